@@ -0,0 +1,596 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+
+#############################################################################
+#  Copyright & License:
+#  ====================
+#
+#  Copyright 2009-2020 gAGE/UPC & ESA
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#############################################################################
+
+#############################################################################
+# MODULE DESCRIPTION
+#
+# Name: benchmark
+# Language: python
+#
+# Purpose:
+#  The purpose of this module is to measure the throughput of gLAB in its
+#  main working modes, so releases can be compared on the same workload.
+#
+# Function:
+#  This program builds a deterministic set of input files from the data in
+#  the FILES folder: the observation files are resampled to the requested
+#  rate and duration, AWGN noise with a fixed seed is added with gLAB's
+#  user-defined error mode, and a synthetic SBAS EMS file is generated from
+#  the broadcast ephemerides. Then it runs gLAB in SPP, PPP, SBAS, DGNSS,
+#  SBAS plots and compare orbits modes with each of the requested number of
+#  threads, and prints the epochs processed per second and the peak memory
+#  (RSS) of each run. The results can be saved as a baseline, and later runs are
+#  compared with it.
+#
+# Dependencies:
+#  gLAB_linux (built with 'make')
+#
+# Files modified:
+#  WORK/BENCH folder
+#  Baseline file (only with '--save-baseline')
+#
+# Files read:
+#  FILES/TUT0, FILES/TUT6 and FILES/TUT7 data files
+#############################################################################
+
+import sys,os,time,math,datetime,gzip,shutil,subprocess
+from optparse import OptionParser
+
+#Data files used from the FILES folder
+DATAFILES = {
+    "TUT0": ["roap1810.09o.gz","brdc1810.09n.gz","igs15382.sp3.gz","igs05_1525.atx.gz"],
+    "TUT6": ["brdc0800.07n.gz","cod14193.sp3.gz","cod14193.clk.gz","igs05_1402.atx.gz"],
+    "TUT7": ["EBRE0770.10o.gz","GARR0770.10o.gz","brdc0770.10n.gz"]
+}
+
+BINARY = "gLAB_linux"
+
+#Seed for the AWGN noise added to the synthetic observation files
+NOISESEED = 1
+
+#SBAS GEO PRN and IODs used in the synthetic SBAS file
+SBASGEO = 120
+SBASIODP = 1
+SBASIODI = 2
+SBASIONOBANDS = [3,4,5]
+SBASPREAMBLES = [0x53,0x9A,0xC6]
+
+
+############################### RINEX observation files ####################
+
+def readRinexObs(filename):
+    #Read a RINEX v2.11 observation file. It returns the header lines, the
+    #number of observables and a list of epochs (time, {satellite: [[value,LLI,SSI],...]})
+    fd = open(filename)
+    header = []
+    numObs = 0
+    for line in fd:
+        header.append(line.rstrip("\n"))
+        if line[60:79] == "# / TYPES OF OBSERV" and line[0:6].strip() != "":
+            numObs = int(line[0:6])
+        if line[60:73] == "END OF HEADER":
+            break
+    linesSat = (numObs+4)//5
+    epochs = []
+    line = fd.readline()
+    while line:
+        if line.strip() == "":
+            line = fd.readline()
+            continue
+        flag = int(line[28:29] or 0)
+        numSat = int(line[29:32])
+        if flag > 1:
+            #Event flag: skip the special records
+            for i in range(numSat):
+                fd.readline()
+            line = fd.readline()
+            continue
+        sec = float(line[15:26])
+        t = datetime.datetime(2000+int(line[1:3]) if int(line[1:3]) < 80 else 1900+int(line[1:3]),int(line[4:6]),int(line[7:9]),
+                              int(line[10:12]),int(line[13:15]))+datetime.timedelta(seconds=sec)
+        sats = []
+        satLine = line
+        for i in range(numSat):
+            if i > 0 and i%12 == 0:
+                satLine = fd.readline()
+            pos = 32+3*(i%12)
+            sat = satLine[pos:pos+3]
+            #A blank system identifier means GPS (the PRN may also be padded with a blank)
+            if sat[0] == " ":
+                sat = "G"+sat[1:]
+            sats.append(sat)
+        data = {}
+        for sat in sats:
+            values = []
+            for i in range(linesSat):
+                obsLine = fd.readline().rstrip("\n").ljust(80)
+                for j in range(5):
+                    if len(values) == numObs:
+                        break
+                    field = obsLine[16*j:16*j+16]
+                    if field[0:14].strip() == "":
+                        values.append(None)
+                    else:
+                        values.append([float(field[0:14]),field[14:15],field[15:16]])
+            data[sat] = values
+        epochs.append((t,data))
+        line = fd.readline()
+    fd.close()
+    return header,numObs,epochs
+
+def interpolateObs(epochs, index, t, sat, obs):
+    #Interpolate one observable at time t (between epochs index and index+1)
+    #with a 4-point Lagrange polynomial, or linearly if the satellite is not
+    #in the outer epochs. It returns None if the observable is not in both
+    #neighbour epochs
+    points = []
+    for i in range(index-1,index+3):
+        if i < 0 or i >= len(epochs):
+            continue
+        values = epochs[i][1].get(sat)
+        if values is not None and values[obs] is not None:
+            points.append(((epochs[i][0]-t).total_seconds(),values[obs][0],i))
+    if len([p for p in points if p[2] in (index,index+1)]) < 2:
+        return None
+    if len(points) < 4:
+        points = [p for p in points if p[2] in (index,index+1)]
+    result = 0.
+    for xi,yi,i in points:
+        weight = 1.
+        for xj,yj,j in points:
+            if j != i:
+                weight *= xj/(xj-xi)
+        result += weight*yi
+    return result
+
+def writeRinexObsResampled(filename, header, numObs, epochs, rate, hours):
+    #Write a RINEX v2.11 observation file with the given rate (in seconds)
+    #and duration (in hours) from the first epoch, interpolating the
+    #observables between the epochs of the original file
+    fd = open(filename,"w")
+    for line in header:
+        if line[60:68] == "INTERVAL":
+            line = "%10.3f" % rate
+            line = line.ljust(60)+"INTERVAL"
+        elif line[60:73] == "END OF HEADER":
+            fd.write(("Resampled to %g seconds by gLAB benchmark" % rate).ljust(60)+"COMMENT\n")
+        fd.write(line+"\n")
+    tStart = epochs[0][0]
+    tEnd = tStart+datetime.timedelta(hours=hours)
+    step = datetime.timedelta(seconds=rate)
+    numEpochs = 0
+    index = 0
+    t = tStart
+    while t <= tEnd and t <= epochs[-1][0]:
+        while index+1 < len(epochs) and epochs[index+1][0] <= t:
+            index += 1
+        exact = epochs[index][0] == t
+        data = {}
+        if exact:
+            data = epochs[index][1]
+        elif index+1 < len(epochs):
+            for sat in epochs[index][1]:
+                values = []
+                for obs in range(numObs):
+                    value = interpolateObs(epochs,index,t,sat,obs)
+                    ssi = epochs[index][1][sat][obs]
+                    values.append(None if value is None else [value," ",ssi[2] if ssi is not None else " "])
+                if any(v is not None for v in values):
+                    data[sat] = values
+        if data:
+            sats = sorted(data)
+            sec = t.second+t.microsecond*1E-6
+            line = " %02d %2d %2d %2d %2d%11.7f  0%3d" % (t.year%100,t.month,t.day,t.hour,t.minute,sec,len(sats))
+            for i,sat in enumerate(sats):
+                if i > 0 and i%12 == 0:
+                    fd.write(line+"\n")
+                    line = " "*32
+                line += sat
+            fd.write(line+"\n")
+            for sat in sats:
+                line = ""
+                for obs,value in enumerate(data[sat]):
+                    if value is None:
+                        line += " "*16
+                    else:
+                        line += "%14.3f%s%s" % (value[0],value[1],value[2])
+                    if obs%5 == 4 or obs == numObs-1:
+                        fd.write(line.rstrip()+"\n")
+                        line = ""
+            numEpochs += 1
+        t += step
+    fd.close()
+    return numEpochs
+
+def addNoise(binary, obsFile, outFile, epochs):
+    #Add AWGN noise with a fixed seed to the code and carrier phase
+    #measurements with gLAB's user-defined error mode
+    t = epochs[0][0]
+    doy = t.timetuple().tm_yday
+    errorFile = outFile+".usererror"
+    fd = open(errorFile,"w")
+    fd.write("SoD Length\n")
+    fd.write("Seed %d\n" % NOISESEED)
+    for meas,sigma in (("C1C",0.5),("C1P",0.3),("C2P",0.3),("L1P",0.003),("L2P",0.003)):
+        fd.write("AWGN G0 %s %g %d %d 0 172800\n" % (meas,sigma,t.year,doy))
+    fd.close()
+    runSilent([binary,"-input:obs",obsFile,"-input:usererror",errorFile,"-output:rinex",outFile,"-print:none","--print:progress"])
+
+def runSilent(args):
+    fd = open(os.devnull,"w")
+    ret = subprocess.call(args,stdout=fd,stderr=fd)
+    fd.close()
+    if ret != 0:
+        print ("ERROR: Command '{0:s}' failed".format(" ".join(args)))
+        sys.exit(1)
+
+
+############################### Synthetic SBAS file ########################
+
+def readNavIODE(filename):
+    #Read the IODE of each satellite and time of clock (in seconds of day)
+    #from a RINEX v2 navigation file
+    fd = open(filename)
+    lines = fd.read().split("\n")
+    fd.close()
+    i = 0
+    while "END OF HEADER" not in lines[i]:
+        i += 1
+    i += 1
+    iode = {}
+    while i+7 < len(lines) and lines[i].strip() != "":
+        prn = int(lines[i][0:2])
+        sod = int(lines[i][12:14])*3600+int(lines[i][15:17])*60
+        iode.setdefault(prn,[]).append((sod,int(float(lines[i+1][3:22].replace("D","E")))))
+        i += 8
+    return iode
+
+class SBASEncoder:
+    #Builds SBAS messages (preamble, message type, data and CRC) in EMS format
+
+    def __init__(self, iode):
+        self.iode = iode
+        self.prns = sorted(iode)[:32]
+        self.count = 0
+
+    def iodAt(self, prn, sod):
+        best = self.iode[prn][0]
+        for entry in self.iode[prn]:
+            if entry[0] <= max(sod,0):
+                best = entry
+        return best[1]
+
+    def crc(self, bits):
+        reg = 0
+        for b in bits+[0]*24:
+            reg = (reg << 1) | b
+            if reg & 0x1000000:
+                reg ^= 0x1864CFB
+        return reg
+
+    def message(self, mt, fields):
+        bits = [0]*226
+        preamble = SBASPREAMBLES[self.count%3]
+        self.count += 1
+        for k in range(8):
+            bits[k] = (preamble >> (7-k)) & 1
+        for k in range(6):
+            bits[8+k] = (mt >> (5-k)) & 1
+        for start,n,v in fields:
+            if v < 0:
+                v += 1 << n
+            for k in range(n):
+                bits[start+k] = (v >> (n-1-k)) & 1
+        crc = self.crc(bits)
+        allBits = bits+[(crc >> (23-k)) & 1 for k in range(24)]+[0]*6
+        return "".join("%X" % int("".join(map(str,allBits[k:k+4])),2) for k in range(0,256,4))
+
+    def prc(self, prn, t):
+        return int(round((3*math.sin(t/700.+prn)+prn*0.2)/0.125))
+
+    def mt1(self):
+        fields = [(14+p-1,1,1) for p in self.prns]
+        fields.append((224,2,SBASIODP))
+        return self.message(1,fields)
+
+    def fastCorrections(self, mt, t, iodf):
+        fields = [(14,2,iodf),(16,2,SBASIODP)]
+        for k in range(13):
+            j = (mt-2)*13+k
+            if j < len(self.prns):
+                fields.append((18+12*k,12,self.prc(self.prns[j],t)))
+                fields.append((174+4*k,4,2+(self.prns[j]%5)))
+            else:
+                fields.append((174+4*k,4,15))
+        return self.message(mt,fields)
+
+    def mt7(self):
+        fields = [(14,4,0),(18,2,SBASIODP)]
+        for k in range(51):
+            fields.append((22+4*k,4,1 if k < len(self.prns) else 0))
+        return self.message(7,fields)
+
+    def mt10(self):
+        fields = [(14,10,10),(24,10,5),(34,10,10),(44,9,240),(53,10,40),(63,9,120),(72,10,10),(82,10,10),
+                  (92,9,240),(101,6,4),(107,10,50),(117,9,300),(126,10,20),(136,1,0),(137,1,0),(138,7,3)]
+        return self.message(10,fields)
+
+    def mt25(self, group, t):
+        fields = []
+        for half in range(2):
+            off = 106*half
+            fields.append((14+off,1,0))
+            for k in range(2):
+                j = group*4+half*2+k
+                if j >= len(self.prns):
+                    continue
+                p = self.prns[j]
+                o = off+51*k
+                fields += [(15+o,6,j+1),(21+o,8,self.iodAt(p,t) & 0xFF),(29+o,9,(p%7)-3),
+                           (38+o,9,2-(p%5)),(47+o,9,p%3),(56+o,10,(p%11)-5)]
+            fields.append((117+off,2,SBASIODP))
+        return self.message(25,fields)
+
+    def mt28(self, group):
+        fields = [(14,2,SBASIODP)]
+        for k in range(2):
+            j = group*2+k
+            if j >= len(self.prns):
+                continue
+            o = 105*k
+            fields += [(16+o,6,j+1),(22+o,3,3),(25+o,9,20+j),(34+o,9,30),(43+o,9,25+(j%4)),(52+o,9,15),
+                       (61+o,10,j-10),(71+o,10,5),(81+o,10,-3),(91+o,10,7),(101+o,10,-2),(111+o,10,4)]
+        return self.message(28,fields)
+
+    def mt18(self, band):
+        fields = [(14,4,len(SBASIONOBANDS)),(18,4,band),(22,2,SBASIODI)]
+        fields += [(24+k,1,1) for k in range(201)]
+        return self.message(18,fields)
+
+    def mt26(self, band, block, t):
+        fields = [(14,4,band),(18,4,block)]
+        for k in range(15):
+            give = 16+int(8*(1+math.sin(t/3000.+band+block*0.3+k*0.1)))
+            fields += [(22+13*k,9,give),(31+13*k,4,4+(k%3))]
+        fields.append((217,2,SBASIODI))
+        return self.message(26,fields)
+
+def writeSBASFile(filename, navFile, day, hours):
+    #Write a synthetic EMS file with one message per second, from half an hour
+    #before the given day (so all the corrections are available at the start)
+    #to the given number of hours after it. Fast corrections are sent every
+    #two seconds, and the rest of the messages fill the remaining slots
+    encoder = SBASEncoder(readNavIODE(navFile))
+    slow = []
+    iodf = {2:0,3:0,4:0}
+    fd = open(filename,"w")
+    numMessages = 0
+    for t in range(-1800,int(hours*3600)+1):
+        if t%6 in (0,2,4):
+            mt = 2+(t%6)//2
+            msg = encoder.fastCorrections(mt,t,iodf[mt])
+            iodf[mt] = (iodf[mt]+1)%3
+        else:
+            if not slow:
+                slow = [(1,),(7,),(10,)]+[(25,g) for g in range(8)]+[(28,g) for g in range(16)]
+                if t%300 < 150 or t < -1650:
+                    slow += [(18,b) for b in SBASIONOBANDS]
+                    slow += [(26,b,k) for b in SBASIONOBANDS for k in range(14)]
+            item = slow.pop(0)
+            mt = item[0]
+            if mt == 1: msg = encoder.mt1()
+            elif mt == 7: msg = encoder.mt7()
+            elif mt == 10: msg = encoder.mt10()
+            elif mt == 25: msg = encoder.mt25(item[1],t)
+            elif mt == 28: msg = encoder.mt28(item[1])
+            elif mt == 18: msg = encoder.mt18(item[1])
+            else: msg = encoder.mt26(item[1],item[2],t)
+        d = day+datetime.timedelta(seconds=t)
+        fd.write("%3d %02d %02d %02d %02d %02d %02d %2d %s\n" % (SBASGEO,d.year%100,d.month,d.day,d.hour,d.minute,d.second,mt,msg))
+        numMessages += 1
+    fd.close()
+    return numMessages
+
+
+############################### Benchmark ##################################
+
+def prepareData(rootDir, workDir, binary, rate, hours):
+    #Copy and uncompress the data files, and generate the synthetic files
+    if not os.path.isdir(workDir):
+        os.makedirs(workDir)
+    for tut in sorted(DATAFILES):
+        for name in DATAFILES[tut]:
+            outName = os.path.join(workDir,name[:-3])
+            if os.path.isfile(outName):
+                continue
+            fin = gzip.open(os.path.join(rootDir,"FILES",tut,name),"rb")
+            fout = open(outName,"wb")
+            shutil.copyfileobj(fin,fout)
+            fin.close()
+            fout.close()
+    synthetic = {}
+    for station in ("roap1810.09o","EBRE0770.10o","GARR0770.10o"):
+        header,numObs,epochs = readRinexObs(os.path.join(workDir,station))
+        resampled = os.path.join(workDir,"resampled_"+station)
+        writeRinexObsResampled(resampled,header,numObs,epochs,rate,hours)
+        synthetic[station] = os.path.join(workDir,"bench_"+station)
+        addNoise(binary,resampled,synthetic[station],epochs)
+        os.remove(resampled)
+        os.remove(synthetic[station]+".usererror")
+    synthetic["sbas"] = os.path.join(workDir,"bench_sbas.ems")
+    synthetic["sbasMessages"] = writeSBASFile(synthetic["sbas"],os.path.join(workDir,"brdc0770.10n"),datetime.datetime(2010,3,18),hours)
+    return synthetic
+
+def benchmarkModes(workDir, synthetic, rate):
+    #List of (mode, gLAB arguments, message used to count the epochs)
+    #The number of epochs of SBAS plots mode is the number of messages (seconds) of the SBAS file
+    w = lambda name: os.path.join(workDir,name)
+    dataGap = "%d" % max(40,2*rate)
+    return [
+        ("SPP",["-input:obs",synthetic["roap1810.09o"],"-input:nav",w("brdc1810.09n"),"-pre:dec","%g" % rate],"OUTPUT"),
+        ("PPP",["-input:obs",synthetic["roap1810.09o"],"-input:sp3",w("igs15382.sp3"),"-input:ant",w("igs05_1525.atx"),"-pre:dec","%g" % rate,
+                "-model:clock:deg","1"],"OUTPUT"),
+        ("SBAS",["-input:obs",synthetic["EBRE0770.10o"],"-input:nav",w("brdc0770.10n"),"-input:sbas",synthetic["sbas"],"-pre:geosel","%d" % SBASGEO,
+                 "-pre:dec","%g" % rate,"-pre:cs:datagap",dataGap,"-pre:smoothmin","0"],"OUTPUT"),
+        ("DGNSS",["-input:obs",synthetic["GARR0770.10o"],"-input:dgnss",synthetic["EBRE0770.10o"],"-input:nav",w("brdc0770.10n"),"-pre:dec","%g" % rate,
+                   "-pre:cs:datagap",dataGap,"-pre:dgnss:smoothmin","0"],"OUTPUT"),
+        ("SBASplots",["-input:nav",w("brdc0770.10n"),"-input:sbas",synthetic["sbas"],"-sbasplots:plotarea","-10","30","35","55","-sbasplots:availstep","2",
+                      "-output:sbasavailplots",w("bench_sbasavail.txt"),"-output:sbasriskplots",w("bench_sbasrisk.txt"),
+                      "-output:sbasriskmarplots",w("bench_sbasriskmar.txt"),"-output:sbasionoplots",w("bench_sbasiono.txt")],None),
+        ("CompareOrbits",["-input:nav",w("brdc0800.07n"),"-input:orb",w("cod14193.sp3"),"-input:clk",w("cod14193.clk"),"-input:ant",w("igs05_1402.atx")],"SATDIFF")
+    ]
+
+def countEpochs(outFile, message):
+    #Count the different epochs of the given message in a gLAB output file
+    epochs = set()
+    fd = open(outFile)
+    for line in fd:
+        if line.startswith(message+" "):
+            fields = line.split()
+            epochs.add((fields[1],fields[2],fields[3]))
+    fd.close()
+    return len(epochs)
+
+def runGLAB(binary, args, threads, outFile, repeat):
+    #Run gLAB and return the best wall time (in seconds) and peak RSS (in kB)
+    bestTime = None
+    peakRSS = 0
+    args = args+["-threads","%d" % threads]
+    for i in range(repeat):
+        fd = open(os.devnull,"w")
+        start = time.time()
+        process = subprocess.Popen([binary]+args+["-output:file",outFile],stdout=fd,stderr=fd,cwd=os.path.dirname(outFile))
+        pid,status,usage = os.wait4(process.pid,0)
+        elapsed = time.time()-start
+        process.returncode = status
+        fd.close()
+        if status != 0:
+            print ("ERROR: gLAB failed when running '{0:s}'".format(" ".join([binary]+args)))
+            sys.exit(1)
+        if bestTime is None or elapsed < bestTime:
+            bestTime = elapsed
+        peakRSS = max(peakRSS,usage.ru_maxrss)
+    return bestTime,peakRSS
+
+def readBaseline(filename):
+    #Read a baseline file. Returns its settings line and the results
+    settings = None
+    results = {}
+    if not os.path.isfile(filename):
+        return settings,results
+    fd = open(filename)
+    for line in fd:
+        if line.startswith("#SETTINGS"):
+            settings = line.split(None,1)[1].strip()
+        elif not line.startswith("#") and line.strip() != "":
+            fields = line.split()
+            results[(fields[0],fields[1])] = (float(fields[2]),float(fields[3]))
+    fd.close()
+    return settings,results
+
+def main():
+    rootDir = os.path.dirname(os.path.abspath(__file__))
+    parser = OptionParser(usage="%prog [options]",description="Measure the throughput of gLAB in its main working modes "
+                          "with deterministic synthetic input files, and compare it with a stored baseline.")
+    parser.add_option("--rate",type="float",dest="rate",default=1.,help="Rate (in seconds) of the synthetic observation files [default %default]")
+    parser.add_option("--hours",type="float",dest="hours",default=1.,help="Duration (in hours) of the synthetic input files [default %default]")
+    parser.add_option("--repeat",type="int",dest="repeat",default=3,help="Number of runs of each mode. The fastest one is kept [default %default]")
+    parser.add_option("--threads",dest="threads",default=None,
+                      help="Comma separated list of number of threads to run each mode with [default 1 and the number of CPUs]")
+    parser.add_option("--modes",dest="modes",default=None,help="Comma separated list of modes to run [default all]")
+    parser.add_option("--baseline",dest="baseline",default=os.path.join(rootDir,"benchmark_baseline.txt"),
+                      help="Baseline file [default benchmark_baseline.txt in gLAB folder]")
+    parser.add_option("--save-baseline",action="store_true",dest="save",default=False,help="Save the results as the new baseline")
+    parser.add_option("--tolerance",type="float",dest="tolerance",default=10.,
+                      help="Maximum decrease of throughput or increase of peak RSS (in %) before a mode is marked as regression [default %default]")
+    parser.add_option("--workdir",dest="workDir",default=os.path.join(rootDir,"WORK","BENCH"),help="Working folder [default WORK/BENCH]")
+    (options,args) = parser.parse_args()
+    options.workDir = os.path.abspath(options.workDir)
+
+    if options.rate <= 0 or options.hours <= 0 or options.repeat <= 0:
+        parser.error("Rate, duration and number of runs must be greater than 0")
+    binary = os.path.join(rootDir,BINARY)
+    if not os.path.isfile(binary):
+        print ("ERROR: {0:s} not found. Compile it first with 'make'".format(BINARY))
+        sys.exit(1)
+    if options.threads is None:
+        numThreads = [1] if (os.cpu_count() or 1) == 1 else [1,os.cpu_count()]
+    else:
+        try:
+            numThreads = [int(t) for t in options.threads.split(",")]
+        except ValueError:
+            parser.error("Number of threads must be a comma separated list of integers")
+        if min(numThreads) <= 0:
+            parser.error("Number of threads must be greater than 0")
+    settings = "rate=%g hours=%g" % (options.rate,options.hours)
+
+    print ("Generating synthetic input files ({0:s}) in '{1:s}'".format(settings,options.workDir))
+    synthetic = prepareData(rootDir,options.workDir,binary,options.rate,options.hours)
+    modes = benchmarkModes(options.workDir,synthetic,options.rate)
+    if options.modes is not None:
+        selected = [m.strip().lower() for m in options.modes.split(",")]
+        modes = [m for m in modes if m[0].lower() in selected]
+
+    baseSettings,baseline = readBaseline(options.baseline)
+    compare = not options.save and baseSettings == settings and len(baseline) > 0
+    if not options.save and len(baseline) > 0 and baseSettings != settings:
+        print ("WARNING: Baseline '{0:s}' was made with '{1:s}'. Results are not compared".format(options.baseline,baseSettings))
+
+    print ("{0:<14s} {1:>7s} {2:>8s} {3:>9s} {4:>10s} {5:>10s}{6:s}".format("Mode","Threads","Epochs","Time[s]","Epochs/s","PeakRSS[MB]",
+           "   vsBaseline" if compare else ""))
+    results = []
+    regressions = 0
+    for mode,args,message in modes:
+        for threads in numThreads:
+            name = "%d" % threads
+            outFile = os.path.join(options.workDir,"bench_%s_%dthreads.out" % (mode,threads))
+            elapsed,peakRSS = runGLAB(binary,args,threads,outFile,options.repeat)
+            epochs = synthetic["sbasMessages"] if message is None else countEpochs(outFile,message)
+            throughput = epochs/elapsed if elapsed > 0 else 0.
+            results.append((mode,name,throughput,peakRSS))
+            line = "{0:<14s} {1:>7s} {2:>8d} {3:>9.3f} {4:>10.1f} {5:>10.1f}".format(mode,name,epochs,elapsed,throughput,peakRSS/1024.)
+            if compare and (mode,name) in baseline:
+                baseThroughput,baseRSS = baseline[(mode,name)]
+                change = (throughput/baseThroughput-1.)*100. if baseThroughput > 0 else 0.
+                status = "OK"
+                if change < -options.tolerance or (baseRSS > 0 and (peakRSS/baseRSS-1.)*100. > options.tolerance):
+                    status = "REGRESSION"
+                    regressions += 1
+                line += "   {0:+7.1f}% {1:s}".format(change,status)
+            print (line)
+            sys.stdout.flush()
+
+    if options.save:
+        fd = open(options.baseline,"w")
+        fd.write("#gLAB benchmark baseline\n")
+        fd.write("#SETTINGS %s\n" % settings)
+        fd.write("#Mode Threads Epochs/s PeakRSS[kB]\n")
+        for result in results:
+            fd.write("%s %s %.3f %d\n" % result)
+        fd.close()
+        print ("Baseline saved to '{0:s}'".format(options.baseline))
+    elif regressions > 0:
+        print ("{0:d} mode(s) with throughput or memory regression over {1:g}%".format(regressions,options.tolerance))
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
@@ -60,12 +60,14 @@ SOURCES += main.cpp \
     showOrbits.cpp \
     coord_converter.cpp \
     date_converter.cpp \
-    adderror_rinex.cpp
+    adderror_rinex.cpp \
+    glab_runner.cpp
 
 HEADERS  += \
     glab_gui.h \
     coord_converter.h \
-    date_converter.h
+    date_converter.h \
+    glab_runner.h
 
 FORMS    += \
     glab_gui.ui \
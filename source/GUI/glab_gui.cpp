@@ -27,9 +27,9 @@
  * Developers: Deimos Ibanez Segura ( gAGE/UPC )
  *             Jesus Romero Sanchez ( gAGE/UPC )
  *          glab.gage @ upc.edu
- * Files: gLAB.pro coord_converter.h date_converter.h glab_gui.h adderror_rinex.cpp analysis.cpp
+ * Files: gLAB.pro coord_converter.h date_converter.h glab_gui.h glab_runner.h adderror_rinex.cpp analysis.cpp
  *        compareOrbits.cpp converter.cpp coord_converter.cpp date_converter.cpp filter.cpp
- *        glab_gui.cpp input.cpp main.cpp modelling.cpp output.cpp preprocess.cpp showOrbits.cpp
+ *        glab_gui.cpp glab_runner.cpp input.cpp main.cpp modelling.cpp output.cpp preprocess.cpp showOrbits.cpp
  *        coord_converter.ui date_converter.ui glab_gui.ui
  *        gAGE.ico gage_logo.png gLAB.icns Header.png igp_grid.jpg Mainlogo.gif warning.png
  *
@@ -471,6 +471,12 @@ gLAB_GUI::gLAB_GUI(QWidget *parent) :
     //Add function for the event of a tab being clicked
     connect(ui->tabWidget, SIGNAL(tabBarClicked(int)), this, SLOT(tabClicked()));
 
+    //gLAB executions are run in the background, and the window is updated from the runner signals
+    runner = new gLABRunner(this);
+    connect(runner, SIGNAL(progressChanged(int)), this, SLOT(runnerProgressChanged(int)));
+    connect(runner, SIGNAL(jobFinished(int,bool,bool,int,QStringList)), this, SLOT(runnerJobFinished(int,bool,bool,int,QStringList)));
+    connect(runner, SIGNAL(allFinished()), this, SLOT(runnerAllFinished()));
+
     //This is to force the QStringList configFileName set space for six positions (each one for a different mode)
     configFileName << "" << "" << "" << "" << "" << "";
 
@@ -3396,6 +3402,92 @@ void gLAB_GUI::on_actionReference_gLAB_triggered() {
 
 void gLAB_GUI::on_pushButtonAbort_clicked() {
     abort=1;
+    runner->abortAll();
+}
+
+// Function to add a gLAB execution to the runner queue and show the progress bar
+void gLAB_GUI::launchGlabJob(QStringList *runString, QPushButton *runButton, QPushButton *showButton, QString outputFile, QString description, bool removeOutputFile) {
+    QString program;
+    TGUIJob job;
+    int jobId;
+
+    #ifdef Q_OS_LINUX
+        program = QString("/gLAB_linux");
+    #elif defined(Q_OS_WIN32)
+        program = QString("\\gLAB.exe");
+    #elif defined(Q_OS_MAC)
+        program = QString("/gLAB_mac");
+    #endif
+
+    //Add hidden parameter to the core so its prints the right lines for the GUI
+    *runString << "-print:guiprogress";
+
+    job.runButton=runButton;
+    job.showButton=showButton;
+    job.outputFile=outputFile;
+    job.description=description;
+    job.removeOutputFile=removeOutputFile;
+
+    jobId=runner->addJob(QDir::toNativeSeparators(qApp->applicationDirPath()+program), *runString);
+    guiJobs.insert(jobId,job);
+
+    //Show Progress bar and Abort button
+    ui->stackedWidgetMainButtons->setCurrentIndex(1);
+    // The window is still usable while gLAB runs
+    this->setCursor(Qt::BusyCursor);
+}
+
+// Function to update the progress bar with the progress of the gLAB jobs
+void gLAB_GUI::runnerProgressChanged(int percentage) {
+    //Currently Qt progress bar cannot display decimals!!!
+    ui->progressBar->setValue(percentage);
+}
+
+// Function to check the result of a gLAB job
+void gLAB_GUI::runnerJobFinished(int jobId, bool started, bool aborted, int exitCode, QStringList log) {
+    QMessageBox messageBox;
+    QString *lastLine = new QString;
+    QString processReadline;
+    QFile fileLock;
+    TGUIJob job;
+
+    if (!guiJobs.contains(jobId)) return;
+    job=guiJobs.take(jobId);
+
+    if (!started) {
+        if (!aborted) messageBox.critical(0, "Errors found", "gLAB could not be executed.\n");
+    } else if (exitCode!=0 && !aborted) {
+        //Check the last line of file for error messages
+        getLastLineOfFile(job.outputFile,lastLine);
+        if ( *lastLine!="" && lastLine->contains("ERROR",Qt::CaseSensitive) && *lastLine!="---" ) {
+            messageBox.critical(0, "Errors found", "gLAB had the following error during " + job.description + ":\n\n" + *lastLine +"\n");
+        } else {
+            //Check if gLAB showed an ERROR in standard output (the output file was not created or existed from previous runs)
+            if (!log.isEmpty()) processReadline=log.last();
+            if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
+                messageBox.critical(0, "Errors found", "gLAB had the following error during " + job.description + ":\n\n" + processReadline +"\n");
+            } else {
+                messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
+            }
+        }
+    }
+    if (started && job.removeOutputFile) {
+        //Remove output file
+        fileLock.remove(job.outputFile);
+    }
+    delete lastLine;
+
+    // Even if errors were found, enable the buttons
+    job.runButton->setEnabled(true);
+    job.showButton->setEnabled(true);
+}
+
+// Function to restore the main buttons when all gLAB jobs have finished
+void gLAB_GUI::runnerAllFinished() {
+    //Hide Progress bar
+    ui->stackedWidgetMainButtons->setCurrentIndex(0);
+    // Restore the cursor
+    this->setCursor(Qt::ArrowCursor);
 }
 
 // Function to execute gLAB
@@ -3405,18 +3497,12 @@ void gLAB_GUI::on_pushButtonRunGlab_clicked() {
     ui->pushButtonRunGlab->setEnabled(false);
     ui->pushButtonShowOutput->setEnabled(false);
     // Declare and initialize
-    QProcess *processRun = new QProcess(this);
-    QString program;
     QMessageBox messageBox;
     QMessageBox::StandardButton reply;
     QString *errorString = new QString;
     QString *warningString = new QString;
     QString *saveString = new QString;
-    QString*lastLine = new QString;
     QStringList *runString = new QStringList;
-    QString processReadline;
-    QChar PercentageCharac = '%';
-    int percentage;
 
     getInputOptions(errorString, warningString, saveString, runString);
     getPreprocessOptions(errorString, warningString, saveString, runString);
@@ -3424,7 +3510,6 @@ void gLAB_GUI::on_pushButtonRunGlab_clicked() {
     getFilterOptions(errorString, warningString, saveString, runString);
     getOutputOptions(errorString, warningString, saveString, runString);
 
-
     if ( *errorString != "" ) {
         messageBox.critical(0, "Errors found",
                             "gLAB has found the following errors, please correct them before executing processing again:\n\n" + *errorString);
@@ -3442,99 +3527,8 @@ void gLAB_GUI::on_pushButtonRunGlab_clicked() {
         }
     }
 
-    #ifdef Q_OS_LINUX
-        program = QString("/gLAB_linux");
-    #elif defined(Q_OS_WIN32)
-        program = QString("\\gLAB.exe");
-    #elif defined(Q_OS_MAC)
-        program = QString("/gLAB_mac");
-    #endif
-
-    //Add hidden parameter to the core so its prints the right lines for the GUI
-    *runString << "-print:guiprogress";
-
-    processRun->setReadChannel(QProcess::StandardOutput);
-
-    abort=0;
-
     // Execute the program
-    processRun->start(QDir::toNativeSeparators(qApp->applicationDirPath()+program), *runString);
-    sleep(10);
-    if ( processRun->state() == 0 ) {
-        messageBox.critical(0, "Errors found", "gLAB could not be executed.\n");
-    } else {
-
-        //Show Progress bar and set it to 0
-        ui->progressBar->setValue(0);
-        ui->stackedWidgetMainButtons->setCurrentIndex(1);
-
-        // Change the cursor to wait mode
-        this->setCursor(Qt::WaitCursor);
-
-        while ( processRun->state() != 0 && abort == 0 ) {
-            if ( processRun->canReadLine() ) {
-                processReadline = processRun->readLine();
-                //Get current percentage from line read
-                if (processReadline[62]!=PercentageCharac) {
-                    //It is not the 100% line
-                    //Currently Qt progress bar cannot display decimals!!!
-                    percentage=processReadline.mid(59,2).toInt();
-                } else {
-                    percentage=100;
-                }
-                //Update progress bar
-                ui->progressBar->setValue(percentage);
-            }
-            sleep(1);
-        }
-
-        //If abort button is clicked, kill the process
-        if (abort==1) {
-            processRun->kill();
-        }
-
-        //Check the exit code
-        if (processRun->exitCode()!=0 && abort==0) {
-            //Check the last line of file for error messages
-            getLastLineOfFile(ui->lineEditOutputDestination->text(),lastLine);
-            if ( (*lastLine=="" || (!lastLine->contains("ERROR",Qt::CaseSensitive))) && *lastLine!="---") {
-                //Check if gLAB showed an ERROR in standard output (the output file existed from previous runs)
-                processReadline="";
-                while ( processRun->canReadLine() ) {
-                    processReadline = processRun->readLine();
-                }
-                if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                    messageBox.critical(0, "Errors found", "gLAB had the following error during the processing:\n\n" + processReadline +"\n");
-                } else {
-                    messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                }
-            } else if (*lastLine!="---") {
-                messageBox.critical(0, "Errors found", "gLAB had the following error during the processing:\n\n" + *lastLine +"\n");
-            } else {
-                //No output file created. Check if gLAB showed an ERROR in standard output before creating the output file
-                processReadline="";
-                while ( processRun->canReadLine() ) {
-                    processReadline = processRun->readLine();
-                }
-                if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                    messageBox.critical(0, "Errors found", "gLAB had the following error during the processing:\n\n" + processReadline +"\n");
-                } else {
-                    messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                }
-            }
-        }
-
-    }
-    // Enable the show output button
-    ui->pushButtonShowOutput->setEnabled(true);
-
-    //Hide Progress bar
-    ui->stackedWidgetMainButtons->setCurrentIndex(0);
-    // Restore the cursor
-    this->setCursor(Qt::ArrowCursor);
-
-    // Even if errors were found, enable the button
-    ui->pushButtonRunGlab->setEnabled(true);
+    launchGlabJob(runString, ui->pushButtonRunGlab, ui->pushButtonShowOutput, ui->lineEditOutputDestination->text(), "the processing", false);
 }
 
 // Function to show the output file
@@ -3724,30 +3718,15 @@ void gLAB_GUI::on_pushButtonConvert_clicked() {
     ui->pushButtonConvert->setEnabled(false);
     ui->pushButtonConvertShowOutput->setEnabled(false);
     // Declare and initialize
-    QProcess *processConvert = new QProcess(this);
-    QString program;
     QMessageBox messageBox;
     QMessageBox::StandardButton reply;
-    QFile fileLock;
 
     QString *errorString = new QString;
     QString *warningString = new QString;
     QString *saveString = new QString;
-    QString *lastLine = new QString;
     QStringList *runString = new QStringList;
-    QString processReadline;
-    QChar PercentageCharac = '%';
-    int percentage;
     int ret;
 
-    #ifdef Q_OS_LINUX
-        program = QString("/gLAB_linux");
-    #elif defined(Q_OS_WIN32)
-        program = QString("\\gLAB.exe");
-    #elif defined(Q_OS_MAC)
-        program = QString("/gLAB_mac");
-    #endif
-
     ret=getConverterOptions(0,errorString, warningString, saveString, runString);
 
     if (ret==1) return; //For the case the user selects not to overwrite files
@@ -3771,87 +3750,8 @@ void gLAB_GUI::on_pushButtonConvert_clicked() {
         }
     }
 
-    //Add hidden parameter to the core so its prints the right lines for the GUI
-    *runString << "-print:guiprogress";
-
-    processConvert->setReadChannel(QProcess::StandardOutput);
-
     // Execute the program
-    processConvert->start(QDir::toNativeSeparators(qApp->applicationDirPath()+program), *runString);
-    sleep(10);
-    if ( processConvert->state() == 0 ) {
-        messageBox.critical(0, "Errors found", "gLAB could not be executed.\n");
-    } else {
-        //Show Abort button
-        abort=0;
-        ui->progressBar->setValue(0);
-        ui->stackedWidgetMainButtons->setCurrentIndex(1);
-        ui->pushButtonConvert->setEnabled(false);
-        ui->pushButtonConvertShowOutput->setEnabled(false);
-        // Change the cursor to wait mode
-        this->setCursor(Qt::WaitCursor);
-        while ( processConvert->state() != 0 && abort==0 ) {
-            if ( processConvert->canReadLine() ) {
-                processReadline = processConvert->readLine();
-                //Get current percentage from line read
-                if (processReadline[25]!=PercentageCharac) {
-                    //It is not the 100% line
-                    //Currently Qt progress bar cannot display decimals!!!
-                    percentage=processReadline.mid(23,2).toInt();
-                } else {
-                    percentage=100;
-                }
-                //Update progress bar
-                ui->progressBar->setValue(percentage);
-            }
-            sleep(1);
-        }
-        if(abort==1) {
-            processConvert->kill();
-        } else {
-            //Check the exit code
-            if (processConvert->exitCode()!=0) {
-                //Check the last line of file for error messages
-                getLastLineOfFile(QDir::toNativeSeparators("./gLAB_conversion.out"),lastLine);
-                if ((*lastLine=="" || (!lastLine->contains("ERROR",Qt::CaseSensitive))) && *lastLine!="---") {
-                    //Check if gLAB showed an ERROR in standard output (the output file existed from previous runs)
-                    processReadline="";
-                    while ( processConvert->canReadLine() ) {
-                        processReadline = processConvert->readLine();
-                    }
-                    if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                        messageBox.critical(0, "Errors found", "gLAB had the following error during the file conversion:\n\n" + processReadline +"\n");
-                    } else {
-                        messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                    }
-                } else if (*lastLine!="---") {
-                    messageBox.critical(0, "Errors found", "gLAB had the following error during the file conversion:\n\n" + *lastLine +"\n");
-                } else {
-                    //No output file created. Check if gLAB showed an ERROR in standard output before creating the output file
-                    processReadline="";
-                    while ( processConvert->canReadLine() ) {
-                        processReadline = processConvert->readLine();
-                    }
-                    if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                        messageBox.critical(0, "Errors found", "gLAB had the following error during the file conversion:\n\n" + processReadline +"\n");
-                    } else {
-                        messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                    }
-                }
-            }
-        }
-        //Remove output file
-        fileLock.remove(QDir::toNativeSeparators("./gLAB_conversion.out"));
-    }
-
-    //Hide Abort Button
-    ui->stackedWidgetMainButtons->setCurrentIndex(0);
-
-    // Enable both Convert and Show Output(s) buttons
-    ui->pushButtonConvert->setEnabled(true);
-    ui->pushButtonConvertShowOutput->setEnabled(true);
-    // Restore the cursor
-    this->setCursor(Qt::ArrowCursor);
+    launchGlabJob(runString, ui->pushButtonConvert, ui->pushButtonConvertShowOutput, QDir::toNativeSeparators("./gLAB_conversion.out"), "the file conversion", true);
 }
 
 // Function to show the orbit comparison output file
@@ -3898,27 +3798,12 @@ void gLAB_GUI::on_pushButtonCompare_clicked() {
     ui->pushButtonCompare->setEnabled(false);
     ui->pushButtonCompareShowOutput->setEnabled(false);
     // Declare and initialize
-    QProcess *processCompare = new QProcess(this);
-    QString program;
     QMessageBox messageBox;
     QMessageBox::StandardButton reply;
     QString *errorString = new QString;
     QString *warningString = new QString;
     QString *saveString = new QString;
-    QString*lastLine = new QString;
     QStringList *runString = new QStringList;
-    QFile fileLock;
-    QString processReadline;
-    int percentage;
-
-
-    #ifdef Q_OS_LINUX
-        program = QString("/gLAB_linux");
-    #elif defined(Q_OS_WIN32)
-        program = QString("\\gLAB.exe");
-    #elif defined(Q_OS_MAC)
-        program = QString("/gLAB_mac");
-    #endif
 
     getCompareOrbitOptions(errorString, warningString, saveString, runString);
 
@@ -3941,82 +3826,8 @@ void gLAB_GUI::on_pushButtonCompare_clicked() {
         }
     }
 
-    //Add hidden parameter to the core so its prints the right lines for the GUI
-    *runString << "-print:guiprogress";
-
-    processCompare->setReadChannel(QProcess::StandardOutput);
-
     // Execute the program
-    processCompare->start(QDir::toNativeSeparators(qApp->applicationDirPath()+program), *runString);
-    sleep(10);
-    if ( processCompare->state() == 0 ) {
-        messageBox.critical(0, "Errors found", "gLAB core could not be executed.\n");
-    } else {
-        //Show Abort button
-        abort=0;
-        ui->pushButtonCompare->setEnabled(false);
-        ui->pushButtonCompareShowOutput->setEnabled(false);
-
-        ui->progressBar->setValue(0);
-        ui->stackedWidgetMainButtons->setCurrentIndex(1);
-        // Change the cursor to wait mode
-        this->setCursor(Qt::WaitCursor);
-
-        while ( processCompare->state() != 0 && abort==0 ) {
-            if ( processCompare->canReadLine() ) {
-                processReadline = processCompare->readLine();
-                //Get current percentage from line read
-                percentage=processReadline.mid(58,3).toInt();
-                ui->progressBar->setValue(percentage);
-            }
-            sleep(1);
-        }
-        if(abort==1) {
-            processCompare->kill();
-        } else {
-            //Check the exit code
-            if (processCompare->exitCode()!=0) {
-                //Check the last line of file for error messages
-                getLastLineOfFile(ui->lineEditOutputFileCompare->text(),lastLine);
-                if ((*lastLine==""  || (!lastLine->contains("ERROR",Qt::CaseSensitive))) && *lastLine!="---") {
-                    //Check if gLAB showed an ERROR in standard output (the output file existed from previous runs)
-                    processReadline="";
-                    while ( processCompare->canReadLine() ) {
-                        processReadline = processCompare->readLine();
-                    }
-                    if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                        messageBox.critical(0, "Errors found", "gLAB had the following error during the orbit comparison:\n\n" + processReadline +"\n");
-                    } else {
-                        messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                    }
-                } else if (*lastLine!="---") {
-                    messageBox.critical(0, "Errors found", "gLAB had the following error during the orbit comparison:\n\n" + *lastLine +"\n");
-                } else {
-                    //No output file created. Check if gLAB showed an ERROR in standard output before creating the output file
-                    processReadline="";
-                    while ( processCompare->canReadLine() ) {
-                        processReadline = processCompare->readLine();
-                    }
-                    if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                        messageBox.critical(0, "Errors found", "gLAB had the following error during the orbit comparison:\n\n" + processReadline +"\n");
-                    } else {
-                        messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                    }
-                }
-            }
-        }
-    }
-    //Hide Abort Button
-    ui->stackedWidgetMainButtons->setCurrentIndex(0);
-
-    // Enable both Convert and Show Output(s) buttons
-    ui->pushButtonCompare->setEnabled(true);
-    ui->pushButtonCompareShowOutput->setEnabled(true);
-
-    // Restore the cursor
-    this->setCursor(Qt::ArrowCursor);
-
-
+    launchGlabJob(runString, ui->pushButtonCompare, ui->pushButtonCompareShowOutput, ui->lineEditOutputFileCompare->text(), "the orbit comparison", false);
 }
 
 // Function to show the orbit show output file
@@ -4063,31 +3874,15 @@ void gLAB_GUI::on_pushButtonShowOrbit_clicked() {
     ui->pushButtonShowOrbit->setEnabled(false);
     ui->pushButtonShowOrbitShowOutput->setEnabled(false);
     // Declare and initialize
-    QProcess *processShowOrbit = new QProcess(this);
-    QString program;
     QMessageBox messageBox;
     QMessageBox::StandardButton reply;
     QString *errorString = new QString;
     QString *warningString = new QString;
     QString *saveString = new QString;
-    QString*lastLine = new QString;
     QStringList *runString = new QStringList;
-    QFile fileLock;
-    QString processReadline;
-    int percentage;
-
-
-    #ifdef Q_OS_LINUX
-        program = QString("/gLAB_linux");
-    #elif defined(Q_OS_WIN32)
-        program = QString("\\gLAB.exe");
-    #elif defined(Q_OS_MAC)
-        program = QString("/gLAB_mac");
-    #endif
 
     getshowOrbitOptions(errorString, warningString, saveString, runString);
 
-
     // Output the errors
     if ( *errorString != "" ) {
         messageBox.critical(0, "Errors found",
@@ -4107,78 +3902,8 @@ void gLAB_GUI::on_pushButtonShowOrbit_clicked() {
         }
     }
 
-    //Add hidden parameter to the core so its prints the right lines for the GUI
-    *runString << "-print:guiprogress";
-
-    processShowOrbit->setReadChannel(QProcess::StandardOutput);
-
     // Execute the program
-    processShowOrbit->start(QDir::toNativeSeparators(qApp->applicationDirPath()+program), *runString);
-    sleep(10);
-    if ( processShowOrbit->state() == 0 ) {
-        messageBox.critical(0, "Errors found", "gLAB core could not be executed.\n");
-    } else {
-        //Show Abort button
-        abort=0;
-        ui->pushButtonShowOrbit->setEnabled(false);
-        ui->pushButtonShowOrbitShowOutput->setEnabled(false);
-        ui->progressBar->setValue(0);
-        ui->stackedWidgetMainButtons->setCurrentIndex(1);
-        // Change the cursor to wait mode
-        this->setCursor(Qt::WaitCursor);
-
-        while ( processShowOrbit->state() != 0 && abort==0 ) {
-            if ( processShowOrbit->canReadLine() ) {
-                processReadline = processShowOrbit->readLine();
-                //Get current percentage from line read
-                percentage=processReadline.mid(58,3).toInt();
-                ui->progressBar->setValue(percentage);
-            }
-            sleep(1);
-        }
-        if(abort==1) {
-            processShowOrbit->kill();
-        } else {
-            //Check the exit code
-            if (processShowOrbit->exitCode()!=0) {
-                //Check the last line of file for error messages
-                getLastLineOfFile(ui->lineEditOutputFileShowOrbit->text(),lastLine);
-                if ( (*lastLine=="" || (!lastLine->contains("ERROR",Qt::CaseSensitive))) && *lastLine!="---" ) {
-                    //Check if gLAB showed an ERROR in standard output (the output file existed from previous runs)
-                    processReadline="";
-                    while ( processShowOrbit->canReadLine() ) {
-                        processReadline = processShowOrbit->readLine();
-                    }
-                    if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                        messageBox.critical(0, "Errors found", "gLAB had the following error during the orbit computation:\n\n" + processReadline +"\n");
-                    } else {
-                        messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                    }
-                } else if (*lastLine!="---") {
-                    messageBox.critical(0, "Errors found", "gLAB had the following error during the orbit computation:\n\n" + *lastLine +"\n");
-                } else {
-                    //No output file created. Check if gLAB showed an ERROR in standard output before creating the output file
-                    processReadline="";
-                    while ( processShowOrbit->canReadLine() ) {
-                        processReadline = processShowOrbit->readLine();
-                    }
-                    if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                        messageBox.critical(0, "Errors found", "gLAB had the following error during the orbit computation:\n\n" + processReadline +"\n");
-                    } else {
-                        messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                    }
-                }
-            }
-        }
-    }
-    //Hide Abort Button
-    ui->stackedWidgetMainButtons->setCurrentIndex(0);
-
-    // Enable both Convert and Show Output(s) buttons
-    ui->pushButtonShowOrbit->setEnabled(true);
-    ui->pushButtonShowOrbitShowOutput->setEnabled(true);
-    // Restore the cursor
-    this->setCursor(Qt::ArrowCursor);
+    launchGlabJob(runString, ui->pushButtonShowOrbit, ui->pushButtonShowOrbitShowOutput, ui->lineEditOutputFileShowOrbit->text(), "the orbit computation", false);
 }
 
 
@@ -4226,31 +3951,15 @@ void gLAB_GUI::on_pushButtonAddError2Rinex_clicked() {
     ui->pushButtonAddError2Rinex->setEnabled(false);
     ui->pushButtonAddErrorShowOutput->setEnabled(false);
     // Declare and initialize
-    QProcess *processAddError = new QProcess(this);
-    QString program;
     QMessageBox messageBox;
     QMessageBox::StandardButton reply;
     QString *errorString = new QString;
     QString *warningString = new QString;
     QString *saveString = new QString;
-    QString*lastLine = new QString;
     QStringList *runString = new QStringList;
-    QFile fileLock;
-    QString processReadline;
-    int percentage;
-
-
-    #ifdef Q_OS_LINUX
-        program = QString("/gLAB_linux");
-    #elif defined(Q_OS_WIN32)
-        program = QString("\\gLAB.exe");
-    #elif defined(Q_OS_MAC)
-        program = QString("/gLAB_mac");
-    #endif
 
     getAddErrorOptions(errorString, warningString, saveString, runString);
 
-
     // Output the errors
     if ( *errorString != "" ) {
         messageBox.critical(0, "Errors found",
@@ -4270,78 +3979,8 @@ void gLAB_GUI::on_pushButtonAddError2Rinex_clicked() {
         }
     }
 
-    //Add hidden parameter to the core so its prints the right lines for the GUI
-    *runString << "-print:guiprogress";
-
-    processAddError->setReadChannel(QProcess::StandardOutput);
-
     // Execute the program
-    processAddError->start(QDir::toNativeSeparators(qApp->applicationDirPath()+program), *runString);
-    sleep(10);
-    if ( processAddError->state() == 0 ) {
-        messageBox.critical(0, "Errors found", "gLAB core could not be executed.\n");
-    } else {
-        //Show Abort button
-        abort=0;
-        ui->pushButtonAddError2Rinex->setEnabled(false);
-        ui->pushButtonAddErrorShowOutput->setEnabled(false);
-        ui->progressBar->setValue(0);
-        ui->stackedWidgetMainButtons->setCurrentIndex(1);
-        // Change the cursor to wait mode
-        this->setCursor(Qt::WaitCursor);
-
-        while ( processAddError->state() != 0 && abort==0 ) {
-            if ( processAddError->canReadLine() ) {
-                processReadline = processAddError->readLine();
-                //Get current percentage from line read
-                percentage=processReadline.mid(58,3).toInt();
-                ui->progressBar->setValue(percentage);
-            }
-            sleep(1);
-        }
-        if(abort==1) {
-            processAddError->kill();
-        } else {
-            //Check the exit code
-            if (processAddError->exitCode()!=0) {
-                //Check the last line of file for error messages
-                getLastLineOfFile(ui->lineEditOutputFileShowOrbit->text(),lastLine);
-                if ( (*lastLine=="" || (!lastLine->contains("ERROR",Qt::CaseSensitive))) && *lastLine!="---" ) {
-                    //Check if gLAB showed an ERROR in standard output (the output file existed from previous runs)
-                    processReadline="";
-                    while ( processAddError->canReadLine() ) {
-                        processReadline = processAddError->readLine();
-                    }
-                    if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                        messageBox.critical(0, "Errors found", "gLAB had the following error during adding user error to RINEX:\n\n" + processReadline +"\n");
-                    } else {
-                        messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                    }
-                } else if (*lastLine!="---") {
-                    messageBox.critical(0, "Errors found", "gLAB had the following error during adding user error to RINEX:\n\n" + *lastLine +"\n");
-                } else {
-                    //No output file created. Check if gLAB showed an ERROR in standard output before creating the output file
-                    processReadline="";
-                    while ( processAddError->canReadLine() ) {
-                        processReadline = processAddError->readLine();
-                    }
-                    if (processReadline.contains("ERROR",Qt::CaseSensitive)) {
-                        messageBox.critical(0, "Errors found", "gLAB had the following error during adding user error to RINEX:\n\n" + processReadline +"\n");
-                    } else {
-                        messageBox.critical(0, "Errors found", "gLAB exited unexpectedly for unknown reason.\n");
-                    }
-                }
-            }
-        }
-    }
-    //Hide Abort Button
-    ui->stackedWidgetMainButtons->setCurrentIndex(0);
-
-    // Enable both Convert and Show Output(s) buttons
-    ui->pushButtonAddError2Rinex->setEnabled(true);
-    ui->pushButtonAddErrorShowOutput->setEnabled(true);
-    // Restore the cursor
-    this->setCursor(Qt::ArrowCursor);
+    launchGlabJob(runString, ui->pushButtonAddError2Rinex, ui->pushButtonAddErrorShowOutput, ui->lineEditOutputFileAddError->text(), "adding user error to RINEX", false);
 }
 
 // Function to show the configuration file
@@ -38,6 +38,8 @@
 #include <QFileInfo>
 #include <QLatin1String>
 #include <QComboBox>
+#include <QPushButton>
+#include <QMap>
 #include <QDebug>
 #include <QTime>
 #include <QTextStream>
@@ -47,6 +49,7 @@
 #include <fstream>
 #include "date_converter.h"
 #include "coord_converter.h"
+#include "glab_runner.h"
 
 #define MIN_EARTH_RADIUS            6356752.
 #define MAX_GNSS                    7
@@ -114,6 +117,15 @@ QTabBar::tab:!selected{background-color:rgb(255, 255, 255);}*/").arg(target->siz
 
 extern int DateConverterWindow;
 
+// gLAB execution launched from the GUI
+typedef struct {
+    QPushButton     *runButton;             //Buttons enabled again when gLAB finishes
+    QPushButton     *showButton;
+    QString         outputFile;             //Output file checked for error messages
+    QString         description;            //Description of the execution for the error messages
+    bool            removeOutputFile;       //Remove the output file when gLAB finishes
+} TGUIJob;
+
 // Main class of the GUI
 class gLAB_GUI : public QMainWindow
 {
@@ -132,6 +144,8 @@ public:
     int SBASmaritime;
     QStringList configFileName;
     QStringList outputFileName;
+    gLABRunner *runner;
+    QMap<int,TGUIJob> guiJobs;
     QString RedColor;
     QString GreenColor;
     //This is a definition of a variable with a pointer to a function type "void" with no parameters for class gLAB_GUI
@@ -162,6 +176,7 @@ private slots:
     bool fileExists(QString path);
     bool directoryExists(QString path);
     void getLastLineOfFile(QString path, QString *lastLine);
+    void launchGlabJob(QStringList *runString, QPushButton *runButton, QPushButton *showButton, QString outputFile, QString description, bool removeOutputFile);
     void extraParametersToWarningStr(int startPos, QString *warningString, QString option, QStringList ParametersList);
     void checkConfigurationFileInputFilePaths (QString FileDescription, QString *warningString, QString *errorString, QString userInput);
     int  GetPRNRangeParam(QString *userInputSingleSpace, QString *option, enum GNSSystem *System, int *StartPRN, int *EndPRN, QString *warningString);
@@ -221,6 +236,9 @@ private slots:
     void on_actionShow_command_line_instruction_triggered();
     void sleep(int millisecondsToWait);
     void on_pushButtonAbort_clicked();
+    void runnerProgressChanged(int percentage);
+    void runnerJobFinished(int jobId, bool started, bool aborted, int exitCode, QStringList log);
+    void runnerAllFinished();
     void on_pushButtonRunGlab_clicked();
     void on_pushButtonShowOutput_clicked();
     void on_pushButtonPlot_clicked();
@@ -0,0 +1,194 @@
+#include "glab_runner.h"
+#include <QThread>
+
+gLABRunnerLog::gLABRunnerLog() :
+    ring(RUNNER_LOG_LINES),
+    first(0),
+    count(0) {
+}
+
+// Function to add a line to the log, dropping the oldest one if it is full
+void gLABRunnerLog::append(const QString &line) {
+    if (count<RUNNER_LOG_LINES) {
+        ring[(first+count)%RUNNER_LOG_LINES]=line;
+        count++;
+    } else {
+        ring[first]=line;
+        first=(first+1)%RUNNER_LOG_LINES;
+    }
+}
+
+// Function to get the lines of the log, from the oldest to the newest
+QStringList gLABRunnerLog::lines() const {
+    QStringList list;
+    for (int i=0;i<count;i++) {
+        list << ring[(first+i)%RUNNER_LOG_LINES];
+    }
+    return list;
+}
+
+gLABRunner::gLABRunner(QObject *parent) :
+    QObject(parent),
+    maxJobs(qMax(1,QThread::idealThreadCount())),
+    nextId(0),
+    batchJobs(0),
+    batchDone(0) {
+}
+
+gLABRunner::~gLABRunner() {
+    //Do not leave gLAB processes running when the GUI is closed
+    foreach (Job *job, running) {
+        job->process->disconnect(this);
+        job->process->kill();
+        job->process->waitForFinished(1000);
+        delete job;
+    }
+    qDeleteAll(queue);
+}
+
+// Function to add a job to the queue. It returns the identifier given in the jobFinished signal
+int gLABRunner::addJob(const QString &program, const QStringList &arguments) {
+    Job *job = new Job;
+    job->id=nextId++;
+    job->program=program;
+    job->arguments=arguments;
+    job->process=NULL;
+    job->percentage=0;
+    job->aborted=false;
+    queue.enqueue(job);
+    batchJobs++;
+    updateProgress();
+    //Jobs are started from the event loop, so no signal of this job is emitted before the caller has its identifier
+    QMetaObject::invokeMethod(this, "startJobs", Qt::QueuedConnection);
+    return job->id;
+}
+
+// Function to set the maximum number of gLAB processes running at the same time
+void gLABRunner::setMaxJobs(int numJobs) {
+    maxJobs=qMax(1,numJobs);
+    startJobs();
+}
+
+// Function to remove the queued jobs and kill the running ones
+void gLABRunner::abortAll() {
+    QList<Job*> waiting;
+    while (!queue.isEmpty()) {
+        waiting << queue.dequeue();
+    }
+    foreach (Job *job, running) {
+        job->aborted=true;
+        job->process->kill();
+    }
+    foreach (Job *job, waiting) {
+        job->aborted=true;
+        finishJob(job,false,-1);
+    }
+}
+
+bool gLABRunner::isIdle() const {
+    return queue.isEmpty() && running.isEmpty();
+}
+
+// Function to start queued jobs until the maximum number of running jobs is reached
+void gLABRunner::startJobs() {
+    while (!queue.isEmpty() && running.size()<maxJobs) {
+        Job *job = queue.dequeue();
+        job->process = new QProcess(this);
+        //Error messages are also kept in the log (and stderr is not buffered without limit)
+        job->process->setProcessChannelMode(QProcess::MergedChannels);
+        job->process->setReadChannel(QProcess::StandardOutput);
+        connect(job->process, SIGNAL(readyReadStandardOutput()), this, SLOT(readOutput()));
+        connect(job->process, SIGNAL(finished(int,QProcess::ExitStatus)), this, SLOT(processFinished(int,QProcess::ExitStatus)));
+        #if QT_VERSION >= QT_VERSION_CHECK(5,6,0)
+            connect(job->process, SIGNAL(errorOccurred(QProcess::ProcessError)), this, SLOT(processError(QProcess::ProcessError)));
+        #else
+            connect(job->process, SIGNAL(error(QProcess::ProcessError)), this, SLOT(processError(QProcess::ProcessError)));
+        #endif
+        running.insert(job->process,job);
+        job->process->start(job->program, job->arguments);
+    }
+}
+
+// Function to read the complete lines available and get the progress from them
+void gLABRunner::readLines(Job *job) {
+    QString line;
+    int pos,start;
+    bool ok;
+    double percentage;
+
+    while (job->process->canReadLine()) {
+        line = QString::fromLocal8Bit(job->process->readLine()).trimmed();
+        job->log.append(line);
+        //The progress lines end with the percentage (e.g. "Percentage converted:  45.3%")
+        pos=line.lastIndexOf('%');
+        if (pos>0) {
+            start=pos;
+            while (start>0 && (line[start-1].isDigit() || line[start-1]=='.')) start--;
+            percentage=line.mid(start,pos-start).toDouble(&ok);
+            if (ok && percentage>=0 && percentage<=100) {
+                job->percentage=percentage;
+            }
+        }
+    }
+}
+
+void gLABRunner::readOutput() {
+    QProcess *process = qobject_cast<QProcess*>(sender());
+    if (!running.contains(process)) return;
+    readLines(running.value(process));
+    updateProgress();
+}
+
+void gLABRunner::processFinished(int exitCode, QProcess::ExitStatus exitStatus) {
+    QProcess *process = qobject_cast<QProcess*>(sender());
+    if (!running.contains(process)) return;
+    Job *job = running.value(process);
+    readLines(job);
+    //Last line without end of line
+    if (process->bytesAvailable()>0) {
+        job->log.append(QString::fromLocal8Bit(process->readAll()).trimmed());
+    }
+    finishJob(job,true,exitStatus==QProcess::NormalExit?exitCode:-1);
+}
+
+void gLABRunner::processError(QProcess::ProcessError error) {
+    QProcess *process = qobject_cast<QProcess*>(sender());
+    //Other errors (such as a crash) are followed by the finished signal
+    if (error!=QProcess::FailedToStart || !running.contains(process)) return;
+    finishJob(running.value(process),false,-1);
+}
+
+// Function to release a job and start the next ones. The state is updated before
+// emitting the signals, as the slots may open dialogs that process other events
+void gLABRunner::finishJob(Job *job, bool started, int exitCode) {
+    int jobId = job->id;
+    bool aborted = job->aborted;
+    QStringList log = job->log.lines();
+
+    if (job->process!=NULL) {
+        running.remove(job->process);
+        job->process->deleteLater();
+    }
+    delete job;
+    batchDone+=100;
+    startJobs();
+    updateProgress();
+
+    emit jobFinished(jobId,started,aborted,exitCode,log);
+
+    if (isIdle() && batchJobs>0) {
+        batchJobs=0;
+        batchDone=0;
+        emit allFinished();
+    }
+}
+
+// Function to compute the progress of all the jobs added since the runner was idle
+void gLABRunner::updateProgress() {
+    double total = batchDone;
+    if (batchJobs<=0) return;
+    foreach (Job *job, running) {
+        total+=job->percentage;
+    }
+    emit progressChanged((int)(total/batchJobs));
+}
@@ -0,0 +1,90 @@
+/*This file is part of gLAB's GUI.
+
+    gLAB's GUI is free software: you can redistribute it and/or modify
+    it under the terms of the Lesser GNU General Public License as published by
+    the Free Software Foundation, either version 3.
+
+    gLAB's GUI is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Lesser GNU General Public License for more details.
+
+    You should have received a copy of the Lesser GNU General Public License
+    along with gLAB's GUI.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GLAB_RUNNER_H
+#define GLAB_RUNNER_H
+
+#include <QObject>
+#include <QProcess>
+#include <QQueue>
+#include <QMap>
+#include <QVector>
+#include <QStringList>
+
+#define RUNNER_LOG_LINES            1000    //Number of lines of the standard output kept for each job
+
+
+// Log of the standard output of a job. Only the last RUNNER_LOG_LINES lines are kept,
+// so a process printing a lot of lines does not make the GUI memory grow
+class gLABRunnerLog
+{
+public:
+    gLABRunnerLog();
+    void append(const QString &line);
+    QStringList lines() const;
+
+private:
+    QVector<QString> ring;
+    int first;
+    int count;
+};
+
+// Runs gLAB processes from a queue. The standard output is read when the process
+// signals that there is data, so the event loop of the GUI is never blocked
+class gLABRunner : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit gLABRunner(QObject *parent = 0);
+    ~gLABRunner();
+    int addJob(const QString &program, const QStringList &arguments);
+    void setMaxJobs(int numJobs);
+    void abortAll();
+    bool isIdle() const;
+
+signals:
+    void progressChanged(int percentage);
+    void jobFinished(int jobId, bool started, bool aborted, int exitCode, const QStringList &log);
+    void allFinished();
+
+private slots:
+    void startJobs();
+    void readOutput();
+    void processFinished(int exitCode, QProcess::ExitStatus exitStatus);
+    void processError(QProcess::ProcessError error);
+
+private:
+    struct Job {
+        int             id;
+        QString         program;
+        QStringList     arguments;
+        QProcess        *process;
+        double          percentage;
+        bool            aborted;
+        gLABRunnerLog   log;
+    };
+    QQueue<Job*>            queue;
+    QMap<QProcess*,Job*>    running;
+    int                     maxJobs;
+    int                     nextId;
+    int                     batchJobs;      //Jobs added since the runner was idle for the last time
+    double                  batchDone;      //Progress of the finished jobs of the batch (100 per job)
+    void readLines(Job *job);
+    void finishJob(Job *job, bool started, int exitCode);
+    void updateProgress();
+};
+
+#endif // GLAB_RUNNER_H
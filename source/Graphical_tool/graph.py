@@ -627,12 +627,14 @@ global PythonVersionDecimal
 global legend
 global LockFile
 global CreateLockFile
+global ColumnCache
 
 legend=False
 PythonVersion=sys.version_info[0]
 PythonVersionDecimal=float(str(sys.version_info[0])+"."+str(sys.version_info[1]))
 LockFile=".plot.lock"
 CreateLockFile=True
+ColumnCache=False
 
 if (sys.platform[:3].lower() != "win"):
     #Tkinter when has an error shows an exception, but is not caught by the try/except
@@ -1936,6 +1938,14 @@ class WIRmap:
             self.StationNames.append(Graph.StaNetWorkDefName)
             self.NumStations.append(0)
 
+        colXCode = compileExpression(self.colX)
+        colYCode = compileExpression(self.colY)
+        colRatioVCode = compileExpression(self.colRatioV)
+        colRatioHCode = compileExpression(self.colRatioH)
+        colMIsVCode = compileExpression(self.colMIsV)
+        colMIsHCode = compileExpression(self.colMIsH)
+        colNameCode = compileExpression(self.colName)
+        ColLabelNameCode = compileExpression(self.ColLabelName)
         i = 0
         for line in f:
             i+=1
@@ -1952,21 +1962,21 @@ class WIRmap:
                         except:
                             j += 1
                     try:
-                        self.longitude.append(float(eval(self.colX)))
-                        self.latitude.append(float(eval(self.colY)))
-                        if self.colRatioV != "": self.ratioV.append(float(eval(self.colRatioV)))
-                        if self.colRatioH != "": self.ratioH.append(float(eval(self.colRatioH)))
-                        if self.colMIsV != "": self.MIsV.append(float(eval(self.colMIsV)))
-                        if self.colMIsH != "": self.MIsH.append(float(eval(self.colMIsH)))
+                        self.longitude.append(float(eval(colXCode)))
+                        self.latitude.append(float(eval(colYCode)))
+                        if self.colRatioV != "": self.ratioV.append(float(eval(colRatioVCode)))
+                        if self.colRatioH != "": self.ratioH.append(float(eval(colRatioHCode)))
+                        if self.colMIsV != "": self.MIsV.append(float(eval(colMIsVCode)))
+                        if self.colMIsH != "": self.MIsH.append(float(eval(colMIsHCode)))
                         if PythonVersion == 2:
-                            if self.colName != "": self.StaName.append(unicode(str(eval(self.colName)), "utf-8", errors="ignore"))
+                            if self.colName != "": self.StaName.append(unicode(str(eval(colNameCode)), "utf-8", errors="ignore"))
                             if self.ColLabelName != "": 
-                                staNetworkName = unicode(str(eval(self.ColLabelName)), "utf-8", errors="ignore")
+                                staNetworkName = unicode(str(eval(ColLabelNameCode)), "utf-8", errors="ignore")
                                 self.StaNetwork.append(staNetworkName)
                         else:
-                            if self.colName != "": self.StaName.append(str(eval(self.colName)))
+                            if self.colName != "": self.StaName.append(str(eval(colNameCode)))
                             if self.ColLabelName != "": 
-                                staNetworkName = str(eval(self.ColLabelName))
+                                staNetworkName = str(eval(ColLabelNameCode))
                                 self.StaNetwork.append(staNetworkName)
                     except:
                         ErrMsg=str(sys.exc_info()[1]).split()
@@ -7325,12 +7335,243 @@ def ParseCallback(option, opt_str, value, parser, Graph):
                 sys.exit()
             
 
+##########################################################################
+# Name        : compileExpression
+# Description : Compile a condition or column expression once, so it is not
+#               parsed again for each line of the data file. If it does not
+#               compile, the string is returned so eval gives the same error
+#               as before
+##########################################################################   
+def compileExpression(expression):
+    try:
+        return compile(expression,"<expression>","eval")
+    except:
+        return expression
+
+##########################################################################
+# Name        : expressionColumns
+# Description : Return the list of columns used by an expression, or None
+#               if it uses 'var' in a way that can not be evaluated by
+#               columns (e.g. 'len(var)' or 'var[-1]')
+##########################################################################   
+def expressionColumns(expression):
+    columns = [int(col) for col in re.findall(r"var\[(\d+)\]",expression)]
+    if "var" in re.sub(r"var\[\d+\]","",expression):
+        return None
+    return columns
+
+##########################################################################
+# Name        : DataColumn
+# Description : Column of a data file loaded in bulk. Comparisons with
+#               strings use the text fields, everything else uses the
+#               numeric values (NaN in lines where the field is missing or
+#               is not a number), so an expression written for one line
+#               is evaluated for all of them at once
+##########################################################################   
+class DataColumn:
+    def __init__(self, values, kind, strings):
+        self.values = values    # Numeric value of the field
+        self.kind = kind        # 0 => Field missing, 1 => Number, 2 => Text
+        self.strings = strings  # Text of the field ('' if it is a number), None if there is no text
+    def __array__(self, dtype=None, copy=None):
+        if dtype is None:
+            return self.values
+        return self.values.astype(dtype)
+    def __bool__(self):
+        raise ValueError("A column has no single truth value")
+    __nonzero__ = __bool__
+    def compareText(self, other, op):
+        if self.strings is None:
+            return np.zeros(len(self.values),dtype=bool)
+        return op(self.strings,other) & (self.kind==2)
+    def compare(self, other, op, text):
+        if isinstance(other, str):
+            return self.compareText(other, op)
+        if isinstance(other, DataColumn):
+            res = op(self.values,other.values)
+            if text and self.strings is not None and other.strings is not None:
+                res = res | (op(self.strings,other.strings) & (self.kind==2) & (other.kind==2))
+            return res
+        return op(self.values,np.asarray(other))
+    def __eq__(self, other): return self.compare(other, lambda a,b: a==b, True)
+    def __ne__(self, other): return ~self.__eq__(other)
+    def __lt__(self, other): return self.compare(other, lambda a,b: a<b, False)
+    def __le__(self, other): return self.compare(other, lambda a,b: a<=b, False)
+    def __gt__(self, other): return self.compare(other, lambda a,b: a>b, False)
+    def __ge__(self, other): return self.compare(other, lambda a,b: a>=b, False)
+    __hash__ = None
+    def __add__(self, other): return self.values + np.asarray(other)
+    def __radd__(self, other): return np.asarray(other) + self.values
+    def __sub__(self, other): return self.values - np.asarray(other)
+    def __rsub__(self, other): return np.asarray(other) - self.values
+    def __mul__(self, other): return self.values * np.asarray(other)
+    def __rmul__(self, other): return np.asarray(other) * self.values
+    def __pow__(self, other): return self.values ** np.asarray(other)
+    def __rpow__(self, other): return np.asarray(other) ** self.values
+    def __neg__(self): return -self.values
+    def __pos__(self): return self.values
+    def __abs__(self): return np.abs(self.values)
+    #A division by zero makes the line not valid (as the exception does when reading line by line)
+    def __truediv__(self, other): return divideColumns(self.values,np.asarray(other,dtype=float))
+    def __rtruediv__(self, other): return divideColumns(np.asarray(other,dtype=float),self.values)
+    __div__ = __truediv__
+    __rdiv__ = __rtruediv__
+    def __mod__(self, other):
+        other = np.asarray(other,dtype=float)
+        return np.where(other==0,np.nan,np.mod(self.values,np.where(other==0,1.,other)))
+
+def divideColumns(num, den):
+    return np.where(den==0,np.nan,num/np.where(den==0,1.,den))
+
+##########################################################################
+# Name        : vectorMathModule
+# Description : Module with the same names as 'math' but working with 
+#               numpy arrays, for using it in the column expressions
+##########################################################################   
+def vectorMathModule():
+    numpyNames = {"asin":"arcsin","acos":"arccos","atan":"arctan","atan2":"arctan2","pow":"power",
+                  "asinh":"arcsinh","acosh":"arccosh","atanh":"arctanh"}
+    vectorMath = type(math)("math")
+    for name in dir(math):
+        if name[0] != "_":
+            setattr(vectorMath,name,getattr(np,numpyNames.get(name,name),getattr(math,name)))
+    return vectorMath
+
+##########################################################################
+# Name        : loadColumns
+# Description : Read the given columns of a data file into DataColumn
+#               objects. With the column cache, each column is stored in
+#               the folder '<file>.colcache' and read from there while the
+#               data file is not modified
+##########################################################################   
+def loadColumns(fileN, columns):
+    columnData = {}
+    numLines = -1
+    cacheDir = fileN + ".colcache"
+    stamp = ""
+    if ColumnCache==True:
+        try:
+            fileStat = os.stat(fileN)
+            stamp = "{0:d} {1:.6f}".format(fileStat.st_size,fileStat.st_mtime)
+            with open(os.path.join(cacheDir,"stamp"),"r") as fstamp:
+                cacheStamp = fstamp.read().split("\n")
+            if cacheStamp[0] == stamp:
+                numLines = int(cacheStamp[1])
+                for col in columns:
+                    try:
+                        with np.load(os.path.join(cacheDir,"col{0:d}.npz".format(col))) as colFile:
+                            strings = colFile["strings"] if colFile["hasText"] else None
+                            columnData[col] = DataColumn(colFile["values"],colFile["kind"],strings)
+                    except:
+                        pass
+            else:
+                for cacheFile in os.listdir(cacheDir):
+                    os.remove(os.path.join(cacheDir,cacheFile))
+        except:
+            pass
+
+    missing = [col for col in columns if col not in columnData]
+    if missing != [] or numLines < 0:
+        if PythonVersion == 2: 
+            f = open(fileN,'rb')
+        else:
+            f = open(fileN,'r',errors='replace')
+        lines = [line.split() for line in f]
+        f.close()
+        numLines = len(lines)
+        for col in missing:
+            values = np.full(numLines,np.nan)
+            kind = np.zeros(numLines,dtype=np.int8)
+            strings = None
+            for i,var in enumerate(lines):
+                if len(var) > col:
+                    try:
+                        values[i] = float(var[col])
+                        kind[i] = 1
+                    except:
+                        if strings is None:
+                            strings = [""]*numLines
+                        strings[i] = var[col]
+                        kind[i] = 2
+            if strings is not None:
+                strings = np.array(strings)
+            columnData[col] = DataColumn(values,kind,strings)
+            if ColumnCache==True:
+                try:
+                    if not os.path.isdir(cacheDir):
+                        os.mkdir(cacheDir)
+                    np.savez(os.path.join(cacheDir,"col{0:d}.npz".format(col)),values=values,kind=kind,
+                             hasText=strings is not None,strings=strings if strings is not None else np.array([""]))
+                    with open(os.path.join(cacheDir,"stamp"),"w") as fstamp:
+                        fstamp.write("{0:s}\n{1:d}\n".format(stamp,numLines))
+                except:
+                    #The cache is optional, plots are done anyway if it can not be written
+                    pass
+    return numLines, columnData
+
+##########################################################################
+# Name        : readFileColumns
+# Description : Evaluate the plotting condition and the X and Y columns for
+#               all the lines at once, with the columns loaded in numpy 
+#               arrays. It returns None when it is not possible (numpy not
+#               available, expressions not valid for arrays or lines that 
+#               would give an error), so the file is read line by line
+##########################################################################   
+def readFileColumns(fileN, cond, colX, colY):
+    global np
+    try:
+        import numpy as np
+    except:
+        return None
+    condCols = expressionColumns(cond) if cond != "" else []
+    xCols = expressionColumns(colX)
+    yCols = expressionColumns(colY)
+    if condCols is None or xCols is None or yCols is None:
+        return None
+    try:
+        numLines, columnData = loadColumns(fileN, sorted(set(condCols+xCols+yCols)))
+    except:
+        return None
+    if numLines < 1:
+        return None
+    namespace = dict(globals())
+    namespace["math"] = vectorMathModule()
+    namespace["var"] = columnData
+    try:
+        with np.errstate(all="ignore"):
+            if cond != "":
+                ret = np.asarray(eval(compileExpression(cond),namespace))==True
+                ret = np.array(np.broadcast_to(ret,(numLines,)))
+                #Lines without the columns used are not valid
+                for col in condCols:
+                    ret &= columnData[col].kind!=0
+            else:
+                ret = np.ones(numLines,dtype=bool)
+            ret1 = np.broadcast_to(np.asarray(eval(compileExpression(colX),namespace),dtype=float),(numLines,))
+            ret2 = np.broadcast_to(np.asarray(eval(compileExpression(colY),namespace),dtype=float),(numLines,))
+    except:
+        return None
+    #The X and Y columns must be numbers in all the selected lines, otherwise the error is given when reading line by line
+    for col in xCols+yCols:
+        if np.any(columnData[col].kind[ret]!=1):
+            return None
+    #Non finite values may come from a division by zero, which is also an error when reading line by line
+    if not (np.all(np.isfinite(ret1[ret])) and np.all(np.isfinite(ret2[ret]))):
+        return None
+    return ret1[ret].tolist(), ret2[ret].tolist()
+
 ##########################################################################
 # Name        : readFile
 # Description : Read the input file, according to the plotting condition,  
 #               assign the value to Xvar and Yvar
 ##########################################################################   
 def readFile(fileN, cond, colX, colY):
+    vectorVars = readFileColumns(fileN, cond, colX, colY)
+    if vectorVars is not None:
+        return vectorVars
+    condCode = compileExpression(cond)
+    colXCode = compileExpression(colX)
+    colYCode = compileExpression(colY)
     try:
         #The 'rb' is to avoid unicode exceptions. In python2 it will not try to encode into utf
         #In Python3, the "errors='replace'" will convert faulty characters to question marks
@@ -7362,15 +7603,15 @@ def readFile(fileN, cond, colX, colY):
                 j += 1
         if (cond != ""):
             try:
-                ret = eval(cond)
+                ret = eval(condCode)
             except:
                 ret = False
         else:
             ret = True
         if (ret==True):
             try:
-                ret1 = float(eval(colX))
-                ret2 = float(eval(colY))
+                ret1 = float(eval(colXCode))
+                ret2 = float(eval(colYCode))
             except:
                 ErrMsg=str(sys.exc_info()[1]).split()
                 if "is not defined" in str(sys.exc_info()[1]):
@@ -7866,6 +8107,12 @@ GRAPHIC GENERAL OPTIONS (default options):
                                                 This option is recommended when multiple instances of this tool
                                                 are executed in parallel.
 
+  --colcache, --ColCache                      Keep the columns read from the data files in a folder named
+                                                '<datafile>.colcache'. Plotting the same file again (for
+                                                instance with a different condition) reads the columns from
+                                                there instead of parsing the file. The cache is discarded
+                                                when the data file changes. Needs numpy.
+
   --colormap,        <colourmapname>          Set the colour map used [DEFAULT: 'jet']
   --ColorMap                                    See full list of colormaps in the following link:
                                                 https://matplotlib.org/users/colormaps.html
@@ -9458,6 +9705,7 @@ GraphicParser.add_option("--XticksList","--xtickslist","--xtl", type="string",de
 GraphicParser.add_option("--YticksList","--ytickslist","--ytl", type="string",dest="YticksList", action="callback",callback=ParseCallback,callback_args=(Graph,),help=optparse.SUPPRESS_HELP)
 GraphicParser.add_option("--AdjustToMargin","--adjusttomargin","--atm",  dest="AdjustToMargin", default=False,action='store_true',help=optparse.SUPPRESS_HELP)
 GraphicParser.add_option("--no-lock-file", dest="NoLockFile", default=False,action='store_true',help=optparse.SUPPRESS_HELP)
+GraphicParser.add_option("--colcache","--ColCache", dest="ColumnCache", default=False,action='store_true',help=optparse.SUPPRESS_HELP)
 GraphicParser.add_option("--colormap","--ColorMap", type="string",dest="ColorMap", action="callback",callback=ParseCallback,callback_args=(Graph,),help=optparse.SUPPRESS_HELP)
 
 GraphicParser.add_option("--numpointslabel","--NumPointsLabel","--npl", type="string",dest="NumPointsLabel", action="callback",callback=ParseCallback,callback_args=(Graph,),help=optparse.SUPPRESS_HELP)
@@ -9725,6 +9973,9 @@ except IOError as e:
 if (opts.NoLockFile==True):
     CreateLockFile=False
 
+if (opts.ColumnCache==True):
+    ColumnCache=True
+
 if (CreateLockFile==True):
     if (os.path.isfile(LockFile) != True) :
         try:
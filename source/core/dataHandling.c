@@ -348,6 +348,10 @@
  *****************************/
 
 /* External classes */
+#if defined (__linux__)
+ //For the CPU affinity functions of sched.h
+ #define _GNU_SOURCE
+#endif
 #include "dataHandling.h"
 #include "input.h"
 #include "output.h"
@@ -356,6 +360,12 @@
 #if defined _OPENMP
  #include <omp.h>
 #endif
+#if defined _OPENMP && defined (__linux__)
+ #include <sched.h>
+#endif
+#if defined (__WIN32__)
+ #include <windows.h>
+#endif
 
 extern char printbufferMODEL[MAX_SATELLITES_VIEWED][MAX_INPUT_LINE];
 extern char printbufferSBASCORR[MAX_SATELLITES_VIEWED][MAX_INPUT_LINE];
@@ -402,6 +412,7 @@ void initOptions (TOptions *options) {
 	strcpy(options->model_dir,"model_files");
 	strcpy(options->tropoGaldir,"TropoGal");
 	strcpy(options->NeQuickdir,"NeQuick");
+	options->productsCacheDir[0]='\0';
 
 	// Verbose options
 	options->printModel = -1;
@@ -433,6 +444,7 @@ void initOptions (TOptions *options) {
 	options->printDGNSSUNUSED = 0;
 
 	options->printSummary = 1;
+	options->printPerf = 0;
 
 	options->ProgressEndCharac='\r';
 
@@ -538,6 +550,7 @@ void initOptions (TOptions *options) {
 	options->filterParams[P0_PAR][BIAS_UNK] = 20 * 20;
 	options->elevationMask = 5. * d2r;
 	options->filterIterations = 1;
+	options->smoother = 0;
 	options->NextSP3 = 0;
 	options->concatenSP3 = 0;
 	options->LastSamplePrevDayOrb=0;
@@ -597,6 +610,7 @@ void initOptions (TOptions *options) {
 	options->GEOfallback = 0;
 	options->MaintainGEO = 1;
 	options->adquisitiontime=GEOACQUISIONTIME;
+	options->SBASseektime=SBASSEEKTIME;
 	options->minimumswitchtime=-1;
 	options->GEOindex = -1;
 	options->GEOPRN = -1;
@@ -654,6 +668,10 @@ void initOptions (TOptions *options) {
  	options->VerAlarmLimit = 50.0;
  	options->HorAlarmLimit = 40.0;
 	options->percentile=95.;
+	options->summarySketch=0;
+	options->summarySaveFile[0]='\0';
+	options->numSummaryMergeFiles=0;
+	options->summaryMergeFiles=NULL;
 	options->SBASPlotsRecHeight = 0;
 	options->NumSBASPlotsExclusionArea=0;
 	options->SBASPlotsExclusionAreaDelimeters=NULL;
@@ -723,9 +741,12 @@ void initOptions (TOptions *options) {
 
 	options->RefDegInterp=0;
 
-	#if defined _OPENMP
-		options->numthreads=omp_get_num_procs();
-	#endif
+	options->numthreads=1;
+	options->threadBind=tbNONE;
+
+	options->followMode=0;
+	options->followLatency=FOLLOWLATENCY;
+	options->followTimeout=0.;
 
 }
 
@@ -767,9 +788,9 @@ void initSatellite (TEpoch *epoch, int satIndex, int satCSindex) {
 
 	for (i=0;i<MAX_SLIDING_WINDOW;i++) {
 		epoch->cycleslip.windowMW[satCSindex][i] = 0.0;
-		epoch->cycleslip.windowMWtime[satCSindex][i] = 0.0;
+		epoch->cycleslip.windowMWtime[satCSindex][i] = 0;
 		epoch->cycleslip.windowL1C1[satCSindex][i] = 0.0;
-		epoch->cycleslip.windowL1C1time[satCSindex][i] = 0.0;
+		epoch->cycleslip.windowL1C1time[satCSindex][i] = 0;
 	}
 }
 
@@ -797,6 +818,7 @@ void initEpoch (TEpoch *epoch, TOptions  *options) {
 	epoch->NewPercentage=0;
 
 	epoch->numSatellites = 0;
+	epoch->obsIndex = NULL;
 	epoch->numAproxPosRead = 0;
 	epoch->lastSBASindex = 0;
 	epoch->prevNumSatellites = 0;
@@ -871,9 +893,9 @@ void initEpoch (TEpoch *epoch, TOptions  *options) {
 		}
 		for (j=0;j<MAX_SLIDING_WINDOW;j++) {
 			epoch->cycleslip.windowMW[i][j] = 0.0;
-			epoch->cycleslip.windowMWtime[i][j] = 0.0;
+			epoch->cycleslip.windowMWtime[i][j] = 0;
 			epoch->cycleslip.windowL1C1[i][j] = 0.0;
-			epoch->cycleslip.windowL1C1time[i][j] = 0.0;
+			epoch->cycleslip.windowL1C1time[i][j] = 0;
 		}
 		// DGNSS
 		epoch->dgnss.msg[i] = 0;
@@ -901,6 +923,7 @@ void initEpoch (TEpoch *epoch, TOptions  *options) {
 			epoch->measOrder[j].conversionFactor[i] = 0;
 			epoch->measOrder[j].usable[i] = 1;
 		}
+		compileCombinationPlans(&epoch->measOrder[j],j);
 		for (i=0;i<MAX_SATELLITES_PER_GNSS;i++) {
 			epoch->satInfo[j][i].lastEclipse.SoD = 0;
 			epoch->satInfo[j][i].lastEclipse.MJDN = 0;
@@ -964,13 +987,13 @@ void initEpoch (TEpoch *epoch, TOptions  *options) {
 	epoch->MaxGDOP = -1.;
 	epoch->MaxVDOP = -1.;
 	epoch->MaxTDOP = -1.;
-	epoch->HError = NULL;
-	epoch->VError = NULL;
-	epoch->HDOP = NULL;
-	epoch->PDOP = NULL;
-	epoch->GDOP = NULL;
-	epoch->VDOP = NULL;
-	epoch->TDOP = NULL;
+	initSummaryStat(&epoch->HError,options->summarySketch);
+	initSummaryStat(&epoch->VError,options->summarySketch);
+	initSummaryStat(&epoch->HDOP,options->summarySketch);
+	initSummaryStat(&epoch->PDOP,options->summarySketch);
+	initSummaryStat(&epoch->GDOP,options->summarySketch);
+	initSummaryStat(&epoch->VDOP,options->summarySketch);
+	initSummaryStat(&epoch->TDOP,options->summarySketch);
 	epoch->StartSummaryEpoch.MJDN=-1;
 	epoch->StartSummaryEpoch.SoD=0.;
 	epoch->LastSummaryEpoch.MJDN=-1;
@@ -1730,8 +1753,8 @@ void initSBASdatabox (TSBASdatabox *SBASdatabox) {
 	SBASdatabox->NumMI = 0;
 	SBASdatabox->NumHMI = 0;
 	SBASdatabox->NumVMI = 0;
-	SBASdatabox->HPL = NULL;
-	SBASdatabox->VPL = NULL;
+	initSummaryStat(&SBASdatabox->HPL,0);
+	initSummaryStat(&SBASdatabox->VPL,0);
 	SBASdatabox->LastEpochAvailPrevCurrDisc.SoD = -1.;
 	SBASdatabox->FirstEpochAvailAfterPrevDisc.SoD = -1.;
 
@@ -2078,11 +2101,19 @@ void initSBASdata (TSBASdata *SBASdata, int pos) {
 		}
 	}
 
+	//Build the IGP index for the empty iono mask
+	SBASupdateIGPindex(&SBASdata[pos]);
+
 	SBASdata[pos].sigmamultipathtype=-1;
 	SBASdata[pos].numsigmamultipath=0;
 	SBASdata[pos].sigmamultipathdata=NULL;
 
 	SBASdata[pos].numSat60=0;
+
+	SBASdata[pos].revision=0;
+	for(i=0;i<MAX_SBASPLOTS_SATELLITES;i++) {
+		SBASdata[pos].satCorr[i].revision=-1;
+	}
 }
 
 /*****************************************************************************
@@ -2317,6 +2348,9 @@ void ClearSBASdata (TSBASdata *SBASdata, int pos) {
 		}
 	}
 
+	//Build the IGP index for the empty iono mask
+	SBASupdateIGPindex(&SBASdata[pos]);
+
 
 
 }
@@ -2436,11 +2470,11 @@ void initSBASPlotsMode (TEpoch *epoch, TSBASPlots *SBASplots, TOptions  *options
 	int 	i,j;
 	
 	//Set the number of satellites in view to 32 (GPS PRN 1-32)
-	epoch->numSatellites=32;
+	epoch->numSatellites=MAX_SBASPLOTS_SATELLITES;
 	//Set last index for SBAS satellite
 	if(options->NoAvailabilityPlot==0) {
 		//We are computing Availability plot, so we will loop through all satellites
-		epoch->lastSBASindex=31;
+		epoch->lastSBASindex=MAX_SBASPLOTS_SATELLITES-1;
 	} else {
 		//We are only computing ionosphere availability plot, so we will use only satellite in position 0 of epoch->sat
 		epoch->lastSBASindex=0;
@@ -3480,6 +3514,169 @@ char *getstr (char *out,char *line,int ini, int length) {
 	return &out[0];
 }
 
+/*****************************************************************************
+ * Name        : parseFieldDigits
+ * Description : Accumulate a run of decimal digits of a fixed-width field into
+ *               an integer. Blocks of eight digits are converted at once with
+ *               64-bit integer arithmetic (SWAR). The mantissa is not updated
+ *               if it would overflow, in which case *overflow is set
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *p                        I  N/A  First character of the run
+ * char  *end                      I  N/A  First character after the field
+ * unsigned long long  *mantissa   IO N/A  Accumulated integer
+ * int  *overflow                  O  N/A  Set to 1 if the mantissa overflowed
+ * Returned value (char*)          O  N/A  First character after the run
+ *****************************************************************************/
+static char *parseFieldDigits (char *p, char *end, unsigned long long *mantissa, int *overflow) {
+	unsigned long long	chunk;
+
+	#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	while (end-p>=8 && *mantissa<100000000000ULL) {
+		memcpy(&chunk,p,8);
+		// All eight bytes must be in '0'..'9'
+		if ( ((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) != 0x3333333333333333ULL ) break;
+		// Combine pairs of digits, then pairs of 2-digit and 4-digit groups
+		chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+		chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+		chunk = ((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+		*mantissa = *mantissa*100000000ULL + chunk;
+		p += 8;
+	}
+	#endif
+	while (p<end && *p>='0' && *p<='9') {
+		if (*mantissa<1000000000000000000ULL) {
+			*mantissa = *mantissa*10 + (unsigned long long)(*p-'0');
+		} else {
+			*overflow = 1;
+		}
+		p++;
+	}
+	return p;
+}
+
+/*****************************************************************************
+ * Name        : getDoubleField
+ * Description : Convert a fixed-width numeric field of a line to double, without
+ *               copying it to an auxiliary string. It gives the same value as
+ *               getstr followed by atof, but 'D' and 'd' are also accepted as 
+ *               exponent character (for RINEX navigation files).
+ *               Fields with up to 15 significant digits and small exponents
+ *               (all the usual RINEX, SP3, CLK and IONEX formats) are converted
+ *               with a single correctly rounded floating point operation. Other
+ *               fields are converted with strtod
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *line                     I  N/A  Input line
+ * int  lineLength                 I  N/A  Length of the line (as given by getL)
+ * int  ini                        I  N/A  Initial character position of the field
+ * int  length                     I  N/A  Length of the field
+ * Returned value (double)         O  N/A  Value of the field (0 if empty)
+ *****************************************************************************/
+double getDoubleField (char *line, int lineLength, int ini, int length) {
+	static const double	pow10[23] = {1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,1e10,1e11,
+									 1e12,1e13,1e14,1e15,1e16,1e17,1e18,1e19,1e20,1e21,1e22};
+	char				*p,*end,*start,*digitsStart;
+	char				aux[MAX_INPUT_LINE];
+	unsigned long long	mantissa = 0;
+	unsigned long long	exponentValue = 0;
+	int					overflow = 0;
+	int					negative = 0;
+	int					exponent;
+	int					numDigits;
+	int					i;
+	double				value;
+
+	if (ini>=lineLength) return 0.;
+	p = &line[ini];
+	end = &line[ini+length>lineLength?lineLength:ini+length];
+
+	while (p<end && *p==' ') p++;
+	if (p==end || *p=='\n' || *p=='\r' || *p=='\0') return 0.;
+	start = p;
+
+	if (*p=='-' || *p=='+') {
+		negative = *p=='-';
+		p++;
+	}
+	digitsStart = p;
+	p = parseFieldDigits(p,end,&mantissa,&overflow);
+	numDigits = (int)(p-digitsStart);
+	exponent = 0;
+	if (p<end && *p=='.') {
+		p++;
+		digitsStart = p;
+		p = parseFieldDigits(p,end,&mantissa,&overflow);
+		exponent = -(int)(p-digitsStart);
+		numDigits += (int)(p-digitsStart);
+	}
+	if (numDigits==0) {
+		// Not a plain number (e.g. 'nan'), leave it to the C library
+		overflow = 1;
+	} else if (p<end && (*p=='E' || *p=='e' || *p=='D' || *p=='d')) {
+		// An exponent character without digits is not part of the number
+		p++;
+		i = 0;
+		if (p<end && (*p=='-' || *p=='+')) {
+			i = *p=='-';
+			p++;
+		}
+		if (p<end && *p>='0' && *p<='9') {
+			parseFieldDigits(p,end,&exponentValue,&overflow);
+			if (exponentValue>1000) overflow = 1;
+			else exponent += i?-(int)exponentValue:(int)exponentValue;
+		}
+	}
+
+	if (!overflow && mantissa<=(1ULL<<53) && exponent>=-22 && exponent<=22) {
+		value = (double)mantissa;
+		if (exponent<0) value /= pow10[-exponent];
+		else value *= pow10[exponent];
+		return negative?-value:value;
+	}
+
+	// Fallback for values out of the exact range
+	for (i=0;start+i<end;i++) {
+		aux[i] = (start[i]=='D' || start[i]=='d')?'E':start[i];
+	}
+	aux[i] = '\0';
+	return strtod(aux,NULL);
+}
+
+/*****************************************************************************
+ * Name        : getIntField
+ * Description : Convert a fixed-width integer field of a line to int, without
+ *               copying it to an auxiliary string. It gives the same value as
+ *               getstr followed by atoi
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *line                     I  N/A  Input line
+ * int  lineLength                 I  N/A  Length of the line (as given by getL)
+ * int  ini                        I  N/A  Initial character position of the field
+ * int  length                     I  N/A  Length of the field
+ * Returned value (int)            O  N/A  Value of the field (0 if empty)
+ *****************************************************************************/
+int getIntField (char *line, int lineLength, int ini, int length) {
+	char	*p,*end;
+	int		negative = 0;
+	int		value = 0;
+
+	if (ini>=lineLength) return 0;
+	p = &line[ini];
+	end = &line[ini+length>lineLength?lineLength:ini+length];
+
+	while (p<end && *p==' ') p++;
+	if (p<end && (*p=='-' || *p=='+')) {
+		negative = *p=='-';
+		p++;
+	}
+	while (p<end && *p>='0' && *p<='9') {
+		value = value*10 + (*p-'0');
+		p++;
+	}
+	return negative?-value:value;
+}
+
 /*****************************************************************************
  * Name        : getnumericalelements
  * Description : Gets the different numbers in a string separated with spaces
@@ -4275,6 +4472,98 @@ char *WeightModeNum2WeightModestr(enum WeightMode weightMode) {
 	return str;
 }
 
+/*****************************************************************************
+ * Name        : setCombinationPlan
+ * Description : Fill one entry of the combination plans of a constellation
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TMeasOrder  *measOrder          IO N/A  TMeasOrder structure
+ * MeasurementType  measType       I  N/A  Combination type
+ * MeasurementType  meas1          I  N/A  First component
+ * MeasurementType  meas2          I  N/A  Second component
+ * double  factor1                 I  N/A  Weight of the first component
+ * double  factor2                 I  N/A  Weight of the second component
+ * double  divisor                 I  N/A  Normalisation of the weighted sum
+ *****************************************************************************/
+void setCombinationPlan (TMeasOrder *measOrder, enum MeasurementType measType, enum MeasurementType meas1, enum MeasurementType meas2, double factor1, double factor2, double divisor) {
+	TCombinationPlan	*plan = &measOrder->combPlan[measType-ENDMEAS];
+
+	plan->available = 1;
+	plan->divergenceFree = 0;
+	plan->meas[0] = meas1;
+	plan->meas[1] = meas2;
+	plan->factor[0] = factor1;
+	plan->factor[1] = factor2;
+	plan->divisor = divisor;
+	plan->alpha2 = 0;
+}
+
+/*****************************************************************************
+ * Name        : compileCombinationPlans
+ * Description : Precompute, for a given constellation, the components and
+ *                 factors of all the measurement combinations, so they do not
+ *                 have to be derived for each satellite and epoch
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TMeasOrder  *measOrder          IO N/A  TMeasOrder structure
+ * GNSSystem  GNSS                 I  N/A  GNSS system of the TMeasOrder
+ *****************************************************************************/
+void compileCombinationPlans (TMeasOrder *measOrder, enum GNSSystem GNSS) {
+	int		i;
+	double	mf1,mf2;
+	double	alpha;
+
+	for (i=0;i<MAX_MEASUREMENTS-ENDMEAS;i++) {
+		measOrder->combPlan[i].available = 0;
+	}
+
+	// Combinations of a single frequency or without frequency factors are defined for all constellations
+	// (in RINEX 2, C1 and L1 are read as C1C and L1P for every constellation)
+	setCombinationPlan(measOrder,PI,C2P,C1P,1.,-1.,1.);
+	setCombinationPlan(measOrder,LI,L1P,L2P,1.,-1.,1.);
+	setCombinationPlan(measOrder,G1C,C1C,L1P,1.,1.,2.);
+	setCombinationPlan(measOrder,G1P,C1P,L1P,1.,1.,2.);
+	setCombinationPlan(measOrder,G2C,C2C,L2P,1.,1.,2.);
+	setCombinationPlan(measOrder,G2P,C2P,L2P,1.,1.,2.);
+
+	// Dual frequency combinations use the frequencies of bands 1 and 2 of the constellation
+	switch ( GNSS ) {
+		case GPS:
+			mf1 = GPSmf1;
+			mf2 = GPSmf2;
+			alpha = ALPHAGPS12;
+			break;
+		case GLONASS:
+			mf1 = GLOmf1;
+			mf2 = GLOmf2;
+			alpha = ALPHAGLO12;
+			break;
+		case BDS:
+			mf1 = BDSmf1;
+			mf2 = BDSmf2;
+			alpha = ALPHABDS12;
+			break;
+		case QZSS:
+			mf1 = QZSSmf1;
+			mf2 = QZSSmf2;
+			alpha = ALPHAGPS12;
+			break;
+		default:
+			// Galileo, SBAS and IRNSS do not transmit in band 2
+			return;
+	}
+
+	setCombinationPlan(measOrder,PW,C1P,C2P,mf1,mf2,mf1+mf2);
+	setCombinationPlan(measOrder,LW,L1P,L2P,mf1,-mf2,mf1-mf2);
+	setCombinationPlan(measOrder,BW,LW,PW,1.,-1.,1.);
+	setCombinationPlan(measOrder,DF,L1P,L2P,1.,-1.,1.);
+	measOrder->combPlan[DF-ENDMEAS].divergenceFree = 1;
+	measOrder->combPlan[DF-ENDMEAS].alpha2 = 2.0 * alpha;
+	setCombinationPlan(measOrder,PC,C1P,C2P,mf1*mf1,-mf2*mf2,mf1*mf1-mf2*mf2);
+	setCombinationPlan(measOrder,PCC,C1C,C2P,mf1*mf1,-mf2*mf2,mf1*mf1-mf2*mf2);
+	setCombinationPlan(measOrder,LC,L1P,L2P,mf1*mf1,-mf2*mf2,mf1*mf1-mf2*mf2);
+}
+
 /*****************************************************************************
  * Name        : getMeasModelValue
  * Description : Get the measurement and model value of a particular satellite
@@ -4292,186 +4581,59 @@ char *WeightModeNum2WeightModestr(enum WeightMode weightMode) {
  *                                        -1 => Found, but not usable
  *****************************************************************************/
 int getMeasModelValue (TEpoch *epoch, enum GNSSystem system, int PRN, enum MeasurementType measType, double *measurement, double *model) {
-	int		ind;
-	int		i,j;
-	double	rawValue;
-	double	conversionFactor;
-	double	align;
-	double	meas1,meas2;
-	double	model1,model2;
-	int		res1,res2;
-	int		usable = 1;
+	int					ind;
+	int					i,j;
+	double				rawValue;
+	double				conversionFactor;
+	double				align;
+	double				meas1,meas2;
+	double				model1,model2;
+	int					usable = 1;
+	TCombinationPlan	*plan;
 
 	// Check if measurement is usable
 	if ( !epoch->measOrder[system].usable[measType] ) usable = 0;
 
-	if ( measType < ENDMEAS ) { // It is a measurement and NOT a combination
-		// If it is a receiver type, that does not has P1, use C1 instead
-		if ( epoch->receiver.recType == rtNOP1 && measType == C1P ) { 
-			measType = C1C;
-		}
-		
-		// Obtain the stored index of the measurement (-1 if not found)
-		ind = epoch->measOrder[system].meas2Ind[measType];
-		
-		// If the measurement is not found, and it can make equivalences between C1 and P1
-		if ( ind == -1 && epoch->receiver.equivalentC1P1 ) { 
-			if ( measType == C1C ) {
-				measType = C1P;
-				ind = epoch->measOrder[system].meas2Ind[measType];
-			} else if ( measType == C1P ) {
-				measType = C1C;
-				ind = epoch->measOrder[system].meas2Ind[measType];
-			} 
-		}
-		if ( ind == -1 ) return 0; // Measurement not found
-	} else if ( measType == PW ) {
-		res1 = getMeasModelValue(epoch,system,PRN,C1P,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,C2P,&meas2,&model2);
-		if ( res1 && res2 ) {
-			if ( measurement != NULL ) *measurement = (GPSmf1*meas1 + GPSmf2*meas2) / (GPSmf1 + GPSmf2);
-			if ( model != NULL ) *model =  (GPSmf1*model1 + GPSmf2*model2) / (GPSmf1 + GPSmf2);
-			if ( usable ) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if ( measType == LW ) {
-		res1 = getMeasModelValue(epoch,system,PRN,L1P,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,L2P,&meas2,&model2);
-		if ( res1 && res2 ) {
-			if ( measurement != NULL ) *measurement = (GPSmf1*meas1 - GPSmf2*meas2) / (GPSmf1 - GPSmf2);
-			if ( model != NULL ) *model =  (GPSmf1*model1 - GPSmf2*model2) / (GPSmf1 - GPSmf2);
-			if ( usable ) return 1;
-			else return -1;
+	if ( measType > ENDMEAS ) { // It is a combination
+		if ( measType >= MAX_MEASUREMENTS ) return 0; // Unknown measurement
+		plan = &epoch->measOrder[system].combPlan[measType-ENDMEAS];
+		if ( !plan->available ) return 0;
+		if ( !getMeasModelValue(epoch,system,PRN,plan->meas[0],&meas1,&model1) ) return 0;
+		if ( !getMeasModelValue(epoch,system,PRN,plan->meas[1],&meas2,&model2) ) return 0;
+		if ( plan->divergenceFree ) {
+			if ( measurement != NULL ) *measurement = meas1 + plan->alpha2 * ( meas1 - meas2 );
+			if ( model != NULL ) *model = model1 + plan->alpha2 * ( model1 - model2 );
 		} else {
-			return 0;
+			if ( measurement != NULL ) *measurement = (plan->factor[0]*meas1 + plan->factor[1]*meas2) / plan->divisor;
+			if ( model != NULL ) *model = (plan->factor[0]*model1 + plan->factor[1]*model2) / plan->divisor;
 		}
-	} else if (measType==BW) {
-		res1 = getMeasModelValue(epoch,system,PRN,LW,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,PW,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = meas1 - meas2;
-			if (model!=NULL) *model =  model1 - model2;
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==PI) {
-		res1 = getMeasModelValue(epoch,system,PRN,C2P,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,C1P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = meas1 - meas2;
-			if (model!=NULL) *model =  model1 - model2;
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==LI) {
-		res1 = getMeasModelValue(epoch,system,PRN,L1P,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,L2P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = meas1 - meas2;
-			if (model!=NULL) *model =  model1 - model2;
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==DF) {
-		res1 = getMeasModelValue(epoch,system,PRN,L1P,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,L2P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = meas1 + 2.0 * ALPHAGPS12 * ( meas1 - meas2 );
-			if (model!=NULL) *model =  model1 + 2.0 * ALPHAGPS12 * ( model1 - model2 );
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==PC) {
-		res1 = getMeasModelValue(epoch,system,PRN,C1P,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,C2P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = (GPSmf1*GPSmf1*meas1 - GPSmf2*GPSmf2*meas2) / (GPSmf1*GPSmf1 - GPSmf2*GPSmf2);
-			if (model!=NULL) *model =  (GPSmf1*GPSmf1*model1 - GPSmf2*GPSmf2*model2) / (GPSmf1*GPSmf1 - GPSmf2*GPSmf2);
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==PCC) {
-		res1 = getMeasModelValue(epoch,system,PRN,C1C,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,C2P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = (GPSmf1*GPSmf1*meas1 - GPSmf2*GPSmf2*meas2) / (GPSmf1*GPSmf1 - GPSmf2*GPSmf2);
-			if (model!=NULL) *model =  (GPSmf1*GPSmf1*model1 - GPSmf2*GPSmf2*model2) / (GPSmf1*GPSmf1 - GPSmf2*GPSmf2);
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==LC) {
-		res1 = getMeasModelValue(epoch,system,PRN,L1P,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,L2P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = (GPSmf1*GPSmf1*meas1 - GPSmf2*GPSmf2*meas2) / (GPSmf1*GPSmf1 - GPSmf2*GPSmf2);
-			if (model!=NULL) *model =  (GPSmf1*GPSmf1*model1 - GPSmf2*GPSmf2*model2) / (GPSmf1*GPSmf1 - GPSmf2*GPSmf2);
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==G1C) {
-		res1 = getMeasModelValue(epoch,system,PRN,C1C,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,L1P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = (meas1 + meas2) / 2.0;
-			if (model!=NULL) *model =  (model1 + model2) / 2.0;
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==G1P) {
-		res1 = getMeasModelValue(epoch,system,PRN,C1P,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,L1P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = (meas1 + meas2) / 2.0;
-			if (model!=NULL) *model =  (model1 + model2) / 2.0;
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==G2C) {
-		res1 = getMeasModelValue(epoch,system,PRN,C2C,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,L2P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = (meas1 + meas2) / 2.0;
-			if (model!=NULL) *model =  (model1 + model2) / 2.0;
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else if (measType==G2P) {
-		res1 = getMeasModelValue(epoch,system,PRN,C2P,&meas1,&model1);
-		res2 = getMeasModelValue(epoch,system,PRN,L2P,&meas2,&model2);
-		if (res1 && res2) {
-			if (measurement!=NULL) *measurement = (meas1 + meas2) / 2.0;
-			if (model!=NULL) *model =  (model1 + model2) / 2.0;
-			if (usable) return 1;
-			else return -1;
-		} else {
-			return 0;
-		}
-	} else {
+		if ( usable ) return 1;
+		else return -1;
+	} else if ( measType == ENDMEAS ) {
 		return 0; // Unknown measurement
 	}
 
+	// It is a measurement and NOT a combination
+	// If it is a receiver type, that does not has P1, use C1 instead
+	if ( epoch->receiver.recType == rtNOP1 && measType == C1P ) { 
+		measType = C1C;
+	}
+	
+	// Obtain the stored index of the measurement (-1 if not found)
+	ind = epoch->measOrder[system].meas2Ind[measType];
+	
+	// If the measurement is not found, and it can make equivalences between C1 and P1
+	if ( ind == -1 && epoch->receiver.equivalentC1P1 ) { 
+		if ( measType == C1C ) {
+			measType = C1P;
+			ind = epoch->measOrder[system].meas2Ind[measType];
+		} else if ( measType == C1P ) {
+			measType = C1C;
+			ind = epoch->measOrder[system].meas2Ind[measType];
+		} 
+	}
+	if ( ind == -1 ) return 0; // Measurement not found
+
 	// Seek satellite
 	i=epoch->satIndex[system][PRN];
 	if (i!=-1) {
@@ -5034,7 +5196,8 @@ TBRDCblock *selectBRDCblock (TBRDCproducts *products, TTime *t, enum GNSSystem G
 	double		diffToe;
 	double		diffToemax; 
 	double		diffLastTransmitted = 9e9;
-	TTime       tGLO;
+	TTimeNs		tNs;
+	TTimeNs		leapSecondsNs;
 	TBRDCblock	*block;
 
 
@@ -5043,6 +5206,12 @@ TBRDCblock *selectBRDCblock (TBRDCproducts *products, TTime *t, enum GNSSystem G
 
 	if (ind==-1 && indPast==-1) return NULL;
 
+	//The reference time is converted once, and the block times are compared in nanoseconds
+	tNs = t2ns(t);
+	//GLONASS toe is in UTC. It is transformed to GPS time
+	if (GNSS==GLONASS) leapSecondsNs = (TTimeNs)products->AT_LS*NSPERSECOND;
+	else leapSecondsNs = 0;
+
 	for(j=0;j<2;j++) {
 		if (indPast==-1 && j==0) continue;
 		if (ind==-1 && j==1) continue;
@@ -5055,21 +5224,9 @@ TBRDCblock *selectBRDCblock (TBRDCproducts *products, TTime *t, enum GNSSystem G
 			else block = &products->block[ind][i];
 			
 			if (SBASIOD!=-1 && block->IODE!=SBASIOD) {continue;}
-			diffTransmitted = tdiff(t,&block->TtransTime);
-			if(GNSS==GLONASS) {
-				tGLO.MJDN=block->Ttoe.MJDN;
-				tGLO.SoD=block->Ttoe.SoD;
-				//Transform from UTC to GPS time
-				tGLO.SoD-=products->AT_LS;
-				if(tGLO.SoD<0) {
-					tGLO.SoD+=86400.;
-					tGLO.MJDN--;
-				}
-				diffToe = tdiff(t,&tGLO);
-				//Tranmission time of message of GLONASS broadcast block is directly saved in GPS time
-			} else {
-				diffToe = tdiff(t,&block->Ttoe);
-			}
+			//Tranmission time of message of GLONASS broadcast block is directly saved in GPS time
+			diffTransmitted = nsdiff(tNs,block->TtransTimeNs);
+			diffToe = nsdiff(tNs,block->TtoeNs-leapSecondsNs);
 			diffToemax = 0.5 * 3600 * block->fitInterval; // Update diffToemax
 
 			if (options->brdcBlockTransTime==0) {
@@ -5121,20 +5278,7 @@ TBRDCblock *selectBRDCblock (TBRDCproducts *products, TTime *t, enum GNSSystem G
 	} else {
 		block = &products->block[ind][selected];
 	}
-	if(GNSS==GLONASS) {
-		tGLO.MJDN=block->Ttoe.MJDN;
-		tGLO.SoD=block->Ttoe.SoD;
-		//Transform from UTC to GPS time
-		tGLO.SoD-=products->AT_LS;
-		if(tGLO.SoD<0) {
-			tGLO.SoD+=86400.;
-			tGLO.MJDN--;
-		}
-		diff = tdiff(t,&tGLO);
-		//Tranmission time of message of GLONASS broadcast block is directly saved in GPS time
-	} else {
-		diff = tdiff(t,&block->Ttoe);
-	}
+	diff = nsdiff(tNs,block->TtoeNs-leapSecondsNs);
 	diffToemax = 0.5*3600*block->fitInterval; // Update diffToemax
 	if (diff<=diffToemax && diff>=-diffToemax) return block;
 	else return NULL;
@@ -5525,6 +5669,283 @@ void getcurrentsystemtime (struct tm *tm) {
 }
 
 
+/*****************************************************************************
+ * Name        : initPerfStats
+ * Description : Initialise the performance instrumentation
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * int  enabled                    I  N/A  0 => Do not time the processing stages
+ *                                         1 => Time the processing stages
+ * FILE  *fdTrace                  I  N/A  File where the Chrome trace is written
+ *                                         (NULL if not used)
+ *****************************************************************************/
+void initPerfStats (int enabled, FILE *fdTrace) {
+	memset(&perfStats,0,sizeof(TPerfStats));
+	perfStats.enabled = enabled;
+	perfStats.fdTrace = fdTrace;
+	perfStats.tStart = perfClock();
+	perfStats.tEpochStart = perfStats.tStart;
+	if (fdTrace!=NULL) {
+		fprintf(fdTrace,"[\n");
+	}
+}
+
+/*****************************************************************************
+ * Name        : freePerfStats
+ * Description : Finish the Chrome trace file of the performance instrumentation
+ * Parameters  : None
+ *****************************************************************************/
+void freePerfStats (void) {
+	if (perfStats.fdTrace!=NULL) {
+		fprintf(perfStats.fdTrace,"\n]\n");
+		fclose(perfStats.fdTrace);
+		perfStats.fdTrace = NULL;
+	}
+	perfStats.enabled = 0;
+}
+
+/*****************************************************************************
+ * Name        : perfClock
+ * Description : Read the monotonic clock used by the performance instrumentation
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * Returned value (double)         O  s    Current value of the clock
+ *****************************************************************************/
+double perfClock (void) {
+	#if defined (__WIN32__)
+		LARGE_INTEGER	counter,frequency;
+
+		QueryPerformanceCounter(&counter);
+		QueryPerformanceFrequency(&frequency);
+		return (double)counter.QuadPart/(double)frequency.QuadPart;
+	#else
+		struct timespec	ts;
+
+		clock_gettime(CLOCK_MONOTONIC,&ts);
+		return (double)ts.tv_sec + (double)ts.tv_nsec*1E-9;
+	#endif
+}
+
+/*****************************************************************************
+ * Name        : perfStart
+ * Description : Start timing a processing stage
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * Returned value (double)         O  s    Clock at the start of the stage (0 if the
+ *                                         instrumentation is disabled)
+ *****************************************************************************/
+double perfStart (void) {
+	if (perfStats.enabled==0) return 0;
+	return perfClock();
+}
+
+/*****************************************************************************
+ * Name        : perfStop
+ * Description : Add the time since perfStart to a processing stage. It can be
+ *               called from several threads at the same time
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * enum PerfStage  stage           I  N/A  Processing stage
+ * double  tStart                  I  s    Value returned by perfStart
+ *****************************************************************************/
+void perfStop (enum PerfStage stage, double tStart) {
+	double	tEnd,elapsed;
+	int		thread = 0;
+
+	if (perfStats.enabled==0) return;
+
+	tEnd = perfClock();
+	elapsed = tEnd-tStart;
+
+	#pragma omp atomic
+	perfStats.epochTime[stage] += elapsed;
+	#pragma omp atomic
+	perfStats.epochCalls[stage]++;
+
+	if (perfStats.fdTrace!=NULL) {
+		#if defined _OPENMP
+			thread = omp_get_thread_num();
+		#endif
+		#pragma omp critical (perfTrace)
+		{
+			//Complete event ("ph":"X") with time stamps in microseconds
+			fprintf(perfStats.fdTrace,"%s{\"name\":\"%s\",\"cat\":\"gLAB\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+					perfStats.numTraceEvents>0?",\n":"",perfstage2str(stage),(tStart-perfStats.tStart)*1E6,elapsed*1E6,thread);
+			perfStats.numTraceEvents++;
+		}
+	}
+}
+
+/*****************************************************************************
+ * Name        : perfSetEpoch
+ * Description : Set the time of the epoch whose stages are being timed
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TTime  *t                       I  N/A  Time of the epoch read
+ *****************************************************************************/
+void perfSetEpoch (TTime *t) {
+	if (perfStats.enabled==0) return;
+	memcpy(&perfStats.t,t,sizeof(TTime));
+	perfStats.epochPending = 1;
+}
+
+/*****************************************************************************
+ * Name        : perfstage2str
+ * Description : Name of a processing stage of the performance instrumentation
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * enum PerfStage  stage           I  N/A  Processing stage
+ * Returned value (char*)          O  N/A  Name of the stage
+ *****************************************************************************/
+char *perfstage2str (enum PerfStage stage) {
+	switch (stage) {
+		case perfREAD:			return "Read";
+		case perfSBAS:			return "SBAS";
+		case perfPREPROCESS:	return "Preprocess";
+		case perfCYCLESLIPS:	return "CycleSlips";
+		case perfMODEL:			return "Model";
+		case perfORBIT:			return "Orbit";
+		case perfIONO:			return "Iono";
+		case perfTROPO:			return "Tropo";
+		case perfANTENNA:		return "Antenna";
+		case perfFILTER:		return "Filter";
+		case perfCHOLESKY:		return "Cholesky";
+		case perfOUTPUT:		return "Output";
+		default:				return "Unknown";
+	}
+}
+
+/*****************************************************************************
+ * Name        : threadbind2str
+ * Description : Get the name of a thread placement policy
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * enum ThreadBind  bind           I  N/A  Thread placement policy
+ * Returned value (char*)          O  N/A  Name of the policy
+ *****************************************************************************/
+char *threadbind2str (enum ThreadBind bind) {
+	switch (bind) {
+		case tbCLOSE:			return "close";
+		case tbSPREAD:			return "spread";
+		default:				return "none";
+	}
+}
+
+#if defined _OPENMP && defined (__linux__)
+/*****************************************************************************
+ * Name        : readNUMAnode
+ * Description : Mark the NUMA node of the CPUs listed in the sysfs cpulist
+ *               file of a node (with the format "0-3,8,10-11")
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * int  node                       I  N/A  NUMA node number
+ * int  *cpuNode                   IO N/A  NUMA node of each CPU
+ * Returned value (int)            O  N/A  0 => Node does not exist
+ *                                         1 => Node read
+ *****************************************************************************/
+static int readNUMAnode (int node, int *cpuNode) {
+	FILE	*fd;
+	char	filename[100],line[MAX_INPUT_LINE];
+	char	*p;
+	int		first,last,cpu;
+
+	sprintf(filename,"/sys/devices/system/node/node%d/cpulist",node);
+	fd = fopen(filename,"r");
+	if (fd==NULL) return 0;
+	if (fgets(line,MAX_INPUT_LINE,fd)!=NULL) {
+		p = line;
+		while (sscanf(p,"%d",&first)==1) {
+			last = first;
+			while (isdigit((unsigned char)*p)) p++;
+			if (*p=='-') {
+				p++;
+				sscanf(p,"%d",&last);
+				while (isdigit((unsigned char)*p)) p++;
+			}
+			for (cpu=first;cpu<=last && cpu<CPU_SETSIZE;cpu++) {
+				cpuNode[cpu] = node;
+			}
+			if (*p!=',') break;
+			p++;
+		}
+	}
+	fclose(fd);
+	return 1;
+}
+#endif
+
+/*****************************************************************************
+ * Name        : setThreadAffinity
+ * Description : Pin each OpenMP thread to one of the CPUs allowed for the
+ *               process. With 'close' placement the threads fill the CPUs
+ *               of a NUMA node before using the next node, and with 'spread'
+ *               placement consecutive threads go to different NUMA nodes.
+ *               It must be called after setting the number of threads, as
+ *               OpenMP keeps the same threads for the following parallel
+ *               regions. It only has effect in Linux
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TOptions  *options              I  N/A  TOptions structure
+ *****************************************************************************/
+void setThreadAffinity (TOptions *options) {
+	#if defined _OPENMP && defined (__linux__)
+		cpu_set_t	allowed;
+		int			cpuNode[CPU_SETSIZE];
+		int			cpuList[CPU_SETSIZE];
+		int			numCPUs = 0;
+		int			numNodes = 0;
+		int			node,cpu,round,found,k;
+
+		if (options->threadBind==tbNONE || options->numthreads<=1) return;
+		if (sched_getaffinity(0,sizeof(cpu_set_t),&allowed)!=0) return;
+
+		//CPUs without NUMA information (or systems without sysfs) are considered in node 0
+		memset(cpuNode,0,sizeof(cpuNode));
+		while (numNodes<MAX_NUMA_NODES && readNUMAnode(numNodes,cpuNode)==1) {
+			numNodes++;
+		}
+		if (numNodes==0) numNodes = 1;
+
+		//Sort the allowed CPUs in the order they will be given to the threads
+		if (options->threadBind==tbCLOSE) {
+			for (node=0;node<numNodes;node++) {
+				for (cpu=0;cpu<CPU_SETSIZE;cpu++) {
+					if (CPU_ISSET(cpu,&allowed) && cpuNode[cpu]==node) cpuList[numCPUs++] = cpu;
+				}
+			}
+		} else {
+			//Take the first free CPU of each node in turn
+			for (round=0,found=1;found==1;round++) {
+				found = 0;
+				for (node=0;node<numNodes;node++) {
+					k = 0;
+					for (cpu=0;cpu<CPU_SETSIZE;cpu++) {
+						if (CPU_ISSET(cpu,&allowed) && cpuNode[cpu]==node) {
+							if (k==round) {
+								cpuList[numCPUs++] = cpu;
+								found = 1;
+								break;
+							}
+							k++;
+						}
+					}
+				}
+			}
+		}
+		if (numCPUs==0) return;
+
+		#pragma omp parallel num_threads(options->numthreads)
+		{
+			cpu_set_t	set;
+
+			CPU_ZERO(&set);
+			CPU_SET(cpuList[omp_get_thread_num()%numCPUs],&set);
+			//A pid of 0 in sched_setaffinity is the calling thread
+			sched_setaffinity(0,sizeof(cpu_set_t),&set);
+		}
+	#endif
+}
+
 /*****************************************************************************
  * Name        : tdiff
  * Description : Difference between two internal time structures in seconds, 
@@ -6149,6 +6570,33 @@ double getIonoValue (TIonoMap *ionoMap, int type, double hgt, double lat, double
 	return 9999;
 }
 
+/*****************************************************************************
+ * Name        : getIonoValueTECRMS
+ * Description : Returns both the TEC and RMS values of a ionospheric map cell,
+ *               computing the cell index only once
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TIonoMap  *ionoMap              I  N/A  Ionospheric map structure
+ * double  hgt                     I  km   Height value  
+ * double  lat                     I  deg  Latitude value
+ * double  lon                     I  deg  Longitude value
+ * double  *TEC                    O  TECU TEC value of the cell (9999 if invalid)
+ * double  *RMS                    O  TECU RMS value of the cell (9999 if invalid)
+ *****************************************************************************/
+void getIonoValueTECRMS (TIonoMap *ionoMap, double hgt, double lat, double lon, double *TEC, double *RMS) {
+	int ind;
+
+	ind = ionoHLLto1D(ionoMap,hgt,lat,lon);
+
+	if (ind<0) {
+		*TEC = 9999;
+		*RMS = 9999;
+	} else {
+		*TEC = ionoMap->TEC[ind];
+		*RMS = ionoMap->RMS[ind];
+	}
+}
+
 /*****************************************************************************
  * Name        : getIonoMapTotalSize
  * Description : Returns the total size of a map
@@ -6276,6 +6724,33 @@ double getFPPPValue (TFPPPMap *FPPPMap, int type, double hgt, double lat, double
 	return 9999;
 }
 
+/*****************************************************************************
+ * Name        : getFPPPValueTECSIGMA
+ * Description : Returns both the TEC and SIGMA values of a FPPP map cell,
+ *               computing the cell index only once
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TFPPPMap  *FPPPMap              I  N/A  FPPP map structure
+ * double  hgt                     I  km   Height value  
+ * double  lat                     I  deg  Latitude value
+ * double  lt                      I  deg  Local time value
+ * double  *TEC                    O  TECU TEC value of the cell (9999 if invalid)
+ * double  *SIGMA                  O  TECU SIGMA value of the cell (9999 if invalid)
+ *****************************************************************************/
+void getFPPPValueTECSIGMA (TFPPPMap *FPPPMap, double hgt, double lat, double lt, double *TEC, double *SIGMA) {
+	int ind;
+
+	ind = FPPPHLLto1D(FPPPMap,hgt,lat,lt);
+
+	if (ind<0) {
+		*TEC = 9999;
+		*SIGMA = 9999;
+	} else {
+		*TEC = FPPPMap->TEC[ind];
+		*SIGMA = FPPPMap->SIGMA[ind];
+	}
+}
+
 /*****************************************************************************
  * Name        : getFPPPMapTotalSize
  * Description : Returns the total size of a map
@@ -9057,6 +9532,179 @@ int IGPLatLon2BandNumberIGP (double IGPlat, double IGPlon, int *Bandnumber, int
 	return 1;
 }
 
+/*****************************************************************************
+ * Name        : initIGPnodeTable
+ * Description : Fill the table with the band number and IGP numbers of each
+ *               node of the 5x5 degree IGP grid. The table does not depend on
+ *               the mask, so it is only computed once
+ * Parameters  : None
+ *****************************************************************************/
+static int	IGPnodeTableInitialized=0;
+static int	IGPnodeTableReturn[IGPGRIDNUMLAT][IGPGRIDNUMLON];
+static int	IGPnodeTableBand[IGPGRIDNUMLAT][IGPGRIDNUMLON];
+static int	IGPnodeTableIGP[IGPGRIDNUMLAT][IGPGRIDNUMLON];
+static int	IGPnodeTableIGP90[IGPGRIDNUMLAT][IGPGRIDNUMLON];
+
+void initIGPnodeTable () {
+
+	int	i,j;
+
+	if (IGPnodeTableInitialized==1) return;
+
+	for(i=0;i<IGPGRIDNUMLAT;i++) {
+		for(j=0;j<IGPGRIDNUMLON;j++) {
+			IGPnodeTableReturn[i][j]=IGPLatLon2BandNumberIGP((double)(i*IGPGRIDSTEP-85),(double)(j*IGPGRIDSTEP),&IGPnodeTableBand[i][j],&IGPnodeTableIGP[i][j],&IGPnodeTableIGP90[i][j]);
+		}
+	}
+
+	IGPnodeTableInitialized=1;
+}
+
+/*****************************************************************************
+ * Name        : IGPLatLon2NodePos
+ * Description : Get the position in the IGP node tables for a given latitude
+ *               and longitude. Only coordinates which are exactly a node of the
+ *               5x5 degree grid have a position in the tables
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * double IGPlat                   I  º    Latitude of the IGP (-90º..90º)
+ * double IGPlon                   I  º    Longitude of the IGP
+ * int *latPos                     O  N/A  Latitude position in the node tables
+ * int *lonPos                     O  N/A  Longitude position in the node tables
+ * Returned value (int)            O  N/A  1 => Coordinates are a grid node
+ *                                         0 => Coordinates are not a grid node
+ *****************************************************************************/
+static int IGPLatLon2NodePos (double IGPlat, double IGPlon, int *latPos, int *lonPos) {
+
+	double	lon;
+
+	if (IGPlat<-85. || IGPlat>85.) return 0;
+	lon=modulo(IGPlon+360,360);
+
+	*latPos=(int)((IGPlat+85.)/IGPGRIDSTEP);
+	*lonPos=(int)(lon/IGPGRIDSTEP);
+	if ((double)(*latPos*IGPGRIDSTEP-85)!=IGPlat) return 0;
+	if ((double)(*lonPos*IGPGRIDSTEP)!=lon) return 0;
+	if (*lonPos>=IGPGRIDNUMLON) return 0;
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : IGPLatLon2BandNumberIGPTable
+ * Description : Same as IGPLatLon2BandNumberIGP, but using the precomputed
+ *               values when the coordinates are a node of the 5x5 degree grid
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * double IGPlat                   I  º    Latitude of the IGP (-90º..90º)
+ * double IGPlon                   I  º    Longitude of the IGP (0º..360º)
+ * int *Bandnumber                 O  N/A  Band number (0-10)
+ * int *IGP                        O  N/A  IGP number for bands 0-8 (1-201)
+ * int *IGP90                      O  N/A  IGP number for bands 9-10 (1-192)
+ * Returned value (int)            O  N/A  1 => IGP found
+ *                                         0 => IGP not in map
+ *****************************************************************************/
+int IGPLatLon2BandNumberIGPTable (double IGPlat, double IGPlon, int *Bandnumber, int *IGP, int *IGP90) {
+
+	int	latPos,lonPos;
+
+	if (IGPnodeTableInitialized==0 || IGPLatLon2NodePos(IGPlat,IGPlon,&latPos,&lonPos)==0) {
+		return IGPLatLon2BandNumberIGP(IGPlat,IGPlon,Bandnumber,IGP,IGP90);
+	}
+
+	*Bandnumber=IGPnodeTableBand[latPos][lonPos];
+	*IGP=IGPnodeTableIGP[latPos][lonPos];
+	*IGP90=IGPnodeTableIGP90[latPos][lonPos];
+
+	return IGPnodeTableReturn[latPos][lonPos];
+}
+
+/*****************************************************************************
+ * Name        : SBASupdateIGPindex
+ * Description : Rebuild the IGP index of a GEO for the current iono mask. It
+ *               must be called each time IGPinMask or IGP2Mask are modified
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSBASdata  *SBASdata            IO N/A  TSBASdata struct of the GEO to update
+ *****************************************************************************/
+void SBASupdateIGPindex (TSBASdata *SBASdata) {
+
+	int			i,j;
+	int			Bandnumber,IGP,IGP90;
+	TIGPnode	*node;
+
+	initIGPnodeTable();
+
+	for(i=0;i<11;i++) {
+		for(j=0;j<202;j++) {
+			SBASdata->IGPinCurrentMask[i][j]=SBASdata->IGPinMask[SBASdata->IGP2Mask[i][j]][i][j];
+		}
+	}
+
+	for(i=0;i<IGPGRIDNUMLAT;i++) {
+		for(j=0;j<IGPGRIDNUMLON;j++) {
+			Bandnumber=IGPnodeTableBand[i][j];
+			IGP=IGPnodeTableIGP[i][j];
+			IGP90=IGPnodeTableIGP90[i][j];
+			//IGPs in bands 9 and 10 have priority over bands 0 to 8
+			if (IGP90>0) {
+				if (SBASdata->IGPinCurrentMask[9][IGP90]==1) {
+					Bandnumber=9;
+					IGP=IGP90;
+				} else if (SBASdata->IGPinCurrentMask[10][IGP90]==1) {
+					Bandnumber=10;
+					IGP=IGP90;
+				}
+			}
+			node=&SBASdata->IGPnodeIndex[i][j];
+			node->BandNumber=Bandnumber;
+			node->IGP=IGP;
+			node->inMask=0;
+			if (IGP>0) node->inMask=SBASdata->IGPinCurrentMask[Bandnumber][IGP];
+		}
+	}
+}
+
+/*****************************************************************************
+ * Name        : IGPnodeLookup
+ * Description : Get the IGP (with bands 9 and 10 priority) of a node of the 
+ *               IGP grid and whether it is in the current mask
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * double IGPlat                   I  º    Latitude of the IGP (-90º..90º)
+ * double IGPlon                   I  º    Longitude of the IGP
+ * TSBASdata  *SBASdata            I  N/A  TSBASdata struct of the GEO used
+ * int *Bandnumber                 O  N/A  Band number (0-10)
+ * int *IGP                        O  N/A  IGP number in band
+ * Returned value (int)            O  N/A  1 => IGP is in mask
+ *                                         0 => IGP is not in mask
+ *****************************************************************************/
+static int IGPnodeLookup (double IGPlat, double IGPlon, TSBASdata *SBASdata, int *Bandnumber, int *IGP) {
+
+	int			latPos,lonPos,IGP90;
+	TIGPnode	*node;
+
+	if (IGPLatLon2NodePos(IGPlat,IGPlon,&latPos,&lonPos)==1) {
+		node=&SBASdata->IGPnodeIndex[latPos][lonPos];
+		*Bandnumber=node->BandNumber;
+		*IGP=node->IGP;
+		return node->inMask;
+	}
+
+	IGPLatLon2BandNumberIGP(IGPlat,IGPlon,Bandnumber,IGP,&IGP90);
+	if (IGP90>0) {
+		if (SBASdata->IGPinCurrentMask[9][IGP90]==1) {
+			*Bandnumber=9;
+			*IGP=IGP90;
+		} else if (SBASdata->IGPinCurrentMask[10][IGP90]==1) {
+			*Bandnumber=10;
+			*IGP=IGP90;
+		}
+	}
+	if (*IGP>0) return SBASdata->IGPinCurrentMask[*Bandnumber][*IGP];
+	return 0;
+}
+
 /*****************************************************************************
  * Name        : IGPsearch
  * Description : Given the latitude and longitude of an IPP, the coordinates 
@@ -9072,8 +9720,7 @@ int IGPLatLon2BandNumberIGP (double IGPlat, double IGPlon, int *Bandnumber, int
  * double IGPlon                   I  º    Left-down corner IGP longitude (0º..360º)
  * double lat_inc                  I  º    Latitude increment (in degrees)
  * double lon_inc                  I  º    Longitude increment (in degrees) 
- * int IGPinMask[5][11][202]       I  N/A  Matrix indicating whether an IGP is monitored or not 
- * int IGP2Mask[11][202]           I  N/A  Matrix indicating to what mask correspond the last received for this IPP
+ * TSBASdata  *SBASdata            I  N/A  TSBASdata struct of the GEO used (with its IGP index updated)
  * int *InterpolationMode          O  N/A  Indicates the available InterpolationMode
  *                                           0 Full square in mask with IPP inside
  *                                           [1:4] Triangle in mask with IPP inside (the number indicates the excluded vertex)
@@ -9083,11 +9730,11 @@ int IGPLatLon2BandNumberIGP (double IGPlat, double IGPlon, int *Bandnumber, int
  * int *IGPnumber                  O  N/A  Vector indicating the number in the mask of the IGPs around the IPP 
  * int *IGPBandNumber              O  N/A  Vector indicating the band number of the IGPs around the IPP 
  *****************************************************************************/
-void IGPsearch (double IPPlat, double IPPlon, double IGPlat, double IGPlon, double lat_inc, double lon_inc, int IGPinMask[5][11][202], int IGP2Mask[11][202], int *InterpolationMode, int *IGPnumber, int *IGPBandNumber) {
+void IGPsearch (double IPPlat, double IPPlon, double IGPlat, double IGPlon, double lat_inc, double lon_inc, TSBASdata *SBASdata, int *InterpolationMode, int *IGPnumber, int *IGPBandNumber) {
 
 	double 	IPPlon_aux,IGPlat_aux1,IGPlat_aux2,IGPlon_aux1,IGPlon_aux2,x,y,W;
 	int 	inside,numIGPvalid;
-	int 	Bandnumber1,Bandnumber2,Bandnumber3,Bandnumber4,IGP1,IGP2,IGP3,IGP4,IGP90;
+	int 	Bandnumber1,Bandnumber2,Bandnumber3,Bandnumber4,IGP1,IGP2,IGP3,IGP4;
 	int 	IGP1valid,IGP2valid,IGP3valid,IGP4valid;
  
 	//WARNING:
@@ -9110,50 +9757,12 @@ void IGPsearch (double IPPlat, double IPPlon, double IGPlat, double IGPlon, doub
 		*InterpolationMode=-20;
 		return;
 	}
- 
-	IGPLatLon2BandNumberIGP(IGPlat_aux2,IGPlon_aux2,&Bandnumber1,&IGP1,&IGP90);
-	if (IGP90>0) {
-		if (IGPinMask[IGP2Mask[9][IGP90]][9][IGP90]==1) {
-			Bandnumber1=9;
-			IGP1=IGP90;
-		} else if (IGPinMask[IGP2Mask[10][IGP90]][10][IGP90]==1) {
-			Bandnumber1=10;
-			IGP1=IGP90;
-		}
-	}
 
-	IGPLatLon2BandNumberIGP(IGPlat_aux2,IGPlon_aux1,&Bandnumber2,&IGP2,&IGP90);
-	if (IGP90>0) {
-		if (IGPinMask[IGP2Mask[9][IGP90]][9][IGP90]==1) {
-			Bandnumber2=9;
-			IGP2=IGP90;
-		} else if (IGPinMask[IGP2Mask[10][IGP90]][10][IGP90]==1) {
-			Bandnumber2=10;
-			IGP2=IGP90;
-		}
-	}
-
-	IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon_aux1,&Bandnumber3,&IGP3,&IGP90);
-	if (IGP90>0) {
-		if (IGPinMask[IGP2Mask[9][IGP90]][9][IGP90]==1) {
-			Bandnumber3=9;
-			IGP3=IGP90;
-		} else if (IGPinMask[IGP2Mask[10][IGP90]][10][IGP90]==1) {
-			Bandnumber3=10;
-			IGP3=IGP90;
-		}
-	}
-
-	IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon_aux2,&Bandnumber4,&IGP4,&IGP90);
-	if (IGP90>0) {
-		if (IGPinMask[IGP2Mask[9][IGP90]][9][IGP90]==1) {
-			Bandnumber4=9;
-			IGP4=IGP90;
-		} else if (IGPinMask[IGP2Mask[10][IGP90]][10][IGP90]==1) {
-			Bandnumber4=10;
-			IGP4=IGP90;
-		}
-	}
+	//The IGP index gives for each corner the IGP (with bands 9 and 10 having priority) and if it is in the current mask
+	IGP1valid=IGPnodeLookup(IGPlat_aux2,IGPlon_aux2,SBASdata,&Bandnumber1,&IGP1);
+	IGP2valid=IGPnodeLookup(IGPlat_aux2,IGPlon_aux1,SBASdata,&Bandnumber2,&IGP2);
+	IGP3valid=IGPnodeLookup(IGPlat_aux1,IGPlon_aux1,SBASdata,&Bandnumber3,&IGP3);
+	IGP4valid=IGPnodeLookup(IGPlat_aux1,IGPlon_aux2,SBASdata,&Bandnumber4,&IGP4);
 
 	IGPnumber[1]=IGP1;
 	IGPnumber[2]=IGP2;
@@ -9166,17 +9775,8 @@ void IGPsearch (double IPPlat, double IPPlon, double IGPlat, double IGPlon, doub
  
 
 	//NOTICE that, after introducing the Bands 9 and 10 we will look for IGPs that are only in the Band 9 or 10 (and they are not in the others bands). 
-	//Thence, if these IGPs are not in the mask (i.e, IGPinMask[IGP2Mask[9][IGP90]][9][IGP90]!=1 or IGPinMask[IGP2Mask[10][IGP90]][10][IGP90]!=1), the IGP will set as "0", because it does not exist for the other bands!!!. 
-	//This is the reason why we must to check if the IGP1,IGP2,IGP3 and IGP4 are zero before to use them as matrix index.
-
-	IGP1valid=0;
-	IGP2valid=0;
-	IGP3valid=0;
-	IGP4valid=0;
-	if (IGP1>0) IGP1valid=IGPinMask[IGP2Mask[Bandnumber1][IGP1]][Bandnumber1][IGP1];
-	if (IGP2>0) IGP2valid=IGPinMask[IGP2Mask[Bandnumber2][IGP2]][Bandnumber2][IGP2];
-	if (IGP3>0) IGP3valid=IGPinMask[IGP2Mask[Bandnumber3][IGP3]][Bandnumber3][IGP3];
-	if (IGP4>0) IGP4valid=IGPinMask[IGP2Mask[Bandnumber4][IGP4]][Bandnumber4][IGP4];
+	//Thence, if these IGPs are not in the mask, the IGP will set as "0", because it does not exist for the other bands!!!. 
+	//IGPs set to "0" are never valid in the IGP index.
 		 
 	numIGPvalid=IGP1valid+IGP2valid+IGP3valid+IGP4valid;
 
@@ -9952,6 +10552,436 @@ int qsort_compare_double(const void *a,const void *b) {
     // return an undefined value
 }
 
+/*****************************************************************************
+ * Name        : quickSelectDouble
+ * Description : Find the k-th smallest value of an array of doubles in linear
+ *               (average) time, without fully sorting the array (Wirth's 
+ *               selection algorithm). The array is reordered in place so that
+ *               values[0..k-1] <= values[k] <= values[k+1..n-1]
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * double *values                  IO N/A  Array of values (it is reordered)
+ * int n                           I  N/A  Number of values in the array
+ * int k                           I  N/A  Position (0..n-1) to select
+ * Returned value (double)         O  N/A  k-th smallest value
+ *****************************************************************************/
+double quickSelectDouble (double *values, int n, int k) {
+	int		i,j,l,r;
+	double	pivot,aux;
+
+	l=0;
+	r=n-1;
+	while (l<r) {
+		pivot=values[k];
+		i=l;
+		j=r;
+		do {
+			while (values[i]<pivot) i++;
+			while (pivot<values[j]) j--;
+			if (i<=j) {
+				aux=values[i];
+				values[i]=values[j];
+				values[j]=aux;
+				i++;
+				j--;
+			}
+		} while (i<=j);
+		if (j<k) l=i;
+		if (k<i) r=j;
+	}
+
+	return values[k];
+}
+
+/*****************************************************************************
+ * Name        : medianDouble
+ * Description : Compute the median of an array of doubles using linear time
+ *               selection instead of sorting. The result is the same as 
+ *               sorting the array and taking the central value (or the mean
+ *               of the two central values if the number of values is even)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * double *values                  IO N/A  Array of values (it is reordered)
+ * int n                           I  N/A  Number of values in the array (>0)
+ * Returned value (double)         O  N/A  Median of the values
+ *****************************************************************************/
+double medianDouble (double *values, int n) {
+	int		i;
+	int		half=n/2;
+	double	upper,lower;
+
+	upper=quickSelectDouble(values,n,half);
+	
+	if(n%2==1) {
+		//Numer of values is odd
+		return upper;
+	}
+
+	//Numer of values is even. After the selection, all values below position 'half'
+	//are lower or equal than the upper central value, so the lower central value is their maximum
+	lower=values[0];
+	for(i=1;i<half;i++) {
+		if(values[i]>lower) lower=values[i];
+	}
+
+	return (lower+upper)/2.;
+}
+
+/*****************************************************************************
+ * Name        : initSummaryStat
+ * Description : Initialise a TSummaryStat structure
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSummaryStat  *stat             O  N/A  TSummaryStat structure
+ * int  sketch                     I  N/A  0 => Store all samples for exact percentiles
+ *                                         1 => Store only a histogram (approximate percentiles)
+ *****************************************************************************/
+void initSummaryStat (TSummaryStat *stat, int sketch) {
+	stat->numSamples = 0;
+	stat->allocated = 0;
+	stat->values = NULL;
+	stat->sketch = sketch;
+	stat->numBins = 0;
+	stat->bins = NULL;
+	stat->lnGamma = log((1.+SUMMARY_SKETCH_ACCURACY)/(1.-SUMMARY_SKETCH_ACCURACY));
+	stat->minValue = 0.;
+	stat->maxValue = 0.;
+	if (sketch) {
+		// Bin i contains the values in (MINVALUE*gamma^(i-1), MINVALUE*gamma^i]
+		stat->numBins = (int)ceil(log(SUMMARY_SKETCH_MAXVALUE/SUMMARY_SKETCH_MINVALUE)/stat->lnGamma)+1;
+		stat->bins = calloc(stat->numBins,sizeof(int));
+	}
+}
+
+/*****************************************************************************
+ * Name        : addSummaryStat
+ * Description : Add a sample to a TSummaryStat structure. In exact mode the
+ *               vector of samples grows geometrically, so the cost of adding
+ *               a sample is constant (amortized)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSummaryStat  *stat             IO N/A  TSummaryStat structure
+ * double  value                   I  N/A  Value to add
+ *****************************************************************************/
+void addSummaryStat (TSummaryStat *stat, double value) {
+	int		bin;
+
+	if (stat->numSamples==0 || value<stat->minValue) stat->minValue = value;
+	if (stat->numSamples==0 || value>stat->maxValue) stat->maxValue = value;
+
+	if (stat->sketch) {
+		if (value<=SUMMARY_SKETCH_MINVALUE) {
+			bin = 0;
+		} else {
+			bin = (int)ceil(log(value/SUMMARY_SKETCH_MINVALUE)/stat->lnGamma);
+			if (bin>=stat->numBins) bin = stat->numBins-1;
+		}
+		stat->bins[bin]++;
+	} else {
+		if (stat->numSamples==stat->allocated) {
+			stat->allocated = stat->allocated==0?SUMMARY_STAT_INITIAL_SIZE:2*stat->allocated;
+			stat->values = realloc(stat->values,sizeof(double)*stat->allocated);
+		}
+		stat->values[stat->numSamples] = value;
+	}
+	stat->numSamples++;
+}
+
+/*****************************************************************************
+ * Name        : mergeSummaryStat
+ * Description : Add all the samples of a TSummaryStat structure to another one,
+ *               so summaries of different days or stations can be combined
+ *               without processing the data again. Exact samples can be added
+ *               to a histogram, but not the opposite
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSummaryStat  *stat             IO N/A  TSummaryStat structure where samples are added
+ * TSummaryStat  *statAdd          I  N/A  TSummaryStat structure with the samples to add
+ * Returned value (int)            O  N/A  1 => Merged
+ *                                         0 => Not merged (histogram into exact samples)
+ *****************************************************************************/
+int mergeSummaryStat (TSummaryStat *stat, TSummaryStat *statAdd) {
+	int		i;
+
+	if (statAdd->numSamples==0) return 1;
+
+	if (statAdd->sketch==0) {
+		for (i=0;i<statAdd->numSamples;i++) {
+			addSummaryStat(stat,statAdd->values[i]);
+		}
+		return 1;
+	}
+
+	if (stat->sketch==0) return 0;
+
+	for (i=0;i<stat->numBins;i++) {
+		stat->bins[i] += statAdd->bins[i];
+	}
+	if (stat->numSamples==0 || statAdd->minValue<stat->minValue) stat->minValue = statAdd->minValue;
+	if (stat->numSamples==0 || statAdd->maxValue>stat->maxValue) stat->maxValue = statAdd->maxValue;
+	stat->numSamples += statAdd->numSamples;
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : percentileSummaryStat
+ * Description : Compute a percentile of the samples of a TSummaryStat structure.
+ *               The sample selected is the same as the one in the sorted vector
+ *               of samples (the last one for the 100 percentile). In exact
+ *               mode, the vector of samples is reordered
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSummaryStat  *stat             IO N/A  TSummaryStat structure
+ * double  percentile              I  %    Percentile to compute
+ * Returned value (double)         O  N/A  Percentile value (0 if there are no samples)
+ *****************************************************************************/
+double percentileSummaryStat (TSummaryStat *stat, double percentile) {
+	int		i;
+	int		sample;
+	int		count;
+	double	value;
+
+	if (stat->numSamples==0) return 0.;
+
+	if (percentile==100.) {
+		sample = stat->numSamples-1;
+	} else {
+		sample = (int)((double)(stat->numSamples)*percentile/100.);
+	}
+
+	if (stat->sketch==0) {
+		return quickSelectDouble(stat->values,stat->numSamples,sample);
+	}
+
+	// Extreme values are kept exactly
+	if (sample==0) return stat->minValue;
+	if (sample==stat->numSamples-1) return stat->maxValue;
+
+	count = 0;
+	for (i=0;i<stat->numBins;i++) {
+		count += stat->bins[i];
+		if (count>sample) break;
+	}
+	if (i==0) return stat->minValue;
+	// Centre of the bin (the relative error is below SUMMARY_SKETCH_ACCURACY)
+	value = SUMMARY_SKETCH_MINVALUE*exp((double)(i)*stat->lnGamma)*(1.-SUMMARY_SKETCH_ACCURACY);
+	if (value>stat->maxValue) value = stat->maxValue;
+	if (value<stat->minValue) value = stat->minValue;
+
+	return value;
+}
+
+/*****************************************************************************
+ * Name        : freeSummaryStat
+ * Description : Free the memory of a TSummaryStat structure
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSummaryStat  *stat             IO N/A  TSummaryStat structure
+ *****************************************************************************/
+void freeSummaryStat (TSummaryStat *stat) {
+	free(stat->values);
+	free(stat->bins);
+	initSummaryStat(stat,0);
+}
+
+/*****************************************************************************
+ * Name        : epoch2SummaryData
+ * Description : Copy the summary data of the TEpoch and TStdESA structures to
+ *               a TSummaryData structure. The epochs missing and the last
+ *               epoch of the summary are computed when printing the summary,
+ *               so they must be set by the caller
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TEpoch  *epoch                  I  N/A  TEpoch structure
+ * TStdESA *StdESA                 I  N/A  Struct with the data from Stanford-ESA
+ * TSummaryData  *summary          O  N/A  TSummaryData structure
+ *****************************************************************************/
+void epoch2SummaryData (TEpoch *epoch, TStdESA *StdESA, TSummaryData *summary) {
+	summary->TotalEpochs = epoch->TotalEpochs;
+	summary->TotalEpochsSol = epoch->TotalEpochsSol;
+	summary->TotalEpochsRef = epoch->TotalEpochsRef;
+	summary->NumNoRefSumSkipped = epoch->NumNoRefSumSkipped;
+	summary->NumNoRefSolSkipped = epoch->NumNoRefSolSkipped;
+	summary->NumDOPSkipped = epoch->NumDOPSkipped;
+	summary->NumHDOPSkipped = epoch->NumHDOPSkipped;
+	summary->NumPDOPSkipped = epoch->NumPDOPSkipped;
+	summary->NumGDOPSkipped = epoch->NumGDOPSkipped;
+	summary->NumHDOPorPDOPSkipped = epoch->NumHDOPorPDOPSkipped;
+	summary->NumSingularMatrixSkipped = epoch->NumSingularMatrixSkipped;
+	summary->NumNoSatSkipped = epoch->NumNoSatSkipped;
+	summary->NumDataGapsSum = epoch->NumDataGapsSum;
+	summary->NumDataGapsTotal = epoch->NumDataGapsTotal;
+	summary->MaxDataGapSizeSum = epoch->MaxDataGapSizeSum;
+	summary->MaxDataGapSizeTotal = epoch->MaxDataGapSizeTotal;
+	summary->numsamplesProcessed = StdESA->numsamplesProcessed;
+	summary->numsamplesComputed = StdESA->numsamplesComputed;
+	summary->numsamplesSingular = StdESA->numsamplesSingular;
+	summary->MaxHError = epoch->MaxHError;
+	summary->MaxVError = epoch->MaxVError;
+	summary->MaxHDOP = epoch->MaxHDOP;
+	summary->MaxPDOP = epoch->MaxPDOP;
+	summary->MaxGDOP = epoch->MaxGDOP;
+	summary->MaxVDOP = epoch->MaxVDOP;
+	summary->MaxTDOP = epoch->MaxTDOP;
+	memcpy(&summary->StartSummaryEpoch,&epoch->StartSummaryEpoch,sizeof(TTime));
+	memcpy(&summary->StartSummaryPercentileEpoch,&epoch->StartSummaryPercentileEpoch,sizeof(TTime));
+	memcpy(&summary->LastSummaryPercentileEpoch,&epoch->LastSummaryPercentileEpoch,sizeof(TTime));
+	memcpy(&summary->HerrorEpoch,&epoch->HerrorEpoch,sizeof(TTime));
+	memcpy(&summary->VerrorEpoch,&epoch->VerrorEpoch,sizeof(TTime));
+	memcpy(&summary->HDOPEpoch,&epoch->HDOPEpoch,sizeof(TTime));
+	memcpy(&summary->PDOPEpoch,&epoch->PDOPEpoch,sizeof(TTime));
+	memcpy(&summary->GDOPEpoch,&epoch->GDOPEpoch,sizeof(TTime));
+	memcpy(&summary->VDOPEpoch,&epoch->VDOPEpoch,sizeof(TTime));
+	memcpy(&summary->TDOPEpoch,&epoch->TDOPEpoch,sizeof(TTime));
+	memcpy(&summary->DataGapSum,&epoch->DataGapSum,sizeof(TTime));
+	memcpy(&summary->DataGapTotal,&epoch->DataGapTotal,sizeof(TTime));
+}
+
+/*****************************************************************************
+ * Name        : summaryData2epoch
+ * Description : Copy the data of a TSummaryData structure back to the TEpoch
+ *               and TStdESA structures
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSummaryData  *summary          I  N/A  TSummaryData structure
+ * TEpoch  *epoch                  O  N/A  TEpoch structure
+ * TStdESA *StdESA                 O  N/A  Struct with the data from Stanford-ESA
+ *****************************************************************************/
+void summaryData2epoch (TSummaryData *summary, TEpoch *epoch, TStdESA *StdESA) {
+	epoch->TotalEpochs = summary->TotalEpochs;
+	epoch->TotalEpochsSol = summary->TotalEpochsSol;
+	epoch->TotalEpochsRef = summary->TotalEpochsRef;
+	epoch->NumNoRefSumSkipped = summary->NumNoRefSumSkipped;
+	epoch->NumNoRefSolSkipped = summary->NumNoRefSolSkipped;
+	epoch->NumDOPSkipped = summary->NumDOPSkipped;
+	epoch->NumHDOPSkipped = summary->NumHDOPSkipped;
+	epoch->NumPDOPSkipped = summary->NumPDOPSkipped;
+	epoch->NumGDOPSkipped = summary->NumGDOPSkipped;
+	epoch->NumHDOPorPDOPSkipped = summary->NumHDOPorPDOPSkipped;
+	epoch->NumSingularMatrixSkipped = summary->NumSingularMatrixSkipped;
+	epoch->NumNoSatSkipped = summary->NumNoSatSkipped;
+	epoch->NumDataGapsSum = summary->NumDataGapsSum;
+	epoch->NumDataGapsTotal = summary->NumDataGapsTotal;
+	epoch->MaxDataGapSizeSum = summary->MaxDataGapSizeSum;
+	epoch->MaxDataGapSizeTotal = summary->MaxDataGapSizeTotal;
+	StdESA->numsamplesProcessed = summary->numsamplesProcessed;
+	StdESA->numsamplesComputed = summary->numsamplesComputed;
+	StdESA->numsamplesSingular = summary->numsamplesSingular;
+	epoch->MaxHError = summary->MaxHError;
+	epoch->MaxVError = summary->MaxVError;
+	epoch->MaxHDOP = summary->MaxHDOP;
+	epoch->MaxPDOP = summary->MaxPDOP;
+	epoch->MaxGDOP = summary->MaxGDOP;
+	epoch->MaxVDOP = summary->MaxVDOP;
+	epoch->MaxTDOP = summary->MaxTDOP;
+	memcpy(&epoch->StartSummaryEpoch,&summary->StartSummaryEpoch,sizeof(TTime));
+	memcpy(&epoch->StartSummaryPercentileEpoch,&summary->StartSummaryPercentileEpoch,sizeof(TTime));
+	memcpy(&epoch->LastSummaryPercentileEpoch,&summary->LastSummaryPercentileEpoch,sizeof(TTime));
+	memcpy(&epoch->HerrorEpoch,&summary->HerrorEpoch,sizeof(TTime));
+	memcpy(&epoch->VerrorEpoch,&summary->VerrorEpoch,sizeof(TTime));
+	memcpy(&epoch->HDOPEpoch,&summary->HDOPEpoch,sizeof(TTime));
+	memcpy(&epoch->PDOPEpoch,&summary->PDOPEpoch,sizeof(TTime));
+	memcpy(&epoch->GDOPEpoch,&summary->GDOPEpoch,sizeof(TTime));
+	memcpy(&epoch->VDOPEpoch,&summary->VDOPEpoch,sizeof(TTime));
+	memcpy(&epoch->TDOPEpoch,&summary->TDOPEpoch,sizeof(TTime));
+	memcpy(&epoch->DataGapSum,&summary->DataGapSum,sizeof(TTime));
+	memcpy(&epoch->DataGapTotal,&summary->DataGapTotal,sizeof(TTime));
+}
+
+/*****************************************************************************
+ * Name        : mergeSummaryData
+ * Description : Add the summary data of another run (other day or station) to
+ *               a TSummaryData structure. Counters are added, maximum values
+ *               are kept with their epoch and the summary period is extended
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSummaryData  *summary          IO N/A  TSummaryData structure where data is added
+ * TSummaryData  *summaryAdd       I  N/A  TSummaryData structure with the data to add
+ *****************************************************************************/
+void mergeSummaryData (TSummaryData *summary, TSummaryData *summaryAdd) {
+	summary->TotalEpochs += summaryAdd->TotalEpochs;
+	summary->TotalEpochsSol += summaryAdd->TotalEpochsSol;
+	summary->TotalEpochsRef += summaryAdd->TotalEpochsRef;
+	summary->NumNoRefSumSkipped += summaryAdd->NumNoRefSumSkipped;
+	summary->NumNoRefSolSkipped += summaryAdd->NumNoRefSolSkipped;
+	summary->NumDOPSkipped += summaryAdd->NumDOPSkipped;
+	summary->NumHDOPSkipped += summaryAdd->NumHDOPSkipped;
+	summary->NumPDOPSkipped += summaryAdd->NumPDOPSkipped;
+	summary->NumGDOPSkipped += summaryAdd->NumGDOPSkipped;
+	summary->NumHDOPorPDOPSkipped += summaryAdd->NumHDOPorPDOPSkipped;
+	summary->NumSingularMatrixSkipped += summaryAdd->NumSingularMatrixSkipped;
+	summary->NumNoSatSkipped += summaryAdd->NumNoSatSkipped;
+	summary->NumEpochsMissingSummary += summaryAdd->NumEpochsMissingSummary;
+	summary->NumEpochsMissingSumNoDecimation += summaryAdd->NumEpochsMissingSumNoDecimation;
+	summary->NumEpochsMissingFile += summaryAdd->NumEpochsMissingFile;
+	summary->NumDataGapsSum += summaryAdd->NumDataGapsSum;
+	summary->NumDataGapsTotal += summaryAdd->NumDataGapsTotal;
+	summary->numsamplesProcessed += summaryAdd->numsamplesProcessed;
+	summary->numsamplesComputed += summaryAdd->numsamplesComputed;
+	summary->numsamplesSingular += summaryAdd->numsamplesSingular;
+
+	//Maximum values and the epoch where they happened
+	if (summaryAdd->MaxDataGapSizeSum>summary->MaxDataGapSizeSum) {
+		summary->MaxDataGapSizeSum = summaryAdd->MaxDataGapSizeSum;
+		memcpy(&summary->DataGapSum,&summaryAdd->DataGapSum,sizeof(TTime));
+	}
+	if (summaryAdd->MaxDataGapSizeTotal>summary->MaxDataGapSizeTotal) {
+		summary->MaxDataGapSizeTotal = summaryAdd->MaxDataGapSizeTotal;
+		memcpy(&summary->DataGapTotal,&summaryAdd->DataGapTotal,sizeof(TTime));
+	}
+	if (summaryAdd->MaxHError>summary->MaxHError) {
+		summary->MaxHError = summaryAdd->MaxHError;
+		memcpy(&summary->HerrorEpoch,&summaryAdd->HerrorEpoch,sizeof(TTime));
+	}
+	if (summaryAdd->MaxVError>summary->MaxVError) {
+		summary->MaxVError = summaryAdd->MaxVError;
+		memcpy(&summary->VerrorEpoch,&summaryAdd->VerrorEpoch,sizeof(TTime));
+	}
+	if (summaryAdd->MaxHDOP>summary->MaxHDOP) {
+		summary->MaxHDOP = summaryAdd->MaxHDOP;
+		memcpy(&summary->HDOPEpoch,&summaryAdd->HDOPEpoch,sizeof(TTime));
+	}
+	if (summaryAdd->MaxPDOP>summary->MaxPDOP) {
+		summary->MaxPDOP = summaryAdd->MaxPDOP;
+		memcpy(&summary->PDOPEpoch,&summaryAdd->PDOPEpoch,sizeof(TTime));
+	}
+	if (summaryAdd->MaxGDOP>summary->MaxGDOP) {
+		summary->MaxGDOP = summaryAdd->MaxGDOP;
+		memcpy(&summary->GDOPEpoch,&summaryAdd->GDOPEpoch,sizeof(TTime));
+	}
+	if (summaryAdd->MaxVDOP>summary->MaxVDOP) {
+		summary->MaxVDOP = summaryAdd->MaxVDOP;
+		memcpy(&summary->VDOPEpoch,&summaryAdd->VDOPEpoch,sizeof(TTime));
+	}
+	if (summaryAdd->MaxTDOP>summary->MaxTDOP) {
+		summary->MaxTDOP = summaryAdd->MaxTDOP;
+		memcpy(&summary->TDOPEpoch,&summaryAdd->TDOPEpoch,sizeof(TTime));
+	}
+
+	//Summary periods (epochs with MJDN -1 are not set)
+	if (summaryAdd->StartSummaryEpoch.MJDN!=-1) {
+		if (summary->StartSummaryEpoch.MJDN==-1 || tdiff(&summaryAdd->StartSummaryEpoch,&summary->StartSummaryEpoch)<0.) {
+			memcpy(&summary->StartSummaryEpoch,&summaryAdd->StartSummaryEpoch,sizeof(TTime));
+		}
+	}
+	if (summaryAdd->LastSummaryEpoch.MJDN!=-1) {
+		if (summary->LastSummaryEpoch.MJDN==-1 || tdiff(&summaryAdd->LastSummaryEpoch,&summary->LastSummaryEpoch)>0.) {
+			memcpy(&summary->LastSummaryEpoch,&summaryAdd->LastSummaryEpoch,sizeof(TTime));
+		}
+	}
+	if (summaryAdd->StartSummaryPercentileEpoch.MJDN!=-1) {
+		if (summary->StartSummaryPercentileEpoch.MJDN==-1 || tdiff(&summaryAdd->StartSummaryPercentileEpoch,&summary->StartSummaryPercentileEpoch)<0.) {
+			memcpy(&summary->StartSummaryPercentileEpoch,&summaryAdd->StartSummaryPercentileEpoch,sizeof(TTime));
+		}
+	}
+	if (summaryAdd->LastSummaryPercentileEpoch.MJDN!=-1) {
+		if (summary->LastSummaryPercentileEpoch.MJDN==-1 || tdiff(&summaryAdd->LastSummaryPercentileEpoch,&summary->LastSummaryPercentileEpoch)>0.) {
+			memcpy(&summary->LastSummaryPercentileEpoch,&summaryAdd->LastSummaryPercentileEpoch,sizeof(TTime));
+		}
+	}
+}
+
 /*****************************************************************************
  * Name        : qsort_compare_int
  * Description : Function to compare two integers for qsort function 
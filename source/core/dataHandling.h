@@ -291,6 +291,12 @@
 #include <errno.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+// With the GNU C library, compressed input files are decompressed by a separate thread
+// behind a custom FILE stream (see openInputFile in input.c)
+#if defined (__GLIBC__)
+	#include <pthread.h>
+	#define DECOMPRESS_THREAD
+#endif
 
 
 /* Internal types, constants and data */
@@ -314,6 +320,7 @@
 #define MAX_NUM_SBAS							50
 #define MAX_WORDS								200
 #define MAX_LINES_BUFFERED						10
+#define MAX_PRODUCTS_EPOCH_BLOCK				256 //Maximum number of epochs processed together when comparing or showing products
 #define SIGMA_INF								1e7
 #define SIGMA_INF_DR							1e4
 #define SIGMA_INF_DT							3e5
@@ -356,6 +363,8 @@
 #define NUMBERSECONDSPERDAY						86400
 #define NUMBERSECONDSPERHOUR					3600
 #define NUMBERFPPPMAPS							2
+#define GLONASS_ORBIT_STEP						60.	//Integration step (in seconds) for GLONASS broadcast orbits
+#define MAX_GLONASS_ORBIT_STEPS					70	//Maximum number of integration steps saved at each side of the GLONASS ephemeris reference time
 #define TECU2MLI								0.105045952848732
 #define DIFFGAL2GPSWEEK							1024
 #define MIN_ELEVATION_WEIGHT					1*d2r	//Satellites under this elevation value are automatically discarded for weights involving 1/sin(elev)^2.
@@ -372,6 +381,12 @@
 #define GALmf6									125
 #define SBASmf1									154
 #define SBASmf5									115
+#define GLOmf1									9		//GLONASS G1/G2 frequency ratio is 9/7 for all FDMA channels
+#define GLOmf2									7
+#define BDSmf1									154		//BeiDou B1C (band 1) and B1I (band 2)
+#define BDSmf2									152.6
+#define QZSSmf1									154
+#define QZSSmf2									120
 
 #define GPSf1									(GPSmf1*f0)
 #define GPSf2									(GPSmf2*f0) 
@@ -399,7 +414,14 @@
 
 #define GAMMAGPS12								((GPSf1*GPSf1)/(GPSf2*GPSf2))
 #define ALPHAGPS12								(1/(GAMMAGPS12-1))
+#define GAMMAGLO12								((GLOmf1*GLOmf1)/(double)(GLOmf2*GLOmf2))
+#define ALPHAGLO12								(1/(GAMMAGLO12-1))
+#define GAMMABDS12								((BDSmf1*BDSmf1)/(BDSmf2*BDSmf2))
+#define ALPHABDS12								(1/(GAMMABDS12-1))
 #define JULIANDAYDIFF							2400000.5
+#define NSPERSECOND								1000000000LL	//Nanoseconds in a second (TTimeNs units)
+#define NSPERDAY								(86400LL*NSPERSECOND)	//Nanoseconds in a day
+#define SEC2NS(s)								((TTimeNs)llround((s)*NSPERSECOND))	//Seconds (double) to TTimeNs
 
 #define DEFAULTMARKERNAME						"----"
 
@@ -408,6 +430,18 @@
 
 #define SBASOUTPUTPATH							"SBAS"
 #define MAXSBASFASTCORR							50
+#define MAX_SBASPLOTS_SATELLITES				32		//Number of satellites of the constellation used in SBAS plots mode
+#define SBASINDEXSTEP							60		//Time (in seconds) between the entries of the time index of a SBAS file
+#define SBASSEEKTIME							1200	//Default minimum time (in seconds) of SBAS messages decoded before the first epoch when skipping the start of a SBAS file (0 => Decode all messages)
+#define SBASINDEXVERSION						2		//Version of the format of the SBAS index files (index files with other versions are built again)
+#define SBASINDEXNUMGROUPS						65		//Number of groups of messages in the SBAS index (one for each message type plus one for any valid message)
+#define SBASINDEXANYMESSAGE						64		//Group of the SBAS index for any valid message of a GEO
+#define SBASINDEXMAXPARTS						154		//Maximum number of parts of the data of a group of messages in the SBAS index (11 bands x 14 blocks of ionospheric corrections)
+#define SBASINDEXMAXVERSIONS					9		//Maximum number of issues of data of a group of messages in the SBAS index (IODS has 3 bits) plus one for messages with no issue of data
+#define SBASBATCHSIZE							3600	//Maximum number of SBAS messages read ahead and decoded in parallel in each batch
+#define IGPGRIDSTEP								5		//Step (in degrees) of the IGP node index in latitude and longitude
+#define IGPGRIDNUMLAT							35		//Number of IGP node latitudes (-85º..85º every 5º)
+#define IGPGRIDNUMLON							72		//Number of IGP node longitudes (0º..355º every 5º)
 #define UDRETHRESHOLDPA							12
 #define URAMAXTHRESHOLD							15
 #define MINGEOPRN								120
@@ -430,9 +464,47 @@
 //  epochs to make SBAS data, smoothing and filter values to converge
 #define HOURSPREVDAYCONVERGENCE					22
 
+// Definitions for the summary statistics (TSummaryStat)
+#define SUMMARY_STAT_INITIAL_SIZE				1024	//Initial number of samples allocated (the vector doubles its size when full)
+#define SUMMARY_SKETCH_ACCURACY					0.001	//Relative accuracy of the percentiles computed from the histogram
+#define SUMMARY_SKETCH_MINVALUE					1E-4	//Values below this are kept in the first bin of the histogram
+#define SUMMARY_SKETCH_MAXVALUE					1E8		//Values over this are kept in the last bin of the histogram
+#define SUMMARY_NUM_STATS						7		//Number of TSummaryStat saved in a summary file (HError, VError, HDOP, PDOP, GDOP, VDOP and TDOP)
+
 // Definition for getLback (input.c)
 #define BACKWARD_READ_BATCH						450
 
+// Definitions for reading compressed input files (TDecompressStream, input.c)
+#define DECOMPRESS_BLOCK_SIZE					1048576		//Size of each block of decompressed data kept in memory
+#define DECOMPRESS_READAHEAD					4194304		//Maximum amount of data decompressed ahead of the reading position
+#define DECOMPRESS_LOOKBEHIND					4194304		//Amount of data kept behind the reading position for reading backwards
+#define DECOMPRESS_INPUT_BUFFER					65536
+#define DECOMPRESS_OUTPUT_BUFFER				65536
+#define INFLATE_WINDOW							32768		//Maximum distance of a DEFLATE back reference
+#define INFLATE_FASTBITS						9			//Huffman codes up to this length are decoded with a single table look up
+#define LZW_MAXBITS								16
+#define CRX_MAX_ARC_ORDER						9			//Maximum order of the differences in Compact RINEX
+
+// Definition for the forward-backward smoother (TSmoother, filter.c)
+#define SMOOTHER_MEMORY_LOG						134217728	//Size of the forward filter log kept in memory (the rest goes to a temporary file)
+
+// Definition for the scratch memory of the filter (TFilterWorkspace, filter.c)
+#define FILTER_WORKSPACE_MINSIZE				16			//Smallest number of elements reserved for each buffer (sizes grow in powers of two)
+
+// Definitions for multithread processing (OpenMP)
+#define MIN_SATELLITES_PARALLEL					8			//Epochs with less satellites are modelled by a single thread (the thread start is slower than the work)
+#define MAX_NUMA_NODES							64			//Maximum number of NUMA nodes read when placing the threads
+
+// Definitions for follow mode (input files read while they are being written)
+#define FOLLOWLATENCY							1.			//Default latency budget (in seconds) from an epoch written in the observation file to its solution
+#define FOLLOWPOLLINTERVAL						0.1			//Time (in seconds) between checks of a followed file when it can not be watched with inotify
+#define FOLLOWRECHECKINTERVAL					1.			//Maximum time (in seconds) waiting for a file notification before checking the file again
+#define FOLLOWTAILSIZE							4096		//Bytes read from the end of a followed SBAS file to get the time of its last message
+
+// Definitions for the Sun and Moon ephemeris cache (TCelestialDay, model.c)
+#define CELESTIAL_CHEBYSHEV_COEFS				12			//Number of Chebyshev coefficients fitted for each day and coordinate
+#define CELESTIAL_CACHE_DAYS					4096		//Number of days kept in the cache (indexed by MJDN modulo this value)
+
 // Constants for SBAS MESSAGES
 #define DONTUSE									0
 #define PRNMASKASSIGNMENTS						1
@@ -1037,6 +1109,30 @@ enum SBASPlotsDOP {
 	SBASplotsHDOPPDOPGDOP
 };
 
+//Enumerator for the stages timed by the performance instrumentation (see TPerfStats)
+enum PerfStage {
+	perfREAD,			// Reading observation epochs
+	perfSBAS,			// Reading and decoding SBAS messages
+	perfPREPROCESS,
+	perfCYCLESLIPS,		// Cycle-slip detection (part of preprocessing)
+	perfMODEL,
+	perfORBIT,			// Satellite orbits and clocks (part of modelling)
+	perfIONO,			// Ionosphere model (part of modelling)
+	perfTROPO,			// Troposphere model (part of modelling)
+	perfANTENNA,		// Satellite and receiver antenna phase center corrections (part of modelling)
+	perfFILTER,
+	perfCHOLESKY,		// Matrix inversions (filter and cycle-slip polynomial fit)
+	perfOUTPUT,			// OUTPUT messages and KML files
+	perfNUMSTAGES
+};
+
+//Enumerator for the placement of the threads in multithread processing
+enum ThreadBind {
+	tbNONE,				// Threads placed by the operating system
+	tbCLOSE,			// Each thread pinned to a CPU, filling one NUMA node before the next one
+	tbSPREAD			// Each thread pinned to a CPU, alternating between NUMA nodes
+};
+
 
 //Structure for creating a string of satellite ranges (grouped by
 //constellations) according to a certain conditions (for example, weight mode)
@@ -1069,6 +1165,38 @@ typedef struct {
 	double		SoD;
 } TTime;
 
+// Time as an integer number of nanoseconds since MJDN 0. Differences and comparisons are exact integer
+// operations, so it is used in the loops which compare many times against the current epoch
+typedef long long int TTimeNs;
+
+// Conversion and comparison of TTimeNs values. They are inline, as they are called for every sample and satellite
+// Convert a TTime structure to nanoseconds since MJDN 0
+static inline TTimeNs t2ns (TTime *t) {
+	return (TTimeNs)t->MJDN*NSPERDAY + SEC2NS(t->SoD);
+}
+
+// Convert nanoseconds since MJDN 0 to a TTime structure
+static inline TTime ns2t (TTimeNs ns) {
+	TTime		t;
+	TTimeNs		nsday;
+
+	t.MJDN = (int)(ns/NSPERDAY);
+	nsday = ns - (TTimeNs)t.MJDN*NSPERDAY;
+	if (nsday<0) {
+		t.MJDN--;
+		nsday += NSPERDAY;
+	}
+	t.SoD = (double)nsday/NSPERSECOND;
+
+	return t;
+}
+
+// Seconds between two TTimeNs values (a-b). As in tdiff, differences under 1 microsecond are rounded to 0
+static inline double nsdiff (TTimeNs a, TTimeNs b) {
+	if ( llabs(a-b) < NSPERSECOND/1000000 ) return 0.0;
+	return (double)(a-b)/NSPERSECOND;
+}
+
 // Satellite structure
 typedef struct {
 	enum GNSSystem	 		GNSS;
@@ -1156,6 +1284,79 @@ typedef struct {
 	enum OUTDiffField	OUTPUTDiffFieldsMode;
 } TReceiver;
 
+// Combination plan structure
+// A combination is built from two components (which may be combinations themselves) as
+// (factor[0]*comp0 + factor[1]*comp1) / divisor, or as comp0 + alpha2*(comp0-comp1) for divergence-free
+typedef struct {
+	int						available;				// 0 => Combination not defined for this constellation
+	int						divergenceFree;			// 1 => Use the divergence-free expression
+	enum MeasurementType	meas[2];				// Components of the combination
+	double					factor[2];				// Weight of each component
+	double					divisor;				// Normalisation of the weighted sum
+	double					alpha2;					// Divergence-free factor (2*alpha)
+} TCombinationPlan;
+
+// Summary statistics of one variable
+// In exact mode all samples are stored, in sketch mode only a logarithmic histogram is kept
+typedef struct {
+	int		numSamples;				//Number of samples added
+	int		allocated;				//Number of samples that fit in values before it has to grow
+	double	*values;				//Vector with all samples (exact mode)
+	int		sketch;					//0 => Exact percentiles  1 => Percentiles from histogram
+	int		numBins;				//Number of bins of the histogram
+	int		*bins;					//Number of samples in each bin (sketch mode)
+	double	lnGamma;				//Logarithm of the ratio between the limits of a bin
+	double	minValue;				//Minimum value added
+	double	maxValue;				//Maximum value added
+} TSummaryStat;
+
+// Data of the SPP/PPP summary (without the samples) that is saved with '-summary:save',
+// so summaries of different days or stations can be combined with '-summary:merge'
+typedef struct {
+	int		TotalEpochs;					//Total epochs processed in summary period
+	int		TotalEpochsSol;					//Total epochs processed with solution
+	int		TotalEpochsRef;					//Total epochs processed with solution and position from reference file
+	int		NumNoRefSumSkipped;				//Number of epochs skipped in the summary due to no position from reference file
+	int		NumNoRefSolSkipped;				//Number of epochs skipped due to no position from reference file
+	int		NumDOPSkipped;					//Number of epochs skipped due to bad DOP (any DOP)
+	int		NumHDOPSkipped;					//Number of epochs skipped due to bad HDOP
+	int		NumPDOPSkipped;					//Number of epochs skipped due to bad PDOP
+	int		NumGDOPSkipped;					//Number of epochs skipped due to bad GDOP
+	int		NumHDOPorPDOPSkipped;			//Number of epochs skipped due to bad HDOPorPDOP
+	int		NumSingularMatrixSkipped;		//Number of epochs skipped due to singular geometry matrix
+	int		NumNoSatSkipped;				//Number of epochs skipped due to lack of satellites
+	int		NumEpochsMissingSummary;		//Number of epochs missing in summary period (not decimated)
+	int		NumEpochsMissingSumNoDecimation;//Number of epochs missing in summary period (decimated)
+	int		NumEpochsMissingFile;			//Number of epochs missing in whole file
+	int		NumDataGapsSum;					//Number of data gaps during summary
+	int		NumDataGapsTotal;				//Number of data gaps in whole file
+	int		MaxDataGapSizeSum;				//Maximum data gap size during summary
+	int		MaxDataGapSizeTotal;			//Maximum data gap size in whole file
+	int		numsamplesProcessed;			//Total number of Stanford-ESA geometries processed
+	int		numsamplesComputed;				//Total number of Stanford-ESA geometries computed
+	int		numsamplesSingular;				//Total number of Stanford-ESA geometries with singular geometry matrix
+	double	MaxHError;						//Maximum horizontal error
+	double	MaxVError;						//Maximum vertical error
+	double	MaxHDOP;						//Maximum HDOP
+	double	MaxPDOP;						//Maximum PDOP
+	double	MaxGDOP;						//Maximum GDOP
+	double	MaxVDOP;						//Maximum VDOP
+	double	MaxTDOP;						//Maximum TDOP
+	TTime	StartSummaryEpoch;				//Timestamp of the first epoch used in the summary
+	TTime	LastSummaryEpoch;				//Timestamp of the last epoch used in the summary
+	TTime	StartSummaryPercentileEpoch;	//Timestamp of the first epoch used in the summary for computing percentiles
+	TTime	LastSummaryPercentileEpoch;		//Timestamp of the last epoch used in the summary for computing percentiles
+	TTime	HerrorEpoch;					//Timestamp of the epoch with highest horizontal error
+	TTime	VerrorEpoch;					//Timestamp of the epoch with highest vertical error
+	TTime	HDOPEpoch;						//Timestamp of the epoch with highest HDOP
+	TTime	PDOPEpoch;						//Timestamp of the epoch with highest PDOP
+	TTime	GDOPEpoch;						//Timestamp of the epoch with highest GDOP
+	TTime	VDOPEpoch;						//Timestamp of the epoch with highest VDOP
+	TTime	TDOPEpoch;						//Timestamp of the epoch with highest TDOP
+	TTime	DataGapSum;						//Timestamp of the epoch with biggest DataGap during summary
+	TTime	DataGapTotal;					//Timestamp of the epoch with biggest DataGap in whole file
+} TSummaryData;
+
 // Measurement order structure
 typedef struct {
 	enum GNSSystem			GNSS;
@@ -1164,6 +1365,7 @@ typedef struct {
 	enum MeasurementType	ind2Meas[MAX_MEASUREMENTS_PER_SATELLITE];
 	double					conversionFactor[MAX_MEASUREMENTS]; // This factor is to allow changing from carrier-phase cycles to meters.
 	int						usable[MAX_MEASUREMENTS];
+	TCombinationPlan		combPlan[MAX_MEASUREMENTS-ENDMEAS]; // Precompiled combinations (indexed by measType-ENDMEAS)
 	int						hasSNRmeas;
 	int						SNRmeaspos[MAX_FREQUENCIES_PER_GNSS];
 } TMeasOrder;
@@ -1193,9 +1395,9 @@ typedef struct {
 	double		BWmean[MAX_SATELLITES_VIEWED];
 	double		BWmean300[MAX_SATELLITES_VIEWED];
 	double		windowMW[MAX_SATELLITES_VIEWED][MAX_SLIDING_WINDOW];
-	double		windowMWtime[MAX_SATELLITES_VIEWED][MAX_SLIDING_WINDOW];
+	TTimeNs		windowMWtime[MAX_SATELLITES_VIEWED][MAX_SLIDING_WINDOW];
 	double		windowL1C1[MAX_SATELLITES_VIEWED][MAX_SLIDING_WINDOW];
-	double		windowL1C1time[MAX_SATELLITES_VIEWED][MAX_SLIDING_WINDOW];
+	TTimeNs		windowL1C1time[MAX_SATELLITES_VIEWED][MAX_SLIDING_WINDOW];
 	double		preAlign[MAX_SATELLITES_VIEWED][MAX_MEASUREMENTS_PER_SATELLITE];
 	double		windUpRadAccumReceiver[MAX_SATELLITES_VIEWED];
 	double		windUpRadAccumReceiverPrev[MAX_SATELLITES_VIEWED];
@@ -1238,6 +1440,20 @@ typedef struct {
 	TTime		lastEclipse;
 } TSatInfo;
 
+// Offset index of a RINEX observation file, used to skip the records of the epochs which are not going to be used
+// without parsing them, and to rewind epochs without reading the file backwards
+typedef struct {
+	int				numEpochs;				//Number of epochs of the index (data and event epochs)
+	long			*offset;				//File position of the epoch line of each epoch
+	long			*dataPos;				//File position just after the epoch line of each epoch
+	long			*end;					//File position just after the last record of each epoch
+	int				*numSats;				//Number of satellites of each epoch (-1 if the records of the epoch cannot be skipped)
+	int				*firstSat;				//Position in satGNSS and satPRN of the first satellite of each epoch
+	int				numSatPool;				//Number of satellites saved in satGNSS and satPRN
+	unsigned char	*satGNSS;				//Constellation of the satellites of all epochs
+	unsigned char	*satPRN;				//PRN of the satellites of all epochs
+} TRinexObsIndex;
+
 // Epoch structure
 typedef struct {
 	int			initialhour;
@@ -1360,13 +1576,13 @@ typedef struct {
 	int			NumEpochsMissingSum;		//Number of epochs missing in summary (used for refernce station)
 	int			NumEpochsMissingTotal;		//Number of epochs missing in whole file (used for refernce station)
 
-	double		*HError;					//Vector with all horizontal errors
-	double		*VError;					//Vector with all vertical errors
-	double		*HDOP;						//Vector with all HDOP values
-	double		*PDOP;						//Vector with all PDOP values
-	double		*GDOP;						//Vector with all GDOP values
-	double		*VDOP;						//Vector with all VDOP values
-	double		*TDOP;						//Vector with all TDOP values
+	TSummaryStat	HError;					//Samples of all horizontal errors
+	TSummaryStat	VError;					//Samples of all vertical errors
+	TSummaryStat	HDOP;					//Samples of all HDOP values
+	TSummaryStat	PDOP;					//Samples of all PDOP values
+	TSummaryStat	GDOP;					//Samples of all GDOP values
+	TSummaryStat	VDOP;					//Samples of all VDOP values
+	TSummaryStat	TDOP;					//Samples of all TDOP values
 	double		MaxHError;					//Maximum horizontal error
 	double		MaxVError;					//Maximum vertical error
 	double		MaxHDOP;					//Maximum HDOP
@@ -1399,6 +1615,8 @@ typedef struct {
 	TTime		DataGapTotal;				//Timestamp of the epoch with biggest DataGap in whole file
 
 	TTime		BackwardTurningEpoch;		//Epoch were forward processing ended		
+
+	TRinexObsIndex	*obsIndex;				//Offset index of the observation file (NULL if not built)
 } TEpoch;
 
 // SP3 orbits block
@@ -1481,6 +1699,8 @@ typedef struct {
 	TTime		Ttoc;
 	TTime		Ttoe;
 	TTime		TtransTime;
+	TTimeNs		TtoeNs;									// Ttoe and TtransTime in nanoseconds (for the block selection)
+	TTimeNs		TtransTimeNs;
 	int			PRN;
 	double		clockbias, clockdrift, clockdriftrate;	// First block row
 	int			IODE, IODNav;							// Second block row (IODNav for Galileo)
@@ -1515,6 +1735,15 @@ typedef struct {
 	int			URAGEO;
 } TBRDCblock;
 
+// Integrated GLONASS broadcast orbit of one satellite
+typedef struct {
+	int			valid;										// 0 => Nothing saved yet
+	TTime		Ttoe;										// Ephemeris reference time of the integrated block
+	double		state0[6];									// Broadcast position and velocity of the integrated block
+	int			kmin,kmax;									// Range of integration steps saved
+	double		state[2*MAX_GLONASS_ORBIT_STEPS+1][6];		// Position and velocity at each integration step (index MAX_GLONASS_ORBIT_STEPS is the reference time)
+} TGLONASSorbit;
+
 // Satellite orbits and clocks broadcast structure
 typedef struct {
 	//Rinex Nav v2
@@ -1827,6 +2056,98 @@ typedef struct {
 	int			prevNumSatellitesGPS;
 } TFilterSolution;
 
+// Epoch of the forward filter log used by the forward-backward smoother. Only the
+// first nunk (or nunkvector) elements of the arrays are stored in the log
+typedef struct {
+	TTime				t;
+	int					nunk;
+	int					nunkvector;
+	int					par2unk[MAX_PAR];
+	double				dop,GDOP,PDOP,TDOP,HDOP,VDOP,HPL,VPL;
+	// Receiver data needed to print the solution
+	double				aproxPosition[3];
+	double				aproxPositionRover[3];
+	double				aproxPositionRef[3];
+	double				orientation[3][3];
+	double				orientationRover[3][3];
+	double				orientationRef[3][3];
+	double				ZTD;
+	int					RefPositionAvail;
+	int					numSatSolutionFilter;
+	// Propagation from the previous epoch of the log
+	int					prevUnk[MAX_UNK];				// Unknown in the previous epoch (-1 => new unknown)
+	double				phi[MAX_UNK];
+	double				qnoise[MAX_UNK];
+	// Filtered values (smoothed values after the backward pass)
+	double				x[MAX_UNK];
+	double				P[MAX_VECTOR_UNK];
+} TSmootherEpoch;
+
+// Forward-backward (Rauch-Tung-Striebel) smoother. The forward filter writes the
+// log and the backward pass reads it in reverse order, so the observation file
+// is not read again and the satellites are not modelled again
+typedef struct {
+	unsigned char		*buffer;			// Log kept in memory
+	size_t				bufferLen;
+	size_t				bufferSize;
+	FILE				*fd;				// Log spilled to a temporary file
+	size_t				*offset;			// Position of each epoch in the log (memory first and then the file)
+	int					numEpochs;
+	int					maxEpochs;
+	int					current;			// Last epoch smoothed in the backward pass
+	TSmootherEpoch		*pending;			// Epoch being computed by the filter
+	TSmootherEpoch		*epoch;				// Epoch being smoothed
+	TSmootherEpoch		*next;				// Following epoch (already smoothed)
+	double				*S;					// Covariance between the epoch and the prediction of the following one
+	double				*C;					// Smoother gain
+	double				*CD;
+	double				*Pp;				// Covariance of the prediction
+	double				*D;
+} TSmoother;
+
+// Scratch memory of the filter. It is reserved for the unknowns and satellites of each epoch,
+// but buffers only grow, so after the first epochs the filter does not call the allocator
+typedef struct {
+	double				*atwa;				// At*W*A (covariance after the inversion)
+	double				*atwy;				// At*W*Y (parameters after the inversion)
+	double				*newcorrelations;	// Covariance to be kept for the next epoch
+	double				*newparameterValues;
+	int					sizeUnk;			// Number of elements reserved in atwy and newparameterValues
+	int					sizeUnkVector;		// Number of elements reserved in atwa and newcorrelations
+	double				*prefits;			// Prefits, weights and geometry matrix (in NEU) of the satellites used for Stanford-ESA
+	double				*weights;
+	double				*Gbuffer;			// Rows of G (4 values per satellite)
+	double				**G;
+	int					*k;					// Combination counters of Stanford-ESA
+	int					*kmask;
+	int					sizeSat;			// Number of satellites reserved
+} TFilterWorkspace;
+
+// Performance instrumentation. Stages are timed with a monotonic clock only when PERF messages
+// or the trace file are enabled. Stages run by several threads add the time of all of them
+typedef struct {
+	int					enabled;
+	double				epochTime[perfNUMSTAGES];	// Time spent in each stage in the current epoch (seconds)
+	double				totalTime[perfNUMSTAGES];	// Time spent in each stage in all the processing (seconds)
+	long long int		epochCalls[perfNUMSTAGES];
+	long long int		totalCalls[perfNUMSTAGES];
+	double				tStart;				// Clock when the instrumentation was enabled
+	double				tEpochStart;		// Clock when the current epoch started
+	int					numEpochs;
+	int					epochPending;		// There are times of an epoch not printed yet
+	TTime				t;					// Time of the current epoch
+	FILE				*fdTrace;			// Chrome trace file (NULL if not used)
+	long long int		numTraceEvents;
+} TPerfStats;
+
+// Sun and Moon ephemeris for one day
+// Chebyshev coefficients of the inertial positions (before the Earth rotation) over [0,86400] seconds of day
+typedef struct {
+	int					MJDN;
+	double				sun[3][CELESTIAL_CHEBYSHEV_COEFS];	// Km
+	double				moon[3][CELESTIAL_CHEBYSHEV_COEFS];	// Km
+} TCelestialDay;
+
 // GNSS Constellation data
 typedef struct {
 	TConstellationElement	*sat;
@@ -1846,6 +2167,26 @@ typedef struct {
 	int 		n;
 } TStat;
 
+// Orbit and clock difference of one satellite at one epoch (orbit comparison mode)
+typedef struct {
+	int			available;		// 1 => Differences computed, 0 => Satellite not available
+	double		eclipseTime;	// Seconds since last eclipse (-1 => satellite not eclipsed)
+	double		SISREDiff;
+	double		OrbDiff;
+	double		Orb3DDiff;
+	double		ClkDiff;
+	double		posDiff[3];		// Along, cross, radial
+	double		posDiffXYZ[3];
+} TSatDiffSample;
+
+// Position, velocity and clock of one satellite at one epoch (show product mode)
+typedef struct {
+	int			available;
+	double		position[3];
+	double		velocity[3];
+	double		clock;
+} TSatPvtSample;
+
 // SBAS block
 typedef struct {
 	//Fields only on RINEXB
@@ -1930,6 +2271,87 @@ typedef struct {
 	double	**ionodelayparameters;				//Ionospheric delay parameters from message type 26
 } TSBASblock;
 
+// Structure with the IGP assigned to a node of the 5x5 degree IGP grid for the current iono mask
+typedef struct {
+	int		BandNumber;						//Band number of the IGP (bands 9 and 10 have priority if the IGP is in their mask)
+	int		IGP;							//IGP number in the band (0 if the node is not an IGP)
+	int		inMask;							//1 if the IGP is monitored in the current mask, 0 otherwise
+} TIGPnode;
+
+// Structure which contains the corrections for a satellite in a single epoch
+typedef struct {
+	double 			SatCoord[3];			//Satellite coordinates (X-Y-Z) after applying SBAS corrections
+	double 			SatCoordbrdc[3];		//Satellite coordinates from broadcast (X-Y-Z)
+	double 			SatCoordCor[3];			//Long term correction to apply in the satellite coordinates (X-Y-Z)
+	double			Clock;					//Clock correction from broadcast
+	double			Clockbrdc;				//Long term correction to apply in the clock
+	double			ClockCor;				//Clock correction after applying SBAS corrections
+	int				IOD;					//IOD used (which must match the navigation IODE)
+	int				IODnoSBAS;				//IOD used when there is no mathc with the IODE of SBAS (only in NPA)
+	double			ionocorrection;			//Ionosphere correction
+	int				uraindex;				//URA index value (in message type 9)
+	double			PRC;					//PRC value (fast correction)
+	double			RRC;					//RRC value (fast correction)
+	double			RRCtime;				//RRC value multiplied by the difference between current time and time of applicabily of last fast correction
+	int				UDREI;					//UDRE indicator of the fast correction
+	double			UDREsigma;				//UDRE sigma of the fast correction (in meters^2)
+	double			fastcorrdegfactor;		//Fast correction degradation factor (in meters/seconds^2)
+	double			fastcorrtmout;			//Time out for current satellite
+	double			fastcorrsmallertmout;	//Smallest time out for all satellites (used for RRC)
+	double			tPRC;					//Time used for computing PRC timeout
+	double			tudre;					//Time used for computing UDRE sigma timeout
+	double			tu;						//Time used for computing fast correction degradation
+
+	double			longtermdegradation;	//Long term degradation parameter
+	double			geonavdegradation;		//GEO navigation degradation
+	double			enroutedegradation;		//En route through NPA degradation parameter
+	double			fastcorrdeg;			//Fast correction degradation
+	double			RRCdeg;					//Range-rate correction degradation
+	double			deltaudre;				//Delta UDRE (factor that multiplies sigma UDRE)
+	int				deltaudresource;		//Indicates the data source for Delta UDRE(27 or 28 for their respective message type,-27 or -28 if received any of these
+												//message types but there was missing data or was timed out, 0 if no message type received)
+	int				mt10avail;				//Indicates if message type 10 is available
+
+
+	double			sigma2flt;			//Sigma flt (sigma of fast and long term corrections) (in meters^2)
+	double			sigma2iono;			//Sigma of the ionosphere (in meters^2)
+	double			sigma2tropo;		//Sigma of the troposphere (in meters^2)
+	double			sigma2noise;		//Sigma of the airborne receiver noise (in meters^2)
+	double			sigma2divergence;	//Sigma of the airborne receiver divergence (in meters^2)
+	double			sigma2multipath;	//Sigma of the airborne receiver multipath (in meters^2)
+	double			sigma2air;			//Total sigma of the airborne receiver (in meters^2)
+	double			SBASsatsigma2;		//Total SBAS sigma for current satellite
+
+	int				fastcorIODP;		//IODP used for fast corrections
+	int				fastcorIODF;		//IODF used for fast corrections
+	int				fastcorPRNpos;		//PRN position in the fast correction mask (1..51)
+	int				longtermIODP;		//IODP used for long term corrections
+	int				longtermPRNpos;		//PRN position in the long term correction mask (1..51)
+	int				serviceIODS;		//IODS used in service message (message type 27)
+	int				covarianceIODP;		//IODP used in Clock ephemeris covariance matrix (message type 28)
+	int				covariancePRNpos;	//PRN position in the covariance mask (1..51)
+	int				ionomodelflag;		//Flag that indicates which iono model is used (-1->no model, 0->SBASiono, 1->Klobuchar, 2->Other model)
+
+	int				SBASplotIonoAvail;	//Flag to indicate that we are computing the SBAS iono corrections availability. No processing is done
+} TSBAScorr;
+
+// Structure which contains the part of the SBAS corrections of a satellite that does not depend on the receiver position.
+// In SBAS plots mode it is computed once per epoch and GEO and reused in all the grid points
+typedef struct {
+	TTime			t;						//Epoch of the stored corrections
+	int				revision;				//SBAS data revision used to compute the corrections (-1 if no valid data is stored)
+	int				precisionapproach;		//Navigation mode used to compute the corrections
+	int				retvalue;				//Value returned when computing the corrections
+	int				nofastcorr;				//Flag to indicate that fast corrections were not available (only in NPA)
+	int				nolongterm;				//Flag to indicate that long term corrections were not available (only in NPA)
+	int				regionsearch;			//Flag to indicate that Delta UDRE has to be computed from the service regions (message type 27)
+	int				hasOrbitsAndClocks;		//0 if the satellite was flagged without orbits and clocks when computing the corrections
+	double			C[4][4];				//Covariance matrix from message type 28 (C=RT*R)
+	double			scalefactor;			//Scale factor of the covariance matrix from message type 28
+	TTime			transTime;				//Transmission time of the satellite after computing the corrections
+	TSBAScorr		SBAScorr;				//Corrections computed
+} TSBASsatCorr;
+
 // SBAS structure
 typedef struct {
 	//Time-outs values
@@ -2085,6 +2507,8 @@ typedef struct {
 	int		IGPinMask[5][11][202];			//For a given Band Number, indicates wheter this IGP is monitored or not in any iono mask received. 
 												//The order is IODI, Band Number and position in mask.
 	int		IGP2Mask[11][202];				//Saves to which IODI corresponds the last iono delay data received for the given band nubmer and IGP.
+	int		IGPinCurrentMask[11][202];		//Cached value of IGPinMask[IGP2Mask[band][IGP]][band][IGP]. Rebuilt with 'SBASupdateIGPindex' each time IGPinMask or IGP2Mask change
+	TIGPnode IGPnodeIndex[IGPGRIDNUMLAT][IGPGRIDNUMLON]; //IGP index of each 5x5 degree grid node for the current mask (latitude -85..85, longitude 0..355)
 	double	Ionodelay[11][202];				//Vertical delay for each IGP in mask (meters) for each band number.
 	double	IonoGIVE[11][202];				//Ionospheric vertical error GIVE (meters) for each band number.
 	double	Ionosigma[11][202];				//Ionospheric vertical error GIVE sigma (meters^2) for each band number.
@@ -2110,6 +2534,10 @@ typedef struct {
 
 	//Counter for number of satellites with sigma of 60 metres
 	int		numSat60;
+
+	//Satellite corrections which do not depend on the receiver position (only used in SBAS plots mode)
+	int				revision;										//Counter increased each time SBAS data is modified while computing corrections (only used in position 0)
+	TSBASsatCorr	satCorr[MAX_SBASPLOTS_SATELLITES];				//Stored corrections for each satellite of the SBAS plots constellation
 } TSBASdata;
 
 //Struct for saving SBASdata for each GEO and the summary data
@@ -2121,8 +2549,8 @@ typedef struct {
 	double	VWIR;							//Vertical worst integrity ratio
 	double	HPLPercentileSamples;			//95th horizontal protection level percentile of the samples
 	double	VPLPercentileSamples;			//95th vertical protection level percentile of the samples
-	double	*HPL;							//Vector with all horizontal protection levels
-	double	*VPL;							//Vector with all vertical protection levels
+	TSummaryStat HPL;						//Samples of all horizontal protection levels
+	TSummaryStat VPL;						//Samples of all vertical protection levels
 	double	MaxHPL;							//Maximum horizontal protection level
 	double	MaxVPL;							//Maximum vertical protection level
 	double	decimation;						//Decimation step (saved here for the case options->decimate=0, put a value of 1)
@@ -2146,64 +2574,68 @@ typedef struct {
 
 } TSBASdatabox;
 
-
-
-// Structure which contains the corrections for a satellite in a single epoch
+//Time index of a SBAS messages file (EMS or RINEX-B), used to skip the messages before the first epoch without decoding them
 typedef struct {
-	double 			SatCoord[3];			//Satellite coordinates (X-Y-Z) after applying SBAS corrections
-	double 			SatCoordbrdc[3];		//Satellite coordinates from broadcast (X-Y-Z)
-	double 			SatCoordCor[3];			//Long term correction to apply in the satellite coordinates (X-Y-Z)
-	double			Clock;					//Clock correction from broadcast
-	double			Clockbrdc;				//Long term correction to apply in the clock
-	double			ClockCor;				//Clock correction after applying SBAS corrections
-	int				IOD;					//IOD used (which must match the navigation IODE)
-	int				IODnoSBAS;				//IOD used when there is no mathc with the IODE of SBAS (only in NPA)
-	double			ionocorrection;			//Ionosphere correction
-	int				uraindex;				//URA index value (in message type 9)
-	double			PRC;					//PRC value (fast correction)
-	double			RRC;					//RRC value (fast correction)
-	double			RRCtime;				//RRC value multiplied by the difference between current time and time of applicabily of last fast correction
-	int				UDREI;					//UDRE indicator of the fast correction
-	double			UDREsigma;				//UDRE sigma of the fast correction (in meters^2)
-	double			fastcorrdegfactor;		//Fast correction degradation factor (in meters/seconds^2)
-	double			fastcorrtmout;			//Time out for current satellite
-	double			fastcorrsmallertmout;	//Smallest time out for all satellites (used for RRC)
-	double			tPRC;					//Time used for computing PRC timeout
-	double			tudre;					//Time used for computing UDRE sigma timeout
-	double			tu;						//Time used for computing fast correction degradation
-
-	double			longtermdegradation;	//Long term degradation parameter
-	double			geonavdegradation;		//GEO navigation degradation
-	double			enroutedegradation;		//En route through NPA degradation parameter
-	double			fastcorrdeg;			//Fast correction degradation
-	double			RRCdeg;					//Range-rate correction degradation
-	double			deltaudre;				//Delta UDRE (factor that multiplies sigma UDRE)
-	int				deltaudresource;		//Indicates the data source for Delta UDRE(27 or 28 for their respective message type,-27 or -28 if received any of these
-												//message types but there was missing data or was timed out, 0 if no message type received)
-	int				mt10avail;				//Indicates if message type 10 is available
+	TTime	t;								//Time of the first entry. Each entry is SBASINDEXSTEP seconds after the previous one
+	int		numEntries;						//Number of entries of the index
+	long	*offset;						//File position of the first message with time equal or greater than the time of each entry
+	long	*start;							//File position of the first message to be decoded for having the same SBAS data at the time of each entry as when decoding all the file
+	int		numGEO;							//Number of GEOs with valid messages
+	int		GEOPRN[MAX_SBAS_PRN];			//PRN of the GEOs with valid messages, in the order of their first valid message
+	long	GEOoffset[MAX_SBAS_PRN];		//File position of the first valid message of each GEO
+	long	filesize;						//Size of the SBAS file (to check if an index read from disk matches the SBAS file)
+	long	filetime;						//Modification time of the SBAS file (to check if an index read from disk matches the SBAS file)
+} TSBASindex;
+
+//Data of the SBAS index of a GEO updated by the same kind of messages (a key). The last messages of each key are kept, so the first message
+//to be decoded is never after them (the data of a key is overwritten by its last message, except for fast corrections, which are kept in a buffer)
+typedef struct {
+	int		depth;							//Number of messages kept
+	int		numOffsets;						//Number of messages read (up to depth)
+	int		lastOffset;						//Position of the last message in the offset buffer
+	long	*offset;						//File position of the last messages read
+} TSBASindexKey;
 
+//Data of a GEO while building the SBAS index (the position 0 is used for the data gaps of all GEOs)
+typedef struct {
+	int				numKeys;
+	TSBASindexKey	*key;
+	int				*keypos[SBASINDEXNUMGROUPS];							//Position in key of each part and issue of data of each group (allocated with the first message of the group)
+	long			lastversion[SBASINDEXNUMGROUPS][SBASINDEXMAXVERSIONS];	//File position of the last message of each group and issue of data (-1 if none)
+	long			firstmessage;											//File position of the first message (valid or not)
+	long			lastmessage;											//File position of the last message (valid or not)
+	TTime			lastmessagetime;										//Time of the last message (valid or not)
+	int				numGaps;												//Number of data gaps (one or more messages missing)
+	long			*gapstart;												//File position of the last message before each data gap
+	long			*gapend;												//File position of the first message after each data gap
+} TSBASindexGEO;
+
+//SBAS messages read ahead from a SBAS file (EMS or RINEX-B) until the current epoch. The messages of each GEO are decoded
+//in a different thread, and then the reader takes them in file order, so the SBAS data is updated as if they were decoded one by one
+typedef struct {
+	int			numMessages;
+	int			current;								//Position of the next message to be taken by the reader
+	TSBASblock	*sbasblock[SBASBATCHSIZE];
+	char		hexstring[SBASBATCHSIZE][300];			//Message in hexadecimal
+	int			decoderesult[SBASBATCHSIZE];			//Value returned by readSBASmessage
+	int			decodedmessagetype[SBASBATCHSIZE];
+	int			messagesmissing[SBASBATCHSIZE];
+} TSBASbatch;
+
+//Input file read in follow mode (the file is being written while it is read, as with 'tail -f')
+typedef struct {
+	char			filename[MAX_INPUT_LINE];
+	enum fileType	type;							//Type of file (only used for SBAS files)
+	int				watchfd;						//inotify descriptor watching the file (-1 if the file is polled)
+	long			size;							//Size of the file in the last check
+	long			mtime;							//Modification time of the file in the last check
+	long			loadedSize;						//Size of the file when it was last read (for products files)
+	long			loadedMtime;					//Modification time of the file when it was last read (for products files)
+	double			availableTime;					//Clock (perfClock) when the last epoch waited for was complete in the file
+} TFollowFile;
 
-	double			sigma2flt;			//Sigma flt (sigma of fast and long term corrections) (in meters^2)
-	double			sigma2iono;			//Sigma of the ionosphere (in meters^2)
-	double			sigma2tropo;		//Sigma of the troposphere (in meters^2)
-	double			sigma2noise;		//Sigma of the airborne receiver noise (in meters^2)
-	double			sigma2divergence;	//Sigma of the airborne receiver divergence (in meters^2)
-	double			sigma2multipath;	//Sigma of the airborne receiver multipath (in meters^2)
-	double			sigma2air;			//Total sigma of the airborne receiver (in meters^2)
-	double			SBASsatsigma2;		//Total SBAS sigma for current satellite
 
-	int				fastcorIODP;		//IODP used for fast corrections
-	int				fastcorIODF;		//IODF used for fast corrections
-	int				fastcorPRNpos;		//PRN position in the fast correction mask (1..51)
-	int				longtermIODP;		//IODP used for long term corrections
-	int				longtermPRNpos;		//PRN position in the long term correction mask (1..51)
-	int				serviceIODS;		//IODS used in service message (message type 27)
-	int				covarianceIODP;		//IODP used in Clock ephemeris covariance matrix (message type 28)
-	int				covariancePRNpos;	//PRN position in the covariance mask (1..51)
-	int				ionomodelflag;		//Flag that indicates which iono model is used (-1->no model, 0->SBASiono, 1->Klobuchar, 2->Other model)
 
-	int				SBASplotIonoAvail;	//Flag to indicate that we are computing the SBAS iono corrections availability. No processing is done
-} TSBAScorr;
 
 //Structure which contains the active user defined errors
 typedef struct {
@@ -2463,6 +2895,103 @@ typedef struct {
 	TRTCM2header	header;
 } TRTCM2;
 
+// Compression of input files
+enum CompressionType {
+	ctNONE,						// Plain text (only Compact RINEX needs decoding)
+	ctGZIP,						// gzip (.gz)
+	ctLZW						// Unix compress (.Z)
+};
+
+// Huffman code for the DEFLATE decoder (inflate)
+typedef struct {
+	short				count[16];					// Number of codes of each length
+	short				symbol[288];				// Symbols ordered by code
+	unsigned short		fast[1<<INFLATE_FASTBITS];	// Symbol<<4|length for the codes up to INFLATE_FASTBITS bits (0 => longer code)
+} THuffman;
+
+// Lines of the Compact RINEX body
+enum CRXLine {
+	crxEPOCH,					// Epoch line
+	crxCLOCK,					// Receiver clock offset line
+	crxDATA,					// Observations of one satellite
+	crxEVENT					// Line of a special event record (copied as is)
+};
+
+// Compact RINEX (Hatanaka) data of one satellite
+typedef struct {
+	char				id[4];						// Satellite identifier as in the epoch line
+	int					lastEpoch;					// Number of the last epoch where the satellite appeared
+	int					order[MAX_MEASUREMENTS_PER_SATELLITE];		// Order of the difference of the last value (-1 => no data)
+	int					arcOrder[MAX_MEASUREMENTS_PER_SATELLITE];	// Maximum order of the differences in the arc
+	long long int		diff[MAX_MEASUREMENTS_PER_SATELLITE][CRX_MAX_ARC_ORDER+1];	// Value and differences (in units of the last decimal)
+	char				flags[2*MAX_MEASUREMENTS_PER_SATELLITE+1];	// LLI and signal strength flags
+} TCRXSatellite;
+
+// Compact RINEX (Hatanaka) decoder
+typedef struct {
+	int					version;					// Compact RINEX version (1 or 3, 0 => not Compact RINEX)
+	int					headerLines;				// Number of Compact RINEX header lines read (the first two are not RINEX lines)
+	int					inHeader;					// 1 => Copying the RINEX header
+	int					rinexVersion;
+	int					numTypes[128];				// Number of observation types per constellation letter (RINEX 2 uses position 0)
+	enum CRXLine		state;						// Next line expected
+	int					numEpochs;					// Number of data epochs decoded
+	int					numSat;						// Number of satellites in current epoch
+	int					currentSat;					// Next satellite of the epoch to be decoded
+	int					pendingLines;				// Lines left to be copied for a special event record
+	char				epochLine[MAX_INPUT_LINE];	// Epoch line of the last data epoch (all satellites in one line)
+	int					epochLineLen;
+	int					clockOrder;
+	int					clockArcOrder;
+	long long int		clockDiff[CRX_MAX_ARC_ORDER+1];
+	short				satSlot[128][100];			// Position in sat+1 of each satellite (by constellation letter and PRN)
+	int					numSlots;
+	TCRXSatellite		*sat;						// Data of all satellites seen (MAX_SATELLITES_VIEWED)
+	TCRXSatellite		*epochSat[MAX_SATELLITES_VIEWED];	// Satellites of the current epoch
+} TCRXDecoder;
+
+// Input file being decompressed
+// The decompressed data is kept in blocks of DECOMPRESS_BLOCK_SIZE bytes. Only the blocks close to the
+// reading position are kept, unless the file is read backwards, in which case all blocks are kept
+typedef struct TDecompressStream {
+	char				filename[MAX_INPUT_LINE];
+	enum CompressionType	compression;
+	FILE				*fdIn;						// Compressed file
+	unsigned char		inBuffer[DECOMPRESS_INPUT_BUFFER];
+	int					inPos, inLen;
+	unsigned long long	bitBuffer;					// Bits read and not used yet (first bit in the least significant position)
+	int					bitCount;
+	unsigned char		*window;					// Output window of the inflate decoder (2*INFLATE_WINDOW bytes)
+	unsigned int		crc;						// CRC-32 of the data of the current gzip member
+	int					crxDetect;					// 1 => First line not read yet (it tells whether the file is Compact RINEX)
+	char				lineBuffer[MAX_INPUT_LINE];	// Compact RINEX line being assembled
+	int					lineLen;
+	TCRXDecoder			*crx;
+	unsigned char		outBuffer[DECOMPRESS_OUTPUT_BUFFER];	// Decoded data not yet moved to the blocks
+	int					outLen;
+	FILE				*fdOut;						// If not NULL, decoded data is written to this file instead of to the blocks
+	unsigned char		**blocks;
+	int					numBlocks;					// Positions allocated in blocks
+	int					firstBlock;					// First block not released
+	unsigned char		*spareBlock;				// Released block to be reused
+	long long int		decodedBytes;				// Amount of decoded data in the blocks
+	long long int		position;					// Reading position
+	int					toEnd;						// 1 => Decode up to the end of file regardless of the reading position
+	int					keepAll;					// 1 => Do not release blocks
+	int					restarts;					// Number of times the decoding has been restarted
+	int					eof;
+	int					error;
+	int					stop;						// 1 => The decoding thread has to finish
+	FILE				*fd;						// Stream given to the readers
+	struct TDecompressStream	*next;
+	#if defined (DECOMPRESS_THREAD)
+		pthread_t		thread;
+		pthread_mutex_t	mutex;
+		pthread_cond_t	dataCond;					// Signalled when data is added (or the decoding ends)
+		pthread_cond_t	spaceCond;					// Signalled when the reading position changes (or stop is requested)
+	#endif
+} TDecompressStream;
+
 // Options structure
 typedef struct {
 	//KML file
@@ -2510,6 +3039,9 @@ typedef struct {
 	char 	tropoGaldir[100];
 	char 	NeQuickdir[100];
 
+	// Directory for the parsed products cache (empty => cache disabled)
+	char	productsCacheDir[MAX_INPUT_LINE];
+
 	// Verbose options
 	int	printModel;			// printModel = 1				=> Print all the model values (default)
 							// printModel = 0				=> Do not print model values
@@ -2599,6 +3131,9 @@ typedef struct {
 	int	printSummary;		// printSummary = 1				=> Print summary of the processing (default)
 							// printSummary = 0				=> Do not print summary of the processing
 
+	int	printPerf;			// printPerf = 1				=> Print PERF messages with the time spent in each processing stage
+							// printPerf = 0				=> Do not print PERF messages (default)
+
 	char ProgressEndCharac;	//Internal option for final character when printing progress
 
 	enum	SatelliteVelocity satVel;		// satVel = svINERTIAL          => Print inertial velocities if satellites
@@ -2828,6 +3363,8 @@ typedef struct {
 
 	int	filterIterations;		// This will set the number of forward/backward runs in the filter, being 1 only forward (default 1)
 
+	int	smoother;				// smoother = 1				=> The backward run smooths the forward solutions instead of processing the data again (default 0)
+
 	double	filterParams[3][MAX_PAR];	// filterParams stores the data of the Kalman filter. The first dimension is the parameter type of the
 										// filter, the second is the specific unknown it is refering to:
 										// To access the first dimension: PHI_PAR, Q_PAR and P0_PAR
@@ -3000,6 +3537,8 @@ typedef struct {
 
 	int	adquisitiontime;				// Time (in seconds) for gathering data from a GEO (default 300 seconds)
 
+	int	SBASseektime;					// Time (in seconds) of SBAS messages decoded before the first epoch. Older messages are skipped (0 => Decode all messages)
+
 	int	minimumswitchtime;				// Minimum time (in seconds) that have to pass before another GEO or mode change
 
 	int	GEOPRN;							// 0 => Use data from all available GEO (default in non precision approach)
@@ -3132,6 +3671,10 @@ typedef struct {
 	TTime firstEpochSummary;			//First epoch to use in the summary
 
 	double	percentile;					//Percentile value for computing the error percentile (default 95)
+	int		summarySketch;				//Compute summary percentiles from a histogram instead of storing all samples (default off)
+	char	summarySaveFile[MAX_INPUT_LINE];	//File where the summary data is saved for merging it later (empty => not saved)
+	int		numSummaryMergeFiles;		//Number of summary files to merge
+	char	**summaryMergeFiles;		//Summary files saved with '-summary:save' to merge in the summary
 
 	int recPosProvided;					//Flag to indicate if receiver position (from rover) is given (either fixed or with a reference file)
 
@@ -3244,10 +3787,16 @@ typedef struct {
 	//Reference file interpolation degree
 	int	RefDegInterp;	
 
-	#if defined _OPENMP
-	//Number of threads used in processing
+	//Number of threads used in processing (1 for serial processing)
 	int numthreads;
-	#endif
+	//Placement of the threads in the CPUs
+	enum ThreadBind threadBind;
+
+	//Follow mode (input files are read while they are being written)
+	int		followMode;			// 0 => Input files are read until the end of file (default)
+								// 1 => Wait for new epochs at the end of the observation file, and for new messages in the SBAS file
+	double	followLatency;		// Latency budget (in seconds) from an epoch written in the observation file to its solution
+	double	followTimeout;		// Time (in seconds) without new epochs after which follow mode ends (0 => Wait indefinitely)
 
 } TOptions;
 
@@ -3256,6 +3805,8 @@ char	messagestr[MAX_MESSAGE_STR];
 char	messagestrSwitchGEO[MAX_MESSAGE_STR];
 char	messagestrSwitchMode[MAX_MESSAGE_STR];
 
+TPerfStats	perfStats;
+
 
 /**************************************
 * NeQuick-G Variables
@@ -3382,6 +3933,8 @@ void vectProd (double *a, double *b, double *res);
 double scalarProd (double *a, double *b);
 char *trim (char *line);
 char *getstr (char *out,char *line,int ini, int length);
+double getDoubleField (char *line, int lineLength, int ini, int length);
+int getIntField (char *line, int lineLength, int ini, int length);
 void getnumericalelements (char *line, int *numelements, double *out);
 int	checkConstellationChar(char c);
 
@@ -3406,6 +3959,8 @@ char *SolutionModeNum2SolutionModeChar(enum SolutionMode numsol);
 char *WeightModeNum2WeightModestr(enum WeightMode weightMode);
 
 // Epoch handling
+void setCombinationPlan (TMeasOrder *measOrder, enum MeasurementType measType, enum MeasurementType meas1, enum MeasurementType meas2, double factor1, double factor2, double divisor);
+void compileCombinationPlans (TMeasOrder *measOrder, enum GNSSystem GNSS);
 int getMeasModelValue (TEpoch *epoch, enum GNSSystem system, int PRN, enum MeasurementType measType, double *measurement, double *model);
 double getModelValue (TEpoch *epoch, enum GNSSystem system, int PRN, enum MeasurementType measType);
 double getMeasurementValue (TEpoch *epoch, enum GNSSystem system, int PRN, enum MeasurementType measType);
@@ -3440,6 +3995,19 @@ TTime cal2t (int year, int month, int day, int hour, int minute, double second);
 void tday_of_month (TTime *t, int *day_of_month, int *month_days, int *month_number);
 double tdiff (TTime *a, TTime *b);
 double tsec (TTime *a);
+
+// Performance instrumentation
+void initPerfStats (int enabled, FILE *fdTrace);
+void freePerfStats (void);
+double perfClock (void);
+double perfStart (void);
+void perfStop (enum PerfStage stage, double tStart);
+void perfSetEpoch (TTime *t);
+char *perfstage2str (enum PerfStage stage);
+
+// Multithread
+void setThreadAffinity (TOptions *options);
+char *threadbind2str (enum ThreadBind bind);
 void getcurrentsystemtime (struct tm *tm);
 TTime tdadd (TTime *a, double b);
 int Gal_loc_month (double doy, int *im, double *id);
@@ -3471,11 +4039,13 @@ int ionoConv3Dto1D (TIonoMap *ionoMap, int ihgt, int ilat, int ilon);
 int ionoHLLto1D (TIonoMap *ionoMap, double hgt, double lat, double lon);
 int setIonoValue (TIonoMap *ionoMap, int type, double hgt, double lat, double lon, double value);
 double getIonoValue (TIonoMap *ionoMap, int type, double hgt, double lat, double lon);
+void getIonoValueTECRMS (TIonoMap *ionoMap, double hgt, double lat, double lon, double *TEC, double *RMS);
 int getIonoMapTotalSize (TIonoMap *ionoMap);
 int FPPPConv3Dto1D (TFPPPMap *FPPPMap, int ihgt, int ilat, int ilt);
 int FPPPHLLto1D (TFPPPMap *FPPPMap, double hgt, double lat, double lt);
 int setFPPPValue (TFPPPMap *FPPPMap, int type, double hgt, double lat, double lt, double value);
 double getFPPPValue (TFPPPMap *FPPPMap, int type, double hgt, double lat, double lt);
+void getFPPPValueTECSIGMA (TFPPPMap *FPPPMap, double hgt, double lat, double lt, double *TEC, double *SIGMA);
 int getFPPPMapTotalSize (TFPPPMap *FPPPMap);
 void getIonoPiercePoint (TEpoch *epoch, TPiercePoint *PiercePoint, int satIndex, double earthRadius, double altitude, int mode);
 void getMappingFunction (TPiercePoint *PiercePoint, double earthRadius, double altitude, char functionType[5], TOptions *options);
@@ -3511,7 +4081,10 @@ void SBAShandlespecialevents (TTime currentepoch, TSBASdata  *SBASdata, TOptions
 int IGP2latlon (int bandnumber, int IGP, int *IGPlat, int *IGPlon);
 int IPP2Sqr (double IPPlat, double IPPlon, double *IGPlat, double *IGPlon, double *increment);
 int IGPLatLon2BandNumberIGP (double IGPlat, double IGPlon, int *Bandnumber, int *IGP, int *IGP90);
-void IGPsearch (double IPPlat, double IPPlon, double IGPlat, double IGPlon, double lat_inc, double lon_inc, int IGPinMask[5][11][202], int IGP2Mask[11][202], int *InterpolationMode, int *IGPnumber, int *IGPBandNumber);
+void initIGPnodeTable ();
+int IGPLatLon2BandNumberIGPTable (double IGPlat, double IGPlon, int *Bandnumber, int *IGP, int *IGP90);
+void SBASupdateIGPindex (TSBASdata *SBASdata);
+void IGPsearch (double IPPlat, double IPPlon, double IGPlat, double IGPlon, double lat_inc, double lon_inc, TSBASdata *SBASdata, int *InterpolationMode, int *IGPnumber, int *IGPBandNumber);
 void SBASionoInterpolation (double IPPlat,double IPPlon,double IGPlat1,double IGPlon1,double IGPlat2,double IGPlon2,int *InterpolationMode,double IGPDelays[5],double IGPSigma2[5],double *VerticalDelay,double *Sigma2,double *IPP_Weight);
 int InsideOutside (double latpos, double lonpos, double lat1, double lon1, double lat2, double lon2, double lat3, double lon3, double lat4, double lon4, int shape);
 
@@ -3523,6 +4096,18 @@ int qsort_compare_float(const void *a,const void *b);
 int qsort_compare_double(const void *a,const void *b);
 int qsort_compare_int(const void *a,const void *b);
 
+//Linear time selection (median without sorting)
+double quickSelectDouble (double *values, int n, int k);
+double medianDouble (double *values, int n);
+void initSummaryStat (TSummaryStat *stat, int sketch);
+void addSummaryStat (TSummaryStat *stat, double value);
+int mergeSummaryStat (TSummaryStat *stat, TSummaryStat *statAdd);
+double percentileSummaryStat (TSummaryStat *stat, double percentile);
+void freeSummaryStat (TSummaryStat *stat);
+void epoch2SummaryData (TEpoch *epoch, TStdESA *StdESA, TSummaryData *summary);
+void summaryData2epoch (TSummaryData *summary, TEpoch *epoch, TStdESA *StdESA);
+void mergeSummaryData (TSummaryData *summary, TSummaryData *summaryAdd);
+
 //Recursive directory creation
 int mkdir_recursive(char *path);
 
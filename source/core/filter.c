@@ -407,10 +407,9 @@ int cholinv (double *mat, int n) {
 int cholinv_opt (double *mat, int n) {
  	int 	i,j,k;
  	double 	sum;
- 	double 	*aux;
+ 	double 	aux[m2v_opt(n-1,n-1)+1];	//In the stack, as this function is called many times per epoch (also from multiple threads)
+ 	double	perfT = perfStart();
  
- 	// Reserving space 
- 	aux = malloc((m2v_opt(n-1,n-1)+1)*sizeof(double));
  	memset(aux,0,(m2v_opt(n-1,n-1)+1)*sizeof(double));
 
  	for (i=0;i<n;i++) {
@@ -418,7 +417,7 @@ int cholinv_opt (double *mat, int n) {
 	  		for (sum=mat[m2v_opt(j,i)],k=i-1;k>=0;k--) sum -= mat[m2v_opt(i,k)]*mat[m2v_opt(j,k)];
 	  		if (i==j) {
 				if (sum <= 0) {
-					free(aux);
+					perfStop(perfCHOLESKY,perfT);
 					return -1;  // Cholesky decomposition failed
 				}
 				mat[m2v_opt(i,i)]=sqrt(sum);
@@ -441,7 +440,7 @@ int cholinv_opt (double *mat, int n) {
 
   	memcpy(mat,aux,(m2v_opt(n-1,n-1)+1)*sizeof(double));
 
-  	free (aux);
+  	perfStop(perfCHOLESKY,perfT);
   	return 0;
 }
 
@@ -456,9 +455,7 @@ int cholinv_opt (double *mat, int n) {
  *****************************************************************************/
 void mxv (double *mat, double *vec, int n) {
 	int		i,j;
-	double	*aux;
-
-	aux=(double *)(malloc(sizeof(double)*n));
+	double	aux[n];
 
 	for (i=0;i<n;i++) {
 		aux[i]=0;
@@ -467,7 +464,65 @@ void mxv (double *mat, double *vec, int n) {
 		}
 	}
 	for (i=0;i<n;i++) vec[i]=aux[i];
-	free(aux);
+}
+
+/*****************************************************************************
+ * Name        : getPrefitValue
+ * Description : Compute the prefit (measurement minus model) of a satellite,
+ *               using the smoothed measurement if smoothing is enabled.
+ *               Shared by the step and prefit outlier detectors
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TEpoch  *epoch                  I  N/A  Reference epoch
+ * int  satIndex                   I  N/A  Index of the satellite in the epoch
+ * enum MeasurementType meas       I  N/A  Measurement to compute the prefit
+ * TOptions  *options              I  N/A  TOptions structure
+ * double  *prefit                 O  m    Prefit value
+ * Returned value (int)            O  N/A  1 => Prefit computed
+ *                                         0 => Measurement or model not available
+ *****************************************************************************/
+int getPrefitValue (TEpoch *epoch, int satIndex, enum MeasurementType meas, TOptions *options, double *prefit) {
+	int		ret;
+	double	smoothWith,measurement,model;
+
+	ret = getMeasModelValue(epoch,epoch->sat[satIndex].GNSS,epoch->sat[satIndex].PRN,meas,&measurement,&model);
+	if (ret!=1) return 0;
+
+	// Smoothing
+	if (options->smoothEpochs!=0 && options->smoothMeas[0]!=NA) {
+		ret = getMeasModelValue(epoch,epoch->sat[satIndex].GNSS,epoch->sat[satIndex].PRN,options->smoothMeas[0],&smoothWith,NULL);
+		if (ret!=1) return 0;
+		*prefit = epoch->cycleslip.smoothedMeas[epoch->satCSIndex[epoch->sat[satIndex].GNSS][epoch->sat[satIndex].PRN]][0] + smoothWith - model;
+	} else {
+		*prefit = measurement - model;
+	}
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : getPrefitsAvailableSatellites
+ * Description : Gather the prefits of a measurement for all available satellites
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TEpoch  *epoch                  I  N/A  Reference epoch
+ * enum MeasurementType meas       I  N/A  Measurement to compute the prefits
+ * TOptions  *options              I  N/A  TOptions structure
+ * double  *prefits                O  m    Prefits of the satellites with valid prefit
+ * int  *List2EpochPos             O  N/A  Position in the epoch of each prefit
+ * Returned value (int)            O  N/A  Number of prefits gathered
+ *****************************************************************************/
+int getPrefitsAvailableSatellites (TEpoch *epoch, enum MeasurementType meas, TOptions *options, double *prefits, int *List2EpochPos) {
+	int		i,k=0;
+
+	for(i=0;i<epoch->numSatellites;i++) {
+		if(epoch->sat[i].available==0) continue;
+		if(getPrefitValue(epoch,i,meas,options,&prefits[k])!=1) continue;
+		List2EpochPos[k]=i;
+		k++;
+	}
+
+	return k;
 }
 
 /*****************************************************************************
@@ -497,8 +552,8 @@ void mxv (double *mat, double *vec, int n) {
  *****************************************************************************/
 void StepDetector (TEpoch *epoch, TOptions *options) {
 
-	int				i,j,k;
-	int				ind,ret;
+	int				i,j;
+	int				ind;
 	int				numsats=0;
 	int				C1Cused=0;
 	int				maxelevationpos=-1,secondmaxelevationpos=-1,thirdmaxelevationpos=-1;
@@ -506,7 +561,6 @@ void StepDetector (TEpoch *epoch, TOptions *options) {
 	static int		PrevSatUsed[MAX_GNSS][MAX_SBAS_PRN];
 
 	double			Threshold=73.8;
-	double			measurement,smoothWith,model;
 	double			diff1,diff2,Rescurrfirst,Resprevfirst,Rescurrsecond,Resprevsecond;
 	double			Prefits[MAX_GNSS][MAX_SBAS_PRN];
 	static double	PrevPrefits[MAX_GNSS][MAX_SBAS_PRN];
@@ -533,7 +587,6 @@ void StepDetector (TEpoch *epoch, TOptions *options) {
 	}
 
 	ind = epoch->measOrder[GPS].meas2Ind[C1C];
-	k = epoch->satCSIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN];
 
 	//Retrieve all the prefits available
 	for(i=0;i<epoch->numSatellites;i++) {
@@ -541,24 +594,11 @@ void StepDetector (TEpoch *epoch, TOptions *options) {
 			SatUsed[epoch->sat[i].GNSS][epoch->sat[i].PRN]=0;
 			continue;
 		}
-		ret = getMeasModelValue(epoch,epoch->sat[i].GNSS,epoch->sat[i].PRN,epoch->measOrder[epoch->sat[i].GNSS].ind2Meas[ind],&measurement,&model);
-		if (ret!=1) {
+		if (getPrefitValue(epoch,i,epoch->measOrder[epoch->sat[i].GNSS].ind2Meas[ind],options,&Prefits[epoch->sat[i].GNSS][epoch->sat[i].PRN])!=1) {
 			SatUsed[epoch->sat[i].GNSS][epoch->sat[i].PRN]=0;
 			continue;
 		}
 
-		// Smoothing
-		if (options->smoothEpochs!=0 && options->smoothMeas[0]!=NA) {
-			ret = getMeasModelValue(epoch,epoch->sat[i].GNSS,epoch->sat[i].PRN,options->smoothMeas[0],&smoothWith,NULL);
-			if (ret!=1) {
-				SatUsed[epoch->sat[i].GNSS][epoch->sat[i].PRN]=0;
-				continue;
-			}
-			Prefits[epoch->sat[i].GNSS][epoch->sat[i].PRN] = epoch->cycleslip.smoothedMeas[k][0] + smoothWith - model;
-		} else {
-			Prefits[epoch->sat[i].GNSS][epoch->sat[i].PRN] = measurement - model;
-		}
-
 		if(PrevSatUsed[epoch->sat[i].GNSS][epoch->sat[i].PRN]==1) {
 			numsats++;
 			//Look for the three satellites with higher elevation
@@ -762,10 +802,8 @@ void StepDetector (TEpoch *epoch, TOptions *options) {
  *****************************************************************************/
 void PrefitOutlierDetectorAbsolute (TEpoch *epoch, TOptions *options) {
 
-	int 					i,j,k,l,m;
-	int						ret;
+	int 					i,j,k,l;
 	enum MeasurementType    meas;
-	double 					smoothWith,measurement,model;
 	double					lowerLimit,upperLimit;
 	double					currentPrefitAbs;
 	double					prefits[epoch->usableSatellites];
@@ -781,31 +819,9 @@ void PrefitOutlierDetectorAbsolute (TEpoch *epoch, TOptions *options) {
 	for(j=0;j<options->totalFilterMeasurements;j++) {
 		meas=options->measurement[j];
 		if (whatIs(meas)!=Pseudorange) continue; //Only check prefits on code measurements
-		k=0;
 		NumSatUnselected=0;
     	//Retrieve all the prefits from available satellites
-		for(i=0;i<epoch->numSatellites;i++) {
-			if(epoch->sat[i].available==0) {
-				continue;
-			}
-			ret = getMeasModelValue(epoch,epoch->sat[i].GNSS,epoch->sat[i].PRN,meas,&measurement,&model);
-			if (ret!=1) {
-				continue;
-			}
-			m = epoch->satCSIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN];
-			// Smoothing
-			if (options->smoothEpochs!=0 && options->smoothMeas[0]!=NA) {
-				ret = getMeasModelValue(epoch,epoch->sat[i].GNSS,epoch->sat[i].PRN,options->smoothMeas[0],&smoothWith,NULL);
-				if (ret!=1) {
-					continue;
-				}
-				prefits[k] = epoch->cycleslip.smoothedMeas[m][0] + smoothWith - model;
-			} else {
-				prefits[k] = measurement - model;
-			}
-			List2EpochPos[k]=i;
-			k++;
-		} 
+		k=getPrefitsAvailableSatellites(epoch,meas,options,prefits,List2EpochPos);
 		HalfAvailSat=(int)((double)(k)/2.);
 		for(i=0;i<k;i++) {
 			numOutliers=0;
@@ -887,11 +903,10 @@ void PrefitOutlierDetectorAbsolute (TEpoch *epoch, TOptions *options) {
  *****************************************************************************/
 void PrefitOutlierDetectorMedian (TEpoch *epoch, TOptions *options) {
 
-	int 					i,j,k,m;
-	int						ret;
+	int 					i,j,k;
 	enum MeasurementType    meas;
-	double 					smoothWith,measurement,model,Median,Difference;
-	double					prefits[epoch->usableSatellites],prefitsSorted[epoch->usableSatellites];
+	double 					Median,Difference;
+	double					prefits[epoch->usableSatellites],prefitsScratch[epoch->usableSatellites];
 	int						List2EpochPos[epoch->usableSatellites];
 	int						HalfAvailSat;
 	int						NumSatUnselected;
@@ -900,42 +915,15 @@ void PrefitOutlierDetectorMedian (TEpoch *epoch, TOptions *options) {
 	for(j=0;j<options->totalFilterMeasurements;j++) {
 		meas=options->measurement[j];
 		if (whatIs(meas)!=Pseudorange) continue; //Only check prefits on code measurements
-		k=0;
 		NumSatUnselected=0;
     	//Retrieve all the prefits from available satellites
-		for(i=0;i<epoch->numSatellites;i++) {
-			if(epoch->sat[i].available==0) {
-				continue;
-			}
-			ret = getMeasModelValue(epoch,epoch->sat[i].GNSS,epoch->sat[i].PRN,meas,&measurement,&model);
-			if (ret!=1) {
-				continue;
-			}
-			m = epoch->satCSIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN];
-			// Smoothing
-			if (options->smoothEpochs!=0 && options->smoothMeas[0]!=NA) {
-				ret = getMeasModelValue(epoch,epoch->sat[i].GNSS,epoch->sat[i].PRN,options->smoothMeas[0],&smoothWith,NULL);
-				if (ret!=1) {
-					continue;
-				}
-				prefitsSorted[k] = prefits[k] = epoch->cycleslip.smoothedMeas[m][0] + smoothWith - model;
-			} else {
-				prefitsSorted[k] = prefits[k] = measurement - model;
-			}
-			List2EpochPos[k]=i;
-			k++;
-		} 
+		k=getPrefitsAvailableSatellites(epoch,meas,options,prefits,List2EpochPos);
+		if(k==0) continue;
 		HalfAvailSat=(int)((double)(k)/2.);
 
-		qsort(prefitsSorted,k,sizeof(double),qsort_compare_double);
-
-		if(k%2==0) {
-			//Numer of prefits is even
-			Median=(prefitsSorted[HalfAvailSat-1]+prefitsSorted[HalfAvailSat])/2.;
-		} else {
-			//Numer of prefits is odd
-			Median=prefitsSorted[HalfAvailSat];
-		}
+		//Compute the median with linear time selection over a copy of the prefits (selection reorders the values)
+		memcpy(prefitsScratch,prefits,sizeof(double)*k);
+		Median=medianDouble(prefitsScratch,k);
 
 		for(i=0;i<k;i++) {
 			//Discard satellites which are N times over the median
@@ -1363,9 +1351,12 @@ void initUnkinfo (TEpoch *epoch, TUnkinfo *unkinfo, int nunk, int observations,
  *                                         the current epoch unknowns
  * TUnkinfo  *prevUnkinfo          I  N/A  TUnkinfo structure with information on 
  *                                         the previous epoch unknowns
+ * int  *prevUnk                   O  N/A  Unknown of the previous epoch for each 
+ *                                         current unknown (-1 => new unknown). Not
+ *                                         filled if NULL
  * TOptions  *options              I  N/A  TOptions structure
  *****************************************************************************/
-void prepareCorrelation (TEpoch *epoch, TFilterSolution *solution, int *PRNlist, TUnkinfo *unkinfo, TUnkinfo *prevUnkinfo, TOptions *options) {
+void prepareCorrelation (TEpoch *epoch, TFilterSolution *solution, int *PRNlist, TUnkinfo *unkinfo, TUnkinfo *prevUnkinfo, int *prevUnk, TOptions *options) {
 	int		i,j,alti,altj,k;
 	double	updatedCorrelations[MAX_VECTOR_UNK];
 	double	updatedParameterValues[MAX_UNK];
@@ -1411,6 +1402,18 @@ void prepareCorrelation (TEpoch *epoch, TFilterSolution *solution, int *PRNlist,
 		iniBiasUnk=1;
 		endBiasUnk=0;
 	}
+
+	if (prevUnk!=NULL) {
+		for (i=0;i<unkinfo->nunk;i++) {
+			if (solution->prevNumSatellitesGPS==0) {
+				prevUnk[i] = -1;
+			} else if (i>=iniBiasUnk && i<=endBiasUnk) {
+				prevUnk[i] = new2old[i-iniBiasUnk]==-1?-1:prevUnkinfo->par2unk[BIAS_UNK]+new2old[i-iniBiasUnk];
+			} else {
+				prevUnk[i] = i;
+			}
+		}
+	}
 	
 	// Updating correlations (including Phi and Q)
 	if (solution->prevNumSatellitesGPS!=0) {
@@ -1811,36 +1814,29 @@ double calculatePostfits (TEpoch *epoch, double *solution, TUnkinfo *unkinfo, en
  * double  *newparameters          O  N/A  Parameters after the filter run
  * TUnkinfo  *unkinfo              I  N/A  Structure containing the information of
  *                                         the unknowns
+ * TFilterWorkspace  *workspace    IO N/A  Scratch memory of the filter (reserved
+ *                                         for the unknowns and satellites of the epoch)
  * TStdESA *StdESA                 O  N/A  TStdESA struct                                        
  * TOptions  *options              I  N/A  TOptions structure
  * Returned value (int)            O  N/A  Status of the function
  *                                         0 => Problem in the matrix inversion
  *                                         1 => Solution found
  *****************************************************************************/
-int computeSolution (TEpoch *epoch,double *stddev2postfit, TFilterSolution *solution, double *newcorrelations, double *newparameterValues, TUnkinfo *unkinfo, TStdESA *StdESA, TOptions *options) {
-	double 		*atwa;
-	double 		*atwy;
+int computeSolution (TEpoch *epoch,double *stddev2postfit, TFilterSolution *solution, double *newcorrelations, double *newparameterValues, TUnkinfo *unkinfo, TFilterWorkspace *workspace, TStdESA *StdESA, TOptions *options) {
+	double 		*atwa = workspace->atwa;
+	double 		*atwy = workspace->atwy;
 	//double 		*aux;
-	double		*prefits;
-	double		*weights;
-	double		**G;
+	double		*prefits = workspace->prefits;
+	double		*weights = workspace->weights;
+	double		**G = workspace->G;
 	double		SoW;
 	int			GPSweek;
-	int			*k;
-	int			*kmask;
+	int			*k = workspace->k;
+	int			*kmask = workspace->kmask;
 	int 		i,j;
 	int			res;
 	char		epochString[50];
 
-	atwy=malloc(sizeof(double)*unkinfo->nunk);
-	atwa=malloc(sizeof(double)*unkinfo->nunkvector);
-	prefits=malloc(sizeof(double)*epoch->numSatellites);
-	weights=malloc(sizeof(double)*epoch->numSatellites);
-	G=malloc(sizeof(double *)*epoch->numSatellites);
-	for(i=0;i<epoch->numSatellites;i++) {
-		G[i]=malloc(sizeof(double)*4);
-	}
-
 
 	// Initializing At*W*A and At*W*Y
 	for (i=0;i<unkinfo->nunk;i++) {
@@ -1860,8 +1856,6 @@ int computeSolution (TEpoch *epoch,double *stddev2postfit, TFilterSolution *solu
 	res = cholinv_opt(atwa,unkinfo->nunk);
 
 	if (res==-1) {
-		free(atwa);
-		free(atwy);
 		sprintf(messagestr,"Problem in CHOLESKI1 res=%d\n",res);
 		printError(messagestr,options);
 		return 0;
@@ -1918,8 +1912,6 @@ int computeSolution (TEpoch *epoch,double *stddev2postfit, TFilterSolution *solu
 
 	//Compute Stanford-ESA plots
 	if(options->stanfordesa==1 && options->useDatasummary>=1) {
-		k=malloc(sizeof(int)*(epoch->numSatSolutionSBAS+1));
-		kmask=malloc(sizeof(int)*(epoch->numSatSolutionSBAS+1));
 		k[0]=0;
 		for(i=0;i<=epoch->numSatSolutionSBAS;i++) {
 			kmask[i]=1;
@@ -1931,20 +1923,7 @@ int computeSolution (TEpoch *epoch,double *stddev2postfit, TFilterSolution *solu
 		//be done at each interation of the Stanford-ESA
 		sprintf(epochString,"%17s    %4d %9.2f",t2doystr(&epoch->t),GPSweek,SoW);
 		StanfordESAComputationRecursive(epoch,epochString,k,kmask,epoch->numSatSolutionSBAS,0,G,prefits,weights,unkinfo,StdESA,options);
-		free(k);
-		free(kmask);
-	}
-
-
-	// Freeing memory
-	free(atwa);
-	free(atwy);
-	free(weights);
-	free(prefits);
-	for(i=0;i<epoch->numSatellites;i++) {
-		free(G[i]);
 	}
-	free(G);
 
 	return 1;
 }
@@ -2138,8 +2117,8 @@ void StanfordESAComputationRecursive (TEpoch *epoch, char *epochString, int *k,
 	int						nunkvector,nunk;
 	unsigned long long int	posx,posy; //Declared as long long int to avoid overflow when PE or PL are very high
 	double					dmajor,HPL,VPL,Herror,Verror;
-	double					*Vector_GtWG;
-	double					*Vector_GtY;
+	double					Vector_GtWG[10];
+	double					Vector_GtY[4];
 	double					HIR,VIR,quantError,quantPL;
 	char					strmask[300],auxstr[300];
 
@@ -2150,10 +2129,6 @@ void StanfordESAComputationRecursive (TEpoch *epoch, char *epochString, int *k,
 	nunkvector=10;	
 	nunk=4;
 
-	//Mount matrix data
-	Vector_GtWG=malloc(sizeof(double)*nunkvector);
-	Vector_GtY=malloc(sizeof(double)*nunk);
-
 	// Initializing At*W*A and At*W*Y
 	for (i=0;i<nunk;i++) {
 		Vector_GtY[i]=0;
@@ -2311,11 +2286,6 @@ void StanfordESAComputationRecursive (TEpoch *epoch, char *epochString, int *k,
 
 		}
 	}
-
-
-	//Free memory
-	free(Vector_GtWG);
-	free(Vector_GtY);
 }
 
 /*****************************************************************************
@@ -2366,17 +2336,11 @@ void SBASSummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolution
 	SBASdatabox->TotalPAEpochs++;
 
 	//Save DOP values
-	epoch->HDOP=realloc(epoch->HDOP,sizeof(double)*SBASdatabox->TotalPAEpochs);
-	epoch->PDOP=realloc(epoch->PDOP,sizeof(double)*SBASdatabox->TotalPAEpochs);
-	epoch->GDOP=realloc(epoch->GDOP,sizeof(double)*SBASdatabox->TotalPAEpochs);
-	epoch->VDOP=realloc(epoch->VDOP,sizeof(double)*SBASdatabox->TotalPAEpochs);
-	epoch->TDOP=realloc(epoch->TDOP,sizeof(double)*SBASdatabox->TotalPAEpochs);
-
-	epoch->HDOP[SBASdatabox->TotalPAEpochs-1]=solution->HDOP;
-	epoch->PDOP[SBASdatabox->TotalPAEpochs-1]=solution->PDOP;
-	epoch->GDOP[SBASdatabox->TotalPAEpochs-1]=solution->GDOP;
-	epoch->VDOP[SBASdatabox->TotalPAEpochs-1]=solution->VDOP;
-	epoch->TDOP[SBASdatabox->TotalPAEpochs-1]=solution->TDOP;
+	addSummaryStat(&epoch->HDOP,solution->HDOP);
+	addSummaryStat(&epoch->PDOP,solution->PDOP);
+	addSummaryStat(&epoch->GDOP,solution->GDOP);
+	addSummaryStat(&epoch->VDOP,solution->VDOP);
+	addSummaryStat(&epoch->TDOP,solution->TDOP);
 
 	//Save maximum values of DOP
 	if (solution->HDOP>=epoch->MaxHDOP) {
@@ -2478,11 +2442,8 @@ void SBASSummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolution
 		}
 
 		//Save horizontal and vertical error values for percentile computation
-		epoch->HError=realloc(epoch->HError,sizeof(double)*epoch->TotalEpochsRef);
-		epoch->VError=realloc(epoch->VError,sizeof(double)*epoch->TotalEpochsRef);
-
-		epoch->HError[epoch->TotalEpochsRef-1]=Herror;
-		epoch->VError[epoch->TotalEpochsRef-1]=Verror;
+		addSummaryStat(&epoch->HError,Herror);
+		addSummaryStat(&epoch->VError,Verror);
 
 	} else if (options->recPosProvided==1 && UseReferenceFile==1 && epoch->receiver.RefPositionAvail==0) {
 		epoch->NumNoRefSumSkipped++;
@@ -2500,11 +2461,8 @@ void SBASSummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolution
 
 
 	//Save horizontal and vertical protection values for percentile computation
-	SBASdatabox->HPL=realloc(SBASdatabox->HPL,sizeof(double)*SBASdatabox->TotalPAEpochs);
-	SBASdatabox->VPL=realloc(SBASdatabox->VPL,sizeof(double)*SBASdatabox->TotalPAEpochs);
-
-	SBASdatabox->HPL[SBASdatabox->TotalPAEpochs-1]=solution->HPL;
-	SBASdatabox->VPL[SBASdatabox->TotalPAEpochs-1]=solution->VPL;
+	addSummaryStat(&SBASdatabox->HPL,solution->HPL);
+	addSummaryStat(&SBASdatabox->VPL,solution->VPL);
 
 	//Check if current epoch is under alarm limits
 	if(solution->HPL<options->HorAlarmLimit && solution->VPL<options->VerAlarmLimit) {
@@ -2578,17 +2536,11 @@ void DGNSSSummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolutio
         epoch->TotalEpochsDGNSS++;
 
 		//Save DOP values
-		epoch->HDOP=realloc(epoch->HDOP,sizeof(double)*epoch->TotalEpochsDGNSS);
-		epoch->PDOP=realloc(epoch->PDOP,sizeof(double)*epoch->TotalEpochsDGNSS);
-		epoch->GDOP=realloc(epoch->GDOP,sizeof(double)*epoch->TotalEpochsDGNSS);
-		epoch->VDOP=realloc(epoch->VDOP,sizeof(double)*epoch->TotalEpochsDGNSS);
-		epoch->TDOP=realloc(epoch->TDOP,sizeof(double)*epoch->TotalEpochsDGNSS);
-
-		epoch->HDOP[epoch->TotalEpochsDGNSS-1]=solution->HDOP;
-		epoch->PDOP[epoch->TotalEpochsDGNSS-1]=solution->PDOP;
-		epoch->GDOP[epoch->TotalEpochsDGNSS-1]=solution->GDOP;
-		epoch->VDOP[epoch->TotalEpochsDGNSS-1]=solution->VDOP;
-		epoch->TDOP[epoch->TotalEpochsDGNSS-1]=solution->TDOP;
+		addSummaryStat(&epoch->HDOP,solution->HDOP);
+		addSummaryStat(&epoch->PDOP,solution->PDOP);
+		addSummaryStat(&epoch->GDOP,solution->GDOP);
+		addSummaryStat(&epoch->VDOP,solution->VDOP);
+		addSummaryStat(&epoch->TDOP,solution->TDOP);
 
 		//Save maximum values of DOP
 		if (solution->HDOP>=epoch->MaxHDOP) {
@@ -2662,11 +2614,8 @@ void DGNSSSummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolutio
             }
 
             //Save horizontal and vertical error values for percentile computation
-            epoch->HError=realloc(epoch->HError,sizeof(double)*epoch->TotalEpochsRef);
-            epoch->VError=realloc(epoch->VError,sizeof(double)*epoch->TotalEpochsRef);
-
-            epoch->HError[epoch->TotalEpochsRef-1]=Herror;
-            epoch->VError[epoch->TotalEpochsRef-1]=Verror;
+            addSummaryStat(&epoch->HError,Herror);
+            addSummaryStat(&epoch->VError,Verror);
 
 
 		} else if (options->recPosProvided==1 && UseReferenceFile==1 && epoch->receiver.RefPositionAvail==0) {
@@ -2700,17 +2649,11 @@ void SummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolution *so
 	epoch->TotalEpochsSol++;
 
 	//Save DOP values
-	epoch->HDOP=realloc(epoch->HDOP,sizeof(double)*epoch->TotalEpochsSol);
-	epoch->PDOP=realloc(epoch->PDOP,sizeof(double)*epoch->TotalEpochsSol);
-	epoch->GDOP=realloc(epoch->GDOP,sizeof(double)*epoch->TotalEpochsSol);
-	epoch->VDOP=realloc(epoch->VDOP,sizeof(double)*epoch->TotalEpochsSol);
-	epoch->TDOP=realloc(epoch->TDOP,sizeof(double)*epoch->TotalEpochsSol);
-
-	epoch->HDOP[epoch->TotalEpochsSol-1]=solution->HDOP;
-	epoch->PDOP[epoch->TotalEpochsSol-1]=solution->PDOP;
-	epoch->GDOP[epoch->TotalEpochsSol-1]=solution->GDOP;
-	epoch->VDOP[epoch->TotalEpochsSol-1]=solution->VDOP;
-	epoch->TDOP[epoch->TotalEpochsSol-1]=solution->TDOP;
+	addSummaryStat(&epoch->HDOP,solution->HDOP);
+	addSummaryStat(&epoch->PDOP,solution->PDOP);
+	addSummaryStat(&epoch->GDOP,solution->GDOP);
+	addSummaryStat(&epoch->VDOP,solution->VDOP);
+	addSummaryStat(&epoch->TDOP,solution->TDOP);
 
 	//Save maximum values of DOP
 	if (solution->HDOP>=epoch->MaxHDOP) {
@@ -2786,11 +2729,8 @@ void SummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolution *so
 		}
 
 		//Save horizontal and vertical error values for percentile computation
-		epoch->HError=realloc(epoch->HError,sizeof(double)*epoch->TotalEpochsRef);
-		epoch->VError=realloc(epoch->VError,sizeof(double)*epoch->TotalEpochsRef);
-
-		epoch->HError[epoch->TotalEpochsRef-1]=Herror;
-		epoch->VError[epoch->TotalEpochsRef-1]=Verror;
+		addSummaryStat(&epoch->HError,Herror);
+		addSummaryStat(&epoch->VError,Verror);
 	} else if (options->recPosProvided==1 && UseReferenceFile==1 && epoch->receiver.RefPositionAvail==0) {
 		epoch->NumNoRefSumSkipped++;
 	}
@@ -3228,6 +3168,11 @@ void updatePRNlist (TEpoch *epoch, int *PRNlist, TFilterSolution *solution) {
  *                                         of the unknowns of the previous epoch
  *                                         (updated)
  * TStdESA *StdESA                 O  N/A  TStdESA struct                                        
+ * TSmoother  *smoother            IO N/A  Forward-backward smoother where the
+ *                                         computed epoch is saved (NULL if the
+ *                                         smoother is not used)
+ * TFilterWorkspace  *workspace    IO N/A  Scratch memory of the filter, reused
+ *                                         in all epochs
  * TOptions  *options              I  N/A  TOptions structure
  * Returned value (int)            O  N/A  Status of the function
  *                                         4 => In SBAS mode and option select best GEO is enabled, process with next GEO or mode
@@ -3240,10 +3185,8 @@ void updatePRNlist (TEpoch *epoch, int *PRNlist, TFilterSolution *solution) {
  *                                        -1 => Epoch not computable due to geometry matrix is singular
  *                                        -2 => Epoch not computable due to GDOP over threshold
  *****************************************************************************/
-int Kalman (TEpoch *epoch, TFilterSolution *solution, int *PRNlist, TUnkinfo *prevUnkinfo, TStdESA *StdESA, TOptions *options) {
-	double			newcorrelations[MAX_VECTOR_UNK];
+int Kalman (TEpoch *epoch, TFilterSolution *solution, int *PRNlist, TUnkinfo *prevUnkinfo, TStdESA *StdESA, TSmoother *smoother, TFilterWorkspace *workspace, TOptions *options) {
 	double			stddev2postfit;
-	double			newparameterValues[MAX_UNK];
 	TUnkinfo		unkinfo;
 	TFilterSolution	aux;
 	static int		first = 1;
@@ -3438,8 +3381,9 @@ int Kalman (TEpoch *epoch, TFilterSolution *solution, int *PRNlist, TUnkinfo *pr
 
 		memcpy(&aux, solution, sizeof(TFilterSolution));	
 		initUnkinfo(epoch, &unkinfo, calculateUnknowns(epoch->numSatellites, options), epoch->numSatellites, fabs(tdiff(&epoch->t,&prevT)), options);
-		prepareCorrelation(epoch, solution, PRNlist, &unkinfo, prevUnkinfo, options);
-		if (!computeSolution(epoch, &stddev2postfit, solution, newcorrelations, newparameterValues, &unkinfo, StdESA, options)) {
+		prepareCorrelation(epoch, solution, PRNlist, &unkinfo, prevUnkinfo, smoother!=NULL?smoother->pending->prevUnk:NULL, options);
+		reserveFilterWorkspace(workspace, unkinfo.nunk, unkinfo.nunkvector, epoch->numSatellites);
+		if (!computeSolution(epoch, &stddev2postfit, solution, workspace->newcorrelations, workspace->newparameterValues, &unkinfo, workspace, StdESA, options)) {
 			memcpy(solution, &aux, sizeof(TFilterSolution));
 			return 0;
 		}
@@ -3466,10 +3410,14 @@ int Kalman (TEpoch *epoch, TFilterSolution *solution, int *PRNlist, TUnkinfo *pr
 
 		printFilter(&epoch->t, unkinfo.nunk, solution, options);
 
+		if (smoother!=NULL) {
+			saveSmootherEpoch(epoch, smoother, solution, workspace->newcorrelations, &unkinfo, prevUnkinfo, options);
+		}
+
 		// Preparing values for next epoch
 		memcpy(prevUnkinfo,&unkinfo,sizeof(TUnkinfo));
-		memcpy(solution->correlations,newcorrelations,sizeof(double)*unkinfo.nunkvector);
-		memcpy(solution->parameters,newparameterValues,sizeof(double)*unkinfo.nunk);
+		memcpy(solution->correlations,workspace->newcorrelations,sizeof(double)*unkinfo.nunkvector);
+		memcpy(solution->parameters,workspace->newparameterValues,sizeof(double)*unkinfo.nunk);
 
 		updatePRNlist(epoch, PRNlist, solution);
 		
@@ -3489,3 +3437,470 @@ int Kalman (TEpoch *epoch, TFilterSolution *solution, int *PRNlist, TUnkinfo *pr
 		return 0;
 	}
 }
+
+/*****************************************************************************
+ * Name        : initFilterWorkspace
+ * Description : Initialises the scratch memory of the filter (no memory is
+ *               reserved until the first epoch)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TFilterWorkspace  *workspace    O  N/A  TFilterWorkspace structure
+ *****************************************************************************/
+void initFilterWorkspace (TFilterWorkspace *workspace) {
+	workspace->atwa = NULL;
+	workspace->atwy = NULL;
+	workspace->newcorrelations = NULL;
+	workspace->newparameterValues = NULL;
+	workspace->sizeUnk = 0;
+	workspace->sizeUnkVector = 0;
+	workspace->prefits = NULL;
+	workspace->weights = NULL;
+	workspace->Gbuffer = NULL;
+	workspace->G = NULL;
+	workspace->k = NULL;
+	workspace->kmask = NULL;
+	workspace->sizeSat = 0;
+}
+
+/*****************************************************************************
+ * Name        : filterWorkspaceSizeClass
+ * Description : Size reserved in the filter scratch memory for a given number
+ *               of elements. Sizes are powers of two, so the buffers are only
+ *               reserved again a few times during the processing
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * int  n                          I  N/A  Number of elements needed
+ * Returned value (int)            O  N/A  Number of elements to reserve
+ *****************************************************************************/
+static int filterWorkspaceSizeClass (int n) {
+	int		size = FILTER_WORKSPACE_MINSIZE;
+
+	while (size<n) size *= 2;
+	return size;
+}
+
+/*****************************************************************************
+ * Name        : reserveFilterWorkspace
+ * Description : Makes the scratch memory of the filter big enough for the
+ *               unknowns and satellites of the current epoch. Buffers only
+ *               grow, so they are reused across epochs, GEO switches and
+ *               filter iterations
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TFilterWorkspace  *workspace    IO N/A  TFilterWorkspace structure
+ * int  nunk                       I  N/A  Number of unknowns
+ * int  nunkvector                 I  N/A  Size of the covariance matrix in vector form
+ * int  numSatellites              I  N/A  Number of satellites of the epoch
+ *****************************************************************************/
+void reserveFilterWorkspace (TFilterWorkspace *workspace, int nunk, int nunkvector, int numSatellites) {
+	int		i;
+
+	if (nunk>workspace->sizeUnk) {
+		workspace->sizeUnk = filterWorkspaceSizeClass(nunk);
+		free(workspace->atwy);
+		free(workspace->newparameterValues);
+		workspace->atwy = malloc(sizeof(double)*workspace->sizeUnk);
+		workspace->newparameterValues = malloc(sizeof(double)*workspace->sizeUnk);
+	}
+	if (nunkvector>workspace->sizeUnkVector) {
+		workspace->sizeUnkVector = filterWorkspaceSizeClass(nunkvector);
+		free(workspace->atwa);
+		free(workspace->newcorrelations);
+		workspace->atwa = malloc(sizeof(double)*workspace->sizeUnkVector);
+		workspace->newcorrelations = malloc(sizeof(double)*workspace->sizeUnkVector);
+	}
+	// One more element than satellites for the Stanford-ESA combination counters
+	if (numSatellites+1>workspace->sizeSat) {
+		workspace->sizeSat = filterWorkspaceSizeClass(numSatellites+1);
+		free(workspace->prefits);
+		free(workspace->weights);
+		free(workspace->Gbuffer);
+		free(workspace->G);
+		free(workspace->k);
+		free(workspace->kmask);
+		workspace->prefits = malloc(sizeof(double)*workspace->sizeSat);
+		workspace->weights = malloc(sizeof(double)*workspace->sizeSat);
+		workspace->Gbuffer = malloc(sizeof(double)*4*workspace->sizeSat);
+		workspace->G = malloc(sizeof(double *)*workspace->sizeSat);
+		workspace->k = malloc(sizeof(int)*workspace->sizeSat);
+		workspace->kmask = malloc(sizeof(int)*workspace->sizeSat);
+		for (i=0;i<workspace->sizeSat;i++) {
+			workspace->G[i] = &workspace->Gbuffer[4*i];
+		}
+	}
+}
+
+/*****************************************************************************
+ * Name        : freeFilterWorkspace
+ * Description : Frees the scratch memory of the filter
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TFilterWorkspace  *workspace    IO N/A  TFilterWorkspace structure
+ *****************************************************************************/
+void freeFilterWorkspace (TFilterWorkspace *workspace) {
+	free(workspace->atwa);
+	free(workspace->atwy);
+	free(workspace->newcorrelations);
+	free(workspace->newparameterValues);
+	free(workspace->prefits);
+	free(workspace->weights);
+	free(workspace->Gbuffer);
+	free(workspace->G);
+	free(workspace->k);
+	free(workspace->kmask);
+	initFilterWorkspace(workspace);
+}
+
+/*****************************************************************************
+ * Name        : initSmoother
+ * Description : Initialises the forward-backward smoother
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSmoother  *smoother            O  N/A  TSmoother structure
+ *****************************************************************************/
+void initSmoother (TSmoother *smoother) {
+	smoother->buffer = NULL;
+	smoother->bufferLen = 0;
+	smoother->bufferSize = 0;
+	smoother->fd = NULL;
+	smoother->offset = NULL;
+	smoother->numEpochs = 0;
+	smoother->maxEpochs = 0;
+	smoother->current = 0;
+	smoother->pending = malloc(sizeof(TSmootherEpoch));
+	smoother->epoch = malloc(sizeof(TSmootherEpoch));
+	smoother->next = malloc(sizeof(TSmootherEpoch));
+	smoother->S = malloc(sizeof(double)*MAX_UNK*MAX_UNK);
+	smoother->C = malloc(sizeof(double)*MAX_UNK*MAX_UNK);
+	smoother->CD = malloc(sizeof(double)*MAX_UNK*MAX_UNK);
+	smoother->Pp = malloc(sizeof(double)*MAX_VECTOR_UNK);
+	smoother->D = malloc(sizeof(double)*MAX_VECTOR_UNK);
+}
+
+/*****************************************************************************
+ * Name        : freeSmoother
+ * Description : Frees the memory of the forward-backward smoother
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSmoother  *smoother            IO N/A  TSmoother structure
+ *****************************************************************************/
+void freeSmoother (TSmoother *smoother) {
+	free(smoother->buffer);
+	free(smoother->offset);
+	free(smoother->pending);
+	free(smoother->epoch);
+	free(smoother->next);
+	free(smoother->S);
+	free(smoother->C);
+	free(smoother->CD);
+	free(smoother->Pp);
+	free(smoother->D);
+	if (smoother->fd!=NULL) fclose(smoother->fd);
+	smoother->buffer = NULL;
+	smoother->offset = NULL;
+	smoother->fd = NULL;
+	smoother->numEpochs = 0;
+	smoother->current = 0;
+}
+
+/*****************************************************************************
+ * Name        : writeSmootherLog
+ * Description : Appends data to the forward filter log of the smoother
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSmoother  *smoother            IO N/A  TSmoother structure
+ * void  *data                     I  N/A  Data to be written
+ * size_t  len                     I  N/A  Number of bytes
+ * TOptions  *options              I  N/A  TOptions structure
+ *****************************************************************************/
+void writeSmootherLog (TSmoother *smoother, void *data, size_t len, TOptions *options) {
+	if (smoother->fd!=NULL) {
+		if (fwrite(data,1,len,smoother->fd)!=len) {
+			printError("Writing the temporary file of the forward-backward smoother",options);
+		}
+		return;
+	}
+	if (smoother->bufferLen+len>smoother->bufferSize) {
+		smoother->bufferSize = smoother->bufferSize==0?1048576:2*smoother->bufferSize;
+		while (smoother->bufferLen+len>smoother->bufferSize) smoother->bufferSize *= 2;
+		if (smoother->bufferSize>SMOOTHER_MEMORY_LOG) smoother->bufferSize = SMOOTHER_MEMORY_LOG;
+		smoother->buffer = realloc(smoother->buffer,smoother->bufferSize);
+		if (smoother->buffer==NULL) {
+			printError("Not enough memory for the forward-backward smoother",options);
+		}
+	}
+	memcpy(&smoother->buffer[smoother->bufferLen],data,len);
+	smoother->bufferLen += len;
+}
+
+/*****************************************************************************
+ * Name        : readSmootherLog
+ * Description : Reads data from the forward filter log of the smoother
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSmoother  *smoother            I  N/A  TSmoother structure
+ * size_t  pos                     I  N/A  Position of the data in the log
+ * void  *data                     O  N/A  Data read
+ * size_t  len                     I  N/A  Number of bytes
+ * TOptions  *options              I  N/A  TOptions structure
+ *****************************************************************************/
+void readSmootherLog (TSmoother *smoother, size_t pos, void *data, size_t len, TOptions *options) {
+	if (pos<smoother->bufferLen) {
+		memcpy(data,&smoother->buffer[pos],len);
+	} else if (fseek(smoother->fd,(long)(pos-smoother->bufferLen),SEEK_SET)!=0 || fread(data,1,len,smoother->fd)!=len) {
+		printError("Reading the temporary file of the forward-backward smoother",options);
+	}
+}
+
+/*****************************************************************************
+ * Name        : saveSmootherEpoch
+ * Description : Saves the epoch computed by the filter in the forward filter
+ *               log of the smoother
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TEpoch  *epoch                  I  N/A  TEpoch structure
+ * TSmoother  *smoother            IO N/A  TSmoother structure (the unknowns of
+ *                                         the previous epoch are already in
+ *                                         smoother->pending->prevUnk)
+ * TFilterSolution  *solution      I  N/A  Filter solution of the epoch
+ * double  *covariance             I  N/A  Covariance matrix of the solution
+ * TUnkinfo  *unkinfo              I  N/A  Unknowns of the epoch
+ * TUnkinfo  *prevUnkinfo          I  N/A  Unknowns of the previous epoch
+ * TOptions  *options              I  N/A  TOptions structure
+ *****************************************************************************/
+void saveSmootherEpoch (TEpoch *epoch, TSmoother *smoother, TFilterSolution *solution, double *covariance, TUnkinfo *unkinfo, TUnkinfo *prevUnkinfo, TOptions *options) {
+	TSmootherEpoch	*pending = smoother->pending;
+	int				n = unkinfo->nunk;
+	int				nv = unkinfo->nunkvector;
+	int				i;
+	size_t			len;
+
+	memcpy(&pending->t,&epoch->t,sizeof(TTime));
+	pending->nunk = n;
+	pending->nunkvector = nv;
+	memcpy(pending->par2unk,unkinfo->par2unk,sizeof(int)*MAX_PAR);
+	pending->dop = solution->dop;
+	pending->GDOP = solution->GDOP;
+	pending->PDOP = solution->PDOP;
+	pending->TDOP = solution->TDOP;
+	pending->HDOP = solution->HDOP;
+	pending->VDOP = solution->VDOP;
+	pending->HPL = solution->HPL;
+	pending->VPL = solution->VPL;
+	memcpy(pending->aproxPosition,epoch->receiver.aproxPosition,sizeof(double)*3);
+	memcpy(pending->aproxPositionRover,epoch->receiver.aproxPositionRover,sizeof(double)*3);
+	memcpy(pending->aproxPositionRef,epoch->receiver.aproxPositionRef,sizeof(double)*3);
+	memcpy(pending->orientation,epoch->receiver.orientation,sizeof(double)*9);
+	memcpy(pending->orientationRover,epoch->receiver.orientationRover,sizeof(double)*9);
+	memcpy(pending->orientationRef,epoch->receiver.orientationRef,sizeof(double)*9);
+	pending->ZTD = epoch->ZTD;
+	pending->RefPositionAvail = epoch->receiver.RefPositionAvail;
+	pending->numSatSolutionFilter = epoch->numSatSolutionFilter;
+	// Propagation used by the filter from the previous epoch (as in prepareCorrelation)
+	for (i=0;i<n;i++) {
+		if (pending->prevUnk[i]==-1) {
+			pending->phi[i] = 0;
+			pending->qnoise[i] = 0;
+		} else {
+			pending->phi[i] = prevUnkinfo->phi[pending->prevUnk[i]];
+			pending->qnoise[i] = prevUnkinfo->qnoise[pending->prevUnk[i]];
+		}
+	}
+	memcpy(pending->x,solution->x,sizeof(double)*n);
+	memcpy(pending->P,covariance,sizeof(double)*nv);
+
+	// Only the used part of the arrays is saved
+	len = offsetof(TSmootherEpoch,prevUnk) + sizeof(int)*n + sizeof(double)*(4*n+nv);
+	if (smoother->fd==NULL && smoother->bufferLen+len>SMOOTHER_MEMORY_LOG) {
+		smoother->fd = tmpfile();
+		if (smoother->fd==NULL) {
+			printError("Creating the temporary file of the forward-backward smoother",options);
+		}
+	}
+	if (smoother->numEpochs==smoother->maxEpochs) {
+		smoother->maxEpochs = smoother->maxEpochs==0?1024:2*smoother->maxEpochs;
+		smoother->offset = realloc(smoother->offset,sizeof(size_t)*smoother->maxEpochs);
+		if (smoother->offset==NULL) {
+			printError("Not enough memory for the forward-backward smoother",options);
+		}
+	}
+	if (smoother->fd==NULL) smoother->offset[smoother->numEpochs] = smoother->bufferLen;
+	else smoother->offset[smoother->numEpochs] = smoother->bufferLen + (size_t)ftell(smoother->fd);
+	writeSmootherLog(smoother,pending,offsetof(TSmootherEpoch,prevUnk),options);
+	writeSmootherLog(smoother,pending->prevUnk,sizeof(int)*n,options);
+	writeSmootherLog(smoother,pending->phi,sizeof(double)*n,options);
+	writeSmootherLog(smoother,pending->qnoise,sizeof(double)*n,options);
+	writeSmootherLog(smoother,pending->x,sizeof(double)*n,options);
+	writeSmootherLog(smoother,pending->P,sizeof(double)*nv,options);
+	smoother->numEpochs++;
+	smoother->current = smoother->numEpochs;
+}
+
+/*****************************************************************************
+ * Name        : readSmootherEpoch
+ * Description : Reads an epoch from the forward filter log of the smoother
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSmoother  *smoother            I  N/A  TSmoother structure
+ * int  index                      I  N/A  Index of the epoch in the log
+ * TSmootherEpoch  *sepoch         O  N/A  Epoch read
+ * TOptions  *options              I  N/A  TOptions structure
+ *****************************************************************************/
+void readSmootherEpoch (TSmoother *smoother, int index, TSmootherEpoch *sepoch, TOptions *options) {
+	size_t	pos = smoother->offset[index];
+	int		n;
+
+	readSmootherLog(smoother,pos,sepoch,offsetof(TSmootherEpoch,prevUnk),options);
+	n = sepoch->nunk;
+	pos += offsetof(TSmootherEpoch,prevUnk);
+	readSmootherLog(smoother,pos,sepoch->prevUnk,sizeof(int)*n,options);
+	pos += sizeof(int)*n;
+	readSmootherLog(smoother,pos,sepoch->phi,sizeof(double)*n,options);
+	pos += sizeof(double)*n;
+	readSmootherLog(smoother,pos,sepoch->qnoise,sizeof(double)*n,options);
+	pos += sizeof(double)*n;
+	readSmootherLog(smoother,pos,sepoch->x,sizeof(double)*n,options);
+	pos += sizeof(double)*n;
+	readSmootherLog(smoother,pos,sepoch->P,sizeof(double)*sepoch->nunkvector,options);
+}
+
+/*****************************************************************************
+ * Name        : getSmoothedEpoch
+ * Description : Computes the smoothed solution of the previous epoch of the
+ *               forward filter log (Rauch-Tung-Striebel smoother). The first
+ *               call returns the last epoch of the log, which is not changed
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TEpoch  *epoch                  O  N/A  TEpoch structure (time and receiver data
+ *                                         of the smoothed epoch)
+ * TSmoother  *smoother            IO N/A  TSmoother structure
+ * TFilterSolution  *solution      O  N/A  Smoothed solution
+ * TUnkinfo  *unkinfo              O  N/A  Unknowns of the smoothed epoch
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  1 => Epoch smoothed
+ *                                         0 => No more epochs in the log
+ *****************************************************************************/
+int getSmoothedEpoch (TEpoch *epoch, TSmoother *smoother, TFilterSolution *solution, TUnkinfo *unkinfo, TOptions *options) {
+	TSmootherEpoch	*cur, *next;
+	double			*S = smoother->S;
+	double			*C = smoother->C;
+	double			*CD = smoother->CD;
+	double			*Pp = smoother->Pp;
+	double			*D = smoother->D;
+	double			dx[MAX_UNK];
+	int				prop[MAX_UNK];
+	double			sum;
+	int				n, m;
+	int				i, j, k;
+
+	if (smoother->current<=0) return 0;
+	smoother->current--;
+
+	// The epoch smoothed in the previous call is the following one of the current epoch
+	cur = smoother->next;
+	smoother->next = smoother->epoch;
+	smoother->epoch = cur;
+	next = smoother->next;
+	readSmootherEpoch(smoother,smoother->current,cur,options);
+
+	if (smoother->current<smoother->numEpochs-1) {
+		// Only the unknowns propagated from the current epoch are related to it (the rest start again)
+		m = 0;
+		for (j=0;j<next->nunk;j++) {
+			if (next->prevUnk[j]!=-1 && next->phi[j]!=0) prop[m++] = j;
+		}
+		n = cur->nunk;
+		// Being P and x the filtered covariance and values, Phi the propagation and Q the process noise:
+		//   Pp = Phi*P*Phi' + Q (covariance of the prediction)
+		//   S = P*Phi' (covariance between the epoch and the prediction)
+		//   C = S*Pp^-1 (gain)
+		//   x_smoothed = x + C*(x_smoothed_next - Phi*x)
+		//   P_smoothed = P + C*(P_smoothed_next - Pp)*C'
+		for (i=0;i<m;i++) {
+			for (j=0;j<=i;j++) {
+				Pp[m2v(i,j)] = next->phi[prop[i]]*next->phi[prop[j]]*cur->P[m2v(next->prevUnk[prop[i]],next->prevUnk[prop[j]])];
+			}
+			Pp[m2v(i,i)] += next->qnoise[prop[i]];
+			dx[i] = next->x[prop[i]] - next->phi[prop[i]]*cur->x[next->prevUnk[prop[i]]];
+		}
+		for (i=0;i<m;i++) {
+			for (j=0;j<=i;j++) {
+				D[m2v(i,j)] = next->P[m2v(prop[i],prop[j])] - Pp[m2v(i,j)];
+			}
+		}
+		for (i=0;i<n;i++) {
+			for (j=0;j<m;j++) {
+				S[i*m+j] = cur->P[m2v(i,next->prevUnk[prop[j]])]*next->phi[prop[j]];
+			}
+		}
+		if (m>0 && cholinv_opt(Pp,m)==0) {
+			for (i=0;i<n;i++) {
+				for (j=0;j<m;j++) {
+					sum = 0;
+					for (k=0;k<m;k++) {
+						sum += S[i*m+k]*Pp[m2v(k,j)];
+					}
+					C[i*m+j] = sum;
+				}
+			}
+			for (i=0;i<n;i++) {
+				for (j=0;j<m;j++) {
+					sum = 0;
+					for (k=0;k<m;k++) {
+						sum += C[i*m+k]*D[m2v(k,j)];
+					}
+					CD[i*m+j] = sum;
+				}
+			}
+			for (i=0;i<n;i++) {
+				sum = 0;
+				for (j=0;j<m;j++) {
+					sum += C[i*m+j]*dx[j];
+				}
+				cur->x[i] += sum;
+				for (k=0;k<=i;k++) {
+					sum = 0;
+					for (j=0;j<m;j++) {
+						sum += CD[i*m+j]*C[k*m+j];
+					}
+					cur->P[m2v(i,k)] += sum;
+				}
+			}
+		}
+	}
+
+	// Smoothed solution
+	memcpy(solution->x,cur->x,sizeof(double)*cur->nunk);
+	memcpy(solution->correlations,cur->P,sizeof(double)*cur->nunkvector);
+	// Formal Error Calculation (from the smoothed covariance)
+	solution->dop = 0;
+	for (i=0;i<3;i++) {
+		solution->dop += cur->P[m2v(cur->par2unk[DR_UNK]+i,cur->par2unk[DR_UNK]+i)];
+	}
+	solution->dop = sqrt(solution->dop);
+	solution->GDOP = cur->GDOP;
+	solution->PDOP = cur->PDOP;
+	solution->TDOP = cur->TDOP;
+	solution->HDOP = cur->HDOP;
+	solution->VDOP = cur->VDOP;
+	solution->HPL = cur->HPL;
+	solution->VPL = cur->VPL;
+	unkinfo->nunk = cur->nunk;
+	unkinfo->nunkvector = cur->nunkvector;
+	memcpy(unkinfo->par2unk,cur->par2unk,sizeof(int)*MAX_PAR);
+
+	// Receiver data of the epoch
+	memcpy(&epoch->t,&cur->t,sizeof(TTime));
+	memcpy(epoch->receiver.aproxPosition,cur->aproxPosition,sizeof(double)*3);
+	memcpy(epoch->receiver.aproxPositionRover,cur->aproxPositionRover,sizeof(double)*3);
+	memcpy(epoch->receiver.aproxPositionRef,cur->aproxPositionRef,sizeof(double)*3);
+	memcpy(epoch->receiver.orientation,cur->orientation,sizeof(double)*9);
+	memcpy(epoch->receiver.orientationRover,cur->orientationRover,sizeof(double)*9);
+	memcpy(epoch->receiver.orientationRef,cur->orientationRef,sizeof(double)*9);
+	epoch->ZTD = cur->ZTD;
+	epoch->receiver.RefPositionAvail = cur->RefPositionAvail;
+	epoch->numSatSolutionFilter = cur->numSatSolutionFilter;
+
+	printFilter(&epoch->t, cur->nunk, solution, options);
+	return 1;
+}
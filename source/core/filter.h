@@ -229,6 +229,7 @@
 /* System modules */
 #include <stdio.h>
 #include <string.h>
+#include <stddef.h>
 
 /* External classes */
 #include "dataHandling.h"
@@ -244,6 +245,8 @@ int cholinv_opt (double *mat, int n);
 void mxv (double *mat, double *vec, int n);
 
 // Filtering
+int getPrefitValue (TEpoch *epoch, int satIndex, enum MeasurementType meas, TOptions *options, double *prefit);
+int getPrefitsAvailableSatellites (TEpoch *epoch, enum MeasurementType meas, TOptions *options, double *prefits, int *List2EpochPos);
 void StepDetector (TEpoch *epoch, TOptions *options);
 void PrefitOutlierDetectorAbsolute (TEpoch *epoch, TOptions *options);
 void PrefitOutlierDetectorMedian (TEpoch *epoch, TOptions *options);
@@ -251,13 +254,13 @@ void fillUsableSatellites (TEpoch *epoch, TOptions *options);
 int isEpochComputable (TEpoch *epoch);
 int calculateUnknowns (int obs, TOptions *options);
 void initUnkinfo (TEpoch *epoch, TUnkinfo *unkinfo, int nunk, int observations, double t, TOptions *options);
-void prepareCorrelation (TEpoch *epoch,TFilterSolution *solution,int *PRNlist, TUnkinfo *unkinfo, TUnkinfo *prevUnkinfo, TOptions *options);
+void prepareCorrelation (TEpoch *epoch,TFilterSolution *solution,int *PRNlist, TUnkinfo *unkinfo, TUnkinfo *prevUnkinfo, int *prevUnk, TOptions *options);
 void atwa_atwy_insertline (double *atwa, double *atwy, double *unk, double prefit, int nunk, double sigma2);
 void atwa_atwy_insertLineWithCorrelation (double *atwa, double *atwy, double *corr, double apriorivalue, int nunk, double multiplier, int iniunk);
 void designSystem (TEpoch *epoch, double *atwa, double *atwy, TUnkinfo *unkinfo, enum MeasurementType measType, int filterInd, double **G, double *prefits, double *weights, TOptions *options);
 void designSystemIniValues (TEpoch *epoch, double *atwa, double *atwy, TUnkinfo *unkinfo, TFilterSolution *solution);
 double calculatePostfits (TEpoch *epoch, double *solution, TUnkinfo *unkinfo, enum MeasurementType measType, int filterInd, TOptions *options);
-int computeSolution (TEpoch *epoch,double *stddev2postfit, TFilterSolution *solution, double *newcorrelations, double *newparameterValues, TUnkinfo *unkinfo, TStdESA *StdESA, TOptions *options);
+int computeSolution (TEpoch *epoch,double *stddev2postfit, TFilterSolution *solution, double *newcorrelations, double *newparameterValues, TUnkinfo *unkinfo, TFilterWorkspace *workspace, TStdESA *StdESA, TOptions *options);
 int calculateDOP (TEpoch *epoch, TFilterSolution *solution, char *errorstr, TOptions *options);
 void StanfordESAComputationRecursive (TEpoch *epoch, char *epochString, int *k, int *kmask, int numsat, int depth, double **G, double *prefits, double *weights, TUnkinfo *unkinfo, TStdESA *StdESA, TOptions  *options);
 void DGNSSSummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolution *solution, TOptions *options, TUnkinfo *unkinfo);
@@ -265,6 +268,20 @@ void SBASSummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolution
 void SummaryDataUpdate (int UseReferenceFile, TEpoch *epoch, TFilterSolution *solution, TOptions *options, TUnkinfo *unkinfo);
 int calculateSBASAvailability (FILE *fdDiscont, FILE *fdDiscontHour, int LatPos, int LonPos, double latitude, double longitude, TEpoch *epoch, TSBASPlots *SBASplots, TOptions *options);
 void updatePRNlist (TEpoch *epoch, int *PRNlist, TFilterSolution *solution);
-int Kalman (TEpoch *epoch, TFilterSolution *solution, int *PRNlist, TUnkinfo *prevUnkinfo, TStdESA *StdESA, TOptions *options);
+int Kalman (TEpoch *epoch, TFilterSolution *solution, int *PRNlist, TUnkinfo *prevUnkinfo, TStdESA *StdESA, TSmoother *smoother, TFilterWorkspace *workspace, TOptions *options);
+
+// Scratch memory of the filter
+void initFilterWorkspace (TFilterWorkspace *workspace);
+void reserveFilterWorkspace (TFilterWorkspace *workspace, int nunk, int nunkvector, int numSatellites);
+void freeFilterWorkspace (TFilterWorkspace *workspace);
+
+// Forward-backward smoother
+void initSmoother (TSmoother *smoother);
+void freeSmoother (TSmoother *smoother);
+void writeSmootherLog (TSmoother *smoother, void *data, size_t len, TOptions *options);
+void readSmootherLog (TSmoother *smoother, size_t pos, void *data, size_t len, TOptions *options);
+void saveSmootherEpoch (TEpoch *epoch, TSmoother *smoother, TFilterSolution *solution, double *covariance, TUnkinfo *unkinfo, TUnkinfo *prevUnkinfo, TOptions *options);
+void readSmootherEpoch (TSmoother *smoother, int index, TSmootherEpoch *sepoch, TOptions *options);
+int getSmoothedEpoch (TEpoch *epoch, TSmoother *smoother, TFilterSolution *solution, TUnkinfo *unkinfo, TOptions *options);
 
 #endif /*FILTER_H_*/
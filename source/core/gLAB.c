@@ -766,6 +766,9 @@ int printProgressConvert=0;	//For file conversion mode only
 							// 0 => Do not print current epoch being processed to terminal (auto disables if stdout is not a terminal)
 							// 1 => Print current epoch being processed to terminal
 
+//Global pointer to the options, so errors found while reading compressed input files (which are read through a FILE stream) can be printed with printError
+TOptions	*inputFileOptions=NULL;
+
 int	ReadL1CAsItself=0; //Variable to enable/disable L1C to be read as itself or as L1P (to be erased when measurement management is finished)
 
 #if !defined (__WIN32__)
@@ -905,6 +908,7 @@ typedef struct {
 	char						recFile[MAX_INPUT_LINE];
 	char						snxFile[MAX_INPUT_LINE];
 	char						sbasFile[MAX_INPUT_LINE];
+	char						sbasIndexFile[MAX_INPUT_LINE];
 	char						sbasAvailplotsFile[MAX_INPUT_LINE+50];
 	char						sbasAvailplotsFileNoExtension[MAX_INPUT_LINE+50];
 	char						sbasRiskplotsFile[MAX_INPUT_LINE+50];
@@ -932,6 +936,7 @@ typedef struct {
 	char						rtcm3File[MAX_INPUT_LINE];
 	char						stanfordESAFile[MAX_INPUT_LINE+50];
 	char						stanfordESALOIFile[MAX_INPUT_LINE+50];
+	char						perfTraceFile[MAX_INPUT_LINE];
 	char						SBASIONOFile[MAX_INPUT_LINE];
 	char						sigmamultipathFile[MAX_INPUT_LINE];
 	char						addederrorFile[MAX_INPUT_LINE];
@@ -1027,6 +1032,7 @@ void initSupportOptions (TSupportOptions *sopt) {
 	sopt->inxFile[0] = '\0';
 	sopt->GalFile[0] = '\0';
 	sopt->sbasFile[0] = '\0';
+	sopt->sbasIndexFile[0] = '\0';
 	sopt->sbasAvailplotsFile[0] = '\0';
 	sopt->sbasAvailplotsFileNoExtension[0] = '\0';
 	sopt->sbasRiskplotsFile[0] = '\0';
@@ -1054,6 +1060,7 @@ void initSupportOptions (TSupportOptions *sopt) {
 	sopt->rtcm3File[0] = '\0';
 	sopt->stanfordESAFile[0] = '\0';
 	sopt->stanfordESALOIFile[0] = '\0';
+	sopt->perfTraceFile[0] = '\0';
 	sopt->SBASIONOFile[0]='\0';
 	sopt->sigmamultipathFile[0]='\0';
 	sopt->addederrorFile[0]='\0';
@@ -1139,11 +1146,19 @@ void showHelp () {
 	printf("    -rtcmv2conversioninfo   Shows detailed information of the text files generated from a RTCM v2.x conversion\n\n");
 	printf("    -referenceposfile       Shows an example of reference position file\n\n");
 	printf("    -sbasplotsinfo          Shows detailed info on how to generate SBAS maps\n");
-	#if defined _OPENMP
-		printf("\n    -numthreads <num>     Sets the number of parallel threads to be used in the processing (multithread is only\n");
-		printf("                             used in the cycle-slip detection and modelling sections). Multi-thread is only\n");
-		printf("                             available if gLAB is compiled with '-fopenmp' flag (OpenMP threads)\n"); 
-	#endif
+	printf("\n    -threads <num>        Sets the number of parallel threads to be used in the processing (multithread is only\n");
+	printf("                             used in the cycle-slip detection, modelling, SBAS decoding, SBAS maps and products\n");
+	printf("                             sections). With 1 thread the processing is serial, and with 0 all the CPU cores are used.\n");
+	printf("                             Epochs with less than %d satellites are always modelled by a single thread.\n",MIN_SATELLITES_PARALLEL);
+	printf("                             More than one thread is only available if gLAB is compiled with '-fopenmp' flag\n");
+	printf("                             (OpenMP threads). '-numthreads' is also accepted [default 1]\n\n");
+	printf("    -threads:bind <val>   Sets the placement of the threads in the CPUs (only in Linux) [default none]\n");
+	printf("                             <val> = none     The operating system places the threads (the OpenMP variables\n");
+	printf("                                                OMP_PROC_BIND and OMP_PLACES are used if they are set)\n");
+	printf("                             <val> = close    Each thread is pinned to a CPU, using all the CPUs of a NUMA node\n");
+	printf("                                                before the next node. Suited for few threads sharing data\n");
+	printf("                             <val> = spread   Each thread is pinned to a CPU, alternating the NUMA nodes.\n");
+	printf("                                                Suited for many threads using all the memory bandwidth\n");
 	printf("\n  INPUT OPTIONS\n\n");
 	printf("    -input:cfg <file>       Sets the input configuration file\n\n");
 	printf("    -input:obs <file>       Sets the input RINEX observation file\n\n");
@@ -1167,6 +1182,19 @@ void showHelp () {
 	printf("    -input:rec <file>       Sets the input GPS receiver types file (default GPS_Receiver_Types) for DCB usage\n\n");
 	printf("    -input:snx <file>       Sets the input SINEX file for receiver position\n\n");
 	printf("    -input:sbas <file>      Sets the SBAS data file (RINEX-B v2.11 or EMS). Activates SBAS processing mode\n\n");
+	printf("    -input:sbasindex <file> Sets the file where the time index of the SBAS data file is saved. If the file exists and matches the\n");
+	printf("                             SBAS data file, the index is read from it instead of reading all the SBAS data file (see '-model:sbasseektime')\n\n");
+	printf("    -input:follow           Reads the input files while they are being written (e.g. by a receiver logger). The observation\n");
+	printf("                             file is read epoch by epoch when each epoch is complete, the SBAS file is read up to the current\n");
+	printf("                             epoch, and the navigation, SP3 and clock files are read again when they are updated. The file\n");
+	printf("                             changes are detected with inotify in Linux, and by polling the file in other systems.\n");
+	printf("                             It cannot be used with compressed files, DGNSS, RTCM files or backward filtering [default disabled]\n\n");
+	printf("    --input:follow          Reads the input files only once (the whole file must be available) [default]\n\n");
+	printf("    -input:follow:latency <val> Sets the latency budget in seconds in follow mode. It is the maximum time to wait for the\n");
+	printf("                             SBAS messages of an epoch once its observations are available. If an epoch is output later\n");
+	printf("                             than this budget, a warning is printed [default %.1f]\n\n",FOLLOWLATENCY);
+	printf("    -input:follow:timeout <val> Sets the time in seconds without new observations after which the processing ends in\n");
+	printf("                             follow mode. With 0 gLAB waits forever [default 0]\n\n");
 	printf("    -input:dgnss <file>     Sets the input RINEX observation file of the Reference Station for DGNSS\n\n");
 	printf("    -input:rtcm <file>      Sets the input RTCM binary file, gLAB will automatically detect the RTCM version\n\n");
 	printf("    -input:rtcm2 <file>     Sets the input RTCM v2.x binary file\n\n");
@@ -1179,6 +1207,10 @@ void showHelp () {
 	printf("    -input:usererror <file> Sets the data file for adding user defined error signal to raw measurements (execute 'gLAB -usererrorfile' for details)\n\n");
 	printf("    -input:refpos    <file> Sets the reference position file. It can be a SP3 or a columnar text file (execute 'gLAB -referencefile' for details)\n");
 	printf("                             This option will set receiver positioning mode to 'calculate' if non set. See '-pre:setrecpos' option below for details\n\n");
+	printf("    -input:prodcache <dir>  Sets the directory for the parsed products cache. SP3 and RINEX navigation files are stored\n");
+	printf("                             there in binary form the first time they are read, and later runs with the same file load\n");
+	printf("                             the binary copy instead of parsing the text file. A directory in memory (e.g. /dev/shm/gLAB)\n");
+	printf("                             allows to share the parsed products between several gLAB processes. Disabled by default\n\n");
 	printf("    The use of '-input:nav' file will preconfigure the parameters to work in the Standard Point Positioning (SPP).\n\n");
 	printf("    The use of '-input:sp3'/'-input:orb'/'-input:clk' will preconfigure the parameters to work in the Precise Point\n");
 	printf("      Positioning (PPP) approach. All the values can be overridden by specifying the parameters. See below for more details\n");
@@ -1515,6 +1547,13 @@ void showHelp () {
 	printf("                              If this timer is set too low (few seconds), it may happen that we switch to a GEO with not enough data (due to\n");
 	printf("                              we are in initialization or the GEO has received an alarm message\n");
 	printf("                              gLAB will not switch to any GEO before this time, except for when an alarm message is received and there is no other GEO available\n\n"); 
+	printf("    -model:sbasseektime #   Set the minimum time (in seconds) of SBAS messages decoded before the first epoch to be processed [default %d]\n",SBASSEEKTIME);
+	printf("                              Older messages are skipped using a time index of the SBAS data file, so the processing of a few hours of a\n");
+	printf("                              long SBAS data file does not require decoding all its messages. The index keeps the last messages of each\n");
+	printf("                              message type and GEO (and of each IODP, IODI or IODS, band or satellite), so older messages still needed\n");
+	printf("                              (for example, a MT12 or MT17 received hours before) are also decoded and the SBAS corrections are the same\n");
+	printf("                              as when decoding all messages. This time will never be lower than the GEO acquisition time or the MT6 and\n");
+	printf("                              MT25 time outs. A value of 0 will make gLAB decode all messages from the beginning of the file\n\n");
 	printf("    -model:switchtime #     Set the minimum time (in seconds) between a GEO or mode switch and the following one [default 0]\n");
 	printf("                              If this timer is set to zero, a maximum of %d switches per epoch (for both mode and GEO) will be done\n\n",MAXSWITCHPEREPOCH);
 	printf("    -model:sbastmout    <n> <val> Set time out value for SBAS messages (except for fast and range rate corrections) in both modes, PA and NPA\n");
@@ -1764,6 +1803,10 @@ void showHelp () {
 	printf("                            process the data backwards. The \"turn point\" is defined as the latest point where orbits and clocks\n");
 	printf("                            are available or when the observation RINEX ends (whatever is first) ('--filter:backward' to disable it)\n");
 	printf("                            [default disabled]\n\n");
+	printf("    -filter:smoother        Specify that the filter does a forward-backward smoothing after the forward processing is finished.\n");
+	printf("                            The backward pass combines the states saved in the forward one (Rauch-Tung-Striebel smoother), without\n");
+	printf("                            reading or modelling the data again. The \"turn point\" is the same as in '-filter:backward'\n");
+	printf("                            ('--filter:smoother' to disable it) [default disabled]\n\n");
 	printf("    -filter:maxhdop <val>   Set the HDOP threshold which will make gLAB do the following when the threshold is exceeded:\n");
 	printf("                              In SPP/PPP:   Skip the epoch [default disabled]\n");
 	printf("                              In SBAS:	It will try to switch mode or GEO (if allowed), otherwise it will skip the epoch\n");
@@ -1852,6 +1895,8 @@ void showHelp () {
 	printf("    -output:stfdesaloi <file> Set the filename where to write the geometries of Stanford-ESA whose integrity ratio are over the horizontal or vertical\n");
 	printf("                                integrity ratio (any of them). [default \"observationfilename_stdESA_LOI.txt\"]\n");
 	printf("                                This option sets enables the following parameter automatically: '-filter:stfdesaloi'.\n\n");
+	printf("    -output:perftrace <file> Set the filename where to write the time spent in each processing stage in Chrome trace\n");
+	printf("                                event format (JSON), which can be opened with 'chrome://tracing' or Perfetto [default disabled]\n\n");
 	printf("    -onlyconvert            Convert EMS or RINEX-B file to RINEX-B, EMS or Pegasus and exit without processing any GNSS data [default off]\n\n");
 	printf("    Incorrect messages from RINEX-B or EMS files are messages which grant any of these conditions:\n");
 	printf("      CRC mismatch, invalid header, unknown message type, invalid time of applicability (time is over 86400 seconds)\n\n");
@@ -1892,6 +1937,8 @@ void showHelp () {
 	printf("    -print:dgnssunused      Print messages from discarded satellites due to DOP switch (from DGNSS to SPP) [default off]\n");
 	printf("                                  An asterisk '*' will be added at the end of the first field to indicate that it is a discarded measurement\n\n");
 	printf("    -print:summary          Print a summary at the end of the files with the statistics of the processing [default on]\n\n");
+	printf("    -print:perf             Print the time spent in each processing stage for every epoch (PERF messages) and for all\n");
+	printf("                              the processing (PERFTOT messages). It is not enabled by '-print:all' [default off]\n\n");
 	printf("    -print:progress         Print to terminal the current epoch being processed [default on]\n\n");
 	printf("    -print:progressalways   Print to terminal the current epoch being processed even if standard output is piped [default off]\n\n");
 	printf("    -print:all              Print all messages\n\n");
@@ -1902,6 +1949,17 @@ void showHelp () {
 	printf("        at the end of the output file. If receiver position is not fixed, error percentiles messages will not be shown\n");
 	printf("        The options for generating this summary are:\n\n");
 	printf("    -summary:percentile  <val>  Sets the value for computing the error percentile [default 95]\n\n"); 
+	printf("    -summary:sketch            Compute the summary percentiles from a logarithmic histogram instead of keeping all the samples.\n");
+	printf("                                     Memory usage does not grow with the number of epochs, and percentiles have a relative\n");
+	printf("                                     error below %g%%. Maximum values are always exact [default off]\n",SUMMARY_SKETCH_ACCURACY*100.);
+	printf("                                    This option can be disabled with '--summary:sketch'\n\n");
+	printf("    -summary:save <file>       Save the summary data (epoch counters, maximum values and the samples for the percentiles) to a binary\n");
+	printf("                                     file, so it can be combined later with the summaries of other days or stations with\n");
+	printf("                                     '-summary:merge'. The summaries merged in this run are included in the file. Only available in\n");
+	printf("                                     SPP and PPP modes\n\n");
+	printf("    -summary:merge <file>      Add the summary saved with '-summary:save' in <file> to the summary of this run. This option can be\n");
+	printf("                                     repeated for merging several files. Summaries saved with '-summary:sketch' can only be\n");
+	printf("                                     merged if '-summary:sketch' is also set. Only available in SPP and PPP modes\n\n");
 	printf("    -summary:waitfordaystart   If the observation file starts at %d hours or later, gLAB will assume that from the first epoch\n",HOURSPREVDAYCONVERGENCE);
 	printf("                                     until epoch 23 hours 59 minutes 59 seconds are given just to fill the messages buffer and wait for\n");
 	printf("                                     the smoothing and filter to converge, and the following epochs from the next day are the ones of interest.\n");
@@ -3357,6 +3415,37 @@ void showMessages () {
 	printf("        Field 13:     Satellite clock offset [m]\n");
 	printf("        Sample:\n");
 	printf("            SATPVT 2006 199 79500.00 GPS  1  15340446.1662 -20066066.3778  -7929249.6479      1191.6479      2132.5615     -3023.0448     19826.4736\n\n");
+	printf("    PERF\n");
+	printf("        Field 1:      'PERF'\n");
+	printf("        Field 2:      Year\n");
+	printf("        Field 3:      Day of year\n");
+	printf("        Field 4:      Seconds of day\n");
+	printf("        Field 5:      Total time spent in the epoch [ms]\n");
+	printf("        Field 6:      Time reading the observation file [ms]\n");
+	printf("        Field 7:      Time reading the SBAS file [ms]\n");
+	printf("        Field 8:      Time in preprocessing, including cycle-slip detection [ms]\n");
+	printf("        Field 9:      Time in cycle-slip detection [ms]\n");
+	printf("        Field 10:     Time in modelling [ms]\n");
+	printf("        Field 11:     Time computing satellite orbits and clocks [ms]\n");
+	printf("        Field 12:     Time computing the ionospheric model [ms]\n");
+	printf("        Field 13:     Time computing the tropospheric model [ms]\n");
+	printf("        Field 14:     Time computing the antenna phase center corrections [ms]\n");
+	printf("        Field 15:     Time in the filter [ms]\n");
+	printf("        Field 16:     Time in the Cholesky decompositions of the filter [ms]\n");
+	printf("        Field 17:     Time printing the OUTPUT messages and writing KML files [ms]\n");
+	printf("        Note:         Fields 9, 11, 12, 13, 14 and 16 are already included in fields 8, 10 and 15. Fields 11 to 14 are\n");
+	printf("                      the sum of the times of all satellites, so with multithread they can be higher than field 10\n");
+	printf("        Sample:\n");
+	printf("            PERF 2010 077 75630.00     0.507     0.016     0.358     0.010     0.007     0.088     0.009     0.000     0.003     0.001     0.018     0.000     0.000\n\n");
+	printf("    PERFTOT\n");
+	printf("        Field 1:      'PERFTOT'\n");
+	printf("        Field 2:      Processing stage ('Total' for the whole processing. The rest of stages are the same as in PERF message)\n");
+	printf("        Field 3:      Number of times the stage has been run (number of epochs with PERF messages for 'Total')\n");
+	printf("        Field 4:      Total time spent in the stage [s]\n");
+	printf("        Field 5:      Mean time per epoch [ms]\n");
+	printf("        Field 6:      Percentage of the processing time\n");
+	printf("        Sample:\n");
+	printf("            PERFTOT Filter              241     0.006327     0.0263   1.92\n\n");
 }
 
 /*****************************************************************************
@@ -4717,6 +4806,11 @@ int parseOption (TSupportOptions *sopt, TOptions *options, char *argv[]) {
 		options->stanfordesa=1;
 		options->stanfordesaLOI=1;
 		return 2;
+	} else if (strcasecmp(argv[0],"-output:perftrace")==0) {
+		if (argv[1]==NULL) return -3;
+		if(strlen(argv[1])>MAX_INPUT_LINE-1) return -4;
+		strcpy(sopt->perfTraceFile,argv[1]);
+		return 2;
 	} else if (strcasecmp(argv[0],"-input:cfg")==0) {
 		if (argv[1]==NULL) return -3;
 		if(strlen(argv[1])>MAX_INPUT_LINE-1) return -4;
@@ -4899,6 +4993,31 @@ int parseOption (TSupportOptions *sopt, TOptions *options, char *argv[]) {
 		strcpy(sopt->sbasFile,argv[1]);
 		options->SBAScorrections=1;
 		return 2;
+	} else if (strcasecmp(argv[0],"-input:sbasindex")==0) {
+		if (argv[1]==NULL) return -3;
+		if(strlen(argv[1])>MAX_INPUT_LINE-1) return -4;
+		strcpy(sopt->sbasIndexFile,argv[1]);
+		return 2;
+	} else if (strcasecmp(argv[0],"-input:follow")==0) {
+		options->followMode=1;
+		return 1;
+	} else if (strcasecmp(argv[0],"--input:follow")==0) {
+		options->followMode=0;
+		return 1;
+	} else if (strcasecmp(argv[0],"-input:follow:latency")==0) {
+		if (argv[1]==NULL) return -3;
+		options->followLatency=atof(argv[1]);
+		if (options->followLatency<=0.) {
+			return -2;
+		}
+		return 2;
+	} else if (strcasecmp(argv[0],"-input:follow:timeout")==0) {
+		if (argv[1]==NULL) return -3;
+		options->followTimeout=atof(argv[1]);
+		if (options->followTimeout<0.) {
+			return -2;
+		}
+		return 2;
 	} else if (strcasecmp(argv[0],"-input:sigmpath")==0) {
 		if (argv[1]==NULL) return -3;
 		if(strlen(argv[1])>MAX_INPUT_LINE-1) return -4;
@@ -4922,6 +5041,11 @@ int parseOption (TSupportOptions *sopt, TOptions *options, char *argv[]) {
 		}
 		options->recPosProvided=1;
 		return 2;
+	} else if (strcasecmp(argv[0],"-input:prodcache")==0) {
+		if (argv[1]==NULL) return -3;
+		if(strlen(argv[1])>MAX_INPUT_LINE-1) return -4;
+		strcpy(options->productsCacheDir,argv[1]);
+		return 2;
 	} else if (strcasecmp(argv[0],"-pre:usererrorafter")==0) {
 		options->useraddednoisepreprocess=1;
 		return 1;
@@ -6272,6 +6396,12 @@ int parseOption (TSupportOptions *sopt, TOptions *options, char *argv[]) {
 		if(aux1<0) return -2;
 		options->adquisitiontime = aux1;
 		return 2;
+	} else if (strcasecmp(argv[0],"-model:sbasseektime")==0) {
+		if (argv[1]==NULL) return -3;
+		aux1 = atoi(argv[1]);
+		if(aux1<0) return -2;
+		options->SBASseektime = aux1;
+		return 2;
 	} else if (strcasecmp(argv[0],"-model:switchtime")==0) {
 		if (argv[1]==NULL) return -3;
 		aux1 = atoi(argv[1]);
@@ -7530,9 +7660,19 @@ int parseOption (TSupportOptions *sopt, TOptions *options, char *argv[]) {
 		return 2;
 	} else if (strcasecmp(argv[0],"-filter:backward")==0) {
 		options->filterIterations = 2;
+		options->smoother = 0;
 		return 1;
 	} else if (strcasecmp(argv[0],"--filter:backward")==0) {
 		options->filterIterations = 1;
+		options->smoother = 0;
+		return 1;
+	} else if (strcasecmp(argv[0],"-filter:smoother")==0) {
+		options->filterIterations = 2;
+		options->smoother = 1;
+		return 1;
+	} else if (strcasecmp(argv[0],"--filter:smoother")==0) {
+		options->filterIterations = 1;
+		options->smoother = 0;
 		return 1;
 	} else if (strcasecmp(argv[0],"-filter:stfdesa")==0) {
 		options->stanfordesa = 1;
@@ -7930,6 +8070,33 @@ int parseOption (TSupportOptions *sopt, TOptions *options, char *argv[]) {
 		auxd = atof(argv[1]);
 		options->percentile = auxd;
 		return 2;
+	} else if (strcasecmp(argv[0],"-sbassummary:sketch")==0 || strcasecmp(argv[0],"-summary:sketch")==0) {
+		options->summarySketch = 1;
+		return 1;
+	} else if (strcasecmp(argv[0],"--sbassummary:sketch")==0 || strcasecmp(argv[0],"--summary:sketch")==0) {
+		options->summarySketch = 0;
+		return 1;
+	} else if (strcasecmp(argv[0],"-summary:save")==0) {
+		if (argv[1]==NULL) return -3;
+		if(strlen(argv[1])>MAX_INPUT_LINE-1) return -4;
+		strcpy(options->summarySaveFile,argv[1]);
+		return 2;
+	} else if (strcasecmp(argv[0],"--summary:save")==0) {
+		options->summarySaveFile[0]='\0';
+		return 1;
+	} else if (strcasecmp(argv[0],"-summary:merge")==0) {
+		if (argv[1]==NULL) return -3;
+		if(strlen(argv[1])>MAX_INPUT_LINE-1) return -4;
+		//Check if file already exist (this function is called several times, so
+		//we need to avoid merging the same file multiple times)
+		for(i=0;i<options->numSummaryMergeFiles;i++) {
+			if (strcmp(options->summaryMergeFiles[i],argv[1])==0) return 2;
+		}
+		options->summaryMergeFiles=realloc(options->summaryMergeFiles,sizeof(char*)*(options->numSummaryMergeFiles+1));
+		options->summaryMergeFiles[options->numSummaryMergeFiles]=malloc(sizeof(char)*(strlen(argv[1])+1));
+		strcpy(options->summaryMergeFiles[options->numSummaryMergeFiles],argv[1]);
+		options->numSummaryMergeFiles++;
+		return 2;
 	} else if (strcasecmp(argv[0],"-sbassummary:windowsize")==0||strcasecmp(argv[0],"-summary:windowsize")==0) {
 		if (argv[1]==NULL) return -3;
 		aux1 = atoi(argv[1]);
@@ -8323,6 +8490,12 @@ int parseOption (TSupportOptions *sopt, TOptions *options, char *argv[]) {
 	} else if (strcasecmp(argv[0],"--print:summary")==0) {
 		options->printSummary=0;
 		return 1;
+	} else if (strcasecmp(argv[0],"-print:perf")==0) {
+		options->printPerf=1;
+		return 1;
+	} else if (strcasecmp(argv[0],"--print:perf")==0) {
+		options->printPerf=0;
+		return 1;
 	} else if (strcasecmp(argv[0],"-print:progress")==0) {
 		printProgress=1;
 		sopt->UserSetPrintProgress=1;
@@ -8399,25 +8572,44 @@ int parseOption (TSupportOptions *sopt, TOptions *options, char *argv[]) {
 		options->printUserError = 0;
 		options->printDGNSS = 0;
 		options->printSummary = 0;
+		options->printPerf = 0;
 		return 1;
-	} else if (strcasecmp(argv[0],"-numthreads")==0) {
+	} else if (strcasecmp(argv[0],"-threads")==0||strcasecmp(argv[0],"-numthreads")==0) {
+		//The number of threads is applied after reading all the options
+		if (argv[1]==NULL) return -3;
+		aux1=atoi(argv[1]);
+		if (aux1<0 ) {
+			return -2;
+		}
 		#if defined _OPENMP
-			if (argv[1]==NULL) return -3;
-			omp_set_dynamic(0);     // Explicitly disable dynamic teams
-			aux1=atoi(argv[1]);
-			if (aux1<=0 ) {
-				return -2;
+			if (aux1==0) {
+				//Use all the CPU cores
+				aux1=omp_get_num_procs();
 			} else if (aux1>omp_get_num_procs()) {
 				printf("ERROR Maximum number of threads is the number of CPU cores (%d)\n",omp_get_num_procs());
 				exit(-1); 
 			}
-			omp_set_num_threads(aux1);
-			options->numthreads=aux1;
-			return 2;
 		#else
-			printf("ERROR Option '-numthreads' is only available when gLAB is compiled with OpenMP multithread\n");
-			exit(-1);
+			if (aux1>1) {
+				printf("ERROR More than one thread is only available when gLAB is compiled with OpenMP multithread\n");
+				exit(-1);
+			}
+			aux1=1;
 		#endif
+		options->numthreads=aux1;
+		return 2;
+	} else if (strcasecmp(argv[0],"-threads:bind")==0) {
+		if (argv[1]==NULL) return -3;
+		if (strcasecmp(argv[1],"none")==0) {
+			options->threadBind=tbNONE;
+		} else if (strcasecmp(argv[1],"close")==0) {
+			options->threadBind=tbCLOSE;
+		} else if (strcasecmp(argv[1],"spread")==0) {
+			options->threadBind=tbSPREAD;
+		} else {
+			return -2;
+		}
+		return 2;
 	}
 
 	return -1;
@@ -8819,6 +9011,9 @@ int processOptions (TSupportOptions *sopt, TOptions *options) {
 		if(options->percentile<=0. || options->percentile>100. ) {
 			printError("Percentile for summary must be greater than 0 and smaller or equal than 100",options);
 		}
+		if ((options->summarySaveFile[0]!='\0' || options->numSummaryMergeFiles>0) && ((options->SBAScorrections == 1 && options->onlySBASiono == 0) || options->DGNSS == 1)) {
+			printError("Summaries can only be saved or merged in SPP and PPP modes",options);
+		}
 		if (options->SBAScorrections == 1 && options->onlySBASiono == 0 ) {
 			//Check that Alarm limits given are valid
 			if(options->HorAlarmLimit<=0.) {
@@ -9129,6 +9324,9 @@ int processOptions (TSupportOptions *sopt, TOptions *options) {
 	}
 	
 	// Sanity check
+	if ( options->followMode == 1 && sopt->obsFile[0] == '\0' ) {
+		printError("Follow mode ('-input:follow') requires an observation file",options);
+	}
 	if ( sopt->obsFile[0] != '\0' ) {
 		options->workMode = wmDOPROCESSING;
 		if ( broadcastProductsAvailable && sopt->navMode == NMND ) sopt->navMode = NMstandalone;
@@ -9148,6 +9346,9 @@ int processOptions (TSupportOptions *sopt, TOptions *options) {
 		} else if (!broadcastProductsAvailable && !preciseProductsAvailable) {
 			if (sopt->addederrorFile[0]!='\0' && options->DGNSS==0 && options->SBAScorrections==0 ) {
 				options->workMode = wmUSERERROR2RINEX;
+				if ( options->followMode == 1 ) {
+					printError("Follow mode ('-input:follow') cannot be used when adding user error to a RINEX file",options);
+				}
 				if (sopt->rnxFile[0]=='\0') {
 					//If no output file is given, observation rinex filename will be used with suffix "_usererror"
 					sprintf(sopt->rnxFile,"%s_usererror",sopt->obsFile);
@@ -9172,6 +9373,15 @@ int processOptions (TSupportOptions *sopt, TOptions *options) {
 				printError("DGNSS mode activated, but no navigation file available",options);
 			}
 		}
+		if ( options->followMode == 1 ) {
+			if ( options->DGNSS == 1 || sopt->rtcmFile[0] != '\0' || sopt->rtcm2File[0] != '\0' || sopt->rtcm3File[0] != '\0' ) {
+				printError("Follow mode ('-input:follow') cannot be used with DGNSS or RTCM input files",options);
+			} else if ( options->filterIterations == 2 ) {
+				printError("Follow mode ('-input:follow') cannot be used with backward filtering",options);
+			}
+			//The progress line would be mixed with the output of each epoch
+			printProgress=0;
+		}
 		if ( options->printMeas == -1 ) options->printMeas = 0;
 	} else if ( nProd == 2 ) {
 		options->workMode = wmCOMPAREORBITS;
@@ -11149,6 +11359,146 @@ int checkConfigFile (TSupportOptions *sopt, TOptions *options) {
 	return 0;
 }
 
+/*****************************************************************************
+ * Name        : compareSatelliteOrbits
+ * Description : Compute the orbit and clock differences of one satellite at one
+ *               epoch between two products. It does not print anything, so it can be
+ *               called in parallel for different satellites
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TGNSSproducts  **products       I  N/A  Products to be compared
+ * TTime  *t                       I  N/A  Epoch of the comparison
+ * enum GNSSystem  GNSS            I  N/A  GNSS system of the satellite
+ * int  PRN                        I  N/A  PRN of the satellite
+ * double  *sunPos                 I  m    Sun position at epoch t (only used for eclipse check)
+ * int  bothSP3                    I  N/A  1 => Both products are SP3
+ * TConstellation  *constellation  I  N/A  Constellation information on the products
+ * TSatInfo  *satInfo              IO N/A  Eclipse information of the satellite
+ * TOptions  *optionsProd          I  N/A  Vector with the TOptions structure for each product
+ * TSatDiffSample  *sample         O  N/A  Differences computed
+ *****************************************************************************/
+void compareSatelliteOrbits (TGNSSproducts **products, TTime *t, enum GNSSystem GNSS, int PRN, double *sunPos, int bothSP3, TConstellation *constellation, TSatInfo *satInfo, TOptions *optionsProd, TSatDiffSample *sample) {
+	double			orientation[2][3][3];
+	double			orientationACR[3][3];
+	double			position[2][3];
+	double			velocity[2][3];
+	double			ITRFvelocity[2][3];
+	double			clock[2];
+	double			dr[3];
+	double			auxT;
+	int				j;
+	int				ret;
+	int				SBASIOD = -1;	//SBAS not used here, so the IOD value for BRDC data is -1
+	TSatellite		sat;
+
+	sample->available = 0;
+	sample->eclipseTime = -1.;
+
+	for ( j = 0; j < 2; j++ ) {
+		// Satellite positions and velocities
+		ret = getSatellitePVT(products[j], t, 0.0, GNSS, PRN, position[j], velocity[j], ITRFvelocity[j], NULL, SBASIOD, &optionsProd[j]);
+		if ( !ret ) return;
+		// Eclipsed satellite check
+		memcpy(sat.position, position[j], 3 * sizeof(double));
+		memcpy(sat.velocity, velocity[j], 3 * sizeof(double));
+		sat.hasOrbitsAndClocks = 1;
+		if ( optionsProd[j].discardEclipsedSatellites ) {
+			if ( isEclipsed(t, &sat, satInfo, sunPos, &auxT) ) {
+				sample->eclipseTime = auxT;
+				return;
+			}
+		}
+		// Satellite clock
+		if ( optionsProd[j].satelliteClockCorrection ) {
+			ret = getSatellitePVT(products[j], t, 0.0, GNSS, PRN, NULL, NULL, NULL, &clock[j], SBASIOD, &optionsProd[j]);
+			if ( !ret ) return;
+		}
+		// Satellite orientation
+		getSatelliteOrientation(t, position[j], orientation[j]);
+		// Satellite phase center correction
+		if ( products[j]->type == SP3 && optionsProd[j].satellitePhaseCenter ) {
+			if ( !bothSP3 || j == 1 ) { // The contrary, will mean both SP3 input files, and first product
+				ret = satellitePhaseCenterCorrection3D(t, GNSS, PRN, C1C, orientation[j], constellation, dr);
+				if ( !ret ) return;
+				// Coordinate correction
+				position[j][0] += dr[0];
+				position[j][1] += dr[1];
+				position[j][2] += dr[2];
+			}
+		}
+	}
+
+	for ( j = 0; j < 3; j++ ) sample->posDiff[j] = position[1][j] - position[0][j];
+
+	memcpy(sample->posDiffXYZ,sample->posDiff,sizeof(sample->posDiff));
+	// Satellite orientation in the ACR system (along, cross, radial)
+	getSatelliteOrientationACR(position[1], velocity[1], orientationACR);
+	changeBase(orientationACR, sample->posDiff);
+
+	// Compute orbit and clock differences
+	if ( optionsProd[0].satelliteClockCorrection ) {
+		sample->ClkDiff = clock[1] - clock[0];
+		sample->SISREDiff = sqrt((sample->posDiff[2] - sample->ClkDiff) * (sample->posDiff[2] - sample->ClkDiff) + (sample->posDiff[0] * sample->posDiff[0] + sample->posDiff[1] * sample->posDiff[1]) / 49);
+	} else {
+		sample->ClkDiff = 0;
+		sample->SISREDiff = 0;
+	}
+	sample->OrbDiff = sqrt(sample->posDiff[2] * sample->posDiff[2] + (sample->posDiff[0] * sample->posDiff[0] + sample->posDiff[1] * sample->posDiff[1]) / 49);
+	sample->Orb3DDiff = sqrt(sample->posDiff[0] * sample->posDiff[0] + sample->posDiff[1] * sample->posDiff[1] + sample->posDiff[2] * sample->posDiff[2]);
+	sample->available = 1;
+}
+
+/*****************************************************************************
+ * Name        : computeSatelliteProduct
+ * Description : Compute the position, velocity and clock of one satellite at one
+ *               epoch from a product. It does not print anything, so it can be
+ *               called in parallel for different satellites
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TGNSSproducts  *products        I  N/A  Products to be shown
+ * TTime  *t                       I  N/A  Epoch to compute
+ * enum GNSSystem  GNSS            I  N/A  GNSS system of the satellite
+ * int  PRN                        I  N/A  PRN of the satellite
+ * TConstellation  *constellation  I  N/A  Constellation information on the products
+ * TOptions  *options              I  N/A  TOptions structure
+ * TSatPvtSample  *sample          O  N/A  Position, velocity and clock computed
+ *****************************************************************************/
+void computeSatelliteProduct (TGNSSproducts *products, TTime *t, enum GNSSystem GNSS, int PRN, TConstellation *constellation, TOptions *options, TSatPvtSample *sample) {
+	double			orientation[3][3];
+	double			velocity[3];
+	double			ITRFvelocity[3];
+	double			dr[3];
+	int				ret;
+	int				SBASIOD = -1;	//SBAS not used here, so the IOD value for BRDC data is -1
+
+	sample->available = 1;
+	// Satellite positions and velocities
+	ret = getSatellitePVT(products, t, 0.0, GNSS, PRN, sample->position, velocity, ITRFvelocity, NULL, SBASIOD, options);
+	if (!ret) sample->available = 0;
+	// Satellite clock
+	if ( options->satelliteClockCorrection ) {
+		ret = getSatellitePVT(products, t, 0.0, GNSS, PRN, NULL, NULL, NULL, &sample->clock, SBASIOD, options);
+	} else {
+		sample->clock=0;
+	}
+	// Satellite phase center correction
+	if ( products->type == SP3 && options->satellitePhaseCenter ) {
+		// Satellite orientation
+		getSatelliteOrientation(t, sample->position, orientation);
+		ret = satellitePhaseCenterCorrection3D(t, GNSS, PRN, C1C, orientation, constellation, dr);
+		if ( !ret ) sample->available = 0;
+		// Coordinate correction
+		sample->position[0] += dr[0];
+		sample->position[1] += dr[1];
+		sample->position[2] += dr[2];
+	}
+	if ( options->satVel == svINERTIAL ) {
+		memcpy(sample->velocity, velocity, sizeof(velocity));
+	} else {
+		memcpy(sample->velocity, ITRFvelocity, sizeof(ITRFvelocity));
+	}
+}
+
 /*****************************************************************************
  * Name        : compareOrbits
  * Description : Perform an orbit comparison between two different products
@@ -11182,26 +11532,19 @@ int checkConfigFile (TSupportOptions *sopt, TOptions *options) {
  * TOptions  *options              I  N/A  TOptions structure
  *****************************************************************************/
 void compareOrbits (TGNSSproducts **products, TGNSSproducts **pastProducts, TGNSSproducts **nextProducts, FILE **fdRNXnav, int *retRNXnav, double *rinexNavVersion, FILE **fdSP3, int *retSP3, FILE **fdSP3o, int *retSP3o, FILE **fdCLK, int *retCLK, double *OrbitsMaxDistance, double *OrbitsToTMaxDistance, double *ClocksMaxDistance, double *ClocksToTMaxDistance, TConstellation *constellation, TTime startTime, TTime endTime, TTime endTimePercentage, double numberEpochs, int startTimeFromNav, TOptions *options, TSupportOptions *sopt) {
-	double			orientation[2][3][3];
-	double			orientationACR[3][3];
 	int				i, j, k, l;
+	int				s, e;
 	TTime			t;
-	double			position[2][3];
-	double			velocity[2][3];
-	double			ITRFvelocity[2][3];
-	double			posDiff[3];
-	double			posDiffXYZ[3];
-	double			clock[2];
-	double			SISREDiff;
-	double			Orb3DDiff;
-	double			OrbDiff;
-	double			ClkDiff;
-	double			dr[3];
-	int				available;
+	TTime			tBlock[MAX_PRODUCTS_EPOCH_BLOCK];
+	int				numEpochsBlock;
+	double			sunPosBlock[MAX_PRODUCTS_EPOCH_BLOCK][3];
+	int				satListGNSS[MAX_GNSS*MAX_SATELLITES_PER_GNSS];
+	int				satListPRN[MAX_GNSS*MAX_SATELLITES_PER_GNSS];
+	int				numSatList = 0;
+	TSatDiffSample	*samples;
+	TSatDiffSample	*sample;
+	TOptions		*optionsProd;
 	double 			tIncrease = 30.;
-	int				ret;
-	double			sunPos[3];
-	double			auxT;
 	double			epochsProcessed=0.;
 	double			CurrentPercentage=0.;
 	double			seconds;
@@ -11210,7 +11553,6 @@ void compareOrbits (TGNSSproducts **products, TGNSSproducts **pastProducts, TGNS
 	int				end=0;
 	int				numReadNav,numReadSP3,numReadOrb;
 	int				currentMJDN;
-	TSatellite		sat;
 	TStat			statSISRE[MAX_GNSS][MAX_SATELLITES_PER_GNSS];
 	TStat			statSISRETot;
 	TStat			stat3D[MAX_GNSS][MAX_SATELLITES_PER_GNSS];
@@ -11227,7 +11569,6 @@ void compareOrbits (TGNSSproducts **products, TGNSSproducts **pastProducts, TGNS
 	TStat			statCroOrbTot;
 	TSatInfo		satInfo[MAX_GNSS][MAX_SATELLITES_PER_GNSS];
 	int				bothSP3;
-	int				SBASIOD = -1;	//SBAS not used here, so the IOD value for BRDC data is -1
 	char			auxstr[100];
 	struct tm 		tm;
 
@@ -11282,6 +11623,27 @@ void compareOrbits (TGNSSproducts **products, TGNSSproducts **pastProducts, TGNS
 		printInfo("WARNING both input orbits are SP3, and the satellite phase centre corrections are active. These corrections will only be applied to the second SP3 product", options);
 	}
 
+	// List of satellites to compare
+	for ( k = 0; k < MAX_GNSS; k++ ) {
+		for ( i = 0; i < MAX_SATELLITES_PER_GNSS; i++ ) {
+			if ( !options->includeSatellite[k][i] ) continue;
+			satListGNSS[numSatList] = k;
+			satListPRN[numSatList] = i;
+			numSatList++;
+		}
+	}
+
+	// Each product has its own orbit and clock max gaps, so a copy of the options is kept for each one
+	optionsProd = malloc(2*sizeof(TOptions));
+	for ( j = 0; j < 2; j++ ) {
+		memcpy(&optionsProd[j], options, sizeof(TOptions));
+		optionsProd[j].OrbitsMaxDistance=OrbitsMaxDistance[j];
+		optionsProd[j].OrbitsToTMaxDistance=OrbitsToTMaxDistance[j];
+		optionsProd[j].ClocksMaxDistance=ClocksMaxDistance[j];
+		optionsProd[j].ClocksToTMaxDistance=ClocksToTMaxDistance[j];
+	}
+	samples = malloc(sizeof(TSatDiffSample)*MAX_PRODUCTS_EPOCH_BLOCK*(numSatList>0?numSatList:1));
+
 	// Check if StartTime MJDN is many days before the EndTime MJDN.
 	// This can happen if in the brodcast file some messages are very old.
 	// This would make gLAB to do a very very long loop checking for broadcast data for so many days
@@ -11362,25 +11724,6 @@ void compareOrbits (TGNSSproducts **products, TGNSSproducts **pastProducts, TGNS
 
 	memcpy(&t, &startTime, sizeof(TTime));
 	while ( end==0 ) {
-		if (printProgress) {
-			CurrentPercentage=100.*epochsProcessed/numberEpochs;
-			if ((CurrentPercentage-PreviousPercentage)>=0.1) { //This is to avoid to many prints when percentages changed less than 0.1
-				t2tmnolocal (&t, &tm, &seconds);
-				if (options->ProgressEndCharac=='\r') {
-					//Printing to a terminal
-					fprintf(options->terminalStream,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        %c",t2doystr(&t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,CurrentPercentage,options->ProgressEndCharac);
-					//In Windows, cursor is not disabled
-					fflush(options->terminalStream);
-				} else {
-					//Printing for the GUI. Only print if the integer of the percentage have changed (to avoid message spamming)
-					if ((int)CurrentPercentage!=(int)PreviousPercentage) {
-						fprintf(options->terminalStream,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        %c",t2doystr(&t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,CurrentPercentage,options->ProgressEndCharac);
-						fflush(options->terminalStream);
-					}
-				}
-				PreviousPercentage=CurrentPercentage;
-			}
-		}
 		// Check if concatenated files. If so and it is needed, read the next file
 		if ( (tdiff(&t, &endTime)  >= 0 || currentMJDN<t.MJDN ) && (DataAvailable[0]==1 && DataAvailable[1]==1)  ) {
 			currentMJDN=t.MJDN;
@@ -11395,7 +11738,7 @@ void compareOrbits (TGNSSproducts **products, TGNSSproducts **pastProducts, TGNS
 					l=0;
 				}
 				if ( retRNXnav[l]==2 && (numReadNav<=sopt->numNav) ) {
-					retRNXnav[l] = readRinexNav(fdRNXnav[l], products[j], &rinexNavVersion[l]);
+					retRNXnav[l] = readRinexNav(fdRNXnav[l], products[j], &rinexNavVersion[l], options);
 					if (retRNXnav[l] == 2 ) DataAvailable[j]=1;
 					endTime = getProductsLastEpoch(products[j]);
 					numReadNav++;
@@ -11449,113 +11792,83 @@ void compareOrbits (TGNSSproducts **products, TGNSSproducts **pastProducts, TGNS
 			continue;
 		}
 
+		// Take all the epochs until the next products change, so they can be computed in parallel
+		numEpochsBlock = 0;
+		do {
+			memcpy(&tBlock[numEpochsBlock], &t, sizeof(TTime));
+			numEpochsBlock++;
+			t = tdadd(&t,tIncrease);
+		} while ( numEpochsBlock < MAX_PRODUCTS_EPOCH_BLOCK && tdiff(&t, &endTime) < 0 && ( currentMJDN >= t.MJDN || ( (DataAvailable[0]==0 || DataAvailable[1]==0) && ( sopt->numNav!=1 || retRNXnav[0]!=2 || (retSP3[0]==2 && retSP3o[0]==2) ) ) ) );
+
 		if ( options->discardEclipsedSatellites ) {
-			findSun(&t, sunPos);
+			for ( e = 0; e < numEpochsBlock; e++ ) {
+				findSun(&tBlock[e], sunPosBlock[e]);
+			}
 		}
-		for ( k = 0; k < MAX_GNSS; k++ ) {
-			if(k==GLONASS && bothSP3==0 ) continue; //Skip GLONASS for navigation files
-			for ( i = 0; i < MAX_SATELLITES_PER_GNSS; i++ ) {
-				available = 1;
-				for ( j = 0; j < 2; j++ ) {
-					//Set values for orbit and clk max gaps in options struc
-					options->OrbitsMaxDistance=OrbitsMaxDistance[j];
-					options->OrbitsToTMaxDistance=OrbitsToTMaxDistance[j];
-					options->ClocksMaxDistance=ClocksMaxDistance[j];
-					options->ClocksToTMaxDistance=ClocksToTMaxDistance[j];
-					// Check if satellite has been deselected
-					if ( !options->includeSatellite[k][i] ) {
-						available = 0;
-						break;
-					}
-					// Satellite positions and velocities
-					ret = getSatellitePVT(products[j], &t, 0.0, k, i, position[j], velocity[j], ITRFvelocity[j], NULL, SBASIOD, options);
-					if ( !ret ) {
-						available = 0;
-						break;
+		// Each thread computes a full satellite, as eclipse checks depend on the previous epochs
+		#pragma omp parallel for private(e) if(options->numthreads>1)
+		for ( s = 0; s < numSatList; s++ ) {
+			for ( e = 0; e < numEpochsBlock; e++ ) {
+				compareSatelliteOrbits(products, &tBlock[e], satListGNSS[s], satListPRN[s], sunPosBlock[e], bothSP3, constellation, &satInfo[satListGNSS[s]][satListPRN[s]], optionsProd, &samples[s*MAX_PRODUCTS_EPOCH_BLOCK+e]);
+			}
+		}
+
+		// Statistics and prints are done in the same order as epochs and satellites were computed
+		for ( e = 0; e < numEpochsBlock; e++ ) {
+			if (printProgress) {
+				CurrentPercentage=100.*epochsProcessed/numberEpochs;
+				if ((CurrentPercentage-PreviousPercentage)>=0.1) { //This is to avoid to many prints when percentages changed less than 0.1
+					t2tmnolocal (&tBlock[e], &tm, &seconds);
+					if (options->ProgressEndCharac=='\r') {
+						//Printing to a terminal
+						fprintf(options->terminalStream,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        %c",t2doystr(&tBlock[e]),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,CurrentPercentage,options->ProgressEndCharac);
+						//In Windows, cursor is not disabled
+						fflush(options->terminalStream);
 					} else {
-						// Eclipsed satellite check
-						memcpy(sat.position, position[j], 3 * sizeof(double));
-						memcpy(sat.velocity, velocity[j], 3 * sizeof(double));
-						sat.hasOrbitsAndClocks = 1;
-						if ( options->discardEclipsedSatellites ) {
-							if ( isEclipsed(&t, &sat, &satInfo[k][i], sunPos, &auxT) ) {
-								if ( auxT == 0 ) {
-									printSatSel(0, i, "Satellite under eclipse", 0, options);
-								} else {
-									sprintf(messagestr, "Satellite was under eclipse %4.0f seconds ago", auxT);
-									printSatSel(0, i, messagestr, 0, options);
-								}
-								available = 0;
-								break;
-							}
-						}
-					}
-					// Satellite clock
-					if ( options->satelliteClockCorrection ) {
-						ret = getSatellitePVT(products[j], &t, 0.0, k, i, NULL, NULL, NULL, &clock[j], SBASIOD, options);
-						if ( !ret ) {
-							available = 0;
-							break;
-						}
-					}
-					// Satellite orientation
-					getSatelliteOrientation(&t, position[j], orientation[j]);
-					// Satellite phase center correction
-					if ( products[j]->type == SP3 && options->satellitePhaseCenter ) {
-						if ( !bothSP3 || j == 1 ) { // The contrary, will mean both SP3 input files, and first product
-							ret = satellitePhaseCenterCorrection3D(&t, k, i, C1C, orientation[j], constellation, dr);
-							if ( !ret ) {
-								available = 0;
-								break;
-							}
-							// Coordinate correction
-							position[j][0] += dr[0];
-							position[j][1] += dr[1];
-							position[j][2] += dr[2];
+						//Printing for the GUI. Only print if the integer of the percentage have changed (to avoid message spamming)
+						if ((int)CurrentPercentage!=(int)PreviousPercentage) {
+							fprintf(options->terminalStream,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        %c",t2doystr(&tBlock[e]),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,CurrentPercentage,options->ProgressEndCharac);
+							fflush(options->terminalStream);
 						}
 					}
-				}
-				if ( available ) {
-					for ( j = 0; j < 3; j++ ) posDiff[j] = position[1][j] - position[0][j];
-	
-					memcpy(posDiffXYZ,posDiff,sizeof(posDiff));
-					// Satellite orientation in the ACR system (along, cross, radial)
-					getSatelliteOrientationACR(position[1], velocity[1], orientationACR);
-					changeBase(orientationACR, posDiff);
-	
-					// Compute orbit and clock differences
-					if ( options->satelliteClockCorrection ) {
-						ClkDiff = clock[1] - clock[0];
-						SISREDiff = sqrt((posDiff[2] - ClkDiff) * (posDiff[2] - ClkDiff) + (posDiff[0] * posDiff[0] + posDiff[1] * posDiff[1]) / 49);
-					} else {
-						ClkDiff = 0;
-						SISREDiff = 0;
-					}
-					OrbDiff = sqrt(posDiff[2] * posDiff[2] + (posDiff[0] * posDiff[0] + posDiff[1] * posDiff[1]) / 49);
-					Orb3DDiff = sqrt(posDiff[0] * posDiff[0] + posDiff[1] * posDiff[1] + posDiff[2] * posDiff[2]);
-					
-					addStat(&statSISRE[k][i], SISREDiff);
-					addStat(&statSISRETot, SISREDiff);
-					addStat(&statOrb[k][i], OrbDiff);
-					addStat(&statOrbTot, OrbDiff);
-					addStat(&stat3D[k][i], Orb3DDiff);
-					addStat(&stat3DTot, Orb3DDiff);
-					addStat(&statClk[k][i], ClkDiff);
-					addStat(&statClkTot, ClkDiff);
-					addStat(&statRadOrb[k][i], posDiff[2]);
-					addStat(&statRadOrbTot, posDiff[2]);
-					addStat(&statAloOrb[k][i], posDiff[0]);
-					addStat(&statAloOrbTot, posDiff[0]);
-					addStat(&statCroOrb[k][i], posDiff[1]);
-					addStat(&statCroOrbTot, posDiff[1]);
-					
-					printSatDiff(&t, k, i, SISREDiff, OrbDiff, Orb3DDiff, ClkDiff, posDiff, posDiffXYZ, options);
+					PreviousPercentage=CurrentPercentage;
 				}
 			}
+			for ( s = 0; s < numSatList; s++ ) {
+				sample = &samples[s*MAX_PRODUCTS_EPOCH_BLOCK+e];
+				k = satListGNSS[s];
+				i = satListPRN[s];
+				if ( sample->eclipseTime == 0 ) {
+					printSatSel(0, i, "Satellite under eclipse", 0, options);
+				} else if ( sample->eclipseTime > 0 ) {
+					sprintf(messagestr, "Satellite was under eclipse %4.0f seconds ago", sample->eclipseTime);
+					printSatSel(0, i, messagestr, 0, options);
+				}
+				if ( !sample->available ) continue;
+
+				addStat(&statSISRE[k][i], sample->SISREDiff);
+				addStat(&statSISRETot, sample->SISREDiff);
+				addStat(&statOrb[k][i], sample->OrbDiff);
+				addStat(&statOrbTot, sample->OrbDiff);
+				addStat(&stat3D[k][i], sample->Orb3DDiff);
+				addStat(&stat3DTot, sample->Orb3DDiff);
+				addStat(&statClk[k][i], sample->ClkDiff);
+				addStat(&statClkTot, sample->ClkDiff);
+				addStat(&statRadOrb[k][i], sample->posDiff[2]);
+				addStat(&statRadOrbTot, sample->posDiff[2]);
+				addStat(&statAloOrb[k][i], sample->posDiff[0]);
+				addStat(&statAloOrbTot, sample->posDiff[0]);
+				addStat(&statCroOrb[k][i], sample->posDiff[1]);
+				addStat(&statCroOrbTot, sample->posDiff[1]);
+
+				printSatDiff(&tBlock[e], k, i, sample->SISREDiff, sample->OrbDiff, sample->Orb3DDiff, sample->ClkDiff, sample->posDiff, sample->posDiffXYZ, options);
+			}
+			epochsProcessed++;
 		}
-		t = tdadd(&t,tIncrease);
-		epochsProcessed++;
 	}
+	free(samples);
+	free(optionsProd);
+
 	// Close opened files
 	for(i=0;i<2;i++) {
 		if ( fdRNXnav[i] != NULL)	fclose(fdRNXnav[i]);
@@ -11603,20 +11916,19 @@ void compareOrbits (TGNSSproducts **products, TGNSSproducts **pastProducts, TGNS
 void showProduct (TGNSSproducts *products, TGNSSproducts *pastProducts, TGNSSproducts *nextProducts, FILE *fdRNXnav, int retRNXnav, double rinexNavVersion, FILE *fdSP3, int retSP3, FILE *fdSP3o, int retSP3o, FILE *fdCLK, int retCLK, TConstellation *constellation, TTime startTime, TTime endTime, TTime endTimePercentage, double numberEpochs, TOptions *options, TSupportOptions *sopt) {
 	double			tIncrease = 30.;
 	TTime			t;
+	TTime			tBlock[MAX_PRODUCTS_EPOCH_BLOCK];
+	int				numEpochsBlock;
 	int				i, k;
+	int				s, e;
+	int				satListGNSS[MAX_GNSS*MAX_SATELLITES_PER_GNSS];
+	int				satListPRN[MAX_GNSS*MAX_SATELLITES_PER_GNSS];
+	int				numSatList = 0;
+	TSatPvtSample	*samples;
+	TSatPvtSample	*sample;
 	int				currentMJDN;
-	int				available;
-	int				ret;
 	int				DataAvailable;
 	int				end=0;
-	double			position[3];
-	double			velocity[3];
-	double			ITRFvelocity[3];
-	double			clock;
-	double			dr[3];
-	double			orientation[3][3];
 	char			auxstr[100];
-	int				SBASIOD = -1;	// SBAS not used here, so the IOD value for BRDC data is -1
 	double			epochsProcessed=0.;
 	double			CurrentPercentage=0.;
 	double			seconds;
@@ -11679,6 +11991,17 @@ void showProduct (TGNSSproducts *products, TGNSSproducts *pastProducts, TGNSSpro
 		DataAvailable=0;
 	}
 
+	// List of satellites to show
+	for ( k = 0; k < MAX_GNSS; k++ ) {
+		for ( i = 0; i < MAX_SATELLITES_PER_GNSS; i++ ) {
+			if ( !options->includeSatellite[k][i] ) continue;
+			satListGNSS[numSatList] = k;
+			satListPRN[numSatList] = i;
+			numSatList++;
+		}
+	}
+	samples = malloc(sizeof(TSatPvtSample)*MAX_PRODUCTS_EPOCH_BLOCK*(numSatList>0?numSatList:1));
+
 	memcpy(&t, &startTime, sizeof(TTime));
 	currentMJDN=startTime.MJDN;
 	if(sopt->numNav==1) {
@@ -11690,30 +12013,12 @@ void showProduct (TGNSSproducts *products, TGNSSproducts *pastProducts, TGNSSpro
 		}
 	}
 	while(end==0) {
-		if (printProgress) {
-			CurrentPercentage=100.*epochsProcessed/numberEpochs;
-			if ((CurrentPercentage-PreviousPercentage)>=0.1) { //This is to avoid to many prints when percentages changed less than 0.1
-				t2tmnolocal (&t, &tm, &seconds);
-				if (options->ProgressEndCharac=='\r') {
-					//Printing to a terminal
-					fprintf(options->terminalStream,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        %c",t2doystr(&t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,CurrentPercentage,options->ProgressEndCharac);
-					fflush(options->terminalStream);
-				} else {
-					//Printing for the GUI. Only print if the integer of the percentage have changed (to avoid message spamming)
-					if ((int)CurrentPercentage!=(int)PreviousPercentage) {
-						fprintf(options->terminalStream,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        %c",t2doystr(&t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,CurrentPercentage,options->ProgressEndCharac);
-						fflush(options->terminalStream);
-					}
-				}
-				PreviousPercentage=CurrentPercentage;
-			}
-		}
 		if ( (tdiff(&t, &endTime) >= 0 || currentMJDN<t.MJDN ) && DataAvailable==1 ) {
 			// Check if concatennated files. If so and it is needed, read the next file
 			DataAvailable=0;
 			currentMJDN=t.MJDN;
 			if ( retRNXnav == 2 ) {
-				retRNXnav = readRinexNav(fdRNXnav, products, &rinexNavVersion);
+				retRNXnav = readRinexNav(fdRNXnav, products, &rinexNavVersion, options);
 				if (retRNXnav == 2 ) DataAvailable=1;
 				endTime = getProductsLastEpoch(products);
 			}
@@ -11761,44 +12066,51 @@ void showProduct (TGNSSproducts *products, TGNSSproducts *pastProducts, TGNSSpro
 			continue;
 		}
 
-		for ( k = 0; k < MAX_GNSS; k++ ) {
-			if(k==GLONASS && sopt->numNav>0 ) continue; //Skip GLONASS for navigation files
-			for ( i = 0; i < MAX_SATELLITES_PER_GNSS; i++ ) {
-				available = 1;
-				// Check if satellite has been deselected
-				if ( !options->includeSatellite[k][i] ) continue;
-				// Satellite positions and velocities
-				ret = getSatellitePVT(products, &t, 0.0, k, i, position, velocity, ITRFvelocity, NULL, SBASIOD, options);
-				if (!ret) available = 0;
-				// Satellite clock
-				if ( options->satelliteClockCorrection ) {
-					ret = getSatellitePVT(products, &t, 0.0, k, i, NULL, NULL, NULL, &clock, SBASIOD, options);
-				} else {
-					clock=0;
-				}
-				// Satellite phase center correction
-				if ( products->type == SP3 && options->satellitePhaseCenter ) {
-					// Satellite orientation
-					getSatelliteOrientation(&t, position, orientation);
-					ret = satellitePhaseCenterCorrection3D(&t, k, i, C1C, orientation, constellation, dr);
-					if ( !ret ) available = 0;
-					// Coordinate correction
-					position[0] += dr[0];
-					position[1] += dr[1];
-					position[2] += dr[2];
-				}
-				if ( available ) {
-					if ( options->satVel == svINERTIAL ) {
-						printSatPvt(&t, k, i, position, velocity, clock, options);
+		// Take all the epochs until the next products change, so they can be computed in parallel
+		numEpochsBlock = 0;
+		do {
+			memcpy(&tBlock[numEpochsBlock], &t, sizeof(TTime));
+			numEpochsBlock++;
+			t = tdadd(&t, tIncrease);
+		} while ( numEpochsBlock < MAX_PRODUCTS_EPOCH_BLOCK && tdiff(&t, &endTime) < 0 && ( currentMJDN >= t.MJDN || DataAvailable==0 ) );
+
+		#pragma omp parallel for private(e) if(options->numthreads>1)
+		for ( s = 0; s < numSatList; s++ ) {
+			for ( e = 0; e < numEpochsBlock; e++ ) {
+				computeSatelliteProduct(products, &tBlock[e], satListGNSS[s], satListPRN[s], constellation, options, &samples[s*MAX_PRODUCTS_EPOCH_BLOCK+e]);
+			}
+		}
+
+		// Prints are done in the same order as epochs and satellites were computed
+		for ( e = 0; e < numEpochsBlock; e++ ) {
+			if (printProgress) {
+				CurrentPercentage=100.*epochsProcessed/numberEpochs;
+				if ((CurrentPercentage-PreviousPercentage)>=0.1) { //This is to avoid to many prints when percentages changed less than 0.1
+					t2tmnolocal (&tBlock[e], &tm, &seconds);
+					if (options->ProgressEndCharac=='\r') {
+						//Printing to a terminal
+						fprintf(options->terminalStream,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        %c",t2doystr(&tBlock[e]),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,CurrentPercentage,options->ProgressEndCharac);
+						fflush(options->terminalStream);
 					} else {
-						printSatPvt(&t, k, i, position, ITRFvelocity, clock, options);
+						//Printing for the GUI. Only print if the integer of the percentage have changed (to avoid message spamming)
+						if ((int)CurrentPercentage!=(int)PreviousPercentage) {
+							fprintf(options->terminalStream,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        %c",t2doystr(&tBlock[e]),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,CurrentPercentage,options->ProgressEndCharac);
+							fflush(options->terminalStream);
+						}
 					}
+					PreviousPercentage=CurrentPercentage;
+				}
+			}
+			for ( s = 0; s < numSatList; s++ ) {
+				sample = &samples[s*MAX_PRODUCTS_EPOCH_BLOCK+e];
+				if ( sample->available ) {
+					printSatPvt(&tBlock[e], satListGNSS[s], satListPRN[s], sample->position, sample->velocity, sample->clock, options);
 				}
 			}
+			epochsProcessed++;
 		}
-		t = tdadd(&t, tIncrease);
-		epochsProcessed++;
 	}
+	free(samples);
 
 	if ( fdRNXnav != NULL)	fclose(fdRNXnav);
 	if ( fdSP3 != NULL )	fclose(fdSP3);
@@ -11887,7 +12199,7 @@ void productsProcessing (TOptions *options, TSupportOptions *sopt, TConstellatio
 	for ( i = 0; i < sopt->numNav; i++ ) {
 		// Open and read the RINEX navigation file
 		if ( whatFileTypeIs( sopt->navFile[i]) != ftRINEXbroadcast ) retRNXnav[i] = 0;
-		if ( (fdRNXnav[i] = fopen(sopt->navFile[i], "rb")) ) {
+		if ( (fdRNXnav[i] = openInputFile(sopt->navFile[i])) ) {
 			if (printProgress==1) {	
 				if (options->ProgressEndCharac=='\r') {
 					//Printing to a terminal
@@ -11895,7 +12207,7 @@ void productsProcessing (TOptions *options, TSupportOptions *sopt, TConstellatio
 					fflush(options->terminalStream);
 				}
 			}
-			retRNXnav[i] = readRinexNav(fdRNXnav[i], products[sources], &rinexNavVersion[i]);
+			retRNXnav[i] = readRinexNav(fdRNXnav[i], products[sources], &rinexNavVersion[i], options);
 		}
 		else retRNXnav[i] = -1;
 
@@ -11914,7 +12226,7 @@ void productsProcessing (TOptions *options, TSupportOptions *sopt, TConstellatio
 	for ( i = 0; i < sopt->numSP3; i++ ) {
 		// Open and read the SP3 file
 		if ( whatFileTypeIs(sopt->SP3File[i]) != ftSP3 ) retSP3[i] = 0;
-		if ( (fdSP3[i] = fopen(sopt->SP3File[i], "rb")) ) retSP3[i] = readSP3(fdSP3[i], pastProducts[sources], 1, 1, 0, options);
+		if ( (fdSP3[i] = openInputFile(sopt->SP3File[i])) ) retSP3[i] = readSP3(fdSP3[i], pastProducts[sources], 1, 1, 0, options);
 		else retSP3[i] = -1;
 
 		// Check errors
@@ -11948,7 +12260,7 @@ void productsProcessing (TOptions *options, TSupportOptions *sopt, TConstellatio
 	for (i=0;i<sopt->numOrb;i++) {
 		// Open and read the SP3 file
 		if ( whatFileTypeIs(sopt->orbFile[i]) != ftSP3 ) retSP3o[i] = 0;
-		if ( (fdSP3o[i] = fopen(sopt->orbFile[i], "rb")) ) {
+		if ( (fdSP3o[i] = openInputFile(sopt->orbFile[i])) ) {
 			if (printProgress==1) {	
 				if (options->ProgressEndCharac=='\r') {
 					//Printing to a terminal
@@ -11987,7 +12299,7 @@ void productsProcessing (TOptions *options, TSupportOptions *sopt, TConstellatio
 
 		// Clock
 		if ( whatFileTypeIs(sopt->clkFile[i]) != ftRINEXclocks ) retCLK[i] = 0;
-		if ( (fdCLK[i] = fopen(sopt->clkFile[i], "r")) ) {
+		if ( (fdCLK[i] = openInputFile(sopt->clkFile[i])) ) {
 			if (printProgress==1) {	
 				if (options->ProgressEndCharac=='\r') {
 					//Printing to a terminal
@@ -12189,9 +12501,9 @@ void productsProcessing (TOptions *options, TSupportOptions *sopt, TConstellatio
 		} else if (retRNXnav[0]==2 && ( (numConcatSP3[0]==1 && sopt->numSP3>0) || (numConcatSP3o[0]==1 && sopt->numOrb>0) ) ) {
 			//Navigation file concatenated but not SP3 file
 			//Read the next or two next days available for the navigation file
-			retRNXnav[0] = readRinexNav(fdRNXnav[0], products[0], &rinexNavVersion[0]);
+			retRNXnav[0] = readRinexNav(fdRNXnav[0], products[0], &rinexNavVersion[0], options);
 			if(retRNXnav[0]==2) {
-				retRNXnav[0] = readRinexNav(fdRNXnav[0], products[0], &rinexNavVersion[0]);
+				retRNXnav[0] = readRinexNav(fdRNXnav[0], products[0], &rinexNavVersion[0], options);
 			}
 			if(sopt->numSP3>0) {
 				sprintf(messagestr,"WARNING: Navigation file [%s] is concatenated, but SP3 for orbit and clock products file [%s] is not. Time range will be defined by the latter product file",sopt->navFile[0],sopt->SP3File[0]);
@@ -12208,7 +12520,7 @@ void productsProcessing (TOptions *options, TSupportOptions *sopt, TConstellatio
 			//Navigation file is concatenated and SP3 are concatenated
 			//Get start time from navigation file before reading the next day (if done later, the start time would be from the second day, not the first day read)
 			startTime = getProductsFirstEpoch(products[0]);
-			retRNXnav[0] = readRinexNav(fdRNXnav[0], products[0], &rinexNavVersion[0]);
+			retRNXnav[0] = readRinexNav(fdRNXnav[0], products[0], &rinexNavVersion[0], options);
 			if (retRNXnav[0]==2 && ( (numConcatSP3[0]<3 && sopt->numSP3>0) || (numConcatSP3o[0]<3 && sopt->numOrb>0) ) ) {
 				//Three days for navigation files but only two days for SP3 files
 				if(sopt->numSP3>0) {
@@ -12596,7 +12908,7 @@ void AddUserError2RINEX (char *ObsFilename, char *UserErrorFilename, char *Outpu
 	ReadL1CAsItself=1;
 
 	//Open Observation file
-	fdRNX = fopen(ObsFilename,"rb");
+	fdRNX = openInputFile(ObsFilename);
 	if ( fdRNX == NULL) {
 		sprintf(messagestr,"Opening RINEX observation file [%s]",ObsFilename);
 		printError(messagestr,options);
@@ -12605,7 +12917,7 @@ void AddUserError2RINEX (char *ObsFilename, char *UserErrorFilename, char *Outpu
 		printError(messagestr,options);
 	}
 	//Open user adder error file
-	fdNoise = fopen(UserErrorFilename,"rb");
+	fdNoise = openInputFile(UserErrorFilename);
 	if ( fdNoise == NULL ) {
 		sprintf(messagestr,"Opening file [%s] for user added error to measurements",UserErrorFilename);
 		printError(messagestr,options);
@@ -12681,6 +12993,109 @@ void AddUserError2RINEX (char *ObsFilename, char *UserErrorFilename, char *Outpu
 }
 
 
+/*****************************************************************************
+ * Name        : followProducts
+ * Description : In follow mode, read again the navigation, SP3 and clock files
+ *               when they have been updated (and are not being written). The
+ *               navigation data is read on the current products, so the
+ *               previous data is kept as past data and all the structures
+ *               pointing to the products remain valid. The SP3 and clock data
+ *               replace the previous data in the past, current and next
+ *               products (the files are not concatenated in follow mode)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSupportOptions  *sopt          I  N/A  TSupportOptions structure
+ * TFollowFile  *followNav         IO N/A  TFollowFile structure of the navigation file
+ * TFollowFile  *followOrb         IO N/A  TFollowFile structure of the SP3 file
+ * TFollowFile  *followClk         IO N/A  TFollowFile structure of the clock file
+ * TGNSSproducts  *products        IO N/A  Current products
+ * TGNSSproducts  *pastSP3Prod     IO N/A  Past SP3 products
+ * TGNSSproducts  *nextSP3Prod     IO N/A  Next SP3 products
+ * TTime  *endProductsTime         O  N/A  Last epoch of the products
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  1 => Products read again
+ *                                         0 => Products not changed
+ *****************************************************************************/
+int followProducts (TSupportOptions *sopt, TFollowFile *followNav, TFollowFile *followOrb, TFollowFile *followClk, TGNSSproducts *products, TGNSSproducts *pastSP3Prod, TGNSSproducts *nextSP3Prod, TTime *endProductsTime, TOptions *options) {
+	int				i;
+	int				ret,ret1;
+	int				updated = 0;
+	double			rinexNavVersion = 0;
+	FILE			*fd;
+	TGNSSproducts	newSP3Prod;
+
+	if ( followNav->filename[0] != '\0' && isFollowFileUpdated(followNav) == 1 ) {
+		fd = openInputFile(followNav->filename);
+		if ( fd == NULL ) {
+			sprintf(messagestr,"Opening RINEX navigation file [%s]",followNav->filename);
+			printError(messagestr,options);
+		}
+		ret = readRinexNav(fd,products,&rinexNavVersion,options);
+		fclose(fd);
+		if ( ret < 1 ) {
+			sprintf(messagestr,"Reading RINEX navigation message file [%s]",followNav->filename);
+			printError(messagestr,options);
+		}
+		sprintf(messagestr,"Navigation file [%s] updated, read again",followNav->filename);
+		printInfo(messagestr,options);
+		updated = 1;
+	}
+
+	if ( followOrb->filename[0] != '\0' ) {
+		ret = isFollowFileUpdated(followOrb);
+		if ( followClk->filename[0] != '\0' ) {
+			ret1 = isFollowFileUpdated(followClk);
+			ret = ret || ret1;
+		}
+		if ( ret == 1 ) {
+			initGNSSproducts(&newSP3Prod);
+			fd = openInputFile(followOrb->filename);
+			if ( fd == NULL ) {
+				sprintf(messagestr,"Opening SP3 orbit products file [%s]",followOrb->filename);
+				printError(messagestr,options);
+			}
+			ret = readSP3(fd,&newSP3Prod,1,followClk->filename[0]=='\0',0,options);
+			fclose(fd);
+			if ( ret < 1 ) {
+				sprintf(messagestr,"Reading SP3 orbit products file [%s]",followOrb->filename);
+				printError(messagestr,options);
+			}
+			if ( followClk->filename[0] != '\0' ) {
+				fd = openInputFile(followClk->filename);
+				if ( fd == NULL ) {
+					sprintf(messagestr,"Opening clock products file [%s]",followClk->filename);
+					printError(messagestr,options);
+				}
+				ret = readRinexClocks(fd,&newSP3Prod);
+				fclose(fd);
+				if ( ret < 1 ) {
+					sprintf(messagestr,"Reading clock products file [%s]",followClk->filename);
+					printError(messagestr,options);
+				}
+			}
+			//Past, current and next products share the same SP3 data
+			for(i=0;i<MAX_GNSS*MAX_SATELLITES_PER_GNSS;i++) {
+				free(products->SP3->orbits.Concatblock[i]);
+				free(products->SP3->clocks.Concatblock[i]);
+			}
+			freeSP3data(products);
+			memcpy(products,&newSP3Prod,sizeof(TGNSSproducts));
+			memcpy(pastSP3Prod,&newSP3Prod,sizeof(TGNSSproducts));
+			memcpy(nextSP3Prod,&newSP3Prod,sizeof(TGNSSproducts));
+			ConcatenateSP3(0,products,pastSP3Prod,nextSP3Prod,options);
+			sprintf(messagestr,"Precise products file [%s] updated, read again",followOrb->filename);
+			printInfo(messagestr,options);
+			updated = 1;
+		}
+	}
+
+	if ( updated == 1 && options->workMode == wmDOPROCESSING ) {
+		*endProductsTime = getProductsLastEpoch(products);
+	}
+
+	return updated;
+}
+
 /*****************************************************************************
  * Name        : main
  * Description : Main executable function
@@ -12714,6 +13129,8 @@ int main (int argc, char* argv[]) {
 	TEpoch						*epochDGNSS = NULL;
 	TUserError					UserError;
 	TStdESA						StdESA;
+	TSmoother					smoother;
+	TFilterWorkspace			filterWorkspace;
 	FILE						*fdRNX = NULL;
 	FILE						*fdRNXnav = NULL;
 	FILE						*fdRNXKlb = NULL;
@@ -12727,6 +13144,7 @@ int main (int argc, char* argv[]) {
 	FILE						*fdCLK = NULL;
 	FILE						*fdNoise = NULL;
 	FILE						*fdstdESA = NULL;
+	FILE						*fdPerfTrace = NULL;
 	FILE						*fdRNXdgnss = NULL;
 	FILE						*fdRTCM = NULL;
 	FILE						*fdRTCM2 = NULL;
@@ -12737,6 +13155,7 @@ int main (int argc, char* argv[]) {
 	int							i,j,k,l;
 	unsigned int				m; //to avoid warning: comparison between signed and unsigned integer expressions
 	double						r;
+	double						perfT;
 	double						ionexVersion = 0;
 	double						rinexBVersion = 0;
 	double						rinexNavVersion = 0;
@@ -12769,6 +13188,12 @@ int main (int argc, char* argv[]) {
 	double						OrbMaxDistance;
 	int							nextNav=0;
 	int							retTGD[2];
+	TFollowFile					followObs;
+	TFollowFile					followNav;
+	TFollowFile					followOrb;
+	TFollowFile					followClk;
+	TFollowFile					followSBAS;
+	TRinexObsIndex				obsIndex;
 	
 	// Filter
 	TFilterSolution				solution;
@@ -13010,9 +13435,20 @@ int main (int argc, char* argv[]) {
 			}
 		}
 	}
+	inputFileOptions = &options;
+
+	//Set the number of threads (one thread gives serial processing) and their placement
+	#if defined _OPENMP
+		omp_set_dynamic(0);     // Explicitly disable dynamic teams
+		omp_set_num_threads(options.numthreads);
+		setThreadAffinity(&options);
+	#endif
 
 	//Init epoch after reading options
 	initEpoch(epoch,&options);
+	//SBAS summary samples are also stored according to the options read
+	initSummaryStat(&SBASdatabox.HPL,options.summarySketch);
+	initSummaryStat(&SBASdatabox.VPL,options.summarySketch);
 
 	//Disable HDOPorPDOP flag if any of HDOP or PDOP are not enabled
 	if (options.workMode==wmSBASPLOTS) {
@@ -13072,7 +13508,7 @@ int main (int argc, char* argv[]) {
 					fflush(options.terminalStream);
 				}
 			}
-			if ( readSBASFile(sopt.sbasFile, &SBASdatabox, &rinexBVersion, &epoch->t, &options) != 1 ) {
+			if ( readSBASFile(sopt.sbasFile, sopt.sbasIndexFile, &SBASdatabox, &rinexBVersion, &epoch->t, &options) != 1 ) {
 				if ( (int)rinexBVersion > 2 && rinexBVersion != 0 ) {
 					sprintf(messagestr, "RINEX-B version %1.2f from file [%s] not supported. Supported version is 2", rinexBVersion, sopt.sbasFile);
 					printError(messagestr, &options);
@@ -13180,11 +13616,23 @@ int main (int argc, char* argv[]) {
 		// The only downside of opening a file in binary mode is that you can't use the fseek function with the "SEEK_END" flag, because
 		// it may have undefined behaviour (according to C Standard "because of possible trailing null characters")
 		// In gLAB, the fseek function is only used in the getLback function
-		fdRNX = fopen(sopt.obsFile,"rb");
+		fdRNX = openInputFile(sopt.obsFile);
 		if ( fdRNX == NULL) {
 			sprintf(messagestr,"Opening RINEX observation file [%s]",sopt.obsFile);
 			printError(messagestr,&options);
-		} else if (whatFileTypeIs(sopt.obsFile)!=ftRINEXobservation) {
+		}
+		if ( options.followMode == 1 ) {
+			if ( initFollowFile(&followObs,sopt.obsFile) == 2 ) {
+				sprintf(messagestr,"RINEX observation file [%s] is compressed, it cannot be read in follow mode",sopt.obsFile);
+				printError(messagestr,&options);
+			}
+			//Wait for the header and the first two epochs (the reader reads one epoch ahead)
+			if ( waitRinexObsEpoch(fdRNX,&followObs,epoch,2,&options) == 0 ) {
+				sprintf(messagestr,"No complete epochs written in RINEX observation file [%s] before the follow mode timeout",sopt.obsFile);
+				printError(messagestr,&options);
+			}
+		}
+		if (whatFileTypeIs(sopt.obsFile)!=ftRINEXobservation) {
 			sprintf(messagestr,"Reading RINEX observation file [%s]",sopt.obsFile);
 			printError(messagestr,&options);
 		}
@@ -13192,7 +13640,7 @@ int main (int argc, char* argv[]) {
 	
 
 	if ( sopt.dgnssFile[0] != '\0' ) {
-		fdRNXdgnss = fopen(sopt.dgnssFile,"rb");
+		fdRNXdgnss = openInputFile(sopt.dgnssFile);
 		if ( fdRNXdgnss == NULL) {
 			sprintf(messagestr, "Opening RINEX observation file [%s] for reference station in DGNSS mode", sopt.dgnssFile);
 			printError(messagestr, &options);
@@ -13298,7 +13746,7 @@ int main (int argc, char* argv[]) {
 		}
 	}
 	if ( sopt.navFile[0][0] != '\0' ) {
-		fdRNXnav = fopen(sopt.navFile[0],"rb");
+		fdRNXnav = openInputFile(sopt.navFile[0]);
 		if (fdRNXnav == NULL) {
 			sprintf(messagestr,"Opening RINEX navigation file [%s]",sopt.navFile[0]);
 			printError(messagestr,&options);
@@ -13308,7 +13756,7 @@ int main (int argc, char* argv[]) {
 		}
 	}
 	if ( sopt.klbFile[0] != '\0' ) {
-		fdRNXKlb = fopen(sopt.klbFile,"rb");
+		fdRNXKlb = openInputFile(sopt.klbFile);
 		if (fdRNXKlb == NULL) {
 			sprintf(messagestr,"Opening RINEX navigation file [%s]",sopt.klbFile);
 			printError(messagestr,&options);
@@ -13318,7 +13766,7 @@ int main (int argc, char* argv[]) {
 		}
 	}
 	if ( sopt.beiFile[0] != '\0' ) {
-		fdRNXBei = fopen(sopt.beiFile,"rb");
+		fdRNXBei = openInputFile(sopt.beiFile);
 		if ( fdRNXBei == NULL) {
 			sprintf(messagestr,"Opening RINEX navigation file [%s]",sopt.beiFile);
 			printError(messagestr,&options);
@@ -13328,7 +13776,7 @@ int main (int argc, char* argv[]) {
 		}
 	}
 	if ( sopt.neqFile[0] != '\0' ) {
-		fdRNXNeq = fopen(sopt.neqFile,"rb");
+		fdRNXNeq = openInputFile(sopt.neqFile);
 		if ( fdRNXNeq == NULL ) {
 			sprintf(messagestr,"Opening RINEX navigation file [%s]",sopt.neqFile);
 			printError(messagestr,&options);
@@ -13338,7 +13786,7 @@ int main (int argc, char* argv[]) {
 		}
 	}
 	if ( sopt.inxFile[0] != '\0' ) {
-		fdIONEX = fopen(sopt.inxFile,"rb");
+		fdIONEX = openInputFile(sopt.inxFile);
 		if ( fdIONEX == NULL ) {
 			sprintf(messagestr,"Opening IONEX file [%s]",sopt.inxFile);
 			printError(messagestr,&options);
@@ -13349,19 +13797,19 @@ int main (int argc, char* argv[]) {
 	}
 	if ( options.workMode == wmDOPROCESSING || options.workMode == wmSHOWINPUT ) {
 		if ( sopt.SP3File[0][0] != '\0' ) {
-			if (!(fdSP3 = fopen(sopt.SP3File[0],"rb"))) {
+			if (!(fdSP3 = openInputFile(sopt.SP3File[0]))) {
 				sprintf(messagestr,"Opening SP3 orbit products file [%s]",sopt.SP3File[0]);
 				printError(messagestr,&options);
 			}
 		}
 		if ( sopt.orbFile[0][0] != '\0' ) {
-			if (!(fdSP3o = fopen(sopt.orbFile[0],"rb"))) {
+			if (!(fdSP3o = openInputFile(sopt.orbFile[0]))) {
 				sprintf(messagestr,"Opening SP3 orbit products file [%s]",sopt.orbFile[0]);
 				printError(messagestr,&options);
 			}
 		}
 		if ( sopt.clkFile[0][0] != '\0' ) {
-			if (!(fdCLK = fopen(sopt.clkFile[0],"rb"))) {
+			if (!(fdCLK = openInputFile(sopt.clkFile[0]))) {
 				sprintf(messagestr,"Opening clock products file [%s]",sopt.clkFile[0]);
 				printError(messagestr,&options);
 			}
@@ -13512,7 +13960,7 @@ int main (int argc, char* argv[]) {
 					fflush(options.terminalStream);
 				}
 			}
-			ret=readRinexNav(fdRNXnav, &products,&rinexNavVersion);
+			ret=readRinexNav(fdRNXnav, &products,&rinexNavVersion, &options);
 			if ( ret < 1 ) {
 				if ( (int)rinexNavVersion > 3 && rinexNavVersion != 0 ) {
 					sprintf(messagestr,"RINEX navigation version %1.2f from file [%s] is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.navFile[0]);
@@ -13760,7 +14208,7 @@ int main (int argc, char* argv[]) {
 			if ( sopt.addederrorFile[0] == '\0' ) {
 				printError("User added error option selected, but no filename given",&options);
 			}
-			fdNoise = fopen(sopt.addederrorFile,"rb");
+			fdNoise = openInputFile(sopt.addederrorFile);
 			if ( fdNoise == NULL ) {
 				sprintf(messagestr,"Reading file [%s] for user added error to measurements",sopt.addederrorFile);
 				printError(messagestr,&options);
@@ -13845,7 +14293,7 @@ int main (int argc, char* argv[]) {
 						fflush(options.terminalStream);
 					}
 				}
-				ret=readRinexNav(fdRNXKlb,&productsKlb,&rinexNavVersion);
+				ret=readRinexNav(fdRNXKlb,&productsKlb,&rinexNavVersion,&options);
 				if ( ret < 1 ) {
 					if ( (int)rinexNavVersion > 3 && rinexNavVersion != 0 ) {
 						sprintf(messagestr,"RINEX navigation version %1.2f from file [%s] is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.klbFile);
@@ -13872,7 +14320,7 @@ int main (int argc, char* argv[]) {
 						fflush(options.terminalStream);
 					}
 				}
-				ret=readRinexNav(fdRNXBei,&productsBei,&rinexNavVersion);
+				ret=readRinexNav(fdRNXBei,&productsBei,&rinexNavVersion,&options);
 				if ( ret < 1 ) {
 					if ( (int)rinexNavVersion > 3 && rinexNavVersion != 0 ) {
 						sprintf(messagestr,"RINEX navigation version %1.2f from file [%s] is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.beiFile);
@@ -13900,7 +14348,7 @@ int main (int argc, char* argv[]) {
 						fflush(options.terminalStream);
 					}
 				}
-				ret=readRinexNav(fdRNXNeq,&productsNeq,&rinexNavVersion);
+				ret=readRinexNav(fdRNXNeq,&productsNeq,&rinexNavVersion,&options);
 					if ( ret < 1 ) {
 						if ( (int)rinexNavVersion > 3 && rinexNavVersion != 0 ) {
 							sprintf(messagestr,"RINEX navigation version %1.2f from file [%s] is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.neqFile);
@@ -14025,11 +14473,11 @@ int main (int argc, char* argv[]) {
 							fflush(options.terminalStream);
 						}
 					}
-					if(!(fdTGD[i]=fopen(sopt.tgdFile[i],"rb"))) {
+					if(!(fdTGD[i]=openInputFile(sopt.tgdFile[i]))) {
 						sprintf(messagestr,"Reading RINEX navigation message file for TGD data [%s]",sopt.tgdFile[i]);
 						printError(messagestr,&options);
 					} else {
-						retTGD[i]=readRinexNav(fdTGD[i],&productsTgd,&rinexNavVersion);
+						retTGD[i]=readRinexNav(fdTGD[i],&productsTgd,&rinexNavVersion,&options);
 						if ( retTGD[i]<1 ) {
 							if ( (int)rinexNavVersion > 3 && rinexNavVersion != 0 ) {
 								sprintf(messagestr,"RINEX navigation version %1.2f from file [%s] is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.tgdFile[i]); 	
@@ -14055,7 +14503,7 @@ int main (int argc, char* argv[]) {
 						fflush(options.terminalStream);
 					}
 				}
-				if(!(fdTGD[i]=fopen(sopt.tgdFile[i],"rb"))) {
+				if(!(fdTGD[i]=openInputFile(sopt.tgdFile[i]))) {
 					sprintf(messagestr,"Reading IONEX file for TGD data [%s]",sopt.tgdFile[i]);
 					printError(messagestr,&options);
 				} else {
@@ -14409,13 +14857,74 @@ int main (int argc, char* argv[]) {
 		// Print input parameters
 		printParameters(&options,epoch,&products,sopt.stanfordESAFile,sopt.stanfordESALOIFile,sopt.kmlFile,sopt.kml0File,sopt.SP3OutputFile,sopt.RefPosOutputFile);
 
+		// Files read in follow mode. Products files are only read again if they are not concatenated
+		followNav.filename[0] = followOrb.filename[0] = followClk.filename[0] = followSBAS.filename[0] = '\0';
+		followNav.watchfd = followOrb.watchfd = followClk.watchfd = followSBAS.watchfd = -1;
+		if ( options.followMode == 1 ) {
+			if ( sopt.navFile[0][0] != '\0' && nextNav == 0 && fdRNXnav == NULL ) {
+				if ( initFollowFile(&followNav,sopt.navFile[0]) != 1 ) followNav.filename[0] = '\0';
+			}
+			if ( options.concatenSP3 == 0 ) {
+				if ( sopt.SP3File[0][0] != '\0' ) {
+					if ( initFollowFile(&followOrb,sopt.SP3File[0]) != 1 ) followOrb.filename[0] = '\0';
+				} else if ( sopt.orbFile[0][0] != '\0' && sopt.clkFile[0][0] != '\0' ) {
+					if ( initFollowFile(&followOrb,sopt.orbFile[0]) != 1 || initFollowFile(&followClk,sopt.clkFile[0]) != 1 ) {
+						followOrb.filename[0] = '\0';
+						followClk.filename[0] = '\0';
+					}
+				}
+			}
+			if ( options.SBAScorrections == 1 ) {
+				if ( initFollowFile(&followSBAS,sopt.sbasFile) == 2 ) {
+					sprintf(messagestr,"SBAS file [%s] is compressed, it cannot be read in follow mode",sopt.sbasFile);
+					printError(messagestr,&options);
+				}
+				followSBAS.type = whatFileTypeIs(sopt.sbasFile);
+			}
+			sprintf(messagestr,"Follow mode enabled. Latency budget: %.3f seconds. Timeout: %.3f seconds",options.followLatency,options.followTimeout);
+			printInfo(messagestr,&options);
+			//The latency is measured from the first epoch read in the processing loop
+			followObs.availableTime = 0.;
+		}
+
 		processedEpochs = 0;
 		direction = pFORWARD;
 		filterIterations = 1;
 
+		initFilterWorkspace(&filterWorkspace);
+		if ( options.smoother == 1 ) {
+			initSmoother(&smoother);
+		}
+
+		// Open file for writing the performance trace
+		if ( sopt.perfTraceFile[0] != '\0' ) {
+			//Create directory recursively if needed
+			if(mkdir_recursive(sopt.perfTraceFile)!=0) {
+			   //Error when creating the directory, and it is not due to that the directory already exists
+			   sprintf(messagestr,"When creating [%s] folder for writing performance trace",sopt.perfTraceFile);
+			   printError(messagestr,&options);
+			}
+			fdPerfTrace = fopen(sopt.perfTraceFile,"w");
+			if ( fdPerfTrace == NULL ) {
+				sprintf(messagestr,"Opening [%s] file for writing performance trace",sopt.perfTraceFile);
+				printError(messagestr,&options);
+			}
+		}
+		initPerfStats(options.printPerf==1 || fdPerfTrace!=NULL,fdPerfTrace);
+
 		//Read timestamp of first epoch
 		getEpochFromObsFile(fdRNX,epoch->source,&epoch->t);	
 
+		//Build the offset index of the observation file if there are epochs which can be skipped without reading them
+		//or if the file has to be read backwards. In follow mode the file is not complete, so the index cannot be built
+		if ( options.followMode == 0 && options.DGNSS == 0 ) {
+			if ( options.StartEpoch.MJDN != -1 || (options.filterIterations > 1 && options.smoother == 0) || canSkipDecimatedEpochs(&options) == 1 ) {
+				if ( buildRinexObsIndex(fdRNX,epoch,&obsIndex) == 1 ) {
+					epoch->obsIndex = &obsIndex;
+				}
+			}
+		}
+
 		//This is to avoid reading the next day of ephemeris data when the observation file starts at the end of the previous day (for converging values)
 		MJDNEpoch=epoch->t.MJDN;
 		if(epoch->t.SoD>=75000.) {
@@ -14424,10 +14933,23 @@ int main (int argc, char* argv[]) {
 
 
 		while ( ret ) {
+			// Print the time spent in the previous epoch
+			printPerf(&options);
+			if ( options.followMode == 1 ) {
+				// Output the previous epoch before waiting for the next one
+				fflush(options.outFileStream);
+				if ( followObs.availableTime > 0. && perfClock()-followObs.availableTime > options.followLatency ) {
+					sprintf(messagestr,"WARNING Epoch %s output %.3f seconds after its observations were available, over the latency budget of %.3f seconds",t2doystr(&epoch->t),perfClock()-followObs.availableTime,options.followLatency);
+					printInfo(messagestr,&options);
+				}
+				if ( waitRinexObsEpoch(fdRNX,&followObs,epoch,1,&options) == 0 ) break;
+			}
 			// Determination of Backward/Forward
 			if ( filterIterations%2 == 1 ) direction = pFORWARD;
 			else direction = pBACKWARD;
+			perfT = perfStart();
 			ret = readRinexObsEpoch(fdRNX,epoch,&constellation,direction,Epochstr,&options);
+			perfStop(perfREAD,perfT);
 			// ret == 2 means that RINEX observables is "large/concatenated", so we need to read
 			// the new header and the next epoch (if header is found, readRinexObsEpoch function does not read any data!)
 			if ( ret == 2 ) {
@@ -14694,6 +15216,8 @@ int main (int argc, char* argv[]) {
 						break;
 					}
 				}
+				//Only the epochs inside the time range set by user have PERF messages
+				perfSetEpoch(&epoch->t);
 
 				//Check for data gaps in the rover observation file
 				if (epoch->CurrentDataGapSize>0 ) {
@@ -14715,6 +15239,9 @@ int main (int argc, char* argv[]) {
 
 				if ( tdiff(&epoch->t,&endProductsTime) > 0 && options.filterIterations > 1 ) ret = 0;
 			}
+			if ( ret && options.followMode == 1 ) {
+				followProducts(&sopt,&followNav,&followOrb,&followClk,&products,&pastSP3Prod,&nextSP3Prod,&endProductsTime,&options);
+			}
 			if ( ret ) {
 				if ( tdiff(&epoch->t,&endProductsTime) > 0 && options.filterIterations > 1 ) {
 					ret = 0;
@@ -14732,7 +15259,7 @@ int main (int argc, char* argv[]) {
 									fflush(options.terminalStream);
 								}
 							}
-							ret1 = readRinexNav(fdRNXnav,&products,&rinexNavVersion);
+							ret1 = readRinexNav(fdRNXnav,&products,&rinexNavVersion,&options);
 							// Set products end time
 							if ( options.workMode == wmDOPROCESSING ) {
 								endProductsTime = getProductsLastEpoch(&products);
@@ -14853,7 +15380,7 @@ int main (int argc, char* argv[]) {
 										fflush(options.terminalStream);
 									}
 								}
-								retTGD[i]=readRinexNav(fdTGD[i],&productsTgd,&rinexNavVersion);
+								retTGD[i]=readRinexNav(fdTGD[i],&productsTgd,&rinexNavVersion,&options);
 								if ( retTGD[i] < 1 ) {
 									if ((int)rinexNavVersion>3 && rinexNavVersion!=0) {
 										sprintf(messagestr,"RINEX navigation version %1.2f from file '%s' is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.tgdFile[i]); 	
@@ -14924,7 +15451,7 @@ int main (int argc, char* argv[]) {
 									fflush(options.terminalStream);
 								}
 							}
-							ret1=readRinexNav(fdRNXKlb,&productsKlb,&rinexNavVersion);
+							ret1=readRinexNav(fdRNXKlb,&productsKlb,&rinexNavVersion,&options);
 							if ( ret1 < 1 ) {
 								if ( (int)rinexNavVersion > 3 && rinexNavVersion != 0 ) {
 									sprintf(messagestr,"RINEX navigation version %1.2f from file '%s' is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.klbFile);
@@ -14952,7 +15479,7 @@ int main (int argc, char* argv[]) {
 									fflush(options.terminalStream);
 								}
 							}
-							ret1=readRinexNav(fdRNXBei,&productsBei,&rinexNavVersion);
+							ret1=readRinexNav(fdRNXBei,&productsBei,&rinexNavVersion,&options);
 							if ( ret1 < 1 ) {
 								if ( (int)rinexNavVersion > 3 && rinexNavVersion != 0 ) {
 									sprintf(messagestr,"RINEX navigation version %1.2f from file '%s' is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.beiFile);
@@ -14980,7 +15507,7 @@ int main (int argc, char* argv[]) {
 									fflush(options.terminalStream);
 								}
 							}
-							ret1=readRinexNav(fdRNXNeq,&productsNeq,&rinexNavVersion);
+							ret1=readRinexNav(fdRNXNeq,&productsNeq,&rinexNavVersion,&options);
 							if ( ret1 < 1 ) {
 								if ( (int)rinexNavVersion > 3 && rinexNavVersion != 0 ) {
 									sprintf(messagestr,"RINEX navigation version %1.2f from file '%s' is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.neqFile);
@@ -15075,8 +15602,13 @@ int main (int argc, char* argv[]) {
 
 			// Check if SBAS mode has been selected
 			if ( options.SBAScorrections == 1 ) {
-				// Read SBAS data until current epoch	
-				retsbas = readSBASFile(sopt.sbasFile,&SBASdatabox,&rinexBVersion,&epoch->t,&options);
+				// Read SBAS data until current epoch. In follow mode, the messages up to the current epoch
+				// must be written, but the epoch is not delayed beyond the latency budget
+				if ( options.followMode == 0 || waitSBASFile(&followSBAS,&epoch->t,followObs.availableTime+options.followLatency) == 1 ) {
+					perfT = perfStart();
+					retsbas = readSBASFile(sopt.sbasFile,sopt.sbasIndexFile,&SBASdatabox,&rinexBVersion,&epoch->t,&options);
+					perfStop(perfSBAS,perfT);
+				}
 				//Select GEO if we don't have one (it has to be each time an epoch starts, as it is when GEO data is updated)
 				SBASGEOselection(epoch,SBASdatabox.SBASdata,&options);
 				//Check GEO alarm status
@@ -15196,6 +15728,7 @@ int main (int argc, char* argv[]) {
 									printError("No convergence to solution",&options);
 								}
 							}
+							perfT = perfStart();
 							modelEpoch(epoch,&options);
 							if ( options.SBAScorrections == 1 && options.onlySBASiono == 0 ) {
 								retsbas=1;
@@ -15215,7 +15748,7 @@ int main (int argc, char* argv[]) {
 										epoch->SBASUsedGEO=SBASdatabox.SBASdata[options.GEOindex].PRN;
 									}
 									epoch->SBASUsedMode=options.precisionapproach;
-									#pragma omp parallel for private(ret1)
+									#pragma omp parallel for private(ret1) if(options.numthreads>1 && epoch->numSatellites>=MIN_SATELLITES_PARALLEL)
 									for ( i = 0; i < epoch->numSatellites; i++ ) {
 										ret1 = modelSatellite(epoch,NULL,i,&products,&productsKlb,&productsBei,&productsNeq,&ionex,&fppp,&tropoGal,&tgdData,&constellation,SBASdatabox.SBASdata,&options);
 										if ( ret1 == 1 ) {
@@ -15266,16 +15799,19 @@ int main (int argc, char* argv[]) {
 								}
 							} else {
 								// Normal processing mode
-								#pragma omp parallel for
+								#pragma omp parallel for if(options.numthreads>1 && epoch->numSatellites>=MIN_SATELLITES_PARALLEL)
 								for ( i=0;i<epoch->numSatellites;i++ ) {
 									modelSatellite(epoch,epochDGNSS,i,&products,&productsKlb,&productsBei,&productsNeq,&ionex,&fppp,&tropoGal,&tgdData,&constellation,SBASdatabox.SBASdata,&options);
 								}
 							}
+							perfStop(perfMODEL,perfT);
 							if ( Measprinted == 0 ) {
 								printMeas(epoch, &tgdData,&options);
 								Measprinted = 1;
 							}
-							kalmanRes = Kalman(epoch,&solution,PRNlist,&prevUnkinfo,&StdESA,&options);
+							perfT = perfStart();
+							kalmanRes = Kalman(epoch,&solution,PRNlist,&prevUnkinfo,&StdESA,options.smoother==1?&smoother:NULL,&filterWorkspace,&options);
+							perfStop(perfFILTER,perfT);
 							switch (kalmanRes) {
 								case 1:
 									processedEpochs++;
@@ -15389,12 +15925,34 @@ int main (int argc, char* argv[]) {
 					filterIterations++;
 					if ( filterIterations%2 == 0 ) { // Backward direction
 						memcpy(&epoch->BackwardTurningEpoch,&epoch->t,sizeof(TTime));
-						rewindEpochRinexObs(fdRNX, epoch->source);
+						if ( options.smoother == 1 ) {
+							// The solutions saved in the forward direction are smoothed from the last one backwards,
+							// without reading the observation file again
+							while ( getSmoothedEpoch(epoch,&smoother,&solution,&prevUnkinfo,&options) ) {
+								printOutput(epoch, NULL, &solution, &options, &prevUnkinfo,sopt.obsFile,VERSION);
+								//Write SP3 file if needed
+								if(fdOutSP3!=NULL) {
+									writeSP3file(fdOutSP3,epoch, &solution,&prevUnkinfo,0,VERSION,&options);
+								}
+								//Write Reference file if needed
+								if(fdOutRefFile!=NULL) {
+									writeReffile(fdOutRefFile,epoch, &solution,&prevUnkinfo,&options);
+								}
+							}
+							freeSmoother(&smoother);
+							continue;
+						}
+						rewindEpochRinexObsIndex(fdRNX, epoch->source, epoch->obsIndex);
 					}
 					ret = 1;
 				}
 			}
 		}
+		freeFilterWorkspace(&filterWorkspace);
+		if ( epoch->obsIndex != NULL ) {
+			freeRinexObsIndex(epoch->obsIndex);
+			epoch->obsIndex = NULL;
+		}
 		if ( !anyInsideProducts && options.workMode == wmDOPROCESSING )  {
 			if (printProgress==1) {
 				fprintf(options.terminalStream,"Percentage converted: %3d%%%10s%c",100,"",options.ProgressEndCharac);
@@ -15526,18 +16084,22 @@ int main (int argc, char* argv[]) {
 
 		sprintf(messagestr,"SBAS GEO switching: %3s",options.switchGEO==1?"ON":"OFF");
 		printInfo(messagestr,&options);
-		#if defined _OPENMP
-			sprintf(messagestr,"Number of threads used: %d",options.numthreads);
+		if (options.numthreads>1) {
+			sprintf(messagestr,"Number of threads used: %d (placement: %s)",options.numthreads,threadbind2str(options.threadBind));
 			printInfo(messagestr,&options);
-		#endif
+		}
 
 		//Open output files
 		if(options.NoAvailabilityPlot==0) {
 			//Show warning message to advert users of the long computation time needed
 			sprintf(messagestr,"WARNING SBAS Availability plots requires a lot of computation time. With the default options it takes around 2 hours");
 			printInfo(messagestr,&options);
-			#if !defined _OPENMP
-				printInfo("The user might consider to use the multithread version of gLAB for reducing computation time. Use the gLAB_Multithread executable or compile using the \"Makefile_multithread\" makefile",&options);
+			#if defined _OPENMP
+				if (options.numthreads==1) {
+					printInfo("The user might consider to use several threads for reducing computation time. Use the '-threads' option to set the number of threads",&options);
+				}
+			#else
+				printInfo("The user might consider to use several threads for reducing computation time. Compile gLAB with the '-fopenmp' flag and use the '-threads' option",&options);
 			#endif
 			if (options.DOPPercentile==1) {
 				printInfo("WARNING Computation of DOP percentiles requires a lot of memory (around 1GB for each DOP map with the default options)",&options);
@@ -15831,7 +16393,7 @@ int main (int argc, char* argv[]) {
 		}
 
 		//Read RINEX navigation data
-		if ( readRinexNav(fdRNXnav,&products,&rinexNavVersion) != 1 ) {
+		if ( readRinexNav(fdRNXnav,&products,&rinexNavVersion,&options) != 1 ) {
 			if ( (int)rinexNavVersion > 3 && rinexNavVersion != 0 ) {
 				sprintf(messagestr,"RINEX navigation version %1.2f from file [%s] is not supported. Supported versions are 2 and 3",rinexNavVersion,sopt.navFile[0]);
 				printError(messagestr,&options);
@@ -15983,7 +16545,7 @@ int main (int argc, char* argv[]) {
 			}
 			
 			// Read SBAS data until current epoch	
-			retsbas = readSBASFile(sopt.sbasFile,&SBASdatabox,&rinexBVersion,&epoch->t,&options);
+			retsbas = readSBASFile(sopt.sbasFile,sopt.sbasIndexFile,&SBASdatabox,&rinexBVersion,&epoch->t,&options);
 			if(retsbas==-2) {
 				//Reached End of file before getting to current epoch
 				if(currenttime<86399) {
@@ -16148,7 +16710,7 @@ int main (int argc, char* argv[]) {
 						//Do While loop to allow switching GEO in processing
 						do {
 							//Model each satellite. Unselect it if it is not in view or below the elevation mask
-							#pragma omp parallel for private(ret1,SBAScorr)
+							#pragma omp parallel for private(ret1,SBAScorr) if(options.numthreads>1 && epoch->numSatellites>=MIN_SATELLITES_PARALLEL)
 							for(i=0;i<epoch->numSatellites;i++) {
 								// Check if satellite has been deselected
 								if (!options.includeSatellite[epoch->sat[i].GNSS][epoch->sat[i].PRN]) {
@@ -16415,10 +16977,17 @@ int main (int argc, char* argv[]) {
 	if ( options.SBAScorrections == 1 && (options.writeRinexBfile || options.writeEMSfile || options.writePegasusfile) ) {
 		epoch->t.MJDN = -2;
 		epoch->t.SoD  = 0.0;
-		readSBASFile(sopt.sbasFile,&SBASdatabox,&rinexBVersion,&epoch->t,&options);
+		readSBASFile(sopt.sbasFile,sopt.sbasIndexFile,&SBASdatabox,&rinexBVersion,&epoch->t,&options);
 	}
 
 	// Close files
+	if ( options.followMode == 1 ) {
+		closeFollowFile(&followObs);
+		closeFollowFile(&followNav);
+		closeFollowFile(&followOrb);
+		closeFollowFile(&followClk);
+		closeFollowFile(&followSBAS);
+	}
 	if ( fdRNX != NULL)		fclose(fdRNX);
 	if ( fdRNXnav != NULL)	fclose(fdRNXnav);
 	if ( fdRNXNeq != NULL )	fclose(fdRNXNeq);
@@ -16509,16 +17078,18 @@ int main (int argc, char* argv[]) {
 			printSummary(UseReferenceFile,epoch,&StdESA,&options);
 		}
 		//Free memory
-		if (options.recPosProvided==1) {
-			free(epoch->HError);
-			free(epoch->VError);
-		}
-		free(epoch->HDOP);
-		free(epoch->PDOP);
-		free(epoch->GDOP);
-		free(epoch->TDOP);
-		free(epoch->VDOP);
+		freeSummaryStat(&epoch->HError);
+		freeSummaryStat(&epoch->VError);
+		freeSummaryStat(&epoch->HDOP);
+		freeSummaryStat(&epoch->PDOP);
+		freeSummaryStat(&epoch->GDOP);
+		freeSummaryStat(&epoch->TDOP);
+		freeSummaryStat(&epoch->VDOP);
+		freeSummaryStat(&SBASdatabox.HPL);
+		freeSummaryStat(&SBASdatabox.VPL);
 	}
+	printPerfSummary(&options);
+	freePerfStats();
 	#if !defined (__WIN32__)
 		if (printProgress) {
 			if (options.ProgressEndCharac=='\r') {		
@@ -394,16 +394,30 @@
  *       END_RELEASE_HISTORY
  *****************************/
 
+// Needed for fopencookie (reading compressed files)
+#define _GNU_SOURCE
+
 /* External classes */
 #include "input.h"
 #include "output.h"
+#include "preprocessing.h"
 #include <limits.h>
 #include <unistd.h>
+#if defined (__linux__)
+ #include <sys/inotify.h>
+ #include <poll.h>
+#endif
+#if defined (__WIN32__)
+ #include <windows.h>
+#endif
 
 //Import global variable printProgress
 extern int 	printProgress;
 extern int 	printProgressConvert;
 
+//Import global variable inputFileOptions
+extern TOptions	*inputFileOptions;
+
 /**************************************
  * Declarations of internal operations
  **************************************/
@@ -2025,2780 +2039,5980 @@ int getLback (char *lineptr, int *n, FILE *stream) {
 }
 
 /*****************************************************************************
- * Name        : whatFileTypeIs
- * Description : Identifies the file type
+ * Name        : initCRC32Table
+ * Description : Fill the table used to compute the CRC-32 of gzip members
+ * Parameters  : None
+ *****************************************************************************/
+static unsigned int	CRC32Table[256];
+static int			CRC32TableReady = 0;
+
+static void initCRC32Table (void) {
+	unsigned int	c;
+	int				i, k;
+
+	if (CRC32TableReady==1) return;
+	for (i=0;i<256;i++) {
+		c = (unsigned int)i;
+		for (k=0;k<8;k++) {
+			if (c&1) c = 0xEDB88320U^(c>>1);
+			else c >>= 1;
+		}
+		CRC32Table[i] = c;
+	}
+	CRC32TableReady = 1;
+}
+
+/*****************************************************************************
+ * Name        : updateCRC32
+ * Description : Update the CRC-32 with new data
  * Parameters  :
  * Name                           |Da|Unit|Description
- * char  *filename                 I  N/A  Name of the file
- * Returned value (fileType)       O  N/A  Type of file
+ * unsigned int  crc               I  N/A  CRC-32 of the previous data
+ * unsigned char  *data            I  N/A  New data
+ * int  n                          I  N/A  Number of bytes of new data
+ * Returned value (unsigned int)   O  N/A  CRC-32 including the new data
  *****************************************************************************/
-enum fileType whatFileTypeIs (char *filename) {
-	FILE			*fd = NULL;
-	char			line[MAX_INPUT_LINE];
-	char			line2[MAX_INPUT_LINE];
-	int				len = 0;
-	int				res;
-	char			aux[100];
-	char			aux2[100];
-	enum fileType	ft;
+static unsigned int updateCRC32 (unsigned int crc, unsigned char *data, int n) {
+	int		i;
 
-	ft = ftUNKNOWN;	// Default value
+	crc = ~crc;
+	for (i=0;i<n;i++) {
+		crc = CRC32Table[(crc^data[i])&0xFF]^(crc>>8);
+	}
+	return ~crc;
+}
 
-	fd = fopen(filename,"rb");
-	
-	if (fd==NULL) return ft;
-	
-	res = getL(line,&len,fd); 
-	
-	if (res!=-1) {
-		getstr(aux,line,60,13);
-		getstr(aux2,line,60,12);
-		// RINEX check
-		if (strcmp(aux,"RINEX VERSION")==0) {
-			getstr(aux,line,20,11);
-			if (strncmp(aux,"O",1)==0) ft = ftRINEXobservation;
-			else if (strncmp(aux,"N",1)==0) ft = ftRINEXbroadcast;
-			else if (strncmp(aux,"H",1)==0) ft = ftRINEXbroadcast; // Rinex v2 GEO nav data
-			else if (strncmp(aux,"G",1)==0) ft = ftRINEXbroadcast; // Rinex v2 GLONASS nav data
-			else if (strncmp(aux,"C",1)==0) ft = ftRINEXclocks;
-			else if (strncmp(aux,"B",1)==0) ft = ftRINEXB;
-			
-		// IONEX check
-		} else if (strcmp(aux,"IONEX VERSION")==0) {
-						ft = ftIONEX;
-		// FPPP check
-				} else if (strcmp(aux2,"FPPP VERSION")==0) {
-						ft = ftFPPP;
-		// ANTEX check
-		} else if (strcmp(aux,"ANTEX VERSION")==0) {
-			ft = ftANTEX;
-		// SP3 check
-		} else if (line[0]=='#' &&  ((line[1]>='a' && line[1]<='z') || line[1]==' ') && (line[2]=='P' || line[2]=='V' || line[2]==' ')) {
-			ft = ftSP3;
-		// DCB check
-		} else if (strstr(line,"DCB SOLUTION")!=NULL) {
-				if (strstr(line,"P1-C1")!=NULL) {
-					ft = ftP1C1DCB;
-			} else if (strstr(line,"P1-P2")!=NULL) {
-					 ft = ftP1P2DCB;
-			 } else {
-			  ft = ftGENDCB;
-			 }
-		// GPS Receiver file type
-		} else if (strncmp(line,"#$Id: GPS_Receiver_Types",24)==0) {
-			ft = ftRECEIVERTYPE;
-		// SINEX check
-		} else if (strncmp(line,"%=SNX",5)==0) {
-			ft = ftSINEX;
-		} else {
-			strcpy(line2,line);	//This is to save the first line, it might be needed for checking EMS message
-			res = getL(line,&len,fd); 
-			if (res!=-1) {
-				if (strstr(line,"Navstar GPS Constellation Status")!=NULL) ft = ftConstellation;
+/*****************************************************************************
+ * Name        : storeDecompressedData
+ * Description : Make decompressed data available to the reader of the stream.
+ *               It waits while the decoding is DECOMPRESS_READAHEAD bytes ahead
+ *               of the reading position
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * unsigned char  *data            I  N/A  Decompressed data
+ * int  n                          I  N/A  Number of bytes
+ * Returned value (int)            O  N/A  0 => Data stored
+ *                                         -1 => Error or decoding has to stop
+ *****************************************************************************/
+static int storeDecompressedData (TDecompressStream *st, unsigned char *data, int n) {
+	#if defined (DECOMPRESS_THREAD)
+		long long int	reference;
+		int				block, offset, m;
+	#endif
+
+	if (n<=0) return 0;
+	if (st->fdOut!=NULL) {
+		if ((int)fwrite(data,1,n,st->fdOut)!=n) return -1;
+		return 0;
+	}
+
+	#if defined (DECOMPRESS_THREAD)
+		pthread_mutex_lock(&st->mutex);
+		while (n>0) {
+			while (st->stop==0 && st->toEnd==0 && st->decodedBytes>=st->position+DECOMPRESS_READAHEAD) {
+				pthread_cond_wait(&st->spaceCond,&st->mutex);
+			}
+			if (st->stop==1) {
+				pthread_mutex_unlock(&st->mutex);
+				return -1;
+			}
+			block = (int)(st->decodedBytes/DECOMPRESS_BLOCK_SIZE);
+			offset = (int)(st->decodedBytes%DECOMPRESS_BLOCK_SIZE);
+			if (offset==0) {
+				// Release the blocks far behind the reading position before starting a new one
+				if (st->keepAll==0) {
+					reference = st->decodedBytes;
+					if (st->toEnd==0 && st->position<reference) reference = st->position;
+					while (st->firstBlock<block && (long long int)(st->firstBlock+1)*DECOMPRESS_BLOCK_SIZE+DECOMPRESS_LOOKBEHIND<=reference) {
+						if (st->spareBlock==NULL) st->spareBlock = st->blocks[st->firstBlock];
+						else free(st->blocks[st->firstBlock]);
+						st->blocks[st->firstBlock] = NULL;
+						st->firstBlock++;
+					}
+				}
+				if (block>=st->numBlocks) {
+					st->numBlocks = 2*block+16;
+					st->blocks = realloc(st->blocks,sizeof(unsigned char *)*st->numBlocks);
+					if (st->blocks==NULL) {
+						pthread_mutex_unlock(&st->mutex);
+						return -1;
+					}
+				}
+				if (st->spareBlock!=NULL) {
+					st->blocks[block] = st->spareBlock;
+					st->spareBlock = NULL;
+				} else {
+					st->blocks[block] = malloc(DECOMPRESS_BLOCK_SIZE);
+					if (st->blocks[block]==NULL) {
+						pthread_mutex_unlock(&st->mutex);
+						return -1;
+					}
+				}
 			}
+			m = DECOMPRESS_BLOCK_SIZE-offset;
+			if (m>n) m = n;
+			memcpy(&st->blocks[block][offset],data,m);
+			st->decodedBytes += m;
+			data += m;
+			n -= m;
+			pthread_cond_broadcast(&st->dataCond);
+		}
+		pthread_mutex_unlock(&st->mutex);
+	#endif
+	return 0;
+}
 
-			// SBAS EMS message
-			if(strlen(line2)>85 && line2[0]!='#') ft = ftSBASEMSMESSAGE;
+/*****************************************************************************
+ * Name        : emitDecompressedData
+ * Description : Add decompressed data to the output buffer of the stream
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * unsigned char  *data            I  N/A  Decompressed data
+ * int  n                          I  N/A  Number of bytes
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Error or decoding has to stop
+ *****************************************************************************/
+static int emitDecompressedData (TDecompressStream *st, unsigned char *data, int n) {
+	int		m;
+
+	while (n>0) {
+		if (st->outLen==DECOMPRESS_OUTPUT_BUFFER) {
+			if (storeDecompressedData(st,st->outBuffer,st->outLen)==-1) return -1;
+			st->outLen = 0;
 		}
-		if ( fd != NULL ) fclose(fd);
-		return ft;
+		m = DECOMPRESS_OUTPUT_BUFFER-st->outLen;
+		if (m>n) m = n;
+		memcpy(&st->outBuffer[st->outLen],data,m);
+		st->outLen += m;
+		data += m;
+		n -= m;
 	}
+	return 0;
+}
 
-	if ( fd != NULL ) fclose(fd);
+/*****************************************************************************
+ * Name        : emitCRXLine
+ * Description : Write a RINEX line decoded from Compact RINEX, removing the
+ *               trailing blanks and adding the end of line
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * char  *line                     I  N/A  Line (with space for one more character)
+ * int  len                        I  N/A  Length of the line
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Error or decoding has to stop
+ *****************************************************************************/
+static int emitCRXLine (TDecompressStream *st, char *line, int len) {
+	while (len>0 && line[len-1]==' ') len--;
+	line[len] = '\n';
+	return emitDecompressedData(st,(unsigned char *)line,len+1);
+}
 
-	return ftINVALID;
+/*****************************************************************************
+ * Name        : repairCRXText
+ * Description : Apply a Compact RINEX text difference to a string. In the
+ *               difference, a space means no change and '&' means a space
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *text                     IO N/A  String to be updated
+ * int  textLen                    I  N/A  Length of the string
+ * char  *diff                     I  N/A  Text difference
+ * int  diffLen                    I  N/A  Length of the difference
+ * Returned value (int)            O  N/A  Length of the updated string
+ *****************************************************************************/
+static int repairCRXText (char *text, int textLen, char *diff, int diffLen) {
+	int		i;
+
+	for (i=0;i<diffLen;i++) {
+		if (diff[i]==' ' && i<textLen) continue;
+		if (diff[i]=='&') text[i] = ' ';
+		else text[i] = diff[i];
+	}
+	if (diffLen>textLen) textLen = diffLen;
+	text[textLen] = '\0';
+	return textLen;
 }
 
 /*****************************************************************************
- * Name        : readRinexObsHeader
- * Description : Read a RINEX observation header from a file descriptor
+ * Name        : updateCRXField
+ * Description : Decode a numeric field of Compact RINEX. The field is either
+ *               'N&value' (start of an arc with differences up to order N)
+ *               or the next difference of the arc
  * Parameters  :
  * Name                           |Da|Unit|Description
- * FILE  *fd                       I  N/A  File descriptor for observation file
- * FILE  *fdout                    O  N/A  File descriptor for output observation file (with user added error)
- * TEpoch  *epoch                  O  N/A  Structure to save the data
- * TOptions  *options              I  N/A  TOptions structure
- * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Properly read
- *                                         0 => Error
+ * char  *field                    I  N/A  Field (not null terminated)
+ * int  len                        I  N/A  Length of the field
+ * int  *order                     IO N/A  Order of the last difference (-1 => no arc)
+ * int  *arcOrder                  IO N/A  Maximum order of the differences in the arc
+ * long long int  *diff            IO N/A  Value and differences up to arcOrder
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid field
  *****************************************************************************/
-int readRinexObsHeader (FILE *fd, FILE *fdout, TEpoch *epoch, TOptions *options) {
-	char					line[MAX_INPUT_LINE];
-	char					aux[100];
-	char					*ca;
-	char					**headerlines=NULL;
-	int						numheaderlines=0;
-	int						prevSysObs = 0, actSysObs = 1;
-	int						len = 0;
-	double					rinexVersion;
-	int						properlyRead = 0;
-	int						error = 0;
-	int						readingHeader = 1;
-	int						numLinesTypesofObsr = 0;
-	int						obs,i,j,k;
-	int						auxN;
-	int						cleanedIndex=0;
-	int						ErrorReadingEpochs;
-	int						epochflag;
-	enum MeasurementType	meas;
-	long					posEndHeader;
-	struct stat 			filestat;	//This is to get the file size
-	off_t					filesize;
-	struct tm   			tm;
-	TTime					firstEpoch;
-	TTime					secondEpoch;
-	TTime					lastEpoch;
-	double					seconds;
-	double					interval;
-	double					auxinterval;
-	int						yy=-1,mm=-1,dd=-1,hour=-1,min=-1;
-	static int				firstProgressCheck=1,firstProgressCheckDGNSS=1;
+static int updateCRXField (char *field, int len, int *order, int *arcOrder, long long int *diff) {
+	long long int	value = 0;
+	int				init = 0;
+	int				negative = 0;
+	int				i = 0, k;
+
+	if (len>=2 && field[1]=='&') {
+		if (field[0]<'0' || field[0]>'0'+CRX_MAX_ARC_ORDER) return -1;
+		init = 1;
+		i = 2;
+	} else if (*order<0) return -1;	// Difference without the start of the arc
+
+	if (i<len && field[i]=='-') {
+		negative = 1;
+		i++;
+	}
+	if (i==len || len-i>18) return -1;
+	for (;i<len;i++) {
+		if (field[i]<'0' || field[i]>'9') return -1;
+		value = value*10+(field[i]-'0');
+	}
+	if (negative==1) value = -value;
 
-	while (getL(line,&len,fd)!=-1 && readingHeader) {
-		if (fdout!=NULL && epoch->DGNSSstruct==0) {
-			//Save header lines for creating an output RINEX files with user added error
-			headerlines=realloc(headerlines,sizeof(char *)*(numheaderlines+1));
-			headerlines[numheaderlines]=malloc(sizeof(char)*MAX_INPUT_LINE);
-			strcpy(headerlines[numheaderlines],line);
-			if(headerlines[numheaderlines][len-1]=='\r'||headerlines[numheaderlines][len-1]=='\n') {
-				headerlines[numheaderlines][len-1]='\0';
-			}
-			numheaderlines++;
-		}
-		if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
-			getstr(aux,line,0,9);
-			rinexVersion = atof(aux);
-			if ((int)(rinexVersion)==2) epoch->source = RINEX2;
-			else if ((int)(rinexVersion)==3) epoch->source = RINEX3;
-			else {
-				epoch->source = UNKNOWN_SOURCE;
-				sprintf(aux,"Rinex observation file version %1.2f not supported. Supported versions are 2 and 3",rinexVersion);
-				printError(aux,options);
-			}
-		} else if (strncmp(&line[60],"MARKER NAME",11)==0) {
-			getstr(aux,line,0,60);
-			//Do not copy empty marker name
-			if (aux[0]!='\0') {
-				strcpy(epoch->receiver.name,aux);
-			}
-		} else if (strncmp(&line[60],"ANT # / TYPE",12)==0) {
-			getstr(aux,line,20,20);
-			strcpy(epoch->receiver.antenna.type,aux);
-			// Separate the anntena.type into antenna and radome
-			strcpy(epoch->receiver.antenna.type_ant,epoch->receiver.antenna.type);
-			ca = strstr(epoch->receiver.antenna.type_ant," ");
-			if (ca != NULL) {
-				*ca = '\0';
-				strcpy(epoch->receiver.antenna.type_radome,&ca[1]);
-				trim(epoch->receiver.antenna.type_radome);
-			}
-		} else if (strncmp(&line[60],"REC # / TYPE / VERS",19)==0) {
-			getstr(aux,line,20,20);
-			strcpy(epoch->receiver.type,aux);
-		} else if (strncmp(&line[60],"ANTENNA: DELTA H/E/N",20)==0) {
-			if (options->ARPData == arpRINEX) {
-				getstr(aux,line,0,14);
-				epoch->receiver.ARP[2] = atof(aux);
-				getstr(aux,line,14,14);
-				epoch->receiver.ARP[1] = atof(aux);
-				getstr(aux,line,28,14);
-				epoch->receiver.ARP[0] = atof(aux);
-			}
+	if (init==1) {
+		*arcOrder = field[0]-'0';
+		*order = 0;
+		diff[0] = value;
+	} else {
+		if (*order<*arcOrder) (*order)++;
+		diff[*order] = value;
+		for (k=*order-1;k>=0;k--) diff[k] += diff[k+1];
+	}
+	return 0;
+}
 
-		} else if (strncmp(&line[60],"TIME OF FIRST OBS",17)==0) {
-			getstr(aux,line,22,2);
-			epoch->initialhour=atoi(aux);
-		} else if (strncmp(&line[60],"# / TYPES OF OBSERV",19)==0) {  // Only for RINEX v2.11
-			//      5    L1    L2    P1    P2    C1                        # / TYPES OF OBSERV
-			numLinesTypesofObsr++;
-			getstr(aux,line,0,6);
-			if (numLinesTypesofObsr==1) { // if this is the first line of observations
-				auxN = atoi(aux);
-				epoch->measOrder[GPS].nDiffMeasurements = auxN;
-				epoch->measOrder[GPS].GNSS = GPS;
-				epoch->measOrder[Galileo].nDiffMeasurements = auxN;
-				epoch->measOrder[Galileo].GNSS = Galileo;
-				epoch->measOrder[GEO].nDiffMeasurements = auxN;
-				epoch->measOrder[GEO].GNSS = GEO;
-				epoch->measOrder[GLONASS].nDiffMeasurements = auxN;
-				epoch->measOrder[GLONASS].GNSS = GLONASS;
-				epoch->numGNSS = 4;
-				obs = 0;
-			} 
+/*****************************************************************************
+ * Name        : formatCRXValue
+ * Description : Write an integer number of units of the last decimal as a
+ *               right justified fixed point number (as Fortran F format)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *out                      O  N/A  Output (not null terminated)
+ * long long int  value            I  N/A  Value in units of the last decimal
+ * int  width                      I  N/A  Width of the field
+ * int  decimals                   I  N/A  Number of decimals
+ * Returned value (int)            O  N/A  Number of characters written
+ *****************************************************************************/
+static int formatCRXValue (char *out, long long int value, int width, int decimals) {
+	char					digits[24];
+	unsigned long long int	u;
+	int						n = 0, p = 0, i;
+
+	if (value<0) u = -(unsigned long long int)value;
+	else u = (unsigned long long int)value;
+	do {
+		digits[n++] = (char)('0'+u%10);
+		u /= 10;
+	} while (u>0 || n<decimals);
+	// As in Fortran, a zero integer part is not written (i.e. '-.123')
+	for (i=n+1+(value<0);i<width;i++) out[p++] = ' ';
+	if (value<0) out[p++] = '-';
+	for (i=n-1;i>=0;i--) {
+		if (i==decimals-1) out[p++] = '.';
+		out[p++] = digits[i];
+	}
+	return p;
+}
 
-			//Initialize meas2Ind factor, so previous index are not maintained when reading concatenated files
-			if(cleanedIndex==0) {
-				cleanedIndex=1;
-				for (j=0;j<MAX_GNSS;j++) {
-					for (i=0;i<MAX_MEASUREMENTS;i++) {
-						epoch->measOrder[j].meas2Ind[i] = -1;
-						epoch->measOrder[j].conversionFactor[i] = 0;
-						epoch->measOrder[j].usable[i] = 1;
-					}
-				}
-			}
+/*****************************************************************************
+ * Name        : getCRXSatellite
+ * Description : Get the Compact RINEX data of a satellite from its identifier
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TCRXDecoder  *crx               IO N/A  Compact RINEX decoder
+ * char  *id                       I  N/A  Satellite identifier (three characters)
+ * Returned value (TCRXSatellite*) O  N/A  Satellite data (NULL if the identifier is invalid)
+ *****************************************************************************/
+static TCRXSatellite *getCRXSatellite (TCRXDecoder *crx, char *id) {
+	int				sys, PRN, slot;
+	TCRXSatellite	*sat;
+
+	if ((id[1]!=' ' && (id[1]<'0' || id[1]>'9')) || id[2]<'0' || id[2]>'9') return NULL;
+	sys = id[0]&127;
+	PRN = (id[1]==' '?0:id[1]-'0')*10+id[2]-'0';
+	slot = crx->satSlot[sys][PRN];
+	if (slot==0) {
+		if (crx->numSlots==MAX_SATELLITES_VIEWED) return NULL;
+		slot = ++crx->numSlots;
+		crx->satSlot[sys][PRN] = (short)slot;
+		sat = &crx->sat[slot-1];
+		memcpy(sat->id,id,3);
+		sat->id[3] = '\0';
+		sat->lastEpoch = -1;
+	}
+	return &crx->sat[slot-1];
+}
 
-			obs = 0;
-			for (i=0,j=0;i<auxN;i++,j++) {
-				getstr(aux,line,10+j*6,2);
-				meas = measstr2meastype(aux);
-				if (meas != NA) {
-					// Carrier-phase are stored in cycles instead of metres, as
-					// they are on RINEX files.
-					//    aux[0]=='L'   => Measurement is carrier phase
-					for (k=0;k<epoch->numGNSS;k++) {
-						if (aux[0]=='L') {
-							if (epoch->measOrder[k].GNSS==GPS) {
-								if (aux[1]=='1') epoch->measOrder[k].conversionFactor[meas] = GPSl1;
-								else if (aux[1]=='2') epoch->measOrder[k].conversionFactor[meas] = GPSl2;
-								else if (aux[1]=='5') epoch->measOrder[k].conversionFactor[meas] = GPSl5;
-								else epoch->measOrder[k].conversionFactor[meas] = 1.0; //For the case of frequencies that are not in this constellation
-							} else if (epoch->measOrder[k].GNSS==Galileo) {
-								if (aux[1]=='1') epoch->measOrder[k].conversionFactor[meas] = GALl1;
-								else if (aux[1]=='5') epoch->measOrder[k].conversionFactor[meas] = GALl5a;
-								else if (aux[1]=='7') epoch->measOrder[k].conversionFactor[meas] = GALl5b;
-								else if (aux[1]=='8') epoch->measOrder[k].conversionFactor[meas] = GALl5;
-								else if (aux[1]=='6') epoch->measOrder[k].conversionFactor[meas] = GALl6;
-								else epoch->measOrder[k].conversionFactor[meas] = 1.0;
-							} else if (epoch->measOrder[k].GNSS==GEO) {
-								if (aux[1]=='1') epoch->measOrder[k].conversionFactor[meas] = SBASl1;
-								else if(aux[1]=='5') epoch->measOrder[k].conversionFactor[meas] = SBASl5;
-								else epoch->measOrder[k].conversionFactor[meas] = 1.0; //For the case of frequencies that are not in this constellation
-							} else if (epoch->measOrder[k].GNSS==GLONASS) {
-								//Conversion factor not implented for GLONASS
-								epoch->measOrder[k].conversionFactor[meas] = 1.0; 
-							}
-						} else { // If measurement is not carrier-phase, conversionFactor is 1
-							epoch->measOrder[k].conversionFactor[meas] = 1.0;
-						}
-						// Update dictionaries (if usableFreq is disabled for a specific frequency, the dictionary meas2Ind is avoided)
-						if (options->usableFreq[k][getFrequencyInt(meas)]) {
-							epoch->measOrder[k].usable[meas] = 1;
-						} else {
-							epoch->measOrder[k].usable[meas] = 0;
-						}
-						epoch->measOrder[k].meas2Ind[meas] = obs;
-						epoch->measOrder[k].ind2Meas[obs] = meas;
-					}
+/*****************************************************************************
+ * Name        : decodeCRXEpoch
+ * Description : Decode the epoch line of a Compact RINEX file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * char  *line                     I  N/A  Compact RINEX line
+ * int  len                        I  N/A  Length of the line
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int decodeCRXEpoch (TDecompressStream *st, char *line, int len) {
+	TCRXDecoder		*crx = st->crx;
+	TCRXSatellite	*sat;
+	char			epochLine[MAX_INPUT_LINE+1];
+	int				epochLen;
+	int				satCol, flagCol, numSat, i, j;
+
+	// Epoch lines of Compact RINEX 1 (RINEX 2) start with '&' when they are not differences from
+	// the previous epoch line, and with '>' in Compact RINEX 3
+	satCol = crx->version==1?32:41;
+	flagCol = crx->version==1?28:31;
+	if (line[0]==(crx->version==1?'&':'>')) {
+		memcpy(epochLine,line,len+1);
+		epochLen = len;
+		// All data arcs and flags start again after an initialisation epoch
+		crx->numEpochs++;
+	} else {
+		if (crx->epochLineLen==0) return -1;
+		memcpy(epochLine,crx->epochLine,crx->epochLineLen+1);
+		epochLen = repairCRXText(epochLine,crx->epochLineLen,line,len);
+	}
+	while (epochLen<satCol) epochLine[epochLen++] = ' ';
+	epochLine[epochLen] = '\0';
+	numSat = getIntField(epochLine,epochLen,flagCol+1,3);
+
+	if (epochLine[flagCol]>='2' && epochLine[flagCol]<='5') {
+		// Special event: the epoch line and the following records are copied as they are
+		epochLine[0] = crx->version==1?' ':'>';
+		if (emitCRXLine(st,epochLine,epochLen)==-1) return -1;
+		crx->pendingLines = numSat;
+		crx->state = numSat>0?crxEVENT:crxEPOCH;
+		return 0;
+	}
+
+	if (numSat<0 || numSat>MAX_SATELLITES_VIEWED || epochLen<satCol+3*numSat) return -1;
+	memcpy(crx->epochLine,epochLine,epochLen+1);
+	crx->epochLineLen = epochLen;
+	crx->numEpochs++;
+	for (i=0;i<numSat;i++) {
+		sat = getCRXSatellite(crx,&epochLine[satCol+3*i]);
+		if (sat==NULL) return -1;
+		if (sat->lastEpoch!=crx->numEpochs-1) {
+			// Satellite not present in the previous epoch, all its arcs start again
+			for (j=0;j<MAX_MEASUREMENTS_PER_SATELLITE;j++) sat->order[j] = -1;
+			sat->flags[0] = '\0';
+		}
+		sat->lastEpoch = crx->numEpochs;
+		crx->epochSat[i] = sat;
+	}
+	crx->numSat = numSat;
+	crx->currentSat = 0;
+	crx->state = crxCLOCK;
+	return 0;
+}
+
+/*****************************************************************************
+ * Name        : decodeCRXClock
+ * Description : Decode the receiver clock line of a Compact RINEX file and
+ *               write the RINEX epoch line
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * char  *line                     I  N/A  Compact RINEX line
+ * int  len                        I  N/A  Length of the line
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int decodeCRXClock (TDecompressStream *st, char *line, int len) {
+	TCRXDecoder		*crx = st->crx;
+	char			out[MAX_INPUT_LINE+1];
+	int				pos, i, k;
+
+	if (len==0) crx->clockOrder = -1;
+	else if (updateCRXField(line,len,&crx->clockOrder,&crx->clockArcOrder,crx->clockDiff)==-1) return -1;
+
+	if (crx->rinexVersion==2) {
+		// RINEX 2: up to 12 satellites per line, clock offset (F12.9) at column 68 of the first line
+		memcpy(out,crx->epochLine,32);
+		out[0] = ' ';
+		pos = 32;
+		for (i=0;i<crx->numSat && i<12;i++,pos+=3) memcpy(&out[pos],crx->epochSat[i]->id,3);
+		if (crx->clockOrder>=0) {
+			while (pos<68) out[pos++] = ' ';
+			pos += formatCRXValue(&out[pos],crx->clockDiff[0],12,9);
+		}
+		if (emitCRXLine(st,out,pos)==-1) return -1;
+		for (;i<crx->numSat;) {
+			memset(out,' ',32);
+			pos = 32;
+			for (k=0;k<12 && i<crx->numSat;k++,i++,pos+=3) memcpy(&out[pos],crx->epochSat[i]->id,3);
+			if (emitCRXLine(st,out,pos)==-1) return -1;
+		}
+	} else {
+		// RINEX 3: clock offset (F15.12) at column 41
+		memcpy(out,crx->epochLine,41);
+		out[0] = '>';
+		pos = 41;
+		if (crx->clockOrder>=0) pos += formatCRXValue(&out[pos],crx->clockDiff[0],15,12);
+		if (emitCRXLine(st,out,pos)==-1) return -1;
+	}
+	crx->state = crx->numSat>0?crxDATA:crxEPOCH;
+	return 0;
+}
+
+/*****************************************************************************
+ * Name        : decodeCRXData
+ * Description : Decode the observations of one satellite of a Compact RINEX
+ *               file and write them in RINEX format
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * char  *line                     I  N/A  Compact RINEX line
+ * int  len                        I  N/A  Length of the line
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int decodeCRXData (TDecompressStream *st, char *line, int len) {
+	TCRXDecoder		*crx = st->crx;
+	TCRXSatellite	*sat = crx->epochSat[crx->currentSat];
+	char			out[16*MAX_MEASUREMENTS_PER_SATELLITE+8];
+	int				numTypes, flagsLen;
+	int				p = 0, start, pos, j;
+
+	if (crx->rinexVersion==2) numTypes = crx->numTypes[0];
+	else numTypes = crx->numTypes[sat->id[0]&127];
+
+	// Fields are separated by one space (an empty field is just the space),
+	// the rest of the line is the text difference of the flags
+	for (j=0;j<numTypes;j++) {
+		if (p>=len) {
+			for (;j<numTypes;j++) sat->order[j] = -1;
+			break;
+		}
+		if (line[p]==' ') {
+			sat->order[j] = -1;
+			p++;
+			continue;
+		}
+		start = p;
+		while (p<len && line[p]!=' ') p++;
+		if (updateCRXField(&line[start],p-start,&sat->order[j],&sat->arcOrder[j],sat->diff[j])==-1) return -1;
+		if (p<len) p++;
+	}
+	flagsLen = (int)strlen(sat->flags);
+	if (p<len) {
+		if (len-p>2*MAX_MEASUREMENTS_PER_SATELLITE) return -1;
+		flagsLen = repairCRXText(sat->flags,flagsLen,&line[p],len-p);
+	}
+
+	if (crx->rinexVersion==2) pos = 0;
+	else {
+		memcpy(out,sat->id,3);
+		pos = 3;
+	}
+	for (j=0;j<numTypes;j++) {
+		if (crx->rinexVersion==2 && j>0 && j%5==0) {
+			// RINEX 2: 5 observations per line
+			if (emitCRXLine(st,out,pos)==-1) return -1;
+			pos = 0;
+		}
+		if (sat->order[j]>=0) formatCRXValue(&out[pos],sat->diff[j][0],14,3);
+		else memset(&out[pos],' ',14);
+		out[pos+14] = 2*j<flagsLen?sat->flags[2*j]:' ';
+		out[pos+15] = 2*j+1<flagsLen?sat->flags[2*j+1]:' ';
+		pos += 16;
+	}
+	if (emitCRXLine(st,out,pos)==-1) return -1;
+
+	crx->currentSat++;
+	if (crx->currentSat==crx->numSat) crx->state = crxEPOCH;
+	return 0;
+}
+
+/*****************************************************************************
+ * Name        : readCRXHeaderLine
+ * Description : Read the data needed for decoding Compact RINEX from a RINEX
+ *               header line
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TCRXDecoder  *crx               IO N/A  Compact RINEX decoder
+ * char  *line                     I  N/A  RINEX header line
+ * int  len                        I  N/A  Length of the line
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid or not supported header
+ *****************************************************************************/
+static int readCRXHeaderLine (TCRXDecoder *crx, char *line, int len) {
+	int		n;
+
+	if (len<60+19) return 0;
+	if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
+		crx->rinexVersion = (int)getDoubleField(line,len,0,9);
+		if (crx->rinexVersion!=2 && crx->rinexVersion!=3) return -1;
+	} else if (strncmp(&line[60],"# / TYPES OF OBSERV",19)==0) {
+		// Continuation lines have the number of types blank
+		n = getIntField(line,len,0,6);
+		if (n>MAX_MEASUREMENTS_PER_SATELLITE) return -1;
+		if (n>0) crx->numTypes[0] = n;
+	} else if (strncmp(&line[60],"SYS / # / OBS TYPES",19)==0) {
+		n = getIntField(line,len,3,3);
+		if (n>MAX_MEASUREMENTS_PER_SATELLITE) return -1;
+		if (line[0]!=' ') crx->numTypes[line[0]&127] = n;
+	}
+	return 0;
+}
+
+/*****************************************************************************
+ * Name        : decodeCRXLine
+ * Description : Decode one line of a Compact RINEX (Hatanaka compressed) file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * char  *line                     I  N/A  Compact RINEX line (without end of line)
+ * int  len                        I  N/A  Length of the line
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int decodeCRXLine (TDecompressStream *st, char *line, int len) {
+	TCRXDecoder		*crx = st->crx;
+
+	if (crx->state==crxEPOCH && len>=80 && strncmp(&line[60],"CRINEX VERS   / TYPE",20)==0) {
+		// Start of a (concatenated) file
+		if (line[0]=='1') crx->version = 1;
+		else if (line[0]=='3') crx->version = 3;
+		else return -1;
+		crx->headerLines = 1;
+		crx->inHeader = 0;
+		crx->epochLineLen = 0;
+		memset(crx->numTypes,0,sizeof(crx->numTypes));
+		return 0;
+	}
+	if (crx->headerLines==1) {
+		// 'CRINEX PROG / DATE' line
+		crx->headerLines = 2;
+		crx->inHeader = 1;
+		return 0;
+	}
+	if (crx->inHeader==1) {
+		if (len>=60+13 && strncmp(&line[60],"END OF HEADER",13)==0) {
+			crx->inHeader = 0;
+			crx->state = crxEPOCH;
+		} else if (readCRXHeaderLine(crx,line,len)==-1) return -1;
+		return emitCRXLine(st,line,len);
+	}
+
+	switch (crx->state) {
+		case crxEPOCH:
+			if (len==0) return 0;
+			return decodeCRXEpoch(st,line,len);
+		case crxCLOCK:
+			return decodeCRXClock(st,line,len);
+		case crxDATA:
+			return decodeCRXData(st,line,len);
+		case crxEVENT:
+			// Event records may have header lines changing the observation types
+			crx->pendingLines--;
+			if (crx->pendingLines==0) crx->state = crxEPOCH;
+			if (readCRXHeaderLine(crx,line,len)==-1) return -1;
+			return emitCRXLine(st,line,len);
+	}
+	return -1;
+}
+
+/*****************************************************************************
+ * Name        : processDecompressedLine
+ * Description : Process the line assembled in the line buffer. The first line
+ *               of the file tells whether the file is Compact RINEX
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * int  endOfLine                  I  N/A  1 => The line ended with '\n' (0 at end of file)
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int processDecompressedLine (TDecompressStream *st, int endOfLine) {
+	int		len = st->lineLen;
+
+	st->lineLen = 0;
+	if (st->crxDetect==1) {
+		st->crxDetect = 0;
+		if (len>=80 && strncmp(&st->lineBuffer[60],"CRINEX VERS   / TYPE",20)==0) {
+			if (st->crx->sat==NULL) {
+				st->crx->sat = malloc(sizeof(TCRXSatellite)*MAX_SATELLITES_VIEWED);
+				if (st->crx->sat==NULL) return -1;
+			}
+		} else {
+			// Not Compact RINEX, data is given as it is
+			st->lineBuffer[len] = '\n';
+			return emitDecompressedData(st,(unsigned char *)st->lineBuffer,len+endOfLine);
+		}
+	}
+	if (len>0 && st->lineBuffer[len-1]=='\r') len--;
+	st->lineBuffer[len] = '\0';
+	return decodeCRXLine(st,st->lineBuffer,len);
+}
+
+/*****************************************************************************
+ * Name        : putDecompressedData
+ * Description : Process the data given by the decompressor (gzip, LZW or plain
+ *               file). Compact RINEX is decoded line by line, any other data
+ *               is given as it is
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * unsigned char  *data            I  N/A  Decompressed data
+ * int  n                          I  N/A  Number of bytes
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int putDecompressedData (TDecompressStream *st, unsigned char *data, int n) {
+	int		i, start = 0;
+
+	if (st->crxDetect==0 && st->crx->version==0) return emitDecompressedData(st,data,n);
+
+	for (i=0;i<n;i++) {
+		if (data[i]=='\n') {
+			if (st->lineLen+i-start>=MAX_INPUT_LINE) return -1;
+			memcpy(&st->lineBuffer[st->lineLen],&data[start],i-start);
+			st->lineLen += i-start;
+			start = i+1;
+			if (processDecompressedLine(st,1)==-1) return -1;
+			if (st->crx->version==0) return emitDecompressedData(st,&data[start],n-start);
+		}
+	}
+	if (st->lineLen+n-start>=MAX_INPUT_LINE) {
+		if (st->crxDetect==0) return -1;
+		// First line too long for Compact RINEX
+		st->crxDetect = 0;
+		if (emitDecompressedData(st,(unsigned char *)st->lineBuffer,st->lineLen)==-1) return -1;
+		st->lineLen = 0;
+		return emitDecompressedData(st,&data[start],n-start);
+	}
+	memcpy(&st->lineBuffer[st->lineLen],&data[start],n-start);
+	st->lineLen += n-start;
+	return 0;
+}
+
+/*****************************************************************************
+ * Name        : readCompressedByte
+ * Description : Read one byte of the compressed file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * Returned value (int)            O  N/A  Byte read (0 to 255), -1 at end of file
+ *****************************************************************************/
+static int readCompressedByte (TDecompressStream *st) {
+	if (st->inPos==st->inLen) {
+		st->inLen = (int)fread(st->inBuffer,1,DECOMPRESS_INPUT_BUFFER,st->fdIn);
+		st->inPos = 0;
+		if (st->inLen<=0) {
+			st->inLen = 0;
+			return -1;
+		}
+	}
+	return st->inBuffer[st->inPos++];
+}
+
+/*****************************************************************************
+ * Name        : getBits
+ * Description : Read bits of a DEFLATE stream (first bit in the least
+ *               significant position)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * int  n                          I  N/A  Number of bits (0 to 32)
+ * Returned value (int)            O  N/A  Value read, -1 at end of file
+ *****************************************************************************/
+static long long int getBits (TDecompressStream *st, int n) {
+	long long int	value;
+	int				c;
+
+	while (st->bitCount<n) {
+		if ((c=readCompressedByte(st))==-1) return -1;
+		st->bitBuffer |= (unsigned long long int)c<<st->bitCount;
+		st->bitCount += 8;
+	}
+	value = (long long int)(st->bitBuffer&((1ULL<<n)-1));
+	st->bitBuffer >>= n;
+	st->bitCount -= n;
+	return value;
+}
+
+/*****************************************************************************
+ * Name        : getAlignedByte
+ * Description : Skip the bits up to the next byte boundary and read a byte of
+ *               a DEFLATE stream (used for gzip headers and trailers)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * Returned value (int)            O  N/A  Byte read (0 to 255), -1 at end of file
+ *****************************************************************************/
+static int getAlignedByte (TDecompressStream *st) {
+	st->bitBuffer >>= st->bitCount&7;
+	st->bitCount -= st->bitCount&7;
+	return (int)getBits(st,8);
+}
+
+/*****************************************************************************
+ * Name        : buildHuffman
+ * Description : Build a canonical Huffman code of DEFLATE from its code lengths
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * THuffman  *h                    O  N/A  Huffman code
+ * short  *length                  I  N/A  Code length of each symbol
+ * int  n                          I  N/A  Number of symbols
+ * Returned value (int)            O  N/A  0 => Complete code
+ *                                         >0 => Incomplete code
+ *                                         -1 => Over-subscribed code (invalid)
+ *****************************************************************************/
+static int buildHuffman (THuffman *h, short *length, int n) {
+	short	offset[16];
+	int		left = 1;
+	int		len, sym, code, index, rev, i, k;
+
+	memset(h->count,0,sizeof(h->count));
+	for (sym=0;sym<n;sym++) h->count[length[sym]]++;
+	for (len=1;len<16;len++) {
+		left <<= 1;
+		left -= h->count[len];
+		if (left<0) return -1;
+	}
+	offset[1] = 0;
+	for (len=1;len<15;len++) offset[len+1] = offset[len]+h->count[len];
+	for (sym=0;sym<n;sym++) {
+		if (length[sym]!=0) h->symbol[offset[length[sym]]++] = (short)sym;
+	}
+
+	// Look up table for the short codes (indexed by the next INFLATE_FASTBITS bits of the stream)
+	memset(h->fast,0,sizeof(h->fast));
+	code = 0;
+	index = 0;
+	for (len=1;len<=INFLATE_FASTBITS;len++) {
+		for (i=0;i<h->count[len];i++) {
+			rev = 0;
+			for (k=0;k<len;k++) rev |= ((code>>k)&1)<<(len-1-k);
+			for (k=rev;k<(1<<INFLATE_FASTBITS);k+=1<<len) h->fast[k] = (unsigned short)(h->symbol[index]<<4|len);
+			code++;
+			index++;
+		}
+		code <<= 1;
+	}
+	return left;
+}
+
+/*****************************************************************************
+ * Name        : decodeHuffman
+ * Description : Decode one symbol of a DEFLATE stream
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * THuffman  *h                    I  N/A  Huffman code
+ * Returned value (int)            O  N/A  Symbol decoded, -1 if invalid or at end of file
+ *****************************************************************************/
+static int decodeHuffman (TDecompressStream *st, THuffman *h) {
+	int		entry, code = 0, first = 0, index = 0, count, len, c;
+
+	if (st->bitCount<15) {
+		while (st->bitCount<=56) {
+			if ((c=readCompressedByte(st))==-1) break;
+			st->bitBuffer |= (unsigned long long int)c<<st->bitCount;
+			st->bitCount += 8;
+		}
+	}
+	entry = h->fast[st->bitBuffer&((1<<INFLATE_FASTBITS)-1)];
+	if (entry!=0 && (entry&15)<=st->bitCount) {
+		st->bitBuffer >>= entry&15;
+		st->bitCount -= entry&15;
+		return entry>>4;
+	}
+	// Codes longer than INFLATE_FASTBITS are decoded bit by bit
+	for (len=1;len<16;len++) {
+		if (st->bitCount==0) return -1;
+		code |= (int)(st->bitBuffer&1);
+		st->bitBuffer >>= 1;
+		st->bitCount--;
+		count = h->count[len];
+		if (code-count<first) return h->symbol[index+code-first];
+		index += count;
+		first += count;
+		first <<= 1;
+		code <<= 1;
+	}
+	return -1;
+}
+
+/*****************************************************************************
+ * Name        : inflateData
+ * Description : Decompress a DEFLATE stream (RFC 1951)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int inflateData (TDecompressStream *st) {
+	static const short	lengthBase[29] = {3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258};
+	static const short	lengthExtra[29] = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0};
+	static const short	distBase[30] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
+	static const short	distExtra[30] = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
+	static const short	codeLengthOrder[19] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
+	THuffman			lengthCode, distCode;
+	short				lengths[288+32];
+	unsigned char		*window = st->window;
+	long long int		extra;
+	int					last, type, numLength, numDist, numCodes;
+	int					sym, len, dist, index, rep, n, i;
+	int					pos = 0, flushed = 0;
+
+	do {
+		if ((last=(int)getBits(st,1))==-1) return -1;
+		if ((type=(int)getBits(st,2))==-1) return -1;
+		if (type==0) {
+			// Stored block
+			st->bitBuffer >>= st->bitCount&7;
+			st->bitCount -= st->bitCount&7;
+			if ((len=(int)getBits(st,16))==-1) return -1;
+			if ((n=(int)getBits(st,16))==-1) return -1;
+			if (len!=(~n&0xFFFF)) return -1;
+			for (;len>0;len--) {
+				if ((sym=(int)getBits(st,8))==-1) return -1;
+				window[pos++] = (unsigned char)sym;
+				if (pos==2*INFLATE_WINDOW) {
+					st->crc = updateCRC32(st->crc,&window[flushed],pos-flushed);
+					if (putDecompressedData(st,&window[flushed],pos-flushed)==-1) return -1;
+					memmove(window,&window[INFLATE_WINDOW],INFLATE_WINDOW);
+					pos = flushed = INFLATE_WINDOW;
+				}
+			}
+			continue;
+		} else if (type==1) {
+			// Fixed Huffman codes
+			for (i=0;i<144;i++) lengths[i] = 8;
+			for (;i<256;i++) lengths[i] = 9;
+			for (;i<280;i++) lengths[i] = 7;
+			for (;i<288;i++) lengths[i] = 8;
+			buildHuffman(&lengthCode,lengths,288);
+			for (i=0;i<30;i++) lengths[i] = 5;
+			buildHuffman(&distCode,lengths,30);
+		} else if (type==2) {
+			// Dynamic Huffman codes
+			if ((numLength=(int)getBits(st,5))==-1) return -1;
+			if ((numDist=(int)getBits(st,5))==-1) return -1;
+			if ((numCodes=(int)getBits(st,4))==-1) return -1;
+			numLength += 257;
+			numDist += 1;
+			numCodes += 4;
+			if (numLength>286 || numDist>30) return -1;
+			for (i=0;i<19;i++) lengths[codeLengthOrder[i]] = 0;
+			for (i=0;i<numCodes;i++) {
+				if ((sym=(int)getBits(st,3))==-1) return -1;
+				lengths[codeLengthOrder[i]] = (short)sym;
+			}
+			if (buildHuffman(&lengthCode,lengths,19)!=0) return -1;
+			index = 0;
+			while (index<numLength+numDist) {
+				if ((sym=decodeHuffman(st,&lengthCode))==-1) return -1;
+				if (sym<16) {
+					lengths[index++] = (short)sym;
+					continue;
+				}
+				len = 0;
+				if (sym==16) {
+					if (index==0) return -1;
+					len = lengths[index-1];
+					extra = getBits(st,2);
+					rep = 3+(int)extra;
+				} else if (sym==17) {
+					extra = getBits(st,3);
+					rep = 3+(int)extra;
 				} else {
-					sprintf(messagestr,"Reading RINEX %4.2f file: Unrecognized measurement type: '%s'",rinexVersion,aux);
-					printError(messagestr,options);
-					error = 1;
-				}				
-				obs++;
-				if ((j+1)%9==0 && auxN>(j+1)) { // Following observables are in the next lines (max 9 per line)
-					j=-1; // j will be increased in the for loop
-					if(getL(line,&len,fd)==-1) return 0; //If line fails to read exit function
-					if (fdout!=NULL && epoch->DGNSSstruct==0) {
-						//Save header lines for creating an output RINEX files with user added error
-						headerlines=realloc(headerlines,sizeof(char *)*(numheaderlines+1));
-						headerlines[numheaderlines]=malloc(sizeof(char)*MAX_INPUT_LINE);
-						strcpy(headerlines[numheaderlines],line);
-						if(headerlines[numheaderlines][len-1]=='\r'||headerlines[numheaderlines][len-1]=='\n') {
-							headerlines[numheaderlines][len-1]='\0';
-						}
-						numheaderlines++;
-					}
+					extra = getBits(st,7);
+					rep = 11+(int)extra;
 				}
+				if (extra==-1 || index+rep>numLength+numDist) return -1;
+				while (rep-->0) lengths[index++] = (short)len;
 			}
-		} else if (strncmp(&line[60],"SYS / # / OBS TYPES",19)==0) { // Rinex version 3.00 can have multiple systems
-			// G    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES
-			// E   36 C1B L1B D1B S1B C1C L1C D1C S1C C5I L5I D5I S5I C5Q  SYS / # / OBS TYPES
-			//        L5Q D5Q S5Q C7I L7I D7I S7I C7Q L7Q D7Q S7Q C6A L6A  SYS / # / OBS TYPES
-			//        D6A S6A C6B L6B D6B S6B C6C L6C D6C S6C              SYS / # / OBS TYPES
-			prevSysObs = actSysObs;
-			actSysObs = gnsschar2gnsstype(line[0]); 
-			getstr(aux,line,1,5);
-			if ( actSysObs==BDS || actSysObs==QZSS || actSysObs==IRNSS || ((prevSysObs==BDS || prevSysObs==QZSS || prevSysObs==IRNSS ) && aux[0]=='\0') ) {continue;} //BeiDou, QZSS, IRNSS are not supported
-			//numLinesTypesofObsr++;
-			//if (aux[0]!='\0') { // if this is the first line of a SYS
-			//if (numLinesTypesofObsr==1 || actSysObs!=prevSysObs) { // if this is the first line of a SYS
-			//if (numLinesTypesofObsr==1  ) { // if this is the first line of a SYS
-				//epoch->measOrder[epoch->numGNSS].nDiffMeasurements = atoi(aux);
-				//epoch->measOrder[actSysObs].nDiffMeasurements = atoi(aux);
-				//epoch->measOrder[epoch->numGNSS].GNSS = gnsschar2gnsstype(line[0]);
-				//epoch->measOrder[epoch->numGNSS].GNSS = actSysObs;
-				//epoch->measOrder[actSysObs].GNSS = actSysObs;
-				//epoch->numGNSS++;
-				//obs = 0;
-			//}}}
-			epoch->measOrder[actSysObs].nDiffMeasurements = atoi(aux);
-			epoch->measOrder[actSysObs].GNSS = actSysObs;
-			//epoch->numGNSS++;
-			obs = 0;
-
-		
-			//Initialize meas2Ind factor, so previous index are not maintained when reading concatenated files
-			if(cleanedIndex==0) {
-				cleanedIndex=1;
-				for (j=0;j<MAX_GNSS;j++) {
-					for (i=0;i<MAX_MEASUREMENTS;i++) {
-						epoch->measOrder[j].meas2Ind[i] = -1;
-						epoch->measOrder[j].conversionFactor[i] = 0;
-						epoch->measOrder[j].usable[i] = 1;
-					}
+			if (lengths[256]==0) return -1;
+			if (buildHuffman(&lengthCode,lengths,numLength)<0) return -1;
+			if (buildHuffman(&distCode,&lengths[numLength],numDist)<0) return -1;
+		} else return -1;
+
+		// Compressed data
+		for (;;) {
+			if ((sym=decodeHuffman(st,&lengthCode))==-1) return -1;
+			if (sym<256) {
+				window[pos++] = (unsigned char)sym;
+				if (pos==2*INFLATE_WINDOW) {
+					st->crc = updateCRC32(st->crc,&window[flushed],pos-flushed);
+					if (putDecompressedData(st,&window[flushed],pos-flushed)==-1) return -1;
+					memmove(window,&window[INFLATE_WINDOW],INFLATE_WINDOW);
+					pos = flushed = INFLATE_WINDOW;
+				}
+				continue;
+			}
+			if (sym==256) break;
+			sym -= 257;
+			if (sym>=29) return -1;
+			if ((extra=getBits(st,lengthExtra[sym]))==-1) return -1;
+			len = lengthBase[sym]+(int)extra;
+			if ((sym=decodeHuffman(st,&distCode))==-1 || sym>=30) return -1;
+			if ((extra=getBits(st,distExtra[sym]))==-1) return -1;
+			dist = distBase[sym]+(int)extra;
+			if (dist>pos) return -1;
+			while (len>0) {
+				n = 2*INFLATE_WINDOW-pos;
+				if (n>len) n = len;
+				for (i=0;i<n;i++) window[pos+i] = window[pos-dist+i];
+				pos += n;
+				len -= n;
+				if (pos==2*INFLATE_WINDOW) {
+					st->crc = updateCRC32(st->crc,&window[flushed],pos-flushed);
+					if (putDecompressedData(st,&window[flushed],pos-flushed)==-1) return -1;
+					memmove(window,&window[INFLATE_WINDOW],INFLATE_WINDOW);
+					pos = flushed = INFLATE_WINDOW;
 				}
 			}
+		}
+	} while (last==0);
 
-			for (i=0,j=0;i<epoch->measOrder[actSysObs].nDiffMeasurements;j++,i++) {
-				getstr(aux,line,7+4*j,3);
-				meas = measstr2meastype(aux);
-				if (meas != NA) {
-					// Carrier-phase are stored in cycles instead of metres, as
-					// they are on RINEX files.
-					//    aux[0]=='L'   => Measurement is carrier phase
-					if (aux[0]=='L') {
-						if (epoch->measOrder[actSysObs].GNSS==GPS) {
-							if (aux[1]=='1') epoch->measOrder[actSysObs].conversionFactor[meas] = GPSl1;
-							else if (aux[1]=='2') epoch->measOrder[actSysObs].conversionFactor[meas] = GPSl2;
-							else if (aux[1]=='5') epoch->measOrder[actSysObs].conversionFactor[meas] = GPSl5;
-							else epoch->measOrder[k].conversionFactor[meas] = 1.0;
-						} else if (epoch->measOrder[actSysObs].GNSS==Galileo) {
-							if (aux[1]=='1') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl1;
-							else if (aux[1]=='5') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl5a;
-							else if (aux[1]=='7') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl5b;
-							else if (aux[1]=='8') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl5;
-							else if (aux[1]=='6') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl6;
-							else epoch->measOrder[k].conversionFactor[meas] = 1.0;
-						} else if (epoch->measOrder[actSysObs].GNSS==GEO) {
-							if (aux[1]=='1') epoch->measOrder[actSysObs].conversionFactor[meas] = SBASl1;
-							else if(aux[1]=='5') epoch->measOrder[actSysObs].conversionFactor[meas] = SBASl5;
-							else epoch->measOrder[k].conversionFactor[meas] = 1.0;
-						} else {
-							//Other constellations (GLONASS, BeiDou).
-							//To be done. Now we apply conversion factor of 1
-							epoch->measOrder[actSysObs].conversionFactor[meas] = 1.0;
-						}
-					} else { // If measurement in not carrier-phase, conversionFactor is 1
-						epoch->measOrder[actSysObs].conversionFactor[meas] = 1.0;
-					}
-					// Update dictionaries (if usableFreq is disabled for a specific frequency, the dictionary meas2Ind is avoided)
-					if (options->usableFreq[actSysObs][getFrequencyInt(meas)]) {
-					//if (epoch->measOrder[actSysObs].usableFreq[getFrequencyInt(epoch->measOrder[actSysObs].GNSS,meas)]) {
-						epoch->measOrder[actSysObs].meas2Ind[meas] = obs;
-					}
-					epoch->measOrder[actSysObs].ind2Meas[obs] = meas;
-				} else {
-					sprintf(messagestr,"Reading RINEX %4.2f file: Unrecognized measurement type: '%s'",rinexVersion,aux);
-					printError(messagestr,options);
-					error = 1;
-				}				
-				obs++;
-				if ((j+1)%13==0 && epoch->measOrder[actSysObs].nDiffMeasurements>(j+1)) { // Following observables are in the next lines (max 13 per line)
-					j=-1; // j will be increased in the for loop
-					if(getL(line,&len,fd)==-1) return 0; //If line fails to read exit function
-					if (fdout!=NULL && epoch->DGNSSstruct==0) {
-						//Save header lines for creating an output RINEX files with user added error
-						headerlines=realloc(headerlines,sizeof(char *)*(numheaderlines+1));
-						headerlines[numheaderlines]=malloc(sizeof(char)*MAX_INPUT_LINE);
-						strcpy(headerlines[numheaderlines],line);
-						if(headerlines[numheaderlines][len-1]=='\r'||headerlines[numheaderlines][len-1]=='\n') {
-							headerlines[numheaderlines][len-1]='\0';
-						}
-						numheaderlines++;
-					}
-				}
-			}
-		} else if (strncmp(&line[60],"INTERVAL",8)==0) {
-			getstr(aux,line,0,10);
-			trim(aux);
-			if(atof(aux)>0.) { //In case Interval is 0, ignore the value
-				epoch->receiver.interval = atof(aux); 
-				//Get the number of decimals
-				auxinterval=epoch->receiver.interval-(double)((int)(epoch->receiver.interval+.00005));
-				epoch->receiver.intervalDecimalsFactor=sprintf(aux,"%.4g",auxinterval)-2;
-				epoch->receiver.intervalDecimalsFactor=(int)(pow(10,(double)epoch->receiver.intervalDecimalsFactor));
-                epoch->receiver.DecimateVal=(long long int)((options->decimate+.00005)*(double)(epoch->receiver.intervalDecimalsFactor));
-				if (epoch->receiver.DecimateVal==0) {
-					//This is the case where user set an interval smaller than the number of decimals in the interval
-					//Therefore, set this value to 1, so all epochs are used (and also avoid dividing by 0)
-					epoch->receiver.DecimateVal=1;
-				}
-			}
-			if ( epoch->receiver.interval >= 15.0 ) {
-				if (options->csNcon==1) options->csNconAutoDisabled=1;
-				options->csNcon = 0;
+	st->crc = updateCRC32(st->crc,&window[flushed],pos-flushed);
+	return putDecompressedData(st,&window[flushed],pos-flushed);
+}
+
+/*****************************************************************************
+ * Name        : inflateGzip
+ * Description : Decompress a gzip file (RFC 1952), which may have several
+ *               members (concatenated gzip files)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int inflateGzip (TDecompressStream *st) {
+	unsigned int	crc;
+	int				members = 0;
+	int				flags, c, i, n;
+
+	for (;;) {
+		c = getAlignedByte(st);
+		// Anything after the last member which is not a gzip header is ignored (e.g. padding with zeros)
+		if (members>0 && c!=0x1F) return 0;
+		if (c!=0x1F || getAlignedByte(st)!=0x8B || getAlignedByte(st)!=8) return -1;
+		if ((flags=getAlignedByte(st))==-1) return -1;
+		for (i=0;i<6;i++) {
+			if (getAlignedByte(st)==-1) return -1;
+		}
+		if (flags&4) {
+			// Extra field
+			if ((c=getAlignedByte(st))==-1) return -1;
+			if ((n=getAlignedByte(st))==-1) return -1;
+			for (n=c|n<<8;n>0;n--) {
+				if (getAlignedByte(st)==-1) return -1;
 			}
-		} else if (strncmp(&line[60],"APPROX POSITION XYZ",19)==0) {
-			if (options->receiverPositionSource==rpRINEX || ( ( (options->receiverPositionSource == rpCALCULATERINEX) || (options->receiverPositionSource == rpCALCULATERINEXREF)  ) && epoch->numAproxPosRead==0)) {
-				getstr(aux,line,1,14);
-				epoch->receiver.aproxPosition[0] = atof(aux);
-				getstr(aux,line,14,14);
-				epoch->receiver.aproxPosition[1] = atof(aux);
-				getstr(aux,line,28,14);
-				epoch->receiver.aproxPosition[2] = atof(aux);
-				if (options->receiverPositionSource==rpRINEX) {
-					epoch->receiver.aproxPositionError = 1e4; // 10 Km
-				} else {
-					epoch->receiver.aproxPositionError = 1e6;
-				}
-				epoch->numAproxPosRead++;
-			} else if ( options->receiverPositionSource >= rpRTCMbaseline && options->receiverPositionSource <= rpRTCMRoverUSERREF  ) {
-				getstr(aux,line,1,14);
-				epoch->receiver.aproxPosition[0] = atof(aux);
-				getstr(aux,line,14,14);
-				epoch->receiver.aproxPosition[1] = atof(aux);
-				getstr(aux,line,28,14);
-				epoch->receiver.aproxPosition[2] = atof(aux);
-				epoch->receiver.aproxPositionError = 0.1; // 10 cm
-				epoch->numAproxPosRead++;
+		}
+		if (flags&8) {
+			// Original file name
+			do {
+				if ((c=getAlignedByte(st))==-1) return -1;
+			} while (c!=0);
+		}
+		if (flags&16) {
+			// Comment
+			do {
+				if ((c=getAlignedByte(st))==-1) return -1;
+			} while (c!=0);
+		}
+		if (flags&2) {
+			// Header CRC
+			if (getAlignedByte(st)==-1 || getAlignedByte(st)==-1) return -1;
+		}
+
+		st->crc = 0;
+		if (inflateData(st)==-1) return -1;
+
+		// Trailer: CRC-32 and size of the uncompressed data
+		crc = 0;
+		for (i=0;i<4;i++) {
+			if ((c=getAlignedByte(st))==-1) return -1;
+			crc |= (unsigned int)c<<(8*i);
+		}
+		if (crc!=st->crc) return -1;
+		for (i=0;i<4;i++) {
+			if (getAlignedByte(st)==-1) return -1;
+		}
+		members++;
+	}
+}
+
+/*****************************************************************************
+ * Name        : uncompressLZW
+ * Description : Decompress a file made by the Unix compress program (LZW)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int uncompressLZW (TDecompressStream *st) {
+	unsigned short	*prefix;
+	unsigned char	*suffix, *stack, *out;
+	unsigned char	buffer[LZW_MAXBITS+3];
+	int				flags, maxBits, blockMode, maxMaxCode;
+	int				numBits = 9, maxCode = (1<<9)-1;
+	int				freeEntry, clear = 0;
+	int				offset = 0, size = 0;
+	int				code, inCode, oldCode = -1, finChar = 0;
+	int				sp, outLen = 0, ret = -1;
+	int				c, i;
+
+	if (readCompressedByte(st)!=0x1F || readCompressedByte(st)!=0x9D) return -1;
+	if ((flags=readCompressedByte(st))==-1) return -1;
+	maxBits = flags&0x1F;
+	blockMode = flags&0x80;
+	if (maxBits<9 || maxBits>LZW_MAXBITS) return -1;
+	maxMaxCode = 1<<maxBits;
+	freeEntry = blockMode?257:256;
+
+	prefix = malloc(sizeof(unsigned short)*(1<<LZW_MAXBITS));
+	suffix = malloc(1<<LZW_MAXBITS);
+	stack = malloc(1<<LZW_MAXBITS);
+	out = malloc(DECOMPRESS_OUTPUT_BUFFER+(1<<LZW_MAXBITS));
+	if (prefix==NULL || suffix==NULL || stack==NULL || out==NULL) goto end;
+	for (i=0;i<256;i++) suffix[i] = (unsigned char)i;
+
+	for (;;) {
+		// Codes are read in groups of numBits bytes (8 codes), and the rest of the group is skipped
+		// when the code size changes (as the original compress program does)
+		if (clear==1 || offset>=size || freeEntry>maxCode) {
+			if (freeEntry>maxCode) {
+				numBits++;
+				maxCode = numBits==maxBits?maxMaxCode:(1<<numBits)-1;
 			}
-			if ( ( options->receiverPositionSource == rpRTCMRINEXROVER || options->receiverPositionSource == rpRTCMUserRINEXROVER ) && epoch->DGNSSstruct==0 ) {
-				getstr(aux,line,1,14);
-				epoch->receiver.aproxPositionRover[0] = atof(aux);
-				getstr(aux,line,14,14);
-				epoch->receiver.aproxPositionRover[1] = atof(aux);
-				getstr(aux,line,28,14);
-				epoch->receiver.aproxPositionRover[2] = atof(aux);
+			if (clear==1) {
+				numBits = 9;
+				maxCode = (1<<9)-1;
+				clear = 0;
 			}
-			if(epoch->DGNSSstruct==1) { //This is to avoid reading the rover approx position as reference position
-				if(epoch->receiver.numRecStation==0) {
-					epoch->receiver.RecStationCoord=malloc(sizeof(double*));
-					epoch->receiver.RecStationCoord[0]=malloc(sizeof(double)*3);
-					memcpy(epoch->receiver.RecStationCoord[0],epoch->receiver.aproxPosition,sizeof(double)*3);
-					epoch->receiver.numRecStation++;
-				} else {
-					if(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][0]!=epoch->receiver.aproxPosition[0] 
-						|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][1]!=epoch->receiver.aproxPosition[1]
-						|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][2]!=epoch->receiver.aproxPosition[2]) {
-						//Station coordinates are differents from the previous read
-						epoch->receiver.RecStationCoord=realloc(epoch->receiver.RecStationCoord,sizeof(double*)*(epoch->receiver.numRecStation+1));
-						epoch->receiver.RecStationCoord[epoch->receiver.numRecStation]=malloc(sizeof(double)*3);
-						memcpy(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation],epoch->receiver.aproxPosition,sizeof(double)*3);
-						epoch->receiver.ChangedStaEpoch=realloc(epoch->receiver.ChangedStaEpoch,sizeof(TTime)*epoch->receiver.numRecStation);
-						memcpy(&epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1],&epoch->t,sizeof(TTime));
-						epoch->receiver.numRecStation++;
-					}
-				}
+			memset(buffer,0,sizeof(buffer));
+			for (size=0;size<numBits;size++) {
+				if ((c=readCompressedByte(st))==-1) break;
+				buffer[size] = (unsigned char)c;
 			}
-		} else if ( strncmp(&line[60], "END OF HEADER", 13) == 0 ) {
-			readingHeader = 0;
-			properlyRead = 1;
-			if (fdout!=NULL && epoch->DGNSSstruct==0) {
-				//Add header comment line indicating that user defined error has been added to measurements
-				headerlines=realloc(headerlines,sizeof(char *)*(numheaderlines+1));
-				headerlines[numheaderlines]=malloc(sizeof(char)*MAX_INPUT_LINE);
-				strcpy(headerlines[numheaderlines],headerlines[numheaderlines-1]); //Copy END OF HEADER line to the last line
-				sprintf(headerlines[numheaderlines-1],"%-60sCOMMENT","User defined error added to measurements (with gLAB tool)");
-				numheaderlines++;
+			if (size==0) break;
+			offset = 0;
+			size = (size<<3)-(numBits-1);
+			if (offset>=size) break;
+		}
+		code = (buffer[offset>>3]|buffer[(offset>>3)+1]<<8|buffer[(offset>>3)+2]<<16)>>(offset&7);
+		code &= (1<<numBits)-1;
+		offset += numBits;
+
+		if (oldCode==-1) {
+			// First code is a character
+			if (code>=256) goto end;
+			oldCode = finChar = code;
+			out[outLen++] = (unsigned char)code;
+			continue;
+		}
+		if (code==256 && blockMode) {
+			clear = 1;
+			freeEntry = 256;
+			continue;
+		}
+		inCode = code;
+		sp = 0;
+		if (code>=freeEntry) {
+			if (code>freeEntry) goto end;
+			stack[sp++] = (unsigned char)finChar;
+			code = oldCode;
+		}
+		while (code>=256) {
+			if (sp>=(1<<LZW_MAXBITS)-1) goto end;
+			stack[sp++] = suffix[code];
+			code = prefix[code];
+		}
+		finChar = suffix[code];
+		stack[sp++] = (unsigned char)finChar;
+		while (sp>0) out[outLen++] = stack[--sp];
+		if (outLen>=DECOMPRESS_OUTPUT_BUFFER) {
+			if (putDecompressedData(st,out,outLen)==-1) goto end;
+			outLen = 0;
+		}
+		if (freeEntry<maxMaxCode) {
+			prefix[freeEntry] = (unsigned short)oldCode;
+			suffix[freeEntry] = (unsigned char)finChar;
+			freeEntry++;
+		}
+		oldCode = inCode;
+	}
+	ret = putDecompressedData(st,out,outLen);
+
+end:
+	free(prefix);
+	free(suffix);
+	free(stack);
+	free(out);
+	return ret;
+}
+
+/*****************************************************************************
+ * Name        : runDecompression
+ * Description : Decompress the whole input file from the beginning
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid data or decoding has to stop
+ *****************************************************************************/
+static int runDecompression (TDecompressStream *st) {
+	TCRXDecoder		*crx = st->crx;
+	int				ret = -1;
+	int				n;
+
+	if ((st->fdIn=fopen(st->filename,"rb"))==NULL) return -1;
+	st->inPos = st->inLen = 0;
+	st->bitBuffer = 0;
+	st->bitCount = 0;
+	st->outLen = 0;
+	st->lineLen = 0;
+	st->crxDetect = 1;
+	crx->version = 0;
+	crx->headerLines = 0;
+	crx->inHeader = 0;
+	crx->state = crxEPOCH;
+	crx->numEpochs = 0;
+	crx->epochLineLen = 0;
+	crx->clockOrder = -1;
+	crx->numSlots = 0;
+	memset(crx->numTypes,0,sizeof(crx->numTypes));
+	memset(crx->satSlot,0,sizeof(crx->satSlot));
+
+	switch (st->compression) {
+		case ctGZIP:
+			ret = inflateGzip(st);
+			break;
+		case ctLZW:
+			ret = uncompressLZW(st);
+			break;
+		case ctNONE:
+			ret = 0;
+			while ((n=(int)fread(st->inBuffer,1,DECOMPRESS_INPUT_BUFFER,st->fdIn))>0) {
+				if ((ret=putDecompressedData(st,st->inBuffer,n))==-1) break;
 			}
 			break;
+	}
+	// Last line without end of line
+	if (ret==0 && (st->lineLen>0 || st->crxDetect==1)) {
+		if (st->crxDetect==1 || st->crx->version!=0) ret = processDecompressedLine(st,0);
+	}
+	if (ret==0) {
+		ret = storeDecompressedData(st,st->outBuffer,st->outLen);
+		st->outLen = 0;
+	}
+	fclose(st->fdIn);
+	st->fdIn = NULL;
+	return ret;
+}
+
+/*****************************************************************************
+ * Name        : printDecompressError
+ * Description : Print the error of a compressed file with invalid or truncated
+ *               data and exit. If the options are not available yet, the error
+ *               is printed to stderr
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          I  N/A  Decompression structure
+ *****************************************************************************/
+static void printDecompressError (TDecompressStream *st) {
+	sprintf(messagestr,"Reading compressed file [%s]: invalid or truncated data",st->filename);
+	if (inputFileOptions!=NULL) printError(messagestr,inputFileOptions);
+	fprintf(stderr,"ERROR %s\n",messagestr);
+	exit(-1);
+}
+
+#if defined (DECOMPRESS_THREAD)
+// List of the compressed files open (to find them from the FILE pointer)
+static TDecompressStream	*decompressStreams = NULL;
+static pthread_mutex_t		decompressStreamsMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*****************************************************************************
+ * Name        : decompressThread
+ * Description : Thread decompressing an input file while it is being read
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * void  *arg                      IO N/A  Decompression structure (TDecompressStream)
+ * Returned value (void*)          O  N/A  NULL
+ *****************************************************************************/
+static void *decompressThread (void *arg) {
+	TDecompressStream	*st = (TDecompressStream *)arg;
+	int					ret;
+
+	ret = runDecompression(st);
+	pthread_mutex_lock(&st->mutex);
+	if (ret==-1 && st->stop==0) st->error = 1;
+	st->eof = 1;
+	pthread_cond_broadcast(&st->dataCond);
+	pthread_mutex_unlock(&st->mutex);
+	return NULL;
+}
+
+/*****************************************************************************
+ * Name        : stopDecompressThread
+ * Description : Stop the decompression thread. The mutex of the stream must
+ *               be locked, and it is locked on return
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ *****************************************************************************/
+static void stopDecompressThread (TDecompressStream *st) {
+	int		i;
+
+	st->stop = 1;
+	pthread_cond_broadcast(&st->spaceCond);
+	pthread_mutex_unlock(&st->mutex);
+	pthread_join(st->thread,NULL);
+	pthread_mutex_lock(&st->mutex);
+	for (i=st->firstBlock;i<st->numBlocks;i++) {
+		free(st->blocks[i]);
+		st->blocks[i] = NULL;
+	}
+	free(st->spareBlock);
+	st->spareBlock = NULL;
+	st->firstBlock = 0;
+	st->decodedBytes = 0;
+}
+
+/*****************************************************************************
+ * Name        : restartDecompressThread
+ * Description : Start decompressing again from the beginning of the file, as
+ *               the data at the reading position has already been released.
+ *               After the second restart, the file is being read backwards and
+ *               all data is kept. The mutex of the stream must be locked
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ *****************************************************************************/
+static void restartDecompressThread (TDecompressStream *st) {
+	stopDecompressThread(st);
+	st->restarts++;
+	if (st->restarts>=2) st->keepAll = 1;
+	st->eof = 0;
+	st->error = 0;
+	st->stop = 0;
+	if (pthread_create(&st->thread,NULL,decompressThread,st)!=0) {
+		st->eof = 1;
+		st->error = 1;
+	}
+}
+
+/*****************************************************************************
+ * Name        : decompressToEnd
+ * Description : Wait until the whole file has been decompressed. The mutex of
+ *               the stream must be locked
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TDecompressStream  *st          IO N/A  Decompression structure
+ *****************************************************************************/
+static void decompressToEnd (TDecompressStream *st) {
+	st->toEnd = 1;
+	pthread_cond_broadcast(&st->spaceCond);
+	while (st->eof==0) pthread_cond_wait(&st->dataCond,&st->mutex);
+	st->toEnd = 0;
+}
+
+/*****************************************************************************
+ * Name        : readDecompressStream
+ * Description : Read function of the FILE stream of a compressed file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * void  *cookie                   IO N/A  Decompression structure (TDecompressStream)
+ * char  *buffer                   O  N/A  Buffer to write to
+ * size_t  size                    I  N/A  Size of the buffer
+ * Returned value (ssize_t)        O  N/A  Number of bytes read, 0 at end of file, -1 on error
+ *****************************************************************************/
+static ssize_t readDecompressStream (void *cookie, char *buffer, size_t size) {
+	TDecompressStream	*st = (TDecompressStream *)cookie;
+	long long int		offset;
+	size_t				n;
+
+	pthread_mutex_lock(&st->mutex);
+	if (st->position<(long long int)st->firstBlock*DECOMPRESS_BLOCK_SIZE) restartDecompressThread(st);
+	while (st->position>=st->decodedBytes && st->eof==0) pthread_cond_wait(&st->dataCond,&st->mutex);
+	if (st->position>=st->decodedBytes) {
+		n = st->error==1?(size_t)-1:0;
+		pthread_mutex_unlock(&st->mutex);
+		if (n==(size_t)-1) printDecompressError(st);
+		return (ssize_t)n;
+	}
+	offset = st->position%DECOMPRESS_BLOCK_SIZE;
+	n = DECOMPRESS_BLOCK_SIZE-offset;
+	if ((long long int)n>st->decodedBytes-st->position) n = (size_t)(st->decodedBytes-st->position);
+	if (n>size) n = size;
+	memcpy(buffer,&st->blocks[st->position/DECOMPRESS_BLOCK_SIZE][offset],n);
+	st->position += n;
+	pthread_cond_signal(&st->spaceCond);
+	pthread_mutex_unlock(&st->mutex);
+	return (ssize_t)n;
+}
+
+/*****************************************************************************
+ * Name        : seekDecompressStream
+ * Description : Seek function of the FILE stream of a compressed file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * void  *cookie                   IO N/A  Decompression structure (TDecompressStream)
+ * off64_t  *offset                IO N/A  Offset to seek, new position on return
+ * int  whence                     I  N/A  SEEK_SET, SEEK_CUR or SEEK_END
+ * Returned value (int)            O  N/A  0 => OK
+ *                                         -1 => Invalid position
+ *****************************************************************************/
+static int seekDecompressStream (void *cookie, off64_t *offset, int whence) {
+	TDecompressStream	*st = (TDecompressStream *)cookie;
+	long long int		position;
+
+	pthread_mutex_lock(&st->mutex);
+	if (whence==SEEK_SET) position = *offset;
+	else if (whence==SEEK_CUR) position = st->position+*offset;
+	else {
+		decompressToEnd(st);
+		position = st->decodedBytes+*offset;
+	}
+	if (position<0) {
+		pthread_mutex_unlock(&st->mutex);
+		errno = EINVAL;
+		return -1;
+	}
+	if (position!=st->position) {
+		st->position = position;
+		if (position<(long long int)st->firstBlock*DECOMPRESS_BLOCK_SIZE) restartDecompressThread(st);
+		pthread_cond_signal(&st->spaceCond);
+	}
+	pthread_mutex_unlock(&st->mutex);
+	*offset = position;
+	return 0;
+}
+
+/*****************************************************************************
+ * Name        : closeDecompressStream
+ * Description : Close function of the FILE stream of a compressed file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * void  *cookie                   IO N/A  Decompression structure (TDecompressStream)
+ * Returned value (int)            O  N/A  0
+ *****************************************************************************/
+static int closeDecompressStream (void *cookie) {
+	TDecompressStream	*st = (TDecompressStream *)cookie;
+	TDecompressStream	**prev;
+
+	pthread_mutex_lock(&decompressStreamsMutex);
+	for (prev=&decompressStreams;*prev!=NULL;prev=&(*prev)->next) {
+		if (*prev==st) {
+			*prev = st->next;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&decompressStreamsMutex);
+
+	pthread_mutex_lock(&st->mutex);
+	stopDecompressThread(st);
+	pthread_mutex_unlock(&st->mutex);
+	pthread_mutex_destroy(&st->mutex);
+	pthread_cond_destroy(&st->dataCond);
+	pthread_cond_destroy(&st->spaceCond);
+	free(st->blocks);
+	free(st->window);
+	free(st->crx->sat);
+	free(st->crx);
+	free(st);
+	return 0;
+}
+#endif
+
+/*****************************************************************************
+ * Name        : openInputFile
+ * Description : Open an input file for reading. Files compressed with gzip
+ *               (.gz) or Unix compress (.Z), and Compact RINEX (Hatanaka)
+ *               files, compressed or not, are decompressed while they are
+ *               read, so the readers see the plain text file.
+ *               Decompression is done in a separate thread and the stream
+ *               can be read backwards and positioned as a normal file (the
+ *               size of the file has to be read with getInputFileSize).
+ *               Without threads, the file is decompressed to a temporary
+ *               file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *filename                 I  N/A  Name of the file
+ * Returned value (FILE*)          O  N/A  File stream opened for reading (NULL on error)
+ *****************************************************************************/
+FILE *openInputFile (char *filename) {
+	FILE					*fd;
+	unsigned char			header[80];
+	int						n;
+	enum CompressionType	compression;
+	TDecompressStream		*st;
+	#if defined (DECOMPRESS_THREAD)
+		cookie_io_functions_t	functions = {readDecompressStream,NULL,seekDecompressStream,closeDecompressStream};
+	#endif
+
+	if ((fd=fopen(filename,"rb"))==NULL) return NULL;
+
+	n = (int)fread(header,1,80,fd);
+	if (n>=2 && header[0]==0x1F && header[1]==0x8B) compression = ctGZIP;
+	else if (n>=2 && header[0]==0x1F && header[1]==0x9D) compression = ctLZW;
+	else if (n==80 && strncmp((char *)&header[60],"CRINEX VERS   / TYPE",20)==0) compression = ctNONE;
+	else {
+		fseek(fd,0,SEEK_SET);
+		return fd;
+	}
+	fclose(fd);
+	if (strlen(filename)>=MAX_INPUT_LINE) return NULL;
+
+	initCRC32Table();
+	st = calloc(1,sizeof(TDecompressStream));
+	if (st==NULL) return NULL;
+	strcpy(st->filename,filename);
+	st->compression = compression;
+	st->window = malloc(2*INFLATE_WINDOW);
+	st->crx = calloc(1,sizeof(TCRXDecoder));
+	if (st->window==NULL || st->crx==NULL) {
+		free(st->window);
+		free(st->crx);
+		free(st);
+		return NULL;
+	}
+
+	#if defined (DECOMPRESS_THREAD)
+		pthread_mutex_init(&st->mutex,NULL);
+		pthread_cond_init(&st->dataCond,NULL);
+		pthread_cond_init(&st->spaceCond,NULL);
+		if (pthread_create(&st->thread,NULL,decompressThread,st)!=0) {
+			fd = NULL;
+		} else if ((fd=fopencookie(st,"rb",functions))==NULL) {
+			pthread_mutex_lock(&st->mutex);
+			stopDecompressThread(st);
+			pthread_mutex_unlock(&st->mutex);
+		}
+		if (fd==NULL) {
+			pthread_mutex_destroy(&st->mutex);
+			pthread_cond_destroy(&st->dataCond);
+			pthread_cond_destroy(&st->spaceCond);
+			free(st->blocks);
+			free(st->window);
+			free(st->crx->sat);
+			free(st->crx);
+			free(st);
+			return NULL;
+		}
+		st->fd = fd;
+		pthread_mutex_lock(&decompressStreamsMutex);
+		st->next = decompressStreams;
+		decompressStreams = st;
+		pthread_mutex_unlock(&decompressStreamsMutex);
+	#else
+		fd = tmpfile();
+		if (fd!=NULL) {
+			st->fdOut = fd;
+			if (runDecompression(st)==-1) printDecompressError(st);
+			fseek(fd,0,SEEK_SET);
+		}
+		free(st->window);
+		free(st->crx->sat);
+		free(st->crx);
+		free(st);
+	#endif
+	return fd;
+}
+
+/*****************************************************************************
+ * Name        : getInputFileSize
+ * Description : Get the size of a file opened with openInputFile. For
+ *               compressed files, it is the size of the decompressed data
+ *               (so the whole file is decompressed)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File stream
+ * Returned value (off_t)          O  N/A  Size of the file
+ *****************************************************************************/
+off_t getInputFileSize (FILE *fd) {
+	struct stat			filestat;
+	#if defined (DECOMPRESS_THREAD)
+		TDecompressStream	*st;
+		off_t				size;
+
+		pthread_mutex_lock(&decompressStreamsMutex);
+		for (st=decompressStreams;st!=NULL;st=st->next) {
+			if (st->fd==fd) break;
+		}
+		pthread_mutex_unlock(&decompressStreamsMutex);
+		if (st!=NULL) {
+			pthread_mutex_lock(&st->mutex);
+			decompressToEnd(st);
+			size = (off_t)st->decodedBytes;
+			pthread_mutex_unlock(&st->mutex);
+			return size;
 		}
+	#endif
+
+	if (fstat(fileno(fd),&filestat)!=0) return 0;
+	return filestat.st_size;
+}
+
+/*****************************************************************************
+ * Name        : sleepSeconds
+ * Description : Suspend the execution for a given time
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * double  seconds                 I  s    Time to sleep
+ *****************************************************************************/
+static void sleepSeconds (double seconds) {
+	#if defined (__WIN32__)
+		Sleep((DWORD)(seconds*1000.));
+	#else
+		struct timespec	ts;
+
+		ts.tv_sec = (time_t)seconds;
+		ts.tv_nsec = (long)((seconds-(double)ts.tv_sec)*1E9);
+		nanosleep(&ts,NULL);
+	#endif
+}
+
+/*****************************************************************************
+ * Name        : initFollowFile
+ * Description : Prepare an input file to be read in follow mode (while it is
+ *               being written). In Linux, the file is watched with inotify,
+ *               so a reader waiting for new data is woken up as soon as it is
+ *               written. In other systems, the file is polled
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TFollowFile  *follow            O  N/A  TFollowFile structure
+ * char  *filename                 I  N/A  Name of the file
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Plain file ready to be followed
+ *                                         2 => Compressed file (it is decompressed
+ *                                              when opened, so it can not grow
+ *                                              while it is read)
+ *                                         0 => File not found
+ *****************************************************************************/
+int initFollowFile (TFollowFile *follow, char *filename) {
+	FILE			*fd;
+	unsigned char	header[80];
+	int				n;
+	struct stat		filestat;
+
+	strcpy(follow->filename,filename);
+	follow->type = ftUNKNOWN;
+	follow->watchfd = -1;
+	follow->availableTime = 0.;
+
+	if (stat(filename,&filestat)!=0) return 0;
+	follow->size = follow->loadedSize = (long)filestat.st_size;
+	follow->mtime = follow->loadedMtime = (long)filestat.st_mtime;
+
+	#if defined (__linux__)
+		follow->watchfd = inotify_init1(IN_NONBLOCK|IN_CLOEXEC);
+		if (follow->watchfd!=-1 && inotify_add_watch(follow->watchfd,filename,IN_MODIFY|IN_CLOSE_WRITE|IN_ATTRIB|IN_MOVE_SELF|IN_DELETE_SELF)==-1) {
+			close(follow->watchfd);
+			follow->watchfd = -1;
+		}
+	#endif
+
+	if ((fd=fopen(filename,"rb"))==NULL) return 0;
+	n = (int)fread(header,1,80,fd);
+	fclose(fd);
+	if (n>=2 && header[0]==0x1F && (header[1]==0x8B || header[1]==0x9D)) return 2;
+	if (n==80 && strncmp((char *)&header[60],"CRINEX VERS   / TYPE",20)==0) return 2;
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : closeFollowFile
+ * Description : Stop watching a file read in follow mode
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TFollowFile  *follow            IO N/A  TFollowFile structure
+ *****************************************************************************/
+void closeFollowFile (TFollowFile *follow) {
+	#if defined (__linux__)
+		if (follow->watchfd!=-1) close(follow->watchfd);
+	#endif
+	follow->watchfd = -1;
+}
+
+/*****************************************************************************
+ * Name        : waitFollowFile
+ * Description : Wait until a file read in follow mode is modified. If the file
+ *               is not watched with inotify, it just waits FOLLOWPOLLINTERVAL
+ *               seconds, so the caller checks the file again
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TFollowFile  *follow            I  N/A  TFollowFile structure
+ * double  maxWait                 I  s    Maximum time to wait
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => File modified (or polling interval elapsed)
+ *                                         0 => Maximum time elapsed without changes
+ *****************************************************************************/
+int waitFollowFile (TFollowFile *follow, double maxWait) {
+	#if defined (__linux__)
+		struct pollfd	pfd;
+		char			buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+	#endif
+
+	if (maxWait<=0.) return 0;
+
+	#if defined (__linux__)
+		if (follow->watchfd!=-1) {
+			pfd.fd = follow->watchfd;
+			pfd.events = POLLIN;
+			if (poll(&pfd,1,(int)(maxWait*1000.)+1)<=0) return 0;
+			//Discard the pending events, the caller checks the file contents
+			while (read(follow->watchfd,buffer,sizeof(buffer))>0);
+			return 1;
+		}
+	#endif
+
+	sleepSeconds(min(maxWait,FOLLOWPOLLINTERVAL));
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : isFollowFileUpdated
+ * Description : Check if a file read in follow mode (products files) has
+ *               changed since it was last read. The file is only reported
+ *               once its size and modification time are the same as in the
+ *               previous check, so a file still being written is not read
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TFollowFile  *follow            IO N/A  TFollowFile structure
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => File updated (it has to be read again)
+ *                                         0 => File not changed or being written
+ *****************************************************************************/
+int isFollowFileUpdated (TFollowFile *follow) {
+	struct stat	filestat;
+	long		size,mtime;
+	int			updated = 0;
+
+	if (stat(follow->filename,&filestat)!=0) return 0;
+	size = (long)filestat.st_size;
+	mtime = (long)filestat.st_mtime;
+
+	if ((size!=follow->loadedSize || mtime!=follow->loadedMtime) && size==follow->size && mtime==follow->mtime && size>0) {
+		follow->loadedSize = size;
+		follow->loadedMtime = mtime;
+		updated = 1;
+	}
+	follow->size = size;
+	follow->mtime = mtime;
+
+	return updated;
+}
+
+/*****************************************************************************
+ * Name        : whatFileTypeIs
+ * Description : Identifies the file type
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *filename                 I  N/A  Name of the file
+ * Returned value (fileType)       O  N/A  Type of file
+ *****************************************************************************/
+enum fileType whatFileTypeIs (char *filename) {
+	FILE			*fd = NULL;
+	char			line[MAX_INPUT_LINE];
+	char			line2[MAX_INPUT_LINE];
+	int				len = 0;
+	int				res;
+	char			aux[100];
+	char			aux2[100];
+	enum fileType	ft;
+
+	ft = ftUNKNOWN;	// Default value
+
+	fd = openInputFile(filename);
+	
+	if (fd==NULL) return ft;
+	
+	res = getL(line,&len,fd); 
+	
+	if (res!=-1) {
+		getstr(aux,line,60,13);
+		getstr(aux2,line,60,12);
+		// RINEX check
+		if (strcmp(aux,"RINEX VERSION")==0) {
+			getstr(aux,line,20,11);
+			if (strncmp(aux,"O",1)==0) ft = ftRINEXobservation;
+			else if (strncmp(aux,"N",1)==0) ft = ftRINEXbroadcast;
+			else if (strncmp(aux,"H",1)==0) ft = ftRINEXbroadcast; // Rinex v2 GEO nav data
+			else if (strncmp(aux,"G",1)==0) ft = ftRINEXbroadcast; // Rinex v2 GLONASS nav data
+			else if (strncmp(aux,"C",1)==0) ft = ftRINEXclocks;
+			else if (strncmp(aux,"B",1)==0) ft = ftRINEXB;
+			
+		// IONEX check
+		} else if (strcmp(aux,"IONEX VERSION")==0) {
+						ft = ftIONEX;
+		// FPPP check
+				} else if (strcmp(aux2,"FPPP VERSION")==0) {
+						ft = ftFPPP;
+		// ANTEX check
+		} else if (strcmp(aux,"ANTEX VERSION")==0) {
+			ft = ftANTEX;
+		// SP3 check
+		} else if (line[0]=='#' &&  ((line[1]>='a' && line[1]<='z') || line[1]==' ') && (line[2]=='P' || line[2]=='V' || line[2]==' ')) {
+			ft = ftSP3;
+		// DCB check
+		} else if (strstr(line,"DCB SOLUTION")!=NULL) {
+				if (strstr(line,"P1-C1")!=NULL) {
+					ft = ftP1C1DCB;
+			} else if (strstr(line,"P1-P2")!=NULL) {
+					 ft = ftP1P2DCB;
+			 } else {
+			  ft = ftGENDCB;
+			 }
+		// GPS Receiver file type
+		} else if (strncmp(line,"#$Id: GPS_Receiver_Types",24)==0) {
+			ft = ftRECEIVERTYPE;
+		// SINEX check
+		} else if (strncmp(line,"%=SNX",5)==0) {
+			ft = ftSINEX;
+		} else {
+			strcpy(line2,line);	//This is to save the first line, it might be needed for checking EMS message
+			res = getL(line,&len,fd); 
+			if (res!=-1) {
+				if (strstr(line,"Navstar GPS Constellation Status")!=NULL) ft = ftConstellation;
+			}
+
+			// SBAS EMS message
+			if(strlen(line2)>85 && line2[0]!='#') ft = ftSBASEMSMESSAGE;
+		}
+		if ( fd != NULL ) fclose(fd);
+		return ft;
+	}
+
+	if ( fd != NULL ) fclose(fd);
+
+	return ftINVALID;
+}
+
+/*****************************************************************************
+ * Name        : readRinexObsHeader
+ * Description : Read a RINEX observation header from a file descriptor
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor for observation file
+ * FILE  *fdout                    O  N/A  File descriptor for output observation file (with user added error)
+ * TEpoch  *epoch                  O  N/A  Structure to save the data
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Properly read
+ *                                         0 => Error
+ *****************************************************************************/
+int readRinexObsHeader (FILE *fd, FILE *fdout, TEpoch *epoch, TOptions *options) {
+	char					line[MAX_INPUT_LINE];
+	char					aux[100];
+	char					*ca;
+	char					**headerlines=NULL;
+	int						numheaderlines=0;
+	int						prevSysObs = 0, actSysObs = 1;
+	int						len = 0;
+	double					rinexVersion;
+	int						properlyRead = 0;
+	int						error = 0;
+	int						readingHeader = 1;
+	int						numLinesTypesofObsr = 0;
+	int						obs,i,j,k;
+	int						auxN;
+	int						cleanedIndex=0;
+	int						ErrorReadingEpochs;
+	int						epochflag;
+	enum MeasurementType	meas;
+	long					posEndHeader;
+	off_t					filesize;
+	struct tm   			tm;
+	TTime					firstEpoch;
+	TTime					secondEpoch;
+	TTime					lastEpoch;
+	double					seconds;
+	double					interval;
+	double					auxinterval;
+	int						yy=-1,mm=-1,dd=-1,hour=-1,min=-1;
+	static int				firstProgressCheck=1,firstProgressCheckDGNSS=1;
+
+	while (getL(line,&len,fd)!=-1 && readingHeader) {
+		if (fdout!=NULL && epoch->DGNSSstruct==0) {
+			//Save header lines for creating an output RINEX files with user added error
+			headerlines=realloc(headerlines,sizeof(char *)*(numheaderlines+1));
+			headerlines[numheaderlines]=malloc(sizeof(char)*MAX_INPUT_LINE);
+			strcpy(headerlines[numheaderlines],line);
+			if(headerlines[numheaderlines][len-1]=='\r'||headerlines[numheaderlines][len-1]=='\n') {
+				headerlines[numheaderlines][len-1]='\0';
+			}
+			numheaderlines++;
+		}
+		if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
+			getstr(aux,line,0,9);
+			rinexVersion = atof(aux);
+			if ((int)(rinexVersion)==2) epoch->source = RINEX2;
+			else if ((int)(rinexVersion)==3) epoch->source = RINEX3;
+			else {
+				epoch->source = UNKNOWN_SOURCE;
+				sprintf(aux,"Rinex observation file version %1.2f not supported. Supported versions are 2 and 3",rinexVersion);
+				printError(aux,options);
+			}
+		} else if (strncmp(&line[60],"MARKER NAME",11)==0) {
+			getstr(aux,line,0,60);
+			//Do not copy empty marker name
+			if (aux[0]!='\0') {
+				strcpy(epoch->receiver.name,aux);
+			}
+		} else if (strncmp(&line[60],"ANT # / TYPE",12)==0) {
+			getstr(aux,line,20,20);
+			strcpy(epoch->receiver.antenna.type,aux);
+			// Separate the anntena.type into antenna and radome
+			strcpy(epoch->receiver.antenna.type_ant,epoch->receiver.antenna.type);
+			ca = strstr(epoch->receiver.antenna.type_ant," ");
+			if (ca != NULL) {
+				*ca = '\0';
+				strcpy(epoch->receiver.antenna.type_radome,&ca[1]);
+				trim(epoch->receiver.antenna.type_radome);
+			}
+		} else if (strncmp(&line[60],"REC # / TYPE / VERS",19)==0) {
+			getstr(aux,line,20,20);
+			strcpy(epoch->receiver.type,aux);
+		} else if (strncmp(&line[60],"ANTENNA: DELTA H/E/N",20)==0) {
+			if (options->ARPData == arpRINEX) {
+				getstr(aux,line,0,14);
+				epoch->receiver.ARP[2] = atof(aux);
+				getstr(aux,line,14,14);
+				epoch->receiver.ARP[1] = atof(aux);
+				getstr(aux,line,28,14);
+				epoch->receiver.ARP[0] = atof(aux);
+			}
+
+		} else if (strncmp(&line[60],"TIME OF FIRST OBS",17)==0) {
+			getstr(aux,line,22,2);
+			epoch->initialhour=atoi(aux);
+		} else if (strncmp(&line[60],"# / TYPES OF OBSERV",19)==0) {  // Only for RINEX v2.11
+			//      5    L1    L2    P1    P2    C1                        # / TYPES OF OBSERV
+			numLinesTypesofObsr++;
+			getstr(aux,line,0,6);
+			if (numLinesTypesofObsr==1) { // if this is the first line of observations
+				auxN = atoi(aux);
+				epoch->measOrder[GPS].nDiffMeasurements = auxN;
+				epoch->measOrder[GPS].GNSS = GPS;
+				epoch->measOrder[Galileo].nDiffMeasurements = auxN;
+				epoch->measOrder[Galileo].GNSS = Galileo;
+				epoch->measOrder[GEO].nDiffMeasurements = auxN;
+				epoch->measOrder[GEO].GNSS = GEO;
+				epoch->measOrder[GLONASS].nDiffMeasurements = auxN;
+				epoch->measOrder[GLONASS].GNSS = GLONASS;
+				epoch->numGNSS = 4;
+				obs = 0;
+			} 
+
+			//Initialize meas2Ind factor, so previous index are not maintained when reading concatenated files
+			if(cleanedIndex==0) {
+				cleanedIndex=1;
+				for (j=0;j<MAX_GNSS;j++) {
+					for (i=0;i<MAX_MEASUREMENTS;i++) {
+						epoch->measOrder[j].meas2Ind[i] = -1;
+						epoch->measOrder[j].conversionFactor[i] = 0;
+						epoch->measOrder[j].usable[i] = 1;
+					}
+				}
+			}
+
+			obs = 0;
+			for (i=0,j=0;i<auxN;i++,j++) {
+				getstr(aux,line,10+j*6,2);
+				meas = measstr2meastype(aux);
+				if (meas != NA) {
+					// Carrier-phase are stored in cycles instead of metres, as
+					// they are on RINEX files.
+					//    aux[0]=='L'   => Measurement is carrier phase
+					for (k=0;k<epoch->numGNSS;k++) {
+						if (aux[0]=='L') {
+							if (epoch->measOrder[k].GNSS==GPS) {
+								if (aux[1]=='1') epoch->measOrder[k].conversionFactor[meas] = GPSl1;
+								else if (aux[1]=='2') epoch->measOrder[k].conversionFactor[meas] = GPSl2;
+								else if (aux[1]=='5') epoch->measOrder[k].conversionFactor[meas] = GPSl5;
+								else epoch->measOrder[k].conversionFactor[meas] = 1.0; //For the case of frequencies that are not in this constellation
+							} else if (epoch->measOrder[k].GNSS==Galileo) {
+								if (aux[1]=='1') epoch->measOrder[k].conversionFactor[meas] = GALl1;
+								else if (aux[1]=='5') epoch->measOrder[k].conversionFactor[meas] = GALl5a;
+								else if (aux[1]=='7') epoch->measOrder[k].conversionFactor[meas] = GALl5b;
+								else if (aux[1]=='8') epoch->measOrder[k].conversionFactor[meas] = GALl5;
+								else if (aux[1]=='6') epoch->measOrder[k].conversionFactor[meas] = GALl6;
+								else epoch->measOrder[k].conversionFactor[meas] = 1.0;
+							} else if (epoch->measOrder[k].GNSS==GEO) {
+								if (aux[1]=='1') epoch->measOrder[k].conversionFactor[meas] = SBASl1;
+								else if(aux[1]=='5') epoch->measOrder[k].conversionFactor[meas] = SBASl5;
+								else epoch->measOrder[k].conversionFactor[meas] = 1.0; //For the case of frequencies that are not in this constellation
+							} else if (epoch->measOrder[k].GNSS==GLONASS) {
+								//Conversion factor not implented for GLONASS
+								epoch->measOrder[k].conversionFactor[meas] = 1.0; 
+							}
+						} else { // If measurement is not carrier-phase, conversionFactor is 1
+							epoch->measOrder[k].conversionFactor[meas] = 1.0;
+						}
+						// Update dictionaries (if usableFreq is disabled for a specific frequency, the dictionary meas2Ind is avoided)
+						if (options->usableFreq[k][getFrequencyInt(meas)]) {
+							epoch->measOrder[k].usable[meas] = 1;
+						} else {
+							epoch->measOrder[k].usable[meas] = 0;
+						}
+						epoch->measOrder[k].meas2Ind[meas] = obs;
+						epoch->measOrder[k].ind2Meas[obs] = meas;
+					}
+				} else {
+					sprintf(messagestr,"Reading RINEX %4.2f file: Unrecognized measurement type: '%s'",rinexVersion,aux);
+					printError(messagestr,options);
+					error = 1;
+				}				
+				obs++;
+				if ((j+1)%9==0 && auxN>(j+1)) { // Following observables are in the next lines (max 9 per line)
+					j=-1; // j will be increased in the for loop
+					if(getL(line,&len,fd)==-1) return 0; //If line fails to read exit function
+					if (fdout!=NULL && epoch->DGNSSstruct==0) {
+						//Save header lines for creating an output RINEX files with user added error
+						headerlines=realloc(headerlines,sizeof(char *)*(numheaderlines+1));
+						headerlines[numheaderlines]=malloc(sizeof(char)*MAX_INPUT_LINE);
+						strcpy(headerlines[numheaderlines],line);
+						if(headerlines[numheaderlines][len-1]=='\r'||headerlines[numheaderlines][len-1]=='\n') {
+							headerlines[numheaderlines][len-1]='\0';
+						}
+						numheaderlines++;
+					}
+				}
+			}
+		} else if (strncmp(&line[60],"SYS / # / OBS TYPES",19)==0) { // Rinex version 3.00 can have multiple systems
+			// G    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES
+			// E   36 C1B L1B D1B S1B C1C L1C D1C S1C C5I L5I D5I S5I C5Q  SYS / # / OBS TYPES
+			//        L5Q D5Q S5Q C7I L7I D7I S7I C7Q L7Q D7Q S7Q C6A L6A  SYS / # / OBS TYPES
+			//        D6A S6A C6B L6B D6B S6B C6C L6C D6C S6C              SYS / # / OBS TYPES
+			prevSysObs = actSysObs;
+			actSysObs = gnsschar2gnsstype(line[0]); 
+			getstr(aux,line,1,5);
+			if ( actSysObs==BDS || actSysObs==QZSS || actSysObs==IRNSS || ((prevSysObs==BDS || prevSysObs==QZSS || prevSysObs==IRNSS ) && aux[0]=='\0') ) {continue;} //BeiDou, QZSS, IRNSS are not supported
+			//numLinesTypesofObsr++;
+			//if (aux[0]!='\0') { // if this is the first line of a SYS
+			//if (numLinesTypesofObsr==1 || actSysObs!=prevSysObs) { // if this is the first line of a SYS
+			//if (numLinesTypesofObsr==1  ) { // if this is the first line of a SYS
+				//epoch->measOrder[epoch->numGNSS].nDiffMeasurements = atoi(aux);
+				//epoch->measOrder[actSysObs].nDiffMeasurements = atoi(aux);
+				//epoch->measOrder[epoch->numGNSS].GNSS = gnsschar2gnsstype(line[0]);
+				//epoch->measOrder[epoch->numGNSS].GNSS = actSysObs;
+				//epoch->measOrder[actSysObs].GNSS = actSysObs;
+				//epoch->numGNSS++;
+				//obs = 0;
+			//}}}
+			epoch->measOrder[actSysObs].nDiffMeasurements = atoi(aux);
+			epoch->measOrder[actSysObs].GNSS = actSysObs;
+			//epoch->numGNSS++;
+			obs = 0;
+
+		
+			//Initialize meas2Ind factor, so previous index are not maintained when reading concatenated files
+			if(cleanedIndex==0) {
+				cleanedIndex=1;
+				for (j=0;j<MAX_GNSS;j++) {
+					for (i=0;i<MAX_MEASUREMENTS;i++) {
+						epoch->measOrder[j].meas2Ind[i] = -1;
+						epoch->measOrder[j].conversionFactor[i] = 0;
+						epoch->measOrder[j].usable[i] = 1;
+					}
+				}
+			}
+
+			for (i=0,j=0;i<epoch->measOrder[actSysObs].nDiffMeasurements;j++,i++) {
+				getstr(aux,line,7+4*j,3);
+				meas = measstr2meastype(aux);
+				if (meas != NA) {
+					// Carrier-phase are stored in cycles instead of metres, as
+					// they are on RINEX files.
+					//    aux[0]=='L'   => Measurement is carrier phase
+					if (aux[0]=='L') {
+						if (epoch->measOrder[actSysObs].GNSS==GPS) {
+							if (aux[1]=='1') epoch->measOrder[actSysObs].conversionFactor[meas] = GPSl1;
+							else if (aux[1]=='2') epoch->measOrder[actSysObs].conversionFactor[meas] = GPSl2;
+							else if (aux[1]=='5') epoch->measOrder[actSysObs].conversionFactor[meas] = GPSl5;
+							else epoch->measOrder[k].conversionFactor[meas] = 1.0;
+						} else if (epoch->measOrder[actSysObs].GNSS==Galileo) {
+							if (aux[1]=='1') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl1;
+							else if (aux[1]=='5') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl5a;
+							else if (aux[1]=='7') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl5b;
+							else if (aux[1]=='8') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl5;
+							else if (aux[1]=='6') epoch->measOrder[actSysObs].conversionFactor[meas] = GALl6;
+							else epoch->measOrder[k].conversionFactor[meas] = 1.0;
+						} else if (epoch->measOrder[actSysObs].GNSS==GEO) {
+							if (aux[1]=='1') epoch->measOrder[actSysObs].conversionFactor[meas] = SBASl1;
+							else if(aux[1]=='5') epoch->measOrder[actSysObs].conversionFactor[meas] = SBASl5;
+							else epoch->measOrder[k].conversionFactor[meas] = 1.0;
+						} else {
+							//Other constellations (GLONASS, BeiDou).
+							//To be done. Now we apply conversion factor of 1
+							epoch->measOrder[actSysObs].conversionFactor[meas] = 1.0;
+						}
+					} else { // If measurement in not carrier-phase, conversionFactor is 1
+						epoch->measOrder[actSysObs].conversionFactor[meas] = 1.0;
+					}
+					// Update dictionaries (if usableFreq is disabled for a specific frequency, the dictionary meas2Ind is avoided)
+					if (options->usableFreq[actSysObs][getFrequencyInt(meas)]) {
+					//if (epoch->measOrder[actSysObs].usableFreq[getFrequencyInt(epoch->measOrder[actSysObs].GNSS,meas)]) {
+						epoch->measOrder[actSysObs].meas2Ind[meas] = obs;
+					}
+					epoch->measOrder[actSysObs].ind2Meas[obs] = meas;
+				} else {
+					sprintf(messagestr,"Reading RINEX %4.2f file: Unrecognized measurement type: '%s'",rinexVersion,aux);
+					printError(messagestr,options);
+					error = 1;
+				}				
+				obs++;
+				if ((j+1)%13==0 && epoch->measOrder[actSysObs].nDiffMeasurements>(j+1)) { // Following observables are in the next lines (max 13 per line)
+					j=-1; // j will be increased in the for loop
+					if(getL(line,&len,fd)==-1) return 0; //If line fails to read exit function
+					if (fdout!=NULL && epoch->DGNSSstruct==0) {
+						//Save header lines for creating an output RINEX files with user added error
+						headerlines=realloc(headerlines,sizeof(char *)*(numheaderlines+1));
+						headerlines[numheaderlines]=malloc(sizeof(char)*MAX_INPUT_LINE);
+						strcpy(headerlines[numheaderlines],line);
+						if(headerlines[numheaderlines][len-1]=='\r'||headerlines[numheaderlines][len-1]=='\n') {
+							headerlines[numheaderlines][len-1]='\0';
+						}
+						numheaderlines++;
+					}
+				}
+			}
+		} else if (strncmp(&line[60],"INTERVAL",8)==0) {
+			getstr(aux,line,0,10);
+			trim(aux);
+			if(atof(aux)>0.) { //In case Interval is 0, ignore the value
+				epoch->receiver.interval = atof(aux); 
+				//Get the number of decimals
+				auxinterval=epoch->receiver.interval-(double)((int)(epoch->receiver.interval+.00005));
+				epoch->receiver.intervalDecimalsFactor=sprintf(aux,"%.4g",auxinterval)-2;
+				epoch->receiver.intervalDecimalsFactor=(int)(pow(10,(double)epoch->receiver.intervalDecimalsFactor));
+                epoch->receiver.DecimateVal=(long long int)((options->decimate+.00005)*(double)(epoch->receiver.intervalDecimalsFactor));
+				if (epoch->receiver.DecimateVal==0) {
+					//This is the case where user set an interval smaller than the number of decimals in the interval
+					//Therefore, set this value to 1, so all epochs are used (and also avoid dividing by 0)
+					epoch->receiver.DecimateVal=1;
+				}
+			}
+			if ( epoch->receiver.interval >= 15.0 ) {
+				if (options->csNcon==1) options->csNconAutoDisabled=1;
+				options->csNcon = 0;
+			}
+		} else if (strncmp(&line[60],"APPROX POSITION XYZ",19)==0) {
+			if (options->receiverPositionSource==rpRINEX || ( ( (options->receiverPositionSource == rpCALCULATERINEX) || (options->receiverPositionSource == rpCALCULATERINEXREF)  ) && epoch->numAproxPosRead==0)) {
+				getstr(aux,line,1,14);
+				epoch->receiver.aproxPosition[0] = atof(aux);
+				getstr(aux,line,14,14);
+				epoch->receiver.aproxPosition[1] = atof(aux);
+				getstr(aux,line,28,14);
+				epoch->receiver.aproxPosition[2] = atof(aux);
+				if (options->receiverPositionSource==rpRINEX) {
+					epoch->receiver.aproxPositionError = 1e4; // 10 Km
+				} else {
+					epoch->receiver.aproxPositionError = 1e6;
+				}
+				epoch->numAproxPosRead++;
+			} else if ( options->receiverPositionSource >= rpRTCMbaseline && options->receiverPositionSource <= rpRTCMRoverUSERREF  ) {
+				getstr(aux,line,1,14);
+				epoch->receiver.aproxPosition[0] = atof(aux);
+				getstr(aux,line,14,14);
+				epoch->receiver.aproxPosition[1] = atof(aux);
+				getstr(aux,line,28,14);
+				epoch->receiver.aproxPosition[2] = atof(aux);
+				epoch->receiver.aproxPositionError = 0.1; // 10 cm
+				epoch->numAproxPosRead++;
+			}
+			if ( ( options->receiverPositionSource == rpRTCMRINEXROVER || options->receiverPositionSource == rpRTCMUserRINEXROVER ) && epoch->DGNSSstruct==0 ) {
+				getstr(aux,line,1,14);
+				epoch->receiver.aproxPositionRover[0] = atof(aux);
+				getstr(aux,line,14,14);
+				epoch->receiver.aproxPositionRover[1] = atof(aux);
+				getstr(aux,line,28,14);
+				epoch->receiver.aproxPositionRover[2] = atof(aux);
+			}
+			if(epoch->DGNSSstruct==1) { //This is to avoid reading the rover approx position as reference position
+				if(epoch->receiver.numRecStation==0) {
+					epoch->receiver.RecStationCoord=malloc(sizeof(double*));
+					epoch->receiver.RecStationCoord[0]=malloc(sizeof(double)*3);
+					memcpy(epoch->receiver.RecStationCoord[0],epoch->receiver.aproxPosition,sizeof(double)*3);
+					epoch->receiver.numRecStation++;
+				} else {
+					if(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][0]!=epoch->receiver.aproxPosition[0] 
+						|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][1]!=epoch->receiver.aproxPosition[1]
+						|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][2]!=epoch->receiver.aproxPosition[2]) {
+						//Station coordinates are differents from the previous read
+						epoch->receiver.RecStationCoord=realloc(epoch->receiver.RecStationCoord,sizeof(double*)*(epoch->receiver.numRecStation+1));
+						epoch->receiver.RecStationCoord[epoch->receiver.numRecStation]=malloc(sizeof(double)*3);
+						memcpy(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation],epoch->receiver.aproxPosition,sizeof(double)*3);
+						epoch->receiver.ChangedStaEpoch=realloc(epoch->receiver.ChangedStaEpoch,sizeof(TTime)*epoch->receiver.numRecStation);
+						memcpy(&epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1],&epoch->t,sizeof(TTime));
+						epoch->receiver.numRecStation++;
+					}
+				}
+			}
+		} else if ( strncmp(&line[60], "END OF HEADER", 13) == 0 ) {
+			readingHeader = 0;
+			properlyRead = 1;
+			if (fdout!=NULL && epoch->DGNSSstruct==0) {
+				//Add header comment line indicating that user defined error has been added to measurements
+				headerlines=realloc(headerlines,sizeof(char *)*(numheaderlines+1));
+				headerlines[numheaderlines]=malloc(sizeof(char)*MAX_INPUT_LINE);
+				strcpy(headerlines[numheaderlines],headerlines[numheaderlines-1]); //Copy END OF HEADER line to the last line
+				sprintf(headerlines[numheaderlines-1],"%-60sCOMMENT","User defined error added to measurements (with gLAB tool)");
+				numheaderlines++;
+			}
+			break;
+		}
+	}
+	
+	//Write header lines for RINEX observation file with user added error
+	if (fdout!=NULL && epoch->DGNSSstruct==0) {
+		writeRinexObsHeaderUserAddedError(fdout,headerlines,numheaderlines);
+		for(i=0;i<numheaderlines;i++) {
+			free(headerlines[i]);
+		}
+		free(headerlines);
+	}
+
+	//Check for non quantizied SNR measurements
+	if (options->solutionMode==PPPMode) {
+		//Get SNR for both frequencies
+		i=epoch->measOrder[GPS].meas2Ind[S1P];
+		if (i==-1) {
+			i=epoch->measOrder[GPS].meas2Ind[S1C];
+		}
+		if (i==-1) {
+			i=epoch->measOrder[GPS].meas2Ind[S1W];
+		}
+		j=epoch->measOrder[GPS].meas2Ind[S2P];
+		if (j==-1) {
+			j=epoch->measOrder[GPS].meas2Ind[S2C];
+		} 
+		if (j==-1) {
+			j=epoch->measOrder[GPS].meas2Ind[S2W];
+		}
+		if (i!=-1 && j!=-1) {
+			//GPS has non quantizied SNR measurements for both frequencies. Save positions
+			epoch->measOrder[GPS].hasSNRmeas=1;
+			epoch->measOrder[GPS].SNRmeaspos[1]=i;
+			epoch->measOrder[GPS].SNRmeaspos[2]=j;
+		}
+	} else {
+		//Get SNR for frequencies one
+		i=epoch->measOrder[GPS].meas2Ind[S1C];
+		if (i==-1) {
+			i=epoch->measOrder[GPS].meas2Ind[S1P];
+		}
+		if (i==-1) {
+			i=epoch->measOrder[GPS].meas2Ind[S1W];
+		}
+		if (i!=-1) {
+			//GPS has non quantizied SNR measurements for both frequencies. Save positions
+			epoch->measOrder[GPS].hasSNRmeas=1;
+			epoch->measOrder[GPS].SNRmeaspos[1]=i;
+		}
+	}
+
+	if (epoch->DGNSSstruct==0 && firstProgressCheck==1) {
+		firstProgressCheck=0;
+		//We need to enter if printProgress is enabled or if it is disabled but want to compute receiver interval
+		if (printProgress==1 || (printProgress==0 && epoch->receiver.interval==-1.) ) {
+			//Check that there was no error when reading the header
+			if (properlyRead==1 && error==0) {
+				//Compute number of epochs.
+				//Save current position in file
+				posEndHeader = ftell(fd);
+				for(i=0;i<3;i++) {
+					if (i==1) {
+						if (epoch->receiver.interval!=-1 && epoch->receiver.interval!=0.) {
+							interval=epoch->receiver.interval;	
+							continue;
+						} else {
+							//Interval is not in the header, read first and second epoch and compute the interval
+							//Maybe some observation files have a data gap for all satellite in second, but that is extemely rare
+						}
+					} else if (i==2) {
+						//We need to go to the end of the file.
+						//NOTE that fseek(fd, 0L, SEEK_END); does not work as we have opened the file in binary mode!!!
+						filesize = getInputFileSize(fd);
+						fseek(fd,filesize,SEEK_SET);
+						//Seek the beginning of the last epoch
+						rewindEpochRinexObs(fd, epoch->source);
+					}
+					ErrorReadingEpochs=0;
+					while(1) {
+						if (getL(line,&len,fd)==-1) {
+							#if !defined (__WIN32__)
+								if (printProgress==1 && options->ProgressEndCharac=='\r') {
+									//If print progress was enabled, reenable the cursor
+									fprintf(options->terminalStream,"\033[?25h");
+								}
+							#endif
+							printProgress=0;
+							ErrorReadingEpochs=1;
+							break;
+						}
+						//Read epoch time
+						if (epoch->source == RINEX2) {
+							getstr(aux,line,0,4);
+							yy = tm.tm_year = atoi(aux);
+							if (tm.tm_year <= 70) tm.tm_year += 100;
+							getstr(aux,line,3,4);
+							mm = atoi(aux);
+							tm.tm_mon  = mm - 1;
+							getstr(aux,line,6,4);
+							dd = tm.tm_mday = atoi(aux);
+							getstr(aux,line,9,4);
+							if(aux[1]=='.'||aux[2]=='.') {
+								hour= tm.tm_hour = -1;
+							} else {
+								hour = tm.tm_hour = atoi(aux);
+							}
+							getstr(aux,line,12,4);
+							min = tm.tm_min  = atoi(aux);
+							getstr(aux,line,16,10);
+							tm.tm_sec  = atoi(aux);
+							seconds = atof(aux);
+						} else {
+							//RINEX v3
+							if (line[0]=='>' && len<60) {
+								//Line with valid epoch
+								getstr(aux,line,2,4);
+								yy =  atoi(aux);
+								if (yy>=2000) yy-=2000;
+								else yy-=1900;
+								tm.tm_year = atoi(aux)-1900;
+								getstr(aux,line,7,2);
+								mm = atoi(aux);
+								tm.tm_mon = mm-1;
+								getstr(aux,line,10,2);
+								dd = tm.tm_mday = atoi(aux);
+								getstr(aux,line,13,2);
+								hour = tm.tm_hour = atoi(aux);
+								getstr(aux,line,16,2);
+								min = tm.tm_min  = atoi(aux);
+								getstr(aux,line,19,10);
+								tm.tm_sec  = atoi(aux);
+								seconds = atof(aux);
+							} else {
+								hour=-1;
+							}
+						}
+						if (yy>=0 && yy<=99 && mm>=1 && mm<=12 && dd>=1 && dd<=31 && hour>=0 && hour<=23 && min>=0 &&min<=59) {
+							//Epoch timestamp found
+							break;
+                        } else if (i==2 && epoch->source == RINEX3) {
+                            //Check if last epoch is an event epoch without date
+                            getstr(aux,line,30,2);
+                            epochflag=atoi(aux);
+                            if (line[0]=='>' && len<60 && epochflag>1 ) {
+                                //Event epoch is the last epoch in file and it does not have the date in the epoch recod,
+                                //so we need to go another epoch back to get an epoch with data and full date
+                                getLback(line,&len,fd);
+                                rewindEpochRinexObs(fd, epoch->source);
+                            }
+						}
+					}
+					if (ErrorReadingEpochs==1) {
+						//Error when looking for epochs
+						if (i<2) {
+							//Interval could not be computed. Set interval to 1 to avoid division by zero
+							interval=epoch->receiver.intervalEstimate=1.;
+							//Disable Ncon filter as we don't know the file interval
+							options->csNcon = 0;
+							break;
+						}
+					} else if (printProgress==0 && i>1) {
+						break;
+					}
+					if (i==0) {
+						firstEpoch.MJDN = MJDN(&tm);
+						firstEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+					} else if (i==1) {
+						secondEpoch.MJDN = MJDN(&tm);
+						secondEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+						interval=tdiff(&secondEpoch,&firstEpoch);
+						if (interval<1E-4) {
+							//Epoch repeated due to an event epoch just in the first epoch
+							//Keep reading epochs until the epoch changes
+							i=0;
+							continue;
+						}
+						epoch->receiver.intervalEstimate=interval;
+						if ( epoch->receiver.intervalEstimate >= 15.0 ) {
+							options->csNcon = 0;
+						}
+						if (interval>=1.) {
+							epoch->receiver.intervalDecimalsFactor=1;
+							epoch->receiver.DecimateVal=1;
+						} else {
+							//Get the number of decimals
+							auxinterval=interval-(double)((int)(interval+.00005));
+							epoch->receiver.intervalDecimalsFactor=sprintf(aux,"%.4g",auxinterval)-2;
+							epoch->receiver.intervalDecimalsFactor=(int)(pow(10,(double)epoch->receiver.intervalDecimalsFactor));
+							epoch->receiver.DecimateVal=(long long int)((options->decimate+.00005)*(double)(epoch->receiver.intervalDecimalsFactor));
+							if (epoch->receiver.DecimateVal==0) {
+								//This is the case where user set an interval smaller than the number of decimals in the interval
+								//Therefore, set this value to 1, so all epochs are used (and also avoid dividing by 0)
+								epoch->receiver.DecimateVal=1;
+							}
+						}
+						if (printProgress==0) break;
+					} else {
+						if (options->StartEpoch.MJDN!=-1) {
+							//User selected an start epoch. Check if first epoch is before or after first epoch of file
+							if (tdiff(&firstEpoch,&options->StartEpoch)<0) {
+								//First epoch of file is before start epoch. Use user start epoch as first epoch
+								memcpy(&firstEpoch,&options->StartEpoch,sizeof(TTime));
+							}
+						}
+						lastEpoch.MJDN = MJDN(&tm);
+						lastEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+						if (options->EndEpoch.MJDN!=-1) {
+							//User selected and ending epoch. Check if last epoch of file is before or after user selected epoch
+							if (tdiff(&lastEpoch,&options->EndEpoch)<0) {
+								//Last epoch of file is before user last epoch. Use file last epoch to compute number of epochs
+								epoch->numEpochsfile=tdiff(&lastEpoch,&firstEpoch)/interval;
+							} else {
+								//Last epoch of file is after user last epoch. Use user last epoch to compute number of epochs
+								epoch->numEpochsfile=tdiff(&options->EndEpoch,&firstEpoch)/interval;
+							}
+						} else {
+							epoch->numEpochsfile=tdiff(&lastEpoch,&firstEpoch)/interval;
+						}
+					}
+				}
+				//Set the file position back to the first epoch
+				fseek(fd,posEndHeader,SEEK_SET);
+				//If backward filtering is enabled, double the number of epochs in file (the smoother does not read the file again)
+				if (options->filterIterations==2 && options->smoother==0) {
+					epoch->numEpochsfile*=2;
+				}
+			} else {
+				//If error reading header, disable printing progress for precaution
+				#if !defined (__WIN32__)
+					if (printProgress==1 && options->ProgressEndCharac=='\r') {
+						//If print progress was enabled, reenable the cursor
+						fprintf(options->terminalStream,"\033[?25h");
+					}
+				#endif
+				printProgress=0;
+			}
+		}
+	} else if (epoch->DGNSSstruct==1 && firstProgressCheckDGNSS==1) {
+		firstProgressCheckDGNSS=0;
+		if (epoch->receiver.interval<=0.) {
+			//Receiver interval not available. Compute it
+			//Save current position in file
+			posEndHeader = ftell(fd);
+			for(i=0;i<2;i++) {
+				while(1) {
+					if (getL(line,&len,fd)==-1) {
+						//Interval cannot be computed. Set 1 to avoid division by 0
+						epoch->receiver.interval=1.;
+						return 0;
+					}
+					//Read epoch time
+					if (epoch->source == RINEX2) {
+						getstr(aux,line,0,4);
+						yy = tm.tm_year = atoi(aux);
+						if (tm.tm_year <= 70) tm.tm_year += 100;
+						getstr(aux,line,3,4);
+						mm = atoi(aux);
+						tm.tm_mon  = mm - 1;
+						getstr(aux,line,6,4);
+						dd = tm.tm_mday = atoi(aux);
+						getstr(aux,line,9,4);
+						if(aux[1]=='.'||aux[2]=='.') {
+							hour= tm.tm_hour = -1;
+						} else {
+							hour = tm.tm_hour = atoi(aux);
+						}
+						getstr(aux,line,12,4);
+						min = tm.tm_min  = atoi(aux);
+						getstr(aux,line,16,10);
+						tm.tm_sec  = atoi(aux);
+						seconds = atof(aux);
+					} else {
+						//RINEX v3
+						if (line[0]=='>' && len<60) {
+							//Line with valid epoch
+							getstr(aux,line,2,4);
+							yy =  atoi(aux);
+							if (yy>=2000) yy-=2000;
+							else yy-=1900;
+							tm.tm_year = atoi(aux)-1900;
+							getstr(aux,line,7,2);
+							mm = atoi(aux);
+							tm.tm_mon = mm-1;
+							getstr(aux,line,10,2);
+							dd = tm.tm_mday = atoi(aux);
+							getstr(aux,line,13,2);
+							hour = tm.tm_hour = atoi(aux);
+							getstr(aux,line,16,2);
+							min = tm.tm_min  = atoi(aux);
+							getstr(aux,line,19,10);
+							tm.tm_sec  = atoi(aux);
+							seconds = atof(aux);
+						} else {
+							hour=-1;
+						}
+					}
+					if (yy>=0 && yy<=99 && mm>=1 && mm<=12 && dd>=1 && dd<=31 && hour>=0 && hour<=23 && min>=0 &&min<=59) {
+						//Epoch timestamp found
+						break;
+					}
+				}
+				if (i==0) {
+					firstEpoch.MJDN = MJDN(&tm);
+					firstEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+				} else {
+					secondEpoch.MJDN = MJDN(&tm);
+					secondEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+					interval=tdiff(&secondEpoch,&firstEpoch);
+					if (interval<1E-4) {
+						//Epoch repeated due to an event epoch just in the first epoch
+						//Keep reading epochs until the epoch changes
+						i=0;
+						continue;
+					}
+					epoch->receiver.interval=interval;
+				}
+			}
+			//Set the file position back to the first epoch
+			fseek(fd,posEndHeader,SEEK_SET);
+		}
+	}
+
+	return (properlyRead && !error); // properly read AND no error
+}
+
+/*****************************************************************************
+ * Name        : readRinexObsEpoch
+ * Description : Read a RINEX observation epoch from a file descriptor
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TEpoch  *epoch                  O  N/A  Structure to save the data
+ * TConstellation  *constellation  I  N/A  TConstellation structure
+ * enum ProcessingDirection        I  N/A  Direction of the read
+ *                                         pFORWARD  => Forward
+ *                                         pBACKWARD => Backward
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Properly read
+ *                                         2 => Another file concatenated
+ *                                         0 => Error or EOF (no more epochs)
+ *****************************************************************************/
+int readRinexObsEpoch (FILE *fd, TEpoch *epoch, TConstellation *constellation, enum ProcessingDirection direction, char *Epochstr, TOptions *options) {
+	char		line[MAX_INPUT_LINE];
+	char		aux[100];
+	char		cons;
+	int			len = 0;
+	int			properlyRead = 0;
+	int			error = 0;
+	int			i, j, k;
+	int			n;
+	int			notSupportedSatellites = 0;
+	int			numEpochsMissing;
+	struct tm	tm;
+	double		seconds;
+	double		value;
+	int			nextRead;
+	int			ret;
+	long		linepos;
+
+	// For converting from SNR flag in RINEX to dBHz. 60 means don't care (0 in RINEX) or very high (9 in RINEX)
+	// There is no fixed value for very high SNR (9 in RINEX). A value is 60 is set in order to give a higher enough
+	// value when computing the satellite weight using the SNR
+	static int	SNRtable[10] = { 60, 11, 17, 23, 29, 35, 41, 47, 53, 60 };
+
+	static int	twoepochs=1;	//Variable to read only the first two epochs to compute data rate file
+	static int	lastCSindex[2]={0,0};	//Variable holding the first free index of all satellites viewed
+
+	// Rewind for backward processing
+	if ( direction == pBACKWARD ) {
+		ret = rewindEpochRinexObsIndex(fd,epoch->source,epoch->obsIndex);
+		if ( ret == 0 ) return 0;
+		ret = rewindEpochRinexObsIndex(fd,epoch->source,epoch->obsIndex);
+		if ( ret == 0 ) return 0;
+	}
+
+	//Remove index values from previous epoch
+	for (i=0;i<epoch->numSatellites;i++) {
+		epoch->satIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]=-1;
+	}
+
+	linepos = ftell(fd);
+	if (getL(line,&len,fd)!=-1) {
+		properlyRead = 1;
+		// Block to detect new RINEX header, it only affects when large RINEX are used
+		getstr(aux,line,60,80);
+		if (strncmp(aux,"RINEX VERSION / TYPE",20)==0) {
+			fseek(fd,linepos,SEEK_SET);
+			return 2;
+		}
+		if (epoch->source == RINEX2) {
+			// RINEX 2.11				
+			epoch->flag = getIntField(line,len,27,2);
+			
+			if (epoch->flag>1) { // Unusable epoch
+				if ( direction == pBACKWARD ) {
+					//Save previous epoch
+					memcpy(&epoch->PreviousEpoch,&epoch->t,sizeof(TTime));
+					//When going backwards, skip epoch events and look for previous epoch in RINEX observation file
+					//If next valid epoch was read, it would make an infinite loop as we want back one epoch, but read two,
+					//and the next time we enter this function, we would go back two epochs, which results in always reading 
+					//the same epoch
+					ret = rewindEpochRinexObsIndex(fd,epoch->source,epoch->obsIndex);
+					if ( ret == 0 ) return 0;
+				} else {
+					tm.tm_year = getIntField(line,len,1,2);
+					if (tm.tm_year <= 70) tm.tm_year += 100;
+					tm.tm_mon  = getIntField(line,len,4,2)-1;
+					tm.tm_mday = getIntField(line,len,7,2);
+					tm.tm_hour = getIntField(line,len,10,2);
+					tm.tm_min  = getIntField(line,len,13,2);
+					tm.tm_sec  = getIntField(line,len,16,10);
+					seconds = getDoubleField(line,len,16,10);
+					n = getIntField(line,len,30,2);
+					for (i=0;i<=n;i++) {
+						if (getL(line,&len,fd)==-1) {
+							return 0;
+						}
+						if (strncmp(&line[60],"APPROX POSITION XYZ",19)==0) {
+							if (options->receiverPositionSource==rpRINEX || ( ( (options->receiverPositionSource == rpCALCULATERINEX) || (options->receiverPositionSource == rpCALCULATERINEXREF)  ) && epoch->numAproxPosRead==0)) {
+								epoch->receiver.aproxPosition[0] = getDoubleField(line,len,1,14);
+								epoch->receiver.aproxPosition[1] = getDoubleField(line,len,14,14);
+								epoch->receiver.aproxPosition[2] = getDoubleField(line,len,28,14);
+								epoch->receiver.aproxPositionError = 1e4; // 10 Km
+								epoch->numAproxPosRead++;
+							} else if ( options->receiverPositionSource >= rpRTCMbaseline && options->receiverPositionSource <= rpRTCMRoverUSERREF  ) {
+								epoch->receiver.aproxPosition[0] = getDoubleField(line,len,1,14);
+								epoch->receiver.aproxPosition[1] = getDoubleField(line,len,14,14);
+								epoch->receiver.aproxPosition[2] = getDoubleField(line,len,28,14);
+								epoch->receiver.aproxPositionError = 0.1; // 10 cm
+								epoch->numAproxPosRead++;
+							} 
+							if ( ( options->receiverPositionSource == rpRTCMRINEXROVER || options->receiverPositionSource == rpRTCMUserRINEXROVER ) && epoch->DGNSSstruct==0 ) {
+								epoch->receiver.aproxPositionRover[0] = getDoubleField(line,len,1,14);
+								epoch->receiver.aproxPositionRover[1] = getDoubleField(line,len,14,14);
+								epoch->receiver.aproxPositionRover[2] = getDoubleField(line,len,28,14);
+							}
+							if(epoch->DGNSSstruct==1) {
+								if(epoch->receiver.numRecStation==0) {
+									epoch->receiver.RecStationCoord=malloc(sizeof(double*));
+									epoch->receiver.RecStationCoord[0]=malloc(sizeof(double)*3);
+									memcpy(epoch->receiver.RecStationCoord[0],epoch->receiver.aproxPosition,sizeof(double)*3);
+									epoch->receiver.numRecStation++;
+								} else {
+									if(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][0]!=epoch->receiver.aproxPosition[0] 
+											|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][1]!=epoch->receiver.aproxPosition[1]
+											|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][2]!=epoch->receiver.aproxPosition[2]) {
+										//Station coordinates are differents from the previous read
+										epoch->receiver.RecStationCoord=realloc(epoch->receiver.RecStationCoord,sizeof(double*)*(epoch->receiver.numRecStation+1));
+										epoch->receiver.RecStationCoord[epoch->receiver.numRecStation]=malloc(sizeof(double)*3);
+										memcpy(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation],epoch->receiver.aproxPosition,sizeof(double)*3);
+										epoch->receiver.ChangedStaEpoch=realloc(epoch->receiver.ChangedStaEpoch,sizeof(TTime)*epoch->receiver.numRecStation);
+										memcpy(&epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1],&epoch->t,sizeof(TTime));
+										epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1].MJDN=MJDN(&tm);
+										epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1].SoD=(double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+										epoch->receiver.numRecStation++;
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+			
+			//Save previous epoch
+			memcpy(&epoch->PreviousEpoch,&epoch->t,sizeof(TTime));
+
+			tm.tm_year = getIntField(line,len,1,2);
+			if (tm.tm_year <= 70) tm.tm_year += 100;
+			tm.tm_mon  = getIntField(line,len,4,2)-1;
+			tm.tm_mday = getIntField(line,len,7,2);
+			tm.tm_hour = getIntField(line,len,10,2);
+			tm.tm_min  = getIntField(line,len,13,2);
+			tm.tm_sec  = getIntField(line,len,16,10);
+			seconds = getDoubleField(line,len,16,10);
+			epoch->t.MJDN = MJDN(&tm);
+			epoch->t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+
+			//Look for data gaps
+			numEpochsMissing=abs((int)(tdiff(&epoch->t,&epoch->PreviousEpoch)/epoch->receiver.interval))-1;
+			if (numEpochsMissing>0) {
+				if (epoch->PreviousEpoch.MJDN!=-1) {
+					epoch->CurrentDataGapSize=numEpochsMissing;
+					sprintf(messagestr,"Data gap of %d epoch%s in %s at %17s / %4d %02d %02d %02d:%02d:%04.1f",numEpochsMissing,numEpochsMissing==1?"":"s",epoch->DGNSSstruct==0?"rover observation file":"reference station RINEX observation file",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds);
+					printInfo(messagestr,options);
+				} else {
+					epoch->CurrentDataGapSize=0;
+				}
+			} else {
+				epoch->CurrentDataGapSize=0;
+			}
+
+			if (printProgress==1) {
+				//Only save current epoch if it we are reading Rover file, not reference file
+				if (epoch->DGNSSstruct==0) {
+					if (options->StartEpoch.MJDN!=-1) {
+						if(tdiff(&epoch->t,&options->StartEpoch)>=0.) {
+							epoch->numEpochsprocessed++;
+							epoch->CurrentPercentage=100*epoch->numEpochsprocessed/epoch->numEpochsfile;
+							if ((epoch->CurrentPercentage-epoch->PreviousPercentage)>=0.1) {
+								sprintf(Epochstr,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        ",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,epoch->CurrentPercentage);
+								epoch->NewPercentage=1;
+							}
+						}
+					} else {
+						epoch->numEpochsprocessed++;
+						epoch->CurrentPercentage=100*epoch->numEpochsprocessed/epoch->numEpochsfile;
+						if ((epoch->CurrentPercentage-epoch->PreviousPercentage)>=0.1) {
+							sprintf(Epochstr,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        ",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,epoch->CurrentPercentage);
+							epoch->NewPercentage=1;
+						}
+					}
+				}
+			}
+
+
+			if (twoepochs) {
+				if(epoch->firstepoch.SoD==-1.) {
+					memcpy(&epoch->firstepoch,&epoch->t,sizeof(TTime));
+				} else {
+					if (tdiff(&epoch->t,&epoch->firstepoch)>1E-4) {
+						//This is for the case we read the first epoch two times.
+						//This occurs if we need to read the first epoch in order to look for Glonass k factors in the navigation file
+						twoepochs=0;
+						memcpy(&epoch->secondepoch,&epoch->t,sizeof(TTime));
+					}
+				}
+			}
+				
+			// Skip the records of the epoch if they are not going to be used
+			if (skipRinexObsEpoch(fd,epoch,direction,&lastCSindex[epoch->DGNSSstruct],options)==1) return 1;
+
+			epoch->numSatellites = getIntField(line,len,30,2);
+			for (i=0,j=0;i<epoch->numSatellites;i++,j++) { // Get satellite PRNs
+				if ((i%12)==0 && i!=0) {
+					if (getL(line,&len,fd)==-1) error = 1; // The next satellites are in the following line
+					j = 0;
+				}
+				cons = line[32+3*j];
+				epoch->sat[i].PRN = getIntField(line,len,33+3*j,2);
+				if (cons=='G' || cons==' ')
+					epoch->sat[i].GNSS = GPS;
+				else if (cons=='S')
+					epoch->sat[i].GNSS = GEO;
+				else if (cons=='R')
+					epoch->sat[i].GNSS = GLONASS;
+				else if (cons=='E')
+					epoch->sat[i].GNSS = Galileo;
+			}
+			for (i=0;i<epoch->numSatellites;i++) { // Get satellite measurements
+				if (getL(line,&len,fd)==-1) error = 1;
+				nextRead = 0;
+				for (j=0,k=0;j<epoch->measOrder[epoch->sat[i].GNSS].nDiffMeasurements;j++,k++) {
+					if (nextRead) {
+						if (getL(line,&len,fd)==-1) error = 1;
+						nextRead = 0;
+					}
+					value = getDoubleField(line,len,16*k,14);
+					if (value==0) value = -1;
+					epoch->sat[i].meas[j].value = value;
+					epoch->sat[i].meas[j].rawvalue = value;
+					epoch->sat[i].meas[j].LLI = getIntField(line,len,14+16*k,1);
+					if (line[15+16*k]==' ') {
+						epoch->sat[i].meas[j].hasSNRflag=0;
+					} else {
+						epoch->sat[i].meas[j].hasSNRflag=1;
+					}
+					epoch->sat[i].meas[j].SNR = getIntField(line,len,15+16*k,1);
+					epoch->sat[i].meas[j].SNRdBHz = SNRtable[epoch->sat[i].meas[j].SNR];
+					epoch->sat[i].meas[j].dataFlag = 0;
+					if ((k+1)%5==0) { // Following observables are in the next lines (max 5 per line)
+						nextRead = 1;
+						k=-1; // k will be increased in the for loop
+					}
+				}
+				if (epoch->sat[i].GNSS==GPS) epoch->lastSBASindex=i; //When gLAB is multiconstellation and SBAS monitors also other constellations, this has to include other constellations
+				epoch->satIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]=i;
+
+				if (epoch->satCSIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]==-1) {
+					epoch->satCSIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]=lastCSindex[epoch->DGNSSstruct];
+					lastCSindex[epoch->DGNSSstruct]++;
+				}
+			}
+		} else if (epoch->source==RINEX3) {
+			// RINEX 3.00
+			epoch->flag = getIntField(line,len,30,2);
+			
+			if (epoch->flag>1) { // Unusable epoch
+				if ( direction == pBACKWARD ) {
+					//Save previous epoch
+					memcpy(&epoch->PreviousEpoch,&epoch->t,sizeof(TTime));
+					//When going backwards, skip epoch events and look for previous epoch in RINEX observation file
+					//If next valid epoch was read, it would make an infinite loop as we want back one epoch, but read two,
+					//and the next time we enter this function, we would go back two epochs, which results in always reading 
+					//the same epoch
+					ret = rewindEpochRinexObsIndex(fd,epoch->source,epoch->obsIndex);
+					if ( ret == 0 ) return 0;
+				} else {
+					tm.tm_year = getIntField(line,len,2,4)-1900;
+					tm.tm_mon  = getIntField(line,len,7,2)-1;
+					tm.tm_mday = getIntField(line,len,10,2);
+					tm.tm_hour = getIntField(line,len,13,2);
+					tm.tm_min  = getIntField(line,len,16,2);
+					tm.tm_sec  = getIntField(line,len,19,10);
+					seconds = getDoubleField(line,len,19,10);
+
+					n = getIntField(line,len,33,2);
+					for (i=0;i<=n;i++) {
+						if (getL(line,&len,fd)==-1) {
+							return 0;
+						}
+						if (strncmp(&line[60],"APPROX POSITION XYZ",19)==0) {
+							if (options->receiverPositionSource==rpRINEX || ( ( (options->receiverPositionSource == rpCALCULATERINEX) || (options->receiverPositionSource == rpCALCULATERINEXREF)  ) && epoch->numAproxPosRead==0)) {
+								epoch->receiver.aproxPosition[0] = getDoubleField(line,len,1,14);
+								epoch->receiver.aproxPosition[1] = getDoubleField(line,len,14,14);
+								epoch->receiver.aproxPosition[2] = getDoubleField(line,len,28,14);
+								epoch->receiver.aproxPositionError = 1e4; // 10 Km
+								epoch->numAproxPosRead++;
+							} else if ( options->receiverPositionSource >= rpRTCMbaseline && options->receiverPositionSource <= rpRTCMRoverUSERREF  ) {
+								epoch->receiver.aproxPosition[0] = getDoubleField(line,len,1,14);
+								epoch->receiver.aproxPosition[1] = getDoubleField(line,len,14,14);
+								epoch->receiver.aproxPosition[2] = getDoubleField(line,len,28,14);
+								epoch->receiver.aproxPositionError = 0.1; // 10 cm
+								epoch->numAproxPosRead++;
+							}
+							if ( ( options->receiverPositionSource == rpRTCMRINEXROVER || options->receiverPositionSource == rpRTCMUserRINEXROVER ) && epoch->DGNSSstruct==0 ) {
+								epoch->receiver.aproxPositionRover[0] = getDoubleField(line,len,1,14);
+								epoch->receiver.aproxPositionRover[1] = getDoubleField(line,len,14,14);
+								epoch->receiver.aproxPositionRover[2] = getDoubleField(line,len,28,14);
+							}
+							if(epoch->DGNSSstruct==1) {
+								if(epoch->receiver.numRecStation==0) {
+									epoch->receiver.RecStationCoord=malloc(sizeof(double*));
+									epoch->receiver.RecStationCoord[0]=malloc(sizeof(double)*3);
+									memcpy(epoch->receiver.RecStationCoord[0],epoch->receiver.aproxPosition,sizeof(double)*3);
+									epoch->receiver.numRecStation++;
+								} else {
+									if(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][0]!=epoch->receiver.aproxPosition[0] 
+											|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][1]!=epoch->receiver.aproxPosition[1]
+											|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][2]!=epoch->receiver.aproxPosition[2]) {
+										//Station coordinates are differents from the previous read
+										epoch->receiver.RecStationCoord=realloc(epoch->receiver.RecStationCoord,sizeof(double*)*(epoch->receiver.numRecStation+1));
+										epoch->receiver.RecStationCoord[epoch->receiver.numRecStation]=malloc(sizeof(double)*3);
+										memcpy(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation],epoch->receiver.aproxPosition,sizeof(double)*3);
+										epoch->receiver.ChangedStaEpoch=realloc(epoch->receiver.ChangedStaEpoch,sizeof(TTime)*epoch->receiver.numRecStation);
+										epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1].MJDN=MJDN(&tm);
+										epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1].SoD=(double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+										epoch->receiver.numRecStation++;
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+			
+			// Save previous epoch
+			memcpy(&epoch->PreviousEpoch,&epoch->t,sizeof(TTime));
+
+			tm.tm_year = getIntField(line,len,2,4)-1900;
+			tm.tm_mon  = getIntField(line,len,7,2)-1;
+			tm.tm_mday = getIntField(line,len,10,2);
+			tm.tm_hour = getIntField(line,len,13,2);
+			tm.tm_min  = getIntField(line,len,16,2);
+			tm.tm_sec  = getIntField(line,len,19,10);
+			seconds = getDoubleField(line,len,19,10);
+			epoch->t.MJDN = MJDN(&tm);
+			epoch->t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+			
+			if (printProgress==1) {
+				//Only save current epoch if it we are reading Rover file, not reference file
+				if (epoch->DGNSSstruct==0) {
+					if (options->StartEpoch.MJDN!=-1) {
+						if(tdiff(&epoch->t,&options->StartEpoch)>=0.) {
+							epoch->numEpochsprocessed++;
+							epoch->CurrentPercentage=100*epoch->numEpochsprocessed/epoch->numEpochsfile;
+							if ((epoch->CurrentPercentage-epoch->PreviousPercentage)>=0.1) {
+								sprintf(Epochstr,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        ",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,epoch->CurrentPercentage);
+								epoch->NewPercentage=1;
+							}
+						}
+					} else {
+						epoch->numEpochsprocessed++;
+						epoch->CurrentPercentage=100*epoch->numEpochsprocessed/epoch->numEpochsfile;
+						if ((epoch->CurrentPercentage-epoch->PreviousPercentage)>=0.1) {
+							sprintf(Epochstr,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        ",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,epoch->CurrentPercentage);
+							epoch->NewPercentage=1;
+						}
+					}
+				}
+			}
+
+			if (twoepochs) {
+				if(epoch->firstepoch.SoD==-1.) {
+					memcpy(&epoch->firstepoch,&epoch->t,sizeof(TTime));
+				} else {
+					twoepochs=0;
+					memcpy(&epoch->secondepoch,&epoch->t,sizeof(TTime));
+				}
+			}
+				
+			// Skip the records of the epoch if they are not going to be used
+			if (skipRinexObsEpoch(fd,epoch,direction,&lastCSindex[epoch->DGNSSstruct],options)==1) return 1;
+
+			epoch->numSatellites = getIntField(line,len,33,2);
+			for (i=0;i<epoch->numSatellites;i++) { // Get satellite measurements and PRNs
+				if (getL(line,&len,fd)==-1) error = 1;
+				epoch->sat[i-notSupportedSatellites].GNSS = gnsschar2gnsstype(line[0]);
+				if ( epoch->sat[i-notSupportedSatellites].GNSS==BDS || epoch->sat[i-notSupportedSatellites].GNSS==QZSS || epoch->sat[i-notSupportedSatellites].GNSS==IRNSS ) { //BeiDou, QZSS, IRNSS are not supported
+					notSupportedSatellites++;
+					continue; 
+				}	
+				epoch->sat[i-notSupportedSatellites].PRN = getIntField(line,len,1,2);
+				for (j=0;j<epoch->measOrder[epoch->sat[i-notSupportedSatellites].GNSS].nDiffMeasurements;j++) {
+					value = getDoubleField(line,len,3+16*j,14);
+					if (value==0) value = -1;
+					epoch->sat[i-notSupportedSatellites].meas[j].value = value;
+					epoch->sat[i-notSupportedSatellites].meas[j].rawvalue = value;
+					epoch->sat[i-notSupportedSatellites].meas[j].LLI = getIntField(line,len,17+16*j,1);
+					if (line[18+16*j]==' ') {
+						epoch->sat[i-notSupportedSatellites].meas[j].hasSNRflag=0;
+					} else {
+						epoch->sat[i-notSupportedSatellites].meas[j].hasSNRflag=1;
+					}
+					epoch->sat[i-notSupportedSatellites].meas[j].SNR = getIntField(line,len,18+16*j,1);
+					epoch->sat[i-notSupportedSatellites].meas[j].SNRdBHz = SNRtable[epoch->sat[i-notSupportedSatellites].meas[j].SNR];
+					epoch->sat[i-notSupportedSatellites].meas[j].dataFlag = 0;
+				}
+				if(epoch->sat[i-notSupportedSatellites].GNSS==GPS) epoch->lastSBASindex=i-notSupportedSatellites; //When gLAB is multiconstellation and SBAS monitors also other constellations, this has to include other constellations
+				epoch->satIndex[epoch->sat[i-notSupportedSatellites].GNSS][epoch->sat[i-notSupportedSatellites].PRN]=i-notSupportedSatellites;
+
+				if (epoch->satCSIndex[epoch->sat[i-notSupportedSatellites].GNSS][epoch->sat[i-notSupportedSatellites].PRN]==-1) {
+					epoch->satCSIndex[epoch->sat[i-notSupportedSatellites].GNSS][epoch->sat[i-notSupportedSatellites].PRN]=lastCSindex[epoch->DGNSSstruct];
+					lastCSindex[epoch->DGNSSstruct]++;
+				}
+			}
+			epoch->numSatellites-=notSupportedSatellites;
+		} // (epoch->source==RINEX3)
+
+	}
+
+	return (properlyRead && !error); // properly read AND no error	
+}
+
+/*****************************************************************************
+ * Name        : rewindEpochRinexObs
+ * Description : Rewind one epoch backward in a RINEX observation file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * enum Source  src                I  N/A  Source of the RINEX file (RINEX2 or RINEX3)
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Properly read
+ *                                         0 => Error or EOF (no more epochs)
+ *****************************************************************************/
+int rewindEpochRinexObs (FILE *fd, enum Source src) {
+	int			ret;
+	int			yy=-1,mm=-1,dd=-1,hour=-1,min=-1;
+	char 		line[MAX_INPUT_LINE];
+	char    	aux[100];
+	int 		len = 0;
+	
+	while (1) {
+		ret = getLback(line,&len,fd);
+		if (ret==-1) return 0;
+		if (len>72 && strncmp(&line[60],"END OF HEADER",13)==0) {
+			//Read backward until beginning of header is found
+			while (1) {
+				ret = getLback(line,&len,fd);
+				if (ret==-1) return 0;
+				if (len>79 && strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
+					break;
+				}
+			}
+		} else {
+			// Check if date is within margins to detect init of epoch
+			// RINEX 2.11
+			if (src==RINEX2) {
+				getstr(aux,line,0,4);
+				yy = atoi(aux);
+				getstr(aux,line,3,4);
+				mm = atoi(aux);
+				getstr(aux,line,6,4);
+				dd = atoi(aux);
+				getstr(aux,line,9,4);
+				//The '.' detection is to avoid some measurements with many 0's to produce a valid date
+				//With the check of the dot, the date string will never have a '.' 
+				//For example, the following line in a RINEX 2:
+				//   20010008.523   105153351.772         472.098          50.585    20010006.448
+				//This produced a valid date, when clearly is not the line where an epoch starts
+				if(aux[1]=='.'||aux[2]=='.') {
+					hour=-1;
+				} else {
+					hour = atoi(aux);
+				}
+				getstr(aux,line,12,4);
+				min = atoi(aux);
+				if (yy>=0 && yy<=99 && mm>=1 && mm<=12 && dd>=1 && dd<=31 && hour>=0 && hour<=23 && min>=0 &&min<=59) {
+					return 1;
+				}
+			// RINEX 3.00
+			} else if (src==RINEX3) {
+				//The len<60 is to avoid potential header or comment lines starting with ">"
+				if (line[0]=='>' && len<60) return 1;
+			} else return 0;
+		}
+	}
+}
+
+/*****************************************************************************
+ * Name        : buildRinexObsIndex
+ * Description : Build the offset index of a RINEX observation file. Only the
+ *               epoch lines and the satellite identifiers are read (the
+ *               measurements are not parsed). The index is built from the
+ *               current position of the file descriptor, which is restored at
+ *               the end. An epoch with incomplete records at the end of the
+ *               file is not saved in the index
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TEpoch  *epoch                  I  N/A  TEpoch structure (with the header already read)
+ * TRinexObsIndex *index           O  N/A  Offset index of the RINEX observation file
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1  => Index built
+ *                                         0  => Error
+ *****************************************************************************/
+int buildRinexObsIndex (FILE *fd, TEpoch *epoch, TRinexObsIndex *index) {
+	char			line[MAX_INPUT_LINE];
+	char			cons;
+	int				len = 0;
+	int				readingHeader = 0;
+	int				maxEpochs = 0;
+	int				maxSats = 0;
+	int				flag;
+	int				numRecords;
+	int				numSats;
+	int				linesPerSat;
+	int				numObs;
+	int				dated;
+	int				complete;
+	int				i,j,n;
+	long			startpos,linepos,datapos;
+	enum Source		source;
+	enum GNSSystem	GNSS;
+
+	index->numEpochs = 0;
+	index->offset = NULL;
+	index->dataPos = NULL;
+	index->end = NULL;
+	index->numSats = NULL;
+	index->firstSat = NULL;
+	index->numSatPool = 0;
+	index->satGNSS = NULL;
+	index->satPRN = NULL;
+
+	startpos = ftell(fd);
+	if (startpos<0) return 0;
+
+	source = epoch->source;
+	numObs = epoch->measOrder[GPS].nDiffMeasurements;
+
+	while (1) {
+		linepos = ftell(fd);
+		if (getL(line,&len,fd)==-1) break;
+		if (len>=80 && strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
+			readingHeader = 1;
+			n = (int)getDoubleField(line,len,0,9);
+			if (n==2) source = RINEX2;
+			else if (n==3) source = RINEX3;
+			continue;
+		} else if (readingHeader) {
+			if (len>=79 && strncmp(&line[60],"# / TYPES OF OBSERV",19)==0) {
+				// Continuation lines have the number of types blank
+				n = getIntField(line,len,0,6);
+				if (n>0) numObs = n;
+			} else if (len>=73 && strncmp(&line[60],"END OF HEADER",13)==0) {
+				readingHeader = 0;
+			}
+			continue;
+		}
+
+		if (source==RINEX3) {
+			if (line[0]!='>') continue;
+			flag = getIntField(line,len,30,2);
+			numRecords = getIntField(line,len,33,2);
+			linesPerSat = 1;
+			//The len<60 is the same check done when rewinding the file
+			dated = len<60;
+		} else {
+			flag = getIntField(line,len,27,2);
+			numRecords = getIntField(line,len,30,2);
+			linesPerSat = numObs>5?(numObs+4)/5:1;
+			//Event epochs may not have date. These are not considered epoch starts when rewinding the file
+			dated = getIntField(line,len,4,2)>=1 && getIntField(line,len,7,2)>=1;
+		}
+		datapos = ftell(fd);
+
+		if (index->numEpochs==maxEpochs) {
+			maxEpochs += 3600;
+			index->offset = realloc(index->offset,sizeof(long)*maxEpochs);
+			index->dataPos = realloc(index->dataPos,sizeof(long)*maxEpochs);
+			index->end = realloc(index->end,sizeof(long)*maxEpochs);
+			index->numSats = realloc(index->numSats,sizeof(int)*maxEpochs);
+			index->firstSat = realloc(index->firstSat,sizeof(int)*maxEpochs);
+		}
+		if (index->numSatPool+numRecords>maxSats) {
+			maxSats += numRecords+3600*MAX_SATELLITES_VIEWED/4;
+			index->satGNSS = realloc(index->satGNSS,sizeof(unsigned char)*maxSats);
+			index->satPRN = realloc(index->satPRN,sizeof(unsigned char)*maxSats);
+		}
+
+		complete = 1;
+		numSats = 0;
+		if (flag>1) {
+			// Event epoch: the records are special records, and the data epoch comes next
+			for (i=0;i<numRecords;i++) {
+				if (getL(line,&len,fd)==-1) break;
+			}
+			if (i<numRecords) break;
+			if (dated==0) continue;
+			numSats = -1;
+		} else if (source==RINEX3) {
+			for (i=0;i<numRecords;i++) {
+				if (getL(line,&len,fd)==-1) {
+					complete = 0;
+					break;
+				}
+				GNSS = gnsschar2gnsstype(line[0]);
+				//BeiDou, QZSS, IRNSS are not supported
+				if (GNSS==BDS || GNSS==QZSS || GNSS==IRNSS) continue;
+				index->satGNSS[index->numSatPool+numSats] = (unsigned char)GNSS;
+				index->satPRN[index->numSatPool+numSats] = (unsigned char)getIntField(line,len,1,2);
+				numSats++;
+			}
+		} else {
+			// RINEX 2 has the list of satellites in the epoch line (12 per line)
+			for (i=0,j=0;i<numRecords && complete==1;i++,j++) {
+				if ((i%12)==0 && i!=0) {
+					if (getL(line,&len,fd)==-1) complete = 0;
+					j = 0;
+				}
+				cons = 32+3*j<len?line[32+3*j]:'\0';
+				if (cons=='G' || cons==' ') GNSS = GPS;
+				else if (cons=='S') GNSS = GEO;
+				else if (cons=='R') GNSS = GLONASS;
+				else if (cons=='E') GNSS = Galileo;
+				else {
+					//Unknown constellation. The reader keeps the previous value, so the epoch has to be read
+					numSats = -1;
+					continue;
+				}
+				if (numSats>=0) {
+					index->satGNSS[index->numSatPool+numSats] = (unsigned char)GNSS;
+					index->satPRN[index->numSatPool+numSats] = (unsigned char)getIntField(line,len,33+3*j,2);
+					numSats++;
+				}
+			}
+			for (i=0;i<numRecords*linesPerSat && complete==1;i++) {
+				if (getL(line,&len,fd)==-1) complete = 0;
+			}
+		}
+		if (complete==0) break;
+		if (numSats>MAX_SATELLITES_VIEWED) numSats = -1;
+
+		index->offset[index->numEpochs] = linepos;
+		index->dataPos[index->numEpochs] = datapos;
+		index->end[index->numEpochs] = ftell(fd);
+		index->numSats[index->numEpochs] = numSats;
+		index->firstSat[index->numEpochs] = index->numSatPool;
+		if (numSats>0) index->numSatPool += numSats;
+		index->numEpochs++;
+	}
+
+	clearerr(fd);
+	fseek(fd,startpos,SEEK_SET);
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : freeRinexObsIndex
+ * Description : Free the memory of the offset index of a RINEX observation file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TRinexObsIndex *index           IO N/A  Offset index of the RINEX observation file
+ *****************************************************************************/
+void freeRinexObsIndex (TRinexObsIndex *index) {
+	free(index->offset);
+	free(index->dataPos);
+	free(index->end);
+	free(index->numSats);
+	free(index->firstSat);
+	free(index->satGNSS);
+	free(index->satPRN);
+	index->offset = NULL;
+	index->dataPos = NULL;
+	index->end = NULL;
+	index->numSats = NULL;
+	index->firstSat = NULL;
+	index->satGNSS = NULL;
+	index->satPRN = NULL;
+	index->numEpochs = 0;
+	index->numSatPool = 0;
+}
+
+/*****************************************************************************
+ * Name        : skipRinexObsEpoch
+ * Description : Skip the records of the current epoch of a RINEX observation
+ *               file when they are not going to be used (epochs before the
+ *               start time set by user, or decimated epochs when the
+ *               preprocessing does not need their measurements). The list of
+ *               satellites is taken from the offset index, so the satellite
+ *               indexes and the arc lengths are the same as if the epoch was
+ *               read. The epoch line must have been already read
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TEpoch  *epoch                  IO N/A  TEpoch structure
+ * enum ProcessingDirection        I  N/A  Direction of the read
+ * int  *lastCSindex               IO N/A  First free cycle-slip index of the satellites viewed
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Records of the epoch skipped
+ *                                         0 => Records of the epoch have to be read
+ *****************************************************************************/
+int skipRinexObsEpoch (FILE *fd, TEpoch *epoch, enum ProcessingDirection direction, int *lastCSindex, TOptions *options) {
+	int				i,j;
+	int				low,high;
+	long			pos;
+	TRinexObsIndex	*index = epoch->obsIndex;
+
+	if (index==NULL) return 0;
+
+	if (direction==pFORWARD && options->StartEpoch.MJDN!=-1 && tdiff(&epoch->t,&options->StartEpoch)<0.) {
+		//Epoch before the start time set by user
+	} else if (epoch->receiver.look4interval==0 && canSkipDecimatedEpochs(options)==1 && isEpochDecimated(epoch,options)==1) {
+		//Decimated epoch
+	} else {
+		return 0;
+	}
+
+	//Look for the epoch with the epoch line ending at the current position
+	pos = ftell(fd);
+	low = 0;
+	high = index->numEpochs-1;
+	j = -1;
+	while (low<=high) {
+		i = (low+high)/2;
+		if (index->dataPos[i]==pos) {
+			j = i;
+			break;
+		} else if (index->dataPos[i]<pos) low = i+1;
+		else high = i-1;
+	}
+	if (j==-1 || index->numSats[j]<0) return 0;
+
+	epoch->numSatellites = index->numSats[j];
+	for (i=0;i<epoch->numSatellites;i++) {
+		epoch->sat[i].GNSS = (enum GNSSystem)index->satGNSS[index->firstSat[j]+i];
+		epoch->sat[i].PRN = (int)index->satPRN[index->firstSat[j]+i];
+		if (epoch->sat[i].GNSS==GPS) epoch->lastSBASindex=i;
+		epoch->satIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]=i;
+		if (epoch->satCSIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]==-1) {
+			epoch->satCSIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]=*lastCSindex;
+			(*lastCSindex)++;
+		}
+	}
+
+	fseek(fd,index->end[j],SEEK_SET);
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : rewindEpochRinexObsIndex
+ * Description : Rewind one epoch backward in a RINEX observation file using
+ *               its offset index. If there is no index, the file is read
+ *               backwards
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * enum Source  src                I  N/A  Source of the RINEX file (RINEX2 or RINEX3)
+ * TRinexObsIndex *index           I  N/A  Offset index of the RINEX observation file (NULL if not built)
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Properly read
+ *                                         0 => Error or EOF (no more epochs)
+ *****************************************************************************/
+int rewindEpochRinexObsIndex (FILE *fd, enum Source src, TRinexObsIndex *index) {
+	int		i;
+	int		low,high;
+	long	pos;
+
+	if (index==NULL) return rewindEpochRinexObs(fd,src);
+
+	//Look for the last epoch starting before the current position
+	pos = ftell(fd);
+	low = 0;
+	high = index->numEpochs-1;
+	while (low<=high) {
+		i = (low+high)/2;
+		if (index->offset[i]<pos) low = i+1;
+		else high = i-1;
+	}
+	if (high<0) return 0;
+
+	fseek(fd,index->offset[high],SEEK_SET);
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : getEpochFromObsFile
+ * Description : This function reads the timestamp of the start of an epoch,
+ *                and leaves the file pointer to the same position. The epoch
+ *                is written in the TTime structure parameter
+ *               IMPORTANT: This function assumes that the next line to be
+ *                read is the start of the next epoch. If it is not the case,
+ *                this function will give an error.
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * enum Source  src                I  N/A  Source of the RINEX file (RINEX2 or RINEX3)
+ * TTime *t                        O  N/A  Timestamp read of the current epoch
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Timestamp of start of epoch read
+ *                                         0 => No start of epoch found
+ *****************************************************************************/
+int getEpochFromObsFile (FILE *fd, enum Source src, TTime *t) {
+	int			ret;
+	int			yy=-1,mm=-1,dd=-1,hour=-1,min=-1;
+	int 		len = 0;
+	char 		line[MAX_INPUT_LINE];
+	char    	aux[100];
+	double		seconds;
+	struct tm   tm;
+
+	ret = getL(line,&len,fd);
+
+	if (ret==-1) {
+		getLback(line,&len,fd);
+		return 0;
+	} else if (src == RINEX2) {
+		getstr(aux,line,0,4);
+		yy = tm.tm_year = atoi(aux);
+		if (tm.tm_year <= 70) tm.tm_year += 100;
+		getstr(aux,line,3,4);
+		mm = atoi(aux);
+		tm.tm_mon  = mm - 1;
+		getstr(aux,line,6,4);
+		dd = tm.tm_mday = atoi(aux);
+		getstr(aux,line,9,4);
+		if(aux[1]=='.'||aux[2]=='.') {
+			hour= tm.tm_hour = -1;
+		} else {
+			hour = tm.tm_hour = atoi(aux);
+		}
+		getstr(aux,line,12,4);
+		min = tm.tm_min  = atoi(aux);
+		getstr(aux,line,16,10);
+		tm.tm_sec  = atoi(aux);
+		seconds = atof(aux);
+	} else {
+		//RINEX v3
+		if (line[0]=='>' && len<60) {
+			//Line with valid epoch
+			getstr(aux,line,2,4);
+			yy =  atoi(aux);
+			if (yy>=2000) yy-=2000;
+			else yy-=1900;
+			tm.tm_year = atoi(aux)-1900;
+			getstr(aux,line,7,2);
+			mm = atoi(aux);
+			tm.tm_mon = mm-1;
+			getstr(aux,line,10,2);
+			dd = tm.tm_mday = atoi(aux);
+			getstr(aux,line,13,2);
+			hour = tm.tm_hour = atoi(aux);
+			getstr(aux,line,16,2);
+			min = tm.tm_min  = atoi(aux);
+			getstr(aux,line,19,10);
+			tm.tm_sec  = atoi(aux);
+			seconds = atof(aux);
+		} else {
+			hour=-1;
+		}
+	}
+	if (yy>=0 && yy<=99 && mm>=1 && mm<=12 && dd>=1 && dd<=31 && hour>=0 && hour<=23 && min>=0 &&min<=59) {
+		//Epoch timestamp found
+		t->MJDN = MJDN(&tm);
+		t->SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+		getLback(line,&len,fd);
+		return 1;
+	}
+	getLback(line,&len,fd);
+	return 0;
+}
+
+/*****************************************************************************
+ * Name        : getCompleteLine
+ * Description : Read a line from a file being written. Only lines ended with
+ *               a newline are complete, as the rest of the line may not have
+ *               been written yet
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *line                     O  N/A  Buffer to write to
+ * int  *len                       O  N/A  Length of the line
+ * FILE  *fd                       I  N/A  File descriptor
+ * Returned value (int)            O  N/A  1 => Complete line read
+ *                                         0 => End of file or incomplete line
+ *****************************************************************************/
+static int getCompleteLine (char *line, int *len, FILE *fd) {
+	if (getL(line,len,fd)==-1) return 0;
+	if (*len==0 || line[*len-1]!='\n') return 0;
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : isRinexObsEpochComplete
+ * Description : Check if the next epochs of a RINEX observation file being
+ *               written are complete, so readRinexObsEpoch can read them.
+ *               The epoch records are counted from the epoch header lines
+ *               without decoding the measurements. Event epochs are read
+ *               together with the following epoch, and headers (at the
+ *               beginning of the file or concatenated) must be complete up to
+ *               the END OF HEADER line. The file position is not changed
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TEpoch  *epoch                  I  N/A  TEpoch structure
+ * int  numEpochs                  I  N/A  Number of epochs that must be complete
+ * Returned value (int)            O  N/A  1 => The epochs are complete
+ *                                         0 => The epochs are not fully written yet
+ *****************************************************************************/
+int isRinexObsEpochComplete (FILE *fd, TEpoch *epoch, int numEpochs) {
+	char		line[MAX_INPUT_LINE];
+	int			len = 0;
+	long		pos;
+	int			numComplete = 0;
+	int			readingHeader = 0;
+	int			flag;
+	int			numRecords;
+	int			linesPerSat;
+	int			numObs;
+	int			i,n;
+	enum Source	source;
+
+	pos = ftell(fd);
+	if (pos<0) return 0;
+
+	source = epoch->source;
+	numObs = epoch->measOrder[GPS].nDiffMeasurements;
+
+	while (numComplete<numEpochs) {
+		if (getCompleteLine(line,&len,fd)==0) break;
+		if (len>=80 && strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
+			readingHeader = 1;
+			n = (int)getDoubleField(line,len,0,9);
+			if (n==2) source = RINEX2;
+			else if (n==3) source = RINEX3;
+			continue;
+		} else if (readingHeader) {
+			if (len>=79 && strncmp(&line[60],"# / TYPES OF OBSERV",19)==0) {
+				// Continuation lines have the number of types blank
+				n = getIntField(line,len,0,6);
+				if (n>0) numObs = n;
+			} else if (len>=73 && strncmp(&line[60],"END OF HEADER",13)==0) {
+				readingHeader = 0;
+			}
+			continue;
+		}
+
+		if (source==RINEX3) {
+			if (line[0]!='>') continue;
+			flag = getIntField(line,len,30,2);
+			numRecords = getIntField(line,len,33,2);
+			linesPerSat = 1;
+		} else {
+			flag = getIntField(line,len,27,2);
+			numRecords = getIntField(line,len,30,2);
+			linesPerSat = numObs>5?(numObs+4)/5:1;
+		}
+
+		if (flag>1) {
+			// Event epoch: the records are special records, and the data epoch comes next
+			for (i=0;i<numRecords;i++) {
+				if (getCompleteLine(line,&len,fd)==0) break;
+			}
+			if (i<numRecords) break;
+			continue;
+		}
+		// RINEX 2 has the list of satellites in the epoch line (12 per line)
+		n = numRecords*linesPerSat;
+		if (source!=RINEX3 && numRecords>12) n += (numRecords-1)/12;
+		for (i=0;i<n;i++) {
+			if (getCompleteLine(line,&len,fd)==0) break;
+		}
+		if (i<n) break;
+		numComplete++;
+	}
+
+	clearerr(fd);
+	fseek(fd,pos,SEEK_SET);
+
+	return numComplete>=numEpochs;
+}
+
+/*****************************************************************************
+ * Name        : waitRinexObsEpoch
+ * Description : In follow mode, wait until the next epochs of the RINEX
+ *               observation file are fully written
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TFollowFile  *follow            IO N/A  TFollowFile structure of the file
+ * TEpoch  *epoch                  I  N/A  TEpoch structure
+ * int  numEpochs                  I  N/A  Number of epochs that must be complete
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  1 => The epochs are complete
+ *                                         0 => No new epochs during the follow
+ *                                              mode timeout
+ *****************************************************************************/
+int waitRinexObsEpoch (FILE *fd, TFollowFile *follow, TEpoch *epoch, int numEpochs, TOptions *options) {
+	double	startTime;
+	double	elapsed;
+	double	wait;
+
+	startTime = perfClock();
+	while (1) {
+		if (isRinexObsEpochComplete(fd,epoch,numEpochs)==1) {
+			follow->availableTime = perfClock();
+			return 1;
+		}
+		elapsed = perfClock()-startTime;
+		wait = FOLLOWRECHECKINTERVAL;
+		if (options->followTimeout>0.) {
+			if (elapsed>=options->followTimeout) return 0;
+			wait = min(wait,options->followTimeout-elapsed);
+		}
+		waitFollowFile(follow,wait);
+	}
+}
+
+/*****************************************************************************
+ * Name        : getProductsCacheFilename
+ * Description : Build the name of the binary cache file of a products file.
+ *               The name is built from a hash (FNV-1a 64 bits) of the file 
+ *               contents and its size, so any change in the file gives a
+ *               different cache file. The file must be at its beginning, and
+ *               it is rewinded to the beginning after computing the hash
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor of the products file
+ * char  *cacheDir                 I  N/A  Directory where cache files are stored
+ * char  *productType              I  N/A  Product type string (NAV, SP3)
+ * int  flags                      I  N/A  Reading flags that change the parsed data
+ * char  *cacheFilename            O  N/A  Cache filename
+ * Returned value (int)            O  N/A  1 => Cache filename built
+ *                                         0 => File can not be used with the cache
+ *****************************************************************************/
+int getProductsCacheFilename (FILE *fd, char *cacheDir, char *productType, int flags, char *cacheFilename) {
+	unsigned long long	hash=14695981039346656037ULL;
+	unsigned char		buffer[65536];
+	size_t				i,n;
+	long				size=0;
+
+	if (cacheDir==NULL || cacheDir[0]=='\0') return 0;
+	if (ftell(fd)!=0) return 0; //Only whole files are cached
+
+	while ((n=fread(buffer,1,sizeof(buffer),fd))>0) {
+		for(i=0;i<n;i++) {
+			hash^=(unsigned long long)buffer[i];
+			hash*=1099511628211ULL;
+		}
+		size+=(long)n;
+	}
+	if (ferror(fd)) {
+		clearerr(fd);
+		fseek(fd,0,SEEK_SET);
+		return 0;
+	}
+	clearerr(fd);
+	fseek(fd,0,SEEK_SET);
+
+	if (strlen(cacheDir)>MAX_INPUT_LINE-100) return 0;
+	sprintf(cacheFilename,"%s/gLAB_%s_%016llx_%ld_%d.cache",cacheDir,productType,hash,size,flags);
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : writeProductsCacheHeader
+ * Description : Write the header of a binary cache file. It includes the sizes
+ *               of the structures, so cache files written by a different 
+ *               gLAB build are not used
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor of the cache file
+ * Returned value (int)            O  N/A  1 => Header written
+ *                                         0 => Error
+ *****************************************************************************/
+int writeProductsCacheHeader (FILE *fd) {
+	int		header[6];
+
+	header[0]=PRODUCTSCACHEVERSION;
+	header[1]=(int)sizeof(TSP3products);
+	header[2]=(int)sizeof(TSP3orbitblock);
+	header[3]=(int)sizeof(TSP3clockblock);
+	header[4]=(int)sizeof(TBRDCproducts);
+	header[5]=(int)sizeof(TBRDCblock);
+
+	if (fwrite(PRODUCTSCACHEMAGIC,1,strlen(PRODUCTSCACHEMAGIC),fd)!=strlen(PRODUCTSCACHEMAGIC)) return 0;
+	if (fwrite(header,sizeof(int),6,fd)!=6) return 0;
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : checkProductsCacheHeader
+ * Description : Check that the header of a binary cache file matches with the
+ *               current gLAB build
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor of the cache file
+ * Returned value (int)            O  N/A  1 => Header is valid
+ *                                         0 => Header is not valid
+ *****************************************************************************/
+int checkProductsCacheHeader (FILE *fd) {
+	char	magic[10];
+	int		header[6];
+
+	if (fread(magic,1,strlen(PRODUCTSCACHEMAGIC),fd)!=strlen(PRODUCTSCACHEMAGIC)) return 0;
+	if (strncmp(magic,PRODUCTSCACHEMAGIC,strlen(PRODUCTSCACHEMAGIC))!=0) return 0;
+	if (fread(header,sizeof(int),6,fd)!=6) return 0;
+	if (header[0]!=PRODUCTSCACHEVERSION) return 0;
+	if (header[1]!=(int)sizeof(TSP3products)) return 0;
+	if (header[2]!=(int)sizeof(TSP3orbitblock)) return 0;
+	if (header[3]!=(int)sizeof(TSP3clockblock)) return 0;
+	if (header[4]!=(int)sizeof(TBRDCproducts)) return 0;
+	if (header[5]!=(int)sizeof(TBRDCblock)) return 0;
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : closeProductsCacheFile
+ * Description : Close a cache file being written and move it to its final name.
+ *               The file is written with a temporary name and renamed at the end,
+ *               so other gLAB processes never read a partially written cache file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor of the cache file
+ * char  *tmpFilename              I  N/A  Temporary filename
+ * char  *cacheFilename            I  N/A  Final cache filename
+ * Returned value (int)            O  N/A  1 => Cache file written
+ *                                         0 => Error
+ *****************************************************************************/
+int closeProductsCacheFile (FILE *fd, char *tmpFilename, char *cacheFilename) {
+	int		error;
+
+	error=ferror(fd);
+	if (fclose(fd)!=0) error=1;
+	if (error || rename(tmpFilename,cacheFilename)!=0) {
+		remove(tmpFilename);
+		return 0;
+	}
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : readRinexNavCache
+ * Description : Read the navigation products from a binary cache file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *cacheFilename            I  N/A  Cache filename
+ * TGNSSproducts  *products        O  N/A  Structure to save the data
+ * double *rinexNavVersion         O  N/A  Rinex Navigation version number
+ * Returned value (int)            O  N/A  1 => Products read from cache
+ *                                         0 => Cache not available
+ *****************************************************************************/
+int readRinexNavCache (char *cacheFilename, TGNSSproducts *products, double *rinexNavVersion) {
+	FILE			*fd;
+	int				i;
+	int				error=0;
+	TBRDCproducts	*BRDCprod;
+
+	fd=fopen(cacheFilename,"rb");
+	if (fd==NULL) return 0;
+	if (checkProductsCacheHeader(fd)==0) {
+		fclose(fd);
+		return 0;
+	}
+
+	BRDCprod=malloc(sizeof(TBRDCproducts));
+	if (fread(rinexNavVersion,sizeof(double),1,fd)!=1) error=1;
+	if (!error && fread(BRDCprod,sizeof(TBRDCproducts),1,fd)!=1) error=1;
+	if (!error && BRDCprod->numsats<0) error=1;
+	if (error) {
+		free(BRDCprod);
+		fclose(fd);
+		return 0;
+	}
+	BRDCprod->blockPast=NULL;
+	BRDCprod->numblocksPast=NULL;
+	BRDCprod->block=NULL;
+	BRDCprod->numblocks=NULL;
+
+	if (BRDCprod->numsats>0) {
+		BRDCprod->numblocks=malloc(sizeof(int)*BRDCprod->numsats);
+		BRDCprod->block=malloc(sizeof(TBRDCblock*)*BRDCprod->numsats);
+		for(i=0;i<BRDCprod->numsats;i++) BRDCprod->block[i]=NULL;
+		if (fread(BRDCprod->numblocks,sizeof(int),BRDCprod->numsats,fd)!=(size_t)BRDCprod->numsats) error=1;
+		for(i=0;i<BRDCprod->numsats && !error;i++) {
+			if (BRDCprod->numblocks[i]<=0) continue;
+			BRDCprod->block[i]=malloc(sizeof(TBRDCblock)*BRDCprod->numblocks[i]);
+			if (fread(BRDCprod->block[i],sizeof(TBRDCblock),BRDCprod->numblocks[i],fd)!=(size_t)BRDCprod->numblocks[i]) error=1;
+		}
+	}
+	fclose(fd);
+
+	if (error) {
+		for(i=0;i<BRDCprod->numsats;i++) free(BRDCprod->block[i]);
+		free(BRDCprod->block);
+		free(BRDCprod->numblocks);
+		free(BRDCprod);
+		return 0;
+	}
+
+	products->BRDC=BRDCprod;
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : writeRinexNavCache
+ * Description : Write the navigation products to a binary cache file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *cacheFilename            I  N/A  Cache filename
+ * TGNSSproducts  *products        I  N/A  Structure with the data
+ * double rinexNavVersion          I  N/A  Rinex Navigation version number
+ * Returned value (int)            O  N/A  1 => Cache file written
+ *                                         0 => Error
+ *****************************************************************************/
+int writeRinexNavCache (char *cacheFilename, TGNSSproducts *products, double rinexNavVersion) {
+	FILE			*fd;
+	int				i;
+	char			tmpFilename[MAX_OUTPUT_FILENAME];
+	TBRDCproducts	*BRDCprod=products->BRDC;
+
+	mkdir_recursive(cacheFilename);
+	sprintf(tmpFilename,"%s.%d.tmp",cacheFilename,(int)getpid());
+	fd=fopen(tmpFilename,"wb");
+	if (fd==NULL) return 0;
+
+	writeProductsCacheHeader(fd);
+	fwrite(&rinexNavVersion,sizeof(double),1,fd);
+	fwrite(BRDCprod,sizeof(TBRDCproducts),1,fd);
+	if (BRDCprod->numsats>0) {
+		fwrite(BRDCprod->numblocks,sizeof(int),BRDCprod->numsats,fd);
+		for(i=0;i<BRDCprod->numsats;i++) {
+			if (BRDCprod->numblocks[i]>0) {
+				fwrite(BRDCprod->block[i],sizeof(TBRDCblock),BRDCprod->numblocks[i],fd);
+			}
+		}
+	}
+
+	return closeProductsCacheFile(fd,tmpFilename,cacheFilename);
+}
+
+/*****************************************************************************
+ * Name        : readSP3Cache
+ * Description : Read the SP3 products from a binary cache file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *cacheFilename            I  N/A  Cache filename
+ * TGNSSproducts  *products        O  N/A  Structure to save the data
+ * Returned value (int)            O  N/A  1 => Products read from cache
+ *                                         0 => Cache not available
+ *****************************************************************************/
+int readSP3Cache (char *cacheFilename, TGNSSproducts *products) {
+	FILE			*fd;
+	int				i,n;
+	int				nOrbits=0,nClocks=0;
+	int				error=0;
+	int				numRecordsSat;
+	TSP3products	*SP3prod;
+
+	fd=fopen(cacheFilename,"rb");
+	if (fd==NULL) return 0;
+	if (checkProductsCacheHeader(fd)==0) {
+		fclose(fd);
+		return 0;
+	}
+
+	SP3prod=malloc(sizeof(TSP3products));
+	if (fread(SP3prod,sizeof(TSP3products),1,fd)!=1) {
+		free(SP3prod);
+		fclose(fd);
+		return 0;
+	}
+	for(i=0;i<MAX_GNSS*MAX_SATELLITES_PER_GNSS;i++) {
+		SP3prod->orbits.Concatblock[i]=NULL;
+		SP3prod->clocks.Concatblock[i]=NULL;
+	}
+	SP3prod->orbits.accuracy=NULL;
+	SP3prod->orbits.block=NULL;
+	SP3prod->clocks.block=NULL;
+
+	//Orbits
+	if (fread(&n,sizeof(int),1,fd)!=1) error=1;
+	if (!error && n>0) {
+		SP3prod->orbits.accuracy=malloc(sizeof(double)*n);
+		if (fread(SP3prod->orbits.accuracy,sizeof(double),n,fd)!=(size_t)n) error=1;
+	}
+	if (!error && fread(&n,sizeof(int),1,fd)!=1) error=1;
+	if (!error && n>0) {
+		nOrbits=n;
+		SP3prod->orbits.block=malloc(sizeof(TSP3orbitblock*)*n);
+		for(i=0;i<n;i++) SP3prod->orbits.block[i]=NULL;
+		for(i=0;i<n && !error;i++) {
+			if (fread(&numRecordsSat,sizeof(int),1,fd)!=1) {error=1; break;}
+			if (numRecordsSat<0) continue;
+			SP3prod->orbits.block[i]=malloc(sizeof(TSP3orbitblock)*(numRecordsSat>0?numRecordsSat:1));
+			if (fread(SP3prod->orbits.block[i],sizeof(TSP3orbitblock),numRecordsSat,fd)!=(size_t)numRecordsSat) error=1;
+		}
+	}
+
+	//Clocks
+	if (!error && fread(&n,sizeof(int),1,fd)!=1) error=1;
+	if (!error && n>0) {
+		nClocks=n;
+		SP3prod->clocks.block=malloc(sizeof(TSP3clockblock*)*n);
+		for(i=0;i<n;i++) SP3prod->clocks.block[i]=NULL;
+		for(i=0;i<n && !error;i++) {
+			if (fread(&numRecordsSat,sizeof(int),1,fd)!=1) {error=1; break;}
+			if (numRecordsSat<0) continue;
+			SP3prod->clocks.block[i]=malloc(sizeof(TSP3clockblock)*(numRecordsSat>0?numRecordsSat:1));
+			if (fread(SP3prod->clocks.block[i],sizeof(TSP3clockblock),numRecordsSat,fd)!=(size_t)numRecordsSat) error=1;
+		}
+	}
+	fclose(fd);
+
+	if (error) {
+		for(i=0;i<nOrbits;i++) free(SP3prod->orbits.block[i]);
+		for(i=0;i<nClocks;i++) free(SP3prod->clocks.block[i]);
+		free(SP3prod->orbits.block);
+		free(SP3prod->orbits.accuracy);
+		free(SP3prod->clocks.block);
+		free(SP3prod);
+		return 0;
+	}
+
+	products->type = SP3;
+	products->SP3 = SP3prod;
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : writeSP3Cache
+ * Description : Write the SP3 products to a binary cache file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *cacheFilename            I  N/A  Cache filename
+ * TGNSSproducts  *products        I  N/A  Structure with the data
+ * Returned value (int)            O  N/A  1 => Cache file written
+ *                                         0 => Error
+ *****************************************************************************/
+int writeSP3Cache (char *cacheFilename, TGNSSproducts *products) {
+	FILE			*fd;
+	int				i,n;
+	int				numRecordsSat;
+	char			tmpFilename[MAX_OUTPUT_FILENAME];
+	TSP3products	*SP3prod=products->SP3;
+
+	mkdir_recursive(cacheFilename);
+	sprintf(tmpFilename,"%s.%d.tmp",cacheFilename,(int)getpid());
+	fd=fopen(tmpFilename,"wb");
+	if (fd==NULL) return 0;
+
+	writeProductsCacheHeader(fd);
+	fwrite(SP3prod,sizeof(TSP3products),1,fd);
+
+	//Orbits. For each satellite, the number of records is written (-1 if the satellite has no data)
+	n=(SP3prod->orbits.accuracy!=NULL)?SP3prod->orbits.numSatellites:0;
+	fwrite(&n,sizeof(int),1,fd);
+	if (n>0) fwrite(SP3prod->orbits.accuracy,sizeof(double),n,fd);
+	n=(SP3prod->orbits.block!=NULL)?SP3prod->orbits.numSatellites:0;
+	fwrite(&n,sizeof(int),1,fd);
+	for(i=0;i<n;i++) {
+		numRecordsSat=(SP3prod->orbits.block[i]!=NULL)?SP3prod->orbits.numRecords:-1;
+		fwrite(&numRecordsSat,sizeof(int),1,fd);
+		if (numRecordsSat>0) fwrite(SP3prod->orbits.block[i],sizeof(TSP3orbitblock),numRecordsSat,fd);
+	}
+
+	//Clocks
+	n=(SP3prod->clocks.block!=NULL)?SP3prod->clocks.numSatellites:0;
+	fwrite(&n,sizeof(int),1,fd);
+	for(i=0;i<n;i++) {
+		numRecordsSat=(SP3prod->clocks.block[i]!=NULL)?SP3prod->clocks.numRecords:-1;
+		fwrite(&numRecordsSat,sizeof(int),1,fd);
+		if (numRecordsSat>0) fwrite(SP3prod->clocks.block[i],sizeof(TSP3clockblock),numRecordsSat,fd);
+	}
+
+	return closeProductsCacheFile(fd,tmpFilename,cacheFilename);
+}
+
+/*****************************************************************************
+ * Name        : writeSummaryStat
+ * Description : Write the samples (or the histogram) of a TSummaryStat
+ *               structure to a binary summary file
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor of the summary file
+ * TSummaryStat  *stat             I  N/A  TSummaryStat structure
+ *****************************************************************************/
+void writeSummaryStat (FILE *fd, TSummaryStat *stat) {
+	fwrite(&stat->numSamples,sizeof(int),1,fd);
+	fwrite(&stat->sketch,sizeof(int),1,fd);
+	fwrite(&stat->numBins,sizeof(int),1,fd);
+	fwrite(&stat->minValue,sizeof(double),1,fd);
+	fwrite(&stat->maxValue,sizeof(double),1,fd);
+	if (stat->sketch) {
+		fwrite(stat->bins,sizeof(int),stat->numBins,fd);
+	} else if (stat->numSamples>0) {
+		fwrite(stat->values,sizeof(double),stat->numSamples,fd);
+	}
+}
+
+/*****************************************************************************
+ * Name        : readSummaryStat
+ * Description : Read a TSummaryStat structure from a binary summary file. The
+ *               structure is initialised here and must be freed with
+ *               freeSummaryStat
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor of the summary file
+ * TSummaryStat  *stat             O  N/A  TSummaryStat structure
+ * Returned value (int)            O  N/A  1 => TSummaryStat read
+ *                                         0 => Error
+ *****************************************************************************/
+int readSummaryStat (FILE *fd, TSummaryStat *stat) {
+	int		numSamples,sketch,numBins;
+
+	initSummaryStat(stat,0);
+	if (fread(&numSamples,sizeof(int),1,fd)!=1) return 0;
+	if (fread(&sketch,sizeof(int),1,fd)!=1) return 0;
+	if (fread(&numBins,sizeof(int),1,fd)!=1) return 0;
+	if (numSamples<0) return 0;
+
+	initSummaryStat(stat,sketch!=0);
+	//The histogram bins depend on the SUMMARY_SKETCH values of the gLAB build
+	if (stat->numBins!=numBins) return 0;
+	if (fread(&stat->minValue,sizeof(double),1,fd)!=1) return 0;
+	if (fread(&stat->maxValue,sizeof(double),1,fd)!=1) return 0;
+	if (stat->sketch) {
+		if (fread(stat->bins,sizeof(int),stat->numBins,fd)!=(size_t)stat->numBins) return 0;
+	} else if (numSamples>0) {
+		stat->allocated = numSamples;
+		stat->values = malloc(sizeof(double)*numSamples);
+		if (fread(stat->values,sizeof(double),numSamples,fd)!=(size_t)numSamples) return 0;
 	}
-	
-	//Write header lines for RINEX observation file with user added error
-	if (fdout!=NULL && epoch->DGNSSstruct==0) {
-		writeRinexObsHeaderUserAddedError(fdout,headerlines,numheaderlines);
-		for(i=0;i<numheaderlines;i++) {
-			free(headerlines[i]);
-		}
-		free(headerlines);
+	stat->numSamples = numSamples;
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : writeSummaryFile
+ * Description : Write the summary data and the samples of the summary to a
+ *               binary file, so it can be merged later with '-summary:merge'
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *filename                 I  N/A  Summary filename
+ * TSummaryData  *summary          I  N/A  TSummaryData structure
+ * TSummaryStat  **stat            I  N/A  Vector of SUMMARY_NUM_STATS TSummaryStat structures
+ * Returned value (int)            O  N/A  1 => Summary file written
+ *                                         0 => Error
+ *****************************************************************************/
+int writeSummaryFile (char *filename, TSummaryData *summary, TSummaryStat **stat) {
+	FILE	*fd;
+	int		i;
+	int		header[3];
+	int		error;
+
+	fd=fopen(filename,"wb");
+	if (fd==NULL) return 0;
+
+	header[0]=SUMMARYFILEVERSION;
+	header[1]=(int)sizeof(TSummaryData);
+	header[2]=SUMMARY_NUM_STATS;
+
+	fwrite(SUMMARYFILEMAGIC,1,strlen(SUMMARYFILEMAGIC),fd);
+	fwrite(header,sizeof(int),3,fd);
+	fwrite(summary,sizeof(TSummaryData),1,fd);
+	for(i=0;i<SUMMARY_NUM_STATS;i++) {
+		writeSummaryStat(fd,stat[i]);
 	}
 
-	//Check for non quantizied SNR measurements
-	if (options->solutionMode==PPPMode) {
-		//Get SNR for both frequencies
-		i=epoch->measOrder[GPS].meas2Ind[S1P];
-		if (i==-1) {
-			i=epoch->measOrder[GPS].meas2Ind[S1C];
-		}
-		if (i==-1) {
-			i=epoch->measOrder[GPS].meas2Ind[S1W];
-		}
-		j=epoch->measOrder[GPS].meas2Ind[S2P];
-		if (j==-1) {
-			j=epoch->measOrder[GPS].meas2Ind[S2C];
-		} 
-		if (j==-1) {
-			j=epoch->measOrder[GPS].meas2Ind[S2W];
-		}
-		if (i!=-1 && j!=-1) {
-			//GPS has non quantizied SNR measurements for both frequencies. Save positions
-			epoch->measOrder[GPS].hasSNRmeas=1;
-			epoch->measOrder[GPS].SNRmeaspos[1]=i;
-			epoch->measOrder[GPS].SNRmeaspos[2]=j;
+	error=ferror(fd);
+	if (fclose(fd)!=0) error=1;
+
+	return !error;
+}
+
+/*****************************************************************************
+ * Name        : readSummaryFile
+ * Description : Read the summary data and the samples of a summary saved with
+ *               '-summary:save'. The TSummaryStat structures must be freed
+ *               with freeSummaryStat, even if the file could not be read
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *filename                 I  N/A  Summary filename
+ * TSummaryData  *summary          O  N/A  TSummaryData structure
+ * TSummaryStat  *stat             O  N/A  Vector of SUMMARY_NUM_STATS TSummaryStat structures
+ * Returned value (int)            O  N/A  1 => Summary file read
+ *                                         0 => File not found, not a summary file or
+ *                                              written by a different gLAB build
+ *****************************************************************************/
+int readSummaryFile (char *filename, TSummaryData *summary, TSummaryStat *stat) {
+	FILE	*fd;
+	char	magic[10];
+	int		i;
+	int		header[3];
+	int		error=0;
+
+	for(i=0;i<SUMMARY_NUM_STATS;i++) {
+		initSummaryStat(&stat[i],0);
+	}
+
+	fd=fopen(filename,"rb");
+	if (fd==NULL) return 0;
+
+	if (fread(magic,1,strlen(SUMMARYFILEMAGIC),fd)!=strlen(SUMMARYFILEMAGIC)) error=1;
+	if (!error && strncmp(magic,SUMMARYFILEMAGIC,strlen(SUMMARYFILEMAGIC))!=0) error=1;
+	if (!error && fread(header,sizeof(int),3,fd)!=3) error=1;
+	if (!error && (header[0]!=SUMMARYFILEVERSION || header[1]!=(int)sizeof(TSummaryData) || header[2]!=SUMMARY_NUM_STATS)) error=1;
+	if (!error && fread(summary,sizeof(TSummaryData),1,fd)!=1) error=1;
+	for(i=0;i<SUMMARY_NUM_STATS && !error;i++) {
+		if (readSummaryStat(fd,&stat[i])==0) error=1;
+	}
+	fclose(fd);
+
+	return !error;
+}
+
+/*****************************************************************************
+ * Name        : readRinexNav
+ * Description : Read a RINEX navigation file from a file descriptor
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TGNSSproducts  *products        O  N/A  Structure to save the data
+ * double *rinexNavVersion         O  N/A  Rinex Navigation version number
+ * TOptions  *options              I  N/A  TOptions structure (NULL disables the products cache)
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Properly read
+ *                                         2 => Another file concatenated
+ *                                         0 => Error
+ *****************************************************************************/
+int readRinexNav (FILE *fd, TGNSSproducts *products, double *rinexNavVersion, TOptions *options) {
+	char						line[MAX_INPUT_LINE];
+	char						aux[100];
+	double						field[4];
+	char						ConstellationType[2];
+	int 						len = 0;
+	int							properlyRead = 0;
+	int							readingHeader = 1;
+	int							i,j;
+	unsigned int				k;  //to avoid warning: comparison between signed and unsigned integer expressions
+	TBRDCblock					block;
+	struct tm					tm;
+	double						seconds;
+	int							row;
+	int							indSat, indBlock;
+	enum TimeSystemCorrection	timecorr;	
+	enum GNSSystem				satSystem;
+	int							GPSweek;
+	double						SoW;
+	int							DoW;	//Day of Week
+	int							useCache = 0;
+	char						cacheFilename[MAX_OUTPUT_FILENAME];
+
+	products->type = BRDC;
+	// Products cache is only used when the whole file is read into an empty products structure
+	if ( products->BRDC == NULL && options != NULL ) {
+		if ( getProductsCacheFilename(fd, options->productsCacheDir, "NAV", 0, cacheFilename) == 1 ) {
+			if ( readRinexNavCache(cacheFilename, products, rinexNavVersion) == 1 ) {
+				fseek(fd, 0, SEEK_END);
+				return 1;
+			}
+			useCache = 1;
 		}
+	}
+	// If to avoid overwritten products structure when RINEX navigation are concatennated
+	if ( products->BRDC == NULL ) {
+		products->BRDC = malloc(sizeof(TBRDCproducts));
+		initBRDCproducts(products->BRDC);
 	} else {
-		//Get SNR for frequencies one
-		i=epoch->measOrder[GPS].meas2Ind[S1C];
-		if (i==-1) {
-			i=epoch->measOrder[GPS].meas2Ind[S1P];
-		}
-		if (i==-1) {
-			i=epoch->measOrder[GPS].meas2Ind[S1W];
+		if ( products->BRDC->numblocksPast!=NULL) {
+			//This is the third or more day we are reading. We need to free memory
+			for(i=0;i<products->BRDC->numsatsPast;i++) {
+				free(products->BRDC->blockPast[i]);
+			}
+			free(products->BRDC->numblocksPast);
+			free(products->BRDC->blockPast);
+			products->BRDC->numblocksPast=NULL;
+			products->BRDC->blockPast=NULL;
 		}
-		if (i!=-1) {
-			//GPS has non quantizied SNR measurements for both frequencies. Save positions
-			epoch->measOrder[GPS].hasSNRmeas=1;
-			epoch->measOrder[GPS].SNRmeaspos[1]=i;
+		memcpy(&products->BRDC->indexPast,&products->BRDC->index,sizeof(int)*MAX_GNSS*MAX_SATELLITES_PER_GNSS);
+		products->BRDC->blockPast=products->BRDC->block;
+		products->BRDC->numblocksPast=products->BRDC->numblocks;
+		products->BRDC->numsatsPast=products->BRDC->numsatsPast;
+		products->BRDC->numsats = 0;
+		products->BRDC->block = NULL;
+		products->BRDC->numblocks = NULL;
+		for (i=0;i<MAX_GNSS;i++) {
+			for (j=0;j<MAX_SATELLITES_PER_GNSS;j++) {
+				products->BRDC->index[i][j] = -1;
+			}
 		}
 	}
 
-	if (epoch->DGNSSstruct==0 && firstProgressCheck==1) {
-		firstProgressCheck=0;
-		//We need to enter if printProgress is enabled or if it is disabled but want to compute receiver interval
-		if (printProgress==1 || (printProgress==0 && epoch->receiver.interval==-1.) ) {
-			//Check that there was no error when reading the header
-			if (properlyRead==1 && error==0) {
-				//Compute number of epochs.
-				//Save current position in file
-				posEndHeader = ftell(fd);
-				for(i=0;i<3;i++) {
-					if (i==1) {
-						if (epoch->receiver.interval!=-1 && epoch->receiver.interval!=0.) {
-							interval=epoch->receiver.interval;	
-							continue;
-						} else {
-							//Interval is not in the header, read first and second epoch and compute the interval
-							//Maybe some observation files have a data gap for all satellite in second, but that is extemely rare
-						}
-					} else if (i==2) {
-						//We need to go to the end of the file.
-						//NOTE that fseek(fd, 0L, SEEK_END); does not work as we have opened the file in binary mode!!!
-						fstat(fileno(fd), &filestat);
-						filesize = filestat.st_size;
-						fseek(fd,filesize,SEEK_SET);
-						//Seek the beginning of the last epoch
-						rewindEpochRinexObs(fd, epoch->source);
+
+	initBRDCblock(&block);
+	ConstellationType[0] = '\0';
+	
+	while(getL(line,&len,fd)!=-1) {
+		if (strncmp(&line[60],"COMMENT",7)==0) continue; //Comment can also be in the middle of the file
+		if (readingHeader) {
+			if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
+				*rinexNavVersion = getDoubleField(line,len,0,9);
+				if ((int)(*rinexNavVersion)>3) {return 0;} //Version check
+				if((int)*(rinexNavVersion)==2 && line[20]=='G') {
+					// GLONASS Rinex v2 navigation file
+					satSystem=GLONASS;
+				} else if ((int)(*rinexNavVersion)==2 && line[20]=='H') {
+					// GEO Rinex v2 navigation file
+					satSystem=GEO;
+				} else if ((int)(*rinexNavVersion)==2) {
+					satSystem=GPS;
+				}
+			} else if (strncmp(&line[60],"ION ALPHA",9)==0) {  // Rinex v2
+				for (i=0;i<4;i++) {
+					getstr(aux,line,2+12*i,12);
+					for (k=0;k<strlen(aux);k++) {
+						if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
 					}
-					ErrorReadingEpochs=0;
-					while(1) {
-						if (getL(line,&len,fd)==-1) {
-							#if !defined (__WIN32__)
-								if (printProgress==1 && options->ProgressEndCharac=='\r') {
-									//If print progress was enabled, reenable the cursor
-									fprintf(options->terminalStream,"\033[?25h");
-								}
-							#endif
-							printProgress=0;
-							ErrorReadingEpochs=1;
-							break;
+					products->BRDC->ionA[i] = atof(aux);
+				}
+			} else if (strncmp(&line[60],"ION BETA",8)==0) {  // Rinex v2
+				for (i=0;i<4;i++) {
+					getstr(aux,line,2+12*i,12);
+					for (k=0;k<strlen(aux);k++) {
+						if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
+					}
+					products->BRDC->ionB[i] = atof(aux);
+				}
+			} else if (strncmp(&line[60],"IONOSPHERIC CORR",16)==0) {  // Rinex v3
+				if (strncmp(&line[0],"GPSA",4)==0) {
+					for (i=0;i<4;i++) {
+						getstr(aux,line,5+12*i,12);
+						for (k=0;k<strlen(aux);k++) {
+							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
 						}
-						//Read epoch time
-						if (epoch->source == RINEX2) {
-							getstr(aux,line,0,4);
-							yy = tm.tm_year = atoi(aux);
-							if (tm.tm_year <= 70) tm.tm_year += 100;
-							getstr(aux,line,3,4);
-							mm = atoi(aux);
-							tm.tm_mon  = mm - 1;
-							getstr(aux,line,6,4);
-							dd = tm.tm_mday = atoi(aux);
-							getstr(aux,line,9,4);
-							if(aux[1]=='.'||aux[2]=='.') {
-								hour= tm.tm_hour = -1;
-							} else {
-								hour = tm.tm_hour = atoi(aux);
-							}
-							getstr(aux,line,12,4);
-							min = tm.tm_min  = atoi(aux);
-							getstr(aux,line,16,10);
-							tm.tm_sec  = atoi(aux);
-							seconds = atof(aux);
-						} else {
-							//RINEX v3
-							if (line[0]=='>' && len<60) {
-								//Line with valid epoch
-								getstr(aux,line,2,4);
-								yy =  atoi(aux);
-								if (yy>=2000) yy-=2000;
-								else yy-=1900;
-								tm.tm_year = atoi(aux)-1900;
-								getstr(aux,line,7,2);
-								mm = atoi(aux);
-								tm.tm_mon = mm-1;
-								getstr(aux,line,10,2);
-								dd = tm.tm_mday = atoi(aux);
-								getstr(aux,line,13,2);
-								hour = tm.tm_hour = atoi(aux);
-								getstr(aux,line,16,2);
-								min = tm.tm_min  = atoi(aux);
-								getstr(aux,line,19,10);
-								tm.tm_sec  = atoi(aux);
-								seconds = atof(aux);
-							} else {
-								hour=-1;
-							}
+						products->BRDC->ionA[i] = atof(aux);
+					}
+				} else if (strncmp(&line[0],"GPSB",4)==0) {
+					for (i=0;i<4;i++) {
+						getstr(aux,line,5+12*i,12);
+						for (k=0;k<strlen(aux);k++) {
+							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
 						}
-						if (yy>=0 && yy<=99 && mm>=1 && mm<=12 && dd>=1 && dd<=31 && hour>=0 && hour<=23 && min>=0 &&min<=59) {
-							//Epoch timestamp found
-							break;
-                        } else if (i==2 && epoch->source == RINEX3) {
-                            //Check if last epoch is an event epoch without date
-                            getstr(aux,line,30,2);
-                            epochflag=atoi(aux);
-                            if (line[0]=='>' && len<60 && epochflag>1 ) {
-                                //Event epoch is the last epoch in file and it does not have the date in the epoch recod,
-                                //so we need to go another epoch back to get an epoch with data and full date
-                                getLback(line,&len,fd);
-                                rewindEpochRinexObs(fd, epoch->source);
-                            }
+						products->BRDC->ionB[i] = atof(aux);
+					}
+				} else if (strncmp(&line[0],"GAL",3)==0) {
+					for (i=0;i<4;i++) {
+						getstr(aux,line,5+12*i,12);
+						for (k=0;k<strlen(aux);k++) {
+							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
 						}
+						products->BRDC->ai[i] = atof(aux);
 					}
-					if (ErrorReadingEpochs==1) {
-						//Error when looking for epochs
-						if (i<2) {
-							//Interval could not be computed. Set interval to 1 to avoid division by zero
-							interval=epoch->receiver.intervalEstimate=1.;
-							//Disable Ncon filter as we don't know the file interval
-							options->csNcon = 0;
-							break;
+				} else if (strncmp(&line[0],"BDSA",4)==0) {
+					for (i=0;i<4;i++) {
+						getstr(aux,line,5+12*i,12);
+						for (k=0;k<strlen(aux);k++) {
+							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
 						}
-					} else if (printProgress==0 && i>1) {
-						break;
+						products->BRDC->bdsA[i] = atof(aux);
 					}
-					if (i==0) {
-						firstEpoch.MJDN = MJDN(&tm);
-						firstEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-					} else if (i==1) {
-						secondEpoch.MJDN = MJDN(&tm);
-						secondEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-						interval=tdiff(&secondEpoch,&firstEpoch);
-						if (interval<1E-4) {
-							//Epoch repeated due to an event epoch just in the first epoch
-							//Keep reading epochs until the epoch changes
-							i=0;
-							continue;
+				} else if (strncmp(&line[0],"BDSB",4)==0) {
+					for (i=0;i<4;i++) {
+						getstr(aux,line,5+12*i,12);
+						for (k=0;k<strlen(aux);k++) {
+							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
 						}
-						epoch->receiver.intervalEstimate=interval;
-						if ( epoch->receiver.intervalEstimate >= 15.0 ) {
-							options->csNcon = 0;
+						products->BRDC->bdsB[i] = atof(aux);
+					}
+				} else if (strncmp(&line[0],"QZSA",4)==0) {
+					for (i=0;i<4;i++) {
+						getstr(aux,line,5+12*i,12);
+						for (k=0;k<strlen(aux);k++) {
+							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
 						}
-						if (interval>=1.) {
-							epoch->receiver.intervalDecimalsFactor=1;
-							epoch->receiver.DecimateVal=1;
-						} else {
-							//Get the number of decimals
-							auxinterval=interval-(double)((int)(interval+.00005));
-							epoch->receiver.intervalDecimalsFactor=sprintf(aux,"%.4g",auxinterval)-2;
-							epoch->receiver.intervalDecimalsFactor=(int)(pow(10,(double)epoch->receiver.intervalDecimalsFactor));
-							epoch->receiver.DecimateVal=(long long int)((options->decimate+.00005)*(double)(epoch->receiver.intervalDecimalsFactor));
-							if (epoch->receiver.DecimateVal==0) {
-								//This is the case where user set an interval smaller than the number of decimals in the interval
-								//Therefore, set this value to 1, so all epochs are used (and also avoid dividing by 0)
-								epoch->receiver.DecimateVal=1;
-							}
+						products->BRDC->qzsA[i] = atof(aux);
+					}
+				} else if (strncmp(&line[0],"QZSB",4)==0) {
+					for (i=0;i<4;i++) {
+						getstr(aux,line,5+12*i,12);
+						for (k=0;k<strlen(aux);k++) {
+							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
 						}
-						if (printProgress==0) break;
-					} else {
-						if (options->StartEpoch.MJDN!=-1) {
-							//User selected an start epoch. Check if first epoch is before or after first epoch of file
-							if (tdiff(&firstEpoch,&options->StartEpoch)<0) {
-								//First epoch of file is before start epoch. Use user start epoch as first epoch
-								memcpy(&firstEpoch,&options->StartEpoch,sizeof(TTime));
+						products->BRDC->qzsB[i] = atof(aux);
+					}
+				} else if (strncmp(&line[0],"IRNA",4)==0) {
+					for (i=0;i<4;i++) {
+						getstr(aux,line,5+12*i,12);
+						for (k=0;k<strlen(aux);k++) {
+							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
+						}
+						products->BRDC->irnA[i] = atof(aux);
+					}
+				} else if (strncmp(&line[0],"IRNB",4)==0) {
+					for (i=0;i<4;i++) {
+						getstr(aux,line,5+12*i,12);
+						for (k=0;k<strlen(aux);k++) {
+							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
+						}
+						products->BRDC->irnB[i] = atof(aux);
+					}
+				}
+			} else if (strncmp(&line[60],"TIME SYSTEM CORR",16)==0) {  //Rinex v3
+				getstr(aux,line,0,4);
+				timecorr = timecorrstr2timecorrtype(aux); 
+				if ( timecorr != UNKNOWN_TIME_CORR){
+					products->BRDC->timeSysCorr[timecorr].acoff[0] = getDoubleField(line,len,5,17);
+					products->BRDC->timeSysCorr[timecorr].acoff[1] = getDoubleField(line,len,22,16);
+					products->BRDC->timeSysCorr[timecorr].timeref = getIntField(line,len,38,7);
+					products->BRDC->timeSysCorr[timecorr].weekref = getIntField(line,len,45,5);
+				}
+			} else if (strncmp(&line[60],"LEAP SECONDS",12)==0) {  
+				products->BRDC->AT_LS = getIntField(line,len,0,6);
+				getstr(aux,line,6,6);
+				if(aux[0] != '\0') { // No number given
+					products->BRDC->AT_LSF = atoi(aux);
+					if(products->BRDC->AT_LSF>0) {
+						products->BRDC->LeapSecondsAvail=1;
+					}
+				}
+				getstr(aux,line,12,6);
+				if(aux[0] != '\0') { // No number given
+					products->BRDC->WN_LSF = atoi(aux);
+				}
+				getstr(aux,line,18,6);
+				if(aux[0] != '\0') { // No number given
+					products->BRDC->DN = atoi(aux);
+				}
+			} else if (strncmp(&line[60],"END OF HEADER",13)==0) {
+				readingHeader = 0;
+				row = 0;
+				properlyRead = 1;
+			}
+		} else {  // Reading body
+			// Block to detect new RINEX header, it only affects when large RINEX are used
+			if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
+				getLback(line,&len,fd);
+				//properlyRead = 1;
+				//break;
+				return 2;
+			}
+			if ((int)(*rinexNavVersion)==2) {
+				if ( row == 0 ) {
+					block.PRN = getIntField(line,len,0,2);
+					tm.tm_year = getIntField(line,len,3,2);
+					if (tm.tm_year <= 70) tm.tm_year += 100;
+					tm.tm_mon  = getIntField(line,len,6,2)-1;
+					tm.tm_mday = getIntField(line,len,9,2);
+					tm.tm_hour = getIntField(line,len,12,2);
+					tm.tm_min  = getIntField(line,len,15,2);
+					tm.tm_sec  = getIntField(line,len,18,4);
+					seconds = getDoubleField(line,len,18,4);
+					block.Ttoc.MJDN = MJDN(&tm);
+					block.Ttoc.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+				}
+				field[0] = getDoubleField(line,len,3,19);
+				field[1] = getDoubleField(line,len,22,19);
+				field[2] = getDoubleField(line,len,41,19);
+				field[3] = getDoubleField(line,len,60,19);
+
+
+				switch (satSystem) {
+					case GPS:
+						switch (row) {
+							case 0:		
+								block.clockbias			= field[1];
+								block.clockdrift		= field[2];
+								block.clockdriftrate	= field[3];
+								break;
+							case 1:
+								block.IODE				= (int)field[0];
+								block.crs				= field[1];
+								block.deltan			= field[2];
+								block.M0				= field[3];
+								break;
+							case 2:
+								block.cuc				= field[0];
+								block.e					= field[1];
+								block.cus				= field[2];
+								block.sqrta				= field[3];
+								break;
+							case 3:
+								block.toe				= field[0];
+								block.cic				= field[1];
+								block.OMEGA				= field[2];
+								block.cis				= field[3];
+								break;
+							case 4:
+								block.i0				= field[0];
+								block.crc				= field[1];
+								block.omega				= field[2];
+								block.OMEGADOT			= field[3];
+								break;
+							case 5:
+								block.IDOT				= field[0];
+								block.codesOnL2			= (int)field[1];
+								block.GPSweek			= (int)field[2];
+								block.L2Pdataflag		= (int)field[3];
+								break;
+							case 6:
+								block.SVaccuracy		= field[0];
+								block.SVhealth			= (int)field[1];
+								block.TGD				= field[2];
+								block.IODC				= (int)field[3];
+								break;
+							case 7:
+								block.transTime			= field[0];
+								block.fitInterval		= (int)field[1];
+								if ( block.fitInterval == 0 ) block.fitInterval = 4;
+								break;
+						}
+						break;
+					case GLONASS: case GEO:
+						switch(row){
+							case 0:
+								block.clockbias     		        = field[1];
+								if (satSystem == GLONASS) {
+									block.clockdrift           	= field[2];
+									block.transTime			= field[3];
+								} else {
+									block.clockdrift                = field[2];
+									block.transTime			= field[3];
+								}
+								block.clockdriftrate			= 0.0;
+								//No IODE provided. Set it to -1
+								block.IODE						= -1;
+								block.SVaccuracy				= 0.;
+								break;
+							case 1:
+								block.satposX                           = field[0]*1000;
+								block.satvelX                           = field[1]*1000;
+								block.sataccX                           = field[2]*1000;
+								block.SVhealth                          = (int)field[3];
+								break;
+							case 2:
+								block.satposY                           = field[0]*1000;
+								block.satvelY                           = field[1]*1000;
+								block.sataccY                           = field[2]*1000;
+								if (satSystem == GLONASS) {
+									block.freqnumber                = (int)field[3];
+								} else {
+									block.URAGEO			= (int)field[3];
+								}
+								break;
+							case 3:
+								block.satposZ                           = field[0]*1000;
+								block.satvelZ                           = field[1]*1000;
+								block.sataccZ                           = field[2]*1000;
+								if (satSystem == GLONASS) {
+									block.ageofoperation            = (int)field[3];
+									block.fitInterval = 2; //For GLONASS, we will interpolate one hour back and one ahead
+								} else {
+									block.IODNGEO			= (int)field[3];
+									block.fitInterval = 4;
+								}
+								break;
+						}
+						break;
+					default:
+						break;
+				}
+				row++;
+				if ( row == 8 || (row==4 && (satSystem == GLONASS || satSystem == GEO ))) {
+					row = 0;
+					if (satSystem == GLONASS ) {
+						//Toc and Toe of GLONASS will be left in UTC because orbits will be computed in UTC time
+						block.Ttoe = block.Ttoc;
+						ttime2gpswsnoroll(&block.Ttoc,&GPSweek,&SoW);
+						//In Rinex v2, GLONASS transmission time is in UTC seconds of day!! We need to change to seconds of GPS Week
+						DoW=(int)(SoW/86400); //Get Day of Week from Toe
+						if(block.transTime<0) {
+							block.transTime+=86400;
+							DoW--;
+							if(DoW<0) {
+								DoW=6;
+								GPSweek--;
 							}
 						}
-						lastEpoch.MJDN = MJDN(&tm);
-						lastEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-						if (options->EndEpoch.MJDN!=-1) {
-							//User selected and ending epoch. Check if last epoch of file is before or after user selected epoch
-							if (tdiff(&lastEpoch,&options->EndEpoch)<0) {
-								//Last epoch of file is before user last epoch. Use file last epoch to compute number of epochs
-								epoch->numEpochsfile=tdiff(&lastEpoch,&firstEpoch)/interval;
-							} else {
-								//Last epoch of file is after user last epoch. Use user last epoch to compute number of epochs
-								epoch->numEpochsfile=tdiff(&options->EndEpoch,&firstEpoch)/interval;
+						//Transform transmission time from UTC to GPS time
+						block.transTime+=products->BRDC->AT_LS;
+						if(block.transTime>=86400) {
+							block.transTime-=86400;
+							DoW++;
+							if(DoW>6) {
+								DoW=0;
+								GPSweek++;
 							}
-						} else {
-							epoch->numEpochsfile=tdiff(&lastEpoch,&firstEpoch)/interval;
+
 						}
+						block.transTime+=DoW*86400;//Convert to seconds of week
+						block.TtransTime = gpsws2ttime(GPSweek,block.transTime);
+					} else if (satSystem == GEO ) {
+						block.Ttoe = block.Ttoc;
+						ttime2gpswsnoroll(&block.Ttoc,&GPSweek,&SoW);
+						block.TtransTime = gpsws2ttime(GPSweek,block.transTime);
+					} else {
+						block.Ttoe = gpsws2ttime(block.GPSweek,block.toe);
+						block.TtransTime = gpsws2ttime(block.GPSweek,block.transTime);
+					}
+					indSat = products->BRDC->index[satSystem][block.PRN];
+					if (indSat == -1) {
+						products->BRDC->index[satSystem][block.PRN] = products->BRDC->numsats;
+						indSat = products->BRDC->index[satSystem][block.PRN];
+						products->BRDC->block = realloc(products->BRDC->block,sizeof(TBRDCblock*)*(products->BRDC->numsats+1));
+						products->BRDC->numblocks = realloc(products->BRDC->numblocks,sizeof(int)*(products->BRDC->numsats+1));
+						products->BRDC->block[indSat] = NULL;
+						products->BRDC->numblocks[indSat] = 0;
+						products->BRDC->numsats++;
 					}
+					indBlock = products->BRDC->numblocks[indSat];
+					products->BRDC->block[indSat] = realloc(products->BRDC->block[indSat],sizeof(TBRDCblock)*(indBlock+1));
+					block.TtoeNs = t2ns(&block.Ttoe);
+					block.TtransTimeNs = t2ns(&block.TtransTime);
+					memcpy(&products->BRDC->block[indSat][indBlock], &block,sizeof(TBRDCblock));
+					products->BRDC->numblocks[indSat]++;
 				}
-				//Set the file position back to the first epoch
-				fseek(fd,posEndHeader,SEEK_SET);
-				//If backward filtering is enabled, double the number of epochs in file
-				if (options->filterIterations==2) {
-					epoch->numEpochsfile*=2;
+			}// End Nav Rinex v2
+			 // Start Nav Rinex v3
+			else if ((int)(*rinexNavVersion)==3) {
+				if (row==0) {
+					getstr(ConstellationType,line,0,1);	//GNSS type letter
+					satSystem = gnsschar2gnsstype(ConstellationType[0]);
+					if ( satSystem==QZSS || satSystem==IRNSS)  {row++;continue;} // QZSS and IRNSS are unsupported
+						block.PRN = getIntField(line,len,1,2);				//PRN
+						tm.tm_year = getIntField(line,len,4,4) -1900;		//Year
+						tm.tm_mon  = getIntField(line,len,9,2)-1;			//Month
+						tm.tm_mday = getIntField(line,len,12,2);			//Day
+						tm.tm_hour = getIntField(line,len,15,2);			//Hour
+						tm.tm_min  = getIntField(line,len,18,2);			//Minute
+						tm.tm_sec  = getIntField(line,len,21,2);			//Second
+						seconds = getDoubleField(line,len,21,2);
+						block.Ttoc.MJDN = MJDN(&tm);
+						block.Ttoc.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
 				}
-			} else {
-				//If error reading header, disable printing progress for precaution
-				#if !defined (__WIN32__)
-					if (printProgress==1 && options->ProgressEndCharac=='\r') {
-						//If print progress was enabled, reenable the cursor
-						fprintf(options->terminalStream,"\033[?25h");
-					}
-				#endif
-				printProgress=0;
-			}
-		}
-	} else if (epoch->DGNSSstruct==1 && firstProgressCheckDGNSS==1) {
-		firstProgressCheckDGNSS=0;
-		if (epoch->receiver.interval<=0.) {
-			//Receiver interval not available. Compute it
-			//Save current position in file
-			posEndHeader = ftell(fd);
-			for(i=0;i<2;i++) {
-				while(1) {
-					if (getL(line,&len,fd)==-1) {
-						//Interval cannot be computed. Set 1 to avoid division by 0
-						epoch->receiver.interval=1.;
-						return 0;
-					}
-					//Read epoch time
-					if (epoch->source == RINEX2) {
-						getstr(aux,line,0,4);
-						yy = tm.tm_year = atoi(aux);
-						if (tm.tm_year <= 70) tm.tm_year += 100;
-						getstr(aux,line,3,4);
-						mm = atoi(aux);
-						tm.tm_mon  = mm - 1;
-						getstr(aux,line,6,4);
-						dd = tm.tm_mday = atoi(aux);
-						getstr(aux,line,9,4);
-						if(aux[1]=='.'||aux[2]=='.') {
-							hour= tm.tm_hour = -1;
-						} else {
-							hour = tm.tm_hour = atoi(aux);
+				if ( satSystem==QZSS || satSystem==IRNSS ) { //QZSS and IRNSS are unsupported
+					row++;
+					if(row==8) { row=0;}	
+					continue;
+				} 
+				field[0] = getDoubleField(line,len,4,19);
+				field[1] = getDoubleField(line,len,23,19);
+				field[2] = getDoubleField(line,len,42,19);
+				field[3] = getDoubleField(line,len,61,19);
+
+				
+
+				switch (satSystem) {
+					case GPS: case Galileo: case BDS:
+						switch (row) {
+							case 0:
+								block.clockbias							= field[1];
+								block.clockdrift						= field[2];
+								block.clockdriftrate					= field[3];
+								break;
+							case 1:
+								block.IODE								= (int)field[0];
+								block.crs								= field[1];
+								block.deltan							= field[2];
+								block.M0								= field[3];
+								break;
+							case 2:
+								block.cuc								= field[0];
+								block.e									= field[1];
+								block.cus								= field[2];
+								block.sqrta								= field[3];
+								break;
+							case 3:
+								block.toe								= field[0];
+								block.cic								= field[1];
+								block.OMEGA								= field[2];
+								block.cis								= field[3];
+								break;
+							case 4:
+								block.i0								= field[0];
+								block.crc								= field[1];
+								block.omega								= field[2];
+								block.OMEGADOT							= field[3];
+								break;
+							case 5:
+								block.IDOT								= field[0];
+								if (satSystem == GPS) {
+									block.codesOnL2						= (int)field[1];
+									block.GPSweek						= (int)field[2];
+									block.L2Pdataflag					= (int)field[3];
+								} else if (satSystem == Galileo) {
+									block.dataSources		= (int)field[1];
+									block.GALweek			= (int)field[2];
+									block.GPSweek			= block.GALweek;
+								} else if (satSystem == BDS) {
+									block.BDSweek			= (int)field[2];
+									block.GPSweek			= block.BDSweek+1356;
+								}
+								break;
+							case 6:
+								block.SVaccuracy = block.SISASignal		= field[0];
+								block.SVhealth							= (int)field[1];
+								if (satSystem == GPS) {
+									block.TGD							= field[2];
+									block.IODC							= (int)field[3];
+								} else if (satSystem == Galileo) {
+									block.BGDE5a			= field[2];
+									block.BGDE5b			= field[3];
+								} else if (satSystem == BDS) {
+									block.TGD                       = field[2];
+									block.TGD2                      = field[3];
+								}
+								break;
+							case 7:
+								block.transTime							= field[0];
+								if (satSystem == GPS) {								
+									block.fitInterval					= (int)field[1];
+									if ( block.fitInterval == 0 ) block.fitInterval = 4;
+								} else if (satSystem == BDS) {
+									//block.transTime-=14;//Adjust 14 seconds to GPS time
+									block.IODC                      = (int)field[1];
+									if ( block.IODC>=0 && block.IODC<=1023 ) block.fitInterval=4;
+								} else  if (satSystem == Galileo) {
+									block.fitInterval		= 4;
+								}
+								break;
 						}
-						getstr(aux,line,12,4);
-						min = tm.tm_min  = atoi(aux);
-						getstr(aux,line,16,10);
-						tm.tm_sec  = atoi(aux);
-						seconds = atof(aux);
-					} else {
-						//RINEX v3
-						if (line[0]=='>' && len<60) {
-							//Line with valid epoch
-							getstr(aux,line,2,4);
-							yy =  atoi(aux);
-							if (yy>=2000) yy-=2000;
-							else yy-=1900;
-							tm.tm_year = atoi(aux)-1900;
-							getstr(aux,line,7,2);
-							mm = atoi(aux);
-							tm.tm_mon = mm-1;
-							getstr(aux,line,10,2);
-							dd = tm.tm_mday = atoi(aux);
-							getstr(aux,line,13,2);
-							hour = tm.tm_hour = atoi(aux);
-							getstr(aux,line,16,2);
-							min = tm.tm_min  = atoi(aux);
-							getstr(aux,line,19,10);
-							tm.tm_sec  = atoi(aux);
-							seconds = atof(aux);
-						} else {
-							hour=-1;
+						break;
+					case GLONASS: case GEO:
+						switch(row){
+							case 0:
+								block.clockbias     		        = field[1];
+								if (satSystem == GLONASS) {
+									block.clockdrift          	= field[2];
+									block.transTime			= field[3];
+								} else {
+									block.clockdrift                = field[2];
+									block.transTime			= field[3];
+								}
+								block.clockdriftrate					= 0.0;
+								//No IODE and IODC provided. Set it to -1
+								block.IODE								= -1;
+								block.IODC         			           	= -1; 
+								block.SVaccuracy						= 0.;
+								break;
+							case 1:
+								block.satposX                           = field[0]*1000;
+								block.satvelX                           = field[1]*1000;
+								block.sataccX                           = field[2]*1000;
+								block.SVhealth                          = (int)field[3];
+								break;
+							case 2:
+								block.satposY                           = field[0]*1000;
+								block.satvelY                           = field[1]*1000;
+								block.sataccY                           = field[2]*1000;
+								if (satSystem == GLONASS) {
+									block.freqnumber                = (int)field[3];
+								} else {
+									block.URAGEO			= (int)field[3];
+								}
+								break;
+							case 3:
+								block.satposZ                           = field[0]*1000;
+								block.satvelZ                           = field[1]*1000;
+								block.sataccZ                           = field[2]*1000;
+								if (satSystem == GLONASS) {
+									block.ageofoperation            = (int)field[3];
+									block.fitInterval = 2; //For GLONASS, we will interpolate one hour back and one ahead
+								} else {
+									block.IODNGEO			= (int)field[3];
+									block.fitInterval = 4;
+								}
+								break;
 						}
-					}
-					if (yy>=0 && yy<=99 && mm>=1 && mm<=12 && dd>=1 && dd<=31 && hour>=0 && hour<=23 && min>=0 &&min<=59) {
-						//Epoch timestamp found
 						break;
-					}
+					default:
+						break;
 				}
-				if (i==0) {
-					firstEpoch.MJDN = MJDN(&tm);
-					firstEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-				} else {
-					secondEpoch.MJDN = MJDN(&tm);
-					secondEpoch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-					interval=tdiff(&secondEpoch,&firstEpoch);
-					if (interval<1E-4) {
-						//Epoch repeated due to an event epoch just in the first epoch
-						//Keep reading epochs until the epoch changes
-						i=0;
-						continue;
+				row++;
+				if (row==8 || (row==4 && (satSystem == GLONASS || satSystem == GEO ))) {
+					row = 0;
+					if (satSystem == GLONASS ) {
+						//Toc and Toe of GLONASS will be left in UTC because orbits will be computed in UTC time
+						block.Ttoe = block.Ttoc;
+						ttime2gpswsnoroll(&block.Ttoc,&GPSweek,&SoW);
+						//In Rinex v3, GLONASS transmission time is in UTC seconds of week!
+						//Transform transmission time from UTC to GPS time
+						block.transTime+=products->BRDC->AT_LS;
+						block.TtransTime = gpsws2ttime(GPSweek,block.transTime);
+					} else if (satSystem == GEO ) {
+						block.Ttoe = block.Ttoc;
+						ttime2gpswsnoroll(&block.Ttoc,&GPSweek,&SoW);
+						block.TtransTime = gpsws2ttime(GPSweek,block.transTime);
+					} else if (satSystem == BDS ) {
+						//Convert from BeiDou time to GPS time
+						//block.toe (toe in in seconds of BDS week) must be left untouched for computing satellite coordinates correctly
+						block.Ttoc = tdadd(&block.Ttoc,14.);
+						block.Ttoe = gpsws2ttime(block.GPSweek,block.toe+14.);
+						block.TtransTime = gpsws2ttime(block.GPSweek,block.transTime+14.);
+					} else {
+						block.Ttoe = gpsws2ttime(block.GPSweek,block.toe);
+						block.TtransTime = gpsws2ttime(block.GPSweek,block.transTime);
 					}
-					epoch->receiver.interval=interval;
+					indSat = products->BRDC->index[satSystem][block.PRN];
+					if (indSat == -1) {
+						products->BRDC->index[satSystem][block.PRN] = products->BRDC->numsats;
+						indSat = products->BRDC->index[satSystem][block.PRN];
+						products->BRDC->block = realloc(products->BRDC->block,sizeof(TBRDCblock*)*(products->BRDC->numsats+1));
+						products->BRDC->numblocks = realloc(products->BRDC->numblocks,sizeof(int)*(products->BRDC->numsats+1));
+						products->BRDC->block[indSat] = NULL;
+						products->BRDC->numblocks[indSat] = 0;
+						products->BRDC->numsats++;
+					}
+					indBlock = products->BRDC->numblocks[indSat];
+					products->BRDC->block[indSat] = realloc(products->BRDC->block[indSat],sizeof(TBRDCblock)*(indBlock+1));
+					block.TtoeNs = t2ns(&block.Ttoe);
+					block.TtransTimeNs = t2ns(&block.TtransTime);
+					memcpy(&products->BRDC->block[indSat][indBlock], &block,sizeof(TBRDCblock));
+					products->BRDC->numblocks[indSat]++;
 				}
+			}// End Nav Rinex v3
+		}
+	}
+
+	if (useCache && properlyRead) writeRinexNavCache(cacheFilename, products, *rinexNavVersion);
+
+	return (properlyRead); // properly read 
+}
+
+/*****************************************************************************
+ * Name        : readRinexNavLastEpoch
+ * Description : Find last epoch of RINEX navigation file. It will read the last
+ *                day of data, as it can't assume that data is ordered 
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TTime *lastEpoch                O  N/A  Last Epoch in SP3 file
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Last Epoch read
+ *                                         0 => Error
+ *****************************************************************************/
+int readRinexNavLastEpoch (FILE *fd, TTime *lastEpoch) {
+
+    off_t                   filesize;
+    long                    CurrentPos;
+    int                     len = 0;
+	int						i;
+    char                    line[MAX_INPUT_LINE];
+	double					rinexNavVersion; 						
+	TGNSSproducts 			products;
+
+	initGNSSproducts(&products);
+
+
+    CurrentPos = ftell(fd);
+    //We need to go to the end of the file.
+    //NOTE that fseek(fd, 0L, SEEK_END); does not work as we have opened the file in binary mode!!!
+    filesize = getInputFileSize(fd);
+    fseek(fd,filesize,SEEK_SET);
+
+    while(1) {
+        if (getLback(line,&len,fd)==-1) {
+			fseek(fd,CurrentPos,SEEK_SET);
+			return 0;
+		}
+		if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
+			if (getLback(line,&len,fd)==-1) {
+				fseek(fd,CurrentPos,SEEK_SET);
+				return 0;
 			}
-			//Set the file position back to the first epoch
-			fseek(fd,posEndHeader,SEEK_SET);
+			break;
 		}
 	}
-
-	return (properlyRead && !error); // properly read AND no error
+	if (readRinexNav(fd, &products, &rinexNavVersion, NULL)<1) {
+		free(products.BRDC->block);
+		fseek(fd,CurrentPos,SEEK_SET);
+		return 0;
+	}
+	fseek(fd,CurrentPos,SEEK_SET);
+	*lastEpoch=getProductsLastEpochBRDC(&products);
+	//Free memory
+	for(i=0;i<products.BRDC->numsats;i++) {
+		free(products.BRDC->block[i]);
+	}
+	free(products.BRDC->numblocks);
+	free(products.BRDC->block);
+	return 1;
 }
 
 /*****************************************************************************
- * Name        : readRinexObsEpoch
- * Description : Read a RINEX observation epoch from a file descriptor
+ * Name        : readSP3
+ * Description : Read an SP3 precise products file from a file descriptor
  * Parameters  :
  * Name                           |Da|Unit|Description
  * FILE  *fd                       I  N/A  File descriptor
- * TEpoch  *epoch                  O  N/A  Structure to save the data
- * TConstellation  *constellation  I  N/A  TConstellation structure
- * enum ProcessingDirection        I  N/A  Direction of the read
- *                                         pFORWARD  => Forward
- *                                         pBACKWARD => Backward
+ * TGNSSproducts  *products        O  N/A  Structure to save the data
+ * int  readOrbits                 I  N/A  Flag to read the position and 
+ *                                         velocities (0 or 1)
+ * int  readClocks                 I  N/A  Flag to read the clocks (0 or 1)
+ * int  readingRefFile             I  N/A  Flag to indicate if we are reading a reference position file (0 or 1)
  * TOptions  *options              I  N/A  TOptions structure
  * Returned value (int)            O  N/A  Status of the function
  *                                         1 => Properly read
  *                                         2 => Another file concatenated
- *                                         0 => Error or EOF (no more epochs)
+ *                                         0 => Error
+ *                                        -2 => Number of entries in header is incorrect (deprecated)
+ *                                        -3 => If reading reference position file, there is more than
+ *                                                one satellite available
  *****************************************************************************/
-int readRinexObsEpoch (FILE *fd, TEpoch *epoch, TConstellation *constellation, enum ProcessingDirection direction, char *Epochstr, TOptions *options) {
-	char		line[MAX_INPUT_LINE];
-	char		aux[100];
-	char		cons;
-	int			len = 0;
-	int			properlyRead = 0;
-	int			error = 0;
-	int			i, j, k;
-	int			n;
-	int			notSupportedSatellites = 0;
-	int			numEpochsMissing;
-	struct tm	tm;
-	double		seconds;
-	double		value;
-	int			nextRead;
-	int			ret;
-
-	// For converting from SNR flag in RINEX to dBHz. 60 means don't care (0 in RINEX) or very high (9 in RINEX)
-	// There is no fixed value for very high SNR (9 in RINEX). A value is 60 is set in order to give a higher enough
-	// value when computing the satellite weight using the SNR
-	static int	SNRtable[10] = { 60, 11, 17, 23, 29, 35, 41, 47, 53, 60 };
+int readSP3 (FILE *fd, TGNSSproducts *products, int readOrbits, int readClocks, int readingRefFile, TOptions *options) {
+	char 			line[MAX_INPUT_LINE];
+	char    		aux[100];
+	int 			len = 0;
+	int				properlyRead = 0;
+	int				error = 0;
+	int				readingHeader = 1;
+	int				i,k;
+	int				PRN;
+	int				HeaderNumRecords;
+	int				FirstHeaderfline=1;
+	TTime			t,lastT;
+	int				ind;
+	struct tm		tm;
+	double			seconds;
+	double			interval;
+	int				readedLine = 0;
+	int				readedSatellites;
+	//char			versionId;
+	enum GNSSystem	system;
+	int				usedRecords;
+	int				CurrentInd;
+	int				auxN;
+	double			BaseSigmaOrbit;
+	double			BaseSigmaClock;
+	double			clockValue;
+	int				useCache = 0;
+	char			cacheFilename[MAX_OUTPUT_FILENAME];
 
-	static int	twoepochs=1;	//Variable to read only the first two epochs to compute data rate file
-	static int	lastCSindex[2]={0,0};	//Variable holding the first free index of all satellites viewed
+	if (!readOrbits && !readClocks) return 0;
 
-	// Rewind for backward processing
-	if ( direction == pBACKWARD ) {
-		ret = rewindEpochRinexObs(fd,epoch->source);
-		if ( ret == 0 ) return 0;
-		ret = rewindEpochRinexObs(fd,epoch->source);
-		if ( ret == 0 ) return 0;
+	if (getProductsCacheFilename(fd,options->productsCacheDir,"SP3",readOrbits+2*readClocks+4*readingRefFile,cacheFilename)==1) {
+		if (readSP3Cache(cacheFilename,products)==1) {
+			fseek(fd,0,SEEK_END);
+			return 1;
+		}
+		useCache = 1;
 	}
 
-	//Remove index values from previous epoch
-	for (i=0;i<epoch->numSatellites;i++) {
-		epoch->satIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]=-1;
-	}
+	products->type = SP3;
+	products->SP3 = malloc(sizeof(TSP3products));
+	initSP3products(products->SP3);
+	lastT.MJDN = 0;
+	lastT.SoD = 0;
 
-	
-	if (getL(line,&len,fd)!=-1) {
-		properlyRead = 1;
-		// Block to detect new RINEX header, it only affects when large RINEX are used
-		if (getLback(line,&len,fd)!=-1) {
-			getL(line,&len,fd);
-			getstr(aux,line,60,80);
-			if (strncmp(aux,"RINEX VERSION / TYPE",20)==0) {
-				getLback(line,&len,fd);
-				return 2;
-			}
-		}
-		if (epoch->source == RINEX2) {
-			// RINEX 2.11				
-			getstr(aux,line,27,2);
-			epoch->flag = atoi(aux);
-			
-			if (epoch->flag>1) { // Unusable epoch
-				if ( direction == pBACKWARD ) {
-					//Save previous epoch
-					memcpy(&epoch->PreviousEpoch,&epoch->t,sizeof(TTime));
-					//When going backwards, skip epoch events and look for previous epoch in RINEX observation file
-					//If next valid epoch was read, it would make an infinite loop as we want back one epoch, but read two,
-					//and the next time we enter this function, we would go back two epochs, which results in always reading 
-					//the same epoch
-					ret = rewindEpochRinexObs(fd,epoch->source);
-					if ( ret == 0 ) return 0;
-				} else {
-					getstr(aux,line,1,2);
-					tm.tm_year = atoi(aux);
-					if (tm.tm_year <= 70) tm.tm_year += 100;
-					getstr(aux,line,4,2);
-					tm.tm_mon  = atoi(aux)-1;
-					getstr(aux,line,7,2);
-					tm.tm_mday = atoi(aux);
-					getstr(aux,line,10,2);
-					tm.tm_hour = atoi(aux);
-					getstr(aux,line,13,2);
-					tm.tm_min  = atoi(aux);
-					getstr(aux,line,16,10);
-					tm.tm_sec  = atoi(aux);
-					seconds = atof(aux);
-					getstr(aux,line,30,2);
-					n = atoi(aux);
-					for (i=0;i<=n;i++) {
-						if (getL(line,&len,fd)==-1) {
-							return 0;
+	while(getL(line,&len,fd)!=-1) {
+		readedLine++;
+		if (readingHeader) {
+			if (readedLine==1) {
+				// #bP2008  8 27 00 00 00.00000000      96   d   ITR91 FIT  JPL
+				if (line[0]!='#') error = 1;
+				if (line[2]=='V') products->SP3->orbits.velocityAvailable = 1;
+				else products->SP3->orbits.velocityAvailable = 0;
+				getstr(aux,line,32,7);
+				HeaderNumRecords=atoi(aux);
+				if (readOrbits) products->SP3->orbits.numRecords = atoi(aux);
+				if (readClocks) products->SP3->clocks.numRecords = atoi(aux);
+			} else if (readedLine==2) {
+				// ## 1494 259200.00000000   900.00000000 54705 0.0000000000000
+				//getstr(aux,line,24,14);
+				//if (readOrbits) products->SP3->orbits.interval = atof(aux);
+				//if (readClocks) products->SP3->clocks.interval = atof(aux);
+				getstr(aux,line,39,5);
+				if (readOrbits) products->SP3->orbits.startTime.MJDN = atoi(aux);
+				if (readClocks) products->SP3->clocks.startTime.MJDN = atoi(aux);
+				getstr(aux,line,45,15);
+				if (readOrbits) products->SP3->orbits.startTime.SoD = atof(aux)*86400.0;
+				if (readClocks) products->SP3->clocks.startTime.SoD = atof(aux)*86400.0;
+			} else if (strncmp(line,"+ ",2)==0) {
+				// +   31   G02G03G04G05G06G07G08G09G10G11G12G13G14G15G16G17G18
+				if (readedLine==3) {
+					auxN = getIntField(line,len,3,3);
+					if(readingRefFile==1) {
+						//If we are reading reference file only one satellite must be in the SP3 file
+						if (auxN>1) {
+							return -3;
 						}
-						if (strncmp(&line[60],"APPROX POSITION XYZ",19)==0) {
-							if (options->receiverPositionSource==rpRINEX || ( ( (options->receiverPositionSource == rpCALCULATERINEX) || (options->receiverPositionSource == rpCALCULATERINEXREF)  ) && epoch->numAproxPosRead==0)) {
-								getstr(aux,line,1,14);
-								epoch->receiver.aproxPosition[0] = atof(aux);
-								getstr(aux,line,14,14);
-								epoch->receiver.aproxPosition[1] = atof(aux);
-								getstr(aux,line,28,14);
-								epoch->receiver.aproxPosition[2] = atof(aux);
-								epoch->receiver.aproxPositionError = 1e4; // 10 Km
-								epoch->numAproxPosRead++;
-							} else if ( options->receiverPositionSource >= rpRTCMbaseline && options->receiverPositionSource <= rpRTCMRoverUSERREF  ) {
-								getstr(aux,line,1,14);
-								epoch->receiver.aproxPosition[0] = atof(aux);
-								getstr(aux,line,14,14);
-								epoch->receiver.aproxPosition[1] = atof(aux);
-								getstr(aux,line,28,14);
-								epoch->receiver.aproxPosition[2] = atof(aux);
-								epoch->receiver.aproxPositionError = 0.1; // 10 cm
-								epoch->numAproxPosRead++;
-							} 
-							if ( ( options->receiverPositionSource == rpRTCMRINEXROVER || options->receiverPositionSource == rpRTCMUserRINEXROVER ) && epoch->DGNSSstruct==0 ) {
-								getstr(aux,line,1,14);
-								epoch->receiver.aproxPositionRover[0] = atof(aux);
-								getstr(aux,line,14,14);
-								epoch->receiver.aproxPositionRover[1] = atof(aux);
-								getstr(aux,line,28,14);
-								epoch->receiver.aproxPositionRover[2] = atof(aux);
-							}
-							if(epoch->DGNSSstruct==1) {
-								if(epoch->receiver.numRecStation==0) {
-									epoch->receiver.RecStationCoord=malloc(sizeof(double*));
-									epoch->receiver.RecStationCoord[0]=malloc(sizeof(double)*3);
-									memcpy(epoch->receiver.RecStationCoord[0],epoch->receiver.aproxPosition,sizeof(double)*3);
-									epoch->receiver.numRecStation++;
-								} else {
-									if(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][0]!=epoch->receiver.aproxPosition[0] 
-											|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][1]!=epoch->receiver.aproxPosition[1]
-											|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][2]!=epoch->receiver.aproxPosition[2]) {
-										//Station coordinates are differents from the previous read
-										epoch->receiver.RecStationCoord=realloc(epoch->receiver.RecStationCoord,sizeof(double*)*(epoch->receiver.numRecStation+1));
-										epoch->receiver.RecStationCoord[epoch->receiver.numRecStation]=malloc(sizeof(double)*3);
-										memcpy(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation],epoch->receiver.aproxPosition,sizeof(double)*3);
-										epoch->receiver.ChangedStaEpoch=realloc(epoch->receiver.ChangedStaEpoch,sizeof(TTime)*epoch->receiver.numRecStation);
-										memcpy(&epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1],&epoch->t,sizeof(TTime));
-										epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1].MJDN=MJDN(&tm);
-										epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1].SoD=(double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-										epoch->receiver.numRecStation++;
-									}
-								}
-							}
+					}
+					if (readOrbits) products->SP3->orbits.numSatellites = products->SP3->orbits.numSatellitesRead = auxN;
+					if (readClocks) products->SP3->clocks.numSatellites = products->SP3->clocks.numSatellitesRead = auxN;
+					// Reserve memory for satellites
+					if (readOrbits) {
+						products->SP3->orbits.block = malloc(sizeof(TSP3orbitblock*)*products->SP3->orbits.numSatellites);
+						for (i=0;i<products->SP3->orbits.numSatellites;i++) {
+							products->SP3->orbits.block[i]=NULL;
+						}
+						products->SP3->orbits.accuracy = malloc(sizeof(double)*products->SP3->orbits.numSatellites);
+					}
+					if (readClocks) {
+						products->SP3->clocks.block = malloc(sizeof(TSP3clockblock*)*products->SP3->clocks.numSatellites);
+						for (i=0;i<products->SP3->clocks.numSatellites;i++) {
+							products->SP3->clocks.block[i]=NULL;
 						}
 					}
+					readedSatellites = 0;
 				}
-			}
-			
-			//Save previous epoch
-			memcpy(&epoch->PreviousEpoch,&epoch->t,sizeof(TTime));
-
-			getstr(aux,line,1,2);
-			tm.tm_year = atoi(aux);
-			if (tm.tm_year <= 70) tm.tm_year += 100;
-			getstr(aux,line,4,2);
-			tm.tm_mon  = atoi(aux)-1;
-			getstr(aux,line,7,2);
-			tm.tm_mday = atoi(aux);
-			getstr(aux,line,10,2);
-			tm.tm_hour = atoi(aux);
-			getstr(aux,line,13,2);
-			tm.tm_min  = atoi(aux);
-			getstr(aux,line,16,10);
-			tm.tm_sec  = atoi(aux);
-			seconds = atof(aux);
-			epoch->t.MJDN = MJDN(&tm);
-			epoch->t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-
-			//Look for data gaps
-			numEpochsMissing=abs((int)(tdiff(&epoch->t,&epoch->PreviousEpoch)/epoch->receiver.interval))-1;
-			if (numEpochsMissing>0) {
-				if (epoch->PreviousEpoch.MJDN!=-1) {
-					epoch->CurrentDataGapSize=numEpochsMissing;
-					sprintf(messagestr,"Data gap of %d epoch%s in %s at %17s / %4d %02d %02d %02d:%02d:%04.1f",numEpochsMissing,numEpochsMissing==1?"":"s",epoch->DGNSSstruct==0?"rover observation file":"reference station RINEX observation file",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds);
-					printInfo(messagestr,options);
-				} else {
-					epoch->CurrentDataGapSize=0;
+				for (i=0;i<17 && readedSatellites<auxN;i++,readedSatellites++) { //auxN = products->SP3->XXXX.numSatellites;
+					system = gnsschar2gnsstype(line[9+3*i]);
+					getstr(aux,line,10+3*i,2);
+					if (readOrbits) products->SP3->orbits.index[system][atoi(aux)] = readedSatellites;
+					if (readClocks) products->SP3->clocks.index[system][atoi(aux)] = readedSatellites;
+				}
+			} else if (strncmp(line,"++",2)==0) {
+				if (readedSatellites==auxN) readedSatellites=0; //This is the first line with "++" read
+				for (i=0;i<17 && readedSatellites<auxN;i++,readedSatellites++) { //auxN = products->SP3->XXXX.numSatellites;
+					// Accuracy is 2^val mm.
+					if (readOrbits) products->SP3->orbits.accuracy[readedSatellites] = pow(2,getIntField(line,len,10+3*i,2))*1e-3;
 				}
-			} else {
-				epoch->CurrentDataGapSize=0;
-			}
-
-			if (printProgress==1) {
-				//Only save current epoch if it we are reading Rover file, not reference file
-				if (epoch->DGNSSstruct==0) {
-					if (options->StartEpoch.MJDN!=-1) {
-						if(tdiff(&epoch->t,&options->StartEpoch)>=0.) {
-							epoch->numEpochsprocessed++;
-							epoch->CurrentPercentage=100*epoch->numEpochsprocessed/epoch->numEpochsfile;
-							if ((epoch->CurrentPercentage-epoch->PreviousPercentage)>=0.1) {
-								sprintf(Epochstr,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        ",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,epoch->CurrentPercentage);
-								epoch->NewPercentage=1;
-							}
+			} else if (strncmp(line,"%f",2)==0) {
+				if (FirstHeaderfline==1) {
+					FirstHeaderfline=0;
+					if (readOrbits) {
+						BaseSigmaOrbit=getDoubleField(line,len,3,10);
+						if (BaseSigmaOrbit==0.) {
+							BaseSigmaOrbit=2.;
 						}
-					} else {
-						epoch->numEpochsprocessed++;
-						epoch->CurrentPercentage=100*epoch->numEpochsprocessed/epoch->numEpochsfile;
-						if ((epoch->CurrentPercentage-epoch->PreviousPercentage)>=0.1) {
-							sprintf(Epochstr,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        ",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,epoch->CurrentPercentage);
-							epoch->NewPercentage=1;
+					}
+					if (readClocks) {
+						BaseSigmaClock=getDoubleField(line,len,14,10);
+						if (BaseSigmaClock==0.) {
+							BaseSigmaClock=2.;
 						}
 					}
 				}
-			}
-
-
-			if (twoepochs) {
-				if(epoch->firstepoch.SoD==-1.) {
-					memcpy(&epoch->firstepoch,&epoch->t,sizeof(TTime));
-				} else {
-					if (tdiff(&epoch->t,&epoch->firstepoch)>1E-4) {
-						//This is for the case we read the first epoch two times.
-						//This occurs if we need to read the first epoch in order to look for Glonass k factors in the navigation file
-						twoepochs=0;
-						memcpy(&epoch->secondepoch,&epoch->t,sizeof(TTime));
+			} else if (strncmp(line,"/*",2)==0) {
+				// /* CCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCC
+				// ++         0  0  0  0  0  0  0  0  0  0  0  0  0  0  0  0  0
+				do {
+					if (getL(line,&len,fd)==-1) {
+						error=1;
+						return 0;
 					}
-				}
-			}
-				
-			getstr(aux,line,30,2);
-			epoch->numSatellites = atoi(aux);
-			for (i=0,j=0;i<epoch->numSatellites;i++,j++) { // Get satellite PRNs
-				if ((i%12)==0 && i!=0) {
-					if (getL(line,&len,fd)==-1) error = 1; // The next satellites are in the following line
-					j = 0;
-				}
-				cons = line[32+3*j];
-				getstr(aux,line,33+3*j,2);
-				epoch->sat[i].PRN = atoi(aux);
-				if (cons=='G' || cons==' ')
-					epoch->sat[i].GNSS = GPS;
-				else if (cons=='S')
-					epoch->sat[i].GNSS = GEO;
-				else if (cons=='R')
-					epoch->sat[i].GNSS = GLONASS;
-				else if (cons=='E')
-					epoch->sat[i].GNSS = Galileo;
+				} while(strncmp(line,"/*",2)==0);
+				getLback(line,&len,fd);
+				properlyRead = 1;
+				readingHeader = 0;
+				usedRecords = 0;
 			}
-			for (i=0;i<epoch->numSatellites;i++) { // Get satellite measurements
-				if (getL(line,&len,fd)==-1) error = 1;
-				nextRead = 0;
-				for (j=0,k=0;j<epoch->measOrder[epoch->sat[i].GNSS].nDiffMeasurements;j++,k++) {
-					if (nextRead) {
-						if (getL(line,&len,fd)==-1) error = 1;
-						nextRead = 0;
-					}
-					getstr(aux,line,16*k,14);
-					value = atof(aux);
-					if (value==0) value = -1;
-					epoch->sat[i].meas[j].value = value;
-					epoch->sat[i].meas[j].rawvalue = value;
-					getstr(aux,line,14+16*k,1);
-					epoch->sat[i].meas[j].LLI = atoi(aux);
-					getstr(aux,line,15+16*k,1);
-					if (line[15+16*k]==' ') {
-						epoch->sat[i].meas[j].hasSNRflag=0;
+		} else { // !readingHeader
+			if (line[0]=='*') { // Epoch starting
+				// *  2008 08 27 00 00 00.00000000
+				tm.tm_year = getIntField(line,len,3,4)-1900;
+				tm.tm_mon  = getIntField(line,len,8,2)-1;
+				tm.tm_mday = getIntField(line,len,11,2);
+				tm.tm_hour = getIntField(line,len,14,2);
+				tm.tm_min  = getIntField(line,len,17,2);
+				tm.tm_sec  = getIntField(line,len,20,11);
+				seconds = getDoubleField(line,len,20,11);
+				t.MJDN = MJDN(&tm);
+				t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+				//Compute interval (do not trust header)
+				if (products->SP3->orbits.interval == 0. && lastT.MJDN!=0) { // If interval is still not known (and it is not the first epoch)
+					interval = tdiff(&t,&lastT);
+					if (interval>=1.) {
+						//Take out decimals if interval is greater than 1
+						if (readOrbits) products->SP3->orbits.interval = (double)((int)(interval));
+						if (readClocks) products->SP3->clocks.interval = (double)((int)(interval));
 					} else {
-						epoch->sat[i].meas[j].hasSNRflag=1;
+						if (readOrbits) products->SP3->orbits.interval = interval;
+						if (readClocks) products->SP3->clocks.interval = interval;
 					}
-					epoch->sat[i].meas[j].SNR = atoi(aux);
-					epoch->sat[i].meas[j].SNRdBHz = SNRtable[epoch->sat[i].meas[j].SNR];
-					epoch->sat[i].meas[j].dataFlag = 0;
-					if ((k+1)%5==0) { // Following observables are in the next lines (max 5 per line)
-						nextRead = 1;
-						k=-1; // k will be increased in the for loop
+
+				}
+				memcpy(&lastT,&t,sizeof(TTime));
+				for (i=0;i<products->SP3->orbits.numSatellites;i++) {
+					if(readOrbits) {
+						products->SP3->orbits.block[i] = realloc(products->SP3->orbits.block[i],sizeof(TSP3orbitblock)*(usedRecords+1));
+						initSP3orbitblock(&products->SP3->orbits.block[i][usedRecords]);
+						memcpy(&products->SP3->orbits.block[i][usedRecords].t,&t,sizeof(TTime));
+					}
+					if (readClocks) {
+						products->SP3->clocks.block[i] = realloc(products->SP3->clocks.block[i],sizeof(TSP3clockblock)*(usedRecords+1));
+						initSP3clockblock(&products->SP3->clocks.block[i][usedRecords]);
+						memcpy(&products->SP3->clocks.block[i][usedRecords].t,&t,sizeof(TTime));
 					}
 				}
-				if (epoch->sat[i].GNSS==GPS) epoch->lastSBASindex=i; //When gLAB is multiconstellation and SBAS monitors also other constellations, this has to include other constellations
-				epoch->satIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]=i;
-
-				if (epoch->satCSIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]==-1) {
-					epoch->satCSIndex[epoch->sat[i].GNSS][epoch->sat[i].PRN]=lastCSindex[epoch->DGNSSstruct];
-					lastCSindex[epoch->DGNSSstruct]++;
+				usedRecords++;
+				if (usedRecords==1) {
+					//Copy first epoch read as start time, do not trust header
+					if(readOrbits) memcpy(&products->SP3->orbits.startTime,&t,sizeof(TTime));
+					if(readClocks) memcpy(&products->SP3->clocks.startTime,&t,sizeof(TTime));
 				}
-			}
-		} else if (epoch->source==RINEX3) {
-			// RINEX 3.00
-			getstr(aux,line,30,2);
-			epoch->flag = atoi(aux);
-			
-			if (epoch->flag>1) { // Unusable epoch
-				if ( direction == pBACKWARD ) {
-					//Save previous epoch
-					memcpy(&epoch->PreviousEpoch,&epoch->t,sizeof(TTime));
-					//When going backwards, skip epoch events and look for previous epoch in RINEX observation file
-					//If next valid epoch was read, it would make an infinite loop as we want back one epoch, but read two,
-					//and the next time we enter this function, we would go back two epochs, which results in always reading 
-					//the same epoch
-					ret = rewindEpochRinexObs(fd,epoch->source);
-					if ( ret == 0 ) return 0;
+			} else if (line[0]=='P') { // Position record
+				CurrentInd=usedRecords-1;
+				if(readingRefFile==1) {
+					//Reference position is saved in position [0][0]
+					system=0;
+					PRN=0;
+					ind=0;
 				} else {
-					getstr(aux,line,2,4);
-					tm.tm_year = atoi(aux)-1900;
-					getstr(aux,line,7,2);
-					tm.tm_mon  = atoi(aux)-1;
-					getstr(aux,line,10,2);
-					tm.tm_mday = atoi(aux);
-					getstr(aux,line,13,2);
-					tm.tm_hour = atoi(aux);
-					getstr(aux,line,16,2);
-					tm.tm_min  = atoi(aux);
-					getstr(aux,line,19,10);
-					tm.tm_sec  = atoi(aux);
-					seconds = atof(aux);
-
-					getstr(aux,line,33,2);
-					n = atoi(aux);
-					for (i=0;i<=n;i++) {
-						if (getL(line,&len,fd)==-1) {
-							return 0;
-						}
-						if (strncmp(&line[60],"APPROX POSITION XYZ",19)==0) {
-							if (options->receiverPositionSource==rpRINEX || ( ( (options->receiverPositionSource == rpCALCULATERINEX) || (options->receiverPositionSource == rpCALCULATERINEXREF)  ) && epoch->numAproxPosRead==0)) {
-								getstr(aux,line,1,14);
-								epoch->receiver.aproxPosition[0] = atof(aux);
-								getstr(aux,line,14,14);
-								epoch->receiver.aproxPosition[1] = atof(aux);
-								getstr(aux,line,28,14);
-								epoch->receiver.aproxPosition[2] = atof(aux);
-								epoch->receiver.aproxPositionError = 1e4; // 10 Km
-								epoch->numAproxPosRead++;
-							} else if ( options->receiverPositionSource >= rpRTCMbaseline && options->receiverPositionSource <= rpRTCMRoverUSERREF  ) {
-								getstr(aux,line,1,14);
-								epoch->receiver.aproxPosition[0] = atof(aux);
-								getstr(aux,line,14,14);
-								epoch->receiver.aproxPosition[1] = atof(aux);
-								getstr(aux,line,28,14);
-								epoch->receiver.aproxPosition[2] = atof(aux);
-								epoch->receiver.aproxPositionError = 0.1; // 10 cm
-								epoch->numAproxPosRead++;
-							}
-							if ( ( options->receiverPositionSource == rpRTCMRINEXROVER || options->receiverPositionSource == rpRTCMUserRINEXROVER ) && epoch->DGNSSstruct==0 ) {
-								getstr(aux,line,1,14);
-								epoch->receiver.aproxPositionRover[0] = atof(aux);
-								getstr(aux,line,14,14);
-								epoch->receiver.aproxPositionRover[1] = atof(aux);
-								getstr(aux,line,28,14);
-								epoch->receiver.aproxPositionRover[2] = atof(aux);
-							}
-							if(epoch->DGNSSstruct==1) {
-								if(epoch->receiver.numRecStation==0) {
-									epoch->receiver.RecStationCoord=malloc(sizeof(double*));
-									epoch->receiver.RecStationCoord[0]=malloc(sizeof(double)*3);
-									memcpy(epoch->receiver.RecStationCoord[0],epoch->receiver.aproxPosition,sizeof(double)*3);
-									epoch->receiver.numRecStation++;
-								} else {
-									if(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][0]!=epoch->receiver.aproxPosition[0] 
-											|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][1]!=epoch->receiver.aproxPosition[1]
-											|| epoch->receiver.RecStationCoord[epoch->receiver.numRecStation-1][2]!=epoch->receiver.aproxPosition[2]) {
-										//Station coordinates are differents from the previous read
-										epoch->receiver.RecStationCoord=realloc(epoch->receiver.RecStationCoord,sizeof(double*)*(epoch->receiver.numRecStation+1));
-										epoch->receiver.RecStationCoord[epoch->receiver.numRecStation]=malloc(sizeof(double)*3);
-										memcpy(epoch->receiver.RecStationCoord[epoch->receiver.numRecStation],epoch->receiver.aproxPosition,sizeof(double)*3);
-										epoch->receiver.ChangedStaEpoch=realloc(epoch->receiver.ChangedStaEpoch,sizeof(TTime)*epoch->receiver.numRecStation);
-										epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1].MJDN=MJDN(&tm);
-										epoch->receiver.ChangedStaEpoch[epoch->receiver.numRecStation-1].SoD=(double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-										epoch->receiver.numRecStation++;
-									}
-								}
+					system = gnsschar2gnsstype(line[1]);
+					PRN = getIntField(line,len,2,2);
+					if (readOrbits) ind = products->SP3->orbits.index[system][PRN];
+					else ind = products->SP3->clocks.index[system][PRN];
+				}
+				if (readOrbits) {
+					if (CurrentInd==0) {
+						//Check if sigmas per epoch are provided
+						products->SP3->orbits.hasSigmaPerEpoch=0;
+						if (getDoubleField(line,len,46,14)!=INVALID_CLOCK) {
+							if (strncmp(&line[61],"  ",2)!=0) {
+								products->SP3->orbits.hasSigmaPerEpoch=1;
 							}
 						}
 					}
-				}
-			}
-			
-			// Save previous epoch
-			memcpy(&epoch->PreviousEpoch,&epoch->t,sizeof(TTime));
+					products->SP3->orbits.block[ind][CurrentInd].x[0] = getDoubleField(line,len,4,14)*1e3;
+					products->SP3->orbits.block[ind][CurrentInd].x[1] = getDoubleField(line,len,18,14)*1e3;
+					products->SP3->orbits.block[ind][CurrentInd].x[2] = getDoubleField(line,len,32,14)*1e3;
+					memcpy(&products->SP3->orbits.block[ind][usedRecords-1].t,&t,sizeof(TTime));
 
-			getstr(aux,line,2,4);
-			tm.tm_year = atoi(aux)-1900;
-			getstr(aux,line,7,2);
-			tm.tm_mon  = atoi(aux)-1;
-			getstr(aux,line,10,2);
-			tm.tm_mday = atoi(aux);
-			getstr(aux,line,13,2);
-			tm.tm_hour = atoi(aux);
-			getstr(aux,line,16,2);
-			tm.tm_min  = atoi(aux);
-			getstr(aux,line,19,10);
-			tm.tm_sec  = atoi(aux);
-			seconds = atof(aux);
-			epoch->t.MJDN = MJDN(&tm);
-			epoch->t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-			
-			if (printProgress==1) {
-				//Only save current epoch if it we are reading Rover file, not reference file
-				if (epoch->DGNSSstruct==0) {
-					if (options->StartEpoch.MJDN!=-1) {
-						if(tdiff(&epoch->t,&options->StartEpoch)>=0.) {
-							epoch->numEpochsprocessed++;
-							epoch->CurrentPercentage=100*epoch->numEpochsprocessed/epoch->numEpochsfile;
-							if ((epoch->CurrentPercentage-epoch->PreviousPercentage)>=0.1) {
-								sprintf(Epochstr,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        ",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,epoch->CurrentPercentage);
-								epoch->NewPercentage=1;
+					if (products->SP3->orbits.hasSigmaPerEpoch==1) {
+						if (getDoubleField(line,len,46,14)!=INVALID_CLOCK) {
+							products->SP3->orbits.block[ind][CurrentInd].xsigma[0] = pow(BaseSigmaOrbit,getDoubleField(line,len,61,2))*1e-3;
+							products->SP3->orbits.block[ind][CurrentInd].xsigma[1] = pow(BaseSigmaOrbit,getDoubleField(line,len,64,2))*1e-3;
+							products->SP3->orbits.block[ind][CurrentInd].xsigma[2] = pow(BaseSigmaOrbit,getDoubleField(line,len,67,2))*1e-3;
+						} else {
+							//When an invalid clock is given, also sigmas are not provided. Use the default ones
+							products->SP3->orbits.block[ind][CurrentInd].xsigma[0]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
+							products->SP3->orbits.block[ind][CurrentInd].xsigma[1]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
+							products->SP3->orbits.block[ind][CurrentInd].xsigma[2]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
+						}
+					} else {
+						//No sigmas per epochs. use the default ones
+						products->SP3->orbits.block[ind][CurrentInd].xsigma[0]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
+						products->SP3->orbits.block[ind][CurrentInd].xsigma[1]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
+						products->SP3->orbits.block[ind][CurrentInd].xsigma[2]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
+					}
+
+					//Read orbit flags
+					if(strlen(line)>=80 && strncmp(&line[78],"  ",2)!=0) {
+						strncpy(products->SP3->orbits.block[ind][CurrentInd].orbitflags,&line[78],2);
+						products->SP3->orbits.block[ind][CurrentInd].orbitflags[2]='\0';
+					} else {
+						products->SP3->orbits.block[ind][CurrentInd].orbitflags[0]='\0';
+					}
+				}
+				if (readClocks) {
+					clockValue = getDoubleField(line,len,46,14);
+					if (CurrentInd==0) {
+						//Check if sigmas per epoch are provided
+						products->SP3->clocks.hasSigmaPerEpoch=0;
+						if (clockValue!=INVALID_CLOCK) {
+							if (strncmp(&line[70],"  ",2)!=0) {
+								products->SP3->clocks.hasSigmaPerEpoch=1;
 							}
 						}
+					}
+					if (clockValue==INVALID_CLOCK) {
+						products->SP3->clocks.block[ind][CurrentInd].clock = INVALID_CLOCK;
+						//clocksigma is initialized by default to 0
 					} else {
-						epoch->numEpochsprocessed++;
-						epoch->CurrentPercentage=100*epoch->numEpochsprocessed/epoch->numEpochsfile;
-						if ((epoch->CurrentPercentage-epoch->PreviousPercentage)>=0.1) {
-							sprintf(Epochstr,"Current epoch: %17s / %4d %02d %02d %02d:%02d:%04.1f (%5.1f%%)        ",t2doystr(&epoch->t),tm.tm_year+1900,tm.tm_mon+1,tm.tm_mday,tm.tm_hour,tm.tm_min,seconds,epoch->CurrentPercentage);
-							epoch->NewPercentage=1;
+						products->SP3->clocks.block[ind][CurrentInd].clock = clockValue*(c0/1e6);
+						if (products->SP3->clocks.hasSigmaPerEpoch==1) {
+							products->SP3->clocks.block[ind][CurrentInd].clocksigma=pow(BaseSigmaClock,getDoubleField(line,len,70,3))*1e-12*c0;
 						}
 					}
-				}
-			}
+					memcpy(&products->SP3->clocks.block[ind][CurrentInd].t,&t,sizeof(TTime));
 
-			if (twoepochs) {
-				if(epoch->firstepoch.SoD==-1.) {
-					memcpy(&epoch->firstepoch,&epoch->t,sizeof(TTime));
-				} else {
-					twoepochs=0;
-					memcpy(&epoch->secondepoch,&epoch->t,sizeof(TTime));
-				}
-			}
-				
-			getstr(aux,line,33,2);
-			epoch->numSatellites = atoi(aux);
-			for (i=0;i<epoch->numSatellites;i++) { // Get satellite measurements and PRNs
-				if (getL(line,&len,fd)==-1) error = 1;
-				epoch->sat[i-notSupportedSatellites].GNSS = gnsschar2gnsstype(line[0]);
-				if ( epoch->sat[i-notSupportedSatellites].GNSS==BDS || epoch->sat[i-notSupportedSatellites].GNSS==QZSS || epoch->sat[i-notSupportedSatellites].GNSS==IRNSS ) { //BeiDou, QZSS, IRNSS are not supported
-					notSupportedSatellites++;
-					continue; 
-				}	
-				getstr(aux,line,1,2);
-				epoch->sat[i-notSupportedSatellites].PRN = atoi(aux);
-				for (j=0;j<epoch->measOrder[epoch->sat[i-notSupportedSatellites].GNSS].nDiffMeasurements;j++) {
-					getstr(aux,line,3+16*j,14);
-					value = atof(aux);
-					if (value==0) value = -1;
-					epoch->sat[i-notSupportedSatellites].meas[j].value = value;
-					epoch->sat[i-notSupportedSatellites].meas[j].rawvalue = value;
-					getstr(aux,line,17+16*j,1);
-					epoch->sat[i-notSupportedSatellites].meas[j].LLI = atoi(aux);
-					getstr(aux,line,18+16*j,1);
-					if (line[18+16*j]==' ') {
-						epoch->sat[i-notSupportedSatellites].meas[j].hasSNRflag=0;
+					//Read clock flags
+					if(strlen(line)>=76 && strncmp(&line[74],"  ",2)!=0) {
+						strncpy(products->SP3->clocks.block[ind][CurrentInd].clockflags,&line[74],2);
+						products->SP3->clocks.block[ind][CurrentInd].clockflags[2]='\0';
 					} else {
-						epoch->sat[i-notSupportedSatellites].meas[j].hasSNRflag=1;
+						products->SP3->clocks.block[ind][CurrentInd].clockflags[0]='\0';
 					}
-					epoch->sat[i-notSupportedSatellites].meas[j].SNR = atoi(aux);
-					epoch->sat[i-notSupportedSatellites].meas[j].SNRdBHz = SNRtable[epoch->sat[i-notSupportedSatellites].meas[j].SNR];
-					epoch->sat[i-notSupportedSatellites].meas[j].dataFlag = 0;
 				}
-				if(epoch->sat[i-notSupportedSatellites].GNSS==GPS) epoch->lastSBASindex=i-notSupportedSatellites; //When gLAB is multiconstellation and SBAS monitors also other constellations, this has to include other constellations
-				epoch->satIndex[epoch->sat[i-notSupportedSatellites].GNSS][epoch->sat[i-notSupportedSatellites].PRN]=i-notSupportedSatellites;
-
-				if (epoch->satCSIndex[epoch->sat[i-notSupportedSatellites].GNSS][epoch->sat[i-notSupportedSatellites].PRN]==-1) {
-					epoch->satCSIndex[epoch->sat[i-notSupportedSatellites].GNSS][epoch->sat[i-notSupportedSatellites].PRN]=lastCSindex[epoch->DGNSSstruct];
-					lastCSindex[epoch->DGNSSstruct]++;
+				
+			} else if (line[0]=='V') { // Velocity record
+				CurrentInd=usedRecords-1;
+				if(readingRefFile==1) {
+					//Reference position is saved in position [0][0]
+					system=0;
+					PRN=0;
+					ind=0;
+				} else {					
+					system = gnsschar2gnsstype(line[1]);
+					PRN = getIntField(line,len,2,2);
+					if (readOrbits) ind = products->SP3->orbits.index[system][PRN];
+					else ind = products->SP3->clocks.index[system][PRN];
 				}
-			}
-			epoch->numSatellites-=notSupportedSatellites;
-		} // (epoch->source==RINEX3)
-
-	}
-
-	return (properlyRead && !error); // properly read AND no error	
-}
-
-/*****************************************************************************
- * Name        : rewindEpochRinexObs
- * Description : Rewind one epoch backward in a RINEX observation file
- * Parameters  :
- * Name                           |Da|Unit|Description
- * FILE  *fd                       I  N/A  File descriptor
- * enum Source  src                I  N/A  Source of the RINEX file (RINEX2 or RINEX3)
- * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Properly read
- *                                         0 => Error or EOF (no more epochs)
- *****************************************************************************/
-int rewindEpochRinexObs (FILE *fd, enum Source src) {
-	int			ret;
-	int			yy=-1,mm=-1,dd=-1,hour=-1,min=-1;
-	char 		line[MAX_INPUT_LINE];
-	char    	aux[100];
-	int 		len = 0;
-	
-	while (1) {
-		ret = getLback(line,&len,fd);
-		if (ret==-1) return 0;
-		if (len>72 && strncmp(&line[60],"END OF HEADER",13)==0) {
-			//Read backward until beginning of header is found
-			while (1) {
-				ret = getLback(line,&len,fd);
-				if (ret==-1) return 0;
-				if (len>79 && strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
-					break;
+				if (readOrbits) {
+					products->SP3->orbits.block[ind][CurrentInd].v[0] = getDoubleField(line,len,4,14)*1e-1;
+					products->SP3->orbits.block[ind][CurrentInd].v[1] = getDoubleField(line,len,18,14)*1e-1;
+					products->SP3->orbits.block[ind][CurrentInd].v[2] = getDoubleField(line,len,32,14)*1e-1;
+					memcpy(&products->SP3->orbits.block[ind][CurrentInd].t,&t,sizeof(TTime));
 				}
-			}
-		} else {
-			// Check if date is within margins to detect init of epoch
-			// RINEX 2.11
-			if (src==RINEX2) {
-				getstr(aux,line,0,4);
-				yy = atoi(aux);
-				getstr(aux,line,3,4);
-				mm = atoi(aux);
-				getstr(aux,line,6,4);
-				dd = atoi(aux);
-				getstr(aux,line,9,4);
-				//The '.' detection is to avoid some measurements with many 0's to produce a valid date
-				//With the check of the dot, the date string will never have a '.' 
-				//For example, the following line in a RINEX 2:
-				//   20010008.523   105153351.772         472.098          50.585    20010006.448
-				//This produced a valid date, when clearly is not the line where an epoch starts
-				if(aux[1]=='.'||aux[2]=='.') {
-					hour=-1;
-				} else {
-					hour = atoi(aux);
+				if (readClocks) {
+					products->SP3->clocks.block[ind][CurrentInd].clockrate = getDoubleField(line,len,46,14)*(c0/1e7);
+					memcpy(&products->SP3->clocks.block[ind][CurrentInd].t,&t,sizeof(TTime));
 				}
-				getstr(aux,line,12,4);
-				min = atoi(aux);
-				if (yy>=0 && yy<=99 && mm>=1 && mm<=12 && dd>=1 && dd<=31 && hour>=0 && hour<=23 && min>=0 &&min<=59) {
-					return 1;
+			} else if (strncmp(line,"EOF",3)==0) { // End of File
+				if (readOrbits) {
+					products->SP3->orbits.numRecords = usedRecords;
+					memcpy(&products->SP3->orbits.endTime,&t,sizeof(TTime));
 				}
-			// RINEX 3.00
-			} else if (src==RINEX3) {
-				//The len<60 is to avoid potential header or comment lines starting with ">"
-				if (line[0]=='>' && len<60) return 1;
-			} else return 0;
-		}
+				if (readClocks) {
+					products->SP3->clocks.numRecords = usedRecords;
+					memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
+				}
+				if(usedRecords!=HeaderNumRecords) {
+					//Header had incorrect number of entries
+					sprintf(messagestr,"WARNING Number of entries in header (%d) does not match with number of entries read (%d)",HeaderNumRecords,usedRecords);
+					printInfo(messagestr,options);
+				}
+				for (k=0;k<5;k++) {
+					if (getL(line,&len,fd)==-1) {
+						//Only files read without warnings are saved in the cache
+						if (useCache && usedRecords==HeaderNumRecords) writeSP3Cache(cacheFilename,products);
+						return 1;
+					}
+				}
+				for (k=0;k<5;k++) getLback(line,&len,fd);
+				return 2;
+			} else if (line[0]=='#') {
+				printInfo("WARNING SP3 file has no 'EOF' line at the end. SP3 file may be incomplete",options);
+				if(usedRecords!=HeaderNumRecords) {
+					//Header had incorrect number of entries
+					sprintf(messagestr,"WARNING Number of entries in header (%d) does not match with number of entries read (%d)",HeaderNumRecords,usedRecords);
+					printInfo(messagestr,options);
+				}
+				//Concatenated file
+				if (readOrbits) {
+					products->SP3->orbits.numRecords = usedRecords;
+					memcpy(&products->SP3->orbits.endTime,&t,sizeof(TTime));
+				}
+				if (readClocks) {
+					products->SP3->clocks.numRecords = usedRecords;
+					memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
+				}
+				getLback(line,&len,fd);
+				return 2;
+			} else { // Record unidentified
+				error = 1;
+			}
+		} //End if (readingHeader) 
+	}
+	//End of file but no EOF found
+	printInfo("WARNING SP3 file has no 'EOF' line at the end. SP3 file may be incomplete",options);
+	if(usedRecords!=HeaderNumRecords) {
+		//Header had incorrect number of entries
+		sprintf(messagestr,"WARNING Number of entries in header (%d) does not match with number of entries read (%d)",HeaderNumRecords,usedRecords);
+		printInfo(messagestr,options);
+	}
+	if (readOrbits) {
+		products->SP3->orbits.numRecords = usedRecords;
+		memcpy(&products->SP3->orbits.endTime,&t,sizeof(TTime));
+	}
+	if (readClocks) {
+		products->SP3->clocks.numRecords = usedRecords;
+		memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
 	}
+	
+	return (properlyRead && !error); // properly read AND no error
 }
 
 /*****************************************************************************
- * Name        : getEpochFromObsFile
- * Description : This function reads the timestamp of the start of an epoch,
- *                and leaves the file pointer to the same position. The epoch
- *                is written in the TTime structure parameter
- *               IMPORTANT: This function assumes that the next line to be
- *                read is the start of the next epoch. If it is not the case,
- *                this function will give an error.
+ * Name        : readSP3LastEpoch
+ * Description : Read last epoch from SP3 file. This function is called when the
+                  SP3 files is concatenated more than 3 days
  * Parameters  :
  * Name                           |Da|Unit|Description
  * FILE  *fd                       I  N/A  File descriptor
- * enum Source  src                I  N/A  Source of the RINEX file (RINEX2 or RINEX3)
- * TTime *t                        O  N/A  Timestamp read of the current epoch
+ * TTime *lastEpoch                O  N/A  Last Epoch in SP3 file
  * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Timestamp of start of epoch read
- *                                         0 => No start of epoch found
+ *                                         1 => Last Epoch read
+ *                                         0 => Error
  *****************************************************************************/
-int getEpochFromObsFile (FILE *fd, enum Source src, TTime *t) {
-	int			ret;
-	int			yy=-1,mm=-1,dd=-1,hour=-1,min=-1;
-	int 		len = 0;
-	char 		line[MAX_INPUT_LINE];
-	char    	aux[100];
-	double		seconds;
-	struct tm   tm;
+int readSP3LastEpoch (FILE *fd, TTime *lastEpoch) {
 
-	ret = getL(line,&len,fd);
+	off_t					filesize;
+	struct tm   			tm;
+	long					CurrentPos;
+	int						len = 0;
+	double					seconds;
+	char		    		aux[100];
+	char					line[MAX_INPUT_LINE];
 
-	if (ret==-1) {
-		getLback(line,&len,fd);
-		return 0;
-	} else if (src == RINEX2) {
-		getstr(aux,line,0,4);
-		yy = tm.tm_year = atoi(aux);
-		if (tm.tm_year <= 70) tm.tm_year += 100;
-		getstr(aux,line,3,4);
-		mm = atoi(aux);
-		tm.tm_mon  = mm - 1;
-		getstr(aux,line,6,4);
-		dd = tm.tm_mday = atoi(aux);
-		getstr(aux,line,9,4);
-		if(aux[1]=='.'||aux[2]=='.') {
-			hour= tm.tm_hour = -1;
-		} else {
-			hour = tm.tm_hour = atoi(aux);
+
+	CurrentPos = ftell(fd);
+	//We need to go to the end of the file.
+	//NOTE that fseek(fd, 0L, SEEK_END); does not work as we have opened the file in binary mode!!!
+	filesize = getInputFileSize(fd);
+	fseek(fd,filesize,SEEK_SET);
+
+	while(1) {
+		if (getLback(line,&len,fd)==-1) {
+			fseek(fd,CurrentPos,SEEK_SET);
+			return 0;
 		}
-		getstr(aux,line,12,4);
-		min = tm.tm_min  = atoi(aux);
-		getstr(aux,line,16,10);
-		tm.tm_sec  = atoi(aux);
-		seconds = atof(aux);
-	} else {
-		//RINEX v3
-		if (line[0]=='>' && len<60) {
-			//Line with valid epoch
-			getstr(aux,line,2,4);
-			yy =  atoi(aux);
-			if (yy>=2000) yy-=2000;
-			else yy-=1900;
+		if (line[0]=='*') { // Epoch starting
+			// *  2008 08 27 00 00 00.00000000
+			getstr(aux,line,3,4);
 			tm.tm_year = atoi(aux)-1900;
-			getstr(aux,line,7,2);
-			mm = atoi(aux);
-			tm.tm_mon = mm-1;
-			getstr(aux,line,10,2);
-			dd = tm.tm_mday = atoi(aux);
-			getstr(aux,line,13,2);
-			hour = tm.tm_hour = atoi(aux);
-			getstr(aux,line,16,2);
-			min = tm.tm_min  = atoi(aux);
-			getstr(aux,line,19,10);
+			getstr(aux,line,8,2);
+			tm.tm_mon  = atoi(aux)-1;
+			getstr(aux,line,11,2);
+			tm.tm_mday = atoi(aux);
+			getstr(aux,line,14,2);
+			tm.tm_hour = atoi(aux);
+			getstr(aux,line,17,2);
+			tm.tm_min  = atoi(aux);
+			getstr(aux,line,20,11);
 			tm.tm_sec  = atoi(aux);
 			seconds = atof(aux);
-		} else {
-			hour=-1;
+			lastEpoch->MJDN = MJDN(&tm);
+			lastEpoch->SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+			fseek(fd,CurrentPos,SEEK_SET);
+			return 1;
 		}
 	}
-	if (yy>=0 && yy<=99 && mm>=1 && mm<=12 && dd>=1 && dd<=31 && hour>=0 && hour<=23 && min>=0 &&min<=59) {
-		//Epoch timestamp found
-		t->MJDN = MJDN(&tm);
-		t->SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-		getLback(line,&len,fd);
-		return 1;
-	}
-	getLback(line,&len,fd);
 	return 0;
 }
 
 /*****************************************************************************
- * Name        : readRinexNav
- * Description : Read a RINEX navigation file from a file descriptor
+ * Name        : readRinexClocks
+ * Description : Read a RINEX Clocks file from a file descriptor
  * Parameters  :
  * Name                           |Da|Unit|Description
  * FILE  *fd                       I  N/A  File descriptor
  * TGNSSproducts  *products        O  N/A  Structure to save the data
- * double *rinexNavVersion         O  N/A  Rinex Navigation version number
  * Returned value (int)            O  N/A  Status of the function
  *                                         1 => Properly read
  *                                         2 => Another file concatenated
  *                                         0 => Error
  *****************************************************************************/
-int readRinexNav (FILE *fd, TGNSSproducts *products, double *rinexNavVersion) {
-	char						line[MAX_INPUT_LINE];
-	char						aux[100], a0[100], a1[100], a2[100], a3[100];
-	char						ConstellationType[2];
-	int 						len = 0;
-	int							properlyRead = 0;
-	int							readingHeader = 1;
-	int							i,j;
-	unsigned int				k;  //to avoid warning: comparison between signed and unsigned integer expressions
-	TBRDCblock					block;
-	struct tm					tm;
-	double						seconds;
-	int							row;
-	int							indSat, indBlock;
-	enum TimeSystemCorrection	timecorr;	
-	enum GNSSystem				satSystem;
-	int							GPSweek;
-	double						SoW;
-	int							DoW;	//Day of Week
-
-	products->type = BRDC;
-	// If to avoid overwritten products structure when RINEX navigation are concatennated
-	if ( products->BRDC == NULL ) {
-		products->BRDC = malloc(sizeof(TBRDCproducts));
-		initBRDCproducts(products->BRDC);
-	} else {
-		if ( products->BRDC->numblocksPast!=NULL) {
-			//This is the third or more day we are reading. We need to free memory
-			for(i=0;i<products->BRDC->numsatsPast;i++) {
-				free(products->BRDC->blockPast[i]);
-			}
-			free(products->BRDC->numblocksPast);
-			free(products->BRDC->blockPast);
-			products->BRDC->numblocksPast=NULL;
-			products->BRDC->blockPast=NULL;
-		}
-		memcpy(&products->BRDC->indexPast,&products->BRDC->index,sizeof(int)*MAX_GNSS*MAX_SATELLITES_PER_GNSS);
-		products->BRDC->blockPast=products->BRDC->block;
-		products->BRDC->numblocksPast=products->BRDC->numblocks;
-		products->BRDC->numsatsPast=products->BRDC->numsatsPast;
-		products->BRDC->numsats = 0;
-		products->BRDC->block = NULL;
-		products->BRDC->numblocks = NULL;
-		for (i=0;i<MAX_GNSS;i++) {
-			for (j=0;j<MAX_SATELLITES_PER_GNSS;j++) {
-				products->BRDC->index[i][j] = -1;
-			}
-		}
-	}
-
-
-	initBRDCblock(&block);
-	ConstellationType[0] = '\0';
+int readRinexClocks (FILE *fd, TGNSSproducts *products) {
+	char 			line[MAX_INPUT_LINE];
+	char	 	   	aux[100];
+	char	 	   	aux2[100];
+	int 			len = 0;
+	//double			rinexVersion;
+	int				properlyRead = 0;
+	int				error = 0;
+	int				readingHeader = 1;
+	enum GNSSystem	system;
+	int				PRN;
+	struct tm		tm;
+	int				i,j;
+	int				ind;
+	double			seconds;
+	double			interval;
+	TTime			t, lastT;
+	int				readedSatellites;
+	const int		ini_vsize = 64;
+	int 			found_prn_list = 0;
+	
+	lastT.MJDN = 0;
+	lastT.SoD = 0;
 	
 	while(getL(line,&len,fd)!=-1) {
-		if (strncmp(&line[60],"COMMENT",7)==0) continue; //Comment can also be in the middle of the file
-		if (readingHeader) {
+		if (!readingHeader) {
 			if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
-				getstr(aux,line,0,9);
-				*rinexNavVersion = atof(aux);
-				if ((int)(*rinexNavVersion)>3) {return 0;} //Version check
-				if((int)*(rinexNavVersion)==2 && line[20]=='G') {
-					// GLONASS Rinex v2 navigation file
-					satSystem=GLONASS;
-				} else if ((int)(*rinexNavVersion)==2 && line[20]=='H') {
-					// GEO Rinex v2 navigation file
-					satSystem=GEO;
-				} else if ((int)(*rinexNavVersion)==2) {
-					satSystem=GPS;
-				}
-			} else if (strncmp(&line[60],"ION ALPHA",9)==0) {  // Rinex v2
-				for (i=0;i<4;i++) {
-					getstr(aux,line,2+12*i,12);
-					for (k=0;k<strlen(aux);k++) {
-						if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-					}
-					products->BRDC->ionA[i] = atof(aux);
-				}
-			} else if (strncmp(&line[60],"ION BETA",8)==0) {  // Rinex v2
-				for (i=0;i<4;i++) {
-					getstr(aux,line,2+12*i,12);
-					for (k=0;k<strlen(aux);k++) {
-						if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-					}
-					products->BRDC->ionB[i] = atof(aux);
-				}
-			} else if (strncmp(&line[60],"IONOSPHERIC CORR",16)==0) {  // Rinex v3
-				if (strncmp(&line[0],"GPSA",4)==0) {
-					for (i=0;i<4;i++) {
-						getstr(aux,line,5+12*i,12);
-						for (k=0;k<strlen(aux);k++) {
-							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-						}
-						products->BRDC->ionA[i] = atof(aux);
-					}
-				} else if (strncmp(&line[0],"GPSB",4)==0) {
-					for (i=0;i<4;i++) {
-						getstr(aux,line,5+12*i,12);
-						for (k=0;k<strlen(aux);k++) {
-							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-						}
-						products->BRDC->ionB[i] = atof(aux);
-					}
-				} else if (strncmp(&line[0],"GAL",3)==0) {
-					for (i=0;i<4;i++) {
-						getstr(aux,line,5+12*i,12);
-						for (k=0;k<strlen(aux);k++) {
-							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-						}
-						products->BRDC->ai[i] = atof(aux);
-					}
-				} else if (strncmp(&line[0],"BDSA",4)==0) {
-					for (i=0;i<4;i++) {
-						getstr(aux,line,5+12*i,12);
-						for (k=0;k<strlen(aux);k++) {
-							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-						}
-						products->BRDC->bdsA[i] = atof(aux);
-					}
-				} else if (strncmp(&line[0],"BDSB",4)==0) {
-					for (i=0;i<4;i++) {
-						getstr(aux,line,5+12*i,12);
-						for (k=0;k<strlen(aux);k++) {
-							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-						}
-						products->BRDC->bdsB[i] = atof(aux);
-					}
-				} else if (strncmp(&line[0],"QZSA",4)==0) {
-					for (i=0;i<4;i++) {
-						getstr(aux,line,5+12*i,12);
-						for (k=0;k<strlen(aux);k++) {
-							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-						}
-						products->BRDC->qzsA[i] = atof(aux);
-					}
-				} else if (strncmp(&line[0],"QZSB",4)==0) {
-					for (i=0;i<4;i++) {
-						getstr(aux,line,5+12*i,12);
-						for (k=0;k<strlen(aux);k++) {
-							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-						}
-						products->BRDC->qzsB[i] = atof(aux);
-					}
-				} else if (strncmp(&line[0],"IRNA",4)==0) {
-					for (i=0;i<4;i++) {
-						getstr(aux,line,5+12*i,12);
-						for (k=0;k<strlen(aux);k++) {
-							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-						}
-						products->BRDC->irnA[i] = atof(aux);
-					}
-				} else if (strncmp(&line[0],"IRNB",4)==0) {
-					for (i=0;i<4;i++) {
-						getstr(aux,line,5+12*i,12);
-						for (k=0;k<strlen(aux);k++) {
-							if (aux[k]=='D' || aux[k]=='e') aux[k]='E';
-						}
-						products->BRDC->irnB[i] = atof(aux);
-					}
-				}
-			} else if (strncmp(&line[60],"TIME SYSTEM CORR",16)==0) {  //Rinex v3
-				getstr(aux,line,0,4);
-				timecorr = timecorrstr2timecorrtype(aux); 
-				if ( timecorr != UNKNOWN_TIME_CORR){
-					getstr(aux,line,5,17);
-					products->BRDC->timeSysCorr[timecorr].acoff[0] = atof(aux);
-					getstr(aux,line,22,16);
-					products->BRDC->timeSysCorr[timecorr].acoff[1] = atof(aux);
-					getstr(aux,line,38,7);
-					products->BRDC->timeSysCorr[timecorr].timeref = atoi(aux);
-					getstr(aux,line,45,5);
-					products->BRDC->timeSysCorr[timecorr].weekref = atoi(aux);
-				}
-			} else if (strncmp(&line[60],"LEAP SECONDS",12)==0) {  
-				getstr(aux,line,0,6);
-				products->BRDC->AT_LS = atoi(aux);
-				getstr(aux,line,6,6);
-				if(aux[0] != '\0') { // No number given
-					products->BRDC->AT_LSF = atoi(aux);
-					if(products->BRDC->AT_LSF>0) {
-						products->BRDC->LeapSecondsAvail=1;
+				//Save last epoch
+				memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
+				getLback(line,&len,fd);
+
+				// If the time stamp of a satellite block of the last epoch has not the right value, 
+				// then there has been no data for that satellite, so the satellite block time stamp has to be fixed 
+				for (i=0;i<products->SP3->clocks.numSatellites;i++) {
+					if (tdiff(&t,&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t)!=0) {
+						memcpy(&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t,&t,sizeof(TTime));
 					}
 				}
-				getstr(aux,line,12,6);
-				if(aux[0] != '\0') { // No number given
-					products->BRDC->WN_LSF = atoi(aux);
+				return 2;
+			}
+		}
+		if (readingHeader) {
+			if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
+				//rinexVersion = getDoubleField(line,len,0,9); //Commented to avoid not used variable warning
+			} else if (strncmp(&line[60],"# OF SOLN SATS",14)==0) {
+				products->SP3->clocks.numSatellites = products->SP3->clocks.numSatellitesRead = getIntField(line,len,4,2);
+				// Reserve memory for satellites
+				products->SP3->clocks.block = malloc(sizeof(TSP3clockblock*)*products->SP3->clocks.numSatellites);
+				// RINEX clock standard does not provide any apriori information on the number of records that will 
+				// appear on the file. A dynamic readjustment becomes necessary to overcome this issue.
+				products->SP3->clocks.vsizeblock = ini_vsize;
+				// Reserve initial memory for blocks
+				for (i=0;i<products->SP3->clocks.numSatellites;i++) {
+					products->SP3->clocks.block[i] = malloc(sizeof(TSP3clockblock)*products->SP3->clocks.vsizeblock);
+					for (j=0;j<products->SP3->clocks.vsizeblock;j++) 
+						initSP3clockblock(&products->SP3->clocks.block[i][j]);
 				}
-				getstr(aux,line,18,6);
-				if(aux[0] != '\0') { // No number given
-					products->BRDC->DN = atoi(aux);
+				readedSatellites = 0;
+			} else if (strncmp(&line[60],"PRN LIST",8)==0) {
+				found_prn_list = 1;
+				for (i=0;i<15 && readedSatellites<products->SP3->clocks.numSatellites;i++,readedSatellites++) {
+					system = gnsschar2gnsstype(line[4*i]);
+					products->SP3->clocks.index[system][getIntField(line,len,1+4*i,2)] = readedSatellites;
 				}
 			} else if (strncmp(&line[60],"END OF HEADER",13)==0) {
 				readingHeader = 0;
-				row = 0;
 				properlyRead = 1;
-			}
-		} else {  // Reading body
-			// Block to detect new RINEX header, it only affects when large RINEX are used
-			if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
-				getLback(line,&len,fd);
-				//properlyRead = 1;
-				//break;
-				return 2;
-			}
-			if ((int)(*rinexNavVersion)==2) {
-				if ( row == 0 ) {
-					getstr(aux,line,0,2);
-					block.PRN = atoi(aux);
-					getstr(aux,line,3,2);
-					tm.tm_year = atoi(aux);
-					if (tm.tm_year <= 70) tm.tm_year += 100;
-					getstr(aux,line,6,2);
-					tm.tm_mon  = atoi(aux)-1;
-					getstr(aux,line,9,2);
-					tm.tm_mday = atoi(aux);
-					getstr(aux,line,12,2);
-					tm.tm_hour = atoi(aux);
-					getstr(aux,line,15,2);
-					tm.tm_min  = atoi(aux);
-					getstr(aux,line,18,4);
-					tm.tm_sec  = atoi(aux);
-					seconds = atof(aux);
-					block.Ttoc.MJDN = MJDN(&tm);
-					block.Ttoc.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-				}
-				getstr(a0,line,3,19);
-				if (a0[13]=='D' || a0[13]=='e') a0[13]='E';
-				if (a0[14]=='D' || a0[14]=='e') a0[14]='E';
-				if (a0[15]=='D' || a0[15]=='e') a0[15]='E';      // '-' sign can appear or not
-				getstr(a1,line,22,19);
-				if (a1[13]=='D' || a1[13]=='e') a1[13]='E';
-				if (a1[14]=='D' || a1[14]=='e') a1[14]='E';
-				if (a1[15]=='D' || a1[15]=='e') a1[15]='E';      // '-' sign can appear or not
-				getstr(a2,line,41,19);
-				if (a2[13]=='D' || a2[13]=='e') a2[13]='E';
-				if (a2[14]=='D' || a2[14]=='e') a2[14]='E';
-				if (a2[15]=='D' || a2[15]=='e') a2[15]='E';      // '-' sign can appear or not
-				getstr(a3,line,60,19);
-				if (a3[13]=='D' || a3[13]=='e') a3[13]='E';
-				if (a3[14]=='D' || a3[14]=='e') a3[14]='E';
-				if (a3[15]=='D' || a3[15]=='e') a3[15]='E';      // '-' sign can appear or not
-
-
-				switch (satSystem) {
-					case GPS:
-						switch (row) {
-							case 0:		
-								block.clockbias			= atof(a1);
-								block.clockdrift		= atof(a2);
-								block.clockdriftrate	= atof(a3);
-								break;
-							case 1:
-								block.IODE				= (int)atof(a0);
-								block.crs				= atof(a1);
-								block.deltan			= atof(a2);
-								block.M0				= atof(a3);
-								break;
-							case 2:
-								block.cuc				= atof(a0);
-								block.e					= atof(a1);
-								block.cus				= atof(a2);
-								block.sqrta				= atof(a3);
-								break;
-							case 3:
-								block.toe				= atof(a0);
-								block.cic				= atof(a1);
-								block.OMEGA				= atof(a2);
-								block.cis				= atof(a3);
-								break;
-							case 4:
-								block.i0				= atof(a0);
-								block.crc				= atof(a1);
-								block.omega				= atof(a2);
-								block.OMEGADOT			= atof(a3);
-								break;
-							case 5:
-								block.IDOT				= atof(a0);
-								block.codesOnL2			= (int)atof(a1);
-								block.GPSweek			= (int)atof(a2);
-								block.L2Pdataflag		= (int)atof(a3);
-								break;
-							case 6:
-								block.SVaccuracy		= atof(a0);
-								block.SVhealth			= (int)atof(a1);
-								block.TGD				= atof(a2);
-								block.IODC				= (int)atof(a3);
-								break;
-							case 7:
-								block.transTime			= atof(a0);
-								block.fitInterval		= (int)atof(a1);
-								if ( block.fitInterval == 0 ) block.fitInterval = 4;
-								break;
-						}
-						break;
-					case GLONASS: case GEO:
-						switch(row){
-							case 0:
-								block.clockbias     		        = atof(a1);
-								if (satSystem == GLONASS) {
-									block.clockdrift           	= atof(a2);
-									block.transTime			= atof(a3);
-								} else {
-									block.clockdrift                = atof(a2);
-									block.transTime			= atof(a3);
-								}
-								block.clockdriftrate			= 0.0;
-								//No IODE provided. Set it to -1
-								block.IODE						= -1;
-								block.SVaccuracy				= 0.;
-								break;
-							case 1:
-								block.satposX                           = atof(a0)*1000;
-								block.satvelX                           = atof(a1)*1000;
-								block.sataccX                           = atof(a2)*1000;
-								block.SVhealth                          = (int)atof(a3);
-								break;
-							case 2:
-								block.satposY                           = atof(a0)*1000;
-								block.satvelY                           = atof(a1)*1000;
-								block.sataccY                           = atof(a2)*1000;
-								if (satSystem == GLONASS) {
-									block.freqnumber                = (int)atof(a3);
-								} else {
-									block.URAGEO			= (int)atof(a3);
-								}
-								break;
-							case 3:
-								block.satposZ                           = atof(a0)*1000;
-								block.satvelZ                           = atof(a1)*1000;
-								block.sataccZ                           = atof(a2)*1000;
-								if (satSystem == GLONASS) {
-									block.ageofoperation            = (int)atof(a3);
-									block.fitInterval = 2; //For GLONASS, we will interpolate one hour back and one ahead
-								} else {
-									block.IODNGEO			= (int)atof(a3);
-									block.fitInterval = 4;
-								}
-								break;
-						}
-						break;
-					default:
-						break;
-				}
-				row++;
-				if ( row == 8 || (row==4 && (satSystem == GLONASS || satSystem == GEO ))) {
-					row = 0;
-					if (satSystem == GLONASS ) {
-						//Toc and Toe of GLONASS will be left in UTC because orbits will be computed in UTC time
-						block.Ttoe = block.Ttoc;
-						ttime2gpswsnoroll(&block.Ttoc,&GPSweek,&SoW);
-						//In Rinex v2, GLONASS transmission time is in UTC seconds of day!! We need to change to seconds of GPS Week
-						DoW=(int)(SoW/86400); //Get Day of Week from Toe
-						if(block.transTime<0) {
-							block.transTime+=86400;
-							DoW--;
-							if(DoW<0) {
-								DoW=6;
-								GPSweek--;
-							}
-						}
-						//Transform transmission time from UTC to GPS time
-						block.transTime+=products->BRDC->AT_LS;
-						if(block.transTime>=86400) {
-							block.transTime-=86400;
-							DoW++;
-							if(DoW>6) {
-								DoW=0;
-								GPSweek++;
-							}
-
-						}
-						block.transTime+=DoW*86400;//Convert to seconds of week
-						block.TtransTime = gpsws2ttime(GPSweek,block.transTime);
-					} else if (satSystem == GEO ) {
-						block.Ttoe = block.Ttoc;
-						ttime2gpswsnoroll(&block.Ttoc,&GPSweek,&SoW);
-						block.TtransTime = gpsws2ttime(GPSweek,block.transTime);
-					} else {
-						block.Ttoe = gpsws2ttime(block.GPSweek,block.toe);
-						block.TtransTime = gpsws2ttime(block.GPSweek,block.transTime);
-					}
-					indSat = products->BRDC->index[satSystem][block.PRN];
-					if (indSat == -1) {
-						products->BRDC->index[satSystem][block.PRN] = products->BRDC->numsats;
-						indSat = products->BRDC->index[satSystem][block.PRN];
-						products->BRDC->block = realloc(products->BRDC->block,sizeof(TBRDCblock*)*(products->BRDC->numsats+1));
-						products->BRDC->numblocks = realloc(products->BRDC->numblocks,sizeof(int)*(products->BRDC->numsats+1));
-						products->BRDC->block[indSat] = NULL;
-						products->BRDC->numblocks[indSat] = 0;
-						products->BRDC->numsats++;
-					}
-					indBlock = products->BRDC->numblocks[indSat];
-					products->BRDC->block[indSat] = realloc(products->BRDC->block[indSat],sizeof(TBRDCblock)*(indBlock+1));
-					memcpy(&products->BRDC->block[indSat][indBlock], &block,sizeof(TBRDCblock));
-					products->BRDC->numblocks[indSat]++;
-				}
-			}// End Nav Rinex v2
-			 // Start Nav Rinex v3
-			else if ((int)(*rinexNavVersion)==3) {
-				if (row==0) {
-					getstr(ConstellationType,line,0,1);	//GNSS type letter
-					satSystem = gnsschar2gnsstype(ConstellationType[0]);
-					if ( satSystem==QZSS || satSystem==IRNSS)  {row++;continue;} // QZSS and IRNSS are unsupported
-						getstr(aux,line,1,2);	//PRN
-						block.PRN = atoi(aux);
-						getstr(aux,line,4,4);	//Year
-						tm.tm_year = atoi(aux) -1900;
-						getstr(aux,line,9,2);	//Month
-						tm.tm_mon  = atoi(aux)-1;
-						getstr(aux,line,12,2);	//Day
-						tm.tm_mday = atoi(aux);
-						getstr(aux,line,15,2);	//Hour
-						tm.tm_hour = atoi(aux);
-						getstr(aux,line,18,2);	//Minute
-						tm.tm_min  = atoi(aux);
-						getstr(aux,line,21,2);	//Second
-						tm.tm_sec  = atoi(aux);
-						seconds = atof(aux);
-						block.Ttoc.MJDN = MJDN(&tm);
-						block.Ttoc.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-				}
-				if ( satSystem==QZSS || satSystem==IRNSS ) { //QZSS and IRNSS are unsupported
-					row++;
-					if(row==8) { row=0;}	
-					continue;
-				} 
-				getstr(a0,line,4,19);
-				if (a0[13]=='D' || a0[13]=='e') a0[13]='E';
-				if (a0[14]=='D' || a0[14]=='e') a0[14]='E';
-				if (a0[15]=='D' || a0[15]=='e') a0[15]='E';	// '-' sign can appear or not
-				getstr(a1,line,23,19);
-				if (a1[13]=='D' || a1[13]=='e') a1[13]='E';
-				if (a1[14]=='D' || a1[14]=='e') a1[14]='E';
-				if (a1[15]=='D' || a1[15]=='e') a1[15]='E';	// '-' sign can appear or not
-				getstr(a2,line,42,19);
-				if (a2[13]=='D' || a2[13]=='e') a2[13]='E';
-				if (a2[14]=='D' || a2[14]=='e') a2[14]='E';
-				if (a2[15]=='D' || a2[15]=='e') a2[15]='E';	// '-' sign can appear or not
-				getstr(a3,line,61,19);
-				if (a3[13]=='D' || a3[13]=='e') a3[13]='E';
-				if (a3[14]=='D' || a3[14]=='e') a3[14]='E';
-				if (a3[15]=='D' || a3[15]=='e') a3[15]='E';	// '-' sign can appear or not
-
-				
-
-				switch (satSystem) {
-					case GPS: case Galileo: case BDS:
-						switch (row) {
-							case 0:
-								block.clockbias							= atof(a1);
-								block.clockdrift						= atof(a2);
-								block.clockdriftrate					= atof(a3);
-								break;
-							case 1:
-								block.IODE								= (int)atof(a0);
-								block.crs								= atof(a1);
-								block.deltan							= atof(a2);
-								block.M0								= atof(a3);
-								break;
-							case 2:
-								block.cuc								= atof(a0);
-								block.e									= atof(a1);
-								block.cus								= atof(a2);
-								block.sqrta								= atof(a3);
-								break;
-							case 3:
-								block.toe								= atof(a0);
-								block.cic								= atof(a1);
-								block.OMEGA								= atof(a2);
-								block.cis								= atof(a3);
-								break;
-							case 4:
-								block.i0								= atof(a0);
-								block.crc								= atof(a1);
-								block.omega								= atof(a2);
-								block.OMEGADOT							= atof(a3);
-								break;
-							case 5:
-								block.IDOT								= atof(a0);
-								if (satSystem == GPS) {
-									block.codesOnL2						= (int)atof(a1);
-									block.GPSweek						= (int)atof(a2);
-									block.L2Pdataflag					= (int)atof(a3);
-								} else if (satSystem == Galileo) {
-									block.dataSources		= (int)atof(a1);
-									block.GALweek			= (int)atof(a2);
-									block.GPSweek			= block.GALweek;
-								} else if (satSystem == BDS) {
-									block.BDSweek			= (int)atof(a2);
-									block.GPSweek			= block.BDSweek+1356;
-								}
-								break;
-							case 6:
-								block.SVaccuracy = block.SISASignal		= atof(a0);
-								block.SVhealth							= (int)atof(a1);
-								if (satSystem == GPS) {
-									block.TGD							= atof(a2);
-									block.IODC							= (int)atof(a3);
-								} else if (satSystem == Galileo) {
-									block.BGDE5a			= atof(a2);
-									block.BGDE5b			= atof(a3);
-								} else if (satSystem == BDS) {
-									block.TGD                       = atof(a2);
-									block.TGD2                      = atof(a3);
-								}
-								break;
-							case 7:
-								block.transTime							= atof(a0);
-								if (satSystem == GPS) {								
-									block.fitInterval					= (int)atof(a1);
-									if ( block.fitInterval == 0 ) block.fitInterval = 4;
-								} else if (satSystem == BDS) {
-									//block.transTime-=14;//Adjust 14 seconds to GPS time
-									block.IODC                      = (int)atof(a1);
-									if ( block.IODC>=0 && block.IODC<=1023 ) block.fitInterval=4;
-								} else  if (satSystem == Galileo) {
-									block.fitInterval		= 4;
-								}
-								break;
-						}
-						break;
-					case GLONASS: case GEO:
-						switch(row){
-							case 0:
-								block.clockbias     		        = atof(a1);
-								if (satSystem == GLONASS) {
-									block.clockdrift          	= atof(a2);
-									block.transTime			= atof(a3);
-								} else {
-									block.clockdrift                = atof(a2);
-									block.transTime			= atof(a3);
-								}
-								block.clockdriftrate					= 0.0;
-								//No IODE and IODC provided. Set it to -1
-								block.IODE								= -1;
-								block.IODC         			           	= -1; 
-								block.SVaccuracy						= 0.;
-								break;
-							case 1:
-								block.satposX                           = atof(a0)*1000;
-								block.satvelX                           = atof(a1)*1000;
-								block.sataccX                           = atof(a2)*1000;
-								block.SVhealth                          = (int)atof(a3);
-								break;
-							case 2:
-								block.satposY                           = atof(a0)*1000;
-								block.satvelY                           = atof(a1)*1000;
-								block.sataccY                           = atof(a2)*1000;
-								if (satSystem == GLONASS) {
-									block.freqnumber                = (int)atof(a3);
-								} else {
-									block.URAGEO			= (int)atof(a3);
-								}
-								break;
-							case 3:
-								block.satposZ                           = atof(a0)*1000;
-								block.satvelZ                           = atof(a1)*1000;
-								block.sataccZ                           = atof(a2)*1000;
-								if (satSystem == GLONASS) {
-									block.ageofoperation            = (int)atof(a3);
-									block.fitInterval = 2; //For GLONASS, we will interpolate one hour back and one ahead
-								} else {
-									block.IODNGEO			= (int)atof(a3);
-									block.fitInterval = 4;
-								}
-								break;
+				products->SP3->clocks.numRecords = 0;
+				// The standard forces that the field 'PRN LIST' is present in the header, so the next section would
+				// never be executed...
+				if (!found_prn_list) {
+					readedSatellites = 0;
+					for (i=0;i<MAX_GNSS;i++) {
+						for (j=0;j<MAX_SATELLITES_PER_GNSS;j++) {
+							products->SP3->clocks.index[i][j] = readedSatellites;
+							readedSatellites++;
 						}
-						break;
-					default:
-						break;
+					}
+					products->SP3->clocks.numSatellites = readedSatellites;
+					// Reserve memory for satellites
+					products->SP3->clocks.block = malloc(sizeof(TSP3clockblock*)*products->SP3->clocks.numSatellites);
+					products->SP3->clocks.vsizeblock = ini_vsize;
+					for (i=0;i<products->SP3->clocks.numSatellites;i++) {
+						products->SP3->clocks.block[i] = malloc(sizeof(TSP3clockblock)*products->SP3->clocks.vsizeblock);
+						for (j=0;j<products->SP3->clocks.vsizeblock;j++) 
+							initSP3clockblock(&products->SP3->clocks.block[i][j]);
+					}
 				}
-				row++;
-				if (row==8 || (row==4 && (satSystem == GLONASS || satSystem == GEO ))) {
-					row = 0;
-					if (satSystem == GLONASS ) {
-						//Toc and Toe of GLONASS will be left in UTC because orbits will be computed in UTC time
-						block.Ttoe = block.Ttoc;
-						ttime2gpswsnoroll(&block.Ttoc,&GPSweek,&SoW);
-						//In Rinex v3, GLONASS transmission time is in UTC seconds of week!
-						//Transform transmission time from UTC to GPS time
-						block.transTime+=products->BRDC->AT_LS;
-						block.TtransTime = gpsws2ttime(GPSweek,block.transTime);
-					} else if (satSystem == GEO ) {
-						block.Ttoe = block.Ttoc;
-						ttime2gpswsnoroll(&block.Ttoc,&GPSweek,&SoW);
-						block.TtransTime = gpsws2ttime(GPSweek,block.transTime);
-					} else if (satSystem == BDS ) {
-						//Convert from BeiDou time to GPS time
-						//block.toe (toe in in seconds of BDS week) must be left untouched for computing satellite coordinates correctly
-						block.Ttoc = tdadd(&block.Ttoc,14.);
-						block.Ttoe = gpsws2ttime(block.GPSweek,block.toe+14.);
-						block.TtransTime = gpsws2ttime(block.GPSweek,block.transTime+14.);
+			}
+		} else { // !readingHeader
+			getstr(aux,line,3,4);
+			getstr(aux2,line,0,2);
+			PRN = getIntField(line,len,4,2);
+			if ( (aux[0]=='G' || aux[0]=='R' || aux[0]=='E' || aux[0]=='S' || aux[0]=='C' || aux[0]=='J' || aux[0]=='I' ) && PRN>0 && strncmp(aux2,"AS",2)==0 )  {
+				// AS G02  2008 10 10 00 00  0.000000  2    1.813604156067e-04  3.113411106060e-11
+				system = gnsschar2gnsstype(aux[0]);
+				ind = products->SP3->clocks.index[system][PRN];
+
+				tm.tm_year = getIntField(line,len,8,4)-1900;
+				tm.tm_mon  = getIntField(line,len,13,2)-1;
+				tm.tm_mday = getIntField(line,len,16,2);
+				tm.tm_hour = getIntField(line,len,19,2);
+				tm.tm_min  = getIntField(line,len,22,2);
+				tm.tm_sec  = getIntField(line,len,25,9);
+				seconds = getDoubleField(line,len,25,9);
+				t.MJDN = MJDN(&tm);
+				t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+				
+				if (lastT.MJDN != t.MJDN || lastT.SoD != t.SoD) { // New Epoch
+					if (products->SP3->clocks.interval == 0. && lastT.MJDN!=0) { // If interval is still not known (and it is not the first epoch)
+						interval = tdiff(&t,&lastT);
+						if (interval>=1.) {
+							//Take out decimals if interval is greater than 1
+							products->SP3->clocks.interval = (double)((int)(interval));
+						} else {
+							products->SP3->clocks.interval = interval;
+						}
+					}
+
+					// Added check: If in one epoch there is no data for a given satellite, it will have an invalid clock value but it will not
+					// have the correct time stamp, which will be a problem when interpolating clocks
+					if ( lastT.MJDN != 0 ) { //It is not the first epoch
+						for (i=0;i<products->SP3->clocks.numSatellites;i++) {
+							// If the time stamp of a satellite block of the previous epoch has not the right value, 
+								// then there has been no data for that satellite, so the satellite block time stamp has to be fixed 
+							if (tdiff(&lastT,&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t)!=0) {
+								memcpy(&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t,&lastT,sizeof(TTime));
+							}
+						}
 					} else {
-						block.Ttoe = gpsws2ttime(block.GPSweek,block.toe);
-						block.TtransTime = gpsws2ttime(block.GPSweek,block.transTime);
+						//First epoch. Save start time
+						memcpy(&products->SP3->clocks.startTime,&t,sizeof(TTime));
 					}
-					indSat = products->BRDC->index[satSystem][block.PRN];
-					if (indSat == -1) {
-						products->BRDC->index[satSystem][block.PRN] = products->BRDC->numsats;
-						indSat = products->BRDC->index[satSystem][block.PRN];
-						products->BRDC->block = realloc(products->BRDC->block,sizeof(TBRDCblock*)*(products->BRDC->numsats+1));
-						products->BRDC->numblocks = realloc(products->BRDC->numblocks,sizeof(int)*(products->BRDC->numsats+1));
-						products->BRDC->block[indSat] = NULL;
-						products->BRDC->numblocks[indSat] = 0;
-						products->BRDC->numsats++;
+
+					memcpy(&lastT,&t,sizeof(TTime));
+					products->SP3->clocks.numRecords++;
+					if (products->SP3->clocks.numRecords == products->SP3->clocks.vsizeblock) {
+						products->SP3->clocks.vsizeblock *= 2;
+						// Reserve memory for blocks
+						for (i=0;i<products->SP3->clocks.numSatellites;i++) {
+							products->SP3->clocks.block[i] = realloc(products->SP3->clocks.block[i],sizeof(TSP3clockblock)*products->SP3->clocks.vsizeblock);
+							for (j=products->SP3->clocks.vsizeblock/2;j<products->SP3->clocks.vsizeblock;j++)  {
+								initSP3clockblock(&products->SP3->clocks.block[i][j]);
+							}
+						}
 					}
-					indBlock = products->BRDC->numblocks[indSat];
-					products->BRDC->block[indSat] = realloc(products->BRDC->block[indSat],sizeof(TBRDCblock)*(indBlock+1));
-					memcpy(&products->BRDC->block[indSat][indBlock], &block,sizeof(TBRDCblock));
-					products->BRDC->numblocks[indSat]++;
 				}
-			}// End Nav Rinex v3
+			
+				products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clock = getDoubleField(line,len,37,22)*c0;
+				products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockrate = 0.0;
+				products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockdriftrate = 0.0;
+
+				//Read clock flags if available (NOTE: This is not in RINEX standard, but appear in MGEX clock files
+				if(len>=83) {
+				   if (	strncmp(&line[81],"  ",2)!=0) {
+						strncpy(products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockflags,&line[81],2);
+						products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockflags[2]='\0';
+				   }
+				} else {
+					products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockflags[0]='\0';
+				}
+			
+				//getstr(aux,line,59,22);
+			
+				memcpy(&products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].t,&t,sizeof(TTime));
+			}
 		}
 	}
 
-	return (properlyRead); // properly read 
+	for (i=0;i<products->SP3->clocks.numSatellites;i++) {
+		// If the time stamp of a satellite block of the last epoch has not the right value, 
+		// then there has been no data for that satellite, so the satellite block time stamp has to be fixed 
+		if (tdiff(&t,&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t)!=0) {
+			memcpy(&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t,&t,sizeof(TTime));
+		}
+	}
+	//Save last epoch
+	memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
+
+	return (properlyRead && !error); // properly read AND no error
 }
 
 /*****************************************************************************
- * Name        : readRinexNavLastEpoch
- * Description : Find last epoch of RINEX navigation file. It will read the last
- *                day of data, as it can't assume that data is ordered 
+ * Name        : readRinexClocksFile
+ * Description : Read a RINEX Clocks file from a filename
  * Parameters  :
  * Name                           |Da|Unit|Description
- * FILE  *fd                       I  N/A  File descriptor
- * TTime *lastEpoch                O  N/A  Last Epoch in SP3 file
+ * char  *filename                 I  N/A  Name of the file
+ * TGNSSproducts  *products        O  N/A  Structure to save the data
  * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Last Epoch read
- *                                         0 => Error
+ *                                         1  => File open and properly read
+ *                                         0  => File open and failed to read
+ *                                         -1 => File not open
  *****************************************************************************/
-int readRinexNavLastEpoch (FILE *fd, TTime *lastEpoch) {
-
-    struct stat             filestat;   //This is to get the file size
-    off_t                   filesize;
-    long                    CurrentPos;
-    int                     len = 0;
-	int						i;
-    char                    line[MAX_INPUT_LINE];
-	double					rinexNavVersion; 						
-	TGNSSproducts 			products;
-
-	initGNSSproducts(&products);
-
+int readRinexClocksFile (char *filename, TGNSSproducts *products) {
+	FILE	*fd;
+	int		ret;
+	
+	if (whatFileTypeIs(filename)!=ftRINEXclocks) return 0;
+	
+	if ((fd = openInputFile(filename))) {
+		ret = readRinexClocks (fd, products);
+		fclose(fd);
+		return ret;
+	} else {
+		// File do not exist
+		return -1;
+	}
+}
 
-    CurrentPos = ftell(fd);
-    //We need to go to the end of the file.
-    //NOTE that fseek(fd, 0L, SEEK_END); does not work as we have opened the file in binary mode!!!
-    fstat(fileno(fd), &filestat);
-    filesize = filestat.st_size;
-    fseek(fd,filesize,SEEK_SET);
+/*****************************************************************************
+ * Name        : readGalileoTroposphericData
+ * Description : Read tropospheric data files extracted from ESA's Matlab
+ *	             tropospheric model (version 2.5, 07/09/2007). These data files
+ *               are created exporting to text files the content of the
+ *	             variables created when loading 'meteo_esa' library
+ *	             (for data exporting, the following Octave's command must be used: 
+ *                'save data_<Variable Name>.txt <Variable Name>')
+ *	             These files were first exported with Octave v3.2.3
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TTROPOGal *TropoGal             O  N/A  Structure to save the data
+ * char *filename                  O  N/A  File name (only in case of failure)
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Properly read
+ *                                         0 => Error
+ *****************************************************************************/
+int readGalileoTroposphericData (TTROPOGal *TropoGal, char *filename, TOptions *options) {
 
-    while(1) {
-        if (getLback(line,&len,fd)==-1) {
-			fseek(fd,CurrentPos,SEEK_SET);
-			return 0;
-		}
-		if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
-			if (getLback(line,&len,fd)==-1) {
-				fseek(fd,CurrentPos,SEEK_SET);
-				return 0;
-			}
-			break;
-		}
-	}
-	if (readRinexNav(fd, &products, &rinexNavVersion)<1) {
-		free(products.BRDC->block);
-		fseek(fd,CurrentPos,SEEK_SET);
-		return 0;
-	}
-	fseek(fd,CurrentPos,SEEK_SET);
-	*lastEpoch=getProductsLastEpochBRDC(&products);
-	//Free memory
-	for(i=0;i<products.BRDC->numsats;i++) {
-		free(products.BRDC->block[i]);
-	}
-	free(products.BRDC->numblocks);
-	free(products.BRDC->block);
-	return 1;
+	return 0;
 }
 
 /*****************************************************************************
- * Name        : readSP3
- * Description : Read an SP3 precise products file from a file descriptor
+ * Name        : readIONEX
+ * Description : Read a IONEX file from a file descriptor
  * Parameters  :
  * Name                           |Da|Unit|Description
  * FILE  *fd                       I  N/A  File descriptor
- * TGNSSproducts  *products        O  N/A  Structure to save the data
- * int  readOrbits                 I  N/A  Flag to read the position and 
- *                                         velocities (0 or 1)
- * int  readClocks                 I  N/A  Flag to read the clocks (0 or 1)
- * int  readingRefFile             I  N/A  Flag to indicate if we are reading a reference position file (0 or 1)
- * TOptions  *options              I  N/A  TOptions structure
+ * TIONEX  *IONEX                  O  N/A  Structure to save the data
+ * double *ionexVersion            O  N/A  IONEX file version
  * Returned value (int)            O  N/A  Status of the function
+ *                                         4 => File is concatenated but no END OF FILE found
+ *                                         3 => File is concatenated
+ *                                         2 => properly read but no END OF FILE found
  *                                         1 => Properly read
- *                                         2 => Another file concatenated
  *                                         0 => Error
- *                                        -2 => Number of entries in header is incorrect (deprecated)
- *                                        -3 => If reading reference position file, there is more than
- *                                                one satellite available
+ *                                        -2 => Number of records read do not match the number given in the header
+ *                                        -3 => Something wrong or missing in Header
  *****************************************************************************/
-int readSP3 (FILE *fd, TGNSSproducts *products, int readOrbits, int readClocks, int readingRefFile, TOptions *options) {
-	char 			line[MAX_INPUT_LINE];
-	char    		aux[100];
-	int 			len = 0;
+int readIONEX (FILE *fd, TIONEX *IONEX, double *ionexVersion) {
+	char			line[MAX_INPUT_LINE];
+	char			aux[100];
+	int				len = 0;
 	int				properlyRead = 0;
-	int				error = 0;
-	int				readingHeader = 1;
-	int				i,k;
-	int				PRN;
-	int				HeaderNumRecords;
-	int				FirstHeaderfline=1;
-	TTime			t,lastT;
-	int				ind;
+	int				i, j;
+	int				PRN;
+	int				HeaderLinesNecessary=-13;
 	struct tm		tm;
 	double			seconds;
-	double			interval;
-	int				readedLine = 0;
-	int				readedSatellites;
-	//char			versionId;
-	enum GNSSystem	system;
-	int				usedRecords;
-	int				CurrentInd;
-	int				auxN;
-	double			BaseSigmaOrbit;
-	double			BaseSigmaClock;
-
-	if (!readOrbits && !readClocks) return 0;
-
-	products->type = SP3;
-	products->SP3 = malloc(sizeof(TSP3products));
-	initSP3products(products->SP3);
-	lastT.MJDN = 0;
-	lastT.SoD = 0;
+	int				readingCells = 0;
+	int				mapType; // 0->TEC 1->RMS 2->HGT
+	int				RMSstarted=0,HGTstarted=0;
+	int				numFirstLineHeaderRead=0;
+	int				EndofFileFound=0;
+	TIonoMap		ionoMap;
+	TIonexStation	ionexStation;
+	int				ind;
+	double			lat;
+	double			lon1, lon2, dlon, lon;
+	int				nlon, ilon;
+	double			h;
+	double			ionoValue;
+	char			ConstellationType[2];
+	enum GNSSystem	satSystem;
+	static int		firstTimeRead=1;
+	
+	initIonoMap(&ionoMap);
+	initIonexStation(&ionexStation);
+	ConstellationType[0] = '\0';
 
 	while(getL(line,&len,fd)!=-1) {
-		readedLine++;
-		if (readingHeader) {
-			if (readedLine==1) {
-				// #bP2008  8 27 00 00 00.00000000      96   d   ITR91 FIT  JPL
-				if (line[0]!='#') error = 1;
-				if (line[2]=='V') products->SP3->orbits.velocityAvailable = 1;
-				else products->SP3->orbits.velocityAvailable = 0;
-				getstr(aux,line,32,7);
-				HeaderNumRecords=atoi(aux);
-				if (readOrbits) products->SP3->orbits.numRecords = atoi(aux);
-				if (readClocks) products->SP3->clocks.numRecords = atoi(aux);
-			} else if (readedLine==2) {
-				// ## 1494 259200.00000000   900.00000000 54705 0.0000000000000
-				//getstr(aux,line,24,14);
-				//if (readOrbits) products->SP3->orbits.interval = atof(aux);
-				//if (readClocks) products->SP3->clocks.interval = atof(aux);
-				getstr(aux,line,39,5);
-				if (readOrbits) products->SP3->orbits.startTime.MJDN = atoi(aux);
-				if (readClocks) products->SP3->clocks.startTime.MJDN = atoi(aux);
-				getstr(aux,line,45,15);
-				if (readOrbits) products->SP3->orbits.startTime.SoD = atof(aux)*86400.0;
-				if (readClocks) products->SP3->clocks.startTime.SoD = atof(aux)*86400.0;
-			} else if (strncmp(line,"+ ",2)==0) {
-				// +   31   G02G03G04G05G06G07G08G09G10G11G12G13G14G15G16G17G18
-				if (readedLine==3) {
-					getstr(aux,line,3,3);
-					auxN = atoi(aux);
-					if(readingRefFile==1) {
-						//If we are reading reference file only one satellite must be in the SP3 file
-						if (auxN>1) {
-							return -3;
-						}
+		if (!readingCells) {
+			if (strncmp(&line[60],"IONEX VERSION / TYPE",20)==0) {
+				numFirstLineHeaderRead++;
+				if (numFirstLineHeaderRead>1) {
+					//Second time "IONEX VERSION / TYPE" line appears. 
+					//It is a concatenated file and we have already read one file
+					getLback(line,&len,fd);
+					if (EndofFileFound==1) {
+						properlyRead=3;
+					} else {
+						properlyRead=4;
 					}
-					if (readOrbits) products->SP3->orbits.numSatellites = products->SP3->orbits.numSatellitesRead = auxN;
-					if (readClocks) products->SP3->clocks.numSatellites = products->SP3->clocks.numSatellitesRead = auxN;
-					// Reserve memory for satellites
-					if (readOrbits) {
-						products->SP3->orbits.block = malloc(sizeof(TSP3orbitblock*)*products->SP3->orbits.numSatellites);
-						for (i=0;i<products->SP3->orbits.numSatellites;i++) {
-							products->SP3->orbits.block[i]=NULL;
-						}
-						products->SP3->orbits.accuracy = malloc(sizeof(double)*products->SP3->orbits.numSatellites);
+					break;
+				}
+				*ionexVersion = getDoubleField(line,len,0,9);
+				if (firstTimeRead==0) {
+					//Free memory from the previous day read
+					for (i=0;i<IONEX->numMaps;i++) {
+						free(IONEX->map[i].TEC);
+						free(IONEX->map[i].RMS);
+						free(IONEX->map[i].HGT);
 					}
-					if (readClocks) {
-						products->SP3->clocks.block = malloc(sizeof(TSP3clockblock*)*products->SP3->clocks.numSatellites);
-						for (i=0;i<products->SP3->clocks.numSatellites;i++) {
-							products->SP3->clocks.block[i]=NULL;
-						}
+					if (IONEX->ionexStation!=NULL) {
+						free(IONEX->ionexStation);
 					}
-					readedSatellites = 0;
+					free(IONEX->map);
+					initIONEX(IONEX);
 				}
-				for (i=0;i<17 && readedSatellites<auxN;i++,readedSatellites++) { //auxN = products->SP3->XXXX.numSatellites;
-					system = gnsschar2gnsstype(line[9+3*i]);
-					getstr(aux,line,10+3*i,2);
-					if (readOrbits) products->SP3->orbits.index[system][atoi(aux)] = readedSatellites;
-					if (readClocks) products->SP3->clocks.index[system][atoi(aux)] = readedSatellites;
+				if (*ionexVersion != 1.0 ) return 0;
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"EPOCH OF FIRST MAP",18)==0) {
+				tm.tm_year = getIntField(line,len,2,4)-1900;
+				tm.tm_mon  = getIntField(line,len,10,2)-1;
+				tm.tm_mday = getIntField(line,len,16,2);
+				tm.tm_hour = getIntField(line,len,22,2);
+				tm.tm_min  = getIntField(line,len,28,2);
+				tm.tm_sec  = getIntField(line,len,34,11);
+				seconds = getDoubleField(line,len,34,11);
+				IONEX->startTime.MJDN = MJDN(&tm);
+				IONEX->startTime.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"EPOCH OF LAST MAP",17)==0) {
+				tm.tm_year = getIntField(line,len,2,4)-1900;
+				tm.tm_mon  = getIntField(line,len,10,2)-1;
+				tm.tm_mday = getIntField(line,len,16,2);
+				tm.tm_hour = getIntField(line,len,22,2);
+				tm.tm_min  = getIntField(line,len,28,2);
+				tm.tm_sec  = getIntField(line,len,34,11);
+				seconds = getDoubleField(line,len,34,11);
+				IONEX->endTime.MJDN = MJDN(&tm);
+				IONEX->endTime.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"INTERVAL",8)==0) {
+				IONEX->interval = getIntField(line,len,0,6);
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"# OF MAPS IN FILE",17)==0) {
+				IONEX->numMaps = getIntField(line,len,0,6); 
+				// Reserve memory for maps
+				IONEX->map = malloc(sizeof(TIonoMap)*IONEX->numMaps);
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"MAPPING FUNCTION",16)==0) {
+				getstr(aux,line,2,4);
+				strcpy(IONEX->mappingFunction,aux);
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"ELEVATION CUTOFF",16)==0) {
+				IONEX->elevationCutoff = getDoubleField(line,len,0,8);
+			} else if (strncmp(&line[60],"OBSERVABLES USED",16)==0) {
+				getstr(aux,line,0,60);
+				strcpy(IONEX->observablesUsed,aux);
+			} else if (strncmp(&line[60],"# OF STATIONS",13)==0) {
+				IONEX->stationNumber = getIntField(line,len,0,6);
+			} else if (strncmp(&line[60],"# OF SATELLITES",15)==0) {
+				IONEX->satNumber = getIntField(line,len,0,6);
+			} else if (strncmp(&line[60],"BASE RADIUS",11)==0) {
+				IONEX->baseRadius = getDoubleField(line,len,0,8);
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"MAP DIMENSION",13)==0) {
+				IONEX->mapDimension = getIntField(line,len,0,6);
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"EXPONENT",8)==0) {
+				IONEX->exponent = getIntField(line,len,0,6);
+				IONEX->conversionFactor = E(IONEX->exponent);
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"HGT1 / HGT2 / DHGT",18)==0) {
+				getstr(aux,line,2,6);			// HGT1
+				ionoMap.hgt1 = atof(aux);
+				getstr(aux,line,8,6);			// HGT2
+				ionoMap.hgt2 = atof(aux);
+				getstr(aux,line,14,6);			// DHGT
+				ionoMap.dhgt = atof(aux);
+				ionoMap.nhgt = numSteps(ionoMap.hgt1,ionoMap.hgt2,ionoMap.dhgt);
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"LAT1 / LAT2 / DLAT",18)==0) {
+				getstr(aux,line,2,6);			// LAT1
+				ionoMap.lat1 = atof(aux);
+				getstr(aux,line,8,6);			// LAT2
+				ionoMap.lat2 = atof(aux);
+				getstr(aux,line,14,6);			// DLAT
+				ionoMap.dlat = atof(aux);
+				ionoMap.nlat = numSteps(ionoMap.lat1,ionoMap.lat2,ionoMap.dlat);
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"LON1 / LON2 / DLON",18)==0) {
+				getstr(aux,line,2,6);			// LON1
+				ionoMap.lon1 = atof(aux);
+				getstr(aux,line,8,6);			// LON2
+				ionoMap.lon2 = atof(aux);
+				getstr(aux,line,14,6);			// DLON
+				ionoMap.dlon = atof(aux);
+				ionoMap.nlon = numSteps(ionoMap.lon1,ionoMap.lon2,ionoMap.dlon);
+				HeaderLinesNecessary++;
+			} else if (strncmp(&line[60],"START OF TEC MAP",16)==0) {
+				if(HeaderLinesNecessary!=0) break;
+				ind = getIntField(line,len,0,6) -1;
+				mapType = 0;  // 0->TEC
+				//Check if number of records read is not greater than the number given in the header
+				if(ind+1>IONEX->numMaps) {
+					return -2;
 				}
-			} else if (strncmp(line,"++",2)==0) {
-				if (readedSatellites==auxN) readedSatellites=0; //This is the first line with "++" read
-				for (i=0;i<17 && readedSatellites<auxN;i++,readedSatellites++) { //auxN = products->SP3->XXXX.numSatellites;
-					// Accuracy is 2^val mm.
-					getstr(aux,line,10+3*i,2);
-					if (readOrbits) products->SP3->orbits.accuracy[readedSatellites] = pow(2,atoi(aux))*1e-3;
+			} else if (strncmp(&line[60],"START OF RMS MAP",16)==0) {
+				if(HeaderLinesNecessary!=0) break;
+				//Check if number of TEC records read match the number given in the header
+				if(ind+1<IONEX->numMaps && RMSstarted==0) {
+					return -2;
 				}
-			} else if (strncmp(line,"%f",2)==0) {
-				if (FirstHeaderfline==1) {
-					FirstHeaderfline=0;
-					if (readOrbits) {
-						getstr(aux,line,3,10);
-						BaseSigmaOrbit=atof(aux);
-						if (BaseSigmaOrbit==0.) {
-							BaseSigmaOrbit=2.;
-						}
-					}
-					if (readClocks) {
-						getstr(aux,line,14,10);
-						BaseSigmaClock=atof(aux);
-						if (BaseSigmaClock==0.) {
-							BaseSigmaClock=2.;
-						}
-					}
+				RMSstarted=1;
+				ind = getIntField(line,len,0,6) -1;
+				mapType = 1;  // 1->RMS
+				IONEX->RMSavailable = 1; 
+				//Check if number of records read is not greater than the number given in the header
+				if(ind+1>IONEX->numMaps) {
+					return -2;
 				}
-			} else if (strncmp(line,"/*",2)==0) {
-				// /* CCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCC
-				// ++         0  0  0  0  0  0  0  0  0  0  0  0  0  0  0  0  0
-				do {
-					if (getL(line,&len,fd)==-1) {
-						error=1;
-						return 0;
+			} else if (strncmp(&line[60],"START OF HEIGHT MAP",19)==0) {
+				if(HeaderLinesNecessary!=0) break;
+				//Check if number of RMS records read match the number given in the header
+				if(ind+1<IONEX->numMaps && HGTstarted==0) {
+					return -2;
+				}
+				HGTstarted=1;
+				ind = getIntField(line,len,0,6) -1;
+				mapType = 2;  // 2->HGT
+				IONEX->HGTavailable = 1;
+				//Check if number of records read is not greater than the number given in the header
+				if(ind+1>IONEX->numMaps) {
+					return -2;
+				}
+			} else if (strncmp(&line[60],"END OF TEC MAP",14)==0) {
+				if(HeaderLinesNecessary!=0) break;
+
+			} else if (strncmp(&line[60],"END OF RMS MAP",14)==0) {
+				if(HeaderLinesNecessary!=0) break;
+
+			} else if (strncmp(&line[60],"END OF HEIGHT MAP",17)==0) {
+				if(HeaderLinesNecessary!=0) break;
+		
+			} else if (strncmp(&line[60],"END OF HEADER",13)==0) {
+				properlyRead=2;
+				HeaderLinesNecessary++;
+				for (i=0;i<IONEX->numMaps;i++) {
+					memcpy(&IONEX->map[i],&ionoMap,sizeof(TIonoMap));
+					IONEX->map[i].TEC = malloc(sizeof(double)*getIonoMapTotalSize(&IONEX->map[i]));
+					IONEX->map[i].RMS = malloc(sizeof(double)*getIonoMapTotalSize(&IONEX->map[i]));
+					IONEX->map[i].HGT = malloc(sizeof(double)*getIonoMapTotalSize(&IONEX->map[i]));
+					for(j=0;j<getIonoMapTotalSize(&IONEX->map[i]);j++) {
+						//Initialize everything to 9999, so if there are any value missing in the IONEX file, the value stored will be 9999 and not 0
+						IONEX->map[i].TEC[j]=9999;
+						IONEX->map[i].RMS[j]=9999;
+						IONEX->map[i].HGT[j]=9999;
 					}
-				} while(strncmp(line,"/*",2)==0);
-				getLback(line,&len,fd);
+				}
+			} else if (strncmp(&line[60],"EPOCH OF CURRENT MAP",20)==0) {
+				if(HeaderLinesNecessary!=0) break;
+				tm.tm_year = getIntField(line,len,2,4)-1900;
+				tm.tm_mon  = getIntField(line,len,10,2)-1;
+				tm.tm_mday = getIntField(line,len,16,2);
+				tm.tm_hour = getIntField(line,len,22,2);
+				tm.tm_min  = getIntField(line,len,28,2);
+				tm.tm_sec  = getIntField(line,len,34,11);
+				seconds = getDoubleField(line,len,34,11);
+				IONEX->map[ind].t.MJDN = MJDN(&tm);
+				IONEX->map[ind].t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+			} else if (strncmp(&line[60],"LAT/LON1/LON2/DLON/H",20)==0) {
+				if(HeaderLinesNecessary!=0) break;
+				lat = getDoubleField(line,len,2,6);
+				lon1 = getDoubleField(line,len,8,6);
+				lon2 = getDoubleField(line,len,14,6);
+				dlon = getDoubleField(line,len,20,6);
+				h = getDoubleField(line,len,26,6);
+				if (IONEX->map[ind].hgt1==0) { IONEX->map[ind].hgt1=IONEX->map[ind].hgt2=h; } //To avoid 0 values in case HGT1=HGT2=DHGT=0 in IONEX file
+				nlon = numSteps(lon1,lon2,dlon);
+				ilon = 0;
+				readingCells = 1;
+			} else if (strncmp(&line[60],"PRN / BIAS / RMS",16)==0) {
+				getstr(ConstellationType,line,3,1);     //GNSS type letter
+				satSystem = gnsschar2gnsstype(ConstellationType[0]);
+				PRN = getIntField(line,len,4,2);
+				IONEX->ionexDCB.DCB[satSystem][PRN] = getDoubleField(line,len,6,10);
+				IONEX->ionexDCB.DCBRMS[satSystem][PRN] = getDoubleField(line,len,16,10);
+				IONEX->ionexDCB.DCBavailable = 1;
+			} else if (strncmp(&line[60],"STATION / BIAS / RMS",20)==0) {
+				IONEX->numStationData++;
+				IONEX->ionexStation = malloc(sizeof(TIonexStation)*IONEX->numStationData);
+				getstr(aux,line,6,4);
+				strcpy(IONEX->ionexStation[IONEX->numStationData -1].stationInitials,aux);
+				getstr(aux,line,11,10);
+				strcpy(IONEX->ionexStation[IONEX->numStationData -1].stationcode,aux);
+				IONEX->ionexStation[IONEX->numStationData -1].stationBias = getDoubleField(line,len,26,10);
+				IONEX->ionexStation[IONEX->numStationData -1].stationRMS = getDoubleField(line,len,36,10);
+			} else if (strncmp(&line[60],"END OF FILE",11)==0) {
 				properlyRead = 1;
-				readingHeader = 0;
-				usedRecords = 0;
+				firstTimeRead=0;
+				EndofFileFound=1;
 			}
-		} else { // !readingHeader
-			if (line[0]=='*') { // Epoch starting
-				// *  2008 08 27 00 00 00.00000000
-				getstr(aux,line,3,4);
+		} else {  // readingCells
+			if(HeaderLinesNecessary!=0) break;
+			for (i=0;i<16 && ilon<nlon;i++,ilon++) {
+				lon = ilon*dlon + lon1;
+				ionoValue = getDoubleField(line,len,i*5,5);
+				if (ionoValue==9999) { setIonoValue(&IONEX->map[ind],mapType,h,lat,lon,ionoValue);}
+				else {
+					setIonoValue(&IONEX->map[ind],mapType,h,lat,lon,ionoValue*IONEX->conversionFactor);
+				}
+			}
+			if (ilon==nlon) readingCells = 0;
+		}
+		
+	}
+
+	if (HeaderLinesNecessary!=0) properlyRead=-3;
+	return (properlyRead); 
+}
+
+/*****************************************************************************
+ * Name        : readFPPP
+ * Description : Read a FPPP file from a file descriptor
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TFPPP  *FPPP                    O  N/A  Structure to save the data
+ * double *FPPPVersion             O  N/A  FPPP file version
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Properly read
+ *                                         0 => Error
+ *****************************************************************************/
+int readFPPP (FILE *fd, TFPPPIONEX *FPPP, double *FPPPVersion) {
+	char		line[MAX_INPUT_LINE];
+	char 		aux[100];
+	int 		len = 0;
+	int			properlyRead = 0;
+	int			error = 0;
+	int			PRN;
+	struct tm	tm;
+	double		seconds;
+	int			readingHeader = 1, readingDCB = 0, lastMapNotStarted = 1;
+	int			mapType;
+	TFPPPMap	FPPPMap;
+	int			ind, mapPosition;
+	double		lt, lat, sigma, exponent, tec, mapHeight;
+	char		ConstellationType[2];
+	enum GNSSystem  satSystem;
+
+	
+	initFPPPMap(&FPPPMap);
+	ConstellationType[0] = '\0';
+
+	while(getL(line,&len,fd)!=-1) {
+		if (readingHeader) {
+			if (strncmp(&line[60],"FPPP VERSION / TYPE",19)==0) {
+				getstr(aux,line,0,9);
+				*FPPPVersion = atof(aux);
+				if (*FPPPVersion != 1.0 ) return 0;
+			} else if (strncmp(&line[60],"EPOCH OF FIRST MAP",18)==0) {
+				getstr(aux,line,2,4);
 				tm.tm_year = atoi(aux)-1900;
-				getstr(aux,line,8,2);
+				getstr(aux,line,10,2);
 				tm.tm_mon  = atoi(aux)-1;
-				getstr(aux,line,11,2);
+				getstr(aux,line,16,2);
 				tm.tm_mday = atoi(aux);
-				getstr(aux,line,14,2);
+				getstr(aux,line,22,2);
 				tm.tm_hour = atoi(aux);
-				getstr(aux,line,17,2);
+				getstr(aux,line,28,2);
 				tm.tm_min  = atoi(aux);
-				getstr(aux,line,20,11);
+				getstr(aux,line,34,11);
 				tm.tm_sec  = atoi(aux);
 				seconds = atof(aux);
-				t.MJDN = MJDN(&tm);
-				t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-				//Compute interval (do not trust header)
-				if (products->SP3->orbits.interval == 0. && lastT.MJDN!=0) { // If interval is still not known (and it is not the first epoch)
-					interval = tdiff(&t,&lastT);
-					if (interval>=1.) {
-						//Take out decimals if interval is greater than 1
-						if (readOrbits) products->SP3->orbits.interval = (double)((int)(interval));
-						if (readClocks) products->SP3->clocks.interval = (double)((int)(interval));
-					} else {
-						if (readOrbits) products->SP3->orbits.interval = interval;
-						if (readClocks) products->SP3->clocks.interval = interval;
-					}
+				FPPP->startTime.MJDN = MJDN(&tm);
+				FPPP->startTime.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+			} else if (strncmp(&line[60],"INTERVAL",8)==0) {
+				getstr(aux,line,0,6);
+				FPPP->interval = atoi(aux);
+			} else if (strncmp(&line[60],"BASE RADIUS",11)==0) {
+				getstr(aux,line,0,8);
+				FPPP->baseRadius = atof(aux);
+			} else if (strncmp(&line[60],"HGT1 / HGT2",11)==0) {
+				getstr(aux,line,0,8);			// HGT1
+				FPPPMap.hgt1 = atof(aux);
+				getstr(aux,line,8,8);			// HGT2
+				FPPPMap.hgt2 = atof(aux);
+				FPPPMap.dhgt = FPPPMap.hgt2 - FPPPMap.hgt1;
+		/*	} else if (strncmp(&line[60],"LAT1 / LAT2 / DLAT",18)==0) {
+				getstr(aux,line,2,6);			// LAT1
+				ionoMap.lat1 = atof(aux);
+				getstr(aux,line,8,6);			// LAT2
+				ionoMap.lat2 = atof(aux);
+				getstr(aux,line,14,6);			// DLAT
+				ionoMap.dlat = atof(aux);
+				ionoMap.nlat = numSteps(ionoMap.lat1,ionoMap.lat2,ionoMap.dlat);*/
+			} else if (strncmp(&line[60],"DLT / DLAT",10)==0) {
+				getstr(aux,line,0,8);			// DLT
+				FPPPMap.dlt = atof(aux);
+				FPPPMap.lt2 = FPPPMap.lt2 - FPPPMap.dlt;
+				getstr(aux,line,8,8);			// DLAT
+				FPPPMap.dlat = atof(aux);
+			} else if (strncmp(&line[60],"MIN/MAX  LAT",12)==0) {
+				getstr(aux,line,0,8);                   // LAT1
+								FPPPMap.lat1 = atof(aux);
+				getstr(aux,line,8,8);			// LAT2
+				FPPPMap.lat2 = atof(aux);
+				FPPPMap.nlt = numSteps(FPPPMap.lt1,FPPPMap.lt2,FPPPMap.dlt);
+				FPPPMap.nlat = numSteps(FPPPMap.lat1,FPPPMap.lat2,FPPPMap.dlat);
+			} else if (strncmp(&line[60],"END OF HEADER",13)==0) {
+				readingHeader = 0;
+			}
+		
+		} else {
+			if (strncmp(&line[60],"START OF TEC MAP",16)==0 && strlen(line)>60) {
+				getstr(aux,line,0,7);
+				ind = atoi(aux) -1;
+				//Reserve memory for new map, copy variables and initialize all points to 9999
+				FPPP->map = (TFPPPMap*) (realloc(FPPP->map,sizeof(TFPPPMap)*(ind+1)));
+				memcpy(&FPPP->map[ind],&FPPPMap,sizeof(TFPPPMap));
+				FPPP->map[ind].TEC = malloc(sizeof(double)*getFPPPMapTotalSize(&FPPP->map[ind]));
+				FPPP->map[ind].SIGMA = malloc(sizeof(double)*getFPPPMapTotalSize(&FPPP->map[ind]));
+				initFPPPMapData(&FPPP->map[ind]);
 
-				}
-				memcpy(&lastT,&t,sizeof(TTime));
-				for (i=0;i<products->SP3->orbits.numSatellites;i++) {
-					if(readOrbits) {
-						products->SP3->orbits.block[i] = realloc(products->SP3->orbits.block[i],sizeof(TSP3orbitblock)*(usedRecords+1));
-						initSP3orbitblock(&products->SP3->orbits.block[i][usedRecords]);
-						memcpy(&products->SP3->orbits.block[i][usedRecords].t,&t,sizeof(TTime));
-					}
-					if (readClocks) {
-						products->SP3->clocks.block[i] = realloc(products->SP3->clocks.block[i],sizeof(TSP3clockblock)*(usedRecords+1));
-						initSP3clockblock(&products->SP3->clocks.block[i][usedRecords]);
-						memcpy(&products->SP3->clocks.block[i][usedRecords].t,&t,sizeof(TTime));
-					}
-				}
-				usedRecords++;
-				if (usedRecords==1) {
-					//Copy first epoch read as start time, do not trust header
-					if(readOrbits) memcpy(&products->SP3->orbits.startTime,&t,sizeof(TTime));
-					if(readClocks) memcpy(&products->SP3->clocks.startTime,&t,sizeof(TTime));
-				}
-			} else if (line[0]=='P') { // Position record
-				CurrentInd=usedRecords-1;
-				if(readingRefFile==1) {
-					//Reference position is saved in position [0][0]
-					system=0;
-					PRN=0;
-					ind=0;
-				} else {
-					system = gnsschar2gnsstype(line[1]);
-					getstr(aux,line,2,2);
-					PRN = atoi(aux);
-					if (readOrbits) ind = products->SP3->orbits.index[system][PRN];
-					else ind = products->SP3->clocks.index[system][PRN];
-				}
-				if (readOrbits) {
-					if (CurrentInd==0) {
-						//Check if sigmas per epoch are provided
-						getstr(aux,line,46,14);
-						products->SP3->orbits.hasSigmaPerEpoch=0;
-						if (atof(aux)!=INVALID_CLOCK) {
-							if (strncmp(&line[61],"  ",2)!=0) {
-								products->SP3->orbits.hasSigmaPerEpoch=1;
-							}
-						}
-					}
-					getstr(aux,line,4,14);
-					products->SP3->orbits.block[ind][CurrentInd].x[0] = atof(aux)*1e3;
-					getstr(aux,line,18,14);
-					products->SP3->orbits.block[ind][CurrentInd].x[1] = atof(aux)*1e3;
-					getstr(aux,line,32,14);
-					products->SP3->orbits.block[ind][CurrentInd].x[2] = atof(aux)*1e3;
-					memcpy(&products->SP3->orbits.block[ind][usedRecords-1].t,&t,sizeof(TTime));
+								//Prepare for reading DCB (if there are any available)
+								readingDCB = 1;
 
-					getstr(aux,line,46,14);
-					if (products->SP3->orbits.hasSigmaPerEpoch==1) {
-						getstr(aux,line,46,14);
-						if (atof(aux)!=INVALID_CLOCK) {
-							getstr(aux,line,61,2);
-							products->SP3->orbits.block[ind][CurrentInd].xsigma[0] = pow(BaseSigmaOrbit,atof(aux))*1e-3;
-							getstr(aux,line,64,2);
-							products->SP3->orbits.block[ind][CurrentInd].xsigma[1] = pow(BaseSigmaOrbit,atof(aux))*1e-3;
-							getstr(aux,line,67,2);
-							products->SP3->orbits.block[ind][CurrentInd].xsigma[2] = pow(BaseSigmaOrbit,atof(aux))*1e-3;
-						} else {
-							//When an invalid clock is given, also sigmas are not provided. Use the default ones
-							products->SP3->orbits.block[ind][CurrentInd].xsigma[0]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
-							products->SP3->orbits.block[ind][CurrentInd].xsigma[1]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
-							products->SP3->orbits.block[ind][CurrentInd].xsigma[2]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
-						}
-					} else {
-						//No sigmas per epochs. use the default ones
-						products->SP3->orbits.block[ind][CurrentInd].xsigma[0]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
-						products->SP3->orbits.block[ind][CurrentInd].xsigma[1]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
-						products->SP3->orbits.block[ind][CurrentInd].xsigma[2]=pow(BaseSigmaOrbit,products->SP3->orbits.accuracy[ind])*1e-3;
-					}
+				//Check if really this last map has data (due to FPPP is real time generated, it includes the Header but not the data)
+				lastMapNotStarted=1;
+			} else if (strncmp(&line[60],"EPOCH OF CURRENT MAP",20)==0 && strlen(line)>60) {
+				getstr(aux,line,2,4);		// Year
+				tm.tm_year = atoi(aux)-1900;
+				getstr(aux,line,10,2);		// Month
+				tm.tm_mon  = atoi(aux)-1;
+				getstr(aux,line,16,2);		// Day
+				tm.tm_mday = atoi(aux);
+				getstr(aux,line,22,2);		// Hour
+				tm.tm_hour = atoi(aux);
+				getstr(aux,line,28,2);		// Minute
+				tm.tm_min  = atoi(aux);
+				getstr(aux,line,34,2);		// Second
+				tm.tm_sec  = atoi(aux);
+				seconds = atof(aux);
+				FPPP->map[ind].t.MJDN = MJDN(&tm);
+				FPPP->map[ind].t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+								//DCB data ended
+								readingDCB = 0;
+			} else if (readingDCB){
+								getstr(ConstellationType,line,0,1);     //GNSS type letter
+								satSystem = gnsschar2gnsstype(ConstellationType[0]);
+				getstr(aux,line,1,2); // PRN 
+				PRN = atoi(aux);	
+				getstr(aux,line,4,9); // frac1 	
+				FPPP->fpppDCB.frac1[satSystem][PRN] = atof(aux);
+				getstr(aux,line,14,9); // frac2
+				FPPP->fpppDCB.fracw[satSystem][PRN] = atof(aux);
+				getstr(aux,line,24,9); // IFB
+				FPPP->fpppDCB.IFB[satSystem][PRN] = atof(aux);
+				FPPP->fpppDCB.DCBavailable = 1;
+		/*	} else if (strncmp(&line[60],"LAT/LON1/LON2/DLON/H",20)==0) {
+				getstr(aux,line,2,6);
+				lat = atof(aux);
+				getstr(aux,line,8,6);
+				lon1 = atof(aux);
+				getstr(aux,line,14,6);
+				lon2 = atof(aux);
+				getstr(aux,line,20,6);
+				dlon = atof(aux);
+				getstr(aux,line,26,6);
+				h = atof(aux);
+				if (FPPP->map[ind].hgt1==0) { FPPP->map[ind].hgt1=FPPP->map[ind].hgt2=h; } //To avoid 0 values in case HGT1=HGT2=DHGT=0 in IONEX file
+				nlon = numSteps(lon1,lon2,dlon);
+				ilon = 0;
+				readingCells = 1;
+		*/
+		/*	} else if (strncmp(&line[60],"END OF FILE",11)==0) {
+								properlyRead = 1;
+		*/	
+			}else {  // readingCells
 
-					//Read orbit flags
-					if(strlen(line)>=80 && strncmp(&line[78],"  ",2)!=0) {
-						strncpy(products->SP3->orbits.block[ind][CurrentInd].orbitflags,&line[78],2);
-						products->SP3->orbits.block[ind][CurrentInd].orbitflags[2]='\0';
-					} else {
-						products->SP3->orbits.block[ind][CurrentInd].orbitflags[0]='\0';
-					}
-				}
-				if (readClocks) {
-					getstr(aux,line,46,14);
-					if (CurrentInd==0) {
-						//Check if sigmas per epoch are provided
-						products->SP3->clocks.hasSigmaPerEpoch=0;
-						if (atof(aux)!=INVALID_CLOCK) {
-							if (strncmp(&line[70],"  ",2)!=0) {
-								products->SP3->clocks.hasSigmaPerEpoch=1;
-							}
-						}
-					}
-					if (atof(aux)==INVALID_CLOCK) {
-						products->SP3->clocks.block[ind][CurrentInd].clock = INVALID_CLOCK;
-						//clocksigma is initialized by default to 0
-					} else {
-						products->SP3->clocks.block[ind][CurrentInd].clock = atof(aux)*(c0/1e6);
-						if (products->SP3->clocks.hasSigmaPerEpoch==1) {
-							getstr(aux,line,70,3);
-							products->SP3->clocks.block[ind][CurrentInd].clocksigma=pow(BaseSigmaClock,atof(aux))*1e-12*c0;
-						}
-					}
-					memcpy(&products->SP3->clocks.block[ind][CurrentInd].t,&t,sizeof(TTime));
+				getstr(aux,line,0,6); // LT
+				lt = modulo(atof(aux)+360,360);
+				getstr(aux,line,6,6); // LAT
+				lat = atof(aux);
+				getstr(aux,line,12,9); // PARTIAL TEC
+				tec = atof(aux);
+				getstr(aux,line,21,5); // SIGMA
+				sigma = atof(aux);
+				getstr(aux,line,27,3); // SIGMA EXPONENT
+				exponent = atof(aux);
+				sigma = sigma * E(exponent);
+				getstr(aux,line,30,3); // MAP POSITION
+				mapPosition = atoi(aux) -1;
+			
 
-					//Read clock flags
-					if(strlen(line)>=76 && strncmp(&line[74],"  ",2)!=0) {
-						strncpy(products->SP3->clocks.block[ind][CurrentInd].clockflags,&line[74],2);
-						products->SP3->clocks.block[ind][CurrentInd].clockflags[2]='\0';
-					} else {
-						products->SP3->clocks.block[ind][CurrentInd].clockflags[0]='\0';
-					}
-				}
-				
-			} else if (line[0]=='V') { // Velocity record
-				CurrentInd=usedRecords-1;
-				if(readingRefFile==1) {
-					//Reference position is saved in position [0][0]
-					system=0;
-					PRN=0;
-					ind=0;
-				} else {					
-					system = gnsschar2gnsstype(line[1]);
-					getstr(aux,line,2,2);
-					PRN = atoi(aux);
-					if (readOrbits) ind = products->SP3->orbits.index[system][PRN];
-					else ind = products->SP3->clocks.index[system][PRN];
-				}
-				if (readOrbits) {
-					getstr(aux,line,4,14);
-					products->SP3->orbits.block[ind][CurrentInd].v[0] = atof(aux)*1e-1;
-					getstr(aux,line,18,14);
-					products->SP3->orbits.block[ind][CurrentInd].v[1] = atof(aux)*1e-1;
-					getstr(aux,line,32,14);
-					products->SP3->orbits.block[ind][CurrentInd].v[2] = atof(aux)*1e-1;
-					memcpy(&products->SP3->orbits.block[ind][CurrentInd].t,&t,sizeof(TTime));
-				}
-				if (readClocks) {
-					getstr(aux,line,46,14);
-					products->SP3->clocks.block[ind][CurrentInd].clockrate = atof(aux)*(c0/1e7);
-					memcpy(&products->SP3->clocks.block[ind][CurrentInd].t,&t,sizeof(TTime));
-				}
-			} else if (strncmp(line,"EOF",3)==0) { // End of File
-				if (readOrbits) {
-					products->SP3->orbits.numRecords = usedRecords;
-					memcpy(&products->SP3->orbits.endTime,&t,sizeof(TTime));
-				}
-				if (readClocks) {
-					products->SP3->clocks.numRecords = usedRecords;
-					memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
-				}
-				if(usedRecords!=HeaderNumRecords) {
-					//Header had incorrect number of entries
-					sprintf(messagestr,"WARNING Number of entries in header (%d) does not match with number of entries read (%d)",HeaderNumRecords,usedRecords);
-					printInfo(messagestr,options);
-				}
-				for (k=0;k<5;k++) {
-					if (getL(line,&len,fd)==-1) {
-						return 1;
-					}
-				}
-				for (k=0;k<5;k++) getLback(line,&len,fd);
-				return 2;
-			} else if (line[0]=='#') {
-				printInfo("WARNING SP3 file has no 'EOF' line at the end. SP3 file may be incomplete",options);
-				if(usedRecords!=HeaderNumRecords) {
-					//Header had incorrect number of entries
-					sprintf(messagestr,"WARNING Number of entries in header (%d) does not match with number of entries read (%d)",HeaderNumRecords,usedRecords);
-					printInfo(messagestr,options);
-				}
-				//Concatenated file
-				if (readOrbits) {
-					products->SP3->orbits.numRecords = usedRecords;
-					memcpy(&products->SP3->orbits.endTime,&t,sizeof(TTime));
-				}
-				if (readClocks) {
-					products->SP3->clocks.numRecords = usedRecords;
-					memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
-				}
-				getLback(line,&len,fd);
-				return 2;
-			} else { // Record unidentified
-				error = 1;
+				mapHeight = FPPP->map[ind].hgt1 + mapPosition*FPPP->map[ind].dhgt;
+				//Set TEC value for current map
+				mapType = 0;	
+				setFPPPValue(&FPPP->map[ind],mapType,mapHeight,lat,lt,tec);
+				//Set SIGMA values for current map
+				mapType = 1;
+								setFPPPValue(&FPPP->map[ind],mapType,mapHeight,lat,lt,sigma);
+			
+				properlyRead = 1;
+				lastMapNotStarted = 0;
 			}
-		} //End if (readingHeader) 
-	}
-	//End of file but no EOF found
-	printInfo("WARNING SP3 file has no 'EOF' line at the end. SP3 file may be incomplete",options);
-	if(usedRecords!=HeaderNumRecords) {
-		//Header had incorrect number of entries
-		sprintf(messagestr,"WARNING Number of entries in header (%d) does not match with number of entries read (%d)",HeaderNumRecords,usedRecords);
-		printInfo(messagestr,options);
-	}
-	if (readOrbits) {
-		products->SP3->orbits.numRecords = usedRecords;
-		memcpy(&products->SP3->orbits.endTime,&t,sizeof(TTime));
-	}
-	if (readClocks) {
-		products->SP3->clocks.numRecords = usedRecords;
-		memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
-	}
-	
+		}
+		
+	} //end While
+
+	if (lastMapNotStarted) {ind--;} //Take into consideration the case in which the Header is given but not the data (due to the file is real time generated)
+	FPPP->numMaps = ind +1;
+	FPPP->endTime.MJDN = FPPP->map[ind].t.MJDN;
+	FPPP->endTime.SoD = FPPP->map[ind].t.SoD;
 	return (properlyRead && !error); // properly read AND no error
 }
 
 /*****************************************************************************
- * Name        : readSP3LastEpoch
- * Description : Read last epoch from SP3 file. This function is called when the
-                  SP3 files is concatenated more than 3 days
+ * Name        : readFPPPFile
+ * Description : Read a IONEX FPPP file from a filename
  * Parameters  :
  * Name                           |Da|Unit|Description
- * FILE  *fd                       I  N/A  File descriptor
- * TTime *lastEpoch                O  N/A  Last Epoch in SP3 file
+ * char  *filename                 I  N/A  Name of the file
+ * TFPPP  *FPPP                    O  N/A  Structure to save the data
+ * double *FPPPVersion             O  N/A  FPPP file version
  * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Last Epoch read
- *                                         0 => Error
+ *                                         1  => File open and properly read
+ *                                         0  => File open and failed to read
+ *                                         -1 => File not open
  *****************************************************************************/
-int readSP3LastEpoch (FILE *fd, TTime *lastEpoch) {
-
-	struct stat 			filestat;	//This is to get the file size
-	off_t					filesize;
-	struct tm   			tm;
-	long					CurrentPos;
-	int						len = 0;
-	double					seconds;
-	char		    		aux[100];
-	char					line[MAX_INPUT_LINE];
-
-
-	CurrentPos = ftell(fd);
-	//We need to go to the end of the file.
-	//NOTE that fseek(fd, 0L, SEEK_END); does not work as we have opened the file in binary mode!!!
-	fstat(fileno(fd), &filestat);
-	filesize = filestat.st_size;
-	fseek(fd,filesize,SEEK_SET);
-
-	while(1) {
-		if (getLback(line,&len,fd)==-1) {
-			fseek(fd,CurrentPos,SEEK_SET);
-			return 0;
-		}
-		if (line[0]=='*') { // Epoch starting
-			// *  2008 08 27 00 00 00.00000000
-			getstr(aux,line,3,4);
-			tm.tm_year = atoi(aux)-1900;
-			getstr(aux,line,8,2);
-			tm.tm_mon  = atoi(aux)-1;
-			getstr(aux,line,11,2);
-			tm.tm_mday = atoi(aux);
-			getstr(aux,line,14,2);
-			tm.tm_hour = atoi(aux);
-			getstr(aux,line,17,2);
-			tm.tm_min  = atoi(aux);
-			getstr(aux,line,20,11);
-			tm.tm_sec  = atoi(aux);
-			seconds = atof(aux);
-			lastEpoch->MJDN = MJDN(&tm);
-			lastEpoch->SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-			fseek(fd,CurrentPos,SEEK_SET);
-			return 1;
-		}
+int readFPPPFile (char *filename, TFPPPIONEX *FPPP, double *FPPPVersion) {
+	FILE	*fd;
+	int		ret;
+	
+	if (whatFileTypeIs(filename)!=ftFPPP) return 0;
+	if ((fd = openInputFile(filename))) {
+		ret = readFPPP (fd, FPPP, FPPPVersion);
+		fclose(fd);
+		return ret;
+	} else {
+		// File do not exist
+		return -1;
 	}
-	return 0;
 }
 
+
 /*****************************************************************************
- * Name        : readRinexClocks
- * Description : Read a RINEX Clocks file from a file descriptor
+ * Name        : readConstellation
+ * Description : Read a constellation status file from a file descriptor
+ *               File available at: 
+ *                 http://gge.unb.ca/Resources/GPSConstellationStatus.txt
+ *	             File compiled and maintaned by Richard B. Langley, Dept. of 
+ *               Geodesy and Geomatics Engineering, University of New Brunswick.
  * Parameters  :
  * Name                           |Da|Unit|Description
- * FILE  *fd                       I  N/A  File descriptor
- * TGNSSproducts  *products        O  N/A  Structure to save the data
- * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Properly read
- *                                         2 => Another file concatenated
- *                                         0 => Error
- *****************************************************************************/
-int readRinexClocks (FILE *fd, TGNSSproducts *products) {
-	char 			line[MAX_INPUT_LINE];
-	char	 	   	aux[100];
-	char	 	   	aux2[100];
-	char	 	   	aux3[100];
-	int 			len = 0;
-	//double			rinexVersion;
-	int				properlyRead = 0;
-	int				error = 0;
-	int				readingHeader = 1;
-	enum GNSSystem	system;
-	int				PRN;
-	struct tm		tm;
-	int				i,j;
-	int				ind;
-	double			seconds;
-	double			interval;
-	TTime			t, lastT;
-	int				readedSatellites;
-	const int		ini_vsize = 64;
-	int 			found_prn_list = 0;
-	
-	lastT.MJDN = 0;
-	lastT.SoD = 0;
+ * FILE  *fd                       I  N/A  File descriptor
+ * TConstellation  *constellation  O  N/A  Structure to save the data
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Properly read
+ *                                         0 => Error
+ *****************************************************************************/
+int readConstellation (FILE *fd, TConstellation *constellation) {
+	char 					line[MAX_INPUT_LINE];
+	char    				aux[100];
+	int 					len = 0;
+	int						properlyRead = 0;
+	int						error = 0;
+	struct tm				tm;
+	int						readingInfo = 0;
+	TConstellationElement	sat;
+	int						i;
 	
-	while(getL(line,&len,fd)!=-1) {
-		if (!readingHeader) {
-			if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
-				//Save last epoch
-				memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
-				getLback(line,&len,fd);
+	tm.tm_hour = 0;
+	tm.tm_min = 0;
+	tm.tm_sec = 0;
 
-				// If the time stamp of a satellite block of the last epoch has not the right value, 
-				// then there has been no data for that satellite, so the satellite block time stamp has to be fixed 
-				for (i=0;i<products->SP3->clocks.numSatellites;i++) {
-					if (tdiff(&t,&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t)!=0) {
-						memcpy(&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t,&t,sizeof(TTime));
-					}
-				}
-				return 2;
+	while(getL(line,&len,fd)!=-1) {
+		if (line[strlen(line)-1]==13) line[strlen(line)-1] = '\n';
+		getstr(aux,line,0,5);
+		if (strcmp(aux,"Block")==0) {
+			// Initialize
+			initConstellationElement(&sat);
+			sat.GNSS = GPS;		// Only prepared for GPS right now
+						
+			getstr(aux,line,6,10);
+			if (strcmp(aux,"I")==0) {
+				sat.block = GPS_BLOCK_I;
+			} else if (strcmp(aux,"II")==0) {
+				sat.block = GPS_BLOCK_II;
+			} else if (strcmp(aux,"IIA")==0) {
+				sat.block = GPS_BLOCK_IIA;
+			} else if (strcmp(aux,"IIR")==0) {
+				sat.block = GPS_BLOCK_IIR;
+			} else if (strcmp(aux,"IIR-M")==0) {
+				sat.block = GPS_BLOCK_IIRM;
+			} else {
+				sat.block = UNKNOWN_BLOCK;
 			}
-		}
-		if (readingHeader) {
-			if (strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) {
-				getstr(aux,line,0,9);
-				//rinexVersion = atof(aux); //Commented to avoid not used variable warning
-			} else if (strncmp(&line[60],"# OF SOLN SATS",14)==0) {
-				getstr(aux,line,4,2);
-				products->SP3->clocks.numSatellites = products->SP3->clocks.numSatellitesRead = atoi(aux);
-				// Reserve memory for satellites
-				products->SP3->clocks.block = malloc(sizeof(TSP3clockblock*)*products->SP3->clocks.numSatellites);
-				// RINEX clock standard does not provide any apriori information on the number of records that will 
-				// appear on the file. A dynamic readjustment becomes necessary to overcome this issue.
-				products->SP3->clocks.vsizeblock = ini_vsize;
-				// Reserve initial memory for blocks
-				for (i=0;i<products->SP3->clocks.numSatellites;i++) {
-					products->SP3->clocks.block[i] = malloc(sizeof(TSP3clockblock)*products->SP3->clocks.vsizeblock);
-					for (j=0;j<products->SP3->clocks.vsizeblock;j++) 
-						initSP3clockblock(&products->SP3->clocks.block[i][j]);
+			if (sat.block == GPS_BLOCK_II || sat.block == GPS_BLOCK_IIA) {
+				for (i=0;i<MAX_FREQUENCIES_PER_GNSS;i++) {
+					sat.PCO[i][0] = 0.279;
+					sat.PCO[i][1] = 0;
+					sat.PCO[i][2] = 1.023;
 				}
-				readedSatellites = 0;
-			} else if (strncmp(&line[60],"PRN LIST",8)==0) {
-				found_prn_list = 1;
-				for (i=0;i<15 && readedSatellites<products->SP3->clocks.numSatellites;i++,readedSatellites++) {
-					system = gnsschar2gnsstype(line[4*i]);
-					getstr(aux,line,1+4*i,2);
-					products->SP3->clocks.index[system][atoi(aux)] = readedSatellites;
+			} else if (sat.block == GPS_BLOCK_I)  {
+				for (i=0;i<MAX_FREQUENCIES_PER_GNSS;i++) {
+					sat.PCO[i][0] = 0.21;
+					sat.PCO[i][1] = 0;
+					sat.PCO[i][2] = 0.854;
 				}
-			} else if (strncmp(&line[60],"END OF HEADER",13)==0) {
-				readingHeader = 0;
-				properlyRead = 1;
-				products->SP3->clocks.numRecords = 0;
-				// The standard forces that the field 'PRN LIST' is present in the header, so the next section would
-				// never be executed...
-				if (!found_prn_list) {
-					readedSatellites = 0;
-					for (i=0;i<MAX_GNSS;i++) {
-						for (j=0;j<MAX_SATELLITES_PER_GNSS;j++) {
-							products->SP3->clocks.index[i][j] = readedSatellites;
-							readedSatellites++;
-						}
-					}
-					products->SP3->clocks.numSatellites = readedSatellites;
-					// Reserve memory for satellites
-					products->SP3->clocks.block = malloc(sizeof(TSP3clockblock*)*products->SP3->clocks.numSatellites);
-					products->SP3->clocks.vsizeblock = ini_vsize;
-					for (i=0;i<products->SP3->clocks.numSatellites;i++) {
-						products->SP3->clocks.block[i] = malloc(sizeof(TSP3clockblock)*products->SP3->clocks.vsizeblock);
-						for (j=0;j<products->SP3->clocks.vsizeblock;j++) 
-							initSP3clockblock(&products->SP3->clocks.block[i][j]);
-					}
+			} else {
+				for (i=0;i<MAX_FREQUENCIES_PER_GNSS;i++) {
+					sat.PCO[i][0] = sat.PCO[i][1] = sat.PCO[i][2] = 0;
 				}
 			}
-		} else { // !readingHeader
-			getstr(aux,line,3,4);
-			getstr(aux2,line,0,2);
-			getstr(aux3,line,4,2);
-			PRN = atoi(aux3);
-			if ( (aux[0]=='G' || aux[0]=='R' || aux[0]=='E' || aux[0]=='S' || aux[0]=='C' || aux[0]=='J' || aux[0]=='I' ) && PRN>0 && strncmp(aux2,"AS",2)==0 )  {
-				// AS G02  2008 10 10 00 00  0.000000  2    1.813604156067e-04  3.113411106060e-11
-				system = gnsschar2gnsstype(aux[0]);
-				ind = products->SP3->clocks.index[system][PRN];
-
-				getstr(aux,line,8,4);
-				tm.tm_year = atoi(aux)-1900;
-				getstr(aux,line,13,2);
-				tm.tm_mon  = atoi(aux)-1;
-				getstr(aux,line,16,2);
-				tm.tm_mday = atoi(aux);
-				getstr(aux,line,19,2);
-				tm.tm_hour = atoi(aux);
-				getstr(aux,line,22,2);
-				tm.tm_min  = atoi(aux);
-				getstr(aux,line,25,9);
-				tm.tm_sec  = atoi(aux);
-				seconds = atof(aux);
-				t.MJDN = MJDN(&tm);
-				t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-				
-				if (lastT.MJDN != t.MJDN || lastT.SoD != t.SoD) { // New Epoch
-					if (products->SP3->clocks.interval == 0. && lastT.MJDN!=0) { // If interval is still not known (and it is not the first epoch)
-						interval = tdiff(&t,&lastT);
-						if (interval>=1.) {
-							//Take out decimals if interval is greater than 1
-							products->SP3->clocks.interval = (double)((int)(interval));
-						} else {
-							products->SP3->clocks.interval = interval;
-						}
-					}
-
-					// Added check: If in one epoch there is no data for a given satellite, it will have an invalid clock value but it will not
-					// have the correct time stamp, which will be a problem when interpolating clocks
-					if ( lastT.MJDN != 0 ) { //It is not the first epoch
-						for (i=0;i<products->SP3->clocks.numSatellites;i++) {
-							// If the time stamp of a satellite block of the previous epoch has not the right value, 
-								// then there has been no data for that satellite, so the satellite block time stamp has to be fixed 
-							if (tdiff(&lastT,&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t)!=0) {
-								memcpy(&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t,&lastT,sizeof(TTime));
-							}
-						}
-					} else {
-						//First epoch. Save start time
-						memcpy(&products->SP3->clocks.startTime,&t,sizeof(TTime));
-					}
-
-					memcpy(&lastT,&t,sizeof(TTime));
-					products->SP3->clocks.numRecords++;
-					if (products->SP3->clocks.numRecords == products->SP3->clocks.vsizeblock) {
-						products->SP3->clocks.vsizeblock *= 2;
-						// Reserve memory for blocks
-						for (i=0;i<products->SP3->clocks.numSatellites;i++) {
-							products->SP3->clocks.block[i] = realloc(products->SP3->clocks.block[i],sizeof(TSP3clockblock)*products->SP3->clocks.vsizeblock);
-							for (j=products->SP3->clocks.vsizeblock/2;j<products->SP3->clocks.vsizeblock;j++)  {
-								initSP3clockblock(&products->SP3->clocks.block[i][j]);
-							}
-						}
+			properlyRead = 1;
+			readingInfo = 1;
+		} else {
+			if (readingInfo) {
+				if (strcmp(aux,"Notes")==0) {
+					readingInfo = 0;
+				} else { // Satellite Data
+					getstr(aux,line,7,3);
+					sat.SVN = atoi(aux);
+					getstr(aux,line,57,14);
+					if (sat.SVN!=0 && strcmp(aux,"Launch failure")!=0) { // Valid line
+						getstr(aux,line,11,2);
+						sat.PRN = atoi(aux);
+						
+						getstr(aux,line,41,2);
+						tm.tm_year = atoi(aux);
+						if (tm.tm_year < 70) tm.tm_year+=100;
+						getstr(aux,line,44,2);
+						tm.tm_mon = atoi(aux)-1;
+						getstr(aux,line,47,2);
+						tm.tm_mday = atoi(aux);
+						sat.tLaunch.MJDN = MJDN(&tm);
+						sat.tLaunch.SoD = 0;
+						
+						if (line[68]==':') { // Satellite not decomissioned
+							tm.tm_year = 130;
+							tm.tm_mon = 0;
+							tm.tm_mday = 1;
+						} else { // Satellite decomissioned
+							getstr(aux,line,70,2);
+							tm.tm_year = atoi(aux);
+							if (tm.tm_year < 70) tm.tm_year+=100;
+							getstr(aux,line,73,2);
+							tm.tm_mon = atoi(aux)-1;
+							getstr(aux,line,76,2);
+							tm.tm_mday = atoi(aux);
+						} 
+						sat.tDecommissioned.MJDN = MJDN(&tm);
+						sat.tDecommissioned.SoD = 0;
+						
+						// Allocate memory
+						constellation->numSatellites ++;
+						constellation->sat = realloc(constellation->sat,sizeof(TConstellationElement)*constellation->numSatellites);
+						
+						// Store satellite
+						memcpy(&constellation->sat[constellation->numSatellites-1],&sat,sizeof(TConstellationElement));
 					}
 				}
-			
-				getstr(aux,line,37,22);
-				products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clock = atof(aux)*c0;
-				products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockrate = 0.0;
-				products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockdriftrate = 0.0;
-
-				//Read clock flags if available (NOTE: This is not in RINEX standard, but appear in MGEX clock files
-				if(len>=83) {
-				   if (	strncmp(&line[81],"  ",2)!=0) {
-						strncpy(products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockflags,&line[81],2);
-						products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockflags[2]='\0';
-				   }
-				} else {
-					products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].clockflags[0]='\0';
-				}
-			
-				//getstr(aux,line,59,22);
-			
-				memcpy(&products->SP3->clocks.block[ind][products->SP3->clocks.numRecords-1].t,&t,sizeof(TTime));
 			}
 		}
 	}
 
-	for (i=0;i<products->SP3->clocks.numSatellites;i++) {
-		// If the time stamp of a satellite block of the last epoch has not the right value, 
-		// then there has been no data for that satellite, so the satellite block time stamp has to be fixed 
-		if (tdiff(&t,&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t)!=0) {
-			memcpy(&products->SP3->clocks.block[i][products->SP3->clocks.numRecords-1].t,&t,sizeof(TTime));
-		}
-	}
-	//Save last epoch
-	memcpy(&products->SP3->clocks.endTime,&t,sizeof(TTime));
-
 	return (properlyRead && !error); // properly read AND no error
 }
 
 /*****************************************************************************
- * Name        : readRinexClocksFile
- * Description : Read a RINEX Clocks file from a filename
+ * Name        : readConstellationFile
+ * Description : Read a constellation status file from a filename
+ *               File available at:
+ *                 http://www2.unb.ca/gge/Resources/GPSConstellationStatus.txt
+ *	             File compiled and maintaned by Richard B. Langley, Dept. of 
+ *               Geodesy and Geomatics Engineering, University of New Brunswick.
  * Parameters  :
  * Name                           |Da|Unit|Description
  * char  *filename                 I  N/A  Name of the file
- * TGNSSproducts  *products        O  N/A  Structure to save the data
+ * TConstellation  *constellation  O  N/A  Structure to save the data
  * Returned value (int)            O  N/A  Status of the function
  *                                         1  => File open and properly read
  *                                         0  => File open and failed to read
  *                                         -1 => File not open
  *****************************************************************************/
-int readRinexClocksFile (char *filename, TGNSSproducts *products) {
+int readConstellationFile (char *filename, TConstellation *constellation) {
 	FILE	*fd;
 	int		ret;
 	
-	if (whatFileTypeIs(filename)!=ftRINEXclocks) return 0;
+	if (whatFileTypeIs(filename)!=ftConstellation) return 0;
 	
-	if ((fd = fopen(filename,"rb"))) {
-		ret = readRinexClocks (fd, products);
+	if ((fd = openInputFile(filename))) {
+		ret = readConstellation (fd, constellation);
 		fclose(fd);
 		return ret;
 	} else {
@@ -4808,566 +8022,465 @@ int readRinexClocksFile (char *filename, TGNSSproducts *products) {
 }
 
 /*****************************************************************************
- * Name        : readGalileoTroposphericData
- * Description : Read tropospheric data files extracted from ESA's Matlab
- *	             tropospheric model (version 2.5, 07/09/2007). These data files
- *               are created exporting to text files the content of the
- *	             variables created when loading 'meteo_esa' library
- *	             (for data exporting, the following Octave's command must be used: 
- *                'save data_<Variable Name>.txt <Variable Name>')
- *	             These files were first exported with Octave v3.2.3
- * Parameters  :
- * Name                           |Da|Unit|Description
- * TTROPOGal *TropoGal             O  N/A  Structure to save the data
- * char *filename                  O  N/A  File name (only in case of failure)
- * TOptions  *options              I  N/A  TOptions structure
- * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Properly read
- *                                         0 => Error
- *****************************************************************************/
-int readGalileoTroposphericData (TTROPOGal *TropoGal, char *filename, TOptions *options) {
-
-	return 0;
-}
-
-/*****************************************************************************
- * Name        : readIONEX
- * Description : Read a IONEX file from a file descriptor
+ * Name        : readAntex
+ * Description : Read an ANTEX file from a file descriptor
  * Parameters  :
  * Name                           |Da|Unit|Description
  * FILE  *fd                       I  N/A  File descriptor
- * TIONEX  *IONEX                  O  N/A  Structure to save the data
- * double *ionexVersion            O  N/A  IONEX file version
+ * TConstellation  *constellation  O  N/A  Structure to save the data of GNSS satellites
+ * TAntennaList *antennaList       O  N/A  Structure to save the data of receiver 
+ *                                         antennas
  * Returned value (int)            O  N/A  Status of the function
- *                                         4 => File is concatenated but no END OF FILE found
- *                                         3 => File is concatenated
- *                                         2 => properly read but no END OF FILE found
  *                                         1 => Properly read
  *                                         0 => Error
- *                                        -2 => Number of records read do not match the number given in the header
- *                                        -3 => Something wrong or missing in Header
  *****************************************************************************/
-int readIONEX (FILE *fd, TIONEX *IONEX, double *ionexVersion) {
+int readAntex (FILE *fd, TConstellation *constellation, TAntennaList *antennaList) {
 	char			line[MAX_INPUT_LINE];
 	char			aux[100];
-	int				len = 0;
+	char			*ca;
+	int 			len = 0;
+	struct tm		tm;
 	int				properlyRead = 0;
-	int				i, j;
+	TConstellationElement	sat;
+	TAntenna		ant;
+	int				i, j, k;
+	int				freqInd;
+	int				readingHeader = 1;
+	int				error = 0;
 	int				PRN;
-	int				HeaderLinesNecessary=-13;
-	struct tm		tm;
+	int				system;
+	int				readingWhat; // = 0 Satellite    = 1 Receiver antenna
 	double			seconds;
-	int				readingCells = 0;
-	int				mapType; // 0->TEC 1->RMS 2->HGT
-	int				RMSstarted=0,HGTstarted=0;
-	int				numFirstLineHeaderRead=0;
-	int				EndofFileFound=0;
-	TIonoMap		ionoMap;
-	TIonexStation	ionexStation;
-	int				ind;
-	double			lat;
-	double			lon1, lon2, dlon, lon;
-	int				nlon, ilon;
-	double			h;
-	double			ionoValue;
-	char			ConstellationType[2];
-	enum GNSSystem	satSystem;
-	static int		firstTimeRead=1;
 	
-	initIonoMap(&ionoMap);
-	initIonexStation(&ionexStation);
-	ConstellationType[0] = '\0';
-
+	tm.tm_hour = 0;
+	tm.tm_min = 0;
+	tm.tm_sec = 0;
+	
 	while(getL(line,&len,fd)!=-1) {
-		if (!readingCells) {
-			if (strncmp(&line[60],"IONEX VERSION / TYPE",20)==0) {
-				numFirstLineHeaderRead++;
-				if (numFirstLineHeaderRead>1) {
-					//Second time "IONEX VERSION / TYPE" line appears. 
-					//It is a concatenated file and we have already read one file
-					getLback(line,&len,fd);
-					if (EndofFileFound==1) {
-						properlyRead=3;
-					} else {
-						properlyRead=4;
-					}
-					break;
-				}
-				getstr(aux,line,0,9);
-				*ionexVersion = atof(aux);
-				if (firstTimeRead==0) {
-					//Free memory from the previous day read
-					for (i=0;i<IONEX->numMaps;i++) {
-						free(IONEX->map[i].TEC);
-						free(IONEX->map[i].RMS);
-						free(IONEX->map[i].HGT);
-					}
-					if (IONEX->ionexStation!=NULL) {
-						free(IONEX->ionexStation);
+		if (readingHeader) {
+			if (strncmp(&line[60],"ANTEX VERSION / SYST",20)==0) {
+				properlyRead = 1;
+			} else if (strncmp(&line[60],"PCV TYPE / REFANT",17)==0) {
+				// Do nothing
+			} else if (strncmp(&line[60],"END OF HEADER",13)==0) {
+				readingHeader = 0;
+			}
+		} else { // readingHeader==0
+			if (strncmp(&line[60],"TYPE / SERIAL NO",16)==0) {
+				getstr(aux,line,20,20);
+				PRN = atoi(&aux[1]);
+				if (PRN!=0 && (aux[0]=='G' || aux[0]=='R' || aux[0]=='E' || aux[0]=='S' || aux[0]=='C' || aux[0]=='J' || aux[0]=='I')) {
+					// GNSS Satellite
+					initConstellationElement(&sat);
+					sat.GNSS = gnsschar2gnsstype(aux[0]);
+					sat.PRN = PRN;
+					getstr(aux,line,40,10);
+					sat.SVN = atoi(&aux[1]);
+					getstr(aux,line,0,20);
+					sat.block = satblockstr2satblock(aux);
+					readingWhat = 0;
+				} else {
+					// Receiver antenna
+					initAntenna(&ant);
+					getstr(aux,line,0,20);
+					strcpy(ant.type,aux);
+					// Separate the anntena.type into antenna and radome
+					strcpy(ant.type_ant,ant.type);
+					ca = strstr(ant.type_ant," ");
+					if (ca != NULL) {
+						*ca = '\0';
+						strcpy(ant.type_radome,&ca[1]);
+						trim(ant.type_radome);
 					}
-					free(IONEX->map);
-					initIONEX(IONEX);
+					readingWhat = 1;
 				}
-				if (*ionexVersion != 1.0 ) return 0;
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"EPOCH OF FIRST MAP",18)==0) {
-				getstr(aux,line,2,4);
-				tm.tm_year = atoi(aux)-1900;
-				getstr(aux,line,10,2);
-				tm.tm_mon  = atoi(aux)-1;
-				getstr(aux,line,16,2);
-				tm.tm_mday = atoi(aux);
-				getstr(aux,line,22,2);
-				tm.tm_hour = atoi(aux);
-				getstr(aux,line,28,2);
-				tm.tm_min  = atoi(aux);
-				getstr(aux,line,34,11);
-				tm.tm_sec  = atoi(aux);
-				seconds = atof(aux);
-				IONEX->startTime.MJDN = MJDN(&tm);
-				IONEX->startTime.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"EPOCH OF LAST MAP",17)==0) {
-				getstr(aux,line,2,4);
-				tm.tm_year = atoi(aux)-1900;
-				getstr(aux,line,10,2);
-				tm.tm_mon  = atoi(aux)-1;
-				getstr(aux,line,16,2);
-				tm.tm_mday = atoi(aux);
-				getstr(aux,line,22,2);
-				tm.tm_hour = atoi(aux);
-				getstr(aux,line,28,2);
-				tm.tm_min  = atoi(aux);
-				getstr(aux,line,34,11);
-				tm.tm_sec  = atoi(aux);
-				seconds = atof(aux);
-				IONEX->endTime.MJDN = MJDN(&tm);
-				IONEX->endTime.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"INTERVAL",8)==0) {
-				getstr(aux,line,0,6);
-				IONEX->interval = atoi(aux);
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"# OF MAPS IN FILE",17)==0) {
-				getstr(aux,line,0,6);
-				IONEX->numMaps = atoi(aux); 
-				// Reserve memory for maps
-				IONEX->map = malloc(sizeof(TIonoMap)*IONEX->numMaps);
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"MAPPING FUNCTION",16)==0) {
-				getstr(aux,line,2,4);
-				strcpy(IONEX->mappingFunction,aux);
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"ELEVATION CUTOFF",16)==0) {
-				getstr(aux,line,0,8);
-				IONEX->elevationCutoff = atof(aux);
-			} else if (strncmp(&line[60],"OBSERVABLES USED",16)==0) {
-				getstr(aux,line,0,60);
-				strcpy(IONEX->observablesUsed,aux);
-			} else if (strncmp(&line[60],"# OF STATIONS",13)==0) {
-				getstr(aux,line,0,6);
-				IONEX->stationNumber = atoi(aux);
-			} else if (strncmp(&line[60],"# OF SATELLITES",15)==0) {
-				getstr(aux,line,0,6);
-				IONEX->satNumber = atoi(aux);
-			} else if (strncmp(&line[60],"BASE RADIUS",11)==0) {
-				getstr(aux,line,0,8);
-				IONEX->baseRadius = atof(aux);
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"MAP DIMENSION",13)==0) {
-				getstr(aux,line,0,6);
-				IONEX->mapDimension = atoi(aux);
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"EXPONENT",8)==0) {
-				getstr(aux,line,0,6);
-				IONEX->exponent = atoi(aux);
-				IONEX->conversionFactor = E(IONEX->exponent);
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"HGT1 / HGT2 / DHGT",18)==0) {
-				getstr(aux,line,2,6);			// HGT1
-				ionoMap.hgt1 = atof(aux);
-				getstr(aux,line,8,6);			// HGT2
-				ionoMap.hgt2 = atof(aux);
-				getstr(aux,line,14,6);			// DHGT
-				ionoMap.dhgt = atof(aux);
-				ionoMap.nhgt = numSteps(ionoMap.hgt1,ionoMap.hgt2,ionoMap.dhgt);
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"LAT1 / LAT2 / DLAT",18)==0) {
-				getstr(aux,line,2,6);			// LAT1
-				ionoMap.lat1 = atof(aux);
-				getstr(aux,line,8,6);			// LAT2
-				ionoMap.lat2 = atof(aux);
-				getstr(aux,line,14,6);			// DLAT
-				ionoMap.dlat = atof(aux);
-				ionoMap.nlat = numSteps(ionoMap.lat1,ionoMap.lat2,ionoMap.dlat);
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"LON1 / LON2 / DLON",18)==0) {
-				getstr(aux,line,2,6);			// LON1
-				ionoMap.lon1 = atof(aux);
-				getstr(aux,line,8,6);			// LON2
-				ionoMap.lon2 = atof(aux);
-				getstr(aux,line,14,6);			// DLON
-				ionoMap.dlon = atof(aux);
-				ionoMap.nlon = numSteps(ionoMap.lon1,ionoMap.lon2,ionoMap.dlon);
-				HeaderLinesNecessary++;
-			} else if (strncmp(&line[60],"START OF TEC MAP",16)==0) {
-				if(HeaderLinesNecessary!=0) break;
-				getstr(aux,line,0,6);
-				ind = atoi(aux) -1;
-				mapType = 0;  // 0->TEC
-				//Check if number of records read is not greater than the number given in the header
-				if(ind+1>IONEX->numMaps) {
-					return -2;
+			} else if (strncmp(&line[60],"VALID",5)==0) {
+				if (readingWhat==0) { // Satellite Antenna
+					getstr(aux,line,2,4);
+					tm.tm_year = atoi(aux)-1900;
+					getstr(aux,line,10,2);
+					tm.tm_mon  = atoi(aux)-1;
+					getstr(aux,line,16,2);
+					tm.tm_mday = atoi(aux);
+					getstr(aux,line,22,2);
+					tm.tm_hour = atoi(aux);
+					getstr(aux,line,28,2);
+					tm.tm_min  = atoi(aux);
+					getstr(aux,line,33,10);
+					tm.tm_sec  = atoi(aux);
+					seconds = atof(aux);
+					if (strncmp(&line[66],"FROM",4)==0) {
+						sat.tLaunch.MJDN = MJDN(&tm);
+						sat.tLaunch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+					} else if (strncmp(&line[66],"UNTIL",5)==0) {
+						sat.tDecommissioned.MJDN = MJDN(&tm);
+						sat.tDecommissioned.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
+					}
 				}
-			} else if (strncmp(&line[60],"START OF RMS MAP",16)==0) {
-				if(HeaderLinesNecessary!=0) break;
-				//Check if number of TEC records read match the number given in the header
-				if(ind+1<IONEX->numMaps && RMSstarted==0) {
-					return -2;
+			} else if (strncmp(&line[60],"DAZI",4)==0) {
+				getstr(aux,line,2,6);
+				if (readingWhat==0) { // Satellite Antenna
+					sat.dazi=atof(aux);
+				} else if (readingWhat==1) { // Receiver Antenna
+					ant.dazi=atof(aux);
 				}
-				RMSstarted=1;
-				getstr(aux,line,0,6);
-				ind = atoi(aux) -1;
-				mapType = 1;  // 1->RMS
-				IONEX->RMSavailable = 1; 
-				//Check if number of records read is not greater than the number given in the header
-				if(ind+1>IONEX->numMaps) {
-					return -2;
+			} else if (strncmp(&line[60],"ZEN1 / ZEN2 / DZEN",18)==0) {
+				getstr(aux,line,2,6);
+				if (readingWhat==0) { // Satellite Antenna
+					sat.zen1=sat.azi1=atof(aux);
+					getstr(aux,line,8,6);
+					sat.zen2=sat.azi2=atof(aux);
+					getstr(aux,line,14,6);
+					sat.dzen=atof(aux);
+					sat.nzen=numSteps(sat.zen1,sat.zen2,sat.dzen);
+					//Allocate memory for non azimuth corrections
+					sat.noazi=malloc(sizeof(double*)*MAX_GNSS);
+					for(i=0;i<MAX_GNSS;i++) {
+						sat.noazi[i]=malloc(sizeof(double*)*MAX_FREQUENCIES_PER_GNSS);
+						for(j=0;j<MAX_FREQUENCIES_PER_GNSS;j++) {
+							sat.noazi[i][j]=malloc(sizeof(double)*sat.nzen);
+						}
+					}
+					if(sat.dazi>0) {
+						sat.numazi=numSteps(0.0,360.0,sat.dazi);
+						//Allocate memory for azimuth corrections
+						sat.azi=malloc(sizeof(double*)*MAX_GNSS);
+						for(i=0;i<MAX_GNSS;i++) {
+							sat.azi[i]=malloc(sizeof(double*)*MAX_FREQUENCIES_PER_GNSS);
+							for(j=0;j<MAX_FREQUENCIES_PER_GNSS;j++) {
+								sat.azi[i][j]=malloc(sizeof(double*)*sat.numazi);
+								for(k=0;k<sat.numazi;k++) {
+									sat.azi[i][j][k]=malloc(sizeof(double)*sat.nzen);
+								}
+							}
+						}
+					}
+				} else if (readingWhat==1) { // Receiver Antenna
+					ant.zen1=ant.azi1=atof(aux);
+					getstr(aux,line,8,6);
+					ant.zen2=ant.azi2=atof(aux);
+					getstr(aux,line,14,6);
+					ant.dzen=atof(aux);
+					ant.nzen=numSteps(ant.zen1,ant.zen2,ant.dzen);
+					//Allocate memory for non azimuth corrections
+					ant.noazi=malloc(sizeof(double*)*MAX_GNSS);
+					for(i=0;i<MAX_GNSS;i++) {
+						ant.noazi[i]=malloc(sizeof(double*)*MAX_FREQUENCIES_PER_GNSS);
+						for(j=0;j<MAX_FREQUENCIES_PER_GNSS;j++) {
+							ant.noazi[i][j]=malloc(sizeof(double)*ant.nzen);
+						}
+					}
+					if(ant.dazi>0) {
+						ant.numazi=numSteps(0.0,360.0,ant.dazi);
+						//Allocate memory for azimuth corrections
+						ant.azi=malloc(sizeof(double*)*MAX_GNSS);
+						for(i=0;i<MAX_GNSS;i++) {
+							ant.azi[i]=malloc(sizeof(double*)*MAX_FREQUENCIES_PER_GNSS);
+							for(j=0;j<MAX_FREQUENCIES_PER_GNSS;j++) {
+								ant.azi[i][j]=malloc(sizeof(double*)*ant.numazi);
+								for(k=0;k<ant.numazi;k++) {
+									ant.azi[i][j][k]=malloc(sizeof(double)*ant.nzen);
+								}
+							}
+						}
+					}
 				}
-			} else if (strncmp(&line[60],"START OF HEIGHT MAP",19)==0) {
-				if(HeaderLinesNecessary!=0) break;
-				//Check if number of RMS records read match the number given in the header
-				if(ind+1<IONEX->numMaps && HGTstarted==0) {
-					return -2;
+			} else if (strncmp(&line[60],"START OF FREQUENCY",18)==0) {
+				getstr(aux,line,4,2);
+				freqInd = atoi(aux);
+				getstr(aux,line,3,1);
+				system=gnsschar2gnsstype(aux[0]);
+			} else if (strncmp(&line[60],"NORTH / EAST / UP",17)==0) {
+				/*if(system!=GPS) {
+					//NORTH / EAST / UP is stored in single constellations, so data different from GPS has to be skipped!!!!!
+					getL(line,&len,fd); //Skip NOAZI data
+					if( (readingWhat==0 && sat.dazi>0) || (readingWhat==1 && ant.dazi>0) ) {
+						for(i=0;i<sat.numazi;i++) {
+							getL(line,&len,fd); //Skip AZI data if available
+						}
+					}
+					continue;
+				}*/
+				for (i=0;i<3;i++) {
+					getstr(aux,line,i*10,10);
+					if (readingWhat==0) { // Satellite Antenna
+						sat.PCO[freqInd][i] = atof(aux)/1e3; // (ANTEX in mm)
+					} else if (readingWhat==1) { // Receiver Antenna
+						ant.PCO[system][freqInd][i] = atof(aux)/1e3; // (ANTEX in mm)
+					}
 				}
-				HGTstarted=1;
-				getstr(aux,line,0,6);
-				ind = atoi(aux) -1;
-				mapType = 2;  // 2->HGT
-				IONEX->HGTavailable = 1;
-				//Check if number of records read is not greater than the number given in the header
-				if(ind+1>IONEX->numMaps) {
-					return -2;
+				//Read non azimuth corrections
+				if(getL(line,&len,fd)!=-1) {
+					if (strncmp(&line[3],"NOAZI",5)==0) {
+						if (readingWhat==0) { // Satellite Antenna
+							for(i=0;i<sat.nzen;i++) {
+								getstr(aux,line,8+8*i,8);
+								sat.noazi[system][freqInd][i]=atof(aux)/1e3;  // (ANTEX in mm)
+							}
+						} else if (readingWhat==1) { // Receiver Antenna
+							for(i=0;i<ant.nzen;i++) {
+								getstr(aux,line,8+8*i,8);
+								ant.noazi[system][freqInd][i]=atof(aux)/1e3;  // (ANTEX in mm)
+							}
+						}
+					} else {
+						//Non azimuth corrections missing
+						properlyRead=0;
+					}
 				}
-			} else if (strncmp(&line[60],"END OF TEC MAP",14)==0) {
-				if(HeaderLinesNecessary!=0) break;
-
-			} else if (strncmp(&line[60],"END OF RMS MAP",14)==0) {
-				if(HeaderLinesNecessary!=0) break;
+				//Read azimuth corrections if available
+				if( (readingWhat==0 && sat.dazi>0) || (readingWhat==1 && ant.dazi>0) ) {
+					if (readingWhat==0) { // Satellite Antenna
+						for(i=0;i<sat.numazi;i++) {
+							if(getL(line,&len,fd)!=-1) {
+								for(j=0;j<sat.nzen;j++) {
+									getstr(aux,line,8+8*j,8);
+									sat.azi[system][freqInd][i][j]=atof(aux)/1e3;  // (ANTEX in mm)
+								}
+							} else {
+								properlyRead=0;
+								break;
+							}
+						}
+					} else if (readingWhat==1) { // Receiver Antenna
+						for(i=0;i<ant.numazi;i++) {
+							if(getL(line,&len,fd)!=-1) {
+								for(j=0;j<ant.nzen;j++) {
+									getstr(aux,line,8+8*j,8);
+									ant.azi[system][freqInd][i][j]=atof(aux)/1e3;  // (ANTEX in mm)
+								}
+							} else {
+								properlyRead=0;
+								break;
+							}
+						}
 
-			} else if (strncmp(&line[60],"END OF HEIGHT MAP",17)==0) {
-				if(HeaderLinesNecessary!=0) break;
-		
-			} else if (strncmp(&line[60],"END OF HEADER",13)==0) {
-				properlyRead=2;
-				HeaderLinesNecessary++;
-				for (i=0;i<IONEX->numMaps;i++) {
-					memcpy(&IONEX->map[i],&ionoMap,sizeof(TIonoMap));
-					IONEX->map[i].TEC = malloc(sizeof(double)*getIonoMapTotalSize(&IONEX->map[i]));
-					IONEX->map[i].RMS = malloc(sizeof(double)*getIonoMapTotalSize(&IONEX->map[i]));
-					IONEX->map[i].HGT = malloc(sizeof(double)*getIonoMapTotalSize(&IONEX->map[i]));
-					for(j=0;j<getIonoMapTotalSize(&IONEX->map[i]);j++) {
-						//Initialize everything to 9999, so if there are any value missing in the IONEX file, the value stored will be 9999 and not 0
-						IONEX->map[i].TEC[j]=9999;
-						IONEX->map[i].RMS[j]=9999;
-						IONEX->map[i].HGT[j]=9999;
 					}
 				}
-			} else if (strncmp(&line[60],"EPOCH OF CURRENT MAP",20)==0) {
-				if(HeaderLinesNecessary!=0) break;
-				getstr(aux,line,2,4);
-				tm.tm_year = atoi(aux)-1900;
-				getstr(aux,line,10,2);
-				tm.tm_mon  = atoi(aux)-1;
-				getstr(aux,line,16,2);
-				tm.tm_mday = atoi(aux);
-				getstr(aux,line,22,2);
-				tm.tm_hour = atoi(aux);
-				getstr(aux,line,28,2);
-				tm.tm_min  = atoi(aux);
-				getstr(aux,line,34,11);
-				tm.tm_sec  = atoi(aux);
-				seconds = atof(aux);
-				IONEX->map[ind].t.MJDN = MJDN(&tm);
-				IONEX->map[ind].t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-			} else if (strncmp(&line[60],"LAT/LON1/LON2/DLON/H",20)==0) {
-				if(HeaderLinesNecessary!=0) break;
-				getstr(aux,line,2,6);
-				lat = atof(aux);
-				getstr(aux,line,8,6);
-				lon1 = atof(aux);
-				getstr(aux,line,14,6);
-				lon2 = atof(aux);
-				getstr(aux,line,20,6);
-				dlon = atof(aux);
-				getstr(aux,line,26,6);
-				h = atof(aux);
-				if (IONEX->map[ind].hgt1==0) { IONEX->map[ind].hgt1=IONEX->map[ind].hgt2=h; } //To avoid 0 values in case HGT1=HGT2=DHGT=0 in IONEX file
-				nlon = numSteps(lon1,lon2,dlon);
-				ilon = 0;
-				readingCells = 1;
-			} else if (strncmp(&line[60],"PRN / BIAS / RMS",16)==0) {
-				getstr(ConstellationType,line,3,1);     //GNSS type letter
-				satSystem = gnsschar2gnsstype(ConstellationType[0]);
-				getstr(aux,line,4,2);
-				PRN = atoi(aux);
-				getstr(aux,line,6,10);
-				IONEX->ionexDCB.DCB[satSystem][PRN] = atof(aux);
-				getstr(aux,line,16,10);
-				IONEX->ionexDCB.DCBRMS[satSystem][PRN] = atof(aux);
-				IONEX->ionexDCB.DCBavailable = 1;
-			} else if (strncmp(&line[60],"STATION / BIAS / RMS",20)==0) {
-				IONEX->numStationData++;
-				IONEX->ionexStation = malloc(sizeof(TIonexStation)*IONEX->numStationData);
-				getstr(aux,line,6,4);
-				strcpy(IONEX->ionexStation[IONEX->numStationData -1].stationInitials,aux);
-				getstr(aux,line,11,10);
-				strcpy(IONEX->ionexStation[IONEX->numStationData -1].stationcode,aux);
-				getstr(aux,line,26,10);
-				IONEX->ionexStation[IONEX->numStationData -1].stationBias = atof(aux);
-				getstr(aux,line,36,10);
-				IONEX->ionexStation[IONEX->numStationData -1].stationRMS = atof(aux);
-			} else if (strncmp(&line[60],"END OF FILE",11)==0) {
-				properlyRead = 1;
-				firstTimeRead=0;
-				EndofFileFound=1;
-			}
-		} else {  // readingCells
-			if(HeaderLinesNecessary!=0) break;
-			for (i=0;i<16 && ilon<nlon;i++,ilon++) {
-				getstr(aux,line,i*5,5);
-				lon = ilon*dlon + lon1;
-				ionoValue = atof(aux);
-				if (ionoValue==9999) { setIonoValue(&IONEX->map[ind],mapType,h,lat,lon,ionoValue);}
-				else {
-					setIonoValue(&IONEX->map[ind],mapType,h,lat,lon,ionoValue*IONEX->conversionFactor);
+			} else if (strncmp(&line[60],"END OF ANTENNA",14)==0) {
+				if (readingWhat==0) { // Satellite Antenna
+					// Allocate memory
+					constellation->numSatellites ++;
+					constellation->sat = realloc(constellation->sat,sizeof(TConstellationElement)*constellation->numSatellites);
+						
+					// Store satellite
+					memcpy(&constellation->sat[constellation->numSatellites-1],&sat,sizeof(TConstellationElement));
+
+				} else if (readingWhat==1) { // Receiver Antenna
+					// Allocate memory
+					antennaList->numAnt ++;
+					antennaList->ant = realloc(antennaList->ant,sizeof(TAntenna)*antennaList->numAnt);
+					
+					// Store antenna
+					memcpy(&antennaList->ant[antennaList->numAnt-1],&ant,sizeof(TAntenna));
 				}
 			}
-			if (ilon==nlon) readingCells = 0;
 		}
-		
 	}
+	
+	return (properlyRead && !error); // properly read AND no error
+}
 
-	if (HeaderLinesNecessary!=0) properlyRead=-3;
-	return (properlyRead); 
+/*****************************************************************************
+ * Name        : readAntexFile
+ * Description : Read an ANTEX file from a filename
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *filename                 I  N/A  Name of the file
+ * TConstellation  *constellation  O  N/A  Structure to save the data of GNSS satellites
+ * TAntennaList *antennaList       O  N/A  Structure to save the data of receiver 
+ *                                         antennas
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1  => File open and properly read
+ *                                         0  => File open and failed to read
+ *                                         -1 => File not open
+ *****************************************************************************/
+int readAntexFile (char *filename, TConstellation *constellation, TAntennaList *antennaList) {
+	FILE	*fd;
+	int		ret;
+	
+	if (whatFileTypeIs(filename)!=ftANTEX) return 0;
+	
+	if ((fd = openInputFile(filename))) {
+		ret = readAntex (fd, constellation, antennaList);
+		fclose(fd);
+		return ret;
+	} else {
+		// File do not exist
+		return -1;
+	}
 }
 
 /*****************************************************************************
- * Name        : readFPPP
- * Description : Read a FPPP file from a file descriptor
+ * Name        : readDCB
+ * Description : Read a DCB file from a file descriptor
  * Parameters  :
  * Name                           |Da|Unit|Description
  * FILE  *fd                       I  N/A  File descriptor
- * TFPPP  *FPPP                    O  N/A  Structure to save the data
- * double *FPPPVersion             O  N/A  FPPP file version
+ * TDCBdata  *DCB                  O  N/A  Structure to save the DCB data
  * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Properly read
- *                                         0 => Error
+ *                                          1 => Properly read
+ *                                          0 => Error
+ *                                         -2 => First header line not recognized
  *****************************************************************************/
-int readFPPP (FILE *fd, TFPPPIONEX *FPPP, double *FPPPVersion) {
-	char		line[MAX_INPUT_LINE];
-	char 		aux[100];
-	int 		len = 0;
-	int			properlyRead = 0;
-	int			error = 0;
-	int			PRN;
-	struct tm	tm;
-	double		seconds;
-	int			readingHeader = 1, readingDCB = 0, lastMapNotStarted = 1;
-	int			mapType;
-	TFPPPMap	FPPPMap;
-	int			ind, mapPosition;
-	double		lt, lat, sigma, exponent, tec, mapHeight;
-	char		ConstellationType[2];
-	enum GNSSystem  satSystem;
-
+int readDCB (FILE *fd, TDCBdata *DCB) {
+	char 					line[MAX_INPUT_LINE];
+	char					*pt;
+	char					*ptaux;
+	char    				aux[100];
+	enum MeasurementType	meas;
+	enum GNSSystem			GNSS;
+	double					value;
+	double					rms;
+	int 					len = 0;
+	struct tm				tm;
+	int						properlyRead = 0;
+	int						readingHeader = 1;
+	int						firstLineHeaderFound = 0;
+	int						PRN;
+	int						writtingAbs;
+	int						year,doy;
+	double					factor;
+	
+	tm.tm_hour = 0;
+	tm.tm_min = 0;
+	tm.tm_sec = 0;
+	tm.tm_mday = 1;
 	
-	initFPPPMap(&FPPPMap);
-	ConstellationType[0] = '\0';
-
 	while(getL(line,&len,fd)!=-1) {
 		if (readingHeader) {
-			if (strncmp(&line[60],"FPPP VERSION / TYPE",19)==0) {
-				getstr(aux,line,0,9);
-				*FPPPVersion = atof(aux);
-				if (*FPPPVersion != 1.0 ) return 0;
-			} else if (strncmp(&line[60],"EPOCH OF FIRST MAP",18)==0) {
-				getstr(aux,line,2,4);
-				tm.tm_year = atoi(aux)-1900;
-				getstr(aux,line,10,2);
-				tm.tm_mon  = atoi(aux)-1;
-				getstr(aux,line,16,2);
-				tm.tm_mday = atoi(aux);
-				getstr(aux,line,22,2);
-				tm.tm_hour = atoi(aux);
-				getstr(aux,line,28,2);
-				tm.tm_min  = atoi(aux);
-				getstr(aux,line,34,11);
-				tm.tm_sec  = atoi(aux);
-				seconds = atof(aux);
-				FPPP->startTime.MJDN = MJDN(&tm);
-				FPPP->startTime.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-			} else if (strncmp(&line[60],"INTERVAL",8)==0) {
-				getstr(aux,line,0,6);
-				FPPP->interval = atoi(aux);
-			} else if (strncmp(&line[60],"BASE RADIUS",11)==0) {
-				getstr(aux,line,0,8);
-				FPPP->baseRadius = atof(aux);
-			} else if (strncmp(&line[60],"HGT1 / HGT2",11)==0) {
-				getstr(aux,line,0,8);			// HGT1
-				FPPPMap.hgt1 = atof(aux);
-				getstr(aux,line,8,8);			// HGT2
-				FPPPMap.hgt2 = atof(aux);
-				FPPPMap.dhgt = FPPPMap.hgt2 - FPPPMap.hgt1;
-		/*	} else if (strncmp(&line[60],"LAT1 / LAT2 / DLAT",18)==0) {
-				getstr(aux,line,2,6);			// LAT1
-				ionoMap.lat1 = atof(aux);
-				getstr(aux,line,8,6);			// LAT2
-				ionoMap.lat2 = atof(aux);
-				getstr(aux,line,14,6);			// DLAT
-				ionoMap.dlat = atof(aux);
-				ionoMap.nlat = numSteps(ionoMap.lat1,ionoMap.lat2,ionoMap.dlat);*/
-			} else if (strncmp(&line[60],"DLT / DLAT",10)==0) {
-				getstr(aux,line,0,8);			// DLT
-				FPPPMap.dlt = atof(aux);
-				FPPPMap.lt2 = FPPPMap.lt2 - FPPPMap.dlt;
-				getstr(aux,line,8,8);			// DLAT
-				FPPPMap.dlat = atof(aux);
-			} else if (strncmp(&line[60],"MIN/MAX  LAT",12)==0) {
-				getstr(aux,line,0,8);                   // LAT1
-								FPPPMap.lat1 = atof(aux);
-				getstr(aux,line,8,8);			// LAT2
-				FPPPMap.lat2 = atof(aux);
-				FPPPMap.nlt = numSteps(FPPPMap.lt1,FPPPMap.lt2,FPPPMap.dlt);
-				FPPPMap.nlat = numSteps(FPPPMap.lat1,FPPPMap.lat2,FPPPMap.dlat);
-			} else if (strncmp(&line[60],"END OF HEADER",13)==0) {
-				readingHeader = 0;
-			}
-		
-		} else {
-			if (strncmp(&line[60],"START OF TEC MAP",16)==0 && strlen(line)>60) {
-				getstr(aux,line,0,7);
-				ind = atoi(aux) -1;
-				//Reserve memory for new map, copy variables and initialize all points to 9999
-				FPPP->map = (TFPPPMap*) (realloc(FPPP->map,sizeof(TFPPPMap)*(ind+1)));
-				memcpy(&FPPP->map[ind],&FPPPMap,sizeof(TFPPPMap));
-				FPPP->map[ind].TEC = malloc(sizeof(double)*getFPPPMapTotalSize(&FPPP->map[ind]));
-				FPPP->map[ind].SIGMA = malloc(sizeof(double)*getFPPPMapTotalSize(&FPPP->map[ind]));
-				initFPPPMapData(&FPPP->map[ind]);
-
-								//Prepare for reading DCB (if there are any available)
-								readingDCB = 1;
-
-				//Check if really this last map has data (due to FPPP is real time generated, it includes the Header but not the data)
-				lastMapNotStarted=1;
-			} else if (strncmp(&line[60],"EPOCH OF CURRENT MAP",20)==0 && strlen(line)>60) {
-				getstr(aux,line,2,4);		// Year
-				tm.tm_year = atoi(aux)-1900;
-				getstr(aux,line,10,2);		// Month
-				tm.tm_mon  = atoi(aux)-1;
-				getstr(aux,line,16,2);		// Day
-				tm.tm_mday = atoi(aux);
-				getstr(aux,line,22,2);		// Hour
-				tm.tm_hour = atoi(aux);
-				getstr(aux,line,28,2);		// Minute
-				tm.tm_min  = atoi(aux);
-				getstr(aux,line,34,2);		// Second
-				tm.tm_sec  = atoi(aux);
-				seconds = atof(aux);
-				FPPP->map[ind].t.MJDN = MJDN(&tm);
-				FPPP->map[ind].t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-								//DCB data ended
-								readingDCB = 0;
-			} else if (readingDCB){
-								getstr(ConstellationType,line,0,1);     //GNSS type letter
-								satSystem = gnsschar2gnsstype(ConstellationType[0]);
-				getstr(aux,line,1,2); // PRN 
-				PRN = atoi(aux);	
-				getstr(aux,line,4,9); // frac1 	
-				FPPP->fpppDCB.frac1[satSystem][PRN] = atof(aux);
-				getstr(aux,line,14,9); // frac2
-				FPPP->fpppDCB.fracw[satSystem][PRN] = atof(aux);
-				getstr(aux,line,24,9); // IFB
-				FPPP->fpppDCB.IFB[satSystem][PRN] = atof(aux);
-				FPPP->fpppDCB.DCBavailable = 1;
-		/*	} else if (strncmp(&line[60],"LAT/LON1/LON2/DLON/H",20)==0) {
-				getstr(aux,line,2,6);
-				lat = atof(aux);
-				getstr(aux,line,8,6);
-				lon1 = atof(aux);
-				getstr(aux,line,14,6);
-				lon2 = atof(aux);
-				getstr(aux,line,20,6);
-				dlon = atof(aux);
-				getstr(aux,line,26,6);
-				h = atof(aux);
-				if (FPPP->map[ind].hgt1==0) { FPPP->map[ind].hgt1=FPPP->map[ind].hgt2=h; } //To avoid 0 values in case HGT1=HGT2=DHGT=0 in IONEX file
-				nlon = numSteps(lon1,lon2,dlon);
-				ilon = 0;
-				readingCells = 1;
-		*/
-		/*	} else if (strncmp(&line[60],"END OF FILE",11)==0) {
-								properlyRead = 1;
-		*/	
-			}else {  // readingCells
+			if ((pt=strstr(line,"YEAR-MONTH"))!=NULL) {
+				// CODE'S MONTHLY GPS P1-C1 DCB SOLUTION, YEAR-MONTH 10-01          04-FEB-10 20:11
+				firstLineHeaderFound=1;
+				DCB->n++;
+				pt += 11; // Pointing to '10-01 [...]'
+				getstr(aux,pt,0,2);
+				tm.tm_year = atoi(aux);
+				if (tm.tm_year <= 70) tm.tm_year += 100;
+				getstr(aux,pt,3,2);
+				tm.tm_mon = atoi(aux) - 1;
+				DCB->block[DCB->n-1].startTime.MJDN = MJDN(&tm);
+				tm.tm_mon ++;
+				DCB->block[DCB->n-1].endTime.MJDN = MJDN(&tm);
 
-				getstr(aux,line,0,6); // LT
-				lt = modulo(atof(aux)+360,360);
-				getstr(aux,line,6,6); // LAT
-				lat = atof(aux);
-				getstr(aux,line,12,9); // PARTIAL TEC
-				tec = atof(aux);
-				getstr(aux,line,21,5); // SIGMA
-				sigma = atof(aux);
-				getstr(aux,line,27,3); // SIGMA EXPONENT
-				exponent = atof(aux);
-				sigma = sigma * E(exponent);
-				getstr(aux,line,30,3); // MAP POSITION
-				mapPosition = atoi(aux) -1;
-			
+			} else if ((pt=strstr(line,"YEAR "))!=NULL) { //From 1 January 2012 the date format has been changed in the DCB header
+				// CODE'S MONTHLY GPS P1-C1 DCB SOLUTION, YEAR 2014, MONTH 05       04-JUN-14 07:46
+				firstLineHeaderFound=1;
+				DCB->n++;
+				pt += 5; // Pointing to year number
+				getstr(aux,pt,0,4);
+				tm.tm_year = atoi(aux) -1900;
+				pt += 12; // Pointing to month number
+				getstr(aux,pt,0,2);
+				tm.tm_mon = atoi(aux) - 1;
+				DCB->block[DCB->n-1].startTime.MJDN = MJDN(&tm);
+				tm.tm_mon ++;
+				DCB->block[DCB->n-1].endTime.MJDN = MJDN(&tm);
 
-				mapHeight = FPPP->map[ind].hgt1 + mapPosition*FPPP->map[ind].dhgt;
-				//Set TEC value for current map
-				mapType = 0;	
-				setFPPPValue(&FPPP->map[ind],mapType,mapHeight,lat,lt,tec);
-				//Set SIGMA values for current map
-				mapType = 1;
-								setFPPPValue(&FPPP->map[ind],mapType,mapHeight,lat,lt,sigma);
-			
+			} else if ((pt=strstr(line,"ENDING DAY"))!=NULL) { //From somewhere around 2017 the date format has been changed in the DCB header
+				// CODE'S 30-DAY GPS P1-C1 DCB SOLUTION, ENDING DAY 306, 2017       06-NOV-17 06:45
+				firstLineHeaderFound=1;
+				DCB->n++;
+				pt += 11; // Pointing to doy
+				getstr(aux,pt,0,3);
+				doy=atoi(aux);
+				pt += 5; // Pointing to year
+				getstr(aux,pt,0,4);
+				year=atoi(aux);
+				DCB->block[DCB->n-1].endTime.MJDN = yeardoy2MJDN(year,doy,0);
+				DCB->block[DCB->n-1].startTime.MJDN = DCB->block[DCB->n-1].endTime.MJDN-30;
+
+			} else if (strstr(line,"CODE BIASES")!=NULL) {
+				if (firstLineHeaderFound==0) return -2;
+				// DIFFERENTIAL (P1-C1) CODE BIASES FOR SATELLITES AND RECEIVERS:
+				pt = strstr(line,"(");
+				if (pt==NULL) return 0;
+				pt++;
+				ptaux = strstr(pt,"-");
+				if (ptaux==NULL) return 0;
+				strncpy(aux,pt,ptaux-pt);
+				aux[ptaux-pt]='\0';
+				meas = measstr2meastype(aux);
+				DCB->block[DCB->n-1].measTo = meas;
+				pt=ptaux+1;
+				ptaux = strstr(pt,")");
+				if (ptaux==NULL) return 0;
+				strncpy(aux,pt,ptaux-pt);
+				aux[ptaux-pt]='\0';
+				meas = measstr2meastype(aux);
+				DCB->block[DCB->n-1].measFrom = meas;
+				// Check to create the absolute measurement (from P1 to NA)
+				if ((DCB->block[DCB->n-1].measFrom==C2P && DCB->block[DCB->n-1].measTo==C1P) || (DCB->block[DCB->n-1].measFrom==C1P && DCB->block[DCB->n-1].measTo==C2P)) {
+					DCB->block[DCB->n].measFrom = C1P;
+					DCB->block[DCB->n].measTo = NA;
+					memcpy(&DCB->block[DCB->n].startTime,&DCB->block[DCB->n-1].startTime,sizeof(TTime));
+					memcpy(&DCB->block[DCB->n].endTime,&DCB->block[DCB->n-1].endTime,sizeof(TTime));
+					factor = 1.0/(1.0-(GPSf1*GPSf1)/(GPSf2*GPSf2)); // 1/(1-f1^2/f2^2)
+					if (DCB->block[DCB->n-1].measFrom==C2P) factor*= -1.0;
+					writtingAbs = 1;
+				} else {
+					writtingAbs = 0;
+				}
+			} else if (strncmp(line,"PRN / STATION NAME",18)==0) {
+				// PRN / STATION NAME        VALUE (NS)  RMS (NS)
+				// ***   ****************    *****.***   *****.***
+				if (firstLineHeaderFound==0) return -2;
+				if (getL(line,&len,fd)==-1) {
+					return 0;
+				}
+				readingHeader = 0;
+			}
+		} else { //readingHeader == 0
+			GNSS = gnsschar2gnsstype(line[0]);
+			getstr(aux,line,1,2);
+			PRN = atoi(aux);
+			if (PRN != 0) { // Satellite unidentified or blank line
 				properlyRead = 1;
-				lastMapNotStarted = 0;
+				getstr(aux,line,26,9);
+				value = atof(aux);
+				getstr(aux,line,38,9);
+				rms = atof(aux);
+				// From ns to meters
+				value *= 1e-9*c0;
+				rms *= 1e-9*c0;
+				DCB->block[DCB->n-1].dcb[GNSS][PRN] = value;
+				DCB->block[DCB->n-1].available[GNSS][PRN] = 1;
+				if (writtingAbs) {
+					DCB->block[DCB->n].dcb[GNSS][PRN] = value*factor;
+					DCB->block[DCB->n].available[GNSS][PRN] = 1;
+				}
 			}
 		}
-		
-	} //end While
-
-	if (lastMapNotStarted) {ind--;} //Take into consideration the case in which the Header is given but not the data (due to the file is real time generated)
-	FPPP->numMaps = ind +1;
-	FPPP->endTime.MJDN = FPPP->map[ind].t.MJDN;
-	FPPP->endTime.SoD = FPPP->map[ind].t.SoD;
-	return (properlyRead && !error); // properly read AND no error
+	}
+	if (writtingAbs) DCB->n++;
+	
+	return properlyRead;
 }
 
 /*****************************************************************************
- * Name        : readFPPPFile
- * Description : Read a IONEX FPPP file from a filename
+ * Name        : readDCBFile
+ * Description : Read a DCB file from a filename
  * Parameters  :
  * Name                           |Da|Unit|Description
  * char  *filename                 I  N/A  Name of the file
- * TFPPP  *FPPP                    O  N/A  Structure to save the data
- * double *FPPPVersion             O  N/A  FPPP file version
+ * TDCBdata  *DCB                  O  N/A  Structure to save the DCB data
  * Returned value (int)            O  N/A  Status of the function
- *                                         1  => File open and properly read
- *                                         0  => File open and failed to read
+ *                                          1 => File open and properly read
+ *                                          0 => File open and failed to read
  *                                         -1 => File not open
+ *                                         -2 => First header line not recognized
  *****************************************************************************/
-int readFPPPFile (char *filename, TFPPPIONEX *FPPP, double *FPPPVersion) {
-	FILE	*fd;
-	int		ret;
+int readDCBFile (char *filename, TDCBdata *DCB) {
+	FILE		*fd;
+	int 		ret;
+	enum fileType	ft;
 	
-	if (whatFileTypeIs(filename)!=ftFPPP) return 0;
-	if ((fd = fopen(filename,"rb"))) {
-		ret = readFPPP (fd, FPPP, FPPPVersion);
+  ft = whatFileTypeIs(filename);
+
+	if (ft!=ftP1C1DCB && ft!=ftP1P2DCB) return 0;
+
+	if ((fd = openInputFile(filename))) {
+		ret = readDCB (fd, DCB);
 		fclose(fd);
 		return ret;
 	} else {
@@ -5376,445 +8489,164 @@ int readFPPPFile (char *filename, TFPPPIONEX *FPPP, double *FPPPVersion) {
 	}
 }
 
-
 /*****************************************************************************
- * Name        : readConstellation
- * Description : Read a constellation status file from a file descriptor
- *               File available at: 
- *                 http://gge.unb.ca/Resources/GPSConstellationStatus.txt
- *	             File compiled and maintaned by Richard B. Langley, Dept. of 
- *               Geodesy and Geomatics Engineering, University of New Brunswick.
+ * Name        : readRecType
+ * Description : Read a GPS Receiver type file from a file descriptor
  * Parameters  :
  * Name                           |Da|Unit|Description
  * FILE  *fd                       I  N/A  File descriptor
- * TConstellation  *constellation  O  N/A  Structure to save the data
+ * TReceiverList  *recList         O  N/A  Structure to save the Receiver data
  * Returned value (int)            O  N/A  Status of the function
  *                                         1 => Properly read
  *                                         0 => Error
  *****************************************************************************/
-int readConstellation (FILE *fd, TConstellation *constellation) {
-	char 					line[MAX_INPUT_LINE];
-	char    				aux[100];
-	int 					len = 0;
-	int						properlyRead = 0;
-	int						error = 0;
-	struct tm				tm;
-	int						readingInfo = 0;
-	TConstellationElement	sat;
-	int						i;
+int readRecType (FILE *fd, TReceiverList *recList) {
+	char 		line[MAX_INPUT_LINE];
+	char		cr;
+	char   		aux[100];
+	int 		len = 0;
 	
-	tm.tm_hour = 0;
-	tm.tm_min = 0;
-	tm.tm_sec = 0;
-
 	while(getL(line,&len,fd)!=-1) {
-		if (line[strlen(line)-1]==13) line[strlen(line)-1] = '\n';
-		getstr(aux,line,0,5);
-		if (strcmp(aux,"Block")==0) {
-			// Initialize
-			initConstellationElement(&sat);
-			sat.GNSS = GPS;		// Only prepared for GPS right now
-						
-			getstr(aux,line,6,10);
-			if (strcmp(aux,"I")==0) {
-				sat.block = GPS_BLOCK_I;
-			} else if (strcmp(aux,"II")==0) {
-				sat.block = GPS_BLOCK_II;
-			} else if (strcmp(aux,"IIA")==0) {
-				sat.block = GPS_BLOCK_IIA;
-			} else if (strcmp(aux,"IIR")==0) {
-				sat.block = GPS_BLOCK_IIR;
-			} else if (strcmp(aux,"IIR-M")==0) {
-				sat.block = GPS_BLOCK_IIRM;
-			} else {
-				sat.block = UNKNOWN_BLOCK;
-			}
-			if (sat.block == GPS_BLOCK_II || sat.block == GPS_BLOCK_IIA) {
-				for (i=0;i<MAX_FREQUENCIES_PER_GNSS;i++) {
-					sat.PCO[i][0] = 0.279;
-					sat.PCO[i][1] = 0;
-					sat.PCO[i][2] = 1.023;
-				}
-			} else if (sat.block == GPS_BLOCK_I)  {
-				for (i=0;i<MAX_FREQUENCIES_PER_GNSS;i++) {
-					sat.PCO[i][0] = 0.21;
-					sat.PCO[i][1] = 0;
-					sat.PCO[i][2] = 0.854;
-				}
-			} else {
-				for (i=0;i<MAX_FREQUENCIES_PER_GNSS;i++) {
-					sat.PCO[i][0] = sat.PCO[i][1] = sat.PCO[i][2] = 0;
-				}
-			}
-			properlyRead = 1;
-			readingInfo = 1;
-		} else {
-			if (readingInfo) {
-				if (strcmp(aux,"Notes")==0) {
-					readingInfo = 0;
-				} else { // Satellite Data
-					getstr(aux,line,7,3);
-					sat.SVN = atoi(aux);
-					getstr(aux,line,57,14);
-					if (sat.SVN!=0 && strcmp(aux,"Launch failure")!=0) { // Valid line
-						getstr(aux,line,11,2);
-						sat.PRN = atoi(aux);
-						
-						getstr(aux,line,41,2);
-						tm.tm_year = atoi(aux);
-						if (tm.tm_year < 70) tm.tm_year+=100;
-						getstr(aux,line,44,2);
-						tm.tm_mon = atoi(aux)-1;
-						getstr(aux,line,47,2);
-						tm.tm_mday = atoi(aux);
-						sat.tLaunch.MJDN = MJDN(&tm);
-						sat.tLaunch.SoD = 0;
-						
-						if (line[68]==':') { // Satellite not decomissioned
-							tm.tm_year = 130;
-							tm.tm_mon = 0;
-							tm.tm_mday = 1;
-						} else { // Satellite decomissioned
-							getstr(aux,line,70,2);
-							tm.tm_year = atoi(aux);
-							if (tm.tm_year < 70) tm.tm_year+=100;
-							getstr(aux,line,73,2);
-							tm.tm_mon = atoi(aux)-1;
-							getstr(aux,line,76,2);
-							tm.tm_mday = atoi(aux);
-						} 
-						sat.tDecommissioned.MJDN = MJDN(&tm);
-						sat.tDecommissioned.SoD = 0;
-						
-						// Allocate memory
-						constellation->numSatellites ++;
-						constellation->sat = realloc(constellation->sat,sizeof(TConstellationElement)*constellation->numSatellites);
-						
-						// Store satellite
-						memcpy(&constellation->sat[constellation->numSatellites-1],&sat,sizeof(TConstellationElement));
-					}
+		if (line[0]!='#') { // Line is not a comment
+			getstr(aux,line,0,20);
+			if (aux[0]!='\0' && aux[0]!='\n') {
+				recList->n++;
+				recList->rec = realloc(recList->rec,sizeof(TReceiverData)*recList->n);
+				strcpy(recList->rec[recList->n-1].name,aux);
+				cr = line[21];
+				switch (cr) {
+					case '0':
+						recList->rec[recList->n-1].type = rtUNKNOWN;
+						break;
+					case '1':
+						recList->rec[recList->n-1].type = rtCROSS;
+						break;
+					case '2':
+						recList->rec[recList->n-1].type = rtNOP1;
+						break;
+					case '3':
+						recList->rec[recList->n-1].type = rtNOMINAL;
+						break;
+					default:
+						recList->rec[recList->n-1].type = rtUNKNOWN;
 				}
 			}
 		}
 	}
-
-	return (properlyRead && !error); // properly read AND no error
+	
+	return 1;
 }
 
 /*****************************************************************************
- * Name        : readConstellationFile
- * Description : Read a constellation status file from a filename
- *               File available at:
- *                 http://www2.unb.ca/gge/Resources/GPSConstellationStatus.txt
- *	             File compiled and maintaned by Richard B. Langley, Dept. of 
- *               Geodesy and Geomatics Engineering, University of New Brunswick.
+ * Name        : readRecTypeFile
+ * Description : Read a GPS Receiver type file from a filename
  * Parameters  :
  * Name                           |Da|Unit|Description
  * char  *filename                 I  N/A  Name of the file
- * TConstellation  *constellation  O  N/A  Structure to save the data
+ * TReceiverList  *recList         O  N/A  Structure to save the Receiver data
  * Returned value (int)            O  N/A  Status of the function
  *                                         1  => File open and properly read
  *                                         0  => File open and failed to read
  *                                         -1 => File not open
  *****************************************************************************/
-int readConstellationFile (char *filename, TConstellation *constellation) {
+int readRecTypeFile (char *filename, TReceiverList *recList) {
 	FILE	*fd;
 	int		ret;
 	
-	if (whatFileTypeIs(filename)!=ftConstellation) return 0;
+	if (whatFileTypeIs(filename)!=ftRECEIVERTYPE) return 0;
 	
-	if ((fd = fopen(filename,"rb"))) {
-		ret = readConstellation (fd, constellation);
+	if ((fd = openInputFile(filename))) {
+		ret = readRecType (fd, recList);
 		fclose(fd);
 		return ret;
 	} else {
 		// File do not exist
 		return -1;
-	}
-}
-
-/*****************************************************************************
- * Name        : readAntex
- * Description : Read an ANTEX file from a file descriptor
- * Parameters  :
- * Name                           |Da|Unit|Description
- * FILE  *fd                       I  N/A  File descriptor
- * TConstellation  *constellation  O  N/A  Structure to save the data of GNSS satellites
- * TAntennaList *antennaList       O  N/A  Structure to save the data of receiver 
- *                                         antennas
- * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Properly read
- *                                         0 => Error
- *****************************************************************************/
-int readAntex (FILE *fd, TConstellation *constellation, TAntennaList *antennaList) {
-	char			line[MAX_INPUT_LINE];
-	char			aux[100];
-	char			*ca;
-	int 			len = 0;
-	struct tm		tm;
-	int				properlyRead = 0;
-	TConstellationElement	sat;
-	TAntenna		ant;
-	int				i, j, k;
-	int				freqInd;
-	int				readingHeader = 1;
-	int				error = 0;
-	int				PRN;
-	int				system;
-	int				readingWhat; // = 0 Satellite    = 1 Receiver antenna
-	double			seconds;
-	
-	tm.tm_hour = 0;
-	tm.tm_min = 0;
-	tm.tm_sec = 0;
-	
-	while(getL(line,&len,fd)!=-1) {
-		if (readingHeader) {
-			if (strncmp(&line[60],"ANTEX VERSION / SYST",20)==0) {
-				properlyRead = 1;
-			} else if (strncmp(&line[60],"PCV TYPE / REFANT",17)==0) {
-				// Do nothing
-			} else if (strncmp(&line[60],"END OF HEADER",13)==0) {
-				readingHeader = 0;
-			}
-		} else { // readingHeader==0
-			if (strncmp(&line[60],"TYPE / SERIAL NO",16)==0) {
-				getstr(aux,line,20,20);
-				PRN = atoi(&aux[1]);
-				if (PRN!=0 && (aux[0]=='G' || aux[0]=='R' || aux[0]=='E' || aux[0]=='S' || aux[0]=='C' || aux[0]=='J' || aux[0]=='I')) {
-					// GNSS Satellite
-					initConstellationElement(&sat);
-					sat.GNSS = gnsschar2gnsstype(aux[0]);
-					sat.PRN = PRN;
-					getstr(aux,line,40,10);
-					sat.SVN = atoi(&aux[1]);
-					getstr(aux,line,0,20);
-					sat.block = satblockstr2satblock(aux);
-					readingWhat = 0;
-				} else {
-					// Receiver antenna
-					initAntenna(&ant);
-					getstr(aux,line,0,20);
-					strcpy(ant.type,aux);
-					// Separate the anntena.type into antenna and radome
-					strcpy(ant.type_ant,ant.type);
-					ca = strstr(ant.type_ant," ");
-					if (ca != NULL) {
-						*ca = '\0';
-						strcpy(ant.type_radome,&ca[1]);
-						trim(ant.type_radome);
-					}
-					readingWhat = 1;
-				}
-			} else if (strncmp(&line[60],"VALID",5)==0) {
-				if (readingWhat==0) { // Satellite Antenna
-					getstr(aux,line,2,4);
-					tm.tm_year = atoi(aux)-1900;
-					getstr(aux,line,10,2);
-					tm.tm_mon  = atoi(aux)-1;
-					getstr(aux,line,16,2);
-					tm.tm_mday = atoi(aux);
-					getstr(aux,line,22,2);
-					tm.tm_hour = atoi(aux);
-					getstr(aux,line,28,2);
-					tm.tm_min  = atoi(aux);
-					getstr(aux,line,33,10);
-					tm.tm_sec  = atoi(aux);
-					seconds = atof(aux);
-					if (strncmp(&line[66],"FROM",4)==0) {
-						sat.tLaunch.MJDN = MJDN(&tm);
-						sat.tLaunch.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-					} else if (strncmp(&line[66],"UNTIL",5)==0) {
-						sat.tDecommissioned.MJDN = MJDN(&tm);
-						sat.tDecommissioned.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds;
-					}
-				}
-			} else if (strncmp(&line[60],"DAZI",4)==0) {
-				getstr(aux,line,2,6);
-				if (readingWhat==0) { // Satellite Antenna
-					sat.dazi=atof(aux);
-				} else if (readingWhat==1) { // Receiver Antenna
-					ant.dazi=atof(aux);
-				}
-			} else if (strncmp(&line[60],"ZEN1 / ZEN2 / DZEN",18)==0) {
-				getstr(aux,line,2,6);
-				if (readingWhat==0) { // Satellite Antenna
-					sat.zen1=sat.azi1=atof(aux);
-					getstr(aux,line,8,6);
-					sat.zen2=sat.azi2=atof(aux);
-					getstr(aux,line,14,6);
-					sat.dzen=atof(aux);
-					sat.nzen=numSteps(sat.zen1,sat.zen2,sat.dzen);
-					//Allocate memory for non azimuth corrections
-					sat.noazi=malloc(sizeof(double*)*MAX_GNSS);
-					for(i=0;i<MAX_GNSS;i++) {
-						sat.noazi[i]=malloc(sizeof(double*)*MAX_FREQUENCIES_PER_GNSS);
-						for(j=0;j<MAX_FREQUENCIES_PER_GNSS;j++) {
-							sat.noazi[i][j]=malloc(sizeof(double)*sat.nzen);
-						}
-					}
-					if(sat.dazi>0) {
-						sat.numazi=numSteps(0.0,360.0,sat.dazi);
-						//Allocate memory for azimuth corrections
-						sat.azi=malloc(sizeof(double*)*MAX_GNSS);
-						for(i=0;i<MAX_GNSS;i++) {
-							sat.azi[i]=malloc(sizeof(double*)*MAX_FREQUENCIES_PER_GNSS);
-							for(j=0;j<MAX_FREQUENCIES_PER_GNSS;j++) {
-								sat.azi[i][j]=malloc(sizeof(double*)*sat.numazi);
-								for(k=0;k<sat.numazi;k++) {
-									sat.azi[i][j][k]=malloc(sizeof(double)*sat.nzen);
-								}
-							}
-						}
-					}
-				} else if (readingWhat==1) { // Receiver Antenna
-					ant.zen1=ant.azi1=atof(aux);
-					getstr(aux,line,8,6);
-					ant.zen2=ant.azi2=atof(aux);
-					getstr(aux,line,14,6);
-					ant.dzen=atof(aux);
-					ant.nzen=numSteps(ant.zen1,ant.zen2,ant.dzen);
-					//Allocate memory for non azimuth corrections
-					ant.noazi=malloc(sizeof(double*)*MAX_GNSS);
-					for(i=0;i<MAX_GNSS;i++) {
-						ant.noazi[i]=malloc(sizeof(double*)*MAX_FREQUENCIES_PER_GNSS);
-						for(j=0;j<MAX_FREQUENCIES_PER_GNSS;j++) {
-							ant.noazi[i][j]=malloc(sizeof(double)*ant.nzen);
-						}
-					}
-					if(ant.dazi>0) {
-						ant.numazi=numSteps(0.0,360.0,ant.dazi);
-						//Allocate memory for azimuth corrections
-						ant.azi=malloc(sizeof(double*)*MAX_GNSS);
-						for(i=0;i<MAX_GNSS;i++) {
-							ant.azi[i]=malloc(sizeof(double*)*MAX_FREQUENCIES_PER_GNSS);
-							for(j=0;j<MAX_FREQUENCIES_PER_GNSS;j++) {
-								ant.azi[i][j]=malloc(sizeof(double*)*ant.numazi);
-								for(k=0;k<ant.numazi;k++) {
-									ant.azi[i][j][k]=malloc(sizeof(double)*ant.nzen);
-								}
-							}
-						}
-					}
-				}
-			} else if (strncmp(&line[60],"START OF FREQUENCY",18)==0) {
-				getstr(aux,line,4,2);
-				freqInd = atoi(aux);
-				getstr(aux,line,3,1);
-				system=gnsschar2gnsstype(aux[0]);
-			} else if (strncmp(&line[60],"NORTH / EAST / UP",17)==0) {
-				/*if(system!=GPS) {
-					//NORTH / EAST / UP is stored in single constellations, so data different from GPS has to be skipped!!!!!
-					getL(line,&len,fd); //Skip NOAZI data
-					if( (readingWhat==0 && sat.dazi>0) || (readingWhat==1 && ant.dazi>0) ) {
-						for(i=0;i<sat.numazi;i++) {
-							getL(line,&len,fd); //Skip AZI data if available
-						}
-					}
-					continue;
-				}*/
-				for (i=0;i<3;i++) {
-					getstr(aux,line,i*10,10);
-					if (readingWhat==0) { // Satellite Antenna
-						sat.PCO[freqInd][i] = atof(aux)/1e3; // (ANTEX in mm)
-					} else if (readingWhat==1) { // Receiver Antenna
-						ant.PCO[system][freqInd][i] = atof(aux)/1e3; // (ANTEX in mm)
-					}
-				}
-				//Read non azimuth corrections
-				if(getL(line,&len,fd)!=-1) {
-					if (strncmp(&line[3],"NOAZI",5)==0) {
-						if (readingWhat==0) { // Satellite Antenna
-							for(i=0;i<sat.nzen;i++) {
-								getstr(aux,line,8+8*i,8);
-								sat.noazi[system][freqInd][i]=atof(aux)/1e3;  // (ANTEX in mm)
-							}
-						} else if (readingWhat==1) { // Receiver Antenna
-							for(i=0;i<ant.nzen;i++) {
-								getstr(aux,line,8+8*i,8);
-								ant.noazi[system][freqInd][i]=atof(aux)/1e3;  // (ANTEX in mm)
-							}
-						}
-					} else {
-						//Non azimuth corrections missing
-						properlyRead=0;
-					}
-				}
-				//Read azimuth corrections if available
-				if( (readingWhat==0 && sat.dazi>0) || (readingWhat==1 && ant.dazi>0) ) {
-					if (readingWhat==0) { // Satellite Antenna
-						for(i=0;i<sat.numazi;i++) {
-							if(getL(line,&len,fd)!=-1) {
-								for(j=0;j<sat.nzen;j++) {
-									getstr(aux,line,8+8*j,8);
-									sat.azi[system][freqInd][i][j]=atof(aux)/1e3;  // (ANTEX in mm)
-								}
-							} else {
-								properlyRead=0;
-								break;
-							}
-						}
-					} else if (readingWhat==1) { // Receiver Antenna
-						for(i=0;i<ant.numazi;i++) {
-							if(getL(line,&len,fd)!=-1) {
-								for(j=0;j<ant.nzen;j++) {
-									getstr(aux,line,8+8*j,8);
-									ant.azi[system][freqInd][i][j]=atof(aux)/1e3;  // (ANTEX in mm)
-								}
-							} else {
-								properlyRead=0;
-								break;
-							}
-						}
+	}
+}
 
+/*****************************************************************************
+ * Name        : readSINEX
+ * Description : Read a SINEX station positions file from a file descriptor
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TStationList  *stationList      O  N/A  Structure to save the station data
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1 => Properly read
+ *                                         0 => Error
+ *****************************************************************************/
+int readSINEX (FILE *fd, TStationList *stationList) {
+	char 	line[MAX_INPUT_LINE];
+	char	aux[100];
+	int 	len = 0;
+	int		section;	// =0 => Unimportant stuff
+						// =1 => SITE/ID section
+						// =2 => SOLUTION/ESTIMATE section
+	int 	properlyRead = 0;
+	int		auxN;
+	int		error = 0;
+	int		i=0;
+	char	prevName[5] = "";
+	
+	section = 0;
+	while(getL(line,&len,fd)!=-1) {
+		if (line[0]=='+') { // Change of section
+			if (strncmp(line,"+SITE/ID",8)==0) section = 1;
+			else if (strncmp(line,"+SOLUTION/ESTIMATE",18)==0) {
+				section = 2;
+				auxN = 0;
+				// Reserve memory for detected stations
+				stationList->station = malloc(sizeof(TStation)*stationList->n);
+			} else section = 0;
+		} else if (line[0]!='*' && line[0]!='-') {
+			if (section==1) {
+				stationList->n++;
+			} else if (section==2) {
+				getstr(aux,line,7,3);
+				if (strcmp(aux,"STA")==0) { // It is a station
+					properlyRead = 1; // Any station has been found
+					getstr(aux,line,14,4);
+					if (strcmp(prevName,aux)!=0) { // New station
+						auxN++;
+						strcpy(stationList->station[auxN-1].name,aux);
+						strcpy(prevName,aux);
 					}
-				}
-			} else if (strncmp(&line[60],"END OF ANTENNA",14)==0) {
-				if (readingWhat==0) { // Satellite Antenna
-					// Allocate memory
-					constellation->numSatellites ++;
-					constellation->sat = realloc(constellation->sat,sizeof(TConstellationElement)*constellation->numSatellites);
-						
-					// Store satellite
-					memcpy(&constellation->sat[constellation->numSatellites-1],&sat,sizeof(TConstellationElement));
-
-				} else if (readingWhat==1) { // Receiver Antenna
-					// Allocate memory
-					antennaList->numAnt ++;
-					antennaList->ant = realloc(antennaList->ant,sizeof(TAntenna)*antennaList->numAnt);
-					
-					// Store antenna
-					memcpy(&antennaList->ant[antennaList->numAnt-1],&ant,sizeof(TAntenna));
+					getstr(aux,line,46,23);
+					if (line[10]=='X') i=0;
+					else if (line[10]=='Y') i=1;
+					else if (line[10]=='Z') i=2;
+					else error = 1;
+					stationList->station[auxN-1].pos[i] = atof(aux);
 				}
 			}
 		}
 	}
 	
+	if (auxN!=stationList->n) error = 1; // Stations number not properly parsed
 	return (properlyRead && !error); // properly read AND no error
 }
 
 /*****************************************************************************
- * Name        : readAntexFile
- * Description : Read an ANTEX file from a filename
+ * Name        : readSINEXFile
+ * Description : Read a SINEX station positions file from a filename
  * Parameters  :
  * Name                           |Da|Unit|Description
  * char  *filename                 I  N/A  Name of the file
- * TConstellation  *constellation  O  N/A  Structure to save the data of GNSS satellites
- * TAntennaList *antennaList       O  N/A  Structure to save the data of receiver 
- *                                         antennas
+ * TStationList  *stationList      O  N/A  Structure to save the station data
  * Returned value (int)            O  N/A  Status of the function
  *                                         1  => File open and properly read
  *                                         0  => File open and failed to read
  *                                         -1 => File not open
  *****************************************************************************/
-int readAntexFile (char *filename, TConstellation *constellation, TAntennaList *antennaList) {
+int readSINEXFile (char *filename, TStationList *stationList) {
 	FILE	*fd;
 	int		ret;
 	
-	if (whatFileTypeIs(filename)!=ftANTEX) return 0;
+	if (whatFileTypeIs(filename)!=ftSINEX) return 0;
 	
-	if ((fd = fopen(filename,"rb"))) {
-		ret = readAntex (fd, constellation, antennaList);
+	if ((fd = openInputFile(filename))) {
+		ret = readSINEX (fd, stationList);
 		fclose(fd);
 		return ret;
 	} else {
@@ -5824,434 +8656,1029 @@ int readAntexFile (char *filename, TConstellation *constellation, TAntennaList *
 }
 
 /*****************************************************************************
- * Name        : readDCB
- * Description : Read a DCB file from a file descriptor
+ * Name        : readSBASFile
+ * Description : Read a SBAS file from a filename
  * Parameters  :
  * Name                           |Da|Unit|Description
- * FILE  *fd                       I  N/A  File descriptor
- * TDCBdata  *DCB                  O  N/A  Structure to save the DCB data
+ * char  *filename                 I  N/A  Name of the file
+ * char  *indexfilename            I  N/A  Name of the time index file of the
+ *                                         SBAS file (empty if not used)
+ * TSBASdatabox *SBASdatabox       O  N/A  Structure to save SBAS data
+ * double *rinexVersion            O  N/A  Rinex file version
+ * TTime *currentepoch             I  N/A  Current epoch
+ * TOptions  *options              I  N/A  TOptions structure
  * Returned value (int)            O  N/A  Status of the function
- *                                          1 => Properly read
- *                                          0 => Error
- *                                         -2 => First header line not recognized
+ *                                         1  => File open and properly read
+ *                                         0  => File open and failed to read
+ *                                         -1 => File not open
+ *                                         -2 => File open but reached end of
+ *                                               file before getting to current
+ *                                               epoch
  *****************************************************************************/
-int readDCB (FILE *fd, TDCBdata *DCB) {
-	char 					line[MAX_INPUT_LINE];
-	char					*pt;
-	char					*ptaux;
-	char    				aux[100];
-	enum MeasurementType	meas;
-	enum GNSSystem			GNSS;
-	double					value;
-	double					rms;
-	int 					len = 0;
-	struct tm				tm;
-	int						properlyRead = 0;
-	int						readingHeader = 1;
-	int						firstLineHeaderFound = 0;
-	int						PRN;
-	int						writtingAbs;
-	int						year,doy;
-	double					factor;
-	
-	tm.tm_hour = 0;
-	tm.tm_min = 0;
-	tm.tm_sec = 0;
-	tm.tm_mday = 1;
+int readSBASFile (char *filename, char *indexfilename, TSBASdatabox *SBASdatabox, double *rinexVersion, TTime *currentepoch, TOptions  *options) {
+	static FILE 			*fd;
+	static FILE				*fdlist[18];
+	static enum fileType 	sbasfile;
+	int 					ret;
+	int						firstcall=0;
+	static int				prevday=0;
+	static int				initialized=0;
+	static int				filesclosed=0;
+	static int				seekchecked=0;
+	static char				*filelist[18];
 	
-	while(getL(line,&len,fd)!=-1) {
-		if (readingHeader) {
-			if ((pt=strstr(line,"YEAR-MONTH"))!=NULL) {
-				// CODE'S MONTHLY GPS P1-C1 DCB SOLUTION, YEAR-MONTH 10-01          04-FEB-10 20:11
-				firstLineHeaderFound=1;
-				DCB->n++;
-				pt += 11; // Pointing to '10-01 [...]'
-				getstr(aux,pt,0,2);
-				tm.tm_year = atoi(aux);
-				if (tm.tm_year <= 70) tm.tm_year += 100;
-				getstr(aux,pt,3,2);
-				tm.tm_mon = atoi(aux) - 1;
-				DCB->block[DCB->n-1].startTime.MJDN = MJDN(&tm);
-				tm.tm_mon ++;
-				DCB->block[DCB->n-1].endTime.MJDN = MJDN(&tm);
+	if(initialized==0) {
+		firstcall=1;
+		sbasfile=whatFileTypeIs(filename);
+		if (sbasfile!=ftRINEXB && sbasfile!=ftSBASEMSMESSAGE) return 0;
+
+		//Check if any SBAS data file has to be written
+		if (sbasfile==ftRINEXB) {
+			ret=openSBASwritefiles(fdlist,filelist,filename,0,options);
+		} else {
+			ret=openSBASwritefiles(fdlist,filelist,filename,1,options);
+		}
+
+		//If any output file failed to open, exit with errors
+		if(ret!=1) return ret;
+
+		//Open SBAS file to be read
+		fd = openInputFile(filename);
+		if(fd==NULL) {
+			// File do not exist
+			return -1;
+		}
+
+		initialized=1;
+	}
+
+	if(seekchecked==0 && currentepoch->MJDN!=-1 && fd!=NULL) {
+		//First epoch to process. If the header has already been read in a previous call, skip the messages older
+		//than SBASseektime seconds before the current epoch which are not needed for the current SBAS data, so they
+		//are not decoded. This is not done when SBAS data files are written or in SBAS plots mode, as all the file has to be read
+		seekchecked=1;
+		if (firstcall==0 && options->SBASseektime>0 && options->onlyconvertSBAS==0 && options->onlySBASplots==0
+				&& (options->writeRinexBfile+options->writeEMSfile+options->writePegasusfile)==0) {
+			seekSBASFile(fd,filename,indexfilename,sbasfile,SBASdatabox,currentepoch,options);
+		}
+	}
+
+	if(sbasfile==ftRINEXB && fd!=NULL) {
+		ret=readRINEXB(fd,fdlist,filelist,SBASdatabox,rinexVersion,&prevday,currentepoch,options);
+
+	} else if(sbasfile==ftSBASEMSMESSAGE && fd!=NULL){
+		//If we are going to process data, the first call to this function will be just for opening files and reading header
+		if(currentepoch->MJDN==-1 && options->onlyconvertSBAS==0) {
+			if (options->workMode != wmSBASPLOTS) return 1;
+		}
+
+		//SBAS EMS message file
+		*rinexVersion=0; //There is no RINEX version here, we set the value to 0
+		ret=readEMS(fd,fdlist,filelist,SBASdatabox,&prevday,currentepoch,options);
+	}
+
+	if(fd!=NULL && filesclosed==0) {
+		if (feof(fd)>0) {
+			//Reached end of file
+			filesclosed=1;
+			fclose(fd);
+			fd=NULL;
+			closefiles(fdlist,18);	//Close all other files
+			if(prevday==0 && options->writePegasusfile==1) {
+				//No data was written in the RINEX H file for the previous day
+				//But we have generated one with the header. We need to erase it.
+				remove(filelist[fdEPHEMERISPREVDAY]);
+			}
+		}
+	} else if (fd==NULL) {
+		//Reached end of file and files are already closed.
+		return -2;
+	}
+
+	return ret;
+}
+
+/*****************************************************************************
+ * Name        : getSBASmessageheader
+ * Description : Read the PRN and the time of applicability of a SBAS message
+ *               from its first line in a EMS or RINEX-B file. For EMS files, 
+ *               the message type is also read. For RINEX-B files, the frequency,
+ *               data length, receiver index and source identifier are also read
+ *               (if they are given)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char  *line                     I  N/A  First line of the message
+ * int  len                        I  N/A  Length of the line
+ * enum fileType sbasfile          I  N/A  Type of SBAS file (EMS or RINEX-B)
+ * TSBASblock  *sbasblock          O  N/A  TSBASblock structure
+ *****************************************************************************/
+void getSBASmessageheader (char *line, int len, enum fileType sbasfile, TSBASblock *sbasblock) {
+	char		aux[100];
+	double		seconds;
+	struct tm	tm;
+
+	getstr(aux,line,0,3);
+	sbasblock->PRN = atoi(aux);		//PRN
+	getstr(aux,line,4,2);
+	tm.tm_year = atoi(aux);			//Year
+	if (tm.tm_year <= 70) tm.tm_year += 100;
+	getstr(aux,line,7,2);
+	tm.tm_mon  = atoi(aux)-1;		//Month
+	getstr(aux,line,10,2);
+	tm.tm_mday = atoi(aux);			//Day
+	getstr(aux,line,13,2);
+	tm.tm_hour = atoi(aux);			//Hour
+	getstr(aux,line,16,2);
+	tm.tm_min  = atoi(aux);			//Minute
+
+	if (sbasfile==ftRINEXB) {
+		getstr(aux,line,18,5);
+		tm.tm_sec  = atoi(aux);		//Seconds,in time of reception of first bit 
+		seconds=atof(aux);
+		sbasblock->t.MJDN = MJDN(&tm);
+		sbasblock->t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds +1.;	//Seconds in time of applicability (1 second later)
+		//Check if RINEXB has the 0.1 second due to flight time. If it isn't, add it
+		if ((double)((int)(sbasblock->t.SoD))==sbasblock->t.SoD) {
+			sbasblock->t.SoD+=.1;
+		}
+		if (len>=45) {
+			getstr(aux,line,26,1);
+			sbasblock->frequency=atoi(aux);				//Frequency number
+			getstr(aux,line,30,3);
+			sbasblock->datalength=atoi(aux);			//Data message length 
+			getstr(aux,line,36,3);
+			sbasblock->receiverindex=atoi(aux);			//Receiver index
+			getstr(aux,line,42,3);
+			strcpy(sbasblock->sourceidentifier,aux); 	//Source identifier
+		}
+	} else {
+		getstr(aux,line,19,2);
+		tm.tm_sec  = atoi(aux);		//Seconds,in time of applicability 
+		seconds=atof(aux);
+		sbasblock->t.MJDN = MJDN(&tm);
+		sbasblock->t.SoD = (double)(tm.tm_hour*3600 + tm.tm_min*60) + seconds + 0.1;	//Seconds in time of applicability (0.1 seconds corresponds to travel time)
+		getstr(aux,line,22,2);
+		sbasblock->messagetype=atoi(aux);	//Message type
+	}
+
+	if(sbasblock->t.SoD>=86400.) {
+		//After adding the seconds to the time of applicability, we have gone to the next day
+		sbasblock->t.MJDN=sbasblock->t.MJDN+1;
+		sbasblock->t.SoD=sbasblock->t.SoD-86400.;
+	}
+}
+
+/*****************************************************************************
+ * Name        : readRINEXBdatalines
+ * Description : Read the data lines of a SBAS message in a RINEX-B file (the 
+ *               lines after the first line of the message)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * FILE  *fd                       I  N/A  File descriptor
+ * TSBASblock  *sbasblock          IO N/A  TSBASblock structure (the data length
+ *                                         is read, the message type is written)
+ * char  *hexstring                O  N/A  Message in hexadecimal
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1  => All data lines read
+ *                                         0  => Reached end of file
+ *****************************************************************************/
+int readRINEXBdatalines (FILE *fd, TSBASblock *sbasblock, char *hexstring) {
+	char	line[MAX_INPUT_LINE];
+	char	aux[100];
+	int		len=0;
+	int		i;
+	int		row=1;
+	int		numberofdatalines;
+	int		numberofcolumns;
+
+	//Compute the number of data lines (there are 18 bytes of message per line)
+	numberofdatalines=sbasblock->datalength/18;
+	if(sbasblock->datalength%18!=0) numberofdatalines++;
+
+	hexstring[0]='\0';
+	while(row<=numberofdatalines) {
+		if (getL(line,&len,fd)==-1) return 0;
+		if(line[0]=='\n' || line[0]=='\r') continue;	//Skip blank lines
+		if (row==1) {
+			getstr(aux,line,1,2);
+			sbasblock->messagetype=atoi(aux);	//Message type
+		}
+		//Compute the number of records (columns) in the current line (normally the last one is not full)
+		if(row==numberofdatalines) {
+			numberofcolumns=sbasblock->datalength%18;
+		} else {
+			numberofcolumns=18;
+		}
+		for(i=0;i<numberofcolumns;i++) {
+			getstr(&hexstring[18*2*(row-1)+2*i],line,7+3*i,2);
+		}
+		row++;
+	}
+
+	return 1;
+}
 
-			} else if ((pt=strstr(line,"YEAR "))!=NULL) { //From 1 January 2012 the date format has been changed in the DCB header
-				// CODE'S MONTHLY GPS P1-C1 DCB SOLUTION, YEAR 2014, MONTH 05       04-JUN-14 07:46
-				firstLineHeaderFound=1;
-				DCB->n++;
-				pt += 5; // Pointing to year number
-				getstr(aux,pt,0,4);
-				tm.tm_year = atoi(aux) -1900;
-				pt += 12; // Pointing to month number
-				getstr(aux,pt,0,2);
-				tm.tm_mon = atoi(aux) - 1;
-				DCB->block[DCB->n-1].startTime.MJDN = MJDN(&tm);
-				tm.tm_mon ++;
-				DCB->block[DCB->n-1].endTime.MJDN = MJDN(&tm);
+/*****************************************************************************
+ * Name        : updateSBASindexKey
+ * Description : Save the file position of a valid message in the data of a
+ *               GEO used for building the SBAS index. Each key keeps the 
+ *               position of its last messages (as many as its depth) and the
+ *               position of the last message of each issue of data is saved
+ *               for each group
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSBASindexGEO *geo              IO N/A  Data of the GEO
+ * int  group                      I  N/A  Group of messages (message type or SBASINDEXANYMESSAGE)
+ * int  part                       I  N/A  Part of the data of the group updated by the message
+ * int  version                    I  N/A  Issue of data of the message (-1 if the message has no issue of data)
+ * int  depth                      I  N/A  Number of messages to be kept
+ * long  offset                    I  N/A  File position of the message
+ *****************************************************************************/
+void updateSBASindexKey (TSBASindexGEO *geo, int group, int part, int version, int depth, long offset) {
+	int				i;
+	int				pos;
+	TSBASindexKey	*key;
 
-			} else if ((pt=strstr(line,"ENDING DAY"))!=NULL) { //From somewhere around 2017 the date format has been changed in the DCB header
-				// CODE'S 30-DAY GPS P1-C1 DCB SOLUTION, ENDING DAY 306, 2017       06-NOV-17 06:45
-				firstLineHeaderFound=1;
-				DCB->n++;
-				pt += 11; // Pointing to doy
-				getstr(aux,pt,0,3);
-				doy=atoi(aux);
-				pt += 5; // Pointing to year
-				getstr(aux,pt,0,4);
-				year=atoi(aux);
-				DCB->block[DCB->n-1].endTime.MJDN = yeardoy2MJDN(year,doy,0);
-				DCB->block[DCB->n-1].startTime.MJDN = DCB->block[DCB->n-1].endTime.MJDN-30;
+	if (part<0 || part>=SBASINDEXMAXPARTS || version<-1 || version>=SBASINDEXMAXVERSIONS-1) return;
 
-			} else if (strstr(line,"CODE BIASES")!=NULL) {
-				if (firstLineHeaderFound==0) return -2;
-				// DIFFERENTIAL (P1-C1) CODE BIASES FOR SATELLITES AND RECEIVERS:
-				pt = strstr(line,"(");
-				if (pt==NULL) return 0;
-				pt++;
-				ptaux = strstr(pt,"-");
-				if (ptaux==NULL) return 0;
-				strncpy(aux,pt,ptaux-pt);
-				aux[ptaux-pt]='\0';
-				meas = measstr2meastype(aux);
-				DCB->block[DCB->n-1].measTo = meas;
-				pt=ptaux+1;
-				ptaux = strstr(pt,")");
-				if (ptaux==NULL) return 0;
-				strncpy(aux,pt,ptaux-pt);
-				aux[ptaux-pt]='\0';
-				meas = measstr2meastype(aux);
-				DCB->block[DCB->n-1].measFrom = meas;
-				// Check to create the absolute measurement (from P1 to NA)
-				if ((DCB->block[DCB->n-1].measFrom==C2P && DCB->block[DCB->n-1].measTo==C1P) || (DCB->block[DCB->n-1].measFrom==C1P && DCB->block[DCB->n-1].measTo==C2P)) {
-					DCB->block[DCB->n].measFrom = C1P;
-					DCB->block[DCB->n].measTo = NA;
-					memcpy(&DCB->block[DCB->n].startTime,&DCB->block[DCB->n-1].startTime,sizeof(TTime));
-					memcpy(&DCB->block[DCB->n].endTime,&DCB->block[DCB->n-1].endTime,sizeof(TTime));
-					factor = 1.0/(1.0-(GPSf1*GPSf1)/(GPSf2*GPSf2)); // 1/(1-f1^2/f2^2)
-					if (DCB->block[DCB->n-1].measFrom==C2P) factor*= -1.0;
-					writtingAbs = 1;
-				} else {
-					writtingAbs = 0;
-				}
-			} else if (strncmp(line,"PRN / STATION NAME",18)==0) {
-				// PRN / STATION NAME        VALUE (NS)  RMS (NS)
-				// ***   ****************    *****.***   *****.***
-				if (firstLineHeaderFound==0) return -2;
-				if (getL(line,&len,fd)==-1) {
-					return 0;
+	if (geo->keypos[group]==NULL) {
+		geo->keypos[group]=malloc(sizeof(int)*SBASINDEXMAXPARTS*SBASINDEXMAXVERSIONS);
+		for(i=0;i<SBASINDEXMAXPARTS*SBASINDEXMAXVERSIONS;i++) {
+			geo->keypos[group][i]=-1;
+		}
+	}
+
+	pos=geo->keypos[group][part*SBASINDEXMAXVERSIONS+version+1];
+	if (pos==-1) {
+		//First message of the key
+		pos=geo->numKeys;
+		geo->numKeys++;
+		geo->key=realloc(geo->key,sizeof(TSBASindexKey)*geo->numKeys);
+		geo->key[pos].depth=depth;
+		geo->key[pos].numOffsets=0;
+		geo->key[pos].lastOffset=-1;
+		geo->key[pos].offset=malloc(sizeof(long)*depth);
+		geo->keypos[group][part*SBASINDEXMAXVERSIONS+version+1]=pos;
+	}
+
+	key=&geo->key[pos];
+	key->lastOffset=mod(key->lastOffset+1,key->depth);
+	key->offset[key->lastOffset]=offset;
+	if (key->numOffsets<key->depth) key->numOffsets++;
+
+	geo->lastversion[group][version+1]=offset;
+}
+
+/*****************************************************************************
+ * Name        : getSBASindexStart
+ * Description : Compute the file position of the first message to be decoded
+ *               for having the same SBAS data as when decoding all the
+ *               messages read while building the SBAS index. For each GEO and
+ *               group of messages, the kept messages of the keys of the two 
+ *               last issues of data (the current and the previous one, which
+ *               are the ones kept by the decoder) are needed. The position is
+ *               also moved back if it is inside a data gap of a GEO (or of 
+ *               all GEOs), as the data gap would not be detected otherwise
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSBASindexGEO **geo             I  N/A  Data of each GEO (NULL if the GEO has no messages)
+ * long  offset                    I  N/A  File position of the next message
+ * Returned value (long)           O  N/A  File position of the first message to be decoded
+ *****************************************************************************/
+long getSBASindexStart (TSBASindexGEO **geo, long offset) {
+	int				i,j,k,l,m;
+	int				changed;
+	int				version[2];
+	long			start=offset;
+	long			needed;
+	TSBASindexKey	*key;
+
+	for(i=1;i<MAX_SBAS_PRN;i++) {
+		if (geo[i]==NULL) continue;
+		if (geo[i]->lastversion[SBASINDEXANYMESSAGE][0]==-1) {
+			//No valid messages from this GEO. All its messages are needed for counting the consecutive invalid messages
+			if (geo[i]->firstmessage<start) start=geo[i]->firstmessage;
+			continue;
+		}
+		for(j=0;j<SBASINDEXNUMGROUPS;j++) {
+			if (geo[i]->keypos[j]==NULL) continue;
+			//Look for the two last issues of data
+			version[0]=version[1]=-1;
+			for(k=0;k<SBASINDEXMAXVERSIONS;k++) {
+				if (geo[i]->lastversion[j][k]==-1) continue;
+				if (version[0]==-1 || geo[i]->lastversion[j][k]>geo[i]->lastversion[j][version[0]]) {
+					version[1]=version[0];
+					version[0]=k;
+				} else if (version[1]==-1 || geo[i]->lastversion[j][k]>geo[i]->lastversion[j][version[1]]) {
+					version[1]=k;
 				}
-				readingHeader = 0;
 			}
-		} else { //readingHeader == 0
-			GNSS = gnsschar2gnsstype(line[0]);
-			getstr(aux,line,1,2);
-			PRN = atoi(aux);
-			if (PRN != 0) { // Satellite unidentified or blank line
-				properlyRead = 1;
-				getstr(aux,line,26,9);
-				value = atof(aux);
-				getstr(aux,line,38,9);
-				rms = atof(aux);
-				// From ns to meters
-				value *= 1e-9*c0;
-				rms *= 1e-9*c0;
-				DCB->block[DCB->n-1].dcb[GNSS][PRN] = value;
-				DCB->block[DCB->n-1].available[GNSS][PRN] = 1;
-				if (writtingAbs) {
-					DCB->block[DCB->n].dcb[GNSS][PRN] = value*factor;
-					DCB->block[DCB->n].available[GNSS][PRN] = 1;
+			for(k=0;k<2;k++) {
+				if (version[k]==-1) continue;
+				for(l=0;l<SBASINDEXMAXPARTS;l++) {
+					m=geo[i]->keypos[j][l*SBASINDEXMAXVERSIONS+version[k]];
+					if (m==-1) continue;
+					key=&geo[i]->key[m];
+					//Oldest message kept. If less messages than the depth have been read, it is the first message of the key
+					if (key->numOffsets<key->depth) needed=key->offset[0];
+					else needed=key->offset[mod(key->lastOffset+1,key->depth)];
+					if (needed<start) start=needed;
 				}
 			}
 		}
 	}
-	if (writtingAbs) DCB->n++;
-	
-	return properlyRead;
+
+	//Move the position back while it is just after a data gap. The data gaps are sorted by position
+	do {
+		changed=0;
+		for(i=0;i<MAX_SBAS_PRN;i++) {
+			if (geo[i]==NULL) continue;
+			for(j=geo[i]->numGaps-1;j>=0;j--) {
+				if (geo[i]->gapend[j]<start) break;
+				if (geo[i]->gapstart[j]<start) {
+					start=geo[i]->gapstart[j];
+					changed=1;
+					break;
+				}
+			}
+		}
+	} while(changed==1);
+
+	return start;
 }
 
 /*****************************************************************************
- * Name        : readDCBFile
- * Description : Read a DCB file from a filename
+ * Name        : buildSBASindex
+ * Description : Build the time index of a SBAS file (EMS or RINEX-B). The 
+ *               messages are decoded, but the SBAS data is not updated. Each
+ *               entry saves the file position of the first message with time
+ *               equal or greater than the time of the entry, and the position
+ *               of the first message to be decoded for having the same SBAS 
+ *               data at the time of the entry as when decoding all the file.
+ *               The index is built from the current position of the file 
+ *               descriptor, which is restored at the end. If a last time is
+ *               given, the file is only read until the first message after
+ *               that time
  * Parameters  :
  * Name                           |Da|Unit|Description
- * char  *filename                 I  N/A  Name of the file
- * TDCBdata  *DCB                  O  N/A  Structure to save the DCB data
+ * FILE  *fd                       I  N/A  File descriptor
+ * enum fileType sbasfile          I  N/A  Type of SBAS file (EMS or RINEX-B)
+ * TTime *lastTime                 I  N/A  Last time needed in the index (NULL to index all the file)
+ * TSBASindex *index               O  N/A  Time index of the SBAS file
+ * TOptions  *options              I  N/A  TOptions structure
  * Returned value (int)            O  N/A  Status of the function
- *                                          1 => File open and properly read
- *                                          0 => File open and failed to read
- *                                         -1 => File not open
- *                                         -2 => First header line not recognized
+ *                                         1  => Index built
+ *                                         0  => Error
  *****************************************************************************/
-int readDCBFile (char *filename, TDCBdata *DCB) {
-	FILE		*fd;
-	int 		ret;
-	enum fileType	ft;
-	
-  ft = whatFileTypeIs(filename);
+int buildSBASindex (FILE *fd, enum fileType sbasfile, TTime *lastTime, TSBASindex *index, TOptions *options) {
+	char			line[MAX_INPUT_LINE];
+	char			hexstring[300];
+	char			binarystring[2400];
+	char			aux[10];
+	int				len=0;
+	int				i,j,k,l;
+	int				readingHeader=0;
+	int				maxEntries=0;
+	int				decoderesult;
+	int				decodedmessagetype=0;
+	int				messagesmissing=0;
+	int				numMsgLost;
+	long			startpos,linepos;
+	double			diff;
+	TSBASblock		sbasblock;
+	TSBASindexGEO	*geo[MAX_SBAS_PRN];
 
-	if (ft!=ftP1C1DCB && ft!=ftP1P2DCB) return 0;
+	index->numEntries=0;
+	index->offset=NULL;
+	index->start=NULL;
+	index->numGEO=0;
 
-	if ((fd = fopen(filename,"rb"))) {
-		ret = readDCB (fd, DCB);
-		fclose(fd);
-		return ret;
-	} else {
-		// File do not exist
-		return -1;
+	startpos=ftell(fd);
+	if (startpos<0) return 0;
+
+	for(i=0;i<MAX_SBAS_PRN;i++) {
+		geo[i]=NULL;
+	}
+
+	while(1) {
+		linepos=ftell(fd);
+		if (getL(line,&len,fd)==-1) break;
+		if(line[0]=='\n' || line[0]=='\r') continue;	//Skip blank lines
+
+		if (sbasfile==ftRINEXB) {
+			//Skip header lines (a new header may be found in the middle of the file)
+			if (len>=80 && strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) readingHeader=1;
+			if (readingHeader==1) {
+				if (len>=73 && strncmp(&line[60],"END OF HEADER",13)==0) readingHeader=0;
+				continue;
+			}
+		} else if (len<88) {
+			//Data line too short. The reader will stop at this line
+			break;
+		}
+
+		initSBASblock(&sbasblock);
+		getSBASmessageheader(line,len,sbasfile,&sbasblock);
+		if (sbasfile==ftRINEXB) {
+			if (sbasblock.frequency!=1) {
+				//Message not from L1. Skip the two following lines of the current message
+				if (getL(line,&len,fd)==-1) break;
+				if (getL(line,&len,fd)==-1) break;
+				continue;
+			}
+			//Read the data lines of the current message
+			if (readRINEXBdatalines(fd,&sbasblock,hexstring)==0) break;
+		} else if(sbasblock.messagetype<10) {
+			getstr(hexstring,line,24,64);
+		} else {
+			getstr(hexstring,line,25,64);
+		}
+		if (index->numEntries==0) {
+			//The first entry starts at the time of the first message, rounded down to the index step
+			index->t.MJDN=sbasblock.t.MJDN;
+			index->t.SoD=(double)(((int)sbasblock.t.SoD/SBASINDEXSTEP)*SBASINDEXSTEP);
+		}
+
+		//Fill all the entries which have not been filled yet and have a time equal or lower than the time of the message
+		diff=tdiff(&sbasblock.t,&index->t);
+		while((double)(index->numEntries*SBASINDEXSTEP)<=diff) {
+			if (index->numEntries==maxEntries) {
+				maxEntries+=86400/SBASINDEXSTEP;
+				index->offset=realloc(index->offset,sizeof(long)*maxEntries);
+				index->start=realloc(index->start,sizeof(long)*maxEntries);
+			}
+			index->offset[index->numEntries]=linepos;
+			index->start[index->numEntries]=getSBASindexStart(geo,linepos);
+			index->numEntries++;
+		}
+
+		//The entries up to the time of the message are filled, so the entry of the last time needed is already in the index
+		if (lastTime!=NULL && tdiff(&sbasblock.t,lastTime)>0.) break;
+
+		if (sbasblock.PRN<=0 || sbasblock.PRN>=MAX_SBAS_PRN) continue;
+
+		//Save the data gaps of all GEOs (position 0) and of the GEO of the message
+		for(i=0;i<2;i++) {
+			j=i==0?0:sbasblock.PRN;
+			if (geo[j]==NULL) {
+				geo[j]=malloc(sizeof(TSBASindexGEO));
+				geo[j]->numKeys=0;
+				geo[j]->key=NULL;
+				for(k=0;k<SBASINDEXNUMGROUPS;k++) {
+					geo[j]->keypos[k]=NULL;
+					for(l=0;l<SBASINDEXMAXVERSIONS;l++) {
+						geo[j]->lastversion[k][l]=-1;
+					}
+				}
+				geo[j]->firstmessage=linepos;
+				geo[j]->numGaps=0;
+				geo[j]->gapstart=NULL;
+				geo[j]->gapend=NULL;
+			} else {
+				//SBAS messages are sent every second
+				numMsgLost=(int)(tdiff(&sbasblock.t,&geo[j]->lastmessagetime)+.00005)-1;
+				if (numMsgLost>=1) {
+					geo[j]->numGaps++;
+					geo[j]->gapstart=realloc(geo[j]->gapstart,sizeof(long)*geo[j]->numGaps);
+					geo[j]->gapend=realloc(geo[j]->gapend,sizeof(long)*geo[j]->numGaps);
+					geo[j]->gapstart[geo[j]->numGaps-1]=geo[j]->lastmessage;
+					geo[j]->gapend[geo[j]->numGaps-1]=linepos;
+				}
+			}
+			geo[j]->lastmessage=linepos;
+			geo[j]->lastmessagetime=sbasblock.t;
+		}
+
+		//Convert the hexadecimal string to a binary string (1 bit per byte)
+		strhextostrbin(hexstring,binarystring);
+
+		//Decode message
+		decoderesult=readSBASmessage(binarystring,sbasblock.messagetype,&decodedmessagetype,&sbasblock,&messagesmissing,options);
+
+		if (decoderesult>=0) {
+			if (geo[sbasblock.PRN]->lastversion[SBASINDEXANYMESSAGE][0]==-1) {
+				//First valid message of the GEO
+				index->GEOPRN[index->numGEO]=sbasblock.PRN;
+				index->GEOoffset[index->numGEO]=linepos;
+				index->numGEO++;
+			}
+			updateSBASindexKey(geo[sbasblock.PRN],SBASINDEXANYMESSAGE,0,-1,1,linepos);
+
+			//Save the keys of the data updated by the message. Fast corrections are saved in a buffer of MAXSBASFASTCORR
+			//values, so the last MAXSBASFASTCORR messages of each message type with fast corrections are kept
+			switch(sbasblock.messagetype) {
+				case(DONTUSE):
+					updateSBASindexKey(geo[sbasblock.PRN],DONTUSE,0,-1,1,linepos);
+					if (sbasblock.problems==0) {
+						//The message may be read as a type 2 message
+						getstr(aux,binarystring,16,2);
+						updateSBASindexKey(geo[sbasblock.PRN],FASTCORRECTIONS2,DONTUSE,(int)strtol(aux,NULL,2),MAXSBASFASTCORR,linepos);
+					}
+					break;
+				case(PRNMASKASSIGNMENTS):case(FASTCORRECTIONSDEGRADATIONFACTOR):
+					updateSBASindexKey(geo[sbasblock.PRN],sbasblock.messagetype,0,sbasblock.IODP,1,linepos);
+					break;
+				case(FASTCORRECTIONS2):case(FASTCORRECTIONS3):case(FASTCORRECTIONS4):case(FASTCORRECTIONS5):
+					updateSBASindexKey(geo[sbasblock.PRN],FASTCORRECTIONS2,sbasblock.messagetype,sbasblock.IODP,MAXSBASFASTCORR,linepos);
+					break;
+				case(INTEGRITYINFO):case(GEONAVIGATIONMESSAGE):case(DEGRADATIONPARAMETERS):case(GEOSATELLITEALMANACS):
+					//The values of the previous message are also saved
+					updateSBASindexKey(geo[sbasblock.PRN],sbasblock.messagetype,0,-1,2,linepos);
+					break;
+				case(SBASNETWORKTIMEPARAMETERS):
+					updateSBASindexKey(geo[sbasblock.PRN],sbasblock.messagetype,0,-1,1,linepos);
+					break;
+				case(IONOSPHERICGRIDPOINTSMASKS):
+					updateSBASindexKey(geo[sbasblock.PRN],sbasblock.messagetype,sbasblock.igpmaskmessage[BANDNUMBER],sbasblock.igpmaskmessage[IODIPOS],1,linepos);
+					break;
+				case(IONOSPHERICDELAYCORRECTIONS):
+					updateSBASindexKey(geo[sbasblock.PRN],sbasblock.messagetype,(int)sbasblock.ionodelayparameters[0][BANDNUMBER]*14+(int)sbasblock.ionodelayparameters[0][BLOCKID],(int)sbasblock.ionodelayparameters[0][IODIPOS],1,linepos);
+					break;
+				case(SBASSERVICEMESSAGE):
+					updateSBASindexKey(geo[sbasblock.PRN],sbasblock.messagetype,(int)sbasblock.servicemessage[SERVICEMESSAGENUMBER],(int)sbasblock.servicemessage[IODSPOS],1,linepos);
+					break;
+				case(CLOCKEPHEMERISCOVARIANCEMATRIX):
+					for(i=0;i<sbasblock.numclockephemeriscovariance;i++) {
+						if(sbasblock.clockephemeriscovariance[i][PRNMASKNUMBER]==0) continue; //PRNMASKNUMBER=0 means that there is no valid data
+						updateSBASindexKey(geo[sbasblock.PRN],sbasblock.messagetype,(int)sbasblock.clockephemeriscovariance[i][PRNMASKNUMBER],(int)sbasblock.clockephemeriscovariance[0][IODPPOSITION],1,linepos);
+					}
+					break;
+				case(MIXEDFASTLONGTERMCORRECTIONS):case(LONGTERMSATELLITECORRECTIONS):
+					if (sbasblock.messagetype==MIXEDFASTLONGTERMCORRECTIONS) {
+						updateSBASindexKey(geo[sbasblock.PRN],FASTCORRECTIONS2,FASTCORRECTIONS5+sbasblock.BlockID,sbasblock.IODP,MAXSBASFASTCORR,linepos);
+					}
+					//Long term corrections of messages type 24 and 25 are saved in the same data
+					for(i=0;i<sbasblock.numlongtermsaterrcorrections;i++) {
+						if(sbasblock.longtermsaterrcorrections[i][PRNMASKNUMBER]==0) continue; //PRNMASKNUMBER=0 means that there is no valid data
+						updateSBASindexKey(geo[sbasblock.PRN],LONGTERMSATELLITECORRECTIONS,(int)sbasblock.longtermsaterrcorrections[i][PRNMASKNUMBER],(int)sbasblock.longtermsaterrcorrections[0][IODPPOSITION],1,linepos);
+					}
+					break;
+				default:
+					//Messages with no data
+					break;
+			}
+		}
+
+		if (decoderesult>0 || decoderesult<-3) {
+			//Only free sbasblock messagetype memory if we have allocated memory
+			freeSBASblock(sbasblock.messagetype,&sbasblock,options);
+		}
+	}
+
+	clearerr(fd);
+	fseek(fd,startpos,SEEK_SET);
+
+	for(i=0;i<MAX_SBAS_PRN;i++) {
+		if (geo[i]==NULL) continue;
+		for(j=0;j<geo[i]->numKeys;j++) {
+			free(geo[i]->key[j].offset);
+		}
+		for(j=0;j<SBASINDEXNUMGROUPS;j++) {
+			free(geo[i]->keypos[j]);
+		}
+		free(geo[i]->key);
+		free(geo[i]->gapstart);
+		free(geo[i]->gapend);
+		free(geo[i]);
 	}
+
+	return 1;
 }
 
 /*****************************************************************************
- * Name        : readRecType
- * Description : Read a GPS Receiver type file from a file descriptor
+ * Name        : readSBASindexFile
+ * Description : Read the time index of a SBAS file previously saved to disk
  * Parameters  :
  * Name                           |Da|Unit|Description
- * FILE  *fd                       I  N/A  File descriptor
- * TReceiverList  *recList         O  N/A  Structure to save the Receiver data
+ * char  *filename                 I  N/A  Name of the index file
+ * TSBASindex *index               O  N/A  Time index of the SBAS file
  * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Properly read
- *                                         0 => Error
+ *                                         1  => File open and properly read
+ *                                         0  => File not open, failed to read
+ *                                               or saved with another format
  *****************************************************************************/
-int readRecType (FILE *fd, TReceiverList *recList) {
-	char 		line[MAX_INPUT_LINE];
-	char		cr;
-	char   		aux[100];
-	int 		len = 0;
-	
-	while(getL(line,&len,fd)!=-1) {
-		if (line[0]!='#') { // Line is not a comment
-			getstr(aux,line,0,20);
-			if (aux[0]!='\0' && aux[0]!='\n') {
-				recList->n++;
-				recList->rec = realloc(recList->rec,sizeof(TReceiverData)*recList->n);
-				strcpy(recList->rec[recList->n-1].name,aux);
-				cr = line[21];
-				switch (cr) {
-					case '0':
-						recList->rec[recList->n-1].type = rtUNKNOWN;
-						break;
-					case '1':
-						recList->rec[recList->n-1].type = rtCROSS;
-						break;
-					case '2':
-						recList->rec[recList->n-1].type = rtNOP1;
-						break;
-					case '3':
-						recList->rec[recList->n-1].type = rtNOMINAL;
-						break;
-					default:
-						recList->rec[recList->n-1].type = rtUNKNOWN;
-				}
-			}
+int readSBASindexFile (char *filename, TSBASindex *index) {
+	FILE	*fd;
+	int		i;
+	int		version,step;
+
+	index->numEntries=0;
+	index->offset=NULL;
+	index->start=NULL;
+	index->numGEO=0;
+
+	fd=fopen(filename,"r");
+	if (fd==NULL) return 0;
+
+	if (fscanf(fd,"%ld %ld %d %d %d %d %lf %d",&index->filesize,&index->filetime,&version,&step,&index->numEntries,&index->t.MJDN,&index->t.SoD,&index->numGEO)!=8 
+			|| version!=SBASINDEXVERSION || step!=SBASINDEXSTEP || index->numEntries<=0 || index->numGEO<0 || index->numGEO>MAX_SBAS_PRN) {
+		index->numEntries=0;
+		index->numGEO=0;
+		fclose(fd);
+		return 0;
+	}
+
+	for(i=0;i<index->numGEO;i++) {
+		if (fscanf(fd,"%d %ld",&index->GEOPRN[i],&index->GEOoffset[i])!=2 || index->GEOPRN[i]<=0 || index->GEOPRN[i]>=MAX_SBAS_PRN) {
+			index->numEntries=0;
+			index->numGEO=0;
+			fclose(fd);
+			return 0;
+		}
+	}
+
+	index->offset=malloc(sizeof(long)*index->numEntries);
+	index->start=malloc(sizeof(long)*index->numEntries);
+	for(i=0;i<index->numEntries;i++) {
+		if (fscanf(fd,"%ld %ld",&index->offset[i],&index->start[i])!=2) {
+			free(index->offset);
+			free(index->start);
+			index->offset=NULL;
+			index->start=NULL;
+			index->numEntries=0;
+			index->numGEO=0;
+			fclose(fd);
+			return 0;
 		}
 	}
-	
+	fclose(fd);
+
 	return 1;
 }
 
 /*****************************************************************************
- * Name        : readRecTypeFile
- * Description : Read a GPS Receiver type file from a filename
+ * Name        : seekSBASFile
+ * Description : Move the file position of a SBAS file to the first message 
+ *               needed for having the same SBAS data at the first epoch as
+ *               when decoding all the file, so the older messages are not
+ *               decoded. All the messages from SBASseektime seconds before
+ *               the current epoch are decoded, as well as the older messages
+ *               whose data is still kept by the decoder (see buildSBASindex).
+ *               The GEOs with valid messages before the new position are
+ *               added to the SBAS data in the same order as when decoding
+ *               all the file. The time index of the file is read from the
+ *               index file (if given and matches the SBAS file) or built by
+ *               reading the messages
  * Parameters  :
  * Name                           |Da|Unit|Description
- * char  *filename                 I  N/A  Name of the file
- * TReceiverList  *recList         O  N/A  Structure to save the Receiver data
+ * FILE  *fd                       I  N/A  File descriptor of the SBAS file
+ * char  *filename                 I  N/A  Name of the SBAS file
+ * char  *indexfilename            I  N/A  Name of the index file (empty if none)
+ * enum fileType sbasfile          I  N/A  Type of SBAS file (EMS or RINEX-B)
+ * TSBASdatabox *SBASdatabox       IO N/A  Struct with SBAS data and summary data
+ * TTime *currentepoch             I  N/A  Current epoch
+ * TOptions  *options              I  N/A  TOptions structure
  * Returned value (int)            O  N/A  Status of the function
- *                                         1  => File open and properly read
- *                                         0  => File open and failed to read
- *                                         -1 => File not open
+ *                                         1  => File position moved
+ *                                         0  => File position not changed
  *****************************************************************************/
-int readRecTypeFile (char *filename, TReceiverList *recList) {
-	FILE	*fd;
-	int		ret;
-	
-	if (whatFileTypeIs(filename)!=ftRECEIVERTYPE) return 0;
-	
-	if ((fd = fopen(filename,"rb"))) {
-		ret = readRecType (fd, recList);
-		fclose(fd);
-		return ret;
-	} else {
-		// File do not exist
-		return -1;
+int seekSBASFile (FILE *fd, char *filename, char *indexfilename, enum fileType sbasfile, TSBASdatabox *SBASdatabox, TTime *currentepoch, TOptions *options) {
+	char		line[MAX_INPUT_LINE];
+	int			i;
+	int			len=0;
+	int			entry;
+	int			PRN;
+	int			seektime;
+	int			ret=0;
+	long		pos;
+	struct stat	filestat;
+	TSBASindex	index;
+	TSBASblock	sbasblock;
+	TTime		t;
+
+	index.numEntries=0;
+	index.offset=NULL;
+	index.start=NULL;
+
+	pos=ftell(fd);
+	if (pos<0) return 0;
+	if (stat(filename,&filestat)!=0) return 0;
+
+	//The messages decoded before the first epoch have to cover the GEO acquisition time, and the time outs of the data 
+	//which the decoder keeps from messages older than the last one (previous IODF of MT6 and previous IOD of MT24 and MT25)
+	seektime=options->SBASseektime;
+	if (options->adquisitiontime>seektime) seektime=options->adquisitiontime;
+	for(i=0;i<2;i++) {
+		if (options->usertmout[i][INTEGRITYINFO]>seektime) seektime=options->usertmout[i][INTEGRITYINFO];
+		if (options->usertmout[i][LONGTERMSATELLITECORRECTIONS]>seektime) seektime=options->usertmout[i][LONGTERMSATELLITECORRECTIONS];
+	}
+	t=tdadd(currentepoch,-(double)seektime);
+
+	if (indexfilename[0]=='\0' || readSBASindexFile(indexfilename,&index)==0 || index.filesize!=(long)filestat.st_size || index.filetime!=(long)filestat.st_mtime) {
+		free(index.offset);
+		free(index.start);
+		//The index saved to disk covers all the file, so it can be reused with any first epoch. Otherwise, the
+		//file is only read until the first message to be decoded
+		buildSBASindex(fd,sbasfile,indexfilename[0]=='\0'?&t:NULL,&index,options);
+		index.filesize=(long)filestat.st_size;
+		index.filetime=(long)filestat.st_mtime;
+		if (indexfilename[0]!='\0' && index.numEntries>0) {
+			if (writeSBASindexFile(indexfilename,&index)==0) {
+				sprintf(messagestr,"WARNING SBAS index file [%s] could not be written",indexfilename);
+				printInfo(messagestr,options);
+			}
+		}
 	}
+
+	if (index.numEntries>0) {
+		//If the time is after the last entry, all the messages of the file are needed
+		entry=(int)floor(tdiff(&t,&index.t)/(double)SBASINDEXSTEP);
+		if (entry>=0 && entry<index.numEntries && index.start[entry]>pos) {
+			if (fseek(fd,index.start[entry],SEEK_SET)==0) {
+				//Add the GEOs with valid messages before the new position, as the order of the GEOs is used when selecting the GEO
+				for(i=0;i<index.numGEO;i++) {
+					if (index.GEOoffset[i]>=index.start[entry]) break;
+					PRN=index.GEOPRN[i];
+					if (options->GEOPRNunsel[PRN]!=0 || SBASdatabox->SBASdata[0].GEOPRN2pos[PRN]!=-1) continue;
+					//Add 1 to the number of satellites
+					SBASdatabox->SBASdata[0].numSBASsatellites=SBASdatabox->SBASdata[0].numSBASsatellites+1;
+					//Add a slot in SBASdata structure for this PRN
+					SBASdatabox->SBASdata=realloc(SBASdatabox->SBASdata,sizeof(TSBASdata)*(SBASdatabox->SBASdata[0].numSBASsatellites+1));
+					//Initialise the new slot
+					initSBASdata(SBASdatabox->SBASdata,SBASdatabox->SBASdata[0].numSBASsatellites);
+					//Save the position of the new satellite
+					SBASdatabox->SBASdata[0].GEOPRN2pos[PRN]=SBASdatabox->SBASdata[0].numSBASsatellites;
+					//Save the PRN of the new satellite
+					SBASdatabox->SBASdata[SBASdatabox->SBASdata[0].numSBASsatellites].PRN=PRN;
+				}
+				//Read the time of the first message to be decoded
+				if (getL(line,&len,fd)!=-1) {
+					initSBASblock(&sbasblock);
+					getSBASmessageheader(line,len,sbasfile,&sbasblock);
+					sprintf(messagestr,"SBAS messages before %17s skipped (they are not needed for the first epoch)",t2doystr(&sbasblock.t));
+					printInfo(messagestr,options);
+				}
+				fseek(fd,index.start[entry],SEEK_SET);
+				ret=1;
+			} else {
+				fseek(fd,pos,SEEK_SET);
+			}
+		}
+	}
+
+	free(index.offset);
+	free(index.start);
+
+	return ret;
 }
 
 /*****************************************************************************
- * Name        : readSINEX
- * Description : Read a SINEX station positions file from a file descriptor
+ * Name        : getSBASFileLastTime
+ * Description : Get the time of applicability of the last complete message
+ *               of a SBAS file (EMS or RINEX-B) being written. Only the end
+ *               of the file (FOLLOWTAILSIZE bytes) is read
  * Parameters  :
  * Name                           |Da|Unit|Description
- * FILE  *fd                       I  N/A  File descriptor
- * TStationList  *stationList      O  N/A  Structure to save the station data
- * Returned value (int)            O  N/A  Status of the function
- *                                         1 => Properly read
- *                                         0 => Error
+ * TFollowFile  *follow            I  N/A  TFollowFile structure of the SBAS file
+ * TTime  *t                       O  N/A  Time of the last message
+ * Returned value (int)            O  N/A  1 => Time of the last message found
+ *                                         0 => No complete message found
  *****************************************************************************/
-int readSINEX (FILE *fd, TStationList *stationList) {
-	char 	line[MAX_INPUT_LINE];
-	char	aux[100];
-	int 	len = 0;
-	int		section;	// =0 => Unimportant stuff
-						// =1 => SITE/ID section
-						// =2 => SOLUTION/ESTIMATE section
-	int 	properlyRead = 0;
-	int		auxN;
-	int		error = 0;
-	int		i=0;
-	char	prevName[5] = "";
-	
-	section = 0;
-	while(getL(line,&len,fd)!=-1) {
-		if (line[0]=='+') { // Change of section
-			if (strncmp(line,"+SITE/ID",8)==0) section = 1;
-			else if (strncmp(line,"+SOLUTION/ESTIMATE",18)==0) {
-				section = 2;
-				auxN = 0;
-				// Reserve memory for detected stations
-				stationList->station = malloc(sizeof(TStation)*stationList->n);
-			} else section = 0;
-		} else if (line[0]!='*' && line[0]!='-') {
-			if (section==1) {
-				stationList->n++;
-			} else if (section==2) {
-				getstr(aux,line,7,3);
-				if (strcmp(aux,"STA")==0) { // It is a station
-					properlyRead = 1; // Any station has been found
-					getstr(aux,line,14,4);
-					if (strcmp(prevName,aux)!=0) { // New station
-						auxN++;
-						strcpy(stationList->station[auxN-1].name,aux);
-						strcpy(prevName,aux);
-					}
-					getstr(aux,line,46,23);
-					if (line[10]=='X') i=0;
-					else if (line[10]=='Y') i=1;
-					else if (line[10]=='Z') i=2;
-					else error = 1;
-					stationList->station[auxN-1].pos[i] = atof(aux);
+int getSBASFileLastTime (TFollowFile *follow, TTime *t) {
+	FILE		*fd;
+	char		buffer[FOLLOWTAILSIZE];
+	char		line[MAX_INPUT_LINE];
+	int			n,len;
+	int			start,end;
+	int			found = 0;
+	long		pos;
+	struct stat	filestat;
+	TSBASblock	*sbasblock;
+
+	if (stat(follow->filename,&filestat)!=0) return 0;
+	pos = (long)filestat.st_size-FOLLOWTAILSIZE;
+	if (pos<0) pos = 0;
+
+	if ((fd=fopen(follow->filename,"rb"))==NULL) return 0;
+	fseek(fd,pos,SEEK_SET);
+	n = (int)fread(buffer,1,FOLLOWTAILSIZE,fd);
+	fclose(fd);
+
+	sbasblock = malloc(sizeof(TSBASblock));
+	initSBASblock(sbasblock);
+
+	//Look for the last message header line, skipping the line not ended with a newline
+	end = n;
+	while (end>0 && buffer[end-1]!='\n') end--;
+	while (end>0 && found==0) {
+		for (start=end-1;start>0 && buffer[start-1]!='\n';start--);
+		//The first line of the buffer may be cut, unless it is the beginning of the file
+		if (start==0 && pos>0) break;
+		len = end-start;
+		if (len<MAX_INPUT_LINE && buffer[start]>='0' && buffer[start]<='9') {
+			memcpy(line,&buffer[start],len);
+			line[len] = '\0';
+			//EMS messages are in a single line. RINEX-B messages have a first line with the PRN and time
+			if ((follow->type==ftRINEXB && len>=23) || (follow->type!=ftRINEXB && len>=88)) {
+				getSBASmessageheader(line,len,follow->type,sbasblock);
+				if (sbasblock->PRN>=MINGEOPRN && sbasblock->PRN<=MAXGEOPRN) {
+					memcpy(t,&sbasblock->t,sizeof(TTime));
+					found = 1;
 				}
 			}
 		}
+		end = start;
 	}
-	
-	if (auxN!=stationList->n) error = 1; // Stations number not properly parsed
-	return (properlyRead && !error); // properly read AND no error
+
+	free(sbasblock);
+
+	return found;
 }
 
 /*****************************************************************************
- * Name        : readSINEXFile
- * Description : Read a SINEX station positions file from a filename
+ * Name        : waitSBASFile
+ * Description : In follow mode, wait until the SBAS file has messages after the
+ *               current epoch, so all the messages up to the current epoch are
+ *               written and the reader does not reach the end of the file
  * Parameters  :
  * Name                           |Da|Unit|Description
- * char  *filename                 I  N/A  Name of the file
- * TStationList  *stationList      O  N/A  Structure to save the station data
- * Returned value (int)            O  N/A  Status of the function
- *                                         1  => File open and properly read
- *                                         0  => File open and failed to read
- *                                         -1 => File not open
+ * TFollowFile  *follow            I  N/A  TFollowFile structure of the SBAS file
+ * TTime  *currentepoch            I  N/A  Current epoch
+ * double  deadline                I  s    Clock (perfClock) until which to wait
+ * Returned value (int)            O  N/A  1 => Messages after the current epoch available
+ *                                         0 => Deadline reached without them
  *****************************************************************************/
-int readSINEXFile (char *filename, TStationList *stationList) {
-	FILE	*fd;
-	int		ret;
-	
-	if (whatFileTypeIs(filename)!=ftSINEX) return 0;
-	
-	if ((fd = fopen(filename,"rb"))) {
-		ret = readSINEX (fd, stationList);
-		fclose(fd);
-		return ret;
-	} else {
-		// File do not exist
-		return -1;
+int waitSBASFile (TFollowFile *follow, TTime *currentepoch, double deadline) {
+	TTime	t;
+	double	remaining;
+
+	while (1) {
+		if (getSBASFileLastTime(follow,&t)==1 && tdiff(&t,currentepoch)>0.) return 1;
+		remaining = deadline-perfClock();
+		if (remaining<=0.) return 0;
+		waitFollowFile(follow,min(remaining,FOLLOWRECHECKINTERVAL));
 	}
 }
 
 /*****************************************************************************
- * Name        : readSBASFile
- * Description : Read a SBAS file from a filename
+ * Name        : readSBASbatch
+ * Description : Read ahead the SBAS messages from the current position of the
+ *               file until the current epoch (or up to SBASBATCHSIZE messages)
+ *               and decode them. The messages of each GEO are decoded in a
+ *               different thread, in the same order as in the file (the 
+ *               preamble check of a message depends on the previous message of
+ *               the same GEO). The file position is restored at the end, so
+ *               the reader reads the same lines and takes the decoded messages
+ *               from the batch
  * Parameters  :
  * Name                           |Da|Unit|Description
- * char  *filename                 I  N/A  Name of the file
- * TSBASdatabox *SBASdatabox       O  N/A  Structure to save SBAS data
- * double *rinexVersion            O  N/A  Rinex file version
+ * FILE  *fd                       I  N/A  File descriptor
+ * enum fileType sbasfile          I  N/A  Type of SBAS file (EMS or RINEX-B)
  * TTime *currentepoch             I  N/A  Current epoch
+ * TSBASbatch *batch               O  N/A  Batch of decoded SBAS messages
  * TOptions  *options              I  N/A  TOptions structure
- * Returned value (int)            O  N/A  Status of the function
- *                                         1  => File open and properly read
- *                                         0  => File open and failed to read
- *                                         -1 => File not open
- *                                         -2 => File open but reached end of
- *                                               file before getting to current
- *                                               epoch
+ * Returned value (int)            O  N/A  Number of messages in the batch
  *****************************************************************************/
-int readSBASFile (char *filename, TSBASdatabox *SBASdatabox, double *rinexVersion, TTime *currentepoch, TOptions  *options) {
-	static FILE 			*fd;
-	static FILE				*fdlist[18];
-	static enum fileType 	sbasfile;
-	int 					ret;
-	static int				prevday=0;
-	static int				initialized=0;
-	static int				filesclosed=0;
-	static char				*filelist[18];
-	
-	if(initialized==0) {
-		sbasfile=whatFileTypeIs(filename);
-		if (sbasfile!=ftRINEXB && sbasfile!=ftSBASEMSMESSAGE) return 0;
+int readSBASbatch (FILE *fd, enum fileType sbasfile, TTime *currentepoch, TSBASbatch *batch, TOptions *options) {
+	char		line[MAX_INPUT_LINE];
+	char		binarystring[2400];
+	int			len=0;
+	int			i,j;
+	int			numGEO=0;
+	int			GEOlist[MAX_SBAS_PRN];
+	int			GEOinlist[MAX_SBAS_PRN];
+	long		startpos;
+	TSBASblock	*sbasblock;
+
+	freeSBASbatch(batch,options);
+
+	startpos=ftell(fd);
+	if (startpos<0) return 0;
+
+	for(i=0;i<MAX_SBAS_PRN;i++) {
+		GEOinlist[i]=0;
+	}
 
-		//Check if any SBAS data file has to be written
+	while(batch->numMessages<SBASBATCHSIZE) {
+		if (getL(line,&len,fd)==-1) break;
+		if(line[0]=='\n' || line[0]=='\r') continue;	//Skip blank lines
 		if (sbasfile==ftRINEXB) {
-			ret=openSBASwritefiles(fdlist,filelist,filename,0,options);
-		} else {
-			ret=openSBASwritefiles(fdlist,filelist,filename,1,options);
+			//A new header is found. The rest of messages will be decoded by the reader
+			if (len>=80 && strncmp(&line[60],"RINEX VERSION / TYPE",20)==0) break;
+		} else if (len<88) {
+			//Data line too short. The reader will stop at this line
+			break;
 		}
 
-		//If any output file failed to open, exit with errors
-		if(ret!=1) return ret;
+		sbasblock=malloc(sizeof(TSBASblock));
+		initSBASblock(sbasblock);
+		getSBASmessageheader(line,len,sbasfile,sbasblock);
 
-		//Open SBAS file to be read
-		fd = fopen(filename,"rb");
-		if(fd==NULL) {
-			// File do not exist
-			return -1;
+		if (sbasfile==ftRINEXB && sbasblock->frequency!=1) {
+			//Message not from L1. Skip the two following lines of the current message
+			free(sbasblock);
+			if (getL(line,&len,fd)==-1) break;
+			if (getL(line,&len,fd)==-1) break;
+			continue;
+		}
+		if (sbasblock->PRN<0 || sbasblock->PRN>=MAX_SBAS_PRN || sbasblock->t.MJDN>currentepoch->MJDN || (currentepoch->MJDN==sbasblock->t.MJDN && sbasblock->t.SoD>currentepoch->SoD)) {
+			//Message ahead of the current epoch (or with an invalid PRN)
+			free(sbasblock);
+			break;
+		}
+		if (sbasfile==ftRINEXB) {
+			if (readRINEXBdatalines(fd,sbasblock,batch->hexstring[batch->numMessages])==0) {
+				free(sbasblock);
+				break;
+			}
+		} else if(sbasblock->messagetype<10) {
+			getstr(batch->hexstring[batch->numMessages],line,24,64);
+		} else {
+			getstr(batch->hexstring[batch->numMessages],line,25,64);
 		}
 
-		initialized=1;
+		if (GEOinlist[sbasblock->PRN]==0) {
+			GEOinlist[sbasblock->PRN]=1;
+			GEOlist[numGEO]=sbasblock->PRN;
+			numGEO++;
+		}
+		batch->sbasblock[batch->numMessages]=sbasblock;
+		batch->numMessages++;
 	}
 
-	if(sbasfile==ftRINEXB && fd!=NULL) {
-		ret=readRINEXB(fd,fdlist,filelist,SBASdatabox,rinexVersion,&prevday,currentepoch,options);
-
-	} else if(sbasfile==ftSBASEMSMESSAGE && fd!=NULL){
-		//If we are going to process data, the first call to this function will be just for opening files and reading header
-		if(currentepoch->MJDN==-1 && options->onlyconvertSBAS==0) {
-			if (options->workMode != wmSBASPLOTS) return 1;
+	clearerr(fd);
+	fseek(fd,startpos,SEEK_SET);
+
+	#pragma omp parallel for private(i,binarystring) if(numGEO>1)
+	for(j=0;j<numGEO;j++) {
+		for(i=0;i<batch->numMessages;i++) {
+			if (batch->sbasblock[i]->PRN!=GEOlist[j]) continue;
+			//Convert the hexadecimal string to a binary string (1 bit per byte)
+			strhextostrbin(batch->hexstring[i],binarystring);
+			//Decode message
+			batch->decoderesult[i]=readSBASmessage(binarystring,batch->sbasblock[i]->messagetype,&batch->decodedmessagetype[i],batch->sbasblock[i],&batch->messagesmissing[i],options);
 		}
+	}
 
-		//SBAS EMS message file
-		*rinexVersion=0; //There is no RINEX version here, we set the value to 0
-		ret=readEMS(fd,fdlist,filelist,SBASdatabox,&prevday,currentepoch,options);
+	return batch->numMessages;
+}
+
+/*****************************************************************************
+ * Name        : getSBASbatchmessage
+ * Description : Get the next decoded message of a batch. If it is not the 
+ *               message read by the reader, the batch is discarded and the
+ *               reader has to decode the message
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSBASbatch *batch               IO N/A  Batch of decoded SBAS messages
+ * TSBASblock  *sbasblock          IO N/A  TSBASblock structure with the header
+ *                                         of the message read (PRN, time and
+ *                                         message type). The decoded message is
+ *                                         copied into it
+ * int  *decoderesult              O  N/A  Value returned by readSBASmessage
+ * int  *decodedmessagetype        O  N/A  Message type decoded by readSBASmessage
+ * int  *messagesmissing           O  N/A  Number of messages missing detected by
+ *                                         readSBASmessage
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1  => Decoded message copied
+ *                                         0  => No decoded message available
+ *****************************************************************************/
+int getSBASbatchmessage (TSBASbatch *batch, TSBASblock *sbasblock, int *decoderesult, int *decodedmessagetype, int *messagesmissing, TOptions *options) {
+	TSBASblock	*batchblock;
+
+	if (batch->current>=batch->numMessages) return 0;
+
+	batchblock=batch->sbasblock[batch->current];
+	if (batchblock->PRN!=sbasblock->PRN || batchblock->messagetype!=sbasblock->messagetype || batchblock->t.MJDN!=sbasblock->t.MJDN || batchblock->t.SoD!=sbasblock->t.SoD) {
+		freeSBASbatch(batch,options);
+		return 0;
 	}
 
-	if(fd!=NULL && filesclosed==0) {
-		if (feof(fd)>0) {
-			//Reached end of file
-			filesclosed=1;
-			fclose(fd);
-			fd=NULL;
-			closefiles(fdlist,18);	//Close all other files
-			if(prevday==0 && options->writePegasusfile==1) {
-				//No data was written in the RINEX H file for the previous day
-				//But we have generated one with the header. We need to erase it.
-				remove(filelist[fdEPHEMERISPREVDAY]);
-			}
+	memcpy(sbasblock,batchblock,sizeof(TSBASblock));
+	*decoderesult=batch->decoderesult[batch->current];
+	*decodedmessagetype=batch->decodedmessagetype[batch->current];
+	*messagesmissing=batch->messagesmissing[batch->current];
+
+	free(batchblock);
+	batch->sbasblock[batch->current]=NULL;
+	batch->current++;
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : freeSBASbatch
+ * Description : Free the decoded messages of a batch not used by the reader
+ *               and empty the batch
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TSBASbatch *batch               IO N/A  Batch of decoded SBAS messages
+ * TOptions  *options              I  N/A  TOptions structure
+ *****************************************************************************/
+void freeSBASbatch (TSBASbatch *batch, TOptions *options) {
+	int		i;
+
+	for(i=batch->current;i<batch->numMessages;i++) {
+		if (batch->decoderesult[i]>0 || batch->decoderesult[i]<-3) {
+			//Only free sbasblock messagetype memory if we have allocated memory
+			freeSBASblock(batch->sbasblock[i]->messagetype,batch->sbasblock[i],options);
 		}
-	} else if (fd==NULL) {
-		//Reached end of file and files are already closed.
-		return -2;
+		free(batch->sbasblock[i]);
+		batch->sbasblock[i]=NULL;
 	}
-
-	return ret;
+	batch->numMessages=0;
+	batch->current=0;
 }
 
 /*****************************************************************************
@@ -6322,10 +9749,11 @@ int readRINEXB (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdata
 	TTime			msgtime,prevmsgtime;
 	TSBASblock  	*sbasblock;
 	double			CurrentPos;
-	struct stat 	filestat;	//This is to get the file size
 	double			filesize;
 	double			CurrentPercentage;
 	double			PreviousPercentage=-1;
+	int				batchmode=0;
+	static TSBASbatch	batch;
 
 	if(initialized==0) {
 		initialized=1;
@@ -6340,8 +9768,7 @@ int readRINEXB (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdata
 
 		if (printProgressConvert==1) {
 			CurrentPos=0;
-			fstat(fileno(fd), &filestat);
-			filesize = (double)filestat.st_size;
+			filesize = (double)getInputFileSize(fd);
 			//Print position 0 as the percentage will be update every 3 lines read
 			if (options->ProgressEndCharac=='\r') {
 				//Printing to a terminal
@@ -6362,6 +9789,14 @@ int readRINEXB (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdata
 		lineaux[i][0]='\0';
 	}
 
+	#if defined _OPENMP
+		//In multithread mode, read ahead the messages until the current epoch and decode them in parallel (one thread per GEO)
+		if (options->numthreads>1 && readingHeader==0 && currentepoch->MJDN>=0 && (options->onlySBASplots==0 || firstdatalineMJDN!=-1)) {
+			batchmode=1;
+			readSBASbatch(fd,ftRINEXB,currentepoch,&batch,options);
+		}
+	#endif
+
 
 	while(getL(line,&len,fd)!=-1) {
 		numfilelines++;
@@ -6684,11 +10119,14 @@ int readRINEXB (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdata
 								PreviousPercentage=CurrentPercentage;
 							}
 						}
-						//Convert the hexadecimal string to a binary string (1 bit per byte)
-						strhextostrbin(hexstring,binarystring);
+						//Take the message from the batch if it has already been decoded
+						if (batchmode==0 || getSBASbatchmessage(&batch,sbasblock,&decoderesult,&decodedmessagetype,&messagesmissing,options)==0) {
+							//Convert the hexadecimal string to a binary string (1 bit per byte)
+							strhextostrbin(hexstring,binarystring);
 
-						//Decode message
-						decoderesult=readSBASmessage(binarystring,sbasblock->messagetype,&decodedmessagetype,sbasblock,&messagesmissing,options);
+							//Decode message
+							decoderesult=readSBASmessage(binarystring,sbasblock->messagetype,&decodedmessagetype,sbasblock,&messagesmissing,options);
+						}
 						if(messagesmissing!=0) {
 							//Increase counter for missing messages
 							totalmsgmissing+=messagesmissing;
@@ -6792,6 +10230,10 @@ int readRINEXB (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdata
 			free(sbasblock);
 			sbasblock=NULL;
 
+			if (batchmode==1 && batch.current==SBASBATCHSIZE) {
+				//All the messages of a full batch have been used. Read and decode the next batch
+				readSBASbatch(fd,ftRINEXB,currentepoch,&batch,options);
+			}
 		}
 	} //End while getLine
 
@@ -6915,10 +10357,11 @@ int readEMS (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdatabox
 	TTime				msgtime,prevmsgtime;
 	TSBASblock  	   	*sbasblock;
 	double				CurrentPos;
-	struct stat	 		filestat;	//This is to get the file size
 	double				filesize;
 	double				CurrentPercentage;
 	double				PreviousPercentage=-1;
+	int					batchmode=0;
+	static TSBASbatch	batch;
 
 
 	if(initialized==0) {
@@ -6934,8 +10377,7 @@ int readEMS (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdatabox
 
 		if (printProgressConvert==1) {
 			CurrentPos=0;
-			fstat(fileno(fd), &filestat);
-			filesize = (double)filestat.st_size;
+			filesize = (double)getInputFileSize(fd);
 			//Print position 0 
 			if (options->ProgressEndCharac=='\r') {
 				//Printing to a terminal
@@ -6956,6 +10398,14 @@ int readEMS (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdatabox
 			lineaux[i][0]='\0';
 	}
 
+	#if defined _OPENMP
+		//In multithread mode, read ahead the messages until the current epoch and decode them in parallel (one thread per GEO)
+		if (options->numthreads>1 && currentepoch->MJDN>=0 && (options->onlySBASplots==0 || firstdatalineMJDN!=-1)) {
+			batchmode=1;
+			readSBASbatch(fd,ftSBASEMSMESSAGE,currentepoch,&batch,options);
+		}
+	#endif
+
 
 	while(getL(line,&len,fd)!=-1) {
 
@@ -7183,18 +10633,21 @@ int readEMS (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdatabox
 		getstr(aux,line,22,2);
 		sbasblock->messagetype=atoi(aux);	//Message type
 
-		//Hexadecimal message
-		if(sbasblock->messagetype<10) {	
-			getstr(hexstring,line,24,64);	
-		} else {
-			getstr(hexstring,line,25,64);
-		}
+		//Take the message from the batch if it has already been decoded
+		if (batchmode==0 || getSBASbatchmessage(&batch,sbasblock,&decoderesult,&decodedmessagetype,&messagesmissing,options)==0) {
+			//Hexadecimal message
+			if(sbasblock->messagetype<10) {	
+				getstr(hexstring,line,24,64);	
+			} else {
+				getstr(hexstring,line,25,64);
+			}
 
-		//Convert the hexadecimal string to a binary string (1 bit per byte)
-		strhextostrbin(hexstring,binarystring);
+			//Convert the hexadecimal string to a binary string (1 bit per byte)
+			strhextostrbin(hexstring,binarystring);
 
-		//Decode message
-		decoderesult=readSBASmessage(binarystring,sbasblock->messagetype,&decodedmessagetype,sbasblock,&messagesmissing,options);
+			//Decode message
+			decoderesult=readSBASmessage(binarystring,sbasblock->messagetype,&decodedmessagetype,sbasblock,&messagesmissing,options);
+		}
 		if(messagesmissing!=0) {
 			//Increase counter for missing messages
 			totalmsgmissing+=messagesmissing;
@@ -7277,6 +10730,11 @@ int readEMS (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdatabox
 
 		free(sbasblock);
 		sbasblock=NULL;
+
+		if (batchmode==1 && batch.current==SBASBATCHSIZE) {
+			//All the messages of a full batch have been used. Read and decode the next batch
+			readSBASbatch(fd,ftSBASEMSMESSAGE,currentepoch,&batch,options);
+		}
 	} //End while(getL(line,&len,fd)!=-1) {
 
 	//Check for missing messages or error messages in all GEOs 
@@ -7384,16 +10842,10 @@ int readSBASmessage (char *binarystring, int messagetype, int *decodedmessagetyp
 	int					ret;
 	int					start;
 
+	int					badpreamble=0;
+	//Last preamble of each GEO (empty until the first message is read). Each position is only used by
+	//the thread which decodes the messages of the GEO, so it is safe to decode GEOs in parallel
 	static char			previouspreamble[MAX_SBAS_PRN][9];
-	static int			badpreamble=0;
-	static int          initialized=0;
-
-	if (initialized==0) {
-		for(i=0;i<MAX_SBAS_PRN;i++) {
-			strcpy(previouspreamble[i],"00000000");
-		}
-		initialized=1;
-	}
 
 	//Table values for messages 2,3,4,5 and 24
 	const double 	udreimeterslist[16]={0.75,1.0,1.25,1.75,2.25,3.0,3.75,4.5,5.25,6.0,7.5,15.0,50.0,150.0,-1,-2}; //UDRE (meters)
@@ -7444,7 +10896,7 @@ int readSBASmessage (char *binarystring, int messagetype, int *decodedmessagetyp
 	//Check if the preamble received is the next in the cycle, otherwise some messages will are missing in the data file
 	if (badpreamble==1) {
 		//If the previous message had a bad preamble, we cannot say if we have lost any messages
-	} else if(strcmp(previouspreamble[sbasblock->PRN],"00000000")==0) {
+	} else if(previouspreamble[sbasblock->PRN][0]=='\0') {
 		//This is the first message read in the file, set previouspreamble and continue
 		strcpy(previouspreamble[sbasblock->PRN],aux);
 	} else if (strcmp(aux,"01010011")==0) {
@@ -9134,6 +12586,8 @@ void updateSBASdata (TSBASdata  *SBASdata, TSBASblock  *sbasblock, TTime current
 						}
 					}
 				}
+				//The mask or the IODI of the IGPs may have changed. Update the IGP index
+				SBASupdateIGPindex(&SBASdata[pos]);
 				break;
 			case(RESERVED8):case(RESERVED11):case(RESERVED13):case(RESERVED14):case(RESERVED15):case(RESERVED16):case(RESERVED19):case(RESERVED20):case(RESERVED21):case(RESERVED22):case(RESERVED23):case(INTERNALTESTMESSAGE):case(NULLMESSAGE):
 				//Messages with no data that do not have any effect
@@ -9169,7 +12623,7 @@ int readsigmamultipathFile (char *filename,  TSBASdata  *SBASdata, TOptions  *op
 	int		ret;
 	FILE 	*fd;
 
-	fd = fopen(filename,"rb");
+	fd = openInputFile(filename);
 	if ( fd == NULL ) {
 		return -1;
 	} else {
@@ -9826,7 +13280,7 @@ int readReferenceFile (char  *filename, TGNSSproducts *RefPosition, TOptions  *o
 	initGNSSproducts(&nextSP3Prod);
 	initGNSSproducts(&pastSP3Prod);
 
-	fd=fopen(filename,"rb");
+	fd=openInputFile(filename);
 	if (fd==NULL) {
 		return -1;
 	}
@@ -250,16 +250,50 @@ int getLNoComments (char *lineptr, int *n, FILE *stream);
 int getLback (char *lineptr, int *n, FILE *stream);
 
 // File management
+FILE *openInputFile (char *filename);
+off_t getInputFileSize (FILE *fd);
 enum fileType whatFileTypeIs (char *filename);
 
+// Follow mode (files read while they are being written)
+int initFollowFile (TFollowFile *follow, char *filename);
+void closeFollowFile (TFollowFile *follow);
+int waitFollowFile (TFollowFile *follow, double maxWait);
+int isFollowFileUpdated (TFollowFile *follow);
+
+// Binary cache of parsed products
+#define PRODUCTSCACHEMAGIC				"gLABPC"
+#define PRODUCTSCACHEVERSION			1
+int getProductsCacheFilename (FILE *fd, char *cacheDir, char *productType, int flags, char *cacheFilename);
+int checkProductsCacheHeader (FILE *fd);
+int writeProductsCacheHeader (FILE *fd);
+int closeProductsCacheFile (FILE *fd, char *tmpFilename, char *cacheFilename);
+int readRinexNavCache (char *cacheFilename, TGNSSproducts *products, double *rinexNavVersion);
+int writeRinexNavCache (char *cacheFilename, TGNSSproducts *products, double rinexNavVersion);
+int readSP3Cache (char *cacheFilename, TGNSSproducts *products);
+int writeSP3Cache (char *cacheFilename, TGNSSproducts *products);
+
+// Summary files (combination of summaries of different runs)
+#define SUMMARYFILEMAGIC				"gLABSU"
+#define SUMMARYFILEVERSION				1
+void writeSummaryStat (FILE *fd, TSummaryStat *stat);
+int readSummaryStat (FILE *fd, TSummaryStat *stat);
+int writeSummaryFile (char *filename, TSummaryData *summary, TSummaryStat **stat);
+int readSummaryFile (char *filename, TSummaryData *summary, TSummaryStat *stat);
+
 // RINEX Observation
 int readRinexObsHeader (FILE *fd, FILE *fdout, TEpoch *epoch, TOptions *options);
 int readRinexObsEpoch (FILE *fd, TEpoch *epoch, TConstellation *constellation, enum ProcessingDirection direction, char *Epochstr, TOptions *options);
 int rewindEpochRinexObs (FILE *fd, enum Source src);
+int buildRinexObsIndex (FILE *fd, TEpoch *epoch, TRinexObsIndex *index);
+void freeRinexObsIndex (TRinexObsIndex *index);
+int skipRinexObsEpoch (FILE *fd, TEpoch *epoch, enum ProcessingDirection direction, int *lastCSindex, TOptions *options);
+int rewindEpochRinexObsIndex (FILE *fd, enum Source src, TRinexObsIndex *index);
 int getEpochFromObsFile (FILE *fd, enum Source src, TTime *t);
+int isRinexObsEpochComplete (FILE *fd, TEpoch *epoch, int numEpochs);
+int waitRinexObsEpoch (FILE *fd, TFollowFile *follow, TEpoch *epoch, int numEpochs, TOptions *options);
 
 // RINEX Navigation message
-int readRinexNav (FILE *fd, TGNSSproducts *products, double *rinexNavVersion);
+int readRinexNav (FILE *fd, TGNSSproducts *products, double *rinexNavVersion, TOptions *options);
 int readRinexNavLastEpoch (FILE *fd, TTime *lastEpoch);
 
 // SP3 files
@@ -300,7 +334,19 @@ int readSINEX (FILE *fd, TStationList *stationList);
 int readSINEXFile (char *filename, TStationList *stationList);
 
 // SBAS
-int readSBASFile (char *filename, TSBASdatabox *SBASdatabox, double *rinexVersion, TTime *currentepoch, TOptions  *options);
+int readSBASFile (char *filename, char *indexfilename, TSBASdatabox *SBASdatabox, double *rinexVersion, TTime *currentepoch, TOptions  *options);
+void getSBASmessageheader (char *line, int len, enum fileType sbasfile, TSBASblock *sbasblock);
+int readRINEXBdatalines (FILE *fd, TSBASblock *sbasblock, char *hexstring);
+void updateSBASindexKey (TSBASindexGEO *geo, int group, int part, int version, int depth, long offset);
+long getSBASindexStart (TSBASindexGEO **geo, long offset);
+int buildSBASindex (FILE *fd, enum fileType sbasfile, TTime *lastTime, TSBASindex *index, TOptions *options);
+int readSBASindexFile (char *filename, TSBASindex *index);
+int seekSBASFile (FILE *fd, char *filename, char *indexfilename, enum fileType sbasfile, TSBASdatabox *SBASdatabox, TTime *currentepoch, TOptions *options);
+int getSBASFileLastTime (TFollowFile *follow, TTime *t);
+int waitSBASFile (TFollowFile *follow, TTime *currentepoch, double deadline);
+int readSBASbatch (FILE *fd, enum fileType sbasfile, TTime *currentepoch, TSBASbatch *batch, TOptions *options);
+int getSBASbatchmessage (TSBASbatch *batch, TSBASblock *sbasblock, int *decoderesult, int *decodedmessagetype, int *messagesmissing, TOptions *options);
+void freeSBASbatch (TSBASbatch *batch, TOptions *options);
 int readRINEXB (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdatabox, double *rinexVersion, int *prevday, TTime *currentepoch, TOptions  *options);
 int readEMS (FILE *fd, FILE **fdlist, char **filelist, TSBASdatabox *SBASdatabox, int *prevday, TTime *currentepoch, TOptions  *options);
 int readSBASmessage (char *binarystring, int messagetype, int *decodedmessagetype, TSBASblock *sbasblock, int *messageslost, TOptions  *options);
@@ -880,8 +880,170 @@ double getClockBRDC (TBRDCblock *block,TTime *t) {
 }
 
 /*****************************************************************************
- * Name        : getPositionBRDC
- * Description : Get the position of the satellite from specified ephemeris block
+ * Name        : GLONASSorbitDerivatives
+ * Description : Time derivative of the GLONASS satellite state vector in the
+ *               PZ-90 rotating frame, following the equations of motion of the
+ *               GLONASS ICD (central body, J2 and luni-solar accelerations)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * double  *state                  I  N/A  Position (m) and velocity (m/s) of the satellite
+ * double  *acc                    I  m/s2 Luni-solar acceleration from the broadcast message
+ * double  *deriv                  O  N/A  Velocity (m/s) and acceleration (m/s2) of the satellite
+ *****************************************************************************/
+void GLONASSorbitDerivatives (double *state, double *acc, double *deriv) {
+	//Constants for GLONASS (PZ-90)
+	const double	muGLO = 3.9860044e+14;  // PZ-90 Earth Universal Gravitational parameter (m3/s2)
+	const double	om_eGLO = 7.292115e-5;  // PZ-90 Earth rotation rate (rad/s)
+	const double	aeGLO = 6378136.0;  // PZ-90 Earth semi-major axis (m)
+	const double	J2GLO = 1.0826257e-3;  // PZ-90 second zonal harmonic
+
+	double			r2, r3;
+	double			kJ2;
+	double			z2r2;
+	double			kCentral;
+
+	r2 = state[0]*state[0] + state[1]*state[1] + state[2]*state[2];
+	r3 = r2*sqrt(r2);
+	kJ2 = 1.5*J2GLO*muGLO*aeGLO*aeGLO/(r2*r3);
+	z2r2 = 5.0*state[2]*state[2]/r2;
+	kCentral = -muGLO/r3 - kJ2*(1.0-z2r2);
+
+	deriv[0] = state[3];
+	deriv[1] = state[4];
+	deriv[2] = state[5];
+	deriv[3] = (kCentral + om_eGLO*om_eGLO)*state[0] + 2.0*om_eGLO*state[4] + acc[0];
+	deriv[4] = (kCentral + om_eGLO*om_eGLO)*state[1] - 2.0*om_eGLO*state[3] + acc[1];
+	deriv[5] = (kCentral - 2.0*kJ2)*state[2] + acc[2];
+}
+
+/*****************************************************************************
+ * Name        : GLONASSorbitStep
+ * Description : Advance the GLONASS satellite state vector with one fourth order
+ *               Runge-Kutta step
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * double  *state                  I  N/A  Position (m) and velocity (m/s) at the start of the step
+ * double  *acc                    I  m/s2 Luni-solar acceleration from the broadcast message
+ * double  h                       I  s    Integration step (negative for integrating backwards)
+ * double  *stateNext              O  N/A  Position (m) and velocity (m/s) at the end of the step
+ *****************************************************************************/
+void GLONASSorbitStep (double *state, double *acc, double h, double *stateNext) {
+	double			k1[6], k2[6], k3[6], k4[6];
+	double			aux[6];
+	int				i;
+
+	GLONASSorbitDerivatives(state, acc, k1);
+	for ( i = 0; i < 6; i++ ) aux[i] = state[i] + 0.5*h*k1[i];
+	GLONASSorbitDerivatives(aux, acc, k2);
+	for ( i = 0; i < 6; i++ ) aux[i] = state[i] + 0.5*h*k2[i];
+	GLONASSorbitDerivatives(aux, acc, k3);
+	for ( i = 0; i < 6; i++ ) aux[i] = state[i] + h*k3[i];
+	GLONASSorbitDerivatives(aux, acc, k4);
+	for ( i = 0; i < 6; i++ ) stateNext[i] = state[i] + h*(k1[i] + 2.0*k2[i] + 2.0*k3[i] + k4[i])/6.0;
+}
+
+/*****************************************************************************
+ * Name        : getPositionVelocityGLONASS
+ * Description : Get the position and ITRF velocity of a GLONASS satellite by
+ *               integrating the broadcast state vector.
+ *               The integration is done in fixed steps of GLONASS_ORBIT_STEP
+ *               seconds from the ephemeris reference time, and the state at each
+ *               step is saved for each satellite. Consecutive epochs (forwards or
+ *               backwards) only integrate the steps not computed yet, and the
+ *               result does not depend on the order of the calls
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TBRDCproducts *products         I  N/A  Ephemerides products
+ * TBRDCblock  *block              I  N/A  TBRDCblock structure
+ * TTime  *t                       I  N/A  Reference time
+ * double  *position               O  m    3D vector with the satellite position
+ * double  *ITRFvel                O  m/s  3D vector with the ITRF satellite velocity
+ *****************************************************************************/
+void getPositionVelocityGLONASS (TBRDCproducts *products, TBRDCblock *block, TTime *t, double *position, double *ITRFvel) {
+	//Static variables are shared between threads (as they are saved in the data segment).
+	//To avoid race conditions, we need to set the directive '#pragma omp threadprivate()'
+	//directive to make OpenMP create a local (static) copy for each thread
+	static TGLONASSorbit	orbit[MAX_SATELLITES_PER_GNSS];
+	#pragma omp threadprivate(orbit)
+	TGLONASSorbit			*sat;
+	double					diff;
+	double					acc[3];
+	double					state[6];
+	double					stateNext[6];
+	double					remainder;
+	int						k, kTarget, kSaved;
+	int						PRN;
+
+	PRN = block->PRN;
+	if ( PRN < 0 || PRN >= MAX_SATELLITES_PER_GNSS ) PRN = 0;
+	sat = &orbit[PRN];
+
+	// Broadcast state vector
+	state[0] = block->satposX;
+	state[1] = block->satposY;
+	state[2] = block->satposZ;
+	state[3] = block->satvelX;
+	state[4] = block->satvelY;
+	state[5] = block->satvelZ;
+	acc[0] = block->sataccX;
+	acc[1] = block->sataccY;
+	acc[2] = block->sataccZ;
+
+	// Start again from the reference time if the block has changed
+	if ( sat->valid == 0 || tdiff(&sat->Ttoe, &block->Ttoe) != 0 || memcmp(sat->state0, state, sizeof(state)) != 0 ) {
+		sat->valid = 1;
+		memcpy(&sat->Ttoe, &block->Ttoe, sizeof(TTime));
+		memcpy(sat->state0, state, sizeof(state));
+		memcpy(sat->state[MAX_GLONASS_ORBIT_STEPS], state, sizeof(state));
+		sat->kmin = 0;
+		sat->kmax = 0;
+	}
+
+	// Ephemeris reference time is in UTC (t is in GPS time)
+	diff = tdiff(t, &block->Ttoe) - products->AT_LS;
+	kTarget = (int)(diff/GLONASS_ORBIT_STEP);
+	remainder = diff - kTarget*GLONASS_ORBIT_STEP;
+
+	// Integrate and save the steps not computed yet
+	if ( kTarget > MAX_GLONASS_ORBIT_STEPS ) kSaved = MAX_GLONASS_ORBIT_STEPS;
+	else if ( kTarget < -MAX_GLONASS_ORBIT_STEPS ) kSaved = -MAX_GLONASS_ORBIT_STEPS;
+	else kSaved = kTarget;
+	for ( k = sat->kmax; k < kSaved; k++ ) {
+		GLONASSorbitStep(sat->state[k+MAX_GLONASS_ORBIT_STEPS], acc, GLONASS_ORBIT_STEP, sat->state[k+1+MAX_GLONASS_ORBIT_STEPS]);
+	}
+	if ( kSaved > sat->kmax ) sat->kmax = kSaved;
+	for ( k = sat->kmin; k > kSaved; k-- ) {
+		GLONASSorbitStep(sat->state[k+MAX_GLONASS_ORBIT_STEPS], acc, -GLONASS_ORBIT_STEP, sat->state[k-1+MAX_GLONASS_ORBIT_STEPS]);
+	}
+	if ( kSaved < sat->kmin ) sat->kmin = kSaved;
+	memcpy(state, sat->state[kSaved+MAX_GLONASS_ORBIT_STEPS], sizeof(state));
+
+	// Steps beyond the saved ones (only if the reference time is too far) and last fraction of step
+	for ( k = kSaved; k < kTarget; k++ ) {
+		GLONASSorbitStep(state, acc, GLONASS_ORBIT_STEP, stateNext);
+		memcpy(state, stateNext, sizeof(state));
+	}
+	for ( k = kSaved; k > kTarget; k-- ) {
+		GLONASSorbitStep(state, acc, -GLONASS_ORBIT_STEP, stateNext);
+		memcpy(state, stateNext, sizeof(state));
+	}
+	if ( remainder != 0 ) {
+		GLONASSorbitStep(state, acc, remainder, stateNext);
+		memcpy(state, stateNext, sizeof(state));
+	}
+
+	memcpy(position, state, sizeof(double) * 3);
+	if ( ITRFvel != NULL ) {
+		memcpy(ITRFvel, &state[3], sizeof(double) * 3);
+	}
+}
+
+/*****************************************************************************
+ * Name        : getPositionVelocityBRDC
+ * Description : Get the position and velocity of the satellite from specified
+ *               ephemeris block. Velocities are computed with the analytic time
+ *               derivatives of the orbital elements, so Kepler's equation is only
+ *               solved once
  * Parameters  :
  * Name                           |Da|Unit|Description
  * TBRDCproducts *products         I  N/A  Ephemerides products
@@ -889,8 +1051,14 @@ double getClockBRDC (TBRDCblock *block,TTime *t) {
  * TTime  *t                       I  N/A  Reference time
  * enum GNSSystem  GNSS            I  N/A  GNSS enumerator of the satellite
  * double  *position               O  m    3D vector with the satellite position
+ * double  *velocity               O  m/s  3D vector with the inertial satellite velocity
+ *                                         If the pointer is NULL this parameter
+ *                                         is not computed
+ * double  *ITRFvel                O  m/s  3D vector with the ITRF satellite velocity
+ *                                         If the pointer is NULL this parameter
+ *                                         is not computed
  *****************************************************************************/
-void getPositionBRDC (TBRDCproducts *products, TBRDCblock *block,TTime *t, enum GNSSystem GNSS, double *position) {
+void getPositionVelocityBRDC (TBRDCproducts *products, TBRDCblock *block, TTime *t, enum GNSSystem GNSS, double *position, double *velocity, double *ITRFvel) {
 	//Constants for GPS
 	const double	mu = 3.986005e+14;  // WGS-84 Earth Universal Gravitational parameter (m3/s2)
 	const double	om_e = 7.2921151467e-5;  // WGS-84 Earth rotation rate (rad/s)
@@ -904,6 +1072,7 @@ void getPositionBRDC (TBRDCproducts *products, TBRDCblock *block,TTime *t, enum
 
 
 	double 			diff;
+	double			n;			// Corrected mean motion
 	double			Mk;			// Mean anomaly
 	double			Ek;			// Excentric anomaly
 	double			fk;			// True anomaly
@@ -912,8 +1081,13 @@ void getPositionBRDC (TBRDCproducts *products, TBRDCblock *block,TTime *t, enum
 	double			ik;			// Inclination
 	double			xp, yp;
 	double			OMk;		// Longitude of ascending node
+	double			OMkdot;
 	double			alpha, beta;
 	double			X, Y, Z;
+	double			Ekdot, fkdot, ukdot, rkdot, ikdot;
+	double			xpdot, ypdot;
+	double			Xdot, Ydot, Zdot;
+	double			vel[3];		// ITRF velocity
 	
 	diff = tdiff(t, &block->Ttoe);
 
@@ -922,113 +1096,118 @@ void getPositionBRDC (TBRDCproducts *products, TBRDCblock *block,TTime *t, enum
 			position[0] = block->satposX + block->satvelX * diff + 0.5 * block->sataccX * diff * diff;
 			position[1] = block->satposY + block->satvelY * diff + 0.5 * block->sataccY * diff * diff;
 			position[2] = block->satposZ + block->satvelZ * diff + 0.5 * block->sataccZ * diff * diff;
-			return;
-			break;
-		case BDS:
-			//BeiDou coordinates
-			//diff-=14; //BeiDou time is 14 seconds ahead of GPS time
-			Mk = block->M0 + (sqrt(muB)/(block->sqrta*block->sqrta*block->sqrta)+block->deltan)*diff; 
-			OMk = block->OMEGA + (block->OMEGADOT-om_eB)*diff - om_eB*block->toe;
-			break;
-		case Galileo:	// True anomaly fk:
-			//Galileo time is synchronized with GPS time in RINEX files!!!
-			Mk = block->M0 + (sqrt(muGal)/(block->sqrta*block->sqrta*block->sqrta)+block->deltan)*diff; 
-			OMk = block->OMEGA + (block->OMEGADOT-om_e)*diff - om_e*block->toe;
+			vel[0] = block->satvelX + block->sataccX * diff;
+			vel[1] = block->satvelY + block->sataccY * diff;
+			vel[2] = block->satvelZ + block->sataccZ * diff;
 			break;
 		case GLONASS:
-			position[0] = 0.;
-			position[1] = 0.;
-			position[2] = 0.;
-			return;
+			getPositionVelocityGLONASS(products, block, t, position, vel);
 			break;
-		default:	//GPS
+		default:
+			switch(GNSS) {
+				case BDS:
+					//BeiDou coordinates
+					//diff-=14; //BeiDou time is 14 seconds ahead of GPS time
+					n = sqrt(muB)/(block->sqrta*block->sqrta*block->sqrta)+block->deltan;
+					OMkdot = block->OMEGADOT-om_eB;
+					break;
+				case Galileo:
+					//Galileo time is synchronized with GPS time in RINEX files!!!
+					n = sqrt(muGal)/(block->sqrta*block->sqrta*block->sqrta)+block->deltan;
+					OMkdot = block->OMEGADOT-om_e;
+					break;
+				default:	//GPS
+					n = sqrt(mu)/(block->sqrta*block->sqrta*block->sqrta)+block->deltan;
+					OMkdot = block->OMEGADOT-om_e;
+					break;
+			}
+			Mk = block->M0 + n*diff;
+			OMk = block->OMEGA + OMkdot*diff - (GNSS==BDS?om_eB:om_e)*block->toe;
+
 			// True anomaly fk:
-			Mk = block->M0 + (sqrt(mu)/(block->sqrta*block->sqrta*block->sqrta)+block->deltan)*diff; 
-			OMk = block->OMEGA + (block->OMEGADOT-om_e)*diff - om_e*block->toe;
+			Ek = nsteffensen(Mk,block->e);
+			if ( Ek < 0 ) Ek += 2 * Pi;
+			if ( Ek > 2 * Pi ) Ek -= 2 * Pi;
+			fk = atan2(sqrt(1-block->e*block->e)*sin(Ek),cos(Ek)-block->e);
+			if ( fk < 0 ) fk += 2 * Pi;
+			if ( fk > 2 * Pi ) fk -= 2 * Pi;
+			
+			// Arg. of Latitude uk,radius rk, inclination ik:
+			uk = block->omega + fk + block->cuc*cos(2*(block->omega+fk)) + block->cus*sin(2*(block->omega+fk));
+			rk = (block->sqrta*block->sqrta)*(1.0-block->e*cos(Ek)) + block->crc*cos(2.0*(block->omega+fk)) + block->crs*sin(2.0*(block->omega+fk));
+			ik = block->i0 + block->IDOT*diff + block->cic*cos(2*(block->omega+fk)) + block->cis*sin(2*(block->omega+fk));
+			
+			// Positions in orbital plane
+			xp = rk * cos(uk);
+			yp = rk * sin(uk);
+
+			// Time derivatives of the orbital parameters
+			Ekdot = n/(1.0-block->e*cos(Ek));
+			fkdot = sqrt(1-block->e*block->e)*Ekdot/(1.0-block->e*cos(Ek));
+			ukdot = fkdot*(1.0 + 2.0*(block->cus*cos(2.0*(block->omega+fk)) - block->cuc*sin(2.0*(block->omega+fk))));
+			rkdot = (block->sqrta*block->sqrta)*block->e*sin(Ek)*Ekdot + 2.0*fkdot*(block->crs*cos(2.0*(block->omega+fk)) - block->crc*sin(2.0*(block->omega+fk)));
+			ikdot = block->IDOT + 2.0*fkdot*(block->cis*cos(2.0*(block->omega+fk)) - block->cic*sin(2.0*(block->omega+fk)));
+			xpdot = rkdot * cos(uk) - yp * ukdot;
+			ypdot = rkdot * sin(uk) + xp * ukdot;
+			
+			if ( GNSS == BDS && block->PRN <= 5 ) {
+			// if(block->sqrta>sqrt(40000000) && (-10*Pi/180)<block->i0 &&  block->i0<10*Pi/180){
+				//Satellite is a BeiDou GEO (BeiDou GEO are from PRN 1 to 5)
+				OMk = block->OMEGA + block->OMEGADOT*diff - om_eB * block->toe; 
+				OMkdot = block->OMEGADOT;
+				X = xp*cos(OMk) - yp*cos(ik)*sin(OMk);
+				Y = xp*sin(OMk) + yp*cos(ik)*cos(OMk);
+				Z = yp*sin(ik);
+				alpha = -5 * Pi / 180;
+				beta = om_eB * diff;
+					
+				position[0] = X * cos(beta) + Y * sin(beta) * cos(alpha) + Z * sin(beta) * sin(alpha);
+				position[1] = X * (-sin(beta)) + Y * cos(beta) * cos(alpha) + Z * cos(beta) * sin(alpha);
+				position[2] = Y * (-sin(alpha)) + Z * cos(alpha);
+
+				Xdot = xpdot*cos(OMk) - ypdot*cos(ik)*sin(OMk) + yp*sin(ik)*sin(OMk)*ikdot - Y*OMkdot;
+				Ydot = xpdot*sin(OMk) + ypdot*cos(ik)*cos(OMk) - yp*sin(ik)*cos(OMk)*ikdot + X*OMkdot;
+				Zdot = ypdot*sin(ik) + yp*cos(ik)*ikdot;
+				vel[0] = Xdot * cos(beta) + Ydot * sin(beta) * cos(alpha) + Zdot * sin(beta) * sin(alpha) + om_eB * position[1];
+				vel[1] = Xdot * (-sin(beta)) + Ydot * cos(beta) * cos(alpha) + Zdot * cos(beta) * sin(alpha) - om_eB * position[0];
+				vel[2] = Ydot * (-sin(alpha)) + Zdot * cos(alpha);
+			} else {
+				// CT-System coordinates
+				position[0] = xp * cos(OMk) - yp * cos(ik) * sin(OMk);
+				position[1] = xp * sin(OMk) + yp * cos(ik) * cos(OMk);
+				position[2] = yp * sin(ik);
+
+				vel[0] = xpdot * cos(OMk) - ypdot * cos(ik) * sin(OMk) + yp * sin(ik) * sin(OMk) * ikdot - position[1] * OMkdot;
+				vel[1] = xpdot * sin(OMk) + ypdot * cos(ik) * cos(OMk) - yp * sin(ik) * cos(OMk) * ikdot + position[0] * OMkdot;
+				vel[2] = ypdot * sin(ik) + yp * cos(ik) * ikdot;
+			}
 			break;
 	}
 
-
-	Ek = nsteffensen(Mk,block->e);
-	if ( Ek < 0 ) Ek += 2 * Pi;
-	if ( Ek > 2 * Pi ) Ek -= 2 * Pi;
-	fk = atan2(sqrt(1-block->e*block->e)*sin(Ek),cos(Ek)-block->e);
-	if ( fk < 0 ) fk += 2 * Pi;
-	if ( fk > 2 * Pi ) fk -= 2 * Pi;
-	
-	// Arg. of Latitude uk,radius rk, inclination ik:
-	uk = block->omega + fk + block->cuc*cos(2*(block->omega+fk)) + block->cus*sin(2*(block->omega+fk));
-	rk = (block->sqrta*block->sqrta)*(1.0-block->e*cos(Ek)) + block->crc*cos(2.0*(block->omega+fk)) + block->crs*sin(2.0*(block->omega+fk));
-	ik = block->i0 + block->IDOT*diff + block->cic*cos(2*(block->omega+fk)) + block->cis*sin(2*(block->omega+fk));
-	
-	// Positions in orbital plane
-	xp = rk * cos(uk);
-	yp = rk * sin(uk);
-	
-	if ( GNSS == BDS && block->PRN <= 5 ) {
-	// if(block->sqrta>sqrt(40000000) && (-10*Pi/180)<block->i0 &&  block->i0<10*Pi/180){
-		//Satellite is a BeiDou GEO (BeiDou GEO are from PRN 1 to 5)
-		OMk = block->OMEGA + block->OMEGADOT*diff - om_eB * block->toe; 
-		X = xp*cos(OMk) - yp*cos(ik)*sin(OMk);
-		Y = xp*sin(OMk) + yp*cos(ik)*cos(OMk);
-		Z = yp*sin(ik);
-		alpha = -5 * Pi / 180;
-		beta = om_eB * diff;
-			
-		position[0] = X * cos(beta) + Y * sin(beta) * cos(alpha) + Z * sin(beta) * sin(alpha);
-		position[1] = X * (-sin(beta)) + Y * cos(beta) * cos(alpha) + Z * cos(beta) * sin(alpha);
-		position[2] = Y * (-sin(alpha)) + Z * cos(alpha);
-	} else {
-		// CT-System coordinates
-		position[0] = xp * cos(OMk) - yp * cos(ik) * sin(OMk);
-		position[1] = xp * sin(OMk) + yp * cos(ik) * cos(OMk);
-		position[2] = yp * sin(ik);
+	if ( ITRFvel != NULL ) {
+		memcpy(ITRFvel, vel, sizeof(double) * 3);
+	}
+	if ( velocity != NULL ) {
+		// Add the Earth rotation to obtain the inertial velocity in the ECEF axes at time t
+		velocity[0] = vel[0] - EARTH_ROTATION * position[1];
+		velocity[1] = vel[1] + EARTH_ROTATION * position[0];
+		velocity[2] = vel[2];
 	}
 }
 
 /*****************************************************************************
- * Name        : getVelocityBRDC
- * Description : Get the velocity of the satellite from specified ephemeris block
+ * Name        : getPositionBRDC
+ * Description : Get the position of the satellite from specified ephemeris block
  * Parameters  :
  * Name                           |Da|Unit|Description
  * TBRDCproducts *products         I  N/A  Ephemerides products
  * TBRDCblock  *block              I  N/A  TBRDCblock structure
  * TTime  *t                       I  N/A  Reference time
- * double  *position               I  N/A  Satellite position (3D vector) at time t.
- *                                         It is used to avoid for optimisation
- *                                         purposes, to avoid recomputing it when
- *                                         obtaining satellite PVT. If this parameter
- *                                         is NULL, the position at t is computed.
- * double  *velocity               O  m/s  3D vector with the satellite velocity
- * enum SatelliteVelocity  sv      I  N/A  Chooses if svINERTIAL or svITRF velocity
- *                                         is computed 
  * enum GNSSystem  GNSS            I  N/A  GNSS enumerator of the satellite
+ * double  *position               O  m    3D vector with the satellite position
  *****************************************************************************/
-void getVelocityBRDC (TBRDCproducts *products, TBRDCblock *block, TTime *t, double *position, double *velocity, enum SatelliteVelocity satVel, enum GNSSystem GNSS) {
-	const double	diffTime = 0.001;
-	double			pos[3],posPrev[3];
-	TTime			tPrev;
-	int				i;
-	
-	// Position at t
-	if ( position == NULL ) {
-		getPositionBRDC(products,block,t,GNSS,pos);
-	} else {
-		memcpy(pos, position, sizeof(double) * 3);
-	}
-	
-	// Position at t-diffTime
-	memcpy(&tPrev, t, sizeof(TTime));
-	tPrev.SoD -= diffTime;
-	getPositionBRDC(products,block,&tPrev,GNSS,posPrev);
-	
-	// Earth rotation in diffTime
-	if ( satVel == svINERTIAL ) {
-		correctEarthRotation(posPrev, diffTime);
-	}
-
-	// Estimate velocity
-	for ( i = 0; i < 3; i++ ) velocity[i] = (pos[i] - posPrev[i]) / diffTime;
+void getPositionBRDC (TBRDCproducts *products, TBRDCblock *block,TTime *t, enum GNSSystem GNSS, double *position) {
+	getPositionVelocityBRDC(products, block, t, GNSS, position, NULL, NULL);
 }
 
 /*****************************************************************************
@@ -1254,7 +1433,7 @@ double getClockSP3 (TGNSSproducts *products, TTime *t, enum GNSSystem GNSS, int
  *****************************************************************************/
 int getPositionSP3 (TGNSSproducts *products,TTime *t,enum GNSSystem GNSS,int PRN,double *position,TOptions *options) {
 	int				ind;
-	int				i,k=-1;
+	int				i,j,k=-1;
 	double			tInitDistance,tEndDistance;
 	int				pointsBelow = 0;
 	int				prevSample;
@@ -1265,6 +1444,7 @@ int getPositionSP3 (TGNSSproducts *products,TTime *t,enum GNSSystem GNSS,int PRN
 	const int		numSamples=options->orbitInterpolationDegree+1;
 	double			pos[3][2*(MAX_INTERPOLATION_DEGREE+1)];
 	TTime			tPrev[2*(MAX_INTERPOLATION_DEGREE+1)];
+	double			weights[2*(MAX_INTERPOLATION_DEGREE+1)];
 	int				halfDeg;
 	int				numblocs;
 	int				startSample,samplesRemaining;
@@ -1437,8 +1617,13 @@ int getPositionSP3 (TGNSSproducts *products,TTime *t,enum GNSSystem GNSS,int PRN
 			//If no upper samples are found check that they are not too far for extrapolation
 			if (tdiff(t,&tPrev[startSample+options->orbitInterpolationDegree])>MAXEXTRAPOLATIONTIME) return 0;
 		}
+		//The weights of the samples are the same for the three coordinates
+		lagrangeWeights(options->orbitInterpolationDegree,t,&tPrev[startSample],weights);
 		for(i=0;i<3;i++) {
-			position[i] = lagrangeInterpolation(options->orbitInterpolationDegree,*t,&tPrev[startSample],&pos[i][startSample]);
+			position[i] = 0;
+			for(j=0;j<=options->orbitInterpolationDegree;j++) {
+				position[i] += weights[j]*pos[i][startSample+j];
+			}
 		}
 		
 		return 1;
@@ -1535,6 +1720,7 @@ int getVelocitySP3 (TGNSSproducts *products,TTime *t,enum GNSSystem GNSS,int PRN
  *****************************************************************************/
 int getSatellitePVTBRDCraw (TGNSSproducts *products, TTime *t, enum GNSSystem GNSS, int PRN, double *position, double *velocity, double *ITRFvel, double *clock, int SBASIOD, TOptions *options) {
 	TBRDCblock		*block;
+	double			pos[3];
 	
 	if (products->type != BRDC) return 0;
 	
@@ -1547,17 +1733,11 @@ int getSatellitePVTBRDCraw (TGNSSproducts *products, TTime *t, enum GNSSystem GN
 		*clock = getClockBRDC(block,t);
 	}
 	
-	// Obtain satellite position
+	// Obtain satellite position and velocity
 	if (position!=NULL) {
-		getPositionBRDC(products->BRDC,block,t,GNSS,position);
-	}
-	
-	// Obtain satellite velocity
-	if (velocity!=NULL) {
-		getVelocityBRDC(products->BRDC,block,t,position,velocity,svINERTIAL,GNSS);
-	}
-	if (ITRFvel!=NULL) {
-		getVelocityBRDC(products->BRDC,block,t,position,ITRFvel,svITRF,GNSS);
+		getPositionVelocityBRDC(products->BRDC,block,t,GNSS,position,velocity,ITRFvel);
+	} else if (velocity!=NULL || ITRFvel!=NULL) {
+		getPositionVelocityBRDC(products->BRDC,block,t,GNSS,pos,velocity,ITRFvel);
 	}
 	
 	return 1;
@@ -1796,16 +1976,16 @@ void fillLineOfSight (TEpoch *epoch, int satIndex) {
 }
 
 /*****************************************************************************
- * Name        : findMoon
+ * Name        : moonInertialPosition
  * Description : Obtains the position vector of the Moon in relation to Earth 
- *               (in ECEF). Source: 
+ *               (in the inertial system). Source: 
  *               O. Montenbruck and G. Eberhard, Satellite Orbits, pp. 70-73, Springer, 2000
  * Parameters  :
  * Name                           |Da|Unit|Description
  * TTime  *t                       I  N/A  Reference time
  * double  *moonPosition           O  Km   Moon position at t
  *****************************************************************************/
-void findMoon (TTime *t, double* moonPosition) {
+void moonInertialPosition (TTime *t, double* moonPosition) {
 	double	T;
 	double	L0;
 	double 	l;
@@ -1816,12 +1996,6 @@ void findMoon (TTime *t, double* moonPosition) {
 	double	latitude;
 	double	distance;
 	double	obliquity = 23.43929111*d2r;
-	double	fday;
-	double	JDN;
-	double	gstr;
-	
-	fday = t->SoD/86400;
-	JDN = t->MJDN-15019.5 + fday;
 	
 	T 	= (t->MJDN - 51544.5  + t->SoD/86400)/36525.0;
 	L0	= (218.31617 + 481267.88088*T - 1.3972*T)*d2r;
@@ -1860,22 +2034,18 @@ void findMoon (TTime *t, double* moonPosition) {
 	moonPosition[2] = distance * sin(latitude);
 	
 	rotate(moonPosition,-obliquity,1);
-	
-	// Rotate from inertial to non inertial system (ECI to ECEF)
-	gstr = modulo(279.690983 + 0.9856473354*JDN + 360*fday + 180,360)*d2r;
-	rotate(moonPosition,gstr,3);
 }
 
 /*****************************************************************************
- * Name        : findSun
- * Description : Obtains the position vector of the Sun in relation to Earth
- *               (in ECEF).
+ * Name        : sunInertialPosition
+ * Description : Obtains the position vector of the Sun in relation to Earth 
+ *               (in the inertial system)
  * Parameters  :
  * Name                           |Da|Unit|Description
  * TTime  *t                       I  N/A  Reference time
  * double  *sunPosition            O  Km   Sun position at t
  *****************************************************************************/
-void findSun (TTime *t, double* sunPosition) {
+void sunInertialPosition (TTime *t, double* sunPosition) {
 	double	gstr;
 	double	slong;
 	double	sra;
@@ -1886,9 +2056,181 @@ void findSun (TTime *t, double* sunPosition) {
 	sunPosition[0] = cos(sdec*d2r) * cos((sra)*d2r) * AU;
 	sunPosition[1] = cos(sdec*d2r) * sin((sra)*d2r) * AU;
 	sunPosition[2] = sin(sdec*d2r) * AU;
+}
+
+/*****************************************************************************
+ * Name        : GMST
+ * Description : Greenwich sidereal angle used to go from the inertial system 
+ *               to ECEF. It is linear in time, so it is computed directly
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TTime  *t                       I  N/A  Reference time
+ * Returned value (double)         O  rad  Greenwich sidereal angle
+ *****************************************************************************/
+double GMST (TTime *t) {
+	double	fday;
+	double	JDN;
+	
+	fday = t->SoD/86400;
+	JDN = t->MJDN-15019.5 + fday;
+	
+	return modulo(279.690983 + 0.9856473354*JDN + 360*fday + 180,360)*d2r;
+}
+
+/*****************************************************************************
+ * Name        : getCelestialDay
+ * Description : Returns the Sun and Moon Chebyshev fit of a day, computing it
+ *               the first time the day is requested. The fits are shared by
+ *               all threads: each day is written once inside a critical section
+ *               and never modified afterwards
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * int  MJDN                       I  N/A  Modified Julian Day Number
+ * Returned value (TCelestialDay*) O  N/A  Fit of the day
+ *                                         NULL => The cache entry is used by another day
+ *****************************************************************************/
+TCelestialDay *getCelestialDay (int MJDN) {
+	static TCelestialDay	*days[CELESTIAL_CACHE_DAYS];
+	TCelestialDay			*day;
+	TTime					t;
+	double					sunNode[CELESTIAL_CHEBYSHEV_COEFS][3];
+	double					moonNode[CELESTIAL_CHEBYSHEV_COEFS][3];
+	double					theta;
+	int						slot;
+	int						i,j,k;
+
+	if ( MJDN < 0 ) return NULL;
+	slot = MJDN % CELESTIAL_CACHE_DAYS;
+
+	#pragma omp atomic read
+	day = days[slot];
+
+	if ( day == NULL ) {
+		#pragma omp critical (celestialCache)
+		{
+			day = days[slot];
+			if ( day == NULL ) {
+				day = malloc(sizeof(TCelestialDay));
+				if ( day != NULL ) {
+					// Evaluate the series at the Chebyshev nodes of the day
+					day->MJDN = MJDN;
+					t.MJDN = MJDN;
+					for ( k = 0; k < CELESTIAL_CHEBYSHEV_COEFS; k++ ) {
+						t.SoD = 43200*(1+cos(Pi*(k+0.5)/CELESTIAL_CHEBYSHEV_COEFS));
+						sunInertialPosition(&t,sunNode[k]);
+						moonInertialPosition(&t,moonNode[k]);
+					}
+					for ( j = 0; j < CELESTIAL_CHEBYSHEV_COEFS; j++ ) {
+						for ( i = 0; i < 3; i++ ) {
+							day->sun[i][j] = 0;
+							day->moon[i][j] = 0;
+						}
+						for ( k = 0; k < CELESTIAL_CHEBYSHEV_COEFS; k++ ) {
+							theta = cos(Pi*j*(k+0.5)/CELESTIAL_CHEBYSHEV_COEFS);
+							for ( i = 0; i < 3; i++ ) {
+								day->sun[i][j] += sunNode[k][i]*theta;
+								day->moon[i][j] += moonNode[k][i]*theta;
+							}
+						}
+						for ( i = 0; i < 3; i++ ) {
+							day->sun[i][j] *= 2./CELESTIAL_CHEBYSHEV_COEFS;
+							day->moon[i][j] *= 2./CELESTIAL_CHEBYSHEV_COEFS;
+						}
+					}
+					// The fit has to be visible to the other threads before its pointer
+					#pragma omp flush
+					#pragma omp atomic write
+					days[slot] = day;
+				}
+			}
+		}
+	} else {
+		#pragma omp flush
+	}
+
+	if ( day == NULL || day->MJDN != MJDN ) return NULL;
+	return day;
+}
+
+/*****************************************************************************
+ * Name        : celestialInertialPosition
+ * Description : Obtains the Sun or Moon inertial position from the daily 
+ *               Chebyshev fit (Clenshaw evaluation)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TTime  *t                       I  N/A  Reference time
+ * int  moon                       I  N/A  0 => Sun
+ *                                         1 => Moon
+ * double  *position               O  Km   Position at t
+ * Returned value (int)            O  N/A  0 => Fit not available (position not computed)
+ *                                         1 => Position computed
+ *****************************************************************************/
+int celestialInertialPosition (TTime *t, int moon, double *position) {
+	TCelestialDay	*day;
+	double			(*coef)[CELESTIAL_CHEBYSHEV_COEFS];
+	double			x,b0,b1,b2;
+	int				MJDN;
+	int				i,j;
+
+	MJDN = t->MJDN;
+	x = t->SoD;
+	if ( x < 0 || x > 86400 ) {
+		MJDN += (int)floor(x/86400);
+		x -= (MJDN-t->MJDN)*86400.;
+	}
+
+	day = getCelestialDay(MJDN);
+	if ( day == NULL ) return 0;
+	coef = moon ? day->moon : day->sun;
+
+	x = x/43200 - 1;
+	for ( i = 0; i < 3; i++ ) {
+		b1 = 0;
+		b2 = 0;
+		for ( j = CELESTIAL_CHEBYSHEV_COEFS-1; j > 0; j-- ) {
+			b0 = 2*x*b1 - b2 + coef[i][j];
+			b2 = b1;
+			b1 = b0;
+		}
+		position[i] = x*b1 - b2 + coef[i][0]/2;
+	}
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : findMoon
+ * Description : Obtains the position vector of the Moon in relation to Earth 
+ *               (in ECEF), using the daily Chebyshev fit of the series
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TTime  *t                       I  N/A  Reference time
+ * double  *moonPosition           O  Km   Moon position at t
+ *****************************************************************************/
+void findMoon (TTime *t, double* moonPosition) {
+	if ( !celestialInertialPosition(t,1,moonPosition) ) {
+		moonInertialPosition(t,moonPosition);
+	}
 	
 	// Rotate from inertial to non inertial system (ECI to ECEF)
-	rotate(sunPosition,gstr*d2r,3);
+	rotate(moonPosition,GMST(t),3);
+}
+
+/*****************************************************************************
+ * Name        : findSun
+ * Description : Obtains the position vector of the Sun in relation to Earth
+ *               (in ECEF), using the daily Chebyshev fit of the series
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TTime  *t                       I  N/A  Reference time
+ * double  *sunPosition            O  Km   Sun position at t
+ *****************************************************************************/
+void findSun (TTime *t, double* sunPosition) {
+	if ( !celestialInertialPosition(t,0,sunPosition) ) {
+		sunInertialPosition(t,sunPosition);
+	}
+	
+	// Rotate from inertial to non inertial system (ECI to ECEF)
+	rotate(sunPosition,GMST(t),3);
 }
 
 /*****************************************************************************
@@ -1903,15 +2245,6 @@ void findSun (TTime *t, double* sunPosition) {
  * double*  sdec                   O  rad  Sun declination
  *****************************************************************************/
 void GSDtime_sun (TTime *t, double *gstr, double *slong, double *sra, double *sdec) {
-	//Static variables are shared between threads (as they are saved in the data segment).
-	//To avoid race conditions, we need to set the directive '#pragma omp threadprivate()'
-	//directive to make OpenMP create a local (static) copy for each thread
-	static int		first = 1;
-	#pragma omp threadprivate(first)
-	static TTime	lastTimeComputed;
-	#pragma omp threadprivate(lastTimeComputed)
-	static double	gstrRec,slongRec,sraRec,sdecRec;
-	#pragma omp threadprivate(gstrRec,slongRec,sraRec,sdecRec)
 	double			JDN;
 	double			fday;
 	double			vl;
@@ -1921,20 +2254,6 @@ void GSDtime_sun (TTime *t, double *gstr, double *slong, double *sra, double *sd
 	double			sind;
 	double			cosd;
 	
-	if (first) {
-		first = 0;
-		lastTimeComputed.MJDN = 0;
-		lastTimeComputed.SoD = 0;
-	}
-	
-	if (tdiff(t,&lastTimeComputed)==0) {
-		*gstr = gstrRec;
-		*slong = slongRec;
-		*sra = sraRec;
-		*sdec = sdecRec;
-		return;
-	}
-	
 	fday = t->SoD/86400;
 	JDN = t->MJDN-15019.5 + fday;
 	
@@ -1951,12 +2270,6 @@ void GSDtime_sun (TTime *t, double *gstr, double *slong, double *sra, double *sd
 	*sdec = atan2(sind,cosd)/d2r;
 	
 	*sra = 180 - atan2(sind/cosd/tan(obliq),-cos(slp)/cosd)/d2r;
-	
-	slongRec = *slong;
-	sraRec = *sra;
-	gstrRec = *gstr;
-	sdecRec = *sdec;
-	memcpy(&lastTimeComputed,t,sizeof(TTime));
 }
 
 /*****************************************************************************
@@ -2683,7 +2996,6 @@ double ionexModel (TEpoch *epoch, int satIndex, TIONEX *ionex, TOptions *options
 	int				totalSecIonex;
 	int				totalSecEpoch;
 	int				mapTimePosition;
-	int				mapType = 0; // 0->TEC 1->RMS 2->HGT
 	int				ilat,ilon;
 	int				onlyLastMapUsed = 0;
 	double			ilonvalue;
@@ -2703,7 +3015,9 @@ double ionexModel (TEpoch *epoch, int satIndex, TIONEX *ionex, TOptions *options
 	double			upRightpoint[3];
 	double			TECtimeInterpolation[2];
 	double			RMStimeInterpolation[2];
-	TPiercePoint	*ionexPiercePointvector = NULL;
+	int				mappingComputed[ionex->map[0].nhgt];
+	TPiercePoint	basePiercePoint[ionex->map[0].nhgt]; //Pierce points are the same for both maps (only the rotation differs)
+	TPiercePoint	ionexPiercePointvector[ionex->map[0].nhgt];
 
 
 	//Auxiliary variables to avoid repetitive calculus and make code more readable
@@ -2788,14 +3102,19 @@ double ionexModel (TEpoch *epoch, int satIndex, TIONEX *ionex, TOptions *options
 		
 		for ( i=0; i < ionex->map[0].nhgt; i++ ) {
 			
-			//ionexPiercePointvector = malloc(sizeof(TPiercePoint)*(i+1));
-			ionexPiercePointvector = (TPiercePoint*) (realloc(ionexPiercePointvector,sizeof(TPiercePoint)*(i+1)));
-			initPiercePoint(&ionexPiercePointvector[i]);
-			currentMapAltitude[i] = ionex->map[0].hgt1 + ionex->map[0].dhgt*i; //Stored in Km 
+			if (j==0) {
+				initPiercePoint(&basePiercePoint[i]);
+				currentMapAltitude[i] = ionex->map[0].hgt1 + ionex->map[0].dhgt*i; //Stored in Km 
+				mappingComputed[i] = 0;
 			
-			
-			//Calculate the Iono Pierce Point at current height
-			getIonoPiercePoint(epoch, &ionexPiercePointvector[i], satIndex, ionex->baseRadius, currentMapAltitude[i],0);
+				//Calculate the Iono Pierce Point at current height
+				getIonoPiercePoint(epoch, &basePiercePoint[i], satIndex, ionex->baseRadius, currentMapAltitude[i],0);
+			} else {
+				//The pierce point only depends on the height, so it is reused for the later map
+				epoch->IPPlat = basePiercePoint[i].fi;
+				epoch->IPPlon = basePiercePoint[i].longitude;
+			}
+			ionexPiercePointvector[i] = basePiercePoint[i];
 
 			//Check if latitude value is in range (some IONEX files, latitude start or end at a value smaller than 90º, thus not covering the poles or more. If this PiercePoint is in the pole and IONEX file has no data, this points must be discarded
 			if (ionex->map[mapTimePosition].dlat > 0 ) {
@@ -2892,7 +3211,7 @@ double ionexModel (TEpoch *epoch, int satIndex, TIONEX *ionex, TOptions *options
 			if ( lowLeftpoint[0] != ionex->map[mapTimePosition].lat2 ) {
 				if ( (lowLeftpoint[1] == ionex->map[mapTimePosition].lon2) && (totalLongitude == (360.0 - fabs(ionex->map[mapTimePosition].dlon)) ) ) { 
 					upRightpoint[0] = lowLeftpoint[0] + ionex->map[mapTimePosition].dlat;
-					upLeftpoint[1] = ionex->map[mapTimePosition].lon1;
+					upRightpoint[1] = ionex->map[mapTimePosition].lon1;
 					upRightpoint[2] = currentMapAltitude[i];
 				} else if ( lowLeftpoint[1] != ionex->map[mapTimePosition].lon2 ) {
 					upRightpoint[0] = lowLeftpoint[0] + ionex->map[mapTimePosition].dlat;
@@ -2902,25 +3221,21 @@ double ionexModel (TEpoch *epoch, int satIndex, TIONEX *ionex, TOptions *options
 				}
 			}
 
-			//Recover TEC data from the four points
-			TEClowLeft = getIonoValue(&ionex->map[mapTimePosition], mapType, lowLeftpoint[2], lowLeftpoint[0], lowLeftpoint[1]);
-			RMSlowLeft = getIonoValue(&ionex->map[mapTimePosition], 1+mapType, lowLeftpoint[2], lowLeftpoint[0], lowLeftpoint[1]);
+			//Recover TEC and RMS data from the four points
+			getIonoValueTECRMS(&ionex->map[mapTimePosition], lowLeftpoint[2], lowLeftpoint[0], lowLeftpoint[1], &TEClowLeft, &RMSlowLeft);
 
 			if ( lowLeftpoint[0] != ionex->map[mapTimePosition].lat2 ){	
-				TEClowRight = getIonoValue(&ionex->map[mapTimePosition], mapType, lowRightpoint[2], lowRightpoint[0], lowRightpoint[1]); 
-				RMSlowRight = getIonoValue(&ionex->map[mapTimePosition], 1+mapType, lowRightpoint[2], lowRightpoint[0], lowRightpoint[1]); 
+				getIonoValueTECRMS(&ionex->map[mapTimePosition], lowRightpoint[2], lowRightpoint[0], lowRightpoint[1], &TEClowRight, &RMSlowRight);
 			} else {
 				TEClowRight = 0;
 				RMSlowRight = 0;
 			}
 
 			if ( (lowLeftpoint[1] == ionex->map[mapTimePosition].lon2) && (totalLongitude == (360.0 - fabs(ionex->map[mapTimePosition].dlon)) ) ) {
-				TECupLeft = getIonoValue(&ionex->map[mapTimePosition], mapType, upLeftpoint[2], upLeftpoint[0], upLeftpoint[1]);
-				RMSupLeft = getIonoValue(&ionex->map[mapTimePosition], 1+mapType, upLeftpoint[2], upLeftpoint[0], upLeftpoint[1]);
+				getIonoValueTECRMS(&ionex->map[mapTimePosition], upLeftpoint[2], upLeftpoint[0], upLeftpoint[1], &TECupLeft, &RMSupLeft);
 
 			} else if ( lowLeftpoint[1] != ionex->map[mapTimePosition].lon2 ){
-				TECupLeft = getIonoValue(&ionex->map[mapTimePosition], mapType, upLeftpoint[2], upLeftpoint[0], upLeftpoint[1]);
-				RMSupLeft = getIonoValue(&ionex->map[mapTimePosition], 1+mapType, upLeftpoint[2], upLeftpoint[0], upLeftpoint[1]);
+				getIonoValueTECRMS(&ionex->map[mapTimePosition], upLeftpoint[2], upLeftpoint[0], upLeftpoint[1], &TECupLeft, &RMSupLeft);
 			} else {
 				TECupLeft = 0;
 				RMSupLeft = 0;
@@ -2928,11 +3243,9 @@ double ionexModel (TEpoch *epoch, int satIndex, TIONEX *ionex, TOptions *options
 			
 			if ( lowLeftpoint[0] != ionex->map[mapTimePosition].lat2 ) {
 				if ( (lowLeftpoint[1] == ionex->map[mapTimePosition].lon2) && (totalLongitude == (360.0 - fabs(ionex->map[mapTimePosition].dlon)) ) ) { 
-					TECupRight = getIonoValue(&ionex->map[mapTimePosition], mapType, upRightpoint[2], upRightpoint[0], upRightpoint[1]);
-					RMSupRight = getIonoValue(&ionex->map[mapTimePosition], 1+mapType, upRightpoint[2], upRightpoint[0], upRightpoint[1]);
+					getIonoValueTECRMS(&ionex->map[mapTimePosition], upRightpoint[2], upRightpoint[0], upRightpoint[1], &TECupRight, &RMSupRight);
 				} else if ( lowLeftpoint[1] != ionex->map[mapTimePosition].lon2 ) {
-					TECupRight = getIonoValue(&ionex->map[mapTimePosition], mapType, upRightpoint[2], upRightpoint[0], upRightpoint[1]);
-					RMSupRight = getIonoValue(&ionex->map[mapTimePosition], 1+mapType, upRightpoint[2], upRightpoint[0], upRightpoint[1]);
+					getIonoValueTECRMS(&ionex->map[mapTimePosition], upRightpoint[2], upRightpoint[0], upRightpoint[1], &TECupRight, &RMSupRight);
 				} else {		
 					TECupRight = 0;
 					RMSupRight = 0;
@@ -2961,8 +3274,12 @@ double ionexModel (TEpoch *epoch, int satIndex, TIONEX *ionex, TOptions *options
 			currentHgtInterpolation = TEClowLeft*(1-unitaryLonDiff)*(1-unitaryLatDiff) + TEClowRight*(1-unitaryLonDiff)*unitaryLatDiff + TECupLeft*unitaryLonDiff*(1-unitaryLatDiff) + TECupRight*unitaryLonDiff*unitaryLatDiff;
 			currentRMSInterpolation = RMSlowLeft*(1-unitaryLonDiff)*(1-unitaryLatDiff) + RMSlowRight*(1-unitaryLonDiff)*unitaryLatDiff + RMSupLeft*unitaryLonDiff*(1-unitaryLatDiff) + RMSupRight*unitaryLonDiff*unitaryLatDiff;
 			
-			//Calculate mapping function
-			getMappingFunction(&ionexPiercePointvector[i], ionex->baseRadius, currentMapAltitude[i], ionex->mappingFunction, options);
+			//Calculate mapping function (it only depends on the elevation, so it is computed once per height)
+			if (mappingComputed[i]==0) {
+				getMappingFunction(&basePiercePoint[i], ionex->baseRadius, currentMapAltitude[i], ionex->mappingFunction, options);
+				mappingComputed[i] = 1;
+			}
+			ionexPiercePointvector[i].mappingFunction = basePiercePoint[i].mappingFunction;
 
 			//Add current height interpolation with previous interpolation
 			TECtimeInterpolation[j] += currentHgtInterpolation*ionexPiercePointvector[i].mappingFunction;
@@ -2970,9 +3287,6 @@ double ionexModel (TEpoch *epoch, int satIndex, TIONEX *ionex, TOptions *options
 
 	
 		} //End of height interpolation
-
-		free(ionexPiercePointvector);
-		ionexPiercePointvector=NULL;
 		
 	} //End of time interpolation
 
@@ -3017,7 +3331,6 @@ double FPPPModel (TEpoch *epoch, int satIndex, TFPPPIONEX *fppp, TOptions *optio
 	int				totalSecIonex;
 	int				totalSecEpoch;
 	int				mapTimePosition;
-	int				mapType = 0; // 0->TEC 1->RMS 2->HGT	
 	int				ilat,ilt;
 	int				onlyLastMapUsed = 0;
 	double			unitaryEarlierTimeDiff;
@@ -3035,7 +3348,8 @@ double FPPPModel (TEpoch *epoch, int satIndex, TFPPPIONEX *fppp, TOptions *optio
 	double			upRightpoint[3];
 	double			TECtimeInterpolation[2];
 	double			RMStimeInterpolation[2];
-	TPiercePoint	*ionexPiercePointvector = NULL;
+	int				mappingComputed[NUMBERFPPPMAPS];
+	TPiercePoint	ionexPiercePointvector[NUMBERFPPPMAPS]; //Pierce points are the same for both maps
 
 
 	//Auxiliary variables to avoid repetitive calculus and make code more readable
@@ -3116,17 +3430,22 @@ double FPPPModel (TEpoch *epoch, int satIndex, TFPPPIONEX *fppp, TOptions *optio
 
 		for(i=0;i < NUMBERFPPPMAPS; i++) {
 			
-			ionexPiercePointvector = (TPiercePoint*) (realloc(ionexPiercePointvector,sizeof(TPiercePoint)*(i+1)));
-			initPiercePoint(&ionexPiercePointvector[i]);
-			currentMapAltitude[i] = fppp->map[0].hgt1 + fppp->map[0].dhgt*i; //Stored in Km 
-
-
-			//Calculate the Iono Pierce Point at current height
-			getIonoPiercePoint(epoch, &ionexPiercePointvector[i], satIndex, fppp->baseRadius, currentMapAltitude[i],0);
-			//Search for local time position
-			ionexPiercePointvector[i].localtime = ionexPiercePointvector[i].longitude + epoch->t.SoD*(1/(double)NUMBERSECONDSPERHOUR)*15.0;
-			//Move localtime value to range 0 360
-			ionexPiercePointvector[i].localtime = modulo(ionexPiercePointvector[i].localtime+360.0,360);
+			if (j==0) {
+				initPiercePoint(&ionexPiercePointvector[i]);
+				currentMapAltitude[i] = fppp->map[0].hgt1 + fppp->map[0].dhgt*i; //Stored in Km 
+				mappingComputed[i] = 0;
+
+				//Calculate the Iono Pierce Point at current height
+				getIonoPiercePoint(epoch, &ionexPiercePointvector[i], satIndex, fppp->baseRadius, currentMapAltitude[i],0);
+				//Search for local time position
+				ionexPiercePointvector[i].localtime = ionexPiercePointvector[i].longitude + epoch->t.SoD*(1/(double)NUMBERSECONDSPERHOUR)*15.0;
+				//Move localtime value to range 0 360
+				ionexPiercePointvector[i].localtime = modulo(ionexPiercePointvector[i].localtime+360.0,360);
+			} else {
+				//The pierce point only depends on the height, so it is reused for the later map
+				epoch->IPPlat = ionexPiercePointvector[i].fi;
+				epoch->IPPlon = ionexPiercePointvector[i].longitude;
+			}
 			
 
 			//Calculate latitude and local time for the four TEC values surrounding current pierce point
@@ -3182,8 +3501,7 @@ double FPPPModel (TEpoch *epoch, int satIndex, TFPPPIONEX *fppp, TOptions *optio
 
 			//Recover TEC data from the four points
 			if( ionexPiercePointvector[i].fi >= fppp->map[mapTimePosition].lat1 && ionexPiercePointvector[i].fi <= fppp->map[mapTimePosition].lat2){
-				TEClowLeft = getFPPPValue(&fppp->map[mapTimePosition], mapType, lowLeftpoint[2], lowLeftpoint[0], lowLeftpoint[1]);
-				RMSlowLeft = getFPPPValue(&fppp->map[mapTimePosition], 1-mapType, lowLeftpoint[2], lowLeftpoint[0], lowLeftpoint[1]);
+				getFPPPValueTECSIGMA(&fppp->map[mapTimePosition], lowLeftpoint[2], lowLeftpoint[0], lowLeftpoint[1], &TEClowLeft, &RMSlowLeft);
 			} else { //
 				TEClowLeft = 9999;
 				epoch->sat[satIndex].validIono = 0;
@@ -3191,19 +3509,16 @@ double FPPPModel (TEpoch *epoch, int satIndex, TFPPPIONEX *fppp, TOptions *optio
 			}
 
 			if ( lowLeftpoint[0] != fppp->map[mapTimePosition].lat2 ){ 	
-				TEClowRight = getFPPPValue(&fppp->map[mapTimePosition], mapType, lowRightpoint[2], lowRightpoint[0], lowRightpoint[1]); 
-				RMSlowRight = getFPPPValue(&fppp->map[mapTimePosition], 1-mapType, lowRightpoint[2], lowRightpoint[0], lowRightpoint[1]); 
+				getFPPPValueTECSIGMA(&fppp->map[mapTimePosition], lowRightpoint[2], lowRightpoint[0], lowRightpoint[1], &TEClowRight, &RMSlowRight);
 			} else {
 				TEClowRight = 0;
 				RMSlowRight = 0;
 			}
 
-			TECupLeft = getFPPPValue(&fppp->map[mapTimePosition], mapType, upLeftpoint[2], upLeftpoint[0], upLeftpoint[1]);
-			RMSupLeft = getFPPPValue(&fppp->map[mapTimePosition], 1-mapType, upLeftpoint[2], upLeftpoint[0], upLeftpoint[1]);
+			getFPPPValueTECSIGMA(&fppp->map[mapTimePosition], upLeftpoint[2], upLeftpoint[0], upLeftpoint[1], &TECupLeft, &RMSupLeft);
 			
 			if ( lowLeftpoint[0] != fppp->map[mapTimePosition].lat2 ){
-				TECupRight = getFPPPValue(&fppp->map[mapTimePosition], mapType, upRightpoint[2], upRightpoint[0], upRightpoint[1]);
-				RMSupRight = getFPPPValue(&fppp->map[mapTimePosition], 1-mapType, upRightpoint[2], upRightpoint[0], upRightpoint[1]);
+				getFPPPValueTECSIGMA(&fppp->map[mapTimePosition], upRightpoint[2], upRightpoint[0], upRightpoint[1], &TECupRight, &RMSupRight);
 			} else {		
 				TECupRight = 0;
 				RMSupRight = 0;
@@ -3229,8 +3544,11 @@ double FPPPModel (TEpoch *epoch, int satIndex, TFPPPIONEX *fppp, TOptions *optio
 			currentHgtInterpolation = TEClowLeft*(1-unitaryLtDiff)*(1-unitaryLatDiff) + TEClowRight*(1-unitaryLtDiff)*unitaryLatDiff + TECupLeft*unitaryLtDiff*(1-unitaryLatDiff) + TECupRight*unitaryLtDiff*unitaryLatDiff;
 			currentRMSInterpolation = RMSlowLeft*(1-unitaryLtDiff)*(1-unitaryLatDiff) + RMSlowRight*(1-unitaryLtDiff)*unitaryLatDiff + RMSupLeft*unitaryLtDiff*(1-unitaryLatDiff) + RMSupRight*unitaryLtDiff*unitaryLatDiff;
 			
-			//Calculate mapping function
-			getMappingFunction(&ionexPiercePointvector[i], fppp->baseRadius, currentMapAltitude[i], fppp->mappingFunction, options);
+			//Calculate mapping function (it only depends on the elevation, so it is computed once per height)
+			if (mappingComputed[i]==0) {
+				getMappingFunction(&ionexPiercePointvector[i], fppp->baseRadius, currentMapAltitude[i], fppp->mappingFunction, options);
+				mappingComputed[i] = 1;
+			}
 
 			//Add current height interpolation with previous interpolation
 			TECtimeInterpolation[j] += currentHgtInterpolation*ionexPiercePointvector[i].mappingFunction;
@@ -3238,9 +3556,6 @@ double FPPPModel (TEpoch *epoch, int satIndex, TFPPPIONEX *fppp, TOptions *optio
 
 	
 		} //End of height interpolation
-
-		free(ionexPiercePointvector);
-		ionexPiercePointvector=NULL;
 		
 	} //End of time interpolation
 
@@ -4228,6 +4543,7 @@ int modelSatellite (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, TGNSSproduc
 	double		sigmaTotal=0.;
 	double 		sigmaMultipath, sigmaAir, sigmaDegradation;
 	double 		deltaPRC,deltaRRC;
+	double		perfT;
 	enum		MeasurementType	meas;
 	TTime		t;
 	TSBAScorr	SBAScorr;
@@ -4339,7 +4655,9 @@ int modelSatellite (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, TGNSSproduc
 		res2 = 1;
 	} else {
 		// Compute satellite coordinates, velocity, and clocks
+		perfT = perfStart();
 		res2 = fillSatellitePVT(epoch,products,&t,flightTime,satIndex,1,1,options->satelliteClockCorrection,SBAScorr.IOD,constellation,options);
+		perfStop(perfORBIT,perfT);
 	
 		// Stop computing models if any problem had arisen to save computing time
 		if ( res2 == 0 ) return 0;
@@ -4402,7 +4720,9 @@ int modelSatellite (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, TGNSSproduc
 	
 	// Tropospheric correction
 	if ( options->troposphericCorrection ) {
+		perfT = perfStart();
 		troposphereModel = troposphericCorrection(&epoch->t, epoch->receiver.aproxPositionNEU, epoch->sat[satIndex].elevation, TropoGal, &tropWetMap, &epoch->ZTD,options);
+		perfStop(perfTROPO,perfT);
 		epoch->sat[satIndex].tropWetMap = tropWetMap;
 	} else {
 		troposphereModel = 0;
@@ -4411,6 +4731,8 @@ int modelSatellite (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, TGNSSproduc
 	
 	// Ionospheric correction
 	if ( options->SBAScorrections == 0 || ( options->SBAScorrections == 1 && options->onlySBASiono == 1 ) ) {
+		// Satellites rejected by the ionosphere model are not accounted in the timer
+		perfT = perfStart();
 		switch(options->ionoModel) {
 			case Klobuchar:
 				ionosphereModelElectrons = klobucharModel(epoch, klbProd, satIndex);
@@ -4462,6 +4784,7 @@ int modelSatellite (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, TGNSSproduc
 				ionosphereModelElectrons = 0;
 				break;
 		}
+		perfStop(perfIONO,perfT);
 	} else {
 		ionosphereModelElectrons = SBAScorr.ionocorrection;
 	}
@@ -4578,12 +4901,14 @@ int modelSatellite (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, TGNSSproduc
 		SBAScorr.ionocorrection = ionosphereModel = ionosphereModelElectrons * 40.3 * (lambda*lambda) / (c0*c0) * pow(10,16);
 
 		// Satellite phase center correction for SP3 products (may depend in the frequency)
+		perfT = perfStart();
 		if ( options->satellitePhaseCenter ) {
 			if ( constellation!=NULL && products->type == SP3 ) {
 				res1 = satellitePhaseCenterCorrection(&epoch->t, epoch->sat[satIndex].GNSS, epoch->sat[satIndex].PRN, meas, epoch->sat[satIndex].orientation, epoch->sat[satIndex].LoS, constellation, &satellitePhaseCenterProjection);
 				
 				if ( !res1 ) {
 					epoch->sat[satIndex].hasSatPhaseCenterCor = 0;	// No constellation information
+					perfStop(perfANTENNA,perfT);
 					return 0; 
 				}
 
@@ -4610,6 +4935,7 @@ int modelSatellite (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, TGNSSproduc
 		} else {
 			receiverPhaseCenterProjection = 0;
 		}
+		perfStop(perfANTENNA,perfT);
 		
 		// Receiver Antenna Reference Point (ARP)
 		if ( options->ARPData >= arpSET ) {
@@ -4670,57 +4996,57 @@ int modelSatellite (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, TGNSSproduc
 }
 
 /*****************************************************************************
- * Name        : computeSBAS
- * Description : Compute SBAS corrections
+ * Name        : SBASdataChanged
+ * Description : Notify that SBAS data has been modified while computing the SBAS
+ *                corrections (e.g. a message timed out). Stored satellite
+ *                corrections computed with the previous data will not be used
  * Parameters  :
  * Name                           |Da|Unit|Description
- * TEpoch  *epoch                  I  N/A  TEpoch structure
+ * TSBASdata *SBASdata             IO N/A  Struct with SBAS data
+ *****************************************************************************/
+void SBASdataChanged (TSBASdata *SBASdata) {
+	#pragma omp atomic
+	SBASdata[0].revision++;
+}
+
+/*****************************************************************************
+ * Name        : SBASsatelliteCorrections
+ * Description : Compute the SBAS corrections of a satellite which do not depend
+ *                on the receiver position (fast, long term, Delta UDRE and
+ *                degradation terms). The GEO in options->GEOindex must be valid
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TEpoch  *epoch                  IO N/A  TEpoch structure
  * TGNSSproducts  *products        I  N/A  TGNSSproducts structure
- * TGNSSproducts  *klbProd         I  N/A  Support products to use for Klobuchar modeling, when applicable
- * TGNSSproducts  *beiProd         I  N/A  Support products to use for BeiDou modeling, when applicable
- * TGNSSproducts  *neqProd         I  N/A  Support products to use for NeQuick modeling, when applicable
- * TIONEX *Ionex                   I  N/A  IONEX structure, when applicable
- * TFPPPIONEX *Fppp                I  N/A  FPPP structure, when applicable
  * int  satIndex                   I  N/A  Index of the satellite to obtain the correction
- * enum MeasurementType  meas      I  N/A  Measurement
- * int  measIndex                  I  N/A  Index of the measurement in which we will apply the correction
- * TSBASdata *SBASdata             I  N/A  Struct with SBAS data
+ * TSBASdata *SBASdata             IO N/A  Struct with SBAS data
  * TSBAScorr *SBAScorr             O  N/A  Struct with the SBAS corrections to be applied
  *                                          to the current satellite
+ * TSBASsatCorr *satCorr           O  N/A  Data needed to finish the computation of the
+ *                                          corrections for a receiver position
  * TOptions  *options              I  N/A  TOptions structure
  * Returned value (int)            O  N/A  Status of the function
  *                                        <0 => No correction for current measurement
  *                                               Check printSBASUNSEL function for return values
- *                                         0  => Satellite is not visible (only for SBAS plots mode)
- *                                         1  => SBAS corrections available
+ *                                         1  => SBAS satellite corrections available
  *****************************************************************************/
-int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd, TGNSSproducts  *beiProd, TGNSSproducts *neqProd, TIONEX *Ionex, TFPPPIONEX *Fppp, int satIndex, enum MeasurementType meas, int measIndex, TSBASdata *SBASdata, TSBAScorr *SBAScorr, TOptions *options) {
+int SBASsatelliteCorrections (TEpoch *epoch, TGNSSproducts *products, int satIndex, TSBASdata *SBASdata, TSBAScorr *SBAScorr, TSBASsatCorr *satCorr, TOptions *options) {
 	int				i,j,k,l;
 	int				res1;
 	int				IODP,PRN,PRNpos;
 	int				IODS;
-	int				ret,mt10available=1;
+	int				mt10available=1;
 	int				nolongterm=0,nocovmatrix=0,nofastcorr=0,nodeltaudre=0;
-	int				ionoerror;
 	int				prevlongterm=0,velocitycode;
 	int				GEOPRN;
-	int				firstinside=1;
 	int				posFC,prevposFC,tmoutFC,smallertmoutFC=9999,FCalarm=0,indexprevPRC=-1,prevUDREI14=0;
 	enum GNSSystem	GNSS;
-	double			ionosphereModelElectrons;
 	double 			difftime,olddifftime;
-	double			deltaoutside=1;
-	double			R[4][4],RT[4][4],C[4][4],CI[4],I[4],scalefactor;
-	double			lambda;
-	double			currentvalue,unitarydistance;
+	double			R[4][4],RT[4][4],C[4][4],scalefactor=0;
 	TBRDCblock		*block;
 	TTime           t,tu,tudre,tPRC;
 
-	///////////////////////////
-	////Check if we have a GEO selected
-
-	//If options->GEOindex is negative, it contains the negative number that states why we can't select a GEO
-	if (options->GEOindex<0) return options->GEOindex;
+	satCorr->regionsearch=0;
 
 	//First gather GEO PRN from which we are receiving the corrections
 	//If we are using multiple GEO, GEOPRN value will be 0
@@ -4763,6 +5089,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 	} else if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][PRNMASKASSIGNMENTS]) ) {
 		//The current mask has time out, so the old one (if we have one stored) will also have time out
 		if(satIndex==epoch->lastSBASindex) {
+			SBASdataChanged(SBASdata);
 			for(i=0;i<MAX_GNSS;i++) {
 				for(j=0;j<MAX_SBAS_PRN;j++) {
 					SBASdata[options->GEOindex].PRNactive[SBASdata[options->GEOindex].IODPmask][i][j]=0;
@@ -4779,6 +5106,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 		//The old mask is timed out. If the values of the old mask have not been discarded, do it now
 		if(SBASdata[options->GEOindex].oldmaskdiscarded[PRNMASKASSIGNMENTS]==0 && (SBASdata[options->GEOindex].oldlastmsgreceived[PRNMASKASSIGNMENTS].MJDN!=-1)) {
 			if(satIndex==epoch->lastSBASindex) {
+				SBASdataChanged(SBASdata);
 				for(i=0;i<MAX_GNSS;i++) {
 					for(j=0;j<MAX_SBAS_PRN;j++) {
 						SBASdata[options->GEOindex].PRNactive[SBASdata[options->GEOindex].oldIODPmask][i][j]=0;
@@ -4818,6 +5146,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 	} else if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][DEGRADATIONPARAMETERS]) ) {
 		//Message Type 10 time out or without data
 		if(satIndex==epoch->lastSBASindex) {
+			SBASdataChanged(SBASdata);
 			SBASdata[options->GEOindex].lastmsgreceived[DEGRADATIONPARAMETERS].MJDN=-1;
 			SBASdata[options->GEOindex].degradationfactors[RSSUDRE]=-1;
 		}
@@ -5020,6 +5349,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 			//We have a "Not monitored" or "Don't use" UDRE
 			//Erase all fast correction data stored data from this satellite
 			nofastcorr=1;
+			SBASdataChanged(SBASdata);
 			for(i=0;i<5;i++) {
 				SBASdata[options->GEOindex].poslastFC[i][PRNpos] = -1;
 				SBASdata[options->GEOindex].numFC[i][PRNpos] = 0;
@@ -5064,6 +5394,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 			//We are in precision approach mode, so we cannot use satellites with UDRE>=12
 			//Clear the use forbidden flag if it is active
 			if(SBASdata[options->GEOindex].useforbidden[GNSS][PRN]>=14) {
+				SBASdataChanged(SBASdata);
 				SBASdata[options->GEOindex].useforbidden[GNSS][PRN]=0;
 			}
 			return -16;
@@ -5083,6 +5414,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 			}
 
 			if (prevUDREI14==1) {
+				SBASdataChanged(SBASdata);
 				//We received an UDREI=14 or 15. Erase this message and all the previous (the ones received with UDRE<14 after the UDREI>=14 do not have to be erased)
 				for(i=0;i<5;i++) {
 					if(i==IODP) {
@@ -5109,6 +5441,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 
 			//Clear the use forbidden flag if it is active
 			if(SBASdata[options->GEOindex].useforbidden[GNSS][PRN]>=14) {
+				SBASdataChanged(SBASdata);
 				SBASdata[options->GEOindex].useforbidden[GNSS][PRN]=0;
 			}
 		}
@@ -5119,6 +5452,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 			difftime=tdiff(&epoch->t,&SBASdata[options->GEOindex].lastfastdegfactor[IODP][PRNpos]);
 			if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][FASTCORRECTIONSDEGRADATIONFACTOR])) {
 				//Message type 7 data timed out
+				SBASdataChanged(SBASdata);
 				SBASdata[options->GEOindex].lastfastdegfactor[IODP][PRNpos].MJDN=-1;
 				SBASdata[options->GEOindex].lastfastdegfactor[IODP][PRNpos].SoD=-1;
 				if(options->precisionapproach==PAMODE) return -18;
@@ -5330,6 +5664,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 		difftime=tdiff(&epoch->t,&SBASdata[options->GEOindex].lastmsgreceived[SBASSERVICEMESSAGE]);
 		if(difftime>(double)((SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][SBASSERVICEMESSAGE])) ) {
 			//Message timed out
+			SBASdataChanged(SBASdata);
 			SBASdata[options->GEOindex].lastmsgreceived[SBASSERVICEMESSAGE].MJDN=-1;
 			SBASdata[options->GEOindex].lastmsgreceived[SBASSERVICEMESSAGE].SoD=-1;
 			IODS=SBASdata[options->GEOindex].IODS;
@@ -5365,116 +5700,8 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 				if(options->precisionapproach==PAMODE) return -26;
 				else nodeltaudre=1;
 			} else {
-				for(k=0;k<2;k++) { //This loop is for checking current and previous service messages
-					if(k==0) IODS=SBASdata[options->GEOindex].IODS;
-					else IODS=SBASdata[options->GEOindex].oldIODS;
-					SBAScorr->serviceIODS=IODS;
-					for(i=SBASdata[options->GEOindex].maxprioritycode[IODS];i>=0;i--) { 
-						//Check all regions, starting with the ones with higher priority code.
-						//If more than one region with the same priority code is found, select the one with lowest UDRE factor
-						//The regions are defined using geodetic coordinates
-						SBAScorr->deltaudre=1;
-						for(j=0;j<SBASdata[options->GEOindex].numberofregions[IODS][i];j++) {
-							if((int)SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][REGIONSHAPE]==1 || (int)SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][REGIONSHAPE]==0) {
-								//Square region or triangular region
-								ret=InsideOutside(epoch->receiver.aproxPositionNEU[0]*r2d,epoch->receiver.aproxPositionNEU[1]*r2d,
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD1LAT],
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD1LON],
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD2LAT],
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD2LON],
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD3LAT],
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD3LON],
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD4LAT],
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD4LON],
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][REGIONSHAPE]);
-								if(ret==1) {
-									//Region inside
-									if(firstinside==1) {
-										//This is the first region we are inside. Set this as the Deltra UDRE value
-										firstinside=0;
-										SBAScorr->deltaudre=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE];
-									} else {
-										if (k==0) {
-											//Using newer IODS
-											if(SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE]<SBAScorr->deltaudre) {
-												//This is not the first region we are inside, and the Delta Udre has a lower value than the previous region
-												SBAScorr->deltaudre=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE];
-											}
-										} else { //k==1
-											//Using old IODS
-											if(SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE]>SBAScorr->deltaudre) {
-												//A Delta Udre from the new IODS lower than the applicable from the previous IODS will not be used
-												//until we have received all the messages for the newer IODS
-												SBAScorr->deltaudre=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE];
-											}
-										}
-									}
-								} else if (ret==0) {
-									//Region outside. Save the Deltra UDRE outside (which will be the same in all regions) in case we don't find any region
-									//A Delta Udre from the new IODS lower than the applicable from the previous IODS will not be use 
-									//until we have received all the messages for the newer IODS
-									if(k==0) {
-										deltaoutside=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREOUTSIDEVALUE];
-									} else { //k==1
-										if(SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREOUTSIDEVALUE]>deltaoutside) {
-											deltaoutside=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREOUTSIDEVALUE];
-										}
-									}
-								} else {
-									//Not able to determine if inside or outside the region. Consider it an invalid region
-									continue;
-								}
-
-							} else {
-								//Not a valid region
-								continue;
-							}
-						}
-						//When we have checked all the regions with a given priority code and there is at least one region inside,
-						//do not look at the regions with lower priority codes
-						if(firstinside==0) {
-							break; //Escape the for(i..) loop if we have found a region
-						}
-					}
-					if (k==0) { //Only enter if this is the first loop (searched in current service message)
-						if(SBASdata[options->GEOindex].oldlastmsgreceived[SBASSERVICEMESSAGE].MJDN==-1) {
-							//No previous message, escape the for(k..) loop
-							break;
-						} else if (SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][NUMBERSERVICEMESSAGES]>SBASdata[options->GEOindex].totalservicemessagesreceived[IODS]) {
-							//If we have not received all the service messages of the current IODS, we can try to check the areas of the previous IODS if it has not timed out
-							//(this is done in order to cover the transition between IODS)
-							difftime=tdiff(&epoch->t,&SBASdata[options->GEOindex].oldlastmsgreceived[SBASSERVICEMESSAGE]);
-							if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][SBASSERVICEMESSAGE]) ) {
-								IODS=SBASdata[options->GEOindex].oldIODS;
-								SBASdata[options->GEOindex].oldlastmsgreceived[SBASSERVICEMESSAGE].MJDN=-1;
-								SBASdata[options->GEOindex].oldlastmsgreceived[SBASSERVICEMESSAGE].SoD=-1;
-								for(i=0;i<4;i++) {
-									SBASdata[options->GEOindex].numberofregions[IODS][i]=0;
-									for(j=0;j<40;j++) {
-										for(k=0;k<12;k++) {
-											SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][k]=9999;
-										}
-									}
-								}
-								for(i=0;i<8;i++) {
-									SBASdata[options->GEOindex].servicemessagesreceived[IODS][i]=-1;
-								}
-								SBASdata[options->GEOindex].maxprioritycode[IODS]=0;
-								SBASdata[options->GEOindex].totalservicemessagesreceived[IODS]=0;
-								break; //Escape for(k..) loop
-							}
-						} else {
-							//We have received all the messages for the current IODS, do not check the previous IODS
-							break;
-						}
-					}
-				} //end for
-
-				//Check if we have not found any region in which we are inside. In this case, use the Delta Outside value. 
-				//In the case we didn't have any region because there were no messages, the Delta outside value will have the default value of 1
-				if(firstinside==1) {
-					SBAScorr->deltaudre=deltaoutside;
-				}
+				//Delta UDRE depends on the receiver position. It is computed from the regions once the satellite corrections are computed
+				satCorr->regionsearch=1;
 			}
 		}
 	} else if (SBASdata[options->GEOindex].lastmsgreceived[CLOCKEPHEMERISCOVARIANCEMATRIX].MJDN!=-1) {
@@ -5488,6 +5715,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 				difftime=tdiff(&epoch->t,&SBASdata[options->GEOindex].lastcovmatrix[IODP][PRNpos]);
 				if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][CLOCKEPHEMERISCOVARIANCEMATRIX]) ) {
 					//Data timed out. No correction available
+					SBASdataChanged(SBASdata);
 					SBASdata[options->GEOindex].lastcovmatrix[IODP][PRNpos].MJDN=-1;
 					SBASdata[options->GEOindex].lastcovmatrix[IODP][PRNpos].SoD=-1;
 					SBAScorr->deltaudresource=-28;
@@ -5524,6 +5752,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 					difftime=tdiff(&epoch->t,&SBASdata[options->GEOindex].lastcovmatrix[IODP][PRNpos]);
 					if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][CLOCKEPHEMERISCOVARIANCEMATRIX]) ) {
 						//Data timed out. No correction available
+						SBASdataChanged(SBASdata);
 						SBASdata[options->GEOindex].lastcovmatrix[IODP][PRNpos].MJDN=-1;
 						SBASdata[options->GEOindex].lastcovmatrix[IODP][PRNpos].SoD=-1;
 						SBAScorr->deltaudresource=-28;
@@ -5626,6 +5855,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 		}
 		difftime=tdiff(&epoch->t,&SBASdata[i].lastmsgreceived[GEONAVIGATIONMESSAGE]);
 		if(difftime>(double)(SBASdata[i].timeoutmessages[options->precisionapproach][GEONAVIGATIONMESSAGE]) ) {
+			SBASdataChanged(SBASdata);
 			SBASdata[i].lastmsgreceived[GEONAVIGATIONMESSAGE].MJDN=-1;
 			//Data timed out. No correction available
 			return -30;
@@ -5704,6 +5934,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 				difftime=tdiff(&epoch->t,&SBASdata[options->GEOindex].lastlongtermdata[IODP][PRNpos]);
 				if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][LONGTERMSATELLITECORRECTIONS]) ) {
 					//Data timed out. No correction available
+					SBASdataChanged(SBASdata);
 					SBASdata[options->GEOindex].lastlongtermdata[IODP][PRNpos].MJDN=-1;
 					SBASdata[options->GEOindex].lastlongtermdata[IODP][PRNpos].SoD=-1;
 					if(options->precisionapproach==PAMODE) return -33;
@@ -5728,6 +5959,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 					difftime=tdiff(&epoch->t,&SBASdata[options->GEOindex].lastlongtermdata[IODP][PRNpos]);
 					if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][LONGTERMSATELLITECORRECTIONS]) ) {
 						//Data timed out. No correction available
+						SBASdataChanged(SBASdata);
 						SBASdata[options->GEOindex].lastlongtermdata[IODP][PRNpos].MJDN=-1;
 						SBASdata[options->GEOindex].lastlongtermdata[IODP][PRNpos].SoD=-1;
 						if(options->precisionapproach==PAMODE) return -33;
@@ -5762,6 +5994,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 					difftime=tdiff(&epoch->t,&SBASdata[options->GEOindex].prevlastlongtermdata[IODP][PRNpos]);
 					if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][LONGTERMSATELLITECORRECTIONS]) ) {
 						//Data timed out. No correction available
+						SBASdataChanged(SBASdata);
 						SBASdata[options->GEOindex].prevlastlongtermdata[IODP][PRNpos].MJDN=-1;
 						SBASdata[options->GEOindex].prevlastlongtermdata[IODP][PRNpos].SoD=-1;
 						if(options->precisionapproach==PAMODE) {
@@ -5974,6 +6207,186 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 		SBAScorr->SatCoord[2]=SBAScorr->SatCoordCor[2]+SBAScorr->SatCoordbrdc[2];
 		memcpy(epoch->sat[satIndex].position,SBAScorr->SatCoord,sizeof(double)*3);
 	}
+
+	satCorr->nofastcorr=nofastcorr;
+	satCorr->nolongterm=nolongterm;
+	memcpy(satCorr->C,C,sizeof(double)*16);
+	satCorr->scalefactor=scalefactor;
+
+	return 1;
+}
+
+/*****************************************************************************
+ * Name        : SBASserviceRegionDeltaUDRE
+ * Description : Compute Delta UDRE for the receiver position from the service
+ *                regions broadcast in message type 27
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TEpoch  *epoch                  I  N/A  TEpoch structure
+ * TSBASdata *SBASdata             IO N/A  Struct with SBAS data
+ * TSBAScorr *SBAScorr             O  N/A  Struct with the SBAS corrections to be applied
+ *                                          to the current satellite
+ * TOptions  *options              I  N/A  TOptions structure
+ *****************************************************************************/
+void SBASserviceRegionDeltaUDRE (TEpoch *epoch, TSBASdata *SBASdata, TSBAScorr *SBAScorr, TOptions *options) {
+	int				i,j=0,k;
+	int				IODS;
+	int				ret;
+	int				firstinside=1;
+	double			difftime;
+	double			deltaoutside=1;
+
+	for(k=0;k<2;k++) { //This loop is for checking current and previous service messages
+		if(k==0) IODS=SBASdata[options->GEOindex].IODS;
+		else IODS=SBASdata[options->GEOindex].oldIODS;
+		SBAScorr->serviceIODS=IODS;
+		for(i=SBASdata[options->GEOindex].maxprioritycode[IODS];i>=0;i--) { 
+			//Check all regions, starting with the ones with higher priority code.
+			//If more than one region with the same priority code is found, select the one with lowest UDRE factor
+			//The regions are defined using geodetic coordinates
+			SBAScorr->deltaudre=1;
+			for(j=0;j<SBASdata[options->GEOindex].numberofregions[IODS][i];j++) {
+				if((int)SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][REGIONSHAPE]==1 || (int)SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][REGIONSHAPE]==0) {
+					//Square region or triangular region
+					ret=InsideOutside(epoch->receiver.aproxPositionNEU[0]*r2d,epoch->receiver.aproxPositionNEU[1]*r2d,
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD1LAT],
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD1LON],
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD2LAT],
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD2LON],
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD3LAT],
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD3LON],
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD4LAT],
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][COORD4LON],
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][REGIONSHAPE]);
+					if(ret==1) {
+						//Region inside
+						if(firstinside==1) {
+							//This is the first region we are inside. Set this as the Deltra UDRE value
+							firstinside=0;
+							SBAScorr->deltaudre=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE];
+						} else {
+							if (k==0) {
+								//Using newer IODS
+								if(SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE]<SBAScorr->deltaudre) {
+									//This is not the first region we are inside, and the Delta Udre has a lower value than the previous region
+									SBAScorr->deltaudre=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE];
+								}
+							} else { //k==1
+								//Using old IODS
+								if(SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE]>SBAScorr->deltaudre) {
+									//A Delta Udre from the new IODS lower than the applicable from the previous IODS will not be used
+									//until we have received all the messages for the newer IODS
+									SBAScorr->deltaudre=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREINSIDEVALUE];
+								}
+							}
+						}
+					} else if (ret==0) {
+						//Region outside. Save the Deltra UDRE outside (which will be the same in all regions) in case we don't find any region
+						//A Delta Udre from the new IODS lower than the applicable from the previous IODS will not be use 
+						//until we have received all the messages for the newer IODS
+						if(k==0) {
+							deltaoutside=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREOUTSIDEVALUE];
+						} else { //k==1
+							if(SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREOUTSIDEVALUE]>deltaoutside) {
+								deltaoutside=SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][UDREOUTSIDEVALUE];
+							}
+						}
+					} else {
+						//Not able to determine if inside or outside the region. Consider it an invalid region
+						continue;
+					}
+
+				} else {
+					//Not a valid region
+					continue;
+				}
+			}
+			//When we have checked all the regions with a given priority code and there is at least one region inside,
+			//do not look at the regions with lower priority codes
+			if(firstinside==0) {
+				break; //Escape the for(i..) loop if we have found a region
+			}
+		}
+		if (k==0) { //Only enter if this is the first loop (searched in current service message)
+			if(SBASdata[options->GEOindex].oldlastmsgreceived[SBASSERVICEMESSAGE].MJDN==-1) {
+				//No previous message, escape the for(k..) loop
+				break;
+			} else if (SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][NUMBERSERVICEMESSAGES]>SBASdata[options->GEOindex].totalservicemessagesreceived[IODS]) {
+				//If we have not received all the service messages of the current IODS, we can try to check the areas of the previous IODS if it has not timed out
+				//(this is done in order to cover the transition between IODS)
+				difftime=tdiff(&epoch->t,&SBASdata[options->GEOindex].oldlastmsgreceived[SBASSERVICEMESSAGE]);
+				if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][SBASSERVICEMESSAGE]) ) {
+					IODS=SBASdata[options->GEOindex].oldIODS;
+					SBASdataChanged(SBASdata);
+					SBASdata[options->GEOindex].oldlastmsgreceived[SBASSERVICEMESSAGE].MJDN=-1;
+					SBASdata[options->GEOindex].oldlastmsgreceived[SBASSERVICEMESSAGE].SoD=-1;
+					for(i=0;i<4;i++) {
+						SBASdata[options->GEOindex].numberofregions[IODS][i]=0;
+						for(j=0;j<40;j++) {
+							for(k=0;k<12;k++) {
+								SBASdata[options->GEOindex].regioncoordinates[IODS][i][j][k]=9999;
+							}
+						}
+					}
+					for(i=0;i<8;i++) {
+						SBASdata[options->GEOindex].servicemessagesreceived[IODS][i]=-1;
+					}
+					SBASdata[options->GEOindex].maxprioritycode[IODS]=0;
+					SBASdata[options->GEOindex].totalservicemessagesreceived[IODS]=0;
+					break; //Escape for(k..) loop
+				}
+			} else {
+				//We have received all the messages for the current IODS, do not check the previous IODS
+				break;
+			}
+		}
+	} //end for
+
+	//Check if we have not found any region in which we are inside. In this case, use the Delta Outside value. 
+	//In the case we didn't have any region because there were no messages, the Delta outside value will have the default value of 1
+	if(firstinside==1) {
+		SBAScorr->deltaudre=deltaoutside;
+	}
+}
+
+/*****************************************************************************
+ * Name        : SBASreceiverCorrections
+ * Description : Finish the computation of the SBAS corrections of a satellite with
+ *                the terms which depend on the receiver position (elevation,
+ *                ionosphere, troposphere and airborne receiver sigmas)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TEpoch  *epoch                  IO N/A  TEpoch structure
+ * TGNSSproducts  *products        I  N/A  TGNSSproducts structure
+ * TGNSSproducts  *klbProd         I  N/A  Support products to use for Klobuchar modeling, when applicable
+ * TGNSSproducts  *beiProd         I  N/A  Support products to use for BeiDou modeling, when applicable
+ * TGNSSproducts  *neqProd         I  N/A  Support products to use for NeQuick modeling, when applicable
+ * TIONEX *Ionex                   I  N/A  IONEX structure, when applicable
+ * TFPPPIONEX *Fppp                I  N/A  FPPP structure, when applicable
+ * int  satIndex                   I  N/A  Index of the satellite to obtain the correction
+ * enum MeasurementType  meas      I  N/A  Measurement
+ * int  measIndex                  I  N/A  Index of the measurement in which we will apply the correction
+ * TSBASdata *SBASdata             IO N/A  Struct with SBAS data
+ * TSBAScorr *SBAScorr             IO N/A  Struct with the SBAS corrections to be applied
+ *                                          to the current satellite
+ * TSBASsatCorr *satCorr           I  N/A  Data from the computation of the satellite corrections
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  Status of the function
+ *                                        <0 => No correction for current measurement
+ *                                               Check printSBASUNSEL function for return values
+ *                                         0  => Satellite is not visible (only for SBAS plots mode)
+ *                                         1  => SBAS corrections available
+ *****************************************************************************/
+int SBASreceiverCorrections (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd, TGNSSproducts  *beiProd, TGNSSproducts *neqProd, TIONEX *Ionex, TFPPPIONEX *Fppp, int satIndex, enum MeasurementType meas, int measIndex, TSBASdata *SBASdata, TSBAScorr *SBAScorr, TSBASsatCorr *satCorr, TOptions *options) {
+	int				i,j;
+	int				mt10available=SBAScorr->mt10avail;
+	int				ionoerror;
+	enum GNSSystem	GNSS=epoch->sat[satIndex].GNSS;
+	double			ionosphereModelElectrons;
+	double			CI[4],I[4];
+	double			lambda;
+	double			currentvalue,unitarydistance;
+
 	getAzimuthElevation(epoch->receiver.orientation,epoch->receiver.aproxPosition,SBAScorr->SatCoord,&epoch->sat[satIndex].azimuth,&epoch->sat[satIndex].elevation);
 
 	//In SBAS plots mode, we compute SBAS sigma for all PRNs in the constellation, and by the elevation (mainly if it is positive)
@@ -6002,7 +6415,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 		for ( i=0;i<4;i++ ) {
 			CI[i] = 0;
 			for ( j=0;j<4;j++ ) {
-				CI[i] += C[i][j] * I[j];
+				CI[i] += satCorr->C[i][j] * I[j];
 			}
 		}
 		// Multipliy IT·CI(C·I) (IT=I transposed)
@@ -6013,7 +6426,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 		SBAScorr->deltaudre=sqrt(SBAScorr->deltaudre);
 		//Add Ec degradation term if message type 10 is available
 		if ( mt10available == 1 ) {
-			SBAScorr->deltaudre=SBAScorr->deltaudre+SBASdata[options->GEOindex].degradationfactors[CCOVARIANCE]*scalefactor;
+			SBAScorr->deltaudre=SBAScorr->deltaudre+SBASdata[options->GEOindex].degradationfactors[CCOVARIANCE]*satCorr->scalefactor;
 		}
 	}
 
@@ -6079,7 +6492,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 	///////////////////////////
 	////Compute sigma flt
 
-	if(nolongterm==0 && nofastcorr==0 && mt10available==1) {
+	if(satCorr->nolongterm==0 && satCorr->nofastcorr==0 && mt10available==1) {
 		//We have all necessary corrections for nominal sigma flt computation
 		//Delta UDRE is optional for this sigma, if we can compute its value we will use, otherwise we will have a value of 1
 		if(SBASdata[options->GEOindex].degradationfactors[RSSUDRE]==0) {
@@ -6089,7 +6502,7 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 			//RSSUDRE=1
 			SBAScorr->sigma2flt=pow(sqrt(SBAScorr->UDREsigma)*SBAScorr->deltaudre,2)+pow(SBAScorr->fastcorrdeg,2)+pow(SBAScorr->RRCdeg,2)+pow(SBAScorr->longtermdegradation,2)+pow(SBAScorr->geonavdegradation,2)+pow(SBAScorr->enroutedegradation,2);
 		}
-	} else if (nolongterm==0 && nofastcorr==0 && mt10available==0) {
+	} else if (satCorr->nolongterm==0 && satCorr->nofastcorr==0 && mt10available==0) {
 		SBAScorr->sigma2flt=pow(sqrt(SBAScorr->UDREsigma)*SBAScorr->deltaudre+options->SigmaOffsetNoMT10,2);
 	} else {
 		//In non-precision approach if we don't have fast corrections or long term corrections
@@ -6236,6 +6649,96 @@ int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd,
 
 }
 
+/*****************************************************************************
+ * Name        : computeSBAS
+ * Description : Compute SBAS corrections. In SBAS plots mode, the corrections which
+ *                do not depend on the receiver position are computed once per
+ *                epoch and satellite and reused in all the grid points
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TEpoch  *epoch                  I  N/A  TEpoch structure
+ * TGNSSproducts  *products        I  N/A  TGNSSproducts structure
+ * TGNSSproducts  *klbProd         I  N/A  Support products to use for Klobuchar modeling, when applicable
+ * TGNSSproducts  *beiProd         I  N/A  Support products to use for BeiDou modeling, when applicable
+ * TGNSSproducts  *neqProd         I  N/A  Support products to use for NeQuick modeling, when applicable
+ * TIONEX *Ionex                   I  N/A  IONEX structure, when applicable
+ * TFPPPIONEX *Fppp                I  N/A  FPPP structure, when applicable
+ * int  satIndex                   I  N/A  Index of the satellite to obtain the correction
+ * enum MeasurementType  meas      I  N/A  Measurement
+ * int  measIndex                  I  N/A  Index of the measurement in which we will apply the correction
+ * TSBASdata *SBASdata             I  N/A  Struct with SBAS data
+ * TSBAScorr *SBAScorr             O  N/A  Struct with the SBAS corrections to be applied
+ *                                          to the current satellite
+ * TOptions  *options              I  N/A  TOptions structure
+ * Returned value (int)            O  N/A  Status of the function
+ *                                        <0 => No correction for current measurement
+ *                                               Check printSBASUNSEL function for return values
+ *                                         0  => Satellite is not visible (only for SBAS plots mode)
+ *                                         1  => SBAS corrections available
+ *****************************************************************************/
+int computeSBAS (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd, TGNSSproducts  *beiProd, TGNSSproducts *neqProd, TIONEX *Ionex, TFPPPIONEX *Fppp, int satIndex, enum MeasurementType meas, int measIndex, TSBASdata *SBASdata, TSBAScorr *SBAScorr, TOptions *options) {
+	int				ret;
+	int				revision,hasOrbitsAndClocks;
+	TSBASsatCorr	auxSatCorr;
+	TSBASsatCorr	*satCorr;
+
+	///////////////////////////
+	////Check if we have a GEO selected
+
+	//If options->GEOindex is negative, it contains the negative number that states why we can't select a GEO
+	if (options->GEOindex<0) return options->GEOindex;
+
+	///////////////////////////
+	////Compute the corrections which do not depend on the receiver position
+
+	if(options->onlySBASplots==1 && satIndex<MAX_SBASPLOTS_SATELLITES) {
+		//In SBAS plots mode, the stored corrections are reused unless the epoch, the navigation mode or the SBAS data
+		//(for instance, a message has timed out when computing the corrections of a previous satellite) have changed
+		satCorr=&SBASdata[options->GEOindex].satCorr[satIndex];
+		if(satCorr->revision!=SBASdata[0].revision || satCorr->precisionapproach!=options->precisionapproach || satCorr->t.MJDN!=epoch->t.MJDN || satCorr->t.SoD!=epoch->t.SoD) {
+			revision=SBASdata[0].revision;
+			satCorr->revision=-1;
+			//Detect if the computation flags the satellite without orbits and clocks
+			hasOrbitsAndClocks=epoch->sat[satIndex].hasOrbitsAndClocks;
+			epoch->sat[satIndex].hasOrbitsAndClocks=1;
+			satCorr->retvalue=SBASsatelliteCorrections(epoch,products,satIndex,SBASdata,SBAScorr,satCorr,options);
+			satCorr->hasOrbitsAndClocks=epoch->sat[satIndex].hasOrbitsAndClocks;
+			if(satCorr->hasOrbitsAndClocks==1) epoch->sat[satIndex].hasOrbitsAndClocks=hasOrbitsAndClocks;
+			memcpy(&satCorr->SBAScorr,SBAScorr,sizeof(TSBAScorr));
+			memcpy(&satCorr->transTime,&epoch->sat[satIndex].transTime,sizeof(TTime));
+			memcpy(&satCorr->t,&epoch->t,sizeof(TTime));
+			satCorr->precisionapproach=options->precisionapproach;
+			//Corrections are only stored if SBAS data has not been modified while computing them
+			if(revision==SBASdata[0].revision) satCorr->revision=revision;
+		} else {
+			memcpy(SBAScorr,&satCorr->SBAScorr,sizeof(TSBAScorr));
+			if(satCorr->hasOrbitsAndClocks==0) epoch->sat[satIndex].hasOrbitsAndClocks=0;
+			if(satCorr->transTime.MJDN==epoch->t.MJDN && satCorr->transTime.SoD==epoch->t.SoD) {
+				memcpy(&epoch->sat[satIndex].transTime,&epoch->t,sizeof(TTime));
+			}
+			if(satCorr->retvalue==1) {
+				memcpy(epoch->sat[satIndex].position,SBAScorr->SatCoord,sizeof(double)*3);
+			}
+		}
+	} else {
+		satCorr=&auxSatCorr;
+		satCorr->retvalue=SBASsatelliteCorrections(epoch,products,satIndex,SBASdata,SBAScorr,satCorr,options);
+	}
+	ret=satCorr->retvalue;
+
+	//Delta UDRE from message type 27 depends on the receiver position
+	if(satCorr->regionsearch==1) {
+		SBASserviceRegionDeltaUDRE(epoch,SBASdata,SBAScorr,options);
+	}
+
+	if(ret<=0) return ret;
+
+	///////////////////////////
+	////Compute the corrections which depend on the receiver position
+
+	return SBASreceiverCorrections(epoch,products,klbProd,beiProd,neqProd,Ionex,Fppp,satIndex,meas,measIndex,SBASdata,SBAScorr,satCorr,options);
+}
+
 /*****************************************************************************
  * Name        : SBASIonoModel
  * Description : Obtains the ionospheric correction from SBAS data
@@ -6394,6 +6897,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 				}
 			}
 			SBASdata[options->GEOindex].IODImask=4;
+			SBASupdateIGPindex(&SBASdata[options->GEOindex]);
 		}
 		InterpolationMode=-1;
 		*errorvalue=-38;
@@ -6412,6 +6916,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			SBASdata[options->GEOindex].oldlastmsgreceived[IONOSPHERICGRIDPOINTSMASKS].MJDN=-1;
 			SBASdata[options->GEOindex].oldlastmsgreceived[IONOSPHERICGRIDPOINTSMASKS].SoD=-1;
 			SBASdata[options->GEOindex].oldIODImask=4;
+			SBASupdateIGPindex(&SBASdata[options->GEOindex]);
 		}
 	}
 
@@ -6423,6 +6928,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			mt10available=0;
 		} else if(difftime>(double)(SBASdata[options->GEOindex].timeoutmessages[options->precisionapproach][DEGRADATIONPARAMETERS]) ) {
 			//Message Type 10 time out or without data
+			SBASdataChanged(SBASdata);
 			SBASdata[options->GEOindex].lastmsgreceived[DEGRADATIONPARAMETERS].MJDN=-1;
 			SBASdata[options->GEOindex].degradationfactors[RSSUDRE]=-1;
 
@@ -6441,20 +6947,20 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 		IGPlon2=modulo(IGPlon3+270,360);
 		IGPlon4=modulo(IGPlon3+90,360);
 		//--- Looking the band 9  ------------
-		IGPLatLon2BandNumberIGP(IGPlat,IGPlon1,&BandNumber1,&IGP1,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon1,&BandNumber1,&IGP1,&IGP90);
 		IGP1=IGP90;
 		BandNumber1=9;
-		IGPLatLon2BandNumberIGP(IGPlat,IGPlon2,&BandNumber2,&IGP2,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon2,&BandNumber2,&IGP2,&IGP90);
 		IGP2=IGP90;
 		BandNumber2=9;
-		IGPLatLon2BandNumberIGP(IGPlat,IGPlon3,&BandNumber3,&IGP3,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon3,&BandNumber3,&IGP3,&IGP90);
 		IGP3=IGP90;
 		BandNumber3=9;
-		IGPLatLon2BandNumberIGP(IGPlat,IGPlon4,&BandNumber4,&IGP4,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon4,&BandNumber4,&IGP4,&IGP90);
 		IGP4=IGP90;
 		BandNumber4=9;
 		if (IGP1*IGP2*IGP3*IGP4>0) {
-			numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber1][IGP1]][BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber2][IGP2]][BandNumber2][IGP2]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber3][IGP3]][BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber4][IGP4]][BandNumber4][IGP4];
+			numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber2][IGP2]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber4][IGP4];
 			//All IGPs must bet set as "1" in the Mask.
 			if(numIGP90<4) {
 				*errorvalue=-40;
@@ -6464,12 +6970,12 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 		}
 
 		//--- Looking the other bands ------
-		IGPLatLon2BandNumberIGP(IGPlat,IGPlon1,&BandNumber1,&IGP1,&IGP90);
-		IGPLatLon2BandNumberIGP(IGPlat,IGPlon2,&BandNumber2,&IGP2,&IGP90);
-		IGPLatLon2BandNumberIGP(IGPlat,IGPlon3,&BandNumber3,&IGP3,&IGP90);
-		IGPLatLon2BandNumberIGP(IGPlat,IGPlon4,&BandNumber4,&IGP4,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon1,&BandNumber1,&IGP1,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon2,&BandNumber2,&IGP2,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon3,&BandNumber3,&IGP3,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon4,&BandNumber4,&IGP4,&IGP90);
 		if (IGP1*IGP2*IGP3*IGP4>0) {
-			numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber1][IGP1]][BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber2][IGP2]][BandNumber2][IGP2]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber3][IGP3]][BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber4][IGP4]][BandNumber4][IGP4];
+			numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber2][IGP2]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber4][IGP4];
 			//All IGPs must bet set as "1" in the Mask.
 			if(numIGP90<4) {
 				*errorvalue=-40;
@@ -6492,20 +6998,20 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 				IGPlon2=modulo(IGPlon3+270,360);
 				IGPlon4=modulo(IGPlon3+90,360);
 				//--- Looking the band 10 ------------
-				IGPLatLon2BandNumberIGP(IGPlat,IGPlon1,&BandNumber1,&IGP1,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon1,&BandNumber1,&IGP1,&IGP90);
 				IGP1=IGP90;
 				BandNumber1=10;
-				IGPLatLon2BandNumberIGP(IGPlat,IGPlon2,&BandNumber2,&IGP2,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon2,&BandNumber2,&IGP2,&IGP90);
 				IGP2=IGP90;
 				BandNumber2=10;
-				IGPLatLon2BandNumberIGP(IGPlat,IGPlon3,&BandNumber3,&IGP3,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon3,&BandNumber3,&IGP3,&IGP90);
 				IGP3=IGP90;
 				BandNumber3=10;
-				IGPLatLon2BandNumberIGP(IGPlat,IGPlon4,&BandNumber4,&IGP4,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon4,&BandNumber4,&IGP4,&IGP90);
 				IGP4=IGP90;
 				BandNumber4=10;
 				if (IGP1*IGP2*IGP3*IGP4>0) {
-						numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber1][IGP1]][BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber2][IGP2]][BandNumber2][IGP2]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber3][IGP3]][BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber4][IGP4]][BandNumber4][IGP4];
+						numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber2][IGP2]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber4][IGP4];
 						//All IGPs must bet set as "1" in the Mask.
 						if(numIGP90<4) {
 				*errorvalue=-40;
@@ -6515,12 +7021,12 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 				}
 
 				//--- Looking the other bands ------
-				IGPLatLon2BandNumberIGP(IGPlat,IGPlon1,&BandNumber1,&IGP1,&IGP90);
-				IGPLatLon2BandNumberIGP(IGPlat,IGPlon2,&BandNumber2,&IGP2,&IGP90);
-				IGPLatLon2BandNumberIGP(IGPlat,IGPlon3,&BandNumber3,&IGP3,&IGP90);
-				IGPLatLon2BandNumberIGP(IGPlat,IGPlon4,&BandNumber4,&IGP4,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon1,&BandNumber1,&IGP1,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon2,&BandNumber2,&IGP2,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon3,&BandNumber3,&IGP3,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat,IGPlon4,&BandNumber4,&IGP4,&IGP90);
 				if (IGP1*IGP2*IGP3*IGP4>0) {
-						numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber1][IGP1]][BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber2][IGP2]][BandNumber2][IGP2]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber3][IGP3]][BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber4][IGP4]][BandNumber4][IGP4];
+						numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber2][IGP2]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber4][IGP4];
 						//All IGPs must bet set as "1" in the Mask.
 						if(numIGP90<4) {
 				*errorvalue=-40;
@@ -6548,23 +7054,23 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 		IGPlat_aux2=IGPlat_aux1+increment;
 		IGPlon2=IGPlon1+increment;
 
-		IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon1,&BandNumber3,&IGP3,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon1,&BandNumber3,&IGP3,&IGP90);
 		IGP3=IGP90;
 		BandNumber3=9;
-		IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon2,&BandNumber4,&IGP4,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon2,&BandNumber4,&IGP4,&IGP90);
 		IGP4=IGP90;
 		BandNumber4=9;
 		
 
 		if (IGP3+IGP4>0) { //One of the IGPs at 75º can be not set because we can interpolate in a triangle
-			numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber3][IGP3]][BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber4][IGP4]][BandNumber4][IGP4];
+			numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber4][IGP4];
 			//Both IGPs must bet set as "1" in the Mask to do the virtual interpolation.
 			if((numIGP90!=2 && (IGP3*IGP4>0)) || (numIGP90<1 && (IGP3+IGP4>0))) {
 				//Points at Band 9 are not available, look in vertical bands
-				IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon1,&BandNumber3,&IGP3,&IGP90);
-				IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon2,&BandNumber4,&IGP4,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon1,&BandNumber3,&IGP3,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon2,&BandNumber4,&IGP4,&IGP90);
 				if (IGP3+IGP4>0) { //One if the IGPs at 75º can be not set because we can interpolate in a triangle
-					numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber3][IGP3]][BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber4][IGP4]][BandNumber4][IGP4];
+					numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber4][IGP4];
 					if((numIGP90!=2 && (IGP3*IGP4>0)) || (numIGP90<1 && (IGP3+IGP4>0))) {
 						//The two nearest IGPs are not available
 						*errorvalue=-40;
@@ -6575,10 +7081,10 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			}
 		} else {
 			//Points at Band 9 are not available, look in vertical bands
-			IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon1,&BandNumber3,&IGP3,&IGP90);
-			IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon2,&BandNumber4,&IGP4,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon1,&BandNumber3,&IGP3,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon2,&BandNumber4,&IGP4,&IGP90);
 			if (IGP3+IGP4>0) { //One if the IGPs at 75º can be not set because we can interpolate in a triangle
-				numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber3][IGP3]][BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber4][IGP4]][BandNumber4][IGP4];
+				numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber4][IGP4];
 				if((numIGP90!=2 && (IGP3*IGP4>0)) || (numIGP90<1 && (IGP3+IGP4>0))) {
 					//The two nearest IGPs are not available
 					*errorvalue=-40;
@@ -6594,15 +7100,15 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			//--- Looking the band 9  ------------
 			IGPlon_auxleft=(int)(IGPlon1/30)*30;
 			IGPlon_auxright=IGPlon_auxleft+30;
-			IGPLatLon2BandNumberIGP(IGPlat_aux2,IGPlon_auxright,&BandNumber1,&IGP1,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux2,IGPlon_auxright,&BandNumber1,&IGP1,&IGP90);
 			BandNumber1=9;
 			IGP1=IGP90;
-			IGPLatLon2BandNumberIGP(IGPlat_aux2,IGPlon_auxleft,&BandNumber2,&IGP2,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux2,IGPlon_auxleft,&BandNumber2,&IGP2,&IGP90);
 			BandNumber2=9;
 			IGP2=IGP90;
 		  
 			if (IGP1*IGP2>0) {
-				numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber1][IGP1]][BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber2][IGP2]][BandNumber2][IGP2];
+				numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber2][IGP2];
 				//Both IGPs must bet set as "1" in the Mask to do the virtual interpolation.
 				if(numIGP90==2) IGPretrieved=1;
 			}
@@ -6612,11 +7118,11 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			//--- Looking the other bands ------
 			IGPlon_auxleft=(int)(IGPlon1/90)*90;
 			IGPlon_auxright=IGPlon_auxleft+90;
-			IGPLatLon2BandNumberIGP(IGPlat_aux2,IGPlon_auxright,&BandNumber1,&IGP1,&IGP90);
-			IGPLatLon2BandNumberIGP(IGPlat_aux2,IGPlon_auxleft,&BandNumber2,&IGP2,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux2,IGPlon_auxright,&BandNumber1,&IGP1,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux2,IGPlon_auxleft,&BandNumber2,&IGP2,&IGP90);
 
 			if (IGP1*IGP2>0) {
-				numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber1][IGP1]][BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber2][IGP2]][BandNumber2][IGP2];
+				numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber2][IGP2];
 				if (numIGP90==2) {
 					//Both IGPs must to bet set as "1" in the Mask to do the virtual interpolation.
 					IGPretrieved=1;
@@ -6652,22 +7158,22 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 		IGPlat_aux2=IGPlat_aux1+increment;
 		IGPlon2=IGPlon1+increment;
 
-		IGPLatLon2BandNumberIGP(IGPlat_aux2,IGPlon2,&BandNumber1,&IGP1,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat_aux2,IGPlon2,&BandNumber1,&IGP1,&IGP90);
 		IGP1=IGP90;
 		BandNumber1=10;
-		IGPLatLon2BandNumberIGP(IGPlat_aux2,IGPlon1,&BandNumber2,&IGP2,&IGP90);
+		IGPLatLon2BandNumberIGPTable(IGPlat_aux2,IGPlon1,&BandNumber2,&IGP2,&IGP90);
 		IGP2=IGP90;
 		BandNumber2=10;
 
 		if (IGP1+IGP2>0) { //One of the IGPs at -75º can be not set because we can interpolate in a triangle
-			numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber1][IGP1]][BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber2][IGP2]][BandNumber2][IGP2];
+			numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber2][IGP2];
 			//Both IGPs must bet set as "1" in the Mask to do the virtual interpolation.
 			if((numIGP90!=2 && (IGP1*IGP2>0)) || (numIGP90<1 && (IGP1+IGP2>0))) {
 				//Points at Band 10 are not available, look in vertical bands
-				IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon1,&BandNumber1,&IGP1,&IGP90);
-				IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon2,&BandNumber2,&IGP2,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon1,&BandNumber1,&IGP1,&IGP90);
+				IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon2,&BandNumber2,&IGP2,&IGP90);
 				if (IGP1+IGP2>0) { //One if the IGPs at -75º can be not set because we can interpolate in a triangle
-					numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber1][IGP1]][BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber2][IGP2]][BandNumber2][IGP2];
+					numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber2][IGP2];
 					if((numIGP90!=2 && (IGP1*IGP2>0)) || (numIGP90<1 && (IGP1+IGP2>0))) {
 						//The two nearest IGPs are not available
 						*errorvalue=-40;
@@ -6678,10 +7184,10 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			}
 		} else {
 			//Points at Band 10 are not available, look in vertical bands
-			IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon1,&BandNumber1,&IGP1,&IGP90);
-			IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon2,&BandNumber2,&IGP2,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon1,&BandNumber1,&IGP1,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon2,&BandNumber2,&IGP2,&IGP90);
 			if (IGP1+IGP2>0) { //One if the IGPs at -75º can be not set because we can interpolate in a triangle
-				numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber1][IGP1]][BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber2][IGP2]][BandNumber2][IGP2];
+				numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber1][IGP1]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber2][IGP2];
 				if((numIGP90!=2 && (IGP1*IGP2>0)) || (numIGP90<1 && (IGP1+IGP2>0))) {
 					//The two nearest IGPs are not available
 					*errorvalue=-40;
@@ -6698,15 +7204,15 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			//--- Looking the band 10  ------------
 			IGPlon_auxleft=(int)((IGPlon1-10)/30)*30+10;
 			IGPlon_auxright=IGPlon_auxleft+30;
-			IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon_auxleft,&BandNumber3,&IGP3,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon_auxleft,&BandNumber3,&IGP3,&IGP90);
 			BandNumber3=10;
 			IGP3=IGP90;
-			IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon_auxright,&BandNumber4,&IGP4,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon_auxright,&BandNumber4,&IGP4,&IGP90);
 			BandNumber4=10;
 			IGP4=IGP90;
 
 			if (IGP3*IGP4>0) {
-				numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber3][IGP3]][BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber4][IGP4]][BandNumber4][IGP4];
+				numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber4][IGP4];
 				//Both IGPs must to bet set as "1" in the Mask to do the virtual interpolation.
 				if (numIGP90==2) IGPretrieved=1;
 			}
@@ -6716,11 +7222,11 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			//--- Looking the other bands ------
 			IGPlon_auxleft=(int)((IGPlon1-40)/90)*90+40;
 			IGPlon_auxright=IGPlon_auxleft+90;
-			IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon_auxleft,&BandNumber3,&IGP3,&IGP90);
-			IGPLatLon2BandNumberIGP(IGPlat_aux1,IGPlon_auxright,&BandNumber4,&IGP4,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon_auxleft,&BandNumber3,&IGP3,&IGP90);
+			IGPLatLon2BandNumberIGPTable(IGPlat_aux1,IGPlon_auxright,&BandNumber4,&IGP4,&IGP90);
 
 			if (IGP3*IGP4>0) {
-				numIGP90=SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber3][IGP3]][BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinMask[SBASdata[options->GEOindex].IGP2Mask[BandNumber4][IGP4]][BandNumber4][IGP4];
+				numIGP90=SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber3][IGP3]+SBASdata[options->GEOindex].IGPinCurrentMask[BandNumber4][IGP4];
 				if (numIGP90==2) {
 					//Both IGPs must to bet set as "1" in the Mask to do the virtual interpolation.
 					IGPretrieved=1;
@@ -6756,11 +7262,11 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 	
 		if (IPPlat-IGPlat_aux1<5) {
 			//The closest IGP in the left-down corner is less than 5º away in latitude, so the IGPs above can be only 5º away
-			IGPsearch(IPPlat,IPPlon,IGPlat_aux1,IGPlon1,5,increment,SBASdata[options->GEOindex].IGPinMask,SBASdata[options->GEOindex].IGP2Mask,&InterpolationMode,IGPnumber,IGPBandNumber);
+			IGPsearch(IPPlat,IPPlon,IGPlat_aux1,IGPlon1,5,increment,&SBASdata[options->GEOindex],&InterpolationMode,IGPnumber,IGPBandNumber);
 		} else {
 			//The closest IGP in the left-down corner is more han 5º away in latitude, so we need to add 5º to the latitude so the distance remains under 5º from the upper IGPs
 			IGPlat_aux1=IGPlat_aux1+5;
-			IGPsearch(IPPlat,IPPlon,IGPlat_aux1,IGPlon1,5,increment,SBASdata[options->GEOindex].IGPinMask,SBASdata[options->GEOindex].IGP2Mask,&InterpolationMode,IGPnumber,IGPBandNumber);
+			IGPsearch(IPPlat,IPPlon,IGPlat_aux1,IGPlon1,5,increment,&SBASdata[options->GEOindex],&InterpolationMode,IGPnumber,IGPBandNumber);
 		}
 
 		IGPlon2=IGPlon1+10;
@@ -6775,7 +7281,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			InterpolationMode2=-30;
 
 			if (IPPlat<70.) {
-				IGPsearch(IPPlat,IPPlon,IGPlat_aux1,IGPlon1,increment,increment,SBASdata[options->GEOindex].IGPinMask,SBASdata[options->GEOindex].IGP2Mask,&InterpolationMode1,IGPnumber_aux1,IGPBandNumber_aux1);
+				IGPsearch(IPPlat,IPPlon,IGPlat_aux1,IGPlon1,increment,increment,&SBASdata[options->GEOindex],&InterpolationMode1,IGPnumber_aux1,IGPBandNumber_aux1);
 
 
 				if (InterpolationMode1==0) {
@@ -6794,7 +7300,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			if (IPPlat>=-70. && InterpolationMode1!=0) {
 
 				IGPlat_aux3=IGPlat_aux1-5;
-				IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon1,increment,increment,SBASdata[options->GEOindex].IGPinMask,SBASdata[options->GEOindex].IGP2Mask,&InterpolationMode2,IGPnumber_aux2,IGPBandNumber_aux2);
+				IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon1,increment,increment,&SBASdata[options->GEOindex],&InterpolationMode2,IGPnumber_aux2,IGPBandNumber_aux2);
 
 
 				if (InterpolationMode2==0) {
@@ -6848,7 +7354,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 		IGPlat_aux2=IGPlat_aux1+increment;
 
 		//.... 5x5 SQUARES .........................................
-		IGPsearch(IPPlat,IPPlon,IGPlat_aux1,IGPlon1,increment,increment,SBASdata[options->GEOindex].IGPinMask,SBASdata[options->GEOindex].IGP2Mask,&InterpolationMode,IGPnumber,IGPBandNumber);
+		IGPsearch(IPPlat,IPPlon,IGPlat_aux1,IGPlon1,increment,increment,&SBASdata[options->GEOindex],&InterpolationMode,IGPnumber,IGPBandNumber);
 
 		if (InterpolationMode<0) {
 
@@ -6897,7 +7403,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 			//Variable "check" looks if the longitude is a multiple of 10. Instead of comparing with zero, compares with 1E-4 (nearly 0) to avoid problems with decimals
 			if ((IPPlat<55.)||(check<1E-4)) {
 
-				IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon_aux3,increment,increment,SBASdata[options->GEOindex].IGPinMask,SBASdata[options->GEOindex].IGP2Mask,&InterpolationMode_aux1,IGPnumber_aux1,IGPBandNumber_aux1);
+				IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon_aux3,increment,increment,&SBASdata[options->GEOindex],&InterpolationMode_aux1,IGPnumber_aux1,IGPBandNumber_aux1);
 
 
 				if (InterpolationMode_aux1==0) {
@@ -6923,7 +7429,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 				//Variable "check" looks if the longitude is a multiple of 10. Instead of comparing with zero, compares with 1E-4 (nearly 0) to avoid problems with decimals
 				if ((IPPlat<55.)||(check<1E-4)) {
 
-					IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon_aux3,increment,increment,SBASdata[options->GEOindex].IGPinMask,SBASdata[options->GEOindex].IGP2Mask,&InterpolationMode_aux2,IGPnumber_aux2,IGPBandNumber_aux2);
+					IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon_aux3,increment,increment,&SBASdata[options->GEOindex],&InterpolationMode_aux2,IGPnumber_aux2,IGPBandNumber_aux2);
 
 
 					if (InterpolationMode_aux2==0) {
@@ -6949,7 +7455,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 					//Variable "check" looks if the longitude is a multiple of 10. Instead of comparing with zero, compares with 1E-4 (nearly 0) to avoid problems with decimals
 					if ((IPPlat>=-55.)||(check<1E-4)) {
 
-						IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon_aux3,increment,increment,SBASdata[options->GEOindex].IGPinMask,SBASdata[options->GEOindex].IGP2Mask,&InterpolationMode_aux3,IGPnumber_aux3,IGPBandNumber_aux3);
+						IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon_aux3,increment,increment,&SBASdata[options->GEOindex],&InterpolationMode_aux3,IGPnumber_aux3,IGPBandNumber_aux3);
 
 					 
 						if (InterpolationMode_aux3==0) {
@@ -6976,7 +7482,7 @@ double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int
 						//Variable "check" looks if the longitude is a multiple of 10. Instead of comparing with zero, compares with 1E-4 (nearly 0) to avoid problems with decimals
 						if ((IPPlat>=-55.)||(check<1E-4)) {
 						 
-							IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon_aux3,increment,increment,SBASdata[options->GEOindex].IGPinMask,SBASdata[options->GEOindex].IGP2Mask,&InterpolationMode_aux4,IGPnumber_aux4,IGPBandNumber_aux4);
+							IGPsearch(IPPlat,IPPlon,IGPlat_aux3,IGPlon_aux3,increment,increment,&SBASdata[options->GEOindex],&InterpolationMode_aux4,IGPnumber_aux4,IGPBandNumber_aux4);
 
 
 							if (InterpolationMode_aux4==0) {
@@ -8181,12 +8687,11 @@ void computeDGNSScorrections (TEpoch *epoch, TEpoch *epochDGNSS, TGNSSproducts *
 		if ( block == NULL ) continue;
 
 		// Compute the satellite position, flight time and satellite velocity
-		getPositionBRDC(products->BRDC,block,&t,epochDGNSS->sat[ii].GNSS,epochDGNSS->sat[ii].position);
+		getPositionVelocityBRDC(products->BRDC,block,&t,epochDGNSS->sat[ii].GNSS,epochDGNSS->sat[ii].position,velocity,NULL);
 		flightTime =
 		sqrt((epochDGNSS->sat[ii].position[0]-epochDGNSS->receiver.aproxPosition[0])*(epochDGNSS->sat[ii].position[0]-epochDGNSS->receiver.aproxPosition[0]) +
 			 (epochDGNSS->sat[ii].position[1]-epochDGNSS->receiver.aproxPosition[1])*(epochDGNSS->sat[ii].position[1]-epochDGNSS->receiver.aproxPosition[1]) +
 			 (epochDGNSS->sat[ii].position[2]-epochDGNSS->receiver.aproxPosition[2])*(epochDGNSS->sat[ii].position[2]-epochDGNSS->receiver.aproxPosition[2]))/c0;
-		getVelocityBRDC(products->BRDC,block,&t,epochDGNSS->sat[ii].position,velocity,svINERTIAL,epochDGNSS->sat[ii].GNSS);
 
 		// Relativistic correction
 		if ( options->earthRotation ) {
@@ -265,8 +265,11 @@ int satellitePhaseCenterCorrection3D (TTime *t, enum GNSSystem GNSS, int PRN, en
 int satellitePhaseCenterCorrection (TTime *t, enum GNSSystem GNSS, int PRN, enum MeasurementType meas, double orientation[3][3], double *LoS, TConstellation *constellation, double *pc);
 int satellitePhaseCenterVarCorrection (TTime *t, enum GNSSystem GNSS, int PRN, enum MeasurementType meas, double satearthdistance, double elevation, TConstellation *constellation, double *pvc);
 double getClockBRDC (TBRDCblock *block,TTime *t);
+void GLONASSorbitDerivatives (double *state, double *acc, double *deriv);
+void GLONASSorbitStep (double *state, double *acc, double h, double *stateNext);
+void getPositionVelocityGLONASS (TBRDCproducts *products, TBRDCblock *block, TTime *t, double *position, double *ITRFvel);
+void getPositionVelocityBRDC (TBRDCproducts *products, TBRDCblock *block, TTime *t, enum GNSSystem GNSS, double *position, double *velocity, double *ITRFvel);
 void getPositionBRDC (TBRDCproducts *products, TBRDCblock *block, TTime *t, enum GNSSystem GNSS,double *position);
-void getVelocityBRDC (TBRDCproducts *products, TBRDCblock *block, TTime *t,double *position, double *velocity, enum SatelliteVelocity satVel, enum GNSSystem GNSS);
 double getClockSP3 (TGNSSproducts *products, TTime *t,enum GNSSystem GNSS,int PRN, TOptions *options);
 int getPositionSP3 (TGNSSproducts *products, TTime *t,enum GNSSystem GNSS,int PRN, double *position, TOptions *options);
 int getVelocitySP3 (TGNSSproducts *products, TTime *t,enum GNSSystem GNSS,int PRN, double *position, double *velocity, enum SatelliteVelocity satVel, TOptions *options);
@@ -276,6 +279,11 @@ int getSatellitePVT (TGNSSproducts *products, TTime *t, double flightTime, enum
 int fillSatellitePVT (TEpoch *epoch, TGNSSproducts *products, TTime *t, double flightTime, int satIndex, int position, int velocity, int clock, int SBASIOD, TConstellation *constellation, TOptions *options);
 void getLineOfSight (double *satPos, double *recPos, double *LoS);
 void fillLineOfSight (TEpoch *epoch, int satIndex);
+void moonInertialPosition (TTime *t, double* moonPosition);
+void sunInertialPosition (TTime *t, double* sunPosition);
+double GMST (TTime *t);
+TCelestialDay *getCelestialDay (int MJDN);
+int celestialInertialPosition (TTime *t, int moon, double *position);
 void findMoon (TTime *t, double* moonPosition);
 void findSun (TTime *t, double* sunPosition);
 void GSDtime_sun (TTime *t,double *gstr, double *slong, double *sra, double *sdec);
@@ -336,6 +344,10 @@ int modelEpoch (TEpoch *epoch, TOptions *options);
 int modelSatellite (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, TGNSSproducts *products, TGNSSproducts *klbProd, TGNSSproducts  *beiProd, TGNSSproducts *neqProd, TIONEX *Ionex, TFPPPIONEX *Fppp, TTROPOGal *TropoGal, TTGDdata *tgdData, TConstellation *constellation, TSBASdata *SBASdata, TOptions *options);
 
 // SBAS processing
+void SBASdataChanged (TSBASdata *SBASdata);
+int SBASsatelliteCorrections (TEpoch *epoch, TGNSSproducts *products, int satIndex, TSBASdata *SBASdata, TSBAScorr *SBAScorr, TSBASsatCorr *satCorr, TOptions *options);
+void SBASserviceRegionDeltaUDRE (TEpoch *epoch, TSBASdata *SBASdata, TSBAScorr *SBAScorr, TOptions *options);
+int SBASreceiverCorrections (TEpoch *epoch, TGNSSproducts *products, TGNSSproducts *klbProd, TGNSSproducts  *beiProd, TGNSSproducts *neqProd, TIONEX *Ionex, TFPPPIONEX *Fppp, int satIndex, enum MeasurementType meas, int measIndex, TSBASdata *SBASdata, TSBAScorr *SBAScorr, TSBASsatCorr *satCorr, TOptions *options);
 int computeSBAS (TEpoch *epoch, TGNSSproducts  *products, TGNSSproducts *klbProd, TGNSSproducts  *beiProd, TGNSSproducts *neqProd, TIONEX *Ionex, TFPPPIONEX *Fppp, int satIndex, enum MeasurementType meas, int measIndex, TSBASdata *SBASdata, TSBAScorr *SBAScorr, TOptions *options);
 double SBASIonoModel (TEpoch *epoch, TGNSSproducts *products, int satIndex, int *errorvalue, TSBAScorr *SBAScorr, TSBASdata *SBASdata, TOptions *options);
 int SwitchSBASGEOMode (TEpoch  *epoch, int  numsatellites, int  numsatdiscardedSBAS, TSBASdata *SBASdata, TOptions  *options);
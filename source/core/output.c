@@ -472,9 +472,9 @@ void printParameters (TOptions *options, TEpoch *epoch, TGNSSproducts *products,
 	} else {
 		strcpy(auxstr,epoch->receiver.name);
 	}
-	#if defined _OPENMP
-		fprintf(options->outFileStream,"INFO Number of threads used: %d\n",options->numthreads);
-	#endif
+	if (options->numthreads>1) {
+		fprintf(options->outFileStream,"INFO Number of threads used: %d (placement: %s)\n",options->numthreads,threadbind2str(options->threadBind));
+	}
 
 	if ( options->SBAScorrections == 1 && options->onlySBASiono == 0 ) {
 		fprintf(options->outFileStream,"INFO SBAS processing mode activated\n");
@@ -784,6 +784,11 @@ void printParameters (TOptions *options, TEpoch *epoch, TGNSSproducts *products,
 		}
 		fprintf(options->outFileStream,"INFO MODELLING SBAS GEO acquisiton time: %3d (seconds)\n",options->adquisitiontime);
 		fprintf(options->outFileStream,"INFO MODELLING SBAS switching cooltime:  %3d (seconds)\n",options->minimumswitchtime);
+		if (options->SBASseektime>0) {
+			fprintf(options->outFileStream,"INFO MODELLING SBAS messages decoded before first epoch: %d (seconds)\n",options->SBASseektime);
+		} else {
+			fprintf(options->outFileStream,"INFO MODELLING SBAS messages decoded before first epoch: ALL\n");
+		}
 
 		if (options->switchmode==1) {
 			//Switch mode enabled. Show both timeouts
@@ -1142,7 +1147,7 @@ void printParameters (TOptions *options, TEpoch *epoch, TGNSSproducts *products,
 	}
 	fprintf(options->outFileStream,"INFO FILTER Carrierphase is used: %3s\n",options->usePhase?"YES":"NO");
 	fprintf(options->outFileStream,"INFO FILTER Estimate troposphere: %3s\n",options->estimateTroposphere?"ON":"OFF");
-	fprintf(options->outFileStream,"INFO FILTER %s Processing\n",(options->filterIterations==1)?"Forward":"Backward"); 
+	fprintf(options->outFileStream,"INFO FILTER %s Processing\n",(options->filterIterations==1)?"Forward":(options->smoother==1?"Forward-backward smoothing":"Backward")); 
 	for (i=0;i<MAX_PAR;i++) {
 		if (i==DR_UNK) strcpy (auxstr,"Position:");
 		else if (i==DT_UNK) strcpy (auxstr,"Clock:");
@@ -1245,6 +1250,7 @@ void printParameters (TOptions *options, TEpoch *epoch, TGNSSproducts *products,
 	fprintf(options->outFileStream,"INFO PRINT DGNSS:           %-3s\n",options->printDGNSS?"ON":"OFF");
 	fprintf(options->outFileStream,"INFO PRINT DGNSSUNSED:      %-3s\n",options->printDGNSSUNUSED?"ON":"OFF");
 	fprintf(options->outFileStream,"INFO PRINT SUMMARY:         %-3s\n",options->printSummary?"ON":"OFF");
+	fprintf(options->outFileStream,"INFO PRINT PERF:            %-3s\n",options->printPerf?"ON":"OFF");
 }
 
 /*****************************************************************************
@@ -1837,6 +1843,7 @@ void printOutput (TEpoch *epoch, TEpoch *epochDGNSS, TFilterSolution *solution,
 	static int 					PrevSolutionModeKMLSBAS=PAMODE; 
 	static int 					PrevSolutionModeKML0SBAS=PAMODE; 
 	char 						solutionMode[50];
+	double						perfT = perfStart();
 	
 	// First index of XYZ
 	indx = unkinfo->par2unk[DR_UNK];
@@ -2067,6 +2074,7 @@ void printOutput (TEpoch *epoch, TEpoch *epochDGNSS, TFilterSolution *solution,
 		PrevSolutionModeKML0SBAS=options->precisionapproach;
 		//}
 	}
+	perfStop(perfOUTPUT,perfT);
 }
 
 /*****************************************************************************
@@ -2736,6 +2744,37 @@ void writeSBASdecodesummary (FILE  **fdlist,FILE  *readfd, char *filename, int
 	}
 }
 
+/*****************************************************************************
+ * Name        : writeSBASindexFile
+ * Description : Writes the time index of a SBAS file to disk, so it does not
+ *               have to be built again in the next executions
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * char *filename                  I  N/A  Name of the index file
+ * TSBASindex *index               I  N/A  Time index of the SBAS file
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         1  => File properly written
+ *                                         0  => File could not be opened
+ *****************************************************************************/
+int writeSBASindexFile (char *filename, TSBASindex *index) {
+	FILE	*fd;
+	int		i;
+
+	fd=fopen(filename,"w");
+	if (fd==NULL) return 0;
+
+	fprintf(fd,"%ld %ld %d %d %d %d %.3f %d\n",index->filesize,index->filetime,SBASINDEXVERSION,SBASINDEXSTEP,index->numEntries,index->t.MJDN,index->t.SoD,index->numGEO);
+	for(i=0;i<index->numGEO;i++) {
+		fprintf(fd,"%d %ld\n",index->GEOPRN[i],index->GEOoffset[i]);
+	}
+	for(i=0;i<index->numEntries;i++) {
+		fprintf(fd,"%ld %ld\n",index->offset[i],index->start[i]);
+	}
+	fclose(fd);
+
+	return 1;
+}
+
 
 /*****************************************************************************
  * Name        : writePegasusheaders
@@ -5056,6 +5095,67 @@ void printUserError (TEpoch *epoch, double **SatMeasError, int numpos, TOptions
 	}
 }
 
+/*****************************************************************************
+ * Name        : printPerf
+ * Description : Prints the PERF message with the time spent in each processing
+ *               stage since the previous call, and adds it to the totals
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TOptions  *options              I  N/A  TOptions structure
+ *****************************************************************************/
+void printPerf (TOptions *options) {
+	int		i;
+	double	tNow;
+
+	if (perfStats.enabled==0) return;
+
+	tNow = perfClock();
+	if (perfStats.epochPending) {
+		perfStats.numEpochs++;
+		if (options->printPerf) {
+			fprintf(options->outFileStream,"PERF %17s %9.3f",t2doystr(&perfStats.t),(tNow-perfStats.tEpochStart)*1E3);
+			for (i=0;i<perfNUMSTAGES;i++) {
+				fprintf(options->outFileStream," %9.3f",perfStats.epochTime[i]*1E3);
+			}
+			fprintf(options->outFileStream,"\n");
+		}
+	}
+	for (i=0;i<perfNUMSTAGES;i++) {
+		perfStats.totalTime[i] += perfStats.epochTime[i];
+		perfStats.totalCalls[i] += perfStats.epochCalls[i];
+		perfStats.epochTime[i] = 0;
+		perfStats.epochCalls[i] = 0;
+	}
+	perfStats.tEpochStart = tNow;
+	perfStats.epochPending = 0;
+}
+
+/*****************************************************************************
+ * Name        : printPerfSummary
+ * Description : Prints the PERFTOT messages with the time spent in each
+ *               processing stage during all the processing
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TOptions  *options              I  N/A  TOptions structure
+ *****************************************************************************/
+void printPerfSummary (TOptions *options) {
+	int		i;
+	double	runTime;
+
+	if (perfStats.enabled==0 || options->printPerf==0) return;
+
+	//Add the stages of the last epoch
+	printPerf(options);
+
+	runTime = perfClock()-perfStats.tStart;
+	fprintf(options->outFileStream,"PERFTOT %-10s %12d %12.6f %10.4f %6.2f\n","Total",perfStats.numEpochs,runTime,
+			perfStats.numEpochs>0?runTime/perfStats.numEpochs*1E3:0.,100.);
+	for (i=0;i<perfNUMSTAGES;i++) {
+		fprintf(options->outFileStream,"PERFTOT %-10s %12lld %12.6f %10.4f %6.2f\n",perfstage2str(i),perfStats.totalCalls[i],perfStats.totalTime[i],
+				perfStats.numEpochs>0?perfStats.totalTime[i]/perfStats.numEpochs*1E3:0.,runTime>0?perfStats.totalTime[i]/runTime*100.:0.);
+	}
+}
+
 /*****************************************************************************
  * Name        : writeStdESA
  * Description : Writes the Stanford-ESA plot values into a file
@@ -6667,7 +6767,6 @@ void printSBASSummary (int UseReferenceFile, TEpoch *epoch, TSBASdatabox *SBASda
 
 	int			i;
 	int			GPSWeek;
-	int			percentileSamples;
 	int			year;
 	int			NumEpochsSummaryPeriod,NumEpochsMissingSummary,NumEpochsMissingFile,NumEpochsMissingSumNoDecimation;
 	int			NumEpochsDataGapSummary;
@@ -6784,45 +6883,26 @@ void printSBASSummary (int UseReferenceFile, TEpoch *epoch, TSBASdatabox *SBASda
 			SBASdatabox->VWIR=0.;
 		} else {
 			if (options->recPosProvided==1) {
-				if(options->percentile==100.) {
-					percentileSamples=epoch->TotalEpochsRef-1;
-				} else {
-					percentileSamples=(int)((double)(epoch->TotalEpochsRef)*options->percentile/100.);
-				}
 				//Compute HPE percentile of the samples
-				qsort(epoch->HError,epoch->TotalEpochsRef,sizeof(double),qsort_compare_double);
-				epoch->HPEPercentileSamples=epoch->HError[percentileSamples];
+				epoch->HPEPercentileSamples=percentileSummaryStat(&epoch->HError,options->percentile);
 				//Compute VPE percentile of the samples
-				qsort(epoch->VError,epoch->TotalEpochsRef,sizeof(double),qsort_compare_double);
-				epoch->VPEPercentileSamples=epoch->VError[percentileSamples];
+				epoch->VPEPercentileSamples=percentileSummaryStat(&epoch->VError,options->percentile);
 			}
 		}
-		if(options->percentile==100.) {
-			percentileSamples=SBASdatabox->TotalPAEpochs-1;
-		} else {
-			percentileSamples=(int)((double)(SBASdatabox->TotalPAEpochs)*options->percentile/100.);
-		}
 		//Compute HPL percentile of the samples
-		qsort(SBASdatabox->HPL,SBASdatabox->TotalPAEpochs,sizeof(double),qsort_compare_double);
-		SBASdatabox->HPLPercentileSamples=SBASdatabox->HPL[percentileSamples];
+		SBASdatabox->HPLPercentileSamples=percentileSummaryStat(&SBASdatabox->HPL,options->percentile);
 		//Compute VPL percentile of the samples
-		qsort(SBASdatabox->VPL,SBASdatabox->TotalPAEpochs,sizeof(double),qsort_compare_double);
-		SBASdatabox->VPLPercentileSamples=SBASdatabox->VPL[percentileSamples];
+		SBASdatabox->VPLPercentileSamples=percentileSummaryStat(&SBASdatabox->VPL,options->percentile);
 		//Compute HDOP percentile of the samples
-		qsort(epoch->HDOP,SBASdatabox->TotalPAEpochs,sizeof(double),qsort_compare_double);
-		epoch->HDOPPercentileSamples=epoch->HDOP[percentileSamples];
+		epoch->HDOPPercentileSamples=percentileSummaryStat(&epoch->HDOP,options->percentile);
 		//Compute PDOP percentile of the samples
-		qsort(epoch->PDOP,SBASdatabox->TotalPAEpochs,sizeof(double),qsort_compare_double);
-		epoch->PDOPPercentileSamples=epoch->PDOP[percentileSamples];
+		epoch->PDOPPercentileSamples=percentileSummaryStat(&epoch->PDOP,options->percentile);
 		//Compute GDOP percentile of the samples
-		qsort(epoch->GDOP,SBASdatabox->TotalPAEpochs,sizeof(double),qsort_compare_double);
-		epoch->GDOPPercentileSamples=epoch->GDOP[percentileSamples];
+		epoch->GDOPPercentileSamples=percentileSummaryStat(&epoch->GDOP,options->percentile);
 		//Compute TDOP percentile of the samples
-		qsort(epoch->TDOP,SBASdatabox->TotalPAEpochs,sizeof(double),qsort_compare_double);
-		epoch->TDOPPercentileSamples=epoch->TDOP[percentileSamples];
+		epoch->TDOPPercentileSamples=percentileSummaryStat(&epoch->TDOP,options->percentile);
 		//Compute VDOP percentile of the samples
-		qsort(epoch->VDOP,SBASdatabox->TotalPAEpochs,sizeof(double),qsort_compare_double);
-		epoch->VDOPPercentileSamples=epoch->VDOP[percentileSamples];
+		epoch->VDOPPercentileSamples=percentileSummaryStat(&epoch->VDOP,options->percentile);
 	}
 
 	//Compute availability percentages
@@ -7353,7 +7433,6 @@ void printDGNSSSummary (int UseReferenceFile, TEpoch *epoch, TEpoch *epochDGNSS,
 
     int         i;
     int         GPSWeek;
-    int         percentileSamples;
 	int			year;
 	int			NumEpochsSummaryPeriod,NumEpochsMissingSummary,NumEpochsMissingFile,NumEpochsMissingSumNoDecimation;
 	int			NumEpochsDataGapSummary;
@@ -7399,18 +7478,11 @@ void printDGNSSSummary (int UseReferenceFile, TEpoch *epoch, TEpoch *epochDGNSS,
         epoch->HPEPercentileSamples=0.;
         epoch->VPEPercentileSamples=0.;
     } else {
-		if(options->percentile==100.) {
-			percentileSamples=epoch->TotalEpochsRef-1;
-		} else {
-			percentileSamples=(int)((double)(epoch->TotalEpochsRef)*options->percentile/100.);
-		}
         if (options->recPosProvided==1) {
             //Compute HPE percentile of the samples
-            qsort(epoch->HError,epoch->TotalEpochsRef,sizeof(double),qsort_compare_double);
-            epoch->HPEPercentileSamples=epoch->HError[percentileSamples];
+            epoch->HPEPercentileSamples=percentileSummaryStat(&epoch->HError,options->percentile);
             //Compute VPE percentile of the samples
-            qsort(epoch->VError,epoch->TotalEpochsRef,sizeof(double),qsort_compare_double);
-            epoch->VPEPercentileSamples=epoch->VError[percentileSamples];
+            epoch->VPEPercentileSamples=percentileSummaryStat(&epoch->VError,options->percentile);
         }
     }
 
@@ -7495,26 +7567,16 @@ void printDGNSSSummary (int UseReferenceFile, TEpoch *epoch, TEpoch *epochDGNSS,
 		epoch->TDOPPercentileSamples=0.;
 		epoch->VDOPPercentileSamples=0.;
 	} else {
-		if(options->percentile==100.) {
-			percentileSamples=epoch->TotalEpochsDGNSS-1;
-		} else {
-			percentileSamples=(int)((double)(epoch->TotalEpochsDGNSS)*options->percentile/100.);
-		}
 		//Compute HDOP percentile of the samples
-		qsort(epoch->HDOP,epoch->TotalEpochsDGNSS,sizeof(double),qsort_compare_double);
-		epoch->HDOPPercentileSamples=epoch->HDOP[percentileSamples];
+		epoch->HDOPPercentileSamples=percentileSummaryStat(&epoch->HDOP,options->percentile);
 		//Compute PDOP percentile of the samples
-		qsort(epoch->PDOP,epoch->TotalEpochsDGNSS,sizeof(double),qsort_compare_double);
-		epoch->PDOPPercentileSamples=epoch->PDOP[percentileSamples];
+		epoch->PDOPPercentileSamples=percentileSummaryStat(&epoch->PDOP,options->percentile);
 		//Compute GDOP percentile of the samples
-		qsort(epoch->GDOP,epoch->TotalEpochsDGNSS,sizeof(double),qsort_compare_double);
-		epoch->GDOPPercentileSamples=epoch->GDOP[percentileSamples];
+		epoch->GDOPPercentileSamples=percentileSummaryStat(&epoch->GDOP,options->percentile);
 		//Compute TDOP percentile of the samples
-		qsort(epoch->TDOP,epoch->TotalEpochsDGNSS,sizeof(double),qsort_compare_double);
-		epoch->TDOPPercentileSamples=epoch->TDOP[percentileSamples];
+		epoch->TDOPPercentileSamples=percentileSummaryStat(&epoch->TDOP,options->percentile);
 		//Compute VDOP percentile of the samples
-		qsort(epoch->VDOP,epoch->TotalEpochsDGNSS,sizeof(double),qsort_compare_double);
-		epoch->VDOPPercentileSamples=epoch->VDOP[percentileSamples];
+		epoch->VDOPPercentileSamples=percentileSummaryStat(&epoch->VDOP,options->percentile);
 	}
 
     //Compute availability percentages for Stanford-ESA if required
@@ -7881,9 +7943,8 @@ void printDGNSSSummary (int UseReferenceFile, TEpoch *epoch, TEpoch *epochDGNSS,
  *****************************************************************************/
 void printSummary (int UseReferenceFile, TEpoch *epoch, TStdESA *StdESA, TOptions *options) {
 
-    int         i;
+    int         i,j;
     int         GPSWeek;
-    int         percentileSamples;
 	int			year;
 	int			NumEpochsSummaryPeriod,NumEpochsMissingSummary,NumEpochsMissingFile,NumEpochsMissingSumNoDecimation;
 	int			NumEpochsDataGapSummary;
@@ -7898,6 +7959,9 @@ void printSummary (int UseReferenceFile, TEpoch *epoch, TStdESA *StdESA, TOption
     char        receiverid[5];
 	TTime		LastEpoch,LastEpochDataGaps;
 	struct tm   tm;
+	TSummaryData	summary,summaryAdd;
+	TSummaryStat	statAdd[SUMMARY_NUM_STATS];
+	TSummaryStat	*stat[SUMMARY_NUM_STATS]={&epoch->HError,&epoch->VError,&epoch->HDOP,&epoch->PDOP,&epoch->GDOP,&epoch->VDOP,&epoch->TDOP};
 
     //Convert receiver name to lower case
     for(i=0;i<4;i++) {
@@ -7920,30 +7984,6 @@ void printSummary (int UseReferenceFile, TEpoch *epoch, TStdESA *StdESA, TOption
 		PercentileDigits=3;
 	}
 
-    // Check number of TotalEpochsSol for printable values
-    if(epoch->TotalEpochsRef==0) {
-        epoch->MaxHError=0.;
-        epoch->MaxVError=0.;
-        //epoch->HPEPercentileValues=0.;
-        //epoch->VPEPercentileValues=0.;
-        epoch->HPEPercentileSamples=0.;
-        epoch->VPEPercentileSamples=0.;
-    } else {
-		if(options->percentile==100.) {
-			percentileSamples=epoch->TotalEpochsRef-1;
-		} else {
-	        percentileSamples=(int)((double)(epoch->TotalEpochsRef)*options->percentile/100.);
-		}
-        if (options->recPosProvided==1) {
-            //Compute HPE percentile of the samples
-            qsort(epoch->HError,epoch->TotalEpochsRef,sizeof(double),qsort_compare_double);
-            epoch->HPEPercentileSamples=epoch->HError[percentileSamples];
-            //Compute VPE percentile of the samples
-            qsort(epoch->VError,epoch->TotalEpochsRef,sizeof(double),qsort_compare_double);
-            epoch->VPEPercentileSamples=epoch->VError[percentileSamples];
-        }
-    }
-
 	//Get last epoch processed
 	if (options->EndEpoch.MJDN!=-1) {
 		if (tdiff(&options->EndEpoch,&epoch->t)>0.) {
@@ -8004,6 +8044,64 @@ void printSummary (int UseReferenceFile, TEpoch *epoch, TStdESA *StdESA, TOption
 		NumEpochsMissingFile=0;
 	}
 
+	//Add the summaries saved in other runs and save the resulting summary
+	if (options->numSummaryMergeFiles>0 || options->summarySaveFile[0]!='\0') {
+		epoch2SummaryData(epoch,StdESA,&summary);
+		summary.NumEpochsMissingSummary=NumEpochsMissingSummary;
+		summary.NumEpochsMissingSumNoDecimation=NumEpochsMissingSumNoDecimation;
+		summary.NumEpochsMissingFile=NumEpochsMissingFile;
+		if (epoch->StartSummaryEpoch.MJDN!=-1) {
+			memcpy(&summary.LastSummaryEpoch,&LastEpoch,sizeof(TTime));
+		} else {
+			summary.LastSummaryEpoch.MJDN=-1;
+			summary.LastSummaryEpoch.SoD=0.;
+		}
+		for(i=0;i<options->numSummaryMergeFiles;i++) {
+			if (readSummaryFile(options->summaryMergeFiles[i],&summaryAdd,statAdd)==0) {
+				sprintf(messagestr,"Summary file '%s' could not be read. It must be saved with '-summary:save' by this gLAB version",options->summaryMergeFiles[i]);
+				printError(messagestr,options);
+			}
+			mergeSummaryData(&summary,&summaryAdd);
+			for(j=0;j<SUMMARY_NUM_STATS;j++) {
+				if (mergeSummaryStat(stat[j],&statAdd[j])==0) {
+					sprintf(messagestr,"Summary file '%s' was saved with '-summary:sketch'. This option must also be set for merging it",options->summaryMergeFiles[i]);
+					printError(messagestr,options);
+				}
+				freeSummaryStat(&statAdd[j]);
+			}
+		}
+		if (options->summarySaveFile[0]!='\0') {
+			if (writeSummaryFile(options->summarySaveFile,&summary,stat)==0) {
+				sprintf(messagestr,"Summary file '%s' could not be written",options->summarySaveFile);
+				printError(messagestr,options);
+			}
+		}
+		summaryData2epoch(&summary,epoch,StdESA);
+		NumEpochsMissingSummary=summary.NumEpochsMissingSummary;
+		NumEpochsMissingSumNoDecimation=summary.NumEpochsMissingSumNoDecimation;
+		NumEpochsMissingFile=summary.NumEpochsMissingFile;
+		if (summary.LastSummaryEpoch.MJDN!=-1) {
+			memcpy(&LastEpoch,&summary.LastSummaryEpoch,sizeof(TTime));
+		}
+	}
+
+    // Check number of TotalEpochsSol for printable values
+    if(epoch->TotalEpochsRef==0) {
+        epoch->MaxHError=0.;
+        epoch->MaxVError=0.;
+        //epoch->HPEPercentileValues=0.;
+        //epoch->VPEPercentileValues=0.;
+        epoch->HPEPercentileSamples=0.;
+        epoch->VPEPercentileSamples=0.;
+    } else {
+        if (options->recPosProvided==1) {
+            //Compute HPE percentile of the samples
+            epoch->HPEPercentileSamples=percentileSummaryStat(&epoch->HError,options->percentile);
+            //Compute VPE percentile of the samples
+            epoch->VPEPercentileSamples=percentileSummaryStat(&epoch->VError,options->percentile);
+        }
+    }
+
 	//Get total number of epochs in data gaps in summary
 	if(DataInterval>epoch->receiver.interval) {
 		NumEpochsDataGapSummary=NumEpochsMissingSummary+NumEpochsMissingSumNoDecimation;
@@ -8045,26 +8143,16 @@ void printSummary (int UseReferenceFile, TEpoch *epoch, TStdESA *StdESA, TOption
 		epoch->TDOPPercentileSamples=0.;
 		epoch->VDOPPercentileSamples=0.;
 	} else {
-		if(options->percentile==100.) {
-			percentileSamples=epoch->TotalEpochsSol-1;
-		} else {
-			percentileSamples=(int)((double)(epoch->TotalEpochsSol)*options->percentile/100.);
-		}
 		//Compute HDOP percentile of the samples
-		qsort(epoch->HDOP,epoch->TotalEpochsSol,sizeof(double),qsort_compare_double);
-		epoch->HDOPPercentileSamples=epoch->HDOP[percentileSamples];
+		epoch->HDOPPercentileSamples=percentileSummaryStat(&epoch->HDOP,options->percentile);
 		//Compute PDOP percentile of the samples
-		qsort(epoch->PDOP,epoch->TotalEpochsSol,sizeof(double),qsort_compare_double);
-		epoch->PDOPPercentileSamples=epoch->PDOP[percentileSamples];
+		epoch->PDOPPercentileSamples=percentileSummaryStat(&epoch->PDOP,options->percentile);
 		//Compute GDOP percentile of the samples
-		qsort(epoch->GDOP,epoch->TotalEpochsSol,sizeof(double),qsort_compare_double);
-		epoch->GDOPPercentileSamples=epoch->GDOP[percentileSamples];
+		epoch->GDOPPercentileSamples=percentileSummaryStat(&epoch->GDOP,options->percentile);
 		//Compute TDOP percentile of the samples
-		qsort(epoch->TDOP,epoch->TotalEpochsSol,sizeof(double),qsort_compare_double);
-		epoch->TDOPPercentileSamples=epoch->TDOP[percentileSamples];
+		epoch->TDOPPercentileSamples=percentileSummaryStat(&epoch->TDOP,options->percentile);
 		//Compute VDOP percentile of the samples
-		qsort(epoch->VDOP,epoch->TotalEpochsSol,sizeof(double),qsort_compare_double);
-		epoch->VDOPPercentileSamples=epoch->VDOP[percentileSamples];
+		epoch->VDOPPercentileSamples=percentileSummaryStat(&epoch->VDOP,options->percentile);
 	}
 
 
@@ -272,6 +272,7 @@ void writeRinexBfile (FILE **fdlist, FILE  *readfd, char *filename, char **line,
 void writeEMSfile (FILE **fdlist, FILE  *readfd, char *filename, char **line, int numlines, int header, int sourcefile, TSBASblock  *sbasblock, TOptions  *optionGs);
 void writeLogfile (FILE **fdlist, FILE  *readfd, char *filename, char **line, int numlines, int sourcefile, int decoderesult, TSBASblock  *sbasblock, TOptions  *options);
 void writeSBASdecodesummary (FILE  **fdlist,FILE  *readfd, char *filename, int  numberofbadmessages, int  totalmessagesmissing, int  msgmissingdetected, int  *linesmissing, int  *listmissing, TOptions  *options);
+int writeSBASindexFile (char *filename, TSBASindex *index);
 void writePegasusheaders (FILE **fdlist, FILE *readfd, char **filelist, TOptions  *options);
 void writePegasusfiles (FILE **fdlist, FILE *readfd, char **filelist, char **line, int numlines, int sourcefile, int header, int decoderesult, int decodedmessagetype, int *prevday, TSBASblock  *sbasblock, TOptions  *options);
 void printSBASCORR (TEpoch *epoch, TSBASdata *SBASdata, TSBAScorr *SBAScorr, int satIndex, int measIndex, double flightTime, double geometricDistance, double satelliteClockModel, double satellitePhaseCenterProjection, double receiverPhaseCenterProjection, double receiverARPProjection, double relativityModel, double windUpMetModel, double troposphereModel, double ionosphereModel, double gravitationalDelayModel, double TGDModel, double solidTidesModel, TOptions *options);
@@ -292,6 +293,10 @@ void printDGNSS (TEpoch *epoch, TEpoch *epochDGNSS, int satIndex, double dt, dou
 // User added error functions
 void printUserError (TEpoch *epoch, double **SatMeasError, int numpos, TOptions *options);
 
+// Performance instrumentation
+void printPerf (TOptions *options);
+void printPerfSummary (TOptions *options);
+
 // Stanford-ESA plot
 void writeStdESA (FILE *fd, TStdESA *StdESA, TOptions *options);
 
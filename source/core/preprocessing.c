@@ -291,12 +291,18 @@
  *                                         2 => Process Reference Station (DGNSS)
  *****************************************************************************/
 void preprocess (TEpoch *epoch, TOptions *options, int mode) {
+	double	perfT = perfStart();
+	double	perfTCS;
+
 	if ( epoch->receiver.look4interval ) look4interval(epoch, options);
 	if ( options->checkPhaseCodeJumps ) checkPseudorangeJumps(epoch, options);
 	if ( options->prealignCP ) prealignEpoch(epoch);
+	perfTCS = perfStart();
 	checkCycleSlips(epoch, options, mode);
+	perfStop(perfCYCLESLIPS, perfTCS);
 	smoothEpoch(epoch, options);
 	if ( options->sigmaInflation && mode != 0 ) sigmaInflation(epoch, options);
+	perfStop(perfPREPROCESS, perfT);
 }
 
 /*****************************************************************************
@@ -455,6 +461,35 @@ int isEpochDecimated (TEpoch *epoch, TOptions *options) {
 	}
 }
 
+/*****************************************************************************
+ * Name        : canSkipDecimatedEpochs
+ * Description : Returns if the decimated epochs can be skipped without reading
+ *               their measurements. Decimated epochs still go through the
+ *               preprocessing (cycle-slip detectors, smoothing, prealignment...),
+ *               so they can only be skipped when the preprocessing only needs
+ *               the list of satellites of the epoch (to update the arc lengths)
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * TOptions  *options              I  N/A  TOptions structure for configuration
+ * Returned value (int)            O  N/A  Status of the function
+ *                                         0 => Decimated epochs must be read
+ *                                         1 => Decimated epochs can be skipped
+ *****************************************************************************/
+int canSkipDecimatedEpochs (TOptions *options) {
+
+	if ( options->decimate == 0. ) return 0;
+	if ( options->csL1C1 || options->csBW || options->csLI || options->csLLI ) return 0;
+	//N-consecutive may be automatically enabled again when computing the interval
+	if ( options->csNcon || options->csNconAutoDisabled ) return 0;
+	if ( options->SNRfilter || options->smoothEpochs ) return 0;
+	if ( options->prealignCP || options->checkPhaseCodeJumps ) return 0;
+	//SBAS, DGNSS and user added noise need the measurements of all epochs
+	if ( options->SBAScorrections || options->DGNSS || options->useraddednoise ) return 0;
+	if ( options->followMode ) return 0;
+
+	return 1;
+}
+
 /*****************************************************************************
  * Name        : isEclipsed
  * Description : Check if a satellite is under eclipse (or has been for the
@@ -583,6 +618,42 @@ void prealignEpoch (TEpoch *epoch) {
 	}
 }
 
+/*****************************************************************************
+ * Name        : lagrangeWeights
+ * Description : Compute the weights of the samples of a Lagrange interpolation
+ *               of specified degree. The interpolated value is the sum of the
+ *               weights multiplied by the sample values, so the weights can be
+ *               reused for all the values sampled at the same times
+ * Parameters  :
+ * Name                           |Da|Unit|Description
+ * int  degree                     I  N/A  Degree of the interpolation
+ * TTime  *t                       I  N/A  Target x point to interpolate in TTime
+ *                                         format
+ * TTime  *tPrev                   I  N/A  x axis in TTime format
+ * double  *weights                O  N/A  Weight of each sample (degree+1 values)
+ *****************************************************************************/
+void lagrangeWeights (int degree, TTime *t, TTime *tPrev, double *weights) {
+	int			i,j;
+	double		xPrev[2*(MAX_INTERPOLATION_DEGREE+1)],x;
+	TTimeNs		tRefNs;
+
+	// Fill xPrev and x with tPrev and t values. The sample times are exact in nanoseconds,
+	// while the target time keeps its fraction of nanosecond
+	tRefNs = t2ns(&tPrev[0]); // Reference time
+	x = tdiff(t,&tPrev[0]);
+	for (i=0;i<=degree;i++)
+		xPrev[i] = nsdiff(t2ns(&tPrev[i]),tRefNs);
+
+	for ( i=0;i<=degree;i++ ) {
+		weights[i] = 1;
+		for ( j=0;j<=degree;j++ ) {
+			if ( i != j ) {
+				weights[i] *= (x-xPrev[j])/(xPrev[i]-xPrev[j]); 
+			}
+		}
+	}
+}
+
 /*****************************************************************************
  * Name        : lagrangeInterpolation
  * Description : Performs a Lagrange interpolation of specified degree
@@ -596,33 +667,17 @@ void prealignEpoch (TEpoch *epoch) {
  * Returned value (double)         O  N/A  Interpolated value at t
  *****************************************************************************/
 double lagrangeInterpolation (int degree, TTime t, TTime *tPrev, double *yPrev) {
-	int			i,j;
-	double		yEst,prod;
-	double		*xPrev,x;
-	TTime		tRef;
+	int			i;
+	double		yEst;
+	double		weights[2*(MAX_INTERPOLATION_DEGREE+1)];
 	
-	yEst = 0;
-	xPrev = malloc(sizeof(double)*(degree+1));
+	lagrangeWeights(degree,&t,tPrev,weights);
 
-	// Fill xPrev and x with tPrev and t values   
-	memcpy(&tRef,&tPrev[0],sizeof(TTime)); // Reference time
-	x = tdiff(&t,&tRef);
-	for (i=0;i<=degree;i++)
-		xPrev[i] = tdiff(&tPrev[i],&tRef);
-				
 	// Perform the interpolation
+	yEst = 0;
 	for ( i=0;i<=degree;i++ ) {
-		prod = 1;
-		for ( j=0;j<=degree;j++ ) {
-			if ( i != j ) {
-				prod *= (x-xPrev[j])/(xPrev[i]-xPrev[j]); 
-			}
-		}
-		prod *= yPrev[i];
-		yEst += prod;
+		yEst += weights[i]*yPrev[i];
 	}
-
-	free(xPrev);
 	
 	return yEst;
 }
@@ -898,14 +953,20 @@ void checkCycleSlips (TEpoch *epoch, TOptions *options, int mode) {
 
 	int				ii;
 	int				allCSDetectorsOff=0; //This variable is not changed, no need to declare it private in the for loop for multithreading
+	TTimeNs			tEpochNs;			//Current epoch and sliding window lengths in nanoseconds, computed once for all satellites
+	TTimeNs			L1C1windowNs,BWwindowNs;
 
 	if ( options->csL1C1 == 0 && options->csBW == 0 && options->csLI == 0 && options->csLLI == 0 ) {
 		allCSDetectorsOff=1;
 	}
+
+	tEpochNs = t2ns(&epoch->t);
+	L1C1windowNs = (TTimeNs)options->csL1C1window*NSPERSECOND;
+	BWwindowNs = (TTimeNs)options->csBWwindow*NSPERSECOND;
 	
 
 	// Go over all the satellites
-	#pragma omp parallel for 
+	#pragma omp parallel for if(options->numthreads>1 && epoch->numSatellites>=MIN_SATELLITES_PARALLEL)
 	for ( ii=0;ii<epoch->numSatellites;ii++ ) {
 		
 		//In this case, variable are declared inside the loop. This is done to allow some compiler optimizations in single thread (as
@@ -1373,19 +1434,17 @@ void checkCycleSlips (TEpoch *epoch, TOptions *options, int mode) {
 			// Update the L1C1 parameters
 			if ( options->csL1C1 && measL1C1 && epoch->cycleslip.Nconsecutive[i] == 0 && epoch->cycleslip.outlierLI[i] != 1 && epoch->cycleslip.outlierBw[i] != 1 ) {
 				// Update sliding window
-				for ( j=0;j<MAX_SLIDING_WINDOW-1;j++ ) {
-					epoch->cycleslip.windowL1C1[i][j] = epoch->cycleslip.windowL1C1[i][j+1];
-					epoch->cycleslip.windowL1C1time[i][j] = epoch->cycleslip.windowL1C1time[i][j+1];
-				}
+				memmove(&epoch->cycleslip.windowL1C1[i][0],&epoch->cycleslip.windowL1C1[i][1],sizeof(double)*(MAX_SLIDING_WINDOW-1));
+				memmove(&epoch->cycleslip.windowL1C1time[i][0],&epoch->cycleslip.windowL1C1time[i][1],sizeof(TTimeNs)*(MAX_SLIDING_WINDOW-1));
 				epoch->cycleslip.windowL1C1[i][MAX_SLIDING_WINDOW-1] = L1-C1;
-				epoch->cycleslip.windowL1C1time[i][MAX_SLIDING_WINDOW-1] = tsec(&epoch->t);
+				epoch->cycleslip.windowL1C1time[i][MAX_SLIDING_WINDOW-1] = tEpochNs;
 
 				// Computing the number of samples in inside the sliding window
+				// The window is filled in time order, so stop at the first sample out of the window
 				samples = 0;
-				for ( j=0;j<MAX_SLIDING_WINDOW;j++ ) {
-					if ( tsec(&epoch->t)-epoch->cycleslip.windowL1C1time[i][j] < options->csL1C1window ) {
-						samples++;
-					}
+				for ( j=MAX_SLIDING_WINDOW-1;j>=0;j-- ) {
+					if ( tEpochNs-epoch->cycleslip.windowL1C1time[i][j] >= L1C1windowNs ) break;
+					samples++;
 				}
 
 				// Computing the mean and quadratic mean in the sliding window
@@ -1417,19 +1476,17 @@ void checkCycleSlips (TEpoch *epoch, TOptions *options, int mode) {
 				}
 
 				// Update sliding window
-				for ( j=0;j<MAX_SLIDING_WINDOW-1;j++ ) {
-					epoch->cycleslip.windowMW[i][j] = epoch->cycleslip.windowMW[i][j+1];
-					epoch->cycleslip.windowMWtime[i][j] = epoch->cycleslip.windowMWtime[i][j+1];
-				}
+				memmove(&epoch->cycleslip.windowMW[i][0],&epoch->cycleslip.windowMW[i][1],sizeof(double)*(MAX_SLIDING_WINDOW-1));
+				memmove(&epoch->cycleslip.windowMWtime[i][0],&epoch->cycleslip.windowMWtime[i][1],sizeof(TTimeNs)*(MAX_SLIDING_WINDOW-1));
 				epoch->cycleslip.windowMW[i][MAX_SLIDING_WINDOW-1] = Bw;
-				epoch->cycleslip.windowMWtime[i][MAX_SLIDING_WINDOW-1] = tsec(&epoch->t);
+				epoch->cycleslip.windowMWtime[i][MAX_SLIDING_WINDOW-1] = tEpochNs;
 
 				// Computing the number of samples in inside the sliding window
+				// The window is filled in time order, so stop at the first sample out of the window
 				samples = 0;
-				for ( j=0;j<MAX_SLIDING_WINDOW;j++ ) {
-					if ( tsec(&epoch->t)-epoch->cycleslip.windowMWtime[i][j] < options->csBWwindow ) {
-						samples++;
-					}
+				for ( j=MAX_SLIDING_WINDOW-1;j>=0;j-- ) {
+					if ( tEpochNs-epoch->cycleslip.windowMWtime[i][j] >= BWwindowNs ) break;
+					samples++;
 				}
 
 				// Computing the mean value for the sliding window
@@ -243,6 +243,7 @@ void preprocess (TEpoch *epoch, TOptions *options, int mode);
 
 // Decimation
 int isEpochDecimated (TEpoch *epoch, TOptions *options);
+int canSkipDecimatedEpochs (TOptions *options);
 
 // Eclipse
 int isEclipsed (TTime *t, TSatellite *sat, TSatInfo *satInfo, double sunPos[3], double *tLast);
@@ -252,6 +253,7 @@ void prealignSat (TEpoch *epoch, int ind);
 void prealignEpoch (TEpoch *epoch);
 
 // Data checks and cycle-slip detection
+void lagrangeWeights (int degree, TTime *t, TTime *tPrev, double *weights);
 double lagrangeInterpolation (int degree, TTime t, TTime *tPrev, double *yPrev);
 int checkPseudorangeJumps (TEpoch *epoch, TOptions *options);
 double polyfit (TEpoch *epoch, TOptions *options, int i, int type, int numsamples, double *res);